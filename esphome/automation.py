@@ -52,7 +52,21 @@ def maybe_conf(conf, *validators):
     return validate
 
 
-def register_action(name: str, action_type: MockObjClass, schema: cv.Schema):
+def register_action(
+    name: str,
+    action_type: MockObjClass,
+    schema: cv.Schema,
+    *,
+    synchronous: bool = False,
+):
+    """Register an action.
+
+    Set synchronous for actions that finish within play() and don't override
+    play_complex(). Straight-line runs of them are played by one SequenceAction
+    instead of being chained.
+    """
+    if synchronous:
+        SYNCHRONOUS_ACTIONS.add(name)
     return ACTION_REGISTRY.register(name, action_type, schema)
 
 
@@ -63,6 +77,7 @@ def register_condition(name: str, condition_type: MockObjClass, schema: cv.Schem
 Action = cg.esphome_ns.class_("Action")
 Trigger = cg.esphome_ns.class_("Trigger")
 ACTION_REGISTRY = Registry()
+SYNCHRONOUS_ACTIONS: set[str] = set()
 Condition = cg.esphome_ns.class_("Condition")
 CONDITION_REGISTRY = Registry()
 validate_action = cv.validate_registry_entry("action", ACTION_REGISTRY)
@@ -87,6 +102,7 @@ def validate_potentially_or_condition(value):
 
 DelayAction = cg.esphome_ns.class_("DelayAction", Action, cg.Component)
 LambdaAction = cg.esphome_ns.class_("LambdaAction", Action)
+SequenceAction = cg.esphome_ns.class_("SequenceAction", Action)
 IfAction = cg.esphome_ns.class_("IfAction", Action)
 WhileAction = cg.esphome_ns.class_("WhileAction", Action)
 RepeatAction = cg.esphome_ns.class_("RepeatAction", Action)
@@ -398,7 +414,7 @@ async def wait_until_action_to_code(
     return var
 
 
-@register_action("lambda", LambdaAction, cv.lambda_)
+@register_action("lambda", LambdaAction, cv.lambda_, synchronous=True)
 async def lambda_action_to_code(
     config: ConfigType,
     action_id: ID,
@@ -417,6 +433,7 @@ async def lambda_action_to_code(
             cv.Required(CONF_ID): cv.use_id(cg.PollingComponent),
         }
     ),
+    synchronous=True,
 )
 async def component_update_action_to_code(
     config: ConfigType,
@@ -488,9 +505,29 @@ async def build_action_list(
     config: list[ConfigType], templ: cg.TemplateArguments, arg_type: TemplateArgsType
 ) -> list[MockObj]:
     actions: list[MockObj] = []
+    # Built synchronous actions not added to actions yet, and their first ID
+    sequence: list[MockObj] = []
+    sequence_id: ID | None = None
+
+    def end_sequence():
+        nonlocal sequence, sequence_id
+        if len(sequence) > 1:
+            id_ = ID(f"{sequence_id.id}_sequence", True, SequenceAction)
+            actions.append(cg.new_Pvariable(id_, templ, sequence))
+        else:
+            actions.extend(sequence)
+        sequence = []
+
     for conf in config:
-        action = await build_action(conf, templ, arg_type)
-        actions.append(action)
+        registry_entry, _ = cg.extract_registry_entry_config(ACTION_REGISTRY, conf)
+        if registry_entry.name not in SYNCHRONOUS_ACTIONS:
+            end_sequence()
+            actions.append(await build_action(conf, templ, arg_type))
+            continue
+        if not sequence:
+            sequence_id = conf[CONF_TYPE_ID]
+        sequence.append(await build_action(conf, templ, arg_type))
+    end_sequence()
     return actions
 
 
@@ -0,0 +1,153 @@
+from esphome import automation
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_SOURCE, CONF_TRIGGER_ID
+
+AUTO_LOAD = ["sha256"]
+CODEOWNERS = ["@esphome/core"]
+
+access_control_ns = cg.esphome_ns.namespace("access_control")
+AccessControl = access_control_ns.class_("AccessControl", cg.Component)
+
+CredentialSource = access_control_ns.enum("CredentialSource")
+CREDENTIAL_SOURCES = {
+    "fingerprint": CredentialSource.CREDENTIAL_SOURCE_FINGERPRINT,
+    "nfc": CredentialSource.CREDENTIAL_SOURCE_NFC,
+    "wiegand": CredentialSource.CREDENTIAL_SOURCE_WIEGAND,
+    "pin": CredentialSource.CREDENTIAL_SOURCE_PIN,
+}
+
+GrantedTrigger = access_control_ns.class_(
+    "GrantedTrigger", automation.Trigger.template(cg.std_string, cg.std_string)
+)
+DeniedTrigger = access_control_ns.class_(
+    "DeniedTrigger", automation.Trigger.template(cg.std_string, cg.std_string)
+)
+CheckAction = access_control_ns.class_("CheckAction", automation.Action)
+AddCredentialAction = access_control_ns.class_(
+    "AddCredentialAction", automation.Action
+)
+RemoveCredentialAction = access_control_ns.class_(
+    "RemoveCredentialAction", automation.Action
+)
+ClearCredentialsAction = access_control_ns.class_(
+    "ClearCredentialsAction", automation.Action
+)
+IsAllowedCondition = access_control_ns.class_(
+    "IsAllowedCondition", automation.Condition
+)
+
+CONF_CREDENTIAL = "credential"
+CONF_CREDENTIALS = "credentials"
+CONF_MAX_CREDENTIALS = "max_credentials"
+CONF_ON_DENIED = "on_denied"
+CONF_ON_GRANTED = "on_granted"
+
+
+CREDENTIAL_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_SOURCE): cv.enum(CREDENTIAL_SOURCES, lower=True),
+        cv.Required(CONF_CREDENTIAL): cv.string_strict,
+    }
+)
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(AccessControl),
+        cv.Optional(CONF_MAX_CREDENTIALS, default=64): cv.int_range(min=1, max=1024),
+        cv.Optional(CONF_CREDENTIALS, default=[]): cv.ensure_list(CREDENTIAL_SCHEMA),
+        cv.Optional(CONF_ON_GRANTED): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(GrantedTrigger),
+            }
+        ),
+        cv.Optional(CONF_ON_DENIED): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(DeniedTrigger),
+            }
+        ),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_max_credentials(config[CONF_MAX_CREDENTIALS]))
+    # Hashed on the device, the salt is generated there on first boot
+    for conf in config[CONF_CREDENTIALS]:
+        cg.add(var.add_static_credential(conf[CONF_SOURCE], conf[CONF_CREDENTIAL]))
+
+    for conf in config.get(CONF_ON_GRANTED, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(
+            trigger, [(cg.std_string, "source"), (cg.std_string, "credential")], conf
+        )
+
+    for conf in config.get(CONF_ON_DENIED, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(
+            trigger, [(cg.std_string, "source"), (cg.std_string, "credential")], conf
+        )
+
+
+CREDENTIAL_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(AccessControl),
+        cv.Required(CONF_SOURCE): cv.enum(CREDENTIAL_SOURCES, lower=True),
+        cv.Required(CONF_CREDENTIAL): cv.templatable(cv.string),
+    }
+)
+
+
+@automation.register_action(
+    "access_control.check", CheckAction, CREDENTIAL_ACTION_SCHEMA
+)
+@automation.register_action(
+    "access_control.add_credential", AddCredentialAction, CREDENTIAL_ACTION_SCHEMA
+)
+@automation.register_action(
+    "access_control.remove_credential",
+    RemoveCredentialAction,
+    CREDENTIAL_ACTION_SCHEMA,
+)
+async def access_control_credential_action_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    cg.add(var.set_source(config[CONF_SOURCE]))
+    template_ = await cg.templatable(config[CONF_CREDENTIAL], args, cg.std_string)
+    cg.add(var.set_credential(template_))
+    return var
+
+
+@automation.register_action(
+    "access_control.clear_credentials",
+    ClearCredentialsAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(AccessControl),
+        }
+    ),
+)
+async def access_control_clear_credentials_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_condition(
+    "access_control.is_allowed", IsAllowedCondition, CREDENTIAL_ACTION_SCHEMA
+)
+async def access_control_is_allowed_to_code(config, condition_id, template_arg, args):
+    var = cg.new_Pvariable(condition_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    cg.add(var.set_source(config[CONF_SOURCE]))
+    template_ = await cg.templatable(config[CONF_CREDENTIAL], args, cg.std_string)
+    cg.add(var.set_credential(template_))
+    return var
@@ -0,0 +1,186 @@
+#include "access_control.h"
+
+#include <algorithm>
+
+#include "esphome/components/sha256/sha256.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+namespace access_control {
+
+static const char *const TAG = "access_control";
+
+const LogString *credential_source_to_string(CredentialSource source) {
+  switch (source) {
+    case CREDENTIAL_SOURCE_FINGERPRINT:
+      return LOG_STR("fingerprint");
+    case CREDENTIAL_SOURCE_NFC:
+      return LOG_STR("nfc");
+    case CREDENTIAL_SOURCE_WIEGAND:
+      return LOG_STR("wiegand");
+    case CREDENTIAL_SOURCE_PIN:
+      return LOG_STR("pin");
+    default:
+      return LOG_STR("unknown");
+  }
+}
+
+uint64_t AccessControl::hash_credential(CredentialSource source, const std::string &credential) const {
+  sha256::SHA256 sha;
+  sha.init();
+  sha.add(this->salt_.bytes, SALT_SIZE);
+  // The source is part of the key, so finger 1234 and PIN 1234 are different credentials
+  const uint8_t source_byte = source;
+  sha.add(&source_byte, 1);
+  sha.add(credential);
+  sha.calculate();
+  uint8_t digest[32];
+  sha.get_bytes(digest);
+  const uint64_t hash = encode_value<uint64_t>(digest);
+  // 0 marks an empty slot
+  return hash == 0 ? 1 : hash;
+}
+
+bool AccessControl::load_salt_() {
+  ESPPreferenceObject pref = global_preferences->make_preference<Salt>(fnv1_hash("access_control_salt"));
+  if (pref.load(&this->salt_))
+    return true;
+  if (!random_bytes(this->salt_.bytes, SALT_SIZE))
+    return false;
+  return pref.save(&this->salt_);
+}
+
+void AccessControl::setup() {
+  if (!this->load_salt_()) {
+    ESP_LOGE(TAG, "Could not create the credential salt");
+    this->mark_failed();
+    return;
+  }
+  this->static_credentials_.reserve(this->pending_static_credentials_.size());
+  for (const auto &configured : this->pending_static_credentials_)
+    this->static_credentials_.push_back(this->hash_credential(configured.first, configured.second));
+  this->pending_static_credentials_.clear();
+  this->pending_static_credentials_.shrink_to_fit();
+  std::sort(this->static_credentials_.begin(), this->static_credentials_.end());
+
+  // Room for a removal record of every configured credential next to the added ones
+  const uint16_t max_records = this->max_credentials_ + this->static_credentials_.size();
+  if (!this->table_.init(max_records, fnv1_hash("access_control_credentials"))) {
+    ESP_LOGE(TAG, "Could not allocate the allowlist");
+    this->mark_failed();
+    return;
+  }
+
+  // Removal records of credentials that left the configuration have no effect anymore
+  std::vector<uint64_t> stale;
+  this->table_.for_each([this, &stale](const CredentialRecord &record) {
+    if (!record.removed)
+      return;
+    if (this->is_static_(record.hash)) {
+      this->removed_count_++;
+    } else {
+      stale.push_back(record.hash);
+    }
+  });
+  for (uint64_t hash : stale)
+    this->table_.erase(hash);
+  this->table_.save();
+}
+
+void AccessControl::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Access Control:\n"
+                "  Configured credentials: %u (%u removed)\n"
+                "  Added credentials: %u of %u",
+                (unsigned) this->static_credentials_.size(), this->removed_count_, this->get_added_count_(),
+                this->max_credentials_);
+}
+
+uint16_t AccessControl::get_credential_count() const {
+  return this->get_added_count_() + this->static_credentials_.size() - this->removed_count_;
+}
+
+bool AccessControl::check(CredentialSource source, const std::string &credential) {
+  const bool allowed = this->is_allowed(source, credential);
+  // PIN codes are secret, the other credentials identify the user in the log
+  const char *shown = source == CREDENTIAL_SOURCE_PIN ? "****" : credential.c_str();
+  if (allowed) {
+    ESP_LOGD(TAG, "Access granted to %s '%s'", LOG_STR_ARG(credential_source_to_string(source)), shown);
+    this->granted_callback_.call(source, credential);
+  } else {
+    ESP_LOGD(TAG, "Access denied to %s '%s'", LOG_STR_ARG(credential_source_to_string(source)), shown);
+    this->denied_callback_.call(source, credential);
+  }
+  return allowed;
+}
+
+bool AccessControl::is_allowed(CredentialSource source, const std::string &credential) const {
+  if (this->is_failed())
+    return false;
+  const uint64_t hash = this->hash_credential(source, credential);
+  const CredentialRecord *record = this->table_.find(hash);
+  if (record != nullptr)
+    return !record->removed;
+  return this->is_static_(hash);
+}
+
+bool AccessControl::add_credential(CredentialSource source, const std::string &credential) {
+  if (this->is_failed())
+    return false;
+  const uint64_t hash = this->hash_credential(source, credential);
+  const CredentialRecord *existing = this->table_.find(hash);
+  if (this->is_static_(hash)) {
+    // Takes back an earlier removal
+    if (existing != nullptr && this->table_.erase(hash)) {
+      this->removed_count_--;
+      this->table_.save();
+    }
+    return true;
+  }
+  if (existing != nullptr)
+    return true;
+  if (this->get_added_count_() >= this->max_credentials_) {
+    ESP_LOGW(TAG, "Allowlist full, %s credential not added", LOG_STR_ARG(credential_source_to_string(source)));
+    return false;
+  }
+  this->table_.insert(CredentialRecord{hash, false});
+  this->table_.save();
+  return true;
+}
+
+bool AccessControl::remove_credential(CredentialSource source, const std::string &credential) {
+  if (this->is_failed())
+    return false;
+  const uint64_t hash = this->hash_credential(source, credential);
+  if (this->is_static_(hash)) {
+    const CredentialRecord *existing = this->table_.find(hash);
+    if (existing != nullptr)
+      return false;
+    this->table_.insert(CredentialRecord{hash, true});
+    this->removed_count_++;
+    ESP_LOGD(TAG, "Removed configured %s credential", LOG_STR_ARG(credential_source_to_string(source)));
+  } else if (!this->table_.erase(hash)) {
+    return false;
+  }
+  this->table_.save();
+  return true;
+}
+
+void AccessControl::clear_credentials() {
+  if (this->is_failed())
+    return;
+  this->table_.clear();
+  for (uint64_t hash : this->static_credentials_)
+    this->table_.insert(CredentialRecord{hash, true});
+  this->removed_count_ = this->static_credentials_.size();
+  this->table_.save();
+  ESP_LOGD(TAG, "Cleared all credentials");
+}
+
+bool AccessControl::is_static_(uint64_t hash) const {
+  return std::binary_search(this->static_credentials_.begin(), this->static_credentials_.end(), hash);
+}
+
+}  // namespace access_control
+}  // namespace esphome
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/log.h"
+#include "esphome/core/persistent_table.h"
+
+namespace esphome {
+namespace access_control {
+
+enum CredentialSource : uint8_t {
+  CREDENTIAL_SOURCE_FINGERPRINT = 0,
+  CREDENTIAL_SOURCE_NFC,
+  CREDENTIAL_SOURCE_WIEGAND,
+  CREDENTIAL_SOURCE_PIN,
+};
+
+const LogString *credential_source_to_string(CredentialSource source);
+
+struct CredentialRecord {
+  /// Truncated salted SHA-256 of source and credential, 0 marks an empty slot.
+  uint64_t hash;
+  /// Persisted in place of a removed configured credential, so it stays removed across reboots.
+  bool removed;
+};
+
+struct CredentialTraits {
+  using Key = uint64_t;
+  static uint64_t key(const CredentialRecord &record) { return record.hash; }
+  static bool is_empty(const CredentialRecord &record) { return record.hash == 0; }
+  static void set_empty(CredentialRecord &record) { record.hash = 0; }
+  static void sanitize(CredentialRecord & /*record*/) {}
+};
+
+/** Makes access decisions for credentials from fingerprint readers, NFC readers, Wiegand readers and keypads.
+ *
+ * The sources forward their matches with check(), which fires a single granted or denied event stream. The allowlist
+ * only holds hashes of source and credential, kept in an open addressed table so a check is a single lookup on the
+ * device. The hashes are SHA-256 over a random per-device salt, so a copy of the stored table does not give away
+ * short credentials like PIN codes. The table is allocated in PSRAM when available and persisted in chunks of
+ * CREDENTIAL_CHUNK_SIZE records.
+ */
+class AccessControl : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  /// Largest number of credentials the allowlist holds, set before setup().
+  void set_max_credentials(uint16_t max_credentials) { this->max_credentials_ = max_credentials; }
+  /// Credentials from the configuration, hashed in setup(). They are kept apart from the persisted allowlist, so
+  /// removing one from the configuration revokes it.
+  void add_static_credential(CredentialSource source, const char *credential) {
+    this->pending_static_credentials_.emplace_back(source, credential);
+  }
+
+  uint64_t hash_credential(CredentialSource source, const std::string &credential) const;
+
+  /// Checks the credential against the allowlist and fires the granted or denied callbacks.
+  bool check(CredentialSource source, const std::string &credential);
+  bool is_allowed(CredentialSource source, const std::string &credential) const;
+  /// @return false if the allowlist is full.
+  bool add_credential(CredentialSource source, const std::string &credential);
+  /// A removed configured credential stays removed until it is added again. @return false if it was not allowed.
+  bool remove_credential(CredentialSource source, const std::string &credential);
+  /// Removes all credentials, the configured ones included.
+  void clear_credentials();
+  uint16_t get_credential_count() const;
+
+  void add_on_granted_callback(std::function<void(CredentialSource, const std::string &)> &&callback) {
+    this->granted_callback_.add(std::move(callback));
+  }
+  void add_on_denied_callback(std::function<void(CredentialSource, const std::string &)> &&callback) {
+    this->denied_callback_.add(std::move(callback));
+  }
+
+ protected:
+  static constexpr size_t CREDENTIAL_CHUNK_SIZE = 16;
+  static constexpr size_t SALT_SIZE = 16;
+
+  struct Salt {
+    uint8_t bytes[SALT_SIZE];
+  };
+
+  bool load_salt_();
+  bool is_static_(uint64_t hash) const;
+  uint16_t get_added_count_() const { return this->table_.size() - this->removed_count_; }
+
+  uint16_t max_credentials_{64};
+  uint16_t removed_count_{0};
+  Salt salt_{};
+  PersistentTable<CredentialRecord, CredentialTraits, CREDENTIAL_CHUNK_SIZE> table_;
+  std::vector<std::pair<CredentialSource, const char *>> pending_static_credentials_;
+  // Sorted, searched with a binary search
+  std::vector<uint64_t> static_credentials_;
+  CallbackManager<void(CredentialSource, const std::string &)> granted_callback_;
+  CallbackManager<void(CredentialSource, const std::string &)> denied_callback_;
+};
+
+class GrantedTrigger : public Trigger<std::string, std::string> {
+ public:
+  explicit GrantedTrigger(AccessControl *parent) {
+    parent->add_on_granted_callback([this](CredentialSource source, const std::string &credential) {
+      this->trigger(LOG_STR_ARG(credential_source_to_string(source)), credential);
+    });
+  }
+};
+
+class DeniedTrigger : public Trigger<std::string, std::string> {
+ public:
+  explicit DeniedTrigger(AccessControl *parent) {
+    parent->add_on_denied_callback([this](CredentialSource source, const std::string &credential) {
+      this->trigger(LOG_STR_ARG(credential_source_to_string(source)), credential);
+    });
+  }
+};
+
+template<typename... Ts> class CheckAction : public Action<Ts...>, public Parented<AccessControl> {
+ public:
+  void set_source(CredentialSource source) { this->source_ = source; }
+  TEMPLATABLE_VALUE(std::string, credential)
+
+  void play(Ts... x) override { this->parent_->check(this->source_, this->credential_.value(x...)); }
+
+ protected:
+  CredentialSource source_{CREDENTIAL_SOURCE_NFC};
+};
+
+template<typename... Ts> class AddCredentialAction : public Action<Ts...>, public Parented<AccessControl> {
+ public:
+  void set_source(CredentialSource source) { this->source_ = source; }
+  TEMPLATABLE_VALUE(std::string, credential)
+
+  void play(Ts... x) override { this->parent_->add_credential(this->source_, this->credential_.value(x...)); }
+
+ protected:
+  CredentialSource source_{CREDENTIAL_SOURCE_NFC};
+};
+
+template<typename... Ts> class RemoveCredentialAction : public Action<Ts...>, public Parented<AccessControl> {
+ public:
+  void set_source(CredentialSource source) { this->source_ = source; }
+  TEMPLATABLE_VALUE(std::string, credential)
+
+  void play(Ts... x) override { this->parent_->remove_credential(this->source_, this->credential_.value(x...)); }
+
+ protected:
+  CredentialSource source_{CREDENTIAL_SOURCE_NFC};
+};
+
+template<typename... Ts> class ClearCredentialsAction : public Action<Ts...>, public Parented<AccessControl> {
+ public:
+  void play(Ts... x) override { this->parent_->clear_credentials(); }
+};
+
+template<typename... Ts> class IsAllowedCondition : public Condition<Ts...>, public Parented<AccessControl> {
+ public:
+  void set_source(CredentialSource source) { this->source_ = source; }
+  TEMPLATABLE_VALUE(std::string, credential)
+
+  bool check(Ts... x) override { return this->parent_->is_allowed(this->source_, this->credential_.value(x...)); }
+
+ protected:
+  CredentialSource source_{CREDENTIAL_SOURCE_NFC};
+};
+
+}  // namespace access_control
+}  // namespace esphome
@@ -9,9 +9,11 @@
 #ifdef USE_ESP32
 #include "esp_adc/adc_cali.h"
 #include "esp_adc/adc_cali_scheme.h"
+#include "esp_adc/adc_continuous.h"
 #include "esp_adc/adc_oneshot.h"
 #include "hal/adc_types.h"  // This defines ADC_CHANNEL_MAX
-#endif                      // USE_ESP32
+#include <vector>
+#endif  // USE_ESP32
 
 #ifdef USE_ZEPHYR
 #include <zephyr/drivers/adc.h>
@@ -47,10 +49,11 @@ template<typename T> class Aggregator {
   Aggregator(SamplingMode mode);
   void add_sample(T value);
   T aggregate();
+  uint32_t get_sample_count() const { return this->samples_; }
 
  protected:
   T aggr_{0};
-  uint8_t samples_{0};
+  uint32_t samples_{0};
   SamplingMode mode_{SamplingMode::AVG};
 };
 
@@ -126,6 +129,15 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   /// Autoranging automatically adjusts the attenuation level to handle a wide range of input voltages.
   /// @param autorange Boolean indicating whether to enable autoranging.
   void set_autorange(bool autorange) { this->autorange_ = autorange; }
+
+  /// Sample in the background with the continuous (DMA) driver instead of reading the ADC in update().
+  /// Every conversion since the last update is aggregated with the sampling mode. All continuous sensors share one
+  /// conversion pattern on ADC1, which runs at the highest frequency any of them sets.
+  /// @param frequency Conversions per second of the whole pattern, 0 reads in update().
+  void set_sampling_frequency(uint32_t frequency) { this->sampling_frequency_ = frequency; }
+
+  /// Hand the conversions of the continuous driver to the sensors, only runs while it has stored some.
+  void loop() override;
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
@@ -139,9 +151,22 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   SamplingMode sampling_mode_{SamplingMode::AVG};
 
 #ifdef USE_ESP32
+  /// Initialize the shared oneshot unit and configure the channel, marks the sensor failed on errors.
+  bool setup_oneshot_();
   float sample_autorange_();
   float sample_fixed_attenuation_();
+  float sample_continuous_();
+  /// Convert an aggregated raw value to volts, unless raw output is set.
+  float convert_raw_(uint32_t final_value);
+  /// Start the continuous driver with the channels of all continuous sensors.
+  static bool start_continuous_();
+  /// Aggregate the conversions the continuous driver has stored, returns false when it had none.
+  static bool read_continuous_();
+  static bool continuous_conv_done_(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *data,
+                                    void *user_data);
   bool autorange_{false};
+  uint32_t sampling_frequency_{0};
+  Aggregator<uint64_t> continuous_aggr_{SamplingMode::AVG};
   adc_oneshot_unit_handle_t adc_handle_{nullptr};
   adc_cali_handle_t calibration_handle_{nullptr};
   adc_atten_t attenuation_{ADC_ATTEN_DB_0};
@@ -155,6 +180,9 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
     uint8_t reserved : 4;
   } setup_flags_{};
   static adc_oneshot_unit_handle_t shared_adc_handles[2];
+  static adc_continuous_handle_t continuous_handle;
+  // The first one runs the loop that reads the driver for all of them
+  static std::vector<ADCSensor *> continuous_sensors;
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
@@ -64,6 +64,10 @@ template class Aggregator<int32_t>;
 #else
 template class Aggregator<uint32_t>;
 #endif
+#ifdef USE_ESP32
+// Continuous sampling aggregates many thousands of conversions per update
+template class Aggregator<uint64_t>;
+#endif
 
 void ADCSensor::update() {
   float value_v = this->sample();
@@ -3,12 +3,30 @@
 #include "adc_sensor.h"
 #include "esphome/core/log.h"
 
+#include <soc/soc_caps.h>
+
 namespace esphome {
 namespace adc {
 
 static const char *const TAG = "adc.esp32";
 
 adc_oneshot_unit_handle_t ADCSensor::shared_adc_handles[2] = {nullptr, nullptr};
+adc_continuous_handle_t ADCSensor::continuous_handle = nullptr;
+std::vector<ADCSensor *> ADCSensor::continuous_sensors;
+
+// Conversions read from the driver at once, and the number of these blocks it stores between loops
+static const uint32_t CONTINUOUS_FRAME_SIZE = 64 * SOC_ADC_DIGI_RESULT_BYTES;
+static const uint32_t CONTINUOUS_FRAME_COUNT = 4;
+static const adc_bitwidth_t CONTINUOUS_BITWIDTH = static_cast<adc_bitwidth_t>(SOC_ADC_DIGI_MAX_BITWIDTH);
+#if USE_ESP32_VARIANT_ESP32 || USE_ESP32_VARIANT_ESP32S2
+static const adc_digi_output_format_t CONTINUOUS_FORMAT = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+#define ADC_CONTINUOUS_CHANNEL(data) ((data)->type1.channel)
+#define ADC_CONTINUOUS_DATA(data) ((data)->type1.data)
+#else
+static const adc_digi_output_format_t CONTINUOUS_FORMAT = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+#define ADC_CONTINUOUS_CHANNEL(data) ((data)->type2.channel)
+#define ADC_CONTINUOUS_DATA(data) ((data)->type2.data)
+#endif
 
 const LogString *attenuation_to_str(adc_atten_t attenuation) {
   switch (attenuation) {
@@ -37,37 +55,14 @@ const LogString *adc_unit_to_str(adc_unit_t unit) {
 }
 
 void ADCSensor::setup() {
-  // Check if another sensor already initialized this ADC unit
-  if (ADCSensor::shared_adc_handles[this->adc_unit_] == nullptr) {
-    adc_oneshot_unit_init_cfg_t init_config = {};  // Zero initialize
-    init_config.unit_id = this->adc_unit_;
-    init_config.ulp_mode = ADC_ULP_MODE_DISABLE;
-#if USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 || USE_ESP32_VARIANT_ESP32H2
-    init_config.clk_src = ADC_DIGI_CLK_SRC_DEFAULT;
-#endif  // USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 ||
-        // USE_ESP32_VARIANT_ESP32H2
-    esp_err_t err = adc_oneshot_new_unit(&init_config, &ADCSensor::shared_adc_handles[this->adc_unit_]);
-    if (err != ESP_OK) {
-      ESP_LOGE(TAG, "Error initializing %s: %d", LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)), err);
-      this->mark_failed();
-      return;
-    }
-  }
-  this->adc_handle_ = ADCSensor::shared_adc_handles[this->adc_unit_];
-
-  this->setup_flags_.handle_init_complete = true;
-
-  adc_oneshot_chan_cfg_t config = {
-      .atten = this->attenuation_,
-      .bitwidth = ADC_BITWIDTH_DEFAULT,
-  };
-  esp_err_t err = adc_oneshot_config_channel(this->adc_handle_, this->channel_, &config);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Error configuring channel: %d", err);
-    this->mark_failed();
+  if (this->sampling_frequency_ > 0) {
+    // The driver is configured for all continuous sensors together, on the first loop
+    ADCSensor::continuous_sensors.push_back(this);
+    this->continuous_aggr_ = Aggregator<uint64_t>(this->sampling_mode_);
+  } else if (!this->setup_oneshot_()) {
     return;
   }
-  this->setup_flags_.config_complete = true;
+  const adc_bitwidth_t bitwidth = this->sampling_frequency_ > 0 ? CONTINUOUS_BITWIDTH : ADC_BITWIDTH_DEFAULT;
 
   // Initialize ADC calibration
   if (this->calibration_handle_ == nullptr) {
@@ -82,9 +77,9 @@ void ADCSensor::setup() {
 #endif  // ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
     cali_config.unit_id = this->adc_unit_;
     cali_config.atten = this->attenuation_;
-    cali_config.bitwidth = ADC_BITWIDTH_DEFAULT;
+    cali_config.bitwidth = bitwidth;
 
-    err = adc_cali_create_scheme_curve_fitting(&cali_config, &handle);
+    esp_err_t err = adc_cali_create_scheme_curve_fitting(&cali_config, &handle);
     if (err == ESP_OK) {
       this->calibration_handle_ = handle;
       this->setup_flags_.calibration_complete = true;
@@ -97,12 +92,12 @@ void ADCSensor::setup() {
     adc_cali_line_fitting_config_t cali_config = {
       .unit_id = this->adc_unit_,
       .atten = this->attenuation_,
-      .bitwidth = ADC_BITWIDTH_DEFAULT,
+      .bitwidth = bitwidth,
 #if !defined(USE_ESP32_VARIANT_ESP32S2)
       .default_vref = 1100,  // Default reference voltage in mV
 #endif  // !defined(USE_ESP32_VARIANT_ESP32S2)
     };
-    err = adc_cali_create_scheme_line_fitting(&cali_config, &handle);
+    esp_err_t err = adc_cali_create_scheme_line_fitting(&cali_config, &handle);
     if (err == ESP_OK) {
       this->calibration_handle_ = handle;
       this->setup_flags_.calibration_complete = true;
@@ -117,6 +112,41 @@ void ADCSensor::setup() {
   this->setup_flags_.init_complete = true;
 }
 
+bool ADCSensor::setup_oneshot_() {
+  // Check if another sensor already initialized this ADC unit
+  if (ADCSensor::shared_adc_handles[this->adc_unit_] == nullptr) {
+    adc_oneshot_unit_init_cfg_t init_config = {};  // Zero initialize
+    init_config.unit_id = this->adc_unit_;
+    init_config.ulp_mode = ADC_ULP_MODE_DISABLE;
+#if USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 || USE_ESP32_VARIANT_ESP32H2
+    init_config.clk_src = ADC_DIGI_CLK_SRC_DEFAULT;
+#endif  // USE_ESP32_VARIANT_ESP32C3 || USE_ESP32_VARIANT_ESP32C5 || USE_ESP32_VARIANT_ESP32C6 ||
+        // USE_ESP32_VARIANT_ESP32H2
+    esp_err_t err = adc_oneshot_new_unit(&init_config, &ADCSensor::shared_adc_handles[this->adc_unit_]);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Error initializing %s: %d", LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)), err);
+      this->mark_failed();
+      return false;
+    }
+  }
+  this->adc_handle_ = ADCSensor::shared_adc_handles[this->adc_unit_];
+
+  this->setup_flags_.handle_init_complete = true;
+
+  adc_oneshot_chan_cfg_t config = {
+      .atten = this->attenuation_,
+      .bitwidth = ADC_BITWIDTH_DEFAULT,
+  };
+  esp_err_t err = adc_oneshot_config_channel(this->adc_handle_, this->channel_, &config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error configuring channel: %d", err);
+    this->mark_failed();
+    return false;
+  }
+  this->setup_flags_.config_complete = true;
+  return true;
+}
+
 void ADCSensor::dump_config() {
   LOG_SENSOR("", "ADC Sensor", this);
   LOG_PIN("  Pin: ", this->pin_);
@@ -129,6 +159,9 @@ void ADCSensor::dump_config() {
                 this->channel_, LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)),
                 this->autorange_ ? "Auto" : LOG_STR_ARG(attenuation_to_str(this->attenuation_)), this->sample_count_,
                 LOG_STR_ARG(sampling_mode_to_str(this->sampling_mode_)));
+  if (this->sampling_frequency_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Continuous:    %" PRIu32 " Hz", this->sampling_frequency_);
+  }
 
   ESP_LOGCONFIG(
       TAG,
@@ -144,6 +177,9 @@ void ADCSensor::dump_config() {
 }
 
 float ADCSensor::sample() {
+  if (this->sampling_frequency_ > 0) {
+    return this->sample_continuous_();
+  }
   if (this->autorange_) {
     return this->sample_autorange_();
   } else {
@@ -171,8 +207,21 @@ float ADCSensor::sample_fixed_attenuation_() {
     aggr.add_sample(raw);
   }
 
-  uint32_t final_value = aggr.aggregate();
+  return this->convert_raw_(aggr.aggregate());
+}
+
+float ADCSensor::sample_continuous_() {
+  Aggregator<uint64_t> aggr = this->continuous_aggr_;
+  this->continuous_aggr_ = Aggregator<uint64_t>(this->sampling_mode_);
+  if (aggr.get_sample_count() == 0) {
+    ESP_LOGW(TAG, "No conversions since the last update");
+    return NAN;
+  }
+  ESP_LOGV(TAG, "Aggregated %" PRIu32 " conversions", aggr.get_sample_count());
+  return this->convert_raw_(aggr.aggregate());
+}
 
+float ADCSensor::convert_raw_(uint32_t final_value) {
   if (this->output_raw_) {
     return final_value;
   }
@@ -361,6 +410,100 @@ float ADCSensor::sample_autorange_() {
   return final_result;
 }
 
+void ADCSensor::loop() {
+  if (this->sampling_frequency_ == 0 || ADCSensor::continuous_sensors.front() != this) {
+    this->disable_loop();
+    return;
+  }
+  if (ADCSensor::continuous_handle == nullptr && !ADCSensor::start_continuous_()) {
+    for (auto *sensor : ADCSensor::continuous_sensors)
+      sensor->mark_failed();
+    return;
+  }
+  // Woken again by the driver when it has stored the next conversions
+  if (!ADCSensor::read_continuous_())
+    this->disable_loop();
+}
+
+bool ADCSensor::start_continuous_() {
+  auto &sensors = ADCSensor::continuous_sensors;
+  if (sensors.size() > SOC_ADC_PATT_LEN_MAX) {
+    ESP_LOGE(TAG, "At most %d continuous sensors are supported", SOC_ADC_PATT_LEN_MAX);
+    return false;
+  }
+
+  adc_continuous_handle_cfg_t handle_config = {};
+  handle_config.max_store_buf_size = CONTINUOUS_FRAME_SIZE * CONTINUOUS_FRAME_COUNT;
+  handle_config.conv_frame_size = CONTINUOUS_FRAME_SIZE;
+  adc_continuous_handle_t handle = nullptr;
+  esp_err_t err = adc_continuous_new_handle(&handle_config, &handle);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error initializing continuous mode: %d", err);
+    return false;
+  }
+
+  adc_digi_pattern_config_t patterns[SOC_ADC_PATT_LEN_MAX] = {};
+  uint32_t frequency = 0;
+  for (size_t i = 0; i < sensors.size(); i++) {
+    patterns[i].atten = sensors[i]->attenuation_;
+    patterns[i].channel = sensors[i]->channel_ & 0x7;
+    patterns[i].unit = ADC_UNIT_1;
+    patterns[i].bit_width = CONTINUOUS_BITWIDTH;
+    frequency = std::max(frequency, sensors[i]->sampling_frequency_);
+  }
+  adc_continuous_config_t config = {};
+  config.pattern_num = sensors.size();
+  config.adc_pattern = patterns;
+  config.sample_freq_hz = frequency;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = CONTINUOUS_FORMAT;
+  err = adc_continuous_config(handle, &config);
+  if (err == ESP_OK) {
+    adc_continuous_evt_cbs_t callbacks = {};
+    callbacks.on_conv_done = ADCSensor::continuous_conv_done_;
+    err = adc_continuous_register_event_callbacks(handle, &callbacks, sensors.front());
+  }
+  if (err == ESP_OK)
+    err = adc_continuous_start(handle);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error starting continuous mode: %d", err);
+    adc_continuous_deinit(handle);
+    return false;
+  }
+  for (auto *sensor : sensors) {
+    sensor->setup_flags_.handle_init_complete = true;
+    sensor->setup_flags_.config_complete = true;
+  }
+  ADCSensor::continuous_handle = handle;
+  return true;
+}
+
+bool ADCSensor::read_continuous_() {
+  uint8_t buffer[CONTINUOUS_FRAME_SIZE];
+  uint32_t length = 0;
+  bool read = false;
+  // The driver stores at most CONTINUOUS_FRAME_COUNT frames, so this ends
+  while (adc_continuous_read(ADCSensor::continuous_handle, buffer, sizeof(buffer), &length, 0) == ESP_OK) {
+    read = true;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+      const auto *data = reinterpret_cast<const adc_digi_output_data_t *>(&buffer[i]);
+      const uint32_t channel = ADC_CONTINUOUS_CHANNEL(data);
+      const uint32_t value = ADC_CONTINUOUS_DATA(data);
+      for (auto *sensor : ADCSensor::continuous_sensors) {
+        if (static_cast<uint32_t>(sensor->channel_) == channel)
+          sensor->continuous_aggr_.add_sample(value);
+      }
+    }
+  }
+  return read;
+}
+
+bool IRAM_ATTR ADCSensor::continuous_conv_done_(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *data,
+                                                void *user_data) {
+  static_cast<ADCSensor *>(user_data)->enable_loop_soon_any_context();
+  return false;
+}
+
 }  // namespace adc
 }  // namespace esphome
 
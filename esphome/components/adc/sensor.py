@@ -3,6 +3,7 @@ import logging
 import esphome.codegen as cg
 from esphome.components import sensor, voltage_sampler
 from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32
 from esphome.components.nrf52.const import AIN_TO_GPIO, EXTRA_ADC
 from esphome.components.zephyr import (
     zephyr_add_overlay,
@@ -12,18 +13,21 @@ from esphome.components.zephyr import (
 from esphome.config_helpers import filter_source_files_from_platform
 import esphome.config_validation as cv
 from esphome.const import (
+    CONF_PLATFORM,
     CONF_ATTENUATION,
     CONF_ID,
     CONF_NUMBER,
     CONF_PIN,
     CONF_RAW,
     DEVICE_CLASS_VOLTAGE,
+    CONF_SENSOR,
     PLATFORM_NRF52,
     STATE_CLASS_MEASUREMENT,
     UNIT_VOLT,
     PlatformFramework,
 )
 from esphome.core import CORE
+import esphome.final_validate as fv
 
 from . import (
     ATTENUATION_MODES,
@@ -41,6 +45,7 @@ AUTO_LOAD = ["voltage_sampler"]
 
 CONF_SAMPLES = "samples"
 CONF_SAMPLING_MODE = "sampling_mode"
+CONF_SAMPLING_FREQUENCY = "sampling_frequency"
 
 
 _attenuation = cv.enum(ATTENUATION_MODES, lower=True)
@@ -62,9 +67,60 @@ def validate_config(config):
         # Alter value here so `config` command prints the recommended change
         config[CONF_ATTENUATION] = _attenuation("12db")
 
+    if (frequency := config.get(CONF_SAMPLING_FREQUENCY)) is not None:
+        if config.get(CONF_ATTENUATION) == "auto":
+            raise cv.Invalid(
+                "Automatic attenuation cannot be used with continuous sampling"
+            )
+        if config[CONF_SAMPLES] > 1:
+            raise cv.Invalid(
+                f"{CONF_SAMPLES} cannot be used with continuous sampling, "
+                "all conversions since the last update are aggregated"
+            )
+        if not _is_adc1_pin(config):
+            raise cv.Invalid("Continuous sampling is only supported on ADC1 pins")
+        # SOC_ADC_SAMPLE_FREQ_THRES_LOW and SOC_ADC_SAMPLE_FREQ_THRES_HIGH
+        if get_esp32_variant() == VARIANT_ESP32:
+            low, high = 20000, 2000000
+        else:
+            low, high = 611, 83333
+        if not low <= frequency <= high:
+            raise cv.Invalid(
+                f"{CONF_SAMPLING_FREQUENCY} must be between {low} Hz and {high} Hz "
+                "on this variant"
+            )
+
+    return config
+
+
+def _is_adc1_pin(config):
+    variant = get_esp32_variant()
+    return config[CONF_PIN][CONF_NUMBER] in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL.get(
+        variant, {}
+    )
+
+
+def _final_validate(config):
+    if not CORE.is_esp32 or not _is_adc1_pin(config):
+        return config
+    # The continuous driver holds ADC1 while it runs, oneshot reads on it would fail
+    sensors = [
+        conf
+        for conf in fv.full_config.get().get(CONF_SENSOR, [])
+        if conf.get(CONF_PLATFORM) == "adc" and _is_adc1_pin(conf)
+    ]
+    continuous = [CONF_SAMPLING_FREQUENCY in conf for conf in sensors]
+    if any(continuous) and not all(continuous):
+        raise cv.Invalid(
+            f"Either all or no ADC1 sensors must set {CONF_SAMPLING_FREQUENCY}, "
+            "continuous sampling uses ADC1 exclusively"
+        )
     return config
 
 
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 ADCSensor = adc_ns.class_(
     "ADCSensor", sensor.Sensor, cg.PollingComponent, voltage_sampler.VoltageSampler
 )
@@ -91,6 +147,9 @@ CONFIG_SCHEMA = cv.All(
             cv.OnlyWith(CONF_NRF_SAADC, PLATFORM_NRF52): cv.declare_id(adc_dt_spec),
             cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
             cv.Optional(CONF_SAMPLING_MODE, default="avg"): _sampling_mode,
+            cv.Optional(CONF_SAMPLING_FREQUENCY): cv.All(
+                cv.only_with_esp_idf, cv.frequency, cv.int_
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s")),
@@ -123,6 +182,8 @@ async def to_code(config):
                 cg.add(var.set_autorange(cg.global_ns.true))
             else:
                 cg.add(var.set_attenuation(attenuation))
+        if (frequency := config.get(CONF_SAMPLING_FREQUENCY)) is not None:
+            cg.add(var.set_sampling_frequency(frequency))
 
         variant = get_esp32_variant()
         pin_num = config[CONF_PIN][CONF_NUMBER]
@@ -1,7 +1,7 @@
 import base64
 import logging
 
-from esphome import automation
+from esphome import automation, yaml_util
 from esphome.automation import Condition
 import esphome.codegen as cg
 from esphome.config_helpers import get_logger_level
@@ -29,9 +29,11 @@ from esphome.const import (
     CONF_TAG,
     CONF_TRIGGER_ID,
     CONF_VARIABLES,
+    __version__,
 )
 from esphome.core import CORE, ID, CoroPriority, coroutine_with_priority
 from esphome.cpp_generator import TemplateArgsType
+from esphome.helpers import fnv1a_32bit_hash
 from esphome.types import ConfigType
 
 _LOGGER = logging.getLogger(__name__)
@@ -78,11 +80,13 @@ SERVICE_ARG_NATIVE_TYPES = {
 }
 CONF_ENCRYPTION = "encryption"
 CONF_BATCH_DELAY = "batch_delay"
+CONF_MAX_BATCH_DELAY = "max_batch_delay"
 CONF_CUSTOM_SERVICES = "custom_services"
 CONF_HOMEASSISTANT_SERVICES = "homeassistant_services"
 CONF_HOMEASSISTANT_STATES = "homeassistant_states"
 CONF_LISTEN_BACKLOG = "listen_backlog"
 CONF_MAX_SEND_QUEUE = "max_send_queue"
+CONF_RESUME_TIMEOUT = "resume_timeout"
 
 
 def validate_encryption_key(value):
@@ -144,6 +148,14 @@ def _validate_api_config(config: ConfigType) -> ConfigType:
             "We strongly recommend using 'encryption' instead for better security."
         )
 
+    if (
+        CONF_MAX_BATCH_DELAY in config
+        and config[CONF_MAX_BATCH_DELAY] < config[CONF_BATCH_DELAY]
+    ):
+        raise cv.Invalid(
+            f"'{CONF_MAX_BATCH_DELAY}' must not be shorter than '{CONF_BATCH_DELAY}'"
+        )
+
     # Warn about password deprecation
     if has_password:
         _LOGGER.warning(
@@ -173,6 +185,15 @@ CONFIG_SCHEMA = cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(max=cv.TimePeriod(milliseconds=65535)),
             ),
+            # Connections whose socket is backed up widen their batch window
+            # up to this delay, and narrow it back to batch_delay once drained
+            cv.Optional(CONF_MAX_BATCH_DELAY): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+            ),
+            # Clients reconnecting within this time after a disconnect may ask
+            # for only the states that changed instead of all of them
+            cv.Optional(CONF_RESUME_TIMEOUT): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_CUSTOM_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_SERVICES, default=False): cv.boolean,
             cv.Optional(CONF_HOMEASSISTANT_STATES, default=False): cv.boolean,
@@ -236,6 +257,18 @@ async def to_code(config):
         cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    if (max_batch_delay := config.get(CONF_MAX_BATCH_DELAY)) is not None and (
+        max_batch_delay > config[CONF_BATCH_DELAY]
+    ):
+        cg.add_define("USE_API_ADAPTIVE_BATCH_DELAY")
+        cg.add(var.set_max_batch_delay(max_batch_delay))
+    if CONF_RESUME_TIMEOUT in config:
+        cg.add_define("USE_API_STATE_RESUME")
+        cg.add(var.set_resume_timeout(config[CONF_RESUME_TIMEOUT]))
+    # Changes whenever the firmware is built from a different configuration,
+    # clients compare it to skip ListEntities when their cached copy is current
+    config_dump = yaml_util.dump(CORE.config, show_secrets=True)
+    cg.add(var.set_config_hash(fnv1a_32bit_hash(f"{__version__}\n{config_dump}")))
     if CONF_LISTEN_BACKLOG in config:
         cg.add(var.set_listen_backlog(config[CONF_LISTEN_BACKLOG]))
     if CONF_MAX_CONNECTIONS in config:
@@ -0,0 +1,99 @@
+#include "api_buffer_pool.h"
+#ifdef USE_API
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome::api {
+
+static const char *const TAG = "api.buffer_pool";
+
+// How often the heap is checked and how often buffers are shrunk to their watermark
+static constexpr uint32_t HEAP_CHECK_INTERVAL_MS = 1000;
+static constexpr uint32_t TRIM_INTERVAL_MS = 10000;
+// Spare receive buffers larger than this are freed right away, client messages are almost always smaller
+static constexpr size_t MAX_SPARE_SIZE = 512;
+// Capacity the shared write buffer keeps at least, one batch packet
+static constexpr size_t MIN_WRITE_BUFFER_SIZE = 1500;
+// Largest free heap block below which low memory mode starts, and above which it ends again
+#ifdef USE_ESP8266
+static constexpr size_t LOW_MEMORY_ENTER_BLOCK = 4096;
+#else
+static constexpr size_t LOW_MEMORY_ENTER_BLOCK = 8192;
+#endif
+static constexpr size_t LOW_MEMORY_EXIT_BLOCK = LOW_MEMORY_ENTER_BLOCK * 3 / 2;
+
+std::vector<uint8_t> APIBufferPool::acquire(size_t size) {
+  if (size > this->rx_high_water_)
+    this->rx_high_water_ = size;
+  if (this->spare_count_ == 0)
+    return std::vector<uint8_t>(size);
+  std::vector<uint8_t> buffer = std::move(this->spare_[--this->spare_count_]);
+  buffer.resize(size);
+  return buffer;
+}
+
+void APIBufferPool::release(std::vector<uint8_t> &&buffer) {
+  if (this->low_memory_ || this->spare_count_ >= API_RX_POOL_SIZE || buffer.capacity() == 0 ||
+      buffer.capacity() > MAX_SPARE_SIZE)
+    return;  // Freed when the caller's container goes out of scope
+  buffer.clear();
+  this->spare_[this->spare_count_++] = std::move(buffer);
+}
+
+void APIBufferPool::loop(std::vector<uint8_t> &shared_write_buffer, uint32_t now) {
+  if (now - this->last_check_ < HEAP_CHECK_INTERVAL_MS)
+    return;
+  this->last_check_ = now;
+
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  size_t free_block = allocator.get_max_free_block_size();
+  if (!this->low_memory_ && free_block < LOW_MEMORY_ENTER_BLOCK) {
+    // Set first, the API log callback drops messages in low memory mode
+    this->low_memory_ = true;
+    ESP_LOGW(TAG, "Low memory (largest free block %u bytes), releasing buffers", (unsigned) free_block);
+  } else if (this->low_memory_ && free_block > LOW_MEMORY_EXIT_BLOCK) {
+    this->low_memory_ = false;
+    ESP_LOGI(TAG, "Memory recovered (largest free block %u bytes)", (unsigned) free_block);
+  }
+
+  if (this->low_memory_ || now - this->last_trim_ >= TRIM_INTERVAL_MS) {
+    this->last_trim_ = now;
+    this->trim_(shared_write_buffer);
+  }
+}
+
+void APIBufferPool::trim_(std::vector<uint8_t> &shared_write_buffer) {
+  // Keep what the last interval needed, anything beyond grows again on demand.
+  // Half of the slack is tolerated so a steady load does not reallocate on every trim.
+  size_t keep = this->low_memory_ ? 0 : std::max(this->write_high_water_, MIN_WRITE_BUFFER_SIZE);
+  if (shared_write_buffer.capacity() > keep + keep / 2) {
+    ESP_LOGV(TAG, "Shrinking write buffer %u -> %u bytes", (unsigned) shared_write_buffer.capacity(), (unsigned) keep);
+    std::vector<uint8_t> shrunk;
+    shrunk.reserve(keep);
+    shared_write_buffer.swap(shrunk);
+  }
+
+  size_t keep_rx = this->low_memory_ ? 0 : this->rx_high_water_;
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < this->spare_count_; i++) {
+    if (this->spare_[i].capacity() <= keep_rx) {
+      if (kept != i)
+        this->spare_[kept] = std::move(this->spare_[i]);
+      kept++;
+    } else {
+      this->spare_[i] = std::vector<uint8_t>();
+    }
+  }
+  this->spare_count_ = kept;
+  if (this->low_memory_) {
+    this->iovs_ = std::vector<struct iovec>();
+  }
+
+  this->rx_high_water_ = 0;
+  this->write_high_water_ = 0;
+}
+
+}  // namespace esphome::api
+#endif  // USE_API
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#include "esphome/components/socket/socket.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace esphome::api {
+
+// Spare receive buffers kept for reuse, only one message is handled at a time
+static constexpr uint8_t API_RX_POOL_SIZE = 2;
+
+/// Buffers shared by the frame helpers of all connections.
+/// Connections are serviced one after another, so instead of every connection keeping buffers sized for its largest
+/// message, receive buffers go back to the pool once their message is handled and the writev scatter list exists
+/// once. Buffers that outgrew what the last interval needed are shrunk, and while the heap runs low everything spare
+/// is released and the server sheds optional work instead of running into a failed allocation.
+class APIBufferPool {
+ public:
+  /// A receive buffer of size bytes, reusing a spare one when available.
+  std::vector<uint8_t> acquire(size_t size);
+  /// Hand back a receive buffer once its message was handled.
+  void release(std::vector<uint8_t> &&buffer);
+  /// Scatter list for writev, writes of different connections never interleave.
+  std::vector<struct iovec> &get_iovs() { return this->iovs_; }
+  /// Record the size the shared write buffer had to hold, for the watermark.
+  void note_write_size(size_t size) {
+    if (size > this->write_high_water_)
+      this->write_high_water_ = size;
+  }
+  /// Check the heap and shrink what outgrew its recent use, called from APIServer::loop().
+  void loop(std::vector<uint8_t> &shared_write_buffer, uint32_t now);
+  bool is_low_memory() const { return this->low_memory_; }
+
+ protected:
+  void trim_(std::vector<uint8_t> &shared_write_buffer);
+
+  std::array<std::vector<uint8_t>, API_RX_POOL_SIZE> spare_{};
+  std::vector<struct iovec> iovs_;
+  // Largest sizes needed since the last trim
+  size_t rx_high_water_{0};
+  size_t write_high_water_{0};
+  uint32_t last_check_{0};
+  uint32_t last_trim_{0};
+  uint8_t spare_count_{0};
+  bool low_memory_{false};
+};
+
+}  // namespace esphome::api
+#endif  // USE_API
@@ -6,6 +6,7 @@
 #ifdef USE_API_PLAINTEXT
 #include "api_frame_helper_plaintext.h"
 #endif
+#include <algorithm>
 #include <cerrno>
 #include <cinttypes>
 #include <functional>
@@ -53,6 +54,8 @@ static constexpr auto ESPHOME_VERSION_REF = StringRef::from_lit(ESPHOME_VERSION)
 static const char *const TAG = "api.connection";
 #ifdef USE_CAMERA
 static const int CAMERA_STOP_STREAM = 5000;
+// Image chunks written per loop at most, the socket usually pushes back well before
+static constexpr uint8_t MAX_CAMERA_CHUNKS_PER_LOOP = 16;
 #endif
 
 #ifdef USE_DEVICES
@@ -105,6 +108,7 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #else
 #error "No frame helper defined"
 #endif
+  this->helper_->set_buffer_pool(&parent->get_buffer_pool());
 #ifdef USE_CAMERA
   if (camera::Camera::instance() != nullptr) {
     this->image_reader_ = std::unique_ptr<camera::CameraImageReader>{camera::Camera::instance()->create_image_reader()};
@@ -112,7 +116,47 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
 #endif
 }
 
-uint32_t APIConnection::get_batch_delay_ms_() const { return this->parent_->get_batch_delay(); }
+uint32_t APIConnection::get_batch_delay_ms_() const {
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  return std::max(this->parent_->get_batch_delay(), this->batch_delay_ms_);
+#else
+  return this->parent_->get_batch_delay();
+#endif
+}
+
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+// Window a backed up connection starts from when batch_delay is 0
+static constexpr uint16_t MIN_ADAPTIVE_BATCH_DELAY_MS = 10;
+
+void APIConnection::adapt_batch_delay_(bool backed_up) {
+  const uint16_t base = this->parent_->get_batch_delay();
+  const uint16_t current = this->get_batch_delay_ms_();
+  uint16_t next;
+  if (backed_up) {
+    // Double the window so the next attempt coalesces more updates into fewer packets
+    next = std::min<uint32_t>(std::max<uint32_t>(current * 2u, MIN_ADAPTIVE_BATCH_DELAY_MS),
+                              std::max(base, this->parent_->get_max_batch_delay()));
+  } else {
+    // Halve it again while writes go out without blocking
+    next = std::max<uint16_t>(base, current / 2);
+  }
+  if (next == current)
+    return;
+  this->batch_delay_ms_ = next;
+  uint32_t packets = std::max<uint32_t>(this->batch_packets_, 1);
+  ESP_LOGV(TAG, "%s (%s): Batch delay %ums -> %ums, %.1f messages/packet, %" PRIu32 "ms avg queue delay",
+           this->client_info_.name.c_str(), this->client_info_.peername.c_str(), current, next,
+           this->batch_messages_ / (float) packets, this->batch_queue_ms_ / packets);
+}
+
+void APIConnection::record_batch_sent_(size_t messages) {
+  this->batch_packets_++;
+  this->batch_messages_ += messages;
+  this->batch_queue_ms_ += App.get_loop_component_start_time() - this->deferred_batch_.queued_time;
+  if (this->batch_delay_ms_ > this->parent_->get_batch_delay() && this->helper_->can_write_without_blocking())
+    this->adapt_batch_delay_(false);
+}
+#endif
 
 void APIConnection::start() {
   this->last_traffic_ = App.get_loop_component_start_time();
@@ -124,6 +168,8 @@ void APIConnection::start() {
   }
   this->client_info_.peername = helper_->getpeername();
   this->client_info_.name = this->client_info_.peername;
+  // The handshake follows right away
+  network::request_fast_poll();
 }
 
 APIConnection::~APIConnection() {
@@ -168,15 +214,30 @@ void APIConnection::loop() {
         return;
       } else {
         this->last_traffic_ = now;
+        // Requests tend to come in bursts, keep a sleepy network awake for the follow ups
+        network::request_fast_poll();
+#ifdef USE_API_STATE_RESUME
+        this->rx_seq_ = this->parent_->get_state_seq();
+#endif
         // read a packet
         this->read_message(buffer.data_len, buffer.type,
                            buffer.data_len > 0 ? &buffer.container[buffer.data_offset] : nullptr);
+        this->parent_->get_buffer_pool().release(std::move(buffer.container));
         if (this->flags_.remove)
           return;
       }
     }
   }
 
+  if (this->state_filter_ != nullptr && this->state_filter_->held_count > 0)
+    this->send_held_states_(now);
+
+#ifdef USE_API_STATE_RESUME
+  if (!this->flags_.batch_scheduled && this->initial_state_iterator_.completed() &&
+      this->helper_->can_write_without_blocking())
+    this->synced_seq_ = this->parent_->get_state_seq();
+#endif
+
   // Process deferred batch if scheduled and timer has expired
   if (this->flags_.batch_scheduled && now - this->deferred_batch_.batch_start_time >= this->get_batch_delay_ms_()) {
     this->process_batch_();
@@ -218,28 +279,13 @@ void APIConnection::loop() {
                                     PingRequest::ESTIMATED_SIZE);
       this->flags_.sent_ping = true;  // Mark as sent to avoid scheduling multiple pings
     }
+    // Don't let the pong wait for the next regular poll of a sleepy network
+    network::request_fast_poll();
   }
 
 #ifdef USE_CAMERA
-  if (this->image_reader_ && this->image_reader_->available() && this->helper_->can_write_without_blocking()) {
-    uint32_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
-    bool done = this->image_reader_->available() == to_send;
-
-    CameraImageResponse msg;
-    msg.key = camera::Camera::instance()->get_object_id_hash();
-    msg.set_data(this->image_reader_->peek_data_buffer(), to_send);
-    msg.done = done;
-#ifdef USE_DEVICES
-    msg.device_id = camera::Camera::instance()->get_device_id();
-#endif
-
-    if (this->send_message_(msg, CameraImageResponse::MESSAGE_TYPE)) {
-      this->image_reader_->consume_data(to_send);
-      if (done) {
-        this->image_reader_->return_image();
-      }
-    }
-  }
+  if (this->image_reader_ && this->image_reader_->available())
+    this->send_camera_image_chunks_();
 #endif
 
 #ifdef USE_API_HOMEASSISTANT_STATES
@@ -293,35 +339,80 @@ uint16_t APIConnection::encode_message_to_buffer(ProtoMessage &msg, uint8_t mess
   }
 
   // Get buffer size after allocation (which includes header padding)
-  std::vector<uint8_t> &shared_buf = conn->parent_->get_shared_buffer_ref();
+  std::vector<uint8_t> &shared_buf = conn->prepare_message_buffer_(header_padding, footer_size, total_calculated_size,
+                                                                   is_single);
+
+  // Size the buffer once and encode directly into it
+  size_t size_before_encode = shared_buf.size();
+  shared_buf.resize(size_before_encode + calculated_size);
+  ProtoWriteBuffer buffer{&shared_buf, size_before_encode};
+  msg.encode(buffer);
+
+  // Verify that calculate_size() returned the correct value
+  assert(buffer.get_pos() == shared_buf.data() + shared_buf.size());
+  return static_cast<uint16_t>(total_calculated_size);
+}
 
-  if (is_single || conn->flags_.batch_first_message) {
+std::vector<uint8_t> &APIConnection::prepare_message_buffer_(uint8_t header_padding, uint8_t footer_size,
+                                                             size_t total_size, bool is_single) {
+  std::vector<uint8_t> &shared_buf = this->parent_->get_shared_buffer_ref();
+
+  if (is_single || this->flags_.batch_first_message) {
     // Single message or first batch message
-    conn->prepare_first_message_buffer(shared_buf, header_padding, total_calculated_size);
-    if (conn->flags_.batch_first_message) {
-      conn->flags_.batch_first_message = false;
+    this->prepare_first_message_buffer(shared_buf, header_padding, total_size);
+    if (this->flags_.batch_first_message) {
+      this->flags_.batch_first_message = false;
     }
   } else {
     // Batch message second or later
     // Add padding for previous message footer + this message header
     size_t current_size = shared_buf.size();
-    shared_buf.reserve(current_size + total_calculated_size);
+    this->parent_->get_buffer_pool().note_write_size(current_size + total_size);
+    shared_buf.reserve(current_size + total_size);
     shared_buf.resize(current_size + footer_size + header_padding);
   }
+  return shared_buf;
+}
 
-  // Encode directly into buffer
-  size_t size_before_encode = shared_buf.size();
-  msg.encode({&shared_buf});
+uint16_t APIConnection::encode_payload_to_buffer(const uint8_t *payload, size_t payload_size, APIConnection *conn,
+                                                 uint32_t remaining_size, bool is_single) {
+  const uint8_t header_padding = conn->helper_->frame_header_padding();
+  const uint8_t footer_size = conn->helper_->frame_footer_size();
+  size_t total_size = payload_size + header_padding + footer_size;
+  if (total_size > remaining_size) {
+    return 0;  // Doesn't fit
+  }
+
+  std::vector<uint8_t> &shared_buf = conn->prepare_message_buffer_(header_padding, footer_size, total_size, is_single);
+  shared_buf.insert(shared_buf.end(), payload, payload + payload_size);
+  return static_cast<uint16_t>(total_size);
+}
 
-  // Calculate actual encoded size (not including header that was already added)
-  size_t actual_payload_size = shared_buf.size() - size_before_encode;
+uint16_t APIConnection::fill_and_encode_entity_state(EntityBase *entity, StateResponseProtoMessage &msg,
+                                                     uint8_t message_type, APIConnection *conn,
+                                                     uint32_t remaining_size, bool is_single) {
+  fill_entity_state(entity, msg);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  if (conn->flags_.log_only_mode) {
+    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+  }
+#endif
 
-  // Return actual total size (header + actual payload + footer)
-  size_t actual_total_size = header_padding + actual_payload_size + footer_size;
+  // Another connection may already have encoded this state, only the framing differs between connections
+  APIServer *server = conn->parent_;
+  const std::vector<uint8_t> *encoded = server->get_encoded_state(entity, message_type);
+  if (encoded != nullptr) {
+    return encode_payload_to_buffer(encoded->data(), encoded->size(), conn, remaining_size, is_single);
+  }
 
-  // Verify that calculate_size() returned the correct value
-  assert(calculated_size == actual_payload_size);
-  return static_cast<uint16_t>(actual_total_size);
+  uint16_t size = encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+  if (size > 0) {
+    const size_t payload_size = size - conn->helper_->frame_header_padding() - conn->helper_->frame_footer_size();
+    const std::vector<uint8_t> &shared_buf = server->get_shared_buffer_ref();
+    server->store_encoded_state(entity, message_type, shared_buf.data() + shared_buf.size() - payload_size,
+                                payload_size);
+  }
+  return size;
 }
 
 #ifdef USE_BINARY_SENSOR
@@ -1073,6 +1164,62 @@ void APIConnection::camera_image(const CameraImageRequest &msg) {
                               []() { camera::Camera::instance()->stop_stream(esphome::camera::API_REQUESTER); });
   }
 }
+
+void APIConnection::stream_credit(const StreamCreditRequest &msg) {
+  if (camera::Camera::instance() == nullptr || msg.key != camera::Camera::instance()->get_object_id_hash())
+    return;
+  // The first grant replaces socket pacing, later ones add up
+  if (this->camera_credit_ == CAMERA_CREDIT_UNLIMITED) {
+    this->camera_credit_ = std::min<uint32_t>(msg.credit, CAMERA_CREDIT_UNLIMITED - 1);
+  } else {
+    this->camera_credit_ += std::min(msg.credit, CAMERA_CREDIT_UNLIMITED - 1 - this->camera_credit_);
+  }
+}
+
+void APIConnection::send_camera_image_chunks_() {
+  auto *camera = camera::Camera::instance();
+  for (uint8_t i = 0; i < MAX_CAMERA_CHUNKS_PER_LOOP; i++) {
+    size_t available = this->image_reader_->available();
+    if (available == 0 || this->camera_credit_ == 0 || !this->helper_->can_write_without_blocking())
+      return;
+    size_t to_send = std::min({(size_t) MAX_BATCH_PACKET_SIZE, available, (size_t) this->camera_credit_});
+    bool done = available == to_send;
+
+    // Encode everything but the image bytes, they are handed to the frame helper from the reader's buffer.
+    // The data field goes last on the wire, field order does not matter to protobuf decoders.
+    CameraImageResponse msg;
+    msg.key = camera->get_object_id_hash();
+    msg.done = done;
+#ifdef USE_DEVICES
+    msg.device_id = camera->get_device_id();
+#endif
+    ProtoSize size;
+    msg.calculate_size(size);
+    size.add_length_force(1, to_send);
+    uint32_t head_size = size.get_size() - to_send;
+
+    ProtoWriteBuffer buffer = this->create_buffer(head_size);
+    msg.encode(buffer);
+    buffer.encode_field_raw(2, 2);  // type 2: Length-delimited bytes
+    buffer.encode_varint_raw(to_send);
+
+    APIError err = this->helper_->write_protobuf_packet_with_tail(
+        CameraImageResponse::MESSAGE_TYPE, buffer, this->image_reader_->peek_data_buffer(), to_send);
+    if (err != APIError::OK) {
+      if (err != APIError::WOULD_BLOCK)
+        this->fatal_error_with_log_(LOG_STR("Packet write failed"), err);
+      return;
+    }
+
+    this->image_reader_->consume_data(to_send);
+    if (this->camera_credit_ != CAMERA_CREDIT_UNLIMITED)
+      this->camera_credit_ -= to_send;
+    if (done) {
+      this->image_reader_->return_image();
+      return;
+    }
+  }
+}
 #endif
 
 #ifdef USE_HOMEASSISTANT_TIME
@@ -1158,12 +1305,12 @@ void APIConnection::on_voice_assistant_response(const VoiceAssistantResponse &ms
   }
   if (msg.port == 0) {
     // Use API Audio
-    voice_assistant::global_voice_assistant->start_streaming();
+    voice_assistant::global_voice_assistant->start_streaming(msg.audio_format);
   } else {
     struct sockaddr_storage storage;
     socklen_t len = sizeof(storage);
     this->helper_->getpeername((struct sockaddr *) &storage, &len);
-    voice_assistant::global_voice_assistant->start_streaming(&storage, msg.port);
+    voice_assistant::global_voice_assistant->start_streaming(&storage, msg.port, msg.audio_format);
   }
 };
 void APIConnection::on_voice_assistant_event_response(const VoiceAssistantEventResponse &msg) {
@@ -1299,6 +1446,8 @@ void APIConnection::alarm_control_panel_command(const AlarmControlPanelCommandRe
 
 #ifdef USE_EVENT
 void APIConnection::send_event(event::Event *event, const std::string &event_type) {
+  if (this->state_filter_ != nullptr && !this->state_filter_->allows(event, EventResponse::MESSAGE_TYPE))
+    return;
   this->schedule_message_(event, MessageCreator(event_type), EventResponse::MESSAGE_TYPE,
                           EventResponse::ESTIMATED_SIZE);
 }
@@ -1306,7 +1455,9 @@ uint16_t APIConnection::try_send_event_response(event::Event *event, const std::
                                                 uint32_t remaining_size, bool is_single) {
   EventResponse resp;
   resp.set_event_type(StringRef(event_type));
-  return fill_and_encode_entity_state(event, resp, EventResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+  // Every event is a message of its own, never reuse an earlier encoding
+  fill_entity_state(event, resp);
+  return encode_message_to_buffer(resp, EventResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
 }
 
 uint16_t APIConnection::try_send_event_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
@@ -1417,6 +1568,7 @@ bool APIConnection::send_hello_response(const HelloRequest &msg) {
   // Send only the version string - the client only logs this for debugging and doesn't use it otherwise
   resp.set_server_info(ESPHOME_VERSION_REF);
   resp.set_name(StringRef(App.get_name()));
+  resp.config_hash = this->parent_->get_config_hash();
 
 #ifdef USE_API_PASSWORD
   // Password required - wait for authentication
@@ -1536,9 +1688,15 @@ bool APIConnection::send_device_info_response(const DeviceInfoRequest &msg) {
 
 #ifdef USE_API_HOMEASSISTANT_STATES
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
+  // The fields point into the receive buffer, only a matching subscription gets a copy of the state
+  auto matches = [](const std::string &value, const uint8_t *data, uint16_t len) {
+    return value.size() == len && memcmp(value.data(), data, len) == 0;
+  };
+  // Subscriptions are unique per entity and attribute, apart from one shot requests sharing the same pair
   for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
+    if (matches(it.entity_id, msg.entity_id, msg.entity_id_len) &&
+        matches(it.attribute.value(), msg.attribute, msg.attribute_len)) {
+      it.deliver(std::string(reinterpret_cast<const char *>(msg.state), msg.state_len));
     }
   }
 }
@@ -1672,10 +1830,87 @@ void APIConnection::DeferredBatch::add_item_front(EntityBase *entity, MessageCre
   }
 }
 
+void APIConnection::subscribe_states(const SubscribeStatesRequest &msg) {
+  this->flags_.state_subscription = true;
+  if (msg.keys.empty() && msg.message_types.empty() && msg.min_interval_ms == 0) {
+    this->state_filter_.reset();
+  } else {
+    auto filter = make_unique<StateFilter>();
+    filter->keys.assign(msg.keys.begin(), msg.keys.end());
+    filter->message_types.assign(msg.message_types.begin(), msg.message_types.end());
+    filter->min_interval_ms = msg.min_interval_ms;
+    this->state_filter_ = std::move(filter);
+    ESP_LOGD(TAG, "%s (%s) filters states: %u keys, %u types, %" PRIu32 "ms min interval",
+             this->client_info_.name.c_str(), this->client_info_.peername.c_str(), (unsigned) msg.keys.size(),
+             (unsigned) msg.message_types.size(), msg.min_interval_ms);
+  }
+#ifdef USE_API_STATE_RESUME
+  if (msg.resume && this->parent_->resume_states(this)) {
+    // Only the changed states are queued, nothing left for the initial state iterator
+    this->flags_.should_try_send_immediately = true;
+    return;
+  }
+#endif
+  this->initial_state_iterator_.begin();
+}
+
+bool APIConnection::StateFilter::allows(EntityBase *entity, uint8_t message_type) const {
+  if (!this->keys.empty() &&
+      std::find(this->keys.begin(), this->keys.end(), entity->get_object_id_hash()) == this->keys.end())
+    return false;
+  return this->message_types.empty() ||
+         std::find(this->message_types.begin(), this->message_types.end(), message_type) != this->message_types.end();
+}
+
+bool APIConnection::filter_state_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type,
+                                  uint8_t estimated_size) {
+  auto &filter = *this->state_filter_;
+  if (!filter.allows(entity, message_type))
+    return false;
+  if (filter.min_interval_ms == 0)
+    return true;
+  const uint32_t now = App.get_loop_component_start_time();
+  for (auto &throttled : filter.throttled) {
+    if (throttled.entity != entity || throttled.message_type != message_type)
+      continue;
+    if (now - throttled.last_sent < filter.min_interval_ms) {
+      // The creator encodes the entity's state when sent, so the held message carries the newest one
+      if (!throttled.held) {
+        throttled.held = true;
+        filter.held_count++;
+      }
+      return false;
+    }
+    if (throttled.held) {
+      throttled.held = false;
+      filter.held_count--;
+    }
+    throttled.last_sent = now;
+    return true;
+  }
+  filter.throttled.push_back({entity, creator, now, message_type, estimated_size, false});
+  return true;
+}
+
+void APIConnection::send_held_states_(uint32_t now) {
+  auto &filter = *this->state_filter_;
+  for (auto &throttled : filter.throttled) {
+    if (!throttled.held || now - throttled.last_sent < filter.min_interval_ms)
+      continue;
+    throttled.held = false;
+    throttled.last_sent = now;
+    filter.held_count--;
+    this->schedule_message_(throttled.entity, throttled.creator, throttled.message_type, throttled.estimated_size);
+  }
+}
+
 bool APIConnection::schedule_batch_() {
   if (!this->flags_.batch_scheduled) {
     this->flags_.batch_scheduled = true;
     this->deferred_batch_.batch_start_time = App.get_loop_component_start_time();
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    this->deferred_batch_.queued_time = this->deferred_batch_.batch_start_time;
+#endif
   }
   return true;
 }
@@ -1693,6 +1928,11 @@ void APIConnection::process_batch_() {
   // Try to clear buffer first
   if (!this->try_to_clear_buffer(true)) {
     // Can't write now, we'll try again later
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    // Retry after the widened window instead of on every loop
+    this->adapt_batch_delay_(true);
+    this->deferred_batch_.batch_start_time = App.get_loop_component_start_time();
+#endif
     return;
   }
 
@@ -1713,6 +1953,9 @@ void APIConnection::process_batch_() {
       // Log messages after send attempt for VV debugging
       // It's safe to use the buffer for logging at this point regardless of send result
       this->log_batch_item_(item);
+#endif
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+      this->record_batch_sent_(1);
 #endif
       this->clear_batch_();
     } else if (payload_size == 0) {
@@ -1807,6 +2050,10 @@ void APIConnection::process_batch_() {
   if (err != APIError::OK && err != APIError::WOULD_BLOCK) {
     this->fatal_error_with_log_(LOG_STR("Batch write failed"), err);
   }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  if (err == APIError::OK)
+    this->record_batch_sent_(items_processed);
+#endif
 
 #ifdef HAS_PROTO_MESSAGE_DUMP
   // Log messages after send attempt for VV debugging
@@ -35,6 +35,10 @@ static constexpr size_t MAX_PACKETS_PER_BATCH = 64;  // ESP32 has 8KB+ stack, HO
 #else
 static constexpr size_t MAX_PACKETS_PER_BATCH = 32;  // ESP8266/RP2040/etc have smaller stacks
 #endif
+#ifdef USE_CAMERA
+// Camera stream credit of clients that never sent a StreamCreditRequest
+static constexpr uint32_t CAMERA_CREDIT_UNLIMITED = UINT32_MAX;
+#endif
 
 class APIConnection final : public APIServerConnection {
  public:
@@ -78,6 +82,7 @@ class APIConnection final : public APIServerConnection {
 #ifdef USE_CAMERA
   void set_camera_state(std::shared_ptr<camera::CameraImage> image);
   void camera_image(const CameraImageRequest &msg) override;
+  void stream_credit(const StreamCreditRequest &msg) override;
 #endif
 #ifdef USE_CLIMATE
   bool send_climate_state(climate::Climate *climate);
@@ -204,12 +209,12 @@ class APIConnection final : public APIServerConnection {
   bool send_ping_response(const PingRequest &msg) override;
   bool send_device_info_response(const DeviceInfoRequest &msg) override;
   void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
-  void subscribe_states(const SubscribeStatesRequest &msg) override {
-    this->flags_.state_subscription = true;
-    this->initial_state_iterator_.begin();
-  }
+  void subscribe_states(const SubscribeStatesRequest &msg) override;
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->flags_.log_subscription = msg.level;
+#ifdef USE_LOGGER
+    this->parent_->update_log_subscription_level();
+#endif
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -257,11 +262,14 @@ class APIConnection final : public APIServerConnection {
     std::vector<uint8_t> &shared_buf = this->parent_->get_shared_buffer_ref();
     this->prepare_first_message_buffer(shared_buf, header_padding,
                                        reserve_size + header_padding + this->helper_->frame_footer_size());
-    return {&shared_buf};
+    // reserve_size is the exact size of the message from ProtoSize
+    shared_buf.resize(header_padding + reserve_size);
+    return {&shared_buf, header_padding};
   }
 
   void prepare_first_message_buffer(std::vector<uint8_t> &shared_buf, size_t header_padding, size_t total_size) {
     shared_buf.clear();
+    this->parent_->get_buffer_pool().note_write_size(total_size);
     // Reserve space for header padding + message + footer
     // - Header padding: space for protocol headers (7 bytes for Noise, 6 for Plaintext)
     // - Footer: space for MAC (16 bytes for Noise, 0 for Plaintext)
@@ -280,40 +288,45 @@ class APIConnection final : public APIServerConnection {
   // Helper function to handle authentication completion
   void complete_authentication_();
 
+  // Make room for the next message of a single send or a batch, returns the shared buffer to append it to
+  std::vector<uint8_t> &prepare_message_buffer_(uint8_t header_padding, uint8_t footer_size, size_t total_size,
+                                                bool is_single);
+
 #ifdef USE_API_HOMEASSISTANT_STATES
   void process_state_subscriptions_();
 #endif
+#ifdef USE_CAMERA
+  // Send the pending image in chunks for as long as the socket and the client's credit take them
+  void send_camera_image_chunks_();
+#endif
 
   // Non-template helper to encode any ProtoMessage
   static uint16_t encode_message_to_buffer(ProtoMessage &msg, uint8_t message_type, APIConnection *conn,
                                            uint32_t remaining_size, bool is_single);
 
-  // Helper to fill entity state base and encode message
-  static uint16_t fill_and_encode_entity_state(EntityBase *entity, StateResponseProtoMessage &msg, uint8_t message_type,
-                                               APIConnection *conn, uint32_t remaining_size, bool is_single) {
+  // Copy an already encoded message payload into the shared buffer, framed like encode_message_to_buffer()
+  static uint16_t encode_payload_to_buffer(const uint8_t *payload, size_t payload_size, APIConnection *conn,
+                                           uint32_t remaining_size, bool is_single);
+
+  // Helper to fill entity state base fields
+  static void fill_entity_state(EntityBase *entity, StateResponseProtoMessage &msg) {
     msg.key = entity->get_object_id_hash();
 #ifdef USE_DEVICES
     msg.device_id = entity->get_device_id();
 #endif
-    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
   }
 
+  // Helper to fill entity state base and encode message
+  // The encoding is shared with the other connections until the entity publishes again
+  static uint16_t fill_and_encode_entity_state(EntityBase *entity, StateResponseProtoMessage &msg, uint8_t message_type,
+                                               APIConnection *conn, uint32_t remaining_size, bool is_single);
+
   // Helper to fill entity info base and encode message
   static uint16_t fill_and_encode_entity_info(EntityBase *entity, InfoResponseProtoMessage &msg, uint8_t message_type,
                                               APIConnection *conn, uint32_t remaining_size, bool is_single) {
     // Set common fields that are shared by all entity types
     msg.key = entity->get_object_id_hash();
-    // Try to use static reference first to avoid allocation
-    StringRef static_ref = entity->get_object_id_ref_for_api_();
-    // Store dynamic string outside the if-else to maintain lifetime
-    std::string object_id;
-    if (!static_ref.empty()) {
-      msg.set_object_id(static_ref);
-    } else {
-      // Dynamic case - need to allocate
-      object_id = entity->get_object_id();
-      msg.set_object_id(StringRef(object_id));
-    }
+    msg.set_object_id(entity->get_object_id_ref());
 
     if (entity->has_own_name()) {
       msg.set_name(entity->get_name());
@@ -489,6 +502,8 @@ class APIConnection final : public APIServerConnection {
   ListEntitiesIterator list_entities_iterator_;
 #ifdef USE_CAMERA
   std::unique_ptr<camera::CameraImageReader> image_reader_;
+  // Image bytes the client still takes, unlimited until it sends its first StreamCreditRequest
+  uint32_t camera_credit_{CAMERA_CREDIT_UNLIMITED};
 #endif
 
   // Group 3: Client info struct (24 bytes on 32-bit: 2 strings × 12 bytes each)
@@ -496,6 +511,16 @@ class APIConnection final : public APIServerConnection {
 
   // Group 4: 4-byte types
   uint32_t last_traffic_;
+#ifdef USE_API_STATE_RESUME
+  // APIServer state change count when everything queued had been handed to the socket,
+  // and when the client last sent something
+  uint32_t synced_seq_{0};
+  uint32_t rx_seq_{0};
+  // The older of the two, states written shortly before a disconnect may never have arrived
+  uint32_t get_resume_seq_() const {
+    return static_cast<int32_t>(this->synced_seq_ - this->rx_seq_) < 0 ? this->synced_seq_ : this->rx_seq_;
+  }
+#endif
 #ifdef USE_API_HOMEASSISTANT_STATES
   int state_subs_at_ = -1;
 #endif
@@ -567,6 +592,10 @@ class APIConnection final : public APIServerConnection {
 
     std::vector<BatchItem> items;
     uint32_t batch_start_time{0};
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    // When the oldest item was queued, batch_start_time moves on while the socket is backed up
+    uint32_t queued_time{0};
+#endif
 
    private:
     // Helper to cleanup items from the beginning
@@ -613,6 +642,30 @@ class APIConnection final : public APIServerConnection {
   // DeferredBatch here (16 bytes, 4-byte aligned)
   DeferredBatch deferred_batch_;
 
+  // Filter sent with SubscribeStatesRequest, applied before a state message is queued
+  struct StateFilter {
+    // A state held back by min_interval_ms, sent from loop() once the interval has passed
+    struct Throttled {
+      EntityBase *entity;
+      MessageCreatorPtr creator;
+      uint32_t last_sent;
+      uint8_t message_type;
+      uint8_t estimated_size;
+      bool held;
+    };
+
+    std::vector<uint32_t> keys;
+    // Kept as sent, an id that no state message has must not wrap around onto one that does
+    std::vector<uint32_t> message_types;
+    uint32_t min_interval_ms{0};
+    std::vector<Throttled> throttled;
+    uint16_t held_count{0};
+
+    bool allows(EntityBase *entity, uint8_t message_type) const;
+  };
+  // nullptr while the client receives every state
+  std::unique_ptr<StateFilter> state_filter_;
+
   // ConnectionState enum for type safety
   enum class ConnectionState : uint8_t {
     WAITING_FOR_HELLO = 0,
@@ -646,6 +699,18 @@ class APIConnection final : public APIServerConnection {
   uint16_t client_api_version_major_{0};
   uint16_t client_api_version_minor_{0};
   // Total: 2 (flags) + 2 + 2 = 6 bytes, then 2 bytes padding to next 4-byte boundary
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  // Batch window of this connection, fills the padding above
+  // Widened while the socket is backed up and narrowed again once it drains, never below batch_delay
+  uint16_t batch_delay_ms_{0};
+  // Packets and messages sent by process_batch_() and the queueing delay summed over those packets
+  uint32_t batch_packets_{0};
+  uint32_t batch_messages_{0};
+  uint32_t batch_queue_ms_{0};
+
+  void adapt_batch_delay_(bool backed_up);
+  void record_batch_sent_(size_t messages);
+#endif
 
   uint32_t get_batch_delay_ms_() const;
   // Message will use 8 more bytes than the minimum size, and typical
@@ -663,6 +728,9 @@ class APIConnection final : public APIServerConnection {
 
   bool schedule_batch_();
   void process_batch_();
+  // Whether a state passes state_filter_ now, records it for min_interval_ms
+  bool filter_state_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type, uint8_t estimated_size);
+  void send_held_states_(uint32_t now);
   void clear_batch_() {
     this->deferred_batch_.clear();
     this->flags_.batch_scheduled = false;
@@ -685,6 +753,9 @@ class APIConnection final : public APIServerConnection {
   // Helper method to send a message either immediately or via batching
   bool send_message_smart_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type,
                            uint8_t estimated_size) {
+    // Filtered out or held back for min_interval_ms, neither is a send failure
+    if (this->state_filter_ != nullptr && !this->filter_state_(entity, creator, message_type, estimated_size))
+      return true;
     // Try to send immediately if:
     // 1. It's an UpdateStateResponse (always send immediately to handle cases where
     //    the main loop is blocked, e.g., during OTA updates)
@@ -1,5 +1,6 @@
 #include "api_frame_helper.h"
 #ifdef USE_API
+#include "api_buffer_pool.h"
 #include "api_connection.h"  // For ClientInfo struct
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
@@ -90,6 +91,22 @@ APIError APIFrameHelper::loop() {
   return APIError::OK;  // Convert WOULD_BLOCK to OK to avoid connection termination
 }
 
+void APIFrameHelper::prepare_rx_buf_(uint16_t size) {
+  if (this->rx_buf_.capacity() == 0) {
+    this->rx_buf_ = this->buffer_pool_->acquire(size);
+  } else if (this->rx_buf_.size() != size) {
+    this->rx_buf_.resize(size);
+  }
+}
+
+// Default implementation for packets with a tail - the Noise helper encrypts in place so it needs one buffer
+APIError APIFrameHelper::write_protobuf_packet_with_tail(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *tail,
+                                                         uint16_t tail_len) {
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  raw_buffer->insert(raw_buffer->end(), tail, tail + tail_len);
+  return this->write_protobuf_packet(type, buffer);
+}
+
 // Common socket write error handling
 APIError APIFrameHelper::handle_socket_write_error_() {
   if (errno == EWOULDBLOCK || errno == EAGAIN) {
@@ -111,9 +128,16 @@ void APIFrameHelper::buffer_data_from_iov_(const struct iovec *iov, int iovcnt,
   }
 
   uint16_t buffer_size = total_write_len - offset;
+  // A failed allocation drops this connection instead of aborting the whole firmware
+  std::unique_ptr<uint8_t[]> data{new (std::nothrow) uint8_t[buffer_size]};
+  if (!data) {
+    HELPER_LOG("Out of memory buffering %u bytes, dropping connection", buffer_size);
+    this->state_ = State::FAILED;
+    return;
+  }
   auto &buffer = this->tx_buf_[this->tx_buf_tail_];
   buffer = std::make_unique<SendBuffer>(SendBuffer{
-      .data = std::make_unique<uint8_t[]>(buffer_size),
+      .data = std::move(data),
       .size = buffer_size,
       .offset = 0,
   });
@@ -31,6 +31,7 @@ static constexpr uint16_t MAX_MESSAGE_SIZE = 32768;  // 32 KiB for ESP32 and oth
 
 // Forward declaration
 struct ClientInfo;
+class APIBufferPool;
 
 class ProtoWriteBuffer;
 
@@ -115,12 +116,19 @@ class APIFrameHelper {
   // packets contains (message_type, offset, length) for each message in the buffer
   // The buffer contains all messages with appropriate padding before each
   virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) = 0;
+  // Write a single packet whose payload is the encoded buffer followed by tail_len bytes at tail
+  // Lets large payloads such as camera frames go out without being copied into the buffer first,
+  // the default implementation appends the tail to the buffer and writes it as usual
+  virtual APIError write_protobuf_packet_with_tail(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *tail,
+                                                   uint16_t tail_len);
   // Get the frame header padding required by this protocol
   uint8_t frame_header_padding() const { return frame_header_padding_; }
   // Get the frame footer size required by this protocol
   uint8_t frame_footer_size() const { return frame_footer_size_; }
   // Check if socket has data ready to read
   bool is_socket_ready() const { return socket_ != nullptr && socket_->ready(); }
+  // Buffers shared with the other connections, must be set before the first read or write
+  void set_buffer_pool(APIBufferPool *buffer_pool) { this->buffer_pool_ = buffer_pool; }
 
  protected:
   // Buffer containing data to be sent
@@ -140,6 +148,9 @@ class APIFrameHelper {
   // Try to send data from the tx buffer
   APIError try_send_tx_buf_();
 
+  // Size rx_buf_ for the frame being received, taking a pooled buffer if the last one was handed out
+  void prepare_rx_buf_(uint16_t size);
+
   // Helper method to buffer data from IOVs
   void buffer_data_from_iov_(const struct iovec *iov, int iovcnt, uint16_t total_write_len, uint16_t offset);
 
@@ -174,12 +185,13 @@ class APIFrameHelper {
 
   // Containers (size varies, but typically 12+ bytes on 32-bit)
   std::array<std::unique_ptr<SendBuffer>, API_MAX_SEND_QUEUE> tx_buf_;
-  std::vector<struct iovec> reusable_iovs_;
   std::vector<uint8_t> rx_buf_;
 
   // Pointer to client info (4 bytes on 32-bit)
   // Note: The pointed-to ClientInfo object must outlive this APIFrameHelper instance.
   const ClientInfo *client_info_{nullptr};
+  // Owned by the APIServer, which outlives its connections
+  APIBufferPool *buffer_pool_{nullptr};
 
   // Group smaller types together
   uint16_t rx_buf_len_ = 0;
@@ -1,6 +1,7 @@
 #include "api_frame_helper_noise.h"
 #ifdef USE_API
 #ifdef USE_API_NOISE
+#include "api_buffer_pool.h"
 #include "api_connection.h"  // For ClientInfo struct
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
@@ -177,9 +178,7 @@ APIError APINoiseFrameHelper::try_read_frame_() {
   }
 
   // Reserve space for body
-  if (this->rx_buf_.size() != msg_size) {
-    this->rx_buf_.resize(msg_size);
-  }
+  this->prepare_rx_buf_(msg_size);
 
   if (rx_buf_len_ < msg_size) {
     // more data to read
@@ -437,8 +436,9 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
   std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   uint8_t *buffer_data = raw_buffer->data();  // Cache buffer pointer
 
-  this->reusable_iovs_.clear();
-  this->reusable_iovs_.reserve(packets.size());
+  std::vector<struct iovec> &iovs = this->buffer_pool_->get_iovs();
+  iovs.clear();
+  iovs.reserve(packets.size());
   uint16_t total_write_len = 0;
 
   // We need to encrypt each packet in place
@@ -479,12 +479,12 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
 
     // Add iovec for this encrypted packet
     size_t packet_len = static_cast<size_t>(3 + mbuf.size);  // indicator + size + encrypted data
-    this->reusable_iovs_.push_back({buf_start, packet_len});
+    iovs.push_back({buf_start, packet_len});
     total_write_len += packet_len;
   }
 
   // Send all encrypted packets in one writev call
-  return this->write_raw_(this->reusable_iovs_.data(), this->reusable_iovs_.size(), total_write_len);
+  return this->write_raw_(iovs.data(), iovs.size(), total_write_len);
 }
 
 APIError APINoiseFrameHelper::write_frame_(const uint8_t *data, uint16_t len) {
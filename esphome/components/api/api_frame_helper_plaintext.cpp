@@ -1,6 +1,7 @@
 #include "api_frame_helper_plaintext.h"
 #ifdef USE_API
 #ifdef USE_API_PLAINTEXT
+#include "api_buffer_pool.h"
 #include "api_connection.h"  // For ClientInfo struct
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
@@ -61,10 +62,14 @@ APIError APIPlaintextFrameHelper::try_read_frame_() {
     // one byte at a time to ensure we don't read past the message and
     // into the next one.
 
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+    ssize_t received = this->read_header_bytes_();
+#else
     // Read directly into rx_header_buf_ at the current position
     // Try to get to at least 3 bytes total (indicator + 2 varint bytes), then read one byte at a time
     ssize_t received =
         this->socket_->read(&rx_header_buf_[rx_header_buf_pos_], rx_header_buf_pos_ < 3 ? 3 - rx_header_buf_pos_ : 1);
+#endif
     APIError err = handle_socket_read_result_(received);
     if (err != APIError::OK) {
       return err;
@@ -143,9 +148,7 @@ APIError APIPlaintextFrameHelper::try_read_frame_() {
   // header reading done
 
   // Reserve space for body
-  if (this->rx_buf_.size() != this->rx_header_parsed_len_) {
-    this->rx_buf_.resize(this->rx_header_parsed_len_);
-  }
+  this->prepare_rx_buf_(this->rx_header_parsed_len_);
 
   if (rx_buf_len_ < rx_header_parsed_len_) {
     // more data to read
@@ -172,6 +175,32 @@ APIError APIPlaintextFrameHelper::try_read_frame_() {
   return APIError::OK;
 }
 
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+ssize_t APIPlaintextFrameHelper::read_header_bytes_() {
+  uint8_t *data;
+  ssize_t available = this->socket_->peek_segment(&data);
+  if (available <= 0)
+    return available;
+
+  // The header ends with the last byte of its second varint, nothing after it may be consumed
+  uint8_t varints_done = 0;
+  for (uint8_t i = 1; i < rx_header_buf_pos_; i++) {
+    if ((rx_header_buf_[i] & 0x80) == 0)
+      varints_done++;
+  }
+  size_t room = sizeof(rx_header_buf_) - rx_header_buf_pos_;
+  size_t take = 0;
+  while (take < room && take < static_cast<size_t>(available)) {
+    uint8_t byte = data[take++];
+    if (rx_header_buf_pos_ + take > 1 && (byte & 0x80) == 0 && ++varints_done == 2)
+      break;
+  }
+  std::memcpy(&rx_header_buf_[rx_header_buf_pos_], data, take);
+  this->socket_->consume(take);
+  return take;
+}
+#endif
+
 APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (this->state_ != State::DATA) {
     return APIError::WOULD_BLOCK;
@@ -216,6 +245,46 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   buffer->type = this->rx_header_parsed_type_;
   return APIError::OK;
 }
+
+uint8_t APIPlaintextFrameHelper::write_header_(uint8_t *payload, uint16_t payload_size, uint8_t message_type) {
+  // Calculate varint sizes for header layout
+  uint8_t size_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(payload_size));
+  uint8_t type_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(message_type));
+  uint8_t total_header_len = 1 + size_varint_len + type_varint_len;
+
+  // Calculate where to start writing the header
+  // The header starts at the latest possible position to minimize unused padding
+  //
+  // Example 1 (small values): total_header_len = 3, header_offset = 6 - 3 = 3
+  // [0-2]  - Unused padding
+  // [3]    - 0x00 indicator byte
+  // [4]    - Payload size varint (1 byte, for sizes 0-127)
+  // [5]    - Message type varint (1 byte, for types 0-127)
+  // [6...] - Actual payload data
+  //
+  // Example 2 (medium values): total_header_len = 4, header_offset = 6 - 4 = 2
+  // [0-1]  - Unused padding
+  // [2]    - 0x00 indicator byte
+  // [3-4]  - Payload size varint (2 bytes, for sizes 128-16383)
+  // [5]    - Message type varint (1 byte, for types 0-127)
+  // [6...] - Actual payload data
+  //
+  // Example 3 (large values): total_header_len = 6, header_offset = 6 - 6 = 0
+  // [0]    - 0x00 indicator byte
+  // [1-3]  - Payload size varint (3 bytes, for sizes 16384-2097151)
+  // [4-5]  - Message type varint (2 bytes, for types 128-32767)
+  // [6...] - Actual payload data
+  //
+  // The header ends right where the payload starts
+  uint8_t *header = payload - total_header_len;
+  header[0] = 0x00;  // indicator
+
+  // Encode varints directly into buffer
+  ProtoVarInt(payload_size).encode_to_buffer_unchecked(header + 1, size_varint_len);
+  ProtoVarInt(message_type).encode_to_buffer_unchecked(header + 1 + size_varint_len, type_varint_len);
+  return total_header_len;
+}
+
 APIError APIPlaintextFrameHelper::write_protobuf_packet(uint8_t type, ProtoWriteBuffer buffer) {
   PacketInfo packet{type, 0, static_cast<uint16_t>(buffer.get_buffer()->size() - frame_header_padding_)};
   return write_protobuf_packets(buffer, std::span<const PacketInfo>(&packet, 1));
@@ -233,60 +302,43 @@ APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer
   std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   uint8_t *buffer_data = raw_buffer->data();  // Cache buffer pointer
 
-  this->reusable_iovs_.clear();
-  this->reusable_iovs_.reserve(packets.size());
+  std::vector<struct iovec> &iovs = this->buffer_pool_->get_iovs();
+  iovs.clear();
+  iovs.reserve(packets.size());
   uint16_t total_write_len = 0;
 
   for (const auto &packet : packets) {
-    // Calculate varint sizes for header layout
-    uint8_t size_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(packet.payload_size));
-    uint8_t type_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
-    uint8_t total_header_len = 1 + size_varint_len + type_varint_len;
-
-    // Calculate where to start writing the header
-    // The header starts at the latest possible position to minimize unused padding
-    //
-    // Example 1 (small values): total_header_len = 3, header_offset = 6 - 3 = 3
-    // [0-2]  - Unused padding
-    // [3]    - 0x00 indicator byte
-    // [4]    - Payload size varint (1 byte, for sizes 0-127)
-    // [5]    - Message type varint (1 byte, for types 0-127)
-    // [6...] - Actual payload data
-    //
-    // Example 2 (medium values): total_header_len = 4, header_offset = 6 - 4 = 2
-    // [0-1]  - Unused padding
-    // [2]    - 0x00 indicator byte
-    // [3-4]  - Payload size varint (2 bytes, for sizes 128-16383)
-    // [5]    - Message type varint (1 byte, for types 0-127)
-    // [6...] - Actual payload data
-    //
-    // Example 3 (large values): total_header_len = 6, header_offset = 6 - 6 = 0
-    // [0]    - 0x00 indicator byte
-    // [1-3]  - Payload size varint (3 bytes, for sizes 16384-2097151)
-    // [4-5]  - Message type varint (2 bytes, for types 128-32767)
-    // [6...] - Actual payload data
-    //
-    // The message starts at offset + frame_header_padding_
-    // So we write the header starting at offset + frame_header_padding_ - total_header_len
-    uint8_t *buf_start = buffer_data + packet.offset;
-    uint32_t header_offset = frame_header_padding_ - total_header_len;
-
-    // Write the plaintext header
-    buf_start[header_offset] = 0x00;  // indicator
-
-    // Encode varints directly into buffer
-    ProtoVarInt(packet.payload_size).encode_to_buffer_unchecked(buf_start + header_offset + 1, size_varint_len);
-    ProtoVarInt(packet.message_type)
-        .encode_to_buffer_unchecked(buf_start + header_offset + 1 + size_varint_len, type_varint_len);
+    // The message starts at offset + frame_header_padding_, the header goes right in front of it
+    uint8_t *payload = buffer_data + packet.offset + frame_header_padding_;
+    uint8_t header_len = write_header_(payload, packet.payload_size, packet.message_type);
 
     // Add iovec for this packet (header + payload)
-    size_t packet_len = static_cast<size_t>(total_header_len + packet.payload_size);
-    this->reusable_iovs_.push_back({buf_start + header_offset, packet_len});
+    size_t packet_len = static_cast<size_t>(header_len + packet.payload_size);
+    iovs.push_back({payload - header_len, packet_len});
     total_write_len += packet_len;
   }
 
   // Send all packets in one writev call
-  return write_raw_(this->reusable_iovs_.data(), this->reusable_iovs_.size(), total_write_len);
+  return write_raw_(iovs.data(), iovs.size(), total_write_len);
+}
+
+APIError APIPlaintextFrameHelper::write_protobuf_packet_with_tail(uint8_t type, ProtoWriteBuffer buffer,
+                                                                  const uint8_t *tail, uint16_t tail_len) {
+  if (state_ != State::DATA) {
+    return APIError::BAD_STATE;
+  }
+
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  uint8_t *payload = raw_buffer->data() + frame_header_padding_;
+  uint16_t head_len = static_cast<uint16_t>(raw_buffer->size() - frame_header_padding_);
+  uint8_t header_len = write_header_(payload, head_len + tail_len, type);
+
+  // The tail goes straight from its own memory to the socket, only a partial write copies what is left of it
+  struct iovec iov[2] = {
+      {payload - header_len, static_cast<size_t>(header_len + head_len)},
+      {const_cast<uint8_t *>(tail), tail_len},
+  };
+  return write_raw_(iov, 2, header_len + head_len + tail_len);
 }
 
 }  // namespace esphome::api
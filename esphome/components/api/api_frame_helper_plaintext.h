@@ -22,9 +22,17 @@ class APIPlaintextFrameHelper final : public APIFrameHelper {
   APIError read_packet(ReadPacketBuffer *buffer) override;
   APIError write_protobuf_packet(uint8_t type, ProtoWriteBuffer buffer) override;
   APIError write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) override;
+  APIError write_protobuf_packet_with_tail(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *tail,
+                                           uint16_t tail_len) override;
 
  protected:
   APIError try_read_frame_();
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+  /// Copy the header bytes held by the current receive segment, stopping where the header ends.
+  ssize_t read_header_bytes_();
+#endif
+  // Write the header in front of the payload at payload, returns the header length
+  static uint8_t write_header_(uint8_t *payload, uint16_t payload_size, uint8_t message_type);
 
   // Group 2-byte aligned types
   uint16_t rx_header_parsed_type_ = 0;
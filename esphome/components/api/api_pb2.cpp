@@ -33,17 +33,19 @@ bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value)
   }
   return true;
 }
-void HelloResponse::encode(ProtoWriteBuffer buffer) const {
+void HelloResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, this->api_version_major);
   buffer.encode_uint32(2, this->api_version_minor);
   buffer.encode_string(3, this->server_info_ref_);
   buffer.encode_string(4, this->name_ref_);
+  buffer.encode_fixed32(5, this->config_hash);
 }
 void HelloResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->api_version_major);
   size.add_uint32(1, this->api_version_minor);
   size.add_length(1, this->server_info_ref_.size());
   size.add_length(1, this->name_ref_.size());
+  size.add_fixed32(1, this->config_hash);
 }
 #ifdef USE_API_PASSWORD
 bool AuthenticationRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
@@ -59,11 +61,11 @@ bool AuthenticationRequest::decode_length(uint32_t field_id, ProtoLengthDelimite
   }
   return true;
 }
-void AuthenticationResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+void AuthenticationResponse::encode(ProtoWriteBuffer &buffer) const { buffer.encode_bool(1, this->invalid_password); }
 void AuthenticationResponse::calculate_size(ProtoSize &size) const { size.add_bool(1, this->invalid_password); }
 #endif
 #ifdef USE_AREAS
-void AreaInfo::encode(ProtoWriteBuffer buffer) const {
+void AreaInfo::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, this->area_id);
   buffer.encode_string(2, this->name_ref_);
 }
@@ -73,7 +75,7 @@ void AreaInfo::calculate_size(ProtoSize &size) const {
 }
 #endif
 #ifdef USE_DEVICES
-void DeviceInfo::encode(ProtoWriteBuffer buffer) const {
+void DeviceInfo::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, this->device_id);
   buffer.encode_string(2, this->name_ref_);
   buffer.encode_uint32(3, this->area_id);
@@ -84,7 +86,7 @@ void DeviceInfo::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->area_id);
 }
 #endif
-void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
+void DeviceInfoResponse::encode(ProtoWriteBuffer &buffer) const {
 #ifdef USE_API_PASSWORD
   buffer.encode_bool(1, this->uses_password);
 #endif
@@ -200,8 +202,41 @@ void DeviceInfoResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(2, this->zwave_home_id);
 #endif
 }
+bool SubscribeStatesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2:
+      this->message_types.push_back(value.as_uint32());
+      break;
+    case 3:
+      this->min_interval_ms = value.as_uint32();
+      break;
+    case 4:
+      this->resume = value.as_bool();
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+bool SubscribeStatesRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 1:
+      this->keys.push_back(value.as_fixed32());
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+void SubscribeStatesRequest::decode(const uint8_t *buffer, size_t length) {
+  uint32_t count_keys = ProtoDecodableMessage::count_repeated_field(buffer, length, 1);
+  this->keys.init(count_keys);
+  uint32_t count_message_types = ProtoDecodableMessage::count_repeated_field(buffer, length, 2);
+  this->message_types.init(count_message_types);
+  ProtoDecodableMessage::decode(buffer, length);
+}
 #ifdef USE_BINARY_SENSOR
-void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -231,7 +266,7 @@ void ListEntitiesBinarySensorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
+void BinarySensorStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
@@ -249,7 +284,7 @@ void BinarySensorStateResponse::calculate_size(ProtoSize &size) const {
 }
 #endif
 #ifdef USE_COVER
-void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesCoverResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -285,7 +320,7 @@ void ListEntitiesCoverResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
+void CoverStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(3, this->position);
   buffer.encode_float(4, this->tilt);
@@ -342,7 +377,7 @@ bool CoverCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_FAN
-void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesFanResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -384,7 +419,7 @@ void ListEntitiesFanResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
+void FanStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->oscillating);
@@ -467,7 +502,7 @@ bool FanCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_LIGHT
-void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesLightResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -513,7 +548,7 @@ void ListEntitiesLightResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(2, this->device_id);
 #endif
 }
-void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
+void LightStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
   buffer.encode_float(3, this->brightness);
@@ -658,7 +693,7 @@ bool LightCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_SENSOR
-void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesSensorResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -694,7 +729,7 @@ void ListEntitiesSensorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
+void SensorStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
@@ -712,7 +747,7 @@ void SensorStateResponse::calculate_size(ProtoSize &size) const {
 }
 #endif
 #ifdef USE_SWITCH
-void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -742,7 +777,7 @@ void ListEntitiesSwitchResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
+void SwitchStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 #ifdef USE_DEVICES
@@ -783,7 +818,7 @@ bool SwitchCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_TEXT_SENSOR
-void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -811,7 +846,7 @@ void ListEntitiesTextSensorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
+void TextSensorStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state_ref_);
   buffer.encode_bool(3, this->missing_state);
@@ -841,7 +876,7 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
   return true;
 }
-void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
+void SubscribeLogsResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, static_cast<uint32_t>(this->level));
   buffer.encode_bytes(3, this->message_ptr_, this->message_len_);
 }
@@ -860,11 +895,11 @@ bool NoiseEncryptionSetKeyRequest::decode_length(uint32_t field_id, ProtoLengthD
   }
   return true;
 }
-void NoiseEncryptionSetKeyResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->success); }
+void NoiseEncryptionSetKeyResponse::encode(ProtoWriteBuffer &buffer) const { buffer.encode_bool(1, this->success); }
 void NoiseEncryptionSetKeyResponse::calculate_size(ProtoSize &size) const { size.add_bool(1, this->success); }
 #endif
 #ifdef USE_API_HOMEASSISTANT_SERVICES
-void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
+void HomeassistantServiceMap::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->key_ref_);
   buffer.encode_string(2, this->value);
 }
@@ -872,7 +907,7 @@ void HomeassistantServiceMap::calculate_size(ProtoSize &size) const {
   size.add_length(1, this->key_ref_.size());
   size.add_length(1, this->value.size());
 }
-void HomeassistantActionRequest::encode(ProtoWriteBuffer buffer) const {
+void HomeassistantActionRequest::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->service_ref_);
   for (auto &it : this->data) {
     buffer.encode_message(2, it, true);
@@ -945,7 +980,7 @@ bool HomeassistantActionResponse::decode_length(uint32_t field_id, ProtoLengthDe
 }
 #endif
 #ifdef USE_API_HOMEASSISTANT_STATES
-void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
+void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->entity_id_ref_);
   buffer.encode_string(2, this->attribute_ref_);
   buffer.encode_bool(3, this->once);
@@ -957,15 +992,24 @@ void SubscribeHomeAssistantStateResponse::calculate_size(ProtoSize &size) const
 }
 bool HomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
-    case 1:
-      this->entity_id = value.as_string();
+    case 1: {
+      // Use raw data directly to avoid allocation
+      this->entity_id = value.data();
+      this->entity_id_len = value.size();
       break;
-    case 2:
-      this->state = value.as_string();
+    }
+    case 2: {
+      // Use raw data directly to avoid allocation
+      this->state = value.data();
+      this->state_len = value.size();
       break;
-    case 3:
-      this->attribute = value.as_string();
+    }
+    case 3: {
+      // Use raw data directly to avoid allocation
+      this->attribute = value.data();
+      this->attribute_len = value.size();
       break;
+    }
     default:
       return false;
   }
@@ -996,7 +1040,7 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   return true;
 }
 #ifdef USE_API_SERVICES
-void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesServicesArgument::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->name_ref_);
   buffer.encode_uint32(2, static_cast<uint32_t>(this->type));
 }
@@ -1004,7 +1048,7 @@ void ListEntitiesServicesArgument::calculate_size(ProtoSize &size) const {
   size.add_length(1, this->name_ref_.size());
   size.add_uint32(1, static_cast<uint32_t>(this->type));
 }
-void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesServicesResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->name_ref_);
   buffer.encode_fixed32(2, this->key);
   for (auto &it : this->args) {
@@ -1103,7 +1147,7 @@ void ExecuteServiceRequest::decode(const uint8_t *buffer, size_t length) {
 }
 #endif
 #ifdef USE_CAMERA
-void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesCameraResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1129,7 +1173,7 @@ void ListEntitiesCameraResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
+void CameraImageResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bytes(2, this->data_ptr_, this->data_len_);
   buffer.encode_bool(3, this->done);
@@ -1158,9 +1202,29 @@ bool CameraImageRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
   return true;
 }
+bool StreamCreditRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2:
+      this->credit = value.as_uint32();
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+bool StreamCreditRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 1:
+      this->key = value.as_fixed32();
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
 #endif
 #ifdef USE_CLIMATE
-void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesClimateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1258,7 +1322,7 @@ void ListEntitiesClimateResponse::calculate_size(ProtoSize &size) const {
 #endif
   size.add_uint32(2, this->feature_flags);
 }
-void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
+void ClimateStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_uint32(2, static_cast<uint32_t>(this->mode));
   buffer.encode_float(3, this->current_temperature);
@@ -1387,7 +1451,7 @@ bool ClimateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_NUMBER
-void ListEntitiesNumberResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesNumberResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1425,7 +1489,7 @@ void ListEntitiesNumberResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
+void NumberStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
@@ -1468,7 +1532,7 @@ bool NumberCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_SELECT
-void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesSelectResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1502,7 +1566,7 @@ void ListEntitiesSelectResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SelectStateResponse::encode(ProtoWriteBuffer buffer) const {
+void SelectStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state_ref_);
   buffer.encode_bool(3, this->missing_state);
@@ -1552,7 +1616,7 @@ bool SelectCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_SIREN
-void ListEntitiesSirenResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesSirenResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1590,7 +1654,7 @@ void ListEntitiesSirenResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void SirenStateResponse::encode(ProtoWriteBuffer buffer) const {
+void SirenStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 #ifdef USE_DEVICES
@@ -1659,7 +1723,7 @@ bool SirenCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_LOCK
-void ListEntitiesLockResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesLockResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1693,7 +1757,7 @@ void ListEntitiesLockResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void LockStateResponse::encode(ProtoWriteBuffer buffer) const {
+void LockStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_uint32(2, static_cast<uint32_t>(this->state));
 #ifdef USE_DEVICES
@@ -1747,7 +1811,7 @@ bool LockCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_BUTTON
-void ListEntitiesButtonResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesButtonResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1799,7 +1863,7 @@ bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_MEDIA_PLAYER
-void MediaPlayerSupportedFormat::encode(ProtoWriteBuffer buffer) const {
+void MediaPlayerSupportedFormat::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->format_ref_);
   buffer.encode_uint32(2, this->sample_rate);
   buffer.encode_uint32(3, this->num_channels);
@@ -1813,7 +1877,7 @@ void MediaPlayerSupportedFormat::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, static_cast<uint32_t>(this->purpose));
   size.add_uint32(1, this->sample_bytes);
 }
-void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -1847,7 +1911,7 @@ void ListEntitiesMediaPlayerResponse::calculate_size(ProtoSize &size) const {
 #endif
   size.add_uint32(1, this->feature_flags);
 }
-void MediaPlayerStateResponse::encode(ProtoWriteBuffer buffer) const {
+void MediaPlayerStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_uint32(2, static_cast<uint32_t>(this->state));
   buffer.encode_float(3, this->volume);
@@ -1930,7 +1994,7 @@ bool SubscribeBluetoothLEAdvertisementsRequest::decode_varint(uint32_t field_id,
   }
   return true;
 }
-void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer buffer) const {
+void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_sint32(2, this->rssi);
   buffer.encode_uint32(3, this->address_type);
@@ -1942,7 +2006,7 @@ void BluetoothLERawAdvertisement::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->address_type);
   size.add_length(1, this->data_len);
 }
-void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer &buffer) const {
   for (uint16_t i = 0; i < this->advertisements_len; i++) {
     buffer.encode_message(1, this->advertisements[i], true);
   }
@@ -1971,7 +2035,7 @@ bool BluetoothDeviceRequest::decode_varint(uint32_t field_id, ProtoVarInt value)
   }
   return true;
 }
-void BluetoothDeviceConnectionResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothDeviceConnectionResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->connected);
   buffer.encode_uint32(3, this->mtu);
@@ -1993,7 +2057,7 @@ bool BluetoothGATTGetServicesRequest::decode_varint(uint32_t field_id, ProtoVarI
   }
   return true;
 }
-void BluetoothGATTDescriptor::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTDescriptor::encode(ProtoWriteBuffer &buffer) const {
   if (this->uuid[0] != 0 || this->uuid[1] != 0) {
     buffer.encode_uint64(1, this->uuid[0], true);
     buffer.encode_uint64(1, this->uuid[1], true);
@@ -2009,7 +2073,7 @@ void BluetoothGATTDescriptor::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->handle);
   size.add_uint32(1, this->short_uuid);
 }
-void BluetoothGATTCharacteristic::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTCharacteristic::encode(ProtoWriteBuffer &buffer) const {
   if (this->uuid[0] != 0 || this->uuid[1] != 0) {
     buffer.encode_uint64(1, this->uuid[0], true);
     buffer.encode_uint64(1, this->uuid[1], true);
@@ -2031,7 +2095,7 @@ void BluetoothGATTCharacteristic::calculate_size(ProtoSize &size) const {
   size.add_repeated_message(1, this->descriptors);
   size.add_uint32(1, this->short_uuid);
 }
-void BluetoothGATTService::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTService::encode(ProtoWriteBuffer &buffer) const {
   if (this->uuid[0] != 0 || this->uuid[1] != 0) {
     buffer.encode_uint64(1, this->uuid[0], true);
     buffer.encode_uint64(1, this->uuid[1], true);
@@ -2051,7 +2115,7 @@ void BluetoothGATTService::calculate_size(ProtoSize &size) const {
   size.add_repeated_message(1, this->characteristics);
   size.add_uint32(1, this->short_uuid);
 }
-void BluetoothGATTGetServicesResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTGetServicesResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   for (auto &it : this->services) {
     buffer.encode_message(2, it, true);
@@ -2061,7 +2125,7 @@ void BluetoothGATTGetServicesResponse::calculate_size(ProtoSize &size) const {
   size.add_uint64(1, this->address);
   size.add_repeated_message(1, this->services);
 }
-void BluetoothGATTGetServicesDoneResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTGetServicesDoneResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
 }
 void BluetoothGATTGetServicesDoneResponse::calculate_size(ProtoSize &size) const { size.add_uint64(1, this->address); }
@@ -2078,7 +2142,7 @@ bool BluetoothGATTReadRequest::decode_varint(uint32_t field_id, ProtoVarInt valu
   }
   return true;
 }
-void BluetoothGATTReadResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTReadResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_bytes(3, this->data_ptr_, this->data_len_);
@@ -2172,7 +2236,7 @@ bool BluetoothGATTNotifyRequest::decode_varint(uint32_t field_id, ProtoVarInt va
   }
   return true;
 }
-void BluetoothGATTNotifyDataResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTNotifyDataResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_bytes(3, this->data_ptr_, this->data_len_);
@@ -2182,7 +2246,7 @@ void BluetoothGATTNotifyDataResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->handle);
   size.add_length(1, this->data_len_);
 }
-void BluetoothConnectionsFreeResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothConnectionsFreeResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, this->free);
   buffer.encode_uint32(2, this->limit);
   for (const auto &it : this->allocated) {
@@ -2200,7 +2264,7 @@ void BluetoothConnectionsFreeResponse::calculate_size(ProtoSize &size) const {
     }
   }
 }
-void BluetoothGATTErrorResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTErrorResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
   buffer.encode_int32(3, this->error);
@@ -2210,7 +2274,7 @@ void BluetoothGATTErrorResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->handle);
   size.add_int32(1, this->error);
 }
-void BluetoothGATTWriteResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTWriteResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
@@ -2218,7 +2282,7 @@ void BluetoothGATTWriteResponse::calculate_size(ProtoSize &size) const {
   size.add_uint64(1, this->address);
   size.add_uint32(1, this->handle);
 }
-void BluetoothGATTNotifyResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothGATTNotifyResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
@@ -2226,7 +2290,7 @@ void BluetoothGATTNotifyResponse::calculate_size(ProtoSize &size) const {
   size.add_uint64(1, this->address);
   size.add_uint32(1, this->handle);
 }
-void BluetoothDevicePairingResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothDevicePairingResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->paired);
   buffer.encode_int32(3, this->error);
@@ -2236,7 +2300,7 @@ void BluetoothDevicePairingResponse::calculate_size(ProtoSize &size) const {
   size.add_bool(1, this->paired);
   size.add_int32(1, this->error);
 }
-void BluetoothDeviceUnpairingResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothDeviceUnpairingResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->success);
   buffer.encode_int32(3, this->error);
@@ -2246,7 +2310,7 @@ void BluetoothDeviceUnpairingResponse::calculate_size(ProtoSize &size) const {
   size.add_bool(1, this->success);
   size.add_int32(1, this->error);
 }
-void BluetoothDeviceClearCacheResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothDeviceClearCacheResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_bool(2, this->success);
   buffer.encode_int32(3, this->error);
@@ -2256,7 +2320,7 @@ void BluetoothDeviceClearCacheResponse::calculate_size(ProtoSize &size) const {
   size.add_bool(1, this->success);
   size.add_int32(1, this->error);
 }
-void BluetoothScannerStateResponse::encode(ProtoWriteBuffer buffer) const {
+void BluetoothScannerStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, static_cast<uint32_t>(this->state));
   buffer.encode_uint32(2, static_cast<uint32_t>(this->mode));
   buffer.encode_uint32(3, static_cast<uint32_t>(this->configured_mode));
@@ -2291,7 +2355,7 @@ bool SubscribeVoiceAssistantRequest::decode_varint(uint32_t field_id, ProtoVarIn
   }
   return true;
 }
-void VoiceAssistantAudioSettings::encode(ProtoWriteBuffer buffer) const {
+void VoiceAssistantAudioSettings::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, this->noise_suppression_level);
   buffer.encode_uint32(2, this->auto_gain);
   buffer.encode_float(3, this->volume_multiplier);
@@ -2301,7 +2365,7 @@ void VoiceAssistantAudioSettings::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->auto_gain);
   size.add_float(1, this->volume_multiplier);
 }
-void VoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
+void VoiceAssistantRequest::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_bool(1, this->start);
   buffer.encode_string(2, this->conversation_id_ref_);
   buffer.encode_uint32(3, this->flags);
@@ -2323,6 +2387,9 @@ bool VoiceAssistantResponse::decode_varint(uint32_t field_id, ProtoVarInt value)
     case 2:
       this->error = value.as_bool();
       break;
+    case 3:
+      this->audio_format = static_cast<enums::VoiceAssistantAudioFormat>(value.as_uint32());
+      break;
     default:
       return false;
   }
@@ -2374,20 +2441,23 @@ bool VoiceAssistantAudio::decode_varint(uint32_t field_id, ProtoVarInt value) {
 }
 bool VoiceAssistantAudio::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
-    case 1:
-      this->data = value.as_string();
+    case 1: {
+      // Use raw data directly to avoid allocation
+      this->data = value.data();
+      this->data_len = value.size();
       break;
+    }
     default:
       return false;
   }
   return true;
 }
-void VoiceAssistantAudio::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_bytes(1, this->data_ptr_, this->data_len_);
+void VoiceAssistantAudio::encode(ProtoWriteBuffer &buffer) const {
+  buffer.encode_bytes(1, this->data, this->data_len);
   buffer.encode_bool(2, this->end);
 }
 void VoiceAssistantAudio::calculate_size(ProtoSize &size) const {
-  size.add_length(1, this->data_len_);
+  size.add_length(1, this->data_len);
   size.add_bool(1, this->end);
 }
 bool VoiceAssistantTimerEventResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
@@ -2448,9 +2518,9 @@ bool VoiceAssistantAnnounceRequest::decode_length(uint32_t field_id, ProtoLength
   }
   return true;
 }
-void VoiceAssistantAnnounceFinished::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->success); }
+void VoiceAssistantAnnounceFinished::encode(ProtoWriteBuffer &buffer) const { buffer.encode_bool(1, this->success); }
 void VoiceAssistantAnnounceFinished::calculate_size(ProtoSize &size) const { size.add_bool(1, this->success); }
-void VoiceAssistantWakeWord::encode(ProtoWriteBuffer buffer) const {
+void VoiceAssistantWakeWord::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->id_ref_);
   buffer.encode_string(2, this->wake_word_ref_);
   for (auto &it : this->trained_languages) {
@@ -2512,7 +2582,7 @@ bool VoiceAssistantConfigurationRequest::decode_length(uint32_t field_id, ProtoL
   }
   return true;
 }
-void VoiceAssistantConfigurationResponse::encode(ProtoWriteBuffer buffer) const {
+void VoiceAssistantConfigurationResponse::encode(ProtoWriteBuffer &buffer) const {
   for (auto &it : this->available_wake_words) {
     buffer.encode_message(1, it, true);
   }
@@ -2542,7 +2612,7 @@ bool VoiceAssistantSetConfiguration::decode_length(uint32_t field_id, ProtoLengt
 }
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
-void ListEntitiesAlarmControlPanelResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesAlarmControlPanelResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2574,7 +2644,7 @@ void ListEntitiesAlarmControlPanelResponse::calculate_size(ProtoSize &size) cons
   size.add_uint32(1, this->device_id);
 #endif
 }
-void AlarmControlPanelStateResponse::encode(ProtoWriteBuffer buffer) const {
+void AlarmControlPanelStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_uint32(2, static_cast<uint32_t>(this->state));
 #ifdef USE_DEVICES
@@ -2625,7 +2695,7 @@ bool AlarmControlPanelCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit
 }
 #endif
 #ifdef USE_TEXT
-void ListEntitiesTextResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesTextResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2659,7 +2729,7 @@ void ListEntitiesTextResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void TextStateResponse::encode(ProtoWriteBuffer buffer) const {
+void TextStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state_ref_);
   buffer.encode_bool(3, this->missing_state);
@@ -2709,7 +2779,7 @@ bool TextCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_DATETIME_DATE
-void ListEntitiesDateResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesDateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2735,7 +2805,7 @@ void ListEntitiesDateResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void DateStateResponse::encode(ProtoWriteBuffer buffer) const {
+void DateStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->missing_state);
   buffer.encode_uint32(3, this->year);
@@ -2788,7 +2858,7 @@ bool DateCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_DATETIME_TIME
-void ListEntitiesTimeResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesTimeResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2814,7 +2884,7 @@ void ListEntitiesTimeResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void TimeStateResponse::encode(ProtoWriteBuffer buffer) const {
+void TimeStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->missing_state);
   buffer.encode_uint32(3, this->hour);
@@ -2867,7 +2937,7 @@ bool TimeCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_EVENT
-void ListEntitiesEventResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesEventResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2903,7 +2973,7 @@ void ListEntitiesEventResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void EventResponse::encode(ProtoWriteBuffer buffer) const {
+void EventResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->event_type_ref_);
 #ifdef USE_DEVICES
@@ -2919,7 +2989,7 @@ void EventResponse::calculate_size(ProtoSize &size) const {
 }
 #endif
 #ifdef USE_VALVE
-void ListEntitiesValveResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesValveResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -2953,7 +3023,7 @@ void ListEntitiesValveResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void ValveStateResponse::encode(ProtoWriteBuffer buffer) const {
+void ValveStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->position);
   buffer.encode_uint32(3, static_cast<uint32_t>(this->current_operation));
@@ -3002,7 +3072,7 @@ bool ValveCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_DATETIME_DATETIME
-void ListEntitiesDateTimeResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesDateTimeResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -3028,7 +3098,7 @@ void ListEntitiesDateTimeResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void DateTimeStateResponse::encode(ProtoWriteBuffer buffer) const {
+void DateTimeStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->missing_state);
   buffer.encode_fixed32(3, this->epoch_seconds);
@@ -3071,7 +3141,7 @@ bool DateTimeCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
 }
 #endif
 #ifdef USE_UPDATE
-void ListEntitiesUpdateResponse::encode(ProtoWriteBuffer buffer) const {
+void ListEntitiesUpdateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
   buffer.encode_fixed32(2, this->key);
   buffer.encode_string(3, this->name_ref_);
@@ -3099,7 +3169,7 @@ void ListEntitiesUpdateResponse::calculate_size(ProtoSize &size) const {
   size.add_uint32(1, this->device_id);
 #endif
 }
-void UpdateStateResponse::encode(ProtoWriteBuffer buffer) const {
+void UpdateStateResponse::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->missing_state);
   buffer.encode_bool(3, this->in_progress);
@@ -3169,7 +3239,7 @@ bool ZWaveProxyFrame::decode_length(uint32_t field_id, ProtoLengthDelimited valu
   }
   return true;
 }
-void ZWaveProxyFrame::encode(ProtoWriteBuffer buffer) const { buffer.encode_bytes(1, this->data, this->data_len); }
+void ZWaveProxyFrame::encode(ProtoWriteBuffer &buffer) const { buffer.encode_bytes(1, this->data, this->data_len); }
 void ZWaveProxyFrame::calculate_size(ProtoSize &size) const { size.add_length(1, this->data_len); }
 bool ZWaveProxyRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -3194,7 +3264,7 @@ bool ZWaveProxyRequest::decode_length(uint32_t field_id, ProtoLengthDelimited va
   }
   return true;
 }
-void ZWaveProxyRequest::encode(ProtoWriteBuffer buffer) const {
+void ZWaveProxyRequest::encode(ProtoWriteBuffer &buffer) const {
   buffer.encode_uint32(1, static_cast<uint32_t>(this->type));
   buffer.encode_bytes(2, this->data, this->data_len);
 }
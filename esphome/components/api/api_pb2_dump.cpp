@@ -513,6 +513,17 @@ template<> const char *proto_enum_to_string<enums::VoiceAssistantRequestFlag>(en
   }
 }
 #ifdef USE_VOICE_ASSISTANT
+template<>
+const char *proto_enum_to_string<enums::VoiceAssistantAudioFormat>(enums::VoiceAssistantAudioFormat value) {
+  switch (value) {
+    case enums::VOICE_ASSISTANT_AUDIO_FORMAT_PCM:
+      return "VOICE_ASSISTANT_AUDIO_FORMAT_PCM";
+    case enums::VOICE_ASSISTANT_AUDIO_FORMAT_IMA_ADPCM:
+      return "VOICE_ASSISTANT_AUDIO_FORMAT_IMA_ADPCM";
+    default:
+      return "UNKNOWN";
+  }
+}
 template<> const char *proto_enum_to_string<enums::VoiceAssistantEvent>(enums::VoiceAssistantEvent value) {
   switch (value) {
     case enums::VOICE_ASSISTANT_ERROR:
@@ -684,6 +695,7 @@ void HelloResponse::dump_to(std::string &out) const {
   dump_field(out, "api_version_minor", this->api_version_minor);
   dump_field(out, "server_info", this->server_info_ref_);
   dump_field(out, "name", this->name_ref_);
+  dump_field(out, "config_hash", this->config_hash);
 }
 #ifdef USE_API_PASSWORD
 void AuthenticationRequest::dump_to(std::string &out) const {
@@ -784,7 +796,17 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
 }
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
-void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
+void SubscribeStatesRequest::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "SubscribeStatesRequest");
+  for (const auto &it : this->keys) {
+    dump_field(out, "keys", it, 4);
+  }
+  for (const auto &it : this->message_types) {
+    dump_field(out, "message_types", it, 4);
+  }
+  dump_field(out, "min_interval_ms", this->min_interval_ms);
+  dump_field(out, "resume", this->resume);
+}
 #ifdef USE_BINARY_SENSOR
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "ListEntitiesBinarySensorResponse");
@@ -1158,9 +1180,15 @@ void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
 }
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "HomeAssistantStateResponse");
-  dump_field(out, "entity_id", this->entity_id);
-  dump_field(out, "state", this->state);
-  dump_field(out, "attribute", this->attribute);
+  out.append("  entity_id: ");
+  out.append(format_hex_pretty(this->entity_id, this->entity_id_len));
+  out.append("\n");
+  out.append("  state: ");
+  out.append(format_hex_pretty(this->state, this->state_len));
+  out.append("\n");
+  out.append("  attribute: ");
+  out.append(format_hex_pretty(this->attribute, this->attribute_len));
+  out.append("\n");
 }
 #endif
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
@@ -1248,6 +1276,11 @@ void CameraImageRequest::dump_to(std::string &out) const {
   dump_field(out, "single", this->single);
   dump_field(out, "stream", this->stream);
 }
+void StreamCreditRequest::dump_to(std::string &out) const {
+  MessageDumpHelper helper(out, "StreamCreditRequest");
+  dump_field(out, "key", this->key);
+  dump_field(out, "credit", this->credit);
+}
 #endif
 #ifdef USE_CLIMATE
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
@@ -1798,6 +1831,7 @@ void VoiceAssistantResponse::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "VoiceAssistantResponse");
   dump_field(out, "port", this->port);
   dump_field(out, "error", this->error);
+  dump_field(out, "audio_format", static_cast<enums::VoiceAssistantAudioFormat>(this->audio_format));
 }
 void VoiceAssistantEventData::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "VoiceAssistantEventData");
@@ -1816,11 +1850,7 @@ void VoiceAssistantEventResponse::dump_to(std::string &out) const {
 void VoiceAssistantAudio::dump_to(std::string &out) const {
   MessageDumpHelper helper(out, "VoiceAssistantAudio");
   out.append("  data: ");
-  if (this->data_ptr_ != nullptr) {
-    out.append(format_hex_pretty(this->data_ptr_, this->data_len_));
-  } else {
-    out.append(format_hex_pretty(reinterpret_cast<const uint8_t *>(this->data.data()), this->data.size()));
-  }
+  out.append(format_hex_pretty(this->data, this->data_len));
   out.append("\n");
   dump_field(out, "end", this->end);
 }
@@ -91,7 +91,7 @@ void APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
     }
     case SubscribeStatesRequest::MESSAGE_TYPE: {
       SubscribeStatesRequest msg;
-      // Empty message: no decode needed
+      msg.decode(msg_data, msg_size);
 #ifdef HAS_PROTO_MESSAGE_DUMP
       ESP_LOGVV(TAG, "on_subscribe_states_request: %s", msg.dump().c_str());
 #endif
@@ -621,6 +621,17 @@ void APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       this->on_homeassistant_action_response(msg);
       break;
     }
+#endif
+#ifdef USE_CAMERA
+    case StreamCreditRequest::MESSAGE_TYPE: {
+      StreamCreditRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_stream_credit_request: %s", msg.dump().c_str());
+#endif
+      this->on_stream_credit_request(msg);
+      break;
+    }
 #endif
     default:
       break;
@@ -686,6 +697,9 @@ void APIServerConnection::on_button_command_request(const ButtonCommandRequest &
 #ifdef USE_CAMERA
 void APIServerConnection::on_camera_image_request(const CameraImageRequest &msg) { this->camera_image(msg); }
 #endif
+#ifdef USE_CAMERA
+void APIServerConnection::on_stream_credit_request(const StreamCreditRequest &msg) { this->stream_credit(msg); }
+#endif
 #ifdef USE_CLIMATE
 void APIServerConnection::on_climate_command_request(const ClimateCommandRequest &msg) { this->climate_command(msg); }
 #endif
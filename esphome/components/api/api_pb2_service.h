@@ -86,6 +86,9 @@ class APIServerConnectionBase : public ProtoService {
 #ifdef USE_CAMERA
   virtual void on_camera_image_request(const CameraImageRequest &value){};
 #endif
+#ifdef USE_CAMERA
+  virtual void on_stream_credit_request(const StreamCreditRequest &value){};
+#endif
 
 #ifdef USE_CLIMATE
   virtual void on_climate_command_request(const ClimateCommandRequest &value){};
@@ -251,6 +254,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_CAMERA
   virtual void camera_image(const CameraImageRequest &msg) = 0;
 #endif
+#ifdef USE_CAMERA
+  virtual void stream_credit(const StreamCreditRequest &msg) = 0;
+#endif
 #ifdef USE_CLIMATE
   virtual void climate_command(const ClimateCommandRequest &msg) = 0;
 #endif
@@ -380,6 +386,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_CAMERA
   void on_camera_image_request(const CameraImageRequest &msg) override;
 #endif
+#ifdef USE_CAMERA
+  void on_stream_credit_request(const StreamCreditRequest &msg) override;
+#endif
 #ifdef USE_CLIMATE
   void on_climate_command_request(const ClimateCommandRequest &msg) override;
 #endif
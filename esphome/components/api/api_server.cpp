@@ -1,5 +1,6 @@
 #include "api_server.h"
 #ifdef USE_API
+#include <algorithm>
 #include <cerrno>
 #include "api_connection.h"
 #include "esphome/components/network/util.h"
@@ -100,7 +101,7 @@ void APIServer::setup() {
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback(
+    this->log_callback_handle_ = logger::global_logger->add_on_log_callback(
         [this](int level, const char *tag, const char *message, size_t message_len) {
           if (this->shutting_down_) {
             // Don't try to send logs during shutdown
@@ -108,11 +109,15 @@ void APIServer::setup() {
             // we would be filling a buffer we are trying to clear
             return;
           }
+          // Logs are the first thing to go while memory is short
+          if (this->buffer_pool_.is_low_memory())
+            return;
           for (auto &c : this->clients_) {
             if (!c->flags_.remove && c->get_log_subscription_level() >= level)
               c->try_send_log_message(level, tag, message, message_len);
           }
-        });
+        },
+        ESPHOME_LOG_LEVEL_NONE);  // Raised once a client subscribes
   }
 #endif
 
@@ -156,6 +161,12 @@ void APIServer::loop() {
         sock.reset();
         continue;
       }
+      // Keep serving the clients already connected rather than risk memory for one more
+      if (this->buffer_pool_.is_low_memory() && !this->clients_.empty()) {
+        ESP_LOGW(TAG, "Low memory, rejecting %s", sock->getpeername().c_str());
+        sock.reset();
+        continue;
+      }
 
       ESP_LOGD(TAG, "Accept %s", sock->getpeername().c_str());
 
@@ -171,7 +182,12 @@ void APIServer::loop() {
     }
   }
 
+  this->buffer_pool_.loop(this->shared_write_buffer_, App.get_loop_component_start_time());
+
   if (this->clients_.empty()) {
+#ifdef USE_POWER_MANAGEMENT
+    this->performance_lock_.release();
+#endif
     return;
   }
 
@@ -187,6 +203,9 @@ void APIServer::loop() {
     // Continue to process and clean up the clients below
   }
 
+#ifdef USE_POWER_MANAGEMENT
+  bool burst = false;
+#endif
   size_t client_index = 0;
   while (client_index < this->clients_.size()) {
     auto &client = this->clients_[client_index];
@@ -194,6 +213,10 @@ void APIServer::loop() {
     if (!client->flags_.remove) {
       // Common case: process active client
       client->loop();
+#ifdef USE_POWER_MANAGEMENT
+      burst = burst || !client->helper_->can_write_without_blocking() ||
+              !client->list_entities_iterator_.completed() || !client->initial_state_iterator_.completed();
+#endif
       client_index++;
       continue;
     }
@@ -203,12 +226,23 @@ void APIServer::loop() {
     this->client_disconnected_trigger_->trigger(client->client_info_.name, client->client_info_.peername);
 #endif
     ESP_LOGV(TAG, "Remove connection %s", client->client_info_.name.c_str());
+#ifdef USE_API_STATE_RESUME
+    this->save_resume_point_(client.get());
+#endif
 
     // Swap with the last element and pop (avoids expensive vector shifts)
     if (client_index < this->clients_.size() - 1) {
       std::swap(this->clients_[client_index], this->clients_.back());
     }
     this->clients_.pop_back();
+#ifdef USE_LOGGER
+    this->update_log_subscription_level();
+#endif
+    if (this->clients_.size() < 2) {
+      // Nobody left to share encoded states with
+      this->encoded_states_.clear();
+      this->encoded_states_.shrink_to_fit();
+    }
 
     // Schedule reboot when last client disconnects
     if (this->clients_.empty() && this->reboot_timeout_ != 0) {
@@ -216,8 +250,24 @@ void APIServer::loop() {
     }
     // Don't increment client_index since we need to process the swapped element
   }
+#ifdef USE_POWER_MANAGEMENT
+  this->performance_lock_.set(burst);
+#endif
 }
 
+#ifdef USE_LOGGER
+void APIServer::update_log_subscription_level() {
+  if (logger::global_logger == nullptr)
+    return;
+  uint8_t level = ESPHOME_LOG_LEVEL_NONE;
+  for (auto &c : this->clients_) {
+    if (!c->flags_.remove)
+      level = std::max(level, c->get_log_subscription_level());
+  }
+  logger::global_logger->set_log_callback_level(this->log_callback_handle_, level);
+}
+#endif
+
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "Server:\n"
@@ -225,6 +275,9 @@ void APIServer::dump_config() {
                 "  Listen backlog: %u\n"
                 "  Max connections: %u",
                 network::get_use_address().c_str(), this->port_, this->listen_backlog_, this->max_connections_);
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  ESP_LOGCONFIG(TAG, "  Batch delay: %ums, adaptive up to %ums", this->batch_delay_, this->max_batch_delay_);
+#endif
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Noise encryption: %s", YESNO(this->noise_ctx_->has_psk()));
   if (!this->noise_ctx_->has_psk()) {
@@ -269,11 +322,49 @@ bool APIServer::check_password(const uint8_t *password_data, size_t password_len
 
 void APIServer::handle_disconnect(APIConnection *conn) {}
 
+const std::vector<uint8_t> *APIServer::get_encoded_state(EntityBase *entity, uint8_t message_type) const {
+  for (const auto &it : this->encoded_states_) {
+    if (it.entity == entity && it.message_type == message_type)
+      return &it.payload;
+  }
+  return nullptr;
+}
+
+void APIServer::store_encoded_state(EntityBase *entity, uint8_t message_type, const uint8_t *payload, size_t size) {
+  // A single connection never encodes the same state twice
+  if (this->clients_.size() < 2)
+    return;
+  this->encoded_states_.push_back({entity, message_type, std::vector<uint8_t>(payload, payload + size)});
+}
+
+void APIServer::invalidate_encoded_state_(EntityBase *entity) {
+  for (size_t i = 0; i < this->encoded_states_.size(); i++) {
+    if (this->encoded_states_[i].entity == entity) {
+      // Order doesn't matter, swap with the last element and pop
+      if (i < this->encoded_states_.size() - 1)
+        std::swap(this->encoded_states_[i], this->encoded_states_.back());
+      this->encoded_states_.pop_back();
+      return;
+    }
+  }
+}
+
 // Macro for entities without extra parameters
+#ifdef USE_API_STATE_RESUME
+#define API_RECORD_STATE_CHANGE(entity_type, entity_name) \
+  this->record_state_change_(obj, [](APIConnection *conn, EntityBase *entity) { \
+    conn->send_##entity_name##_state(static_cast<entity_type *>(entity)); /* NOLINT(bugprone-macro-parentheses) */ \
+  });
+#else
+#define API_RECORD_STATE_CHANGE(entity_type, entity_name)
+#endif
+
 #define API_DISPATCH_UPDATE(entity_type, entity_name) \
   void APIServer::on_##entity_name##_update(entity_type *obj) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    this->invalidate_encoded_state_(obj); \
+    API_RECORD_STATE_CHANGE(entity_type, entity_name) \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -283,6 +374,8 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
   void APIServer::on_##entity_name##_update(entity_type *obj, __VA_ARGS__) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    this->invalidate_encoded_state_(obj); \
+    API_RECORD_STATE_CHANGE(entity_type, entity_name) \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -370,6 +463,8 @@ void APIServer::on_event(event::Event *obj, const std::string &event_type) {
 void APIServer::on_update(update::UpdateEntity *obj) {
   if (obj->is_internal())
     return;
+  this->invalidate_encoded_state_(obj);
+  API_RECORD_STATE_CHANGE(update::UpdateEntity, update)
   for (auto &c : this->clients_)
     c->send_update_state(obj);
 }
@@ -388,6 +483,64 @@ void APIServer::on_zwave_proxy_request(const esphome::api::ProtoMessage &msg) {
 API_DISPATCH_UPDATE(alarm_control_panel::AlarmControlPanel, alarm_control_panel)
 #endif
 
+#ifdef USE_API_STATE_RESUME
+// Clients remembered for a resume, the oldest is dropped beyond this
+static constexpr size_t MAX_RESUME_POINTS = 4;
+
+void APIServer::record_state_change_(EntityBase *entity, StateResender resend) {
+  const uint32_t seq = ++this->state_seq_;
+  auto it = std::lower_bound(this->state_changes_.begin(), this->state_changes_.end(), entity,
+                             [](const StateChange &change, EntityBase *e) { return change.entity < e; });
+  if (it != this->state_changes_.end() && it->entity == entity) {
+    it->seq = seq;
+    return;
+  }
+  this->state_changes_.insert(it, StateChange{entity, resend, seq});
+}
+
+void APIServer::save_resume_point_(APIConnection *conn) {
+  if (!conn->flags_.state_subscription || !conn->initial_state_iterator_.completed() ||
+      conn->client_info_.name.empty())
+    return;
+  const uint32_t now = App.get_loop_component_start_time();
+  const std::string &name = conn->client_info_.name;
+  const std::string &peername = conn->client_info_.peername;
+  this->resume_points_.erase(std::remove_if(this->resume_points_.begin(), this->resume_points_.end(),
+                                            [&](const ResumePoint &point) {
+                                              return now - point.time >= this->resume_timeout_ ||
+                                                     (point.name == name && point.peername == peername);
+                                            }),
+                             this->resume_points_.end());
+  if (this->resume_points_.size() >= MAX_RESUME_POINTS)
+    this->resume_points_.erase(this->resume_points_.begin());
+  this->resume_points_.push_back({name, peername, conn->get_resume_seq_(), now});
+}
+
+bool APIServer::resume_states(APIConnection *conn) {
+  const uint32_t now = App.get_loop_component_start_time();
+  for (auto it = this->resume_points_.begin(); it != this->resume_points_.end(); ++it) {
+    if (it->name != conn->client_info_.name || it->peername != conn->client_info_.peername)
+      continue;
+    const uint32_t seq = it->seq;
+    const bool expired = now - it->time >= this->resume_timeout_;
+    this->resume_points_.erase(it);
+    if (expired)
+      return false;
+    uint16_t count = 0;
+    for (const auto &change : this->state_changes_) {
+      if (static_cast<int32_t>(change.seq - seq) > 0) {
+        change.resend(conn, change.entity);
+        count++;
+      }
+    }
+    ESP_LOGD(TAG, "%s (%s): Resumed, %u states changed", conn->client_info_.name.c_str(),
+             conn->client_info_.peername.c_str(), count);
+    return true;
+  }
+  return false;
+}
+#endif
+
 float APIServer::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
 
 void APIServer::set_port(uint16_t port) { this->port_ = port; }
@@ -438,26 +591,55 @@ void APIServer::handle_action_response(uint32_t call_id, bool success, const std
 #endif  // USE_API_HOMEASSISTANT_SERVICES
 
 #ifdef USE_API_HOMEASSISTANT_STATES
-void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                               std::function<void(std::string)> f) {
+APIServer::HomeAssistantStateSubscription &APIServer::get_state_sub_(std::string entity_id,
+                                                                      optional<std::string> attribute, bool once) {
+  // Components importing the same state share the subscription, Home Assistant then sends each update only once
+  for (auto &it : this->state_subs_) {
+    if (it.once == once && it.entity_id == entity_id && it.attribute.value_or("") == attribute.value_or(""))
+      return it;
+  }
   this->state_subs_.push_back(HomeAssistantStateSubscription{
       .entity_id = std::move(entity_id),
       .attribute = std::move(attribute),
-      .callback = std::move(f),
-      .once = false,
+      .callbacks = {},
+      .number_callbacks = {},
+      .last_state = {},
+      .last_number = {},
+      .once = once,
   });
+  return this->state_subs_.back();
+}
+
+void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
+                                               std::function<void(std::string)> f) {
+  this->get_state_sub_(std::move(entity_id), std::move(attribute), false).callbacks.push_back(std::move(f));
+}
+
+void APIServer::subscribe_home_assistant_number(std::string entity_id, optional<std::string> attribute,
+                                                HomeAssistantNumberCallback f) {
+  this->get_state_sub_(std::move(entity_id), std::move(attribute), false).number_callbacks.push_back(std::move(f));
 }
 
 void APIServer::get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                          std::function<void(std::string)> f) {
-  this->state_subs_.push_back(HomeAssistantStateSubscription{
-      .entity_id = std::move(entity_id),
-      .attribute = std::move(attribute),
-      .callback = std::move(f),
-      .once = true,
-  });
+  this->get_state_sub_(std::move(entity_id), std::move(attribute), true).callbacks.push_back(std::move(f));
 };
 
+void APIServer::HomeAssistantStateSubscription::deliver(const std::string &state) const {
+  for (auto &callback : this->callbacks)
+    callback(state);
+  if (this->number_callbacks.empty())
+    return;
+  // Attribute subscriptions repeat the same text on every change of the entity, only parse when it changed. The empty
+  // initial state matches its nullopt value.
+  if (state != this->last_state) {
+    this->last_state = state;
+    this->last_number = parse_number<float>(state);
+  }
+  for (auto &callback : this->number_callbacks)
+    callback(state, this->last_number);
+}
+
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
 }
@@ -529,6 +711,12 @@ void APIServer::on_shutdown() {
 
   // Change batch delay to 5ms for quick flushing during shutdown
   this->batch_delay_ = 5;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->max_batch_delay_ = 5;
+  for (auto &c : this->clients_) {
+    c->batch_delay_ms_ = 0;
+  }
+#endif
 
   // Send disconnect requests to all connected clients
   for (auto &c : this->clients_) {
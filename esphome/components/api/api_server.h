@@ -2,6 +2,7 @@
 
 #include "esphome/core/defines.h"
 #ifdef USE_API
+#include "api_buffer_pool.h"
 #include "api_noise_context.h"
 #include "api_pb2.h"
 #include "api_pb2_service.h"
@@ -15,6 +16,9 @@
 #ifdef USE_API_SERVICES
 #include "user_services.h"
 #endif
+#ifdef USE_POWER_MANAGEMENT
+#include "esphome/components/power_management/power_management.h"
+#endif
 
 #include <map>
 #include <vector>
@@ -34,6 +38,8 @@ class APIServer : public Component, public Controller {
   uint16_t get_port() const;
   float get_setup_priority() const override;
   void loop() override;
+  // Client sockets are read here, a deferred pass delays every API message
+  LoopClass get_loop_class() const override { return LoopClass::LATENCY_CRITICAL; }
   void dump_config() override;
   void on_shutdown() override;
   bool teardown() override;
@@ -45,11 +51,31 @@ class APIServer : public Component, public Controller {
   void set_reboot_timeout(uint32_t reboot_timeout);
   void set_batch_delay(uint16_t batch_delay);
   uint16_t get_batch_delay() const { return batch_delay_; }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  void set_max_batch_delay(uint16_t max_batch_delay) { this->max_batch_delay_ = max_batch_delay; }
+  uint16_t get_max_batch_delay() const { return this->max_batch_delay_; }
+#endif
+  void set_config_hash(uint32_t config_hash) { this->config_hash_ = config_hash; }
+  uint32_t get_config_hash() const { return this->config_hash_; }
+#ifdef USE_API_STATE_RESUME
+  void set_resume_timeout(uint32_t resume_timeout) { this->resume_timeout_ = resume_timeout; }
+  /// Number of state changes so far, connections remember up to which one they are in sync.
+  uint32_t get_state_seq() const { return this->state_seq_; }
+  /// Queue the states that changed since the client was last in sync, false if it needs a full sync instead.
+  bool resume_states(APIConnection *conn);
+#endif
   void set_listen_backlog(uint8_t listen_backlog) { this->listen_backlog_ = listen_backlog; }
   void set_max_connections(uint8_t max_connections) { this->max_connections_ = max_connections; }
 
   // Get reference to shared buffer for API connections
   std::vector<uint8_t> &get_shared_buffer_ref() { return shared_write_buffer_; }
+  // Receive buffers and scatter list shared by the frame helpers of all connections
+  APIBufferPool &get_buffer_pool() { return this->buffer_pool_; }
+
+  /// Encoded payload of the current state message of an entity, nullptr if no connection encoded it yet.
+  const std::vector<uint8_t> *get_encoded_state(EntityBase *entity, uint8_t message_type) const;
+  /// Keep an encoded state message for the other connections, only done while more than one is connected.
+  void store_encoded_state(EntityBase *entity, uint8_t message_type, const uint8_t *payload, size_t size);
 
 #ifdef USE_API_NOISE
   bool save_noise_psk(psk_t psk, bool make_active = true);
@@ -58,6 +84,10 @@ class APIServer : public Component, public Controller {
 #endif  // USE_API_NOISE
 
   void handle_disconnect(APIConnection *conn);
+#ifdef USE_LOGGER
+  /// Tell the logger the highest level any client subscribed to, so nothing above it gets formatted.
+  void update_log_subscription_level();
+#endif
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj) override;
 #endif
@@ -146,15 +176,29 @@ class APIServer : public Component, public Controller {
   bool is_connected() const;
 
 #ifdef USE_API_HOMEASSISTANT_STATES
+  /// Receives the raw state and its value parsed as a number, nullopt when it isn't one.
+  using HomeAssistantNumberCallback = std::function<void(const std::string &, optional<float>)>;
+
+  /// One subscription per entity and attribute, shared by every local consumer of that state.
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
-    std::function<void(std::string)> callback;
+    std::vector<std::function<void(std::string)>> callbacks;
+    std::vector<HomeAssistantNumberCallback> number_callbacks;
+    // Last state and its parsed value, only tracked for number consumers
+    mutable std::string last_state;
+    mutable optional<float> last_number;
     bool once;
+
+    /// Fans the state out to all consumers, parsing it at most once.
+    void deliver(const std::string &state) const;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                       std::function<void(std::string)> f);
+  /// Like subscribe_home_assistant_state(), but the state is parsed once for all consumers of the same entity.
+  void subscribe_home_assistant_number(std::string entity_id, optional<std::string> attribute,
+                                       HomeAssistantNumberCallback f);
   void get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                 std::function<void(std::string)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
@@ -174,6 +218,15 @@ class APIServer : public Component, public Controller {
 
  protected:
   void schedule_reboot_timeout_();
+  /// The entity published a new state, its encoding is outdated
+  void invalidate_encoded_state_(EntityBase *entity);
+#ifdef USE_API_STATE_RESUME
+  /// Sends the current state of an entity to one connection
+  using StateResender = void (*)(APIConnection *conn, EntityBase *entity);
+  void record_state_change_(EntityBase *entity, StateResender resend);
+  /// Remember where a disconnecting client was in sync, so its next connection can resume from there
+  void save_resume_point_(APIConnection *conn);
+#endif
   // Pointers and pointer-like types first (4 bytes each)
   std::unique_ptr<socket::Socket> socket_ = nullptr;
 #ifdef USE_API_CLIENT_CONNECTED_TRIGGER
@@ -185,6 +238,11 @@ class APIServer : public Component, public Controller {
 
   // 4-byte aligned types
   uint32_t reboot_timeout_{300000};
+  uint32_t config_hash_{0};
+#ifdef USE_API_STATE_RESUME
+  uint32_t resume_timeout_{0};
+  uint32_t state_seq_{0};
+#endif
 
   // Vectors and strings (12 bytes each on 32-bit)
   std::vector<std::unique_ptr<APIConnection>> clients_;
@@ -192,7 +250,34 @@ class APIServer : public Component, public Controller {
   std::string password_;
 #endif
   std::vector<uint8_t> shared_write_buffer_;  // Shared proto write buffer for all connections
+  APIBufferPool buffer_pool_;
+  // State messages encoded by one connection and reused by the others until the entity publishes again
+  struct EncodedState {
+    EntityBase *entity;
+    uint8_t message_type;
+    std::vector<uint8_t> payload;
+  };
+  std::vector<EncodedState> encoded_states_;
+#ifdef USE_API_STATE_RESUME
+  // Latest change of every entity that changed at least once, sorted by entity
+  struct StateChange {
+    EntityBase *entity;
+    StateResender resend;
+    uint32_t seq;
+  };
+  std::vector<StateChange> state_changes_;
+  // Where recently disconnected clients were in sync, dropped after resume_timeout
+  struct ResumePoint {
+    std::string name;
+    std::string peername;
+    uint32_t seq;
+    uint32_t time;
+  };
+  std::vector<ResumePoint> resume_points_;
+#endif
 #ifdef USE_API_HOMEASSISTANT_STATES
+  HomeAssistantStateSubscription &get_state_sub_(std::string entity_id, optional<std::string> attribute, bool once);
+
   std::vector<HomeAssistantStateSubscription> state_subs_;
 #endif
 #ifdef USE_API_SERVICES
@@ -205,10 +290,17 @@ class APIServer : public Component, public Controller {
   };
   std::vector<PendingActionResponse> action_response_callbacks_;
 #endif
+#ifdef USE_LOGGER
+  size_t log_callback_handle_{0};
+#endif
 
   // Group smaller types together
   uint16_t port_{6053};
   uint16_t batch_delay_{100};
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  // Upper bound for the batch window of a connection whose socket is backed up
+  uint16_t max_batch_delay_{0};
+#endif
   // Connection limits - these defaults will be overridden by config values
   // from cv.SplitDefault in __init__.py which sets platform-specific defaults
   uint8_t listen_backlog_{4};
@@ -220,6 +312,10 @@ class APIServer : public Component, public Controller {
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
   ESPPreferenceObject noise_pref_;
 #endif  // USE_API_NOISE
+#ifdef USE_POWER_MANAGEMENT
+  // Held during handshakes, the entity list and initial states, and while a socket is backed up
+  power_management::PerformanceLock performance_lock_{"api"};
+#endif
 };
 
 extern APIServer *global_api_server;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
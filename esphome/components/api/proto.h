@@ -229,12 +229,33 @@ class Proto32Bit {
 
 // NOTE: Proto64Bit class removed - wire type 1 (64-bit fixed) not supported
 
+/**
+ * Write cursor into a buffer that is already sized for the whole message.
+ *
+ * The size of every message is known up front from ProtoSize, so the buffer is resized once and the encode methods
+ * store through a pointer without any bounds or capacity checks. Encoding more than ProtoSize calculated is a bug.
+ */
 class ProtoWriteBuffer {
  public:
+  /// Refers to a buffer holding complete messages, for the frame helpers; nothing can be encoded through it.
   ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
-  void write(uint8_t value) { this->buffer_->push_back(value); }
-  void encode_varint_raw(ProtoVarInt value) { value.encode(*this->buffer_); }
-  void encode_varint_raw(uint32_t value) { this->encode_varint_raw(ProtoVarInt(value)); }
+  /// Encode from offset on, buffer must already be resized to hold everything that will be encoded.
+  ProtoWriteBuffer(std::vector<uint8_t> *buffer, size_t offset) : buffer_(buffer), pos_(buffer->data() + offset) {}
+  void write(uint8_t value) { *this->pos_++ = value; }
+  void encode_varint_raw(uint32_t value) {
+    while (value > 0x7F) {
+      *this->pos_++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *this->pos_++ = static_cast<uint8_t>(value);
+  }
+  void encode_varint_raw_64(uint64_t value) {
+    while (value > 0x7F) {
+      *this->pos_++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *this->pos_++ = static_cast<uint8_t>(value);
+  }
   /**
    * Encode a field key (tag/wire type combination).
    *
@@ -257,13 +278,8 @@ class ProtoWriteBuffer {
 
     this->encode_field_raw(field_id, 2);  // type 2: Length-delimited string
     this->encode_varint_raw(len);
-
-    // Using resize + memcpy instead of insert provides significant performance improvement:
-    // ~10-11x faster for 16-32 byte strings, ~3x faster for 64-byte strings
-    // as it avoids iterator checks and potential element moves that insert performs
-    size_t old_size = this->buffer_->size();
-    this->buffer_->resize(old_size + len);
-    std::memcpy(this->buffer_->data() + old_size, string, len);
+    std::memcpy(this->pos_, string, len);
+    this->pos_ += len;
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
     this->encode_string(field_id, value.data(), value.size(), force);
@@ -284,7 +300,7 @@ class ProtoWriteBuffer {
     if (value == 0 && !force)
       return;
     this->encode_field_raw(field_id, 0);  // type 0: Varint - uint64
-    this->encode_varint_raw(ProtoVarInt(value));
+    this->encode_varint_raw_64(value);
   }
   void encode_bool(uint32_t field_id, bool value, bool force = false) {
     if (!value && !force)
@@ -297,10 +313,11 @@ class ProtoWriteBuffer {
       return;
 
     this->encode_field_raw(field_id, 5);  // type 5: 32-bit fixed32
-    this->write((value >> 0) & 0xFF);
-    this->write((value >> 8) & 0xFF);
-    this->write((value >> 16) & 0xFF);
-    this->write((value >> 24) & 0xFF);
+    this->pos_[0] = (value >> 0) & 0xFF;
+    this->pos_[1] = (value >> 8) & 0xFF;
+    this->pos_[2] = (value >> 16) & 0xFF;
+    this->pos_[3] = (value >> 24) & 0xFF;
+    this->pos_ += 4;
   }
   // NOTE: Wire type 1 (64-bit fixed: double, fixed64, sfixed64) is intentionally
   // not supported to reduce overhead on embedded systems. All ESPHome devices are
@@ -336,9 +353,12 @@ class ProtoWriteBuffer {
   }
   void encode_message(uint32_t field_id, const ProtoMessage &value, bool force = false);
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
+  /// Where the next byte will be encoded
+  const uint8_t *get_pos() const { return pos_; }
 
  protected:
   std::vector<uint8_t> *buffer_;
+  uint8_t *pos_{nullptr};
 };
 
 // Forward declaration
@@ -348,7 +368,7 @@ class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
   // Default implementation for messages with no fields
-  virtual void encode(ProtoWriteBuffer buffer) const {}
+  virtual void encode(ProtoWriteBuffer &buffer) const {}
   // Default implementation for messages with no fields
   virtual void calculate_size(ProtoSize &size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -803,21 +823,16 @@ inline void ProtoWriteBuffer::encode_message(uint32_t field_id, const ProtoMessa
   value.calculate_size(msg_size);
   uint32_t msg_length_bytes = msg_size.get_size();
 
-  // Calculate how many bytes the length varint needs
-  uint32_t varint_length_bytes = ProtoSize::varint(msg_length_bytes);
-
-  // Reserve exact space for the length varint
-  size_t begin = this->buffer_->size();
-  this->buffer_->resize(this->buffer_->size() + varint_length_bytes);
+  this->encode_varint_raw(msg_length_bytes);
 
-  // Write the length varint directly
-  ProtoVarInt(msg_length_bytes).encode_to_buffer_unchecked(this->buffer_->data() + begin, varint_length_bytes);
-
-  // Now encode the message content - it will append to the buffer
+  // Now encode the message content right behind its length
+#ifndef NDEBUG
+  const uint8_t *begin = this->pos_;
+#endif
   value.encode(*this);
 
   // Verify that the encoded size matches what we calculated
-  assert(this->buffer_->size() == begin + varint_length_bytes + msg_length_bytes);
+  assert(this->pos_ == begin + msg_length_bytes);
 }
 
 // Implementation of decode_to_message - must be after ProtoDecodableMessage is defined
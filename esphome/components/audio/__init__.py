@@ -7,6 +7,7 @@ CODEOWNERS = ["@kahrendt"]
 audio_ns = cg.esphome_ns.namespace("audio")
 
 AudioFile = audio_ns.struct("AudioFile")
+PolyphaseFilter = audio_ns.struct("PolyphaseFilter")
 AudioFileType = audio_ns.enum("AudioFileType", is_class=True)
 AUDIO_FILE_TYPE_ENUM = {
     "NONE": AudioFileType.NONE,
@@ -54,12 +54,47 @@ const char *audio_file_type_to_string(AudioFileType file_type) {
   }
 }
 
+// Both kernels work on four samples per iteration so the loads and multiplies of independent samples can overlap, the
+// bounds of saturate_sample() compile to a single clamps instruction on Xtensa.
+static inline int16_t saturate_sample(int32_t sample) {
+  return static_cast<int16_t>(sample < INT16_MIN ? INT16_MIN : (sample > INT16_MAX ? INT16_MAX : sample));
+}
+
 void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, int16_t scale_factor,
                          size_t samples_to_scale) {
   // Note the assembly dsps_mulc function has audio glitches if the input and output buffers are the same.
-  for (size_t i = 0; i < samples_to_scale; i++) {
-    int32_t acc = (int32_t) audio_samples[i] * (int32_t) scale_factor;
-    output_buffer[i] = (int16_t) (acc >> 15);
+  const int32_t factor = scale_factor;
+  size_t i = 0;
+  for (; i + 4 <= samples_to_scale; i += 4) {
+    const int32_t acc0 = audio_samples[i] * factor;
+    const int32_t acc1 = audio_samples[i + 1] * factor;
+    const int32_t acc2 = audio_samples[i + 2] * factor;
+    const int32_t acc3 = audio_samples[i + 3] * factor;
+    output_buffer[i] = static_cast<int16_t>(acc0 >> 15);
+    output_buffer[i + 1] = static_cast<int16_t>(acc1 >> 15);
+    output_buffer[i + 2] = static_cast<int16_t>(acc2 >> 15);
+    output_buffer[i + 3] = static_cast<int16_t>(acc3 >> 15);
+  }
+  for (; i < samples_to_scale; i++) {
+    output_buffer[i] = static_cast<int16_t>((audio_samples[i] * factor) >> 15);
+  }
+}
+
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples_to_add) {
+  size_t i = 0;
+  for (; i + 4 <= samples_to_add; i += 4) {
+    const int32_t sum0 = first_samples[i] + second_samples[i];
+    const int32_t sum1 = first_samples[i + 1] + second_samples[i + 1];
+    const int32_t sum2 = first_samples[i + 2] + second_samples[i + 2];
+    const int32_t sum3 = first_samples[i + 3] + second_samples[i + 3];
+    output_buffer[i] = saturate_sample(sum0);
+    output_buffer[i + 1] = saturate_sample(sum1);
+    output_buffer[i + 2] = saturate_sample(sum2);
+    output_buffer[i + 3] = saturate_sample(sum3);
+  }
+  for (; i < samples_to_add; i++) {
+    output_buffer[i] = saturate_sample(first_samples[i] + second_samples[i]);
   }
 }
 
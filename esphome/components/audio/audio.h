@@ -135,6 +135,15 @@ const char *audio_file_type_to_string(AudioFileType file_type);
 void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, int16_t scale_factor,
                          size_t samples_to_scale);
 
+/// @brief Adds two buffers of PCM int16 audio samples, saturating the sums to the int16 range. The output buffer may
+///        be either of the input buffers.
+/// @param first_samples PCM int16 audio samples
+/// @param second_samples PCM int16 audio samples to add to first_samples
+/// @param output_buffer Buffer to store the summed samples
+/// @param samples_to_add Number of samples to add
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples_to_add);
+
 /// @brief Unpacks a quantized audio sample into a Q31 fixed-point number.
 /// @param data Pointer to uint8_t array containing the audio sample
 /// @param bytes_per_sample The number of bytes per sample
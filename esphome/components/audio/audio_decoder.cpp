@@ -27,7 +27,7 @@ AudioDecoder::~AudioDecoder() {
 
 esp_err_t AudioDecoder::add_source(std::weak_ptr<RingBuffer> &input_ring_buffer) {
   if (this->input_transfer_buffer_ != nullptr) {
-    this->input_transfer_buffer_->set_source(input_ring_buffer);
+    this->input_transfer_buffer_->set_source(input_ring_buffer, true);
     return ESP_OK;
   }
   return ESP_ERR_NO_MEM;
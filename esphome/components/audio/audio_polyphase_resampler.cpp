@@ -0,0 +1,73 @@
+#include "audio_polyphase_resampler.h"
+
+namespace esphome {
+namespace audio {
+
+PolyphaseResampler::PolyphaseResampler(const PolyphaseFilter *filter, uint8_t channels)
+    : filter_(filter), channels_(channels) {
+  this->history_.resize(static_cast<size_t>(channels) * filter->taps * 2, 0);
+}
+
+void PolyphaseResampler::push_frame_(const int16_t *frame) {
+  const uint16_t taps = this->filter_->taps;
+  int16_t *history = this->history_.data();
+  for (uint8_t channel = 0; channel < this->channels_; ++channel) {
+    history[this->history_position_] = frame[channel];
+    history[this->history_position_ + taps] = frame[channel];
+    history += 2 * taps;
+  }
+  if (++this->history_position_ == taps) {
+    this->history_position_ = 0;
+  }
+}
+
+uint32_t PolyphaseResampler::resample(const int16_t *input_buffer, int16_t *output_buffer, uint32_t input_frames,
+                                      uint32_t output_frames, uint32_t *frames_used) {
+  const uint16_t taps = this->filter_->taps;
+  const uint16_t interpolation = this->filter_->interpolation;
+  const uint16_t decimation = this->filter_->decimation;
+
+  uint32_t frames_generated = 0;
+  uint32_t input_index = 0;
+
+  while (frames_generated < output_frames) {
+    while ((this->pending_frames_ > 0) && (input_index < input_frames)) {
+      this->push_frame_(input_buffer + input_index * this->channels_);
+      ++input_index;
+      --this->pending_frames_;
+    }
+    if (this->pending_frames_ > 0) {
+      // Out of input
+      break;
+    }
+
+    const int16_t *coefficients = this->filter_->coefficients + this->phase_ * taps;
+    const int16_t *window = this->history_.data() + this->history_position_;
+    for (uint8_t channel = 0; channel < this->channels_; ++channel) {
+      // Four independent accumulators keep the multiplies pipelined, taps is a multiple of 4
+      int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+      for (uint16_t tap = 0; tap < taps; tap += 4) {
+        acc0 += window[tap] * coefficients[tap];
+        acc1 += window[tap + 1] * coefficients[tap + 1];
+        acc2 += window[tap + 2] * coefficients[tap + 2];
+        acc3 += window[tap + 3] * coefficients[tap + 3];
+      }
+      // Round to nearest before dropping the Q15 fraction. The coefficient bound keeps the sum from overflowing
+      const int32_t sample = (acc0 + acc1 + acc2 + acc3 + (1 << 14)) >> 15;
+      output_buffer[frames_generated * this->channels_ + channel] =
+          static_cast<int16_t>(sample < INT16_MIN ? INT16_MIN : (sample > INT16_MAX ? INT16_MAX : sample));
+      window += 2 * taps;
+    }
+    ++frames_generated;
+
+    this->phase_ += decimation;
+    this->pending_frames_ += this->phase_ / interpolation;
+    this->phase_ %= interpolation;
+  }
+
+  *frames_used = input_index;
+  return frames_generated;
+}
+
+}  // namespace audio
+}  // namespace esphome
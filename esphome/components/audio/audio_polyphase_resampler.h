@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace audio {
+
+struct PolyphaseFilter {
+  /* Coefficient table of a fixed-point polyphase FIR filter converting between two sample rates with the rational ratio
+   * interpolation / decimation. The tables are generated by the code generator for the sample rates selected in the
+   * configuration.
+   *
+   *  - coefficients holds interpolation phases of taps Q15 coefficients each, phase-major.
+   *  - The coefficients of a phase are ordered from the oldest to the newest input sample they are applied to.
+   *  - The sum of the absolute coefficients of each phase is below 2 in Q15, so the products of full scale samples
+   *    accumulate in an int32 without overflowing.
+   */
+  uint32_t source_sample_rate;
+  uint32_t target_sample_rate;
+  uint16_t interpolation;
+  uint16_t decimation;
+  uint16_t taps;
+  const int16_t *coefficients;
+};
+
+class PolyphaseResampler {
+  /*
+   * @brief Resamples interleaved 16 bit PCM audio with a precomputed PolyphaseFilter using only integer arithmetic.
+   * The last taps frames of input are kept between calls, so the stream can be fed in arbitrarily sized chunks.
+   */
+ public:
+  /// @brief Sets the filter and allocates the sample history for the channels.
+  /// @param filter Coefficient table, must outlive the resampler. Its taps must be a multiple of 4.
+  /// @param channels Number of interleaved channels
+  PolyphaseResampler(const PolyphaseFilter *filter, uint8_t channels);
+
+  /// @brief Resamples as many input frames as fit into the output buffer.
+  /// @param input_buffer Interleaved samples to resample
+  /// @param output_buffer Buffer to store the resampled interleaved samples
+  /// @param input_frames Number of frames available in input_buffer
+  /// @param output_frames Number of frames free in output_buffer
+  /// @param frames_used Pointer to a (uint32_t) variable that will store the number of input frames used
+  /// @return Number of frames written to the output buffer
+  uint32_t resample(const int16_t *input_buffer, int16_t *output_buffer, uint32_t input_frames, uint32_t output_frames,
+                    uint32_t *frames_used);
+
+ protected:
+  /// @brief Appends one input frame to the history of every channel.
+  void push_frame_(const int16_t *frame);
+
+  const PolyphaseFilter *filter_;
+  uint8_t channels_;
+
+  // Each channel keeps its last taps samples twice in a row, so the window is always contiguous at history_position_
+  std::vector<int16_t> history_;
+  uint16_t history_position_{0};
+
+  uint16_t phase_{0};
+  // Input frames to add to the history before the next output frame can be computed
+  uint32_t pending_frames_{1};
+};
+
+}  // namespace audio
+}  // namespace esphome
@@ -19,7 +19,7 @@ AudioResampler::AudioResampler(size_t input_buffer_size, size_t output_buffer_si
 
 esp_err_t AudioResampler::add_source(std::weak_ptr<RingBuffer> &input_ring_buffer) {
   if (this->input_transfer_buffer_ != nullptr) {
-    this->input_transfer_buffer_->set_source(input_ring_buffer);
+    this->input_transfer_buffer_->set_source(input_ring_buffer, true);
     return ESP_OK;
   }
   return ESP_ERR_NO_MEM;
@@ -44,7 +44,8 @@ esp_err_t AudioResampler::add_sink(speaker::Speaker *speaker) {
 #endif
 
 esp_err_t AudioResampler::start(AudioStreamInfo &input_stream_info, AudioStreamInfo &output_stream_info,
-                                uint16_t number_of_taps, uint16_t number_of_filters) {
+                                uint16_t number_of_taps, uint16_t number_of_filters,
+                                const PolyphaseFilter *polyphase_filter) {
   this->input_stream_info_ = input_stream_info;
   this->output_stream_info_ = output_stream_info;
 
@@ -57,8 +58,12 @@ esp_err_t AudioResampler::start(AudioStreamInfo &input_stream_info, AudioStreamI
     return ESP_ERR_NOT_SUPPORTED;
   }
 
-  if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) ||
-      (input_stream_info.get_bits_per_sample() != output_stream_info.get_bits_per_sample())) {
+  if ((polyphase_filter != nullptr) && (polyphase_filter->source_sample_rate == input_stream_info.get_sample_rate()) &&
+      (polyphase_filter->target_sample_rate == output_stream_info.get_sample_rate()) &&
+      (input_stream_info.get_bits_per_sample() == 16) && (output_stream_info.get_bits_per_sample() == 16)) {
+    this->polyphase_resampler_ = make_unique<PolyphaseResampler>(polyphase_filter, input_stream_info.get_channels());
+  } else if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) ||
+             (input_stream_info.get_bits_per_sample() != output_stream_info.get_bits_per_sample())) {
     this->resampler_ = make_unique<esp_audio_libs::resampler::Resampler>(
         input_stream_info.bytes_to_samples(this->input_buffer_size_),
         output_stream_info.bytes_to_samples(this->output_buffer_size_));
@@ -118,20 +123,31 @@ AudioResamplerState AudioResampler::resample(bool stop_gracefully, int32_t *ms_d
 
   if ((this->input_stream_info_.get_sample_rate() != this->output_stream_info_.get_sample_rate()) ||
       (this->input_stream_info_.get_bits_per_sample() != this->output_stream_info_.get_bits_per_sample())) {
-    // Adjust gain by -3 dB to avoid clipping due to the resampling process
-    esp_audio_libs::resampler::ResamplerResults results =
-        this->resampler_->resample(this->input_transfer_buffer_->get_buffer_start(),
-                                   this->output_transfer_buffer_->get_buffer_end(), frames_available, frames_free, -3);
+    uint32_t frames_used;
+    uint32_t frames_generated;
+    if (this->polyphase_resampler_ != nullptr) {
+      // The -3 dB gain adjustment is part of the filter coefficients
+      frames_generated = this->polyphase_resampler_->resample(
+          reinterpret_cast<const int16_t *>(this->input_transfer_buffer_->get_buffer_start()),
+          reinterpret_cast<int16_t *>(this->output_transfer_buffer_->get_buffer_end()), frames_available, frames_free,
+          &frames_used);
+    } else {
+      // Adjust gain by -3 dB to avoid clipping due to the resampling process
+      esp_audio_libs::resampler::ResamplerResults results = this->resampler_->resample(
+          this->input_transfer_buffer_->get_buffer_start(), this->output_transfer_buffer_->get_buffer_end(),
+          frames_available, frames_free, -3);
+      frames_used = results.frames_used;
+      frames_generated = results.frames_generated;
+    }
 
-    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(results.frames_used));
-    this->output_transfer_buffer_->increase_buffer_length(
-        this->output_stream_info_.frames_to_bytes(results.frames_generated));
+    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(frames_used));
+    this->output_transfer_buffer_->increase_buffer_length(this->output_stream_info_.frames_to_bytes(frames_generated));
 
     // Resampling causes slight differences in the durations used versus generated. Computes the difference in
     // millisconds. The callback function passing the played audio duration uses the difference to convert from output
     // duration to input duration.
-    this->accumulated_frames_used_ += results.frames_used;
-    this->accumulated_frames_generated_ += results.frames_generated;
+    this->accumulated_frames_used_ += frames_used;
+    this->accumulated_frames_generated_ += frames_generated;
 
     const int32_t used_ms =
         this->input_stream_info_.frames_to_milliseconds_with_remainder(&this->accumulated_frames_used_);
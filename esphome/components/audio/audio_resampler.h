@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "audio.h"
+#include "audio_polyphase_resampler.h"
 #include "audio_transfer_buffer.h"
 
 #include "esphome/core/defines.h"
@@ -60,11 +61,13 @@ class AudioResampler {
   /// @param output_stream_info The desired outgoing sample rate, bits per sample, and number of channels
   /// @param number_of_taps Number of taps per FIR filter
   /// @param number_of_filters Number of FIR filters
+  /// @param polyphase_filter Optional fixed-point filter table. Used instead of the floating point resampler if it
+  ///                         converts between the stream sample rates and both streams have 16 bits per sample.
   /// @return ESP_OK if it is able to convert the incoming stream,
   ///         ESP_ERR_NO_MEM if the transfer buffers failed to allocate,
   ///         ESP_ERR_NOT_SUPPORTED if the stream can't be converted.
   esp_err_t start(AudioStreamInfo &input_stream_info, AudioStreamInfo &output_stream_info, uint16_t number_of_taps,
-                  uint16_t number_of_filters);
+                  uint16_t number_of_filters, const PolyphaseFilter *polyphase_filter = nullptr);
 
   /// @brief Resamples audio from the ring buffer source and writes to the sink.
   /// @param stop_gracefully If true, it indicates the file decoder is finished. The resampler will resample all the
@@ -94,6 +97,7 @@ class AudioResampler {
   AudioStreamInfo output_stream_info_;
 
   std::unique_ptr<esp_audio_libs::resampler::Resampler> resampler_;
+  std::unique_ptr<PolyphaseResampler> polyphase_resampler_;
 };
 
 }  // namespace audio
@@ -4,6 +4,8 @@
 
 #include "esphome/core/helpers.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace audio {
 
@@ -86,7 +88,7 @@ bool AudioTransferBuffer::reallocate(size_t new_buffer_size) {
 bool AudioTransferBuffer::allocate_buffer_(size_t buffer_size) {
   this->buffer_size_ = buffer_size;
 
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(RAMSubsystem::AUDIO);
 
   this->buffer_ = allocator.allocate(this->buffer_size_);
   if (this->buffer_ == nullptr) {
@@ -101,7 +103,7 @@ bool AudioTransferBuffer::allocate_buffer_(size_t buffer_size) {
 
 void AudioTransferBuffer::deallocate_buffer_() {
   if (this->buffer_ != nullptr) {
-    RAMAllocator<uint8_t> allocator;
+    RAMAllocator<uint8_t> allocator(RAMSubsystem::AUDIO);
     allocator.deallocate(this->buffer_, this->buffer_size_);
     this->buffer_ = nullptr;
     this->data_start_ = nullptr;
@@ -111,7 +113,77 @@ void AudioTransferBuffer::deallocate_buffer_() {
   this->buffer_length_ = 0;
 }
 
+AudioSourceTransferBuffer::~AudioSourceTransferBuffer() { this->release_borrowed_(); }
+
+size_t AudioSourceTransferBuffer::free() const {
+  if (this->borrowed_ != nullptr) {
+    // As if the borrowed data were at the start of the transfer buffer
+    return this->buffer_size_ - this->buffer_length_;
+  }
+  return AudioTransferBuffer::free();
+}
+
+void AudioSourceTransferBuffer::decrease_buffer_length(size_t bytes) {
+  if (this->borrowed_ == nullptr) {
+    AudioTransferBuffer::decrease_buffer_length(bytes);
+    return;
+  }
+  this->buffer_length_ -= bytes;
+  this->data_start_ += bytes;
+  if (this->buffer_length_ == 0) {
+    this->release_borrowed_();
+  }
+}
+
+void AudioSourceTransferBuffer::release_borrowed_() {
+  if (this->borrowed_ == nullptr) {
+    return;
+  }
+  if (this->buffer_length_ > 0) {
+    std::memcpy(this->buffer_, this->data_start_, this->buffer_length_);
+  }
+  this->ring_buffer_->read_release(this->borrowed_);
+  this->borrowed_ = nullptr;
+  this->data_start_ = this->buffer_;
+}
+
+void AudioSourceTransferBuffer::clear_buffered_data() {
+  this->buffer_length_ = 0;
+  this->release_borrowed_();
+  AudioTransferBuffer::clear_buffered_data();
+}
+
+void AudioSourceTransferBuffer::deallocate_buffer_() {
+  this->buffer_length_ = 0;
+  this->release_borrowed_();
+  AudioTransferBuffer::deallocate_buffer_();
+}
+
 size_t AudioSourceTransferBuffer::transfer_data_from_source(TickType_t ticks_to_wait, bool pre_shift) {
+  if (this->borrow_blocks_ && (this->buffer_length_ == 0) && (this->borrowed_ == nullptr) &&
+      (this->buffer_size_ > 0) && (this->ring_buffer_.use_count() > 0)) {
+    // Nothing buffered, use the next block of the ring buffer in place
+    size_t bytes_read = 0;
+    uint8_t *block = this->ring_buffer_->read_acquire(&bytes_read, this->buffer_size_, ticks_to_wait);
+    this->data_start_ = this->buffer_;
+    if (block == nullptr) {
+      return 0;
+    }
+    if (reinterpret_cast<uintptr_t>(block) % sizeof(uint32_t) != 0) {
+      // Consumers cast the data to samples, a misaligned block is copied like before
+      std::memcpy(this->buffer_, block, bytes_read);
+      this->ring_buffer_->read_release(block);
+    } else {
+      this->borrowed_ = block;
+      this->data_start_ = block;
+    }
+    this->buffer_length_ = bytes_read;
+    return bytes_read;
+  }
+
+  // More data is requested while some of the borrowed block is left, continue in the transfer buffer
+  this->release_borrowed_();
+
   if (pre_shift) {
     // Shift data in buffer to start
     if (this->buffer_length_ > 0) {
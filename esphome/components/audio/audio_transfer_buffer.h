@@ -34,7 +34,7 @@ class AudioTransferBuffer {
 
   /// @brief Updates the internal state of the transfer buffer. This should be called after reading data
   /// @param bytes The number of bytes consumed/read
-  void decrease_buffer_length(size_t bytes);
+  virtual void decrease_buffer_length(size_t bytes);
 
   /// @brief Updates the internal state of the transfer buffer. This should be called after writing data
   /// @param bytes The number of bytes written
@@ -47,7 +47,7 @@ class AudioTransferBuffer {
   size_t capacity() const { return this->buffer_size_; }
 
   /// @brief Returns the transfer buffer's currrently free bytes available to write
-  size_t free() const;
+  virtual size_t free() const;
 
   /// @brief Clears data in the transfer buffer and, if possible, the source/sink.
   virtual void clear_buffered_data();
@@ -65,7 +65,7 @@ class AudioTransferBuffer {
   bool allocate_buffer_(size_t buffer_size);
 
   /// @brief Deallocates the buffer and resets the class variables.
-  void deallocate_buffer_();
+  virtual void deallocate_buffer_();
 
   // A possible source or sink for the transfer buffer
   std::shared_ptr<RingBuffer> ring_buffer_;
@@ -119,8 +119,13 @@ class AudioSourceTransferBuffer : public AudioTransferBuffer {
   /*
    * @brief A class that implements a transfer buffer for audio sources.
    * Supports reading audio data from a ring buffer into the transfer buffer for processing.
+   *   - If enabled in set_source(), an empty transfer buffer borrows the next contiguous block of the ring buffer in
+   *     place instead of copying it. The block is handed back as soon as it is fully consumed. Data left over when
+   *     more is requested is copied into the transfer buffer first, so callers always see one contiguous region.
    */
  public:
+  ~AudioSourceTransferBuffer();
+
   /// @brief Creates a new source transfer buffer.
   /// @param buffer_size Size of the transfer buffer in bytes.
   /// @return unique_ptr if successfully allocated, nullptr otherwise
@@ -135,7 +140,28 @@ class AudioSourceTransferBuffer : public AudioTransferBuffer {
 
   /// @brief Adds a ring buffer as the transfer buffer's source.
   /// @param ring_buffer weak_ptr to the allocated ring buffer
-  void set_source(const std::weak_ptr<RingBuffer> &ring_buffer) { this->ring_buffer_ = ring_buffer.lock(); };
+  /// @param borrow_blocks Read blocks in place. Only for ring buffers written with write_without_replacement(): a
+  ///                      borrowed block holds its space until consumed, and write() cannot discard old data meanwhile.
+  void set_source(const std::weak_ptr<RingBuffer> &ring_buffer, bool borrow_blocks = false) {
+    this->ring_buffer_ = ring_buffer.lock();
+    this->borrow_blocks_ = borrow_blocks;
+  };
+
+  void decrease_buffer_length(size_t bytes) override;
+
+  size_t free() const override;
+
+  void clear_buffered_data() override;
+
+ protected:
+  void deallocate_buffer_() override;
+
+  /// @brief Hands the borrowed ring buffer block back, copying any unconsumed data into the transfer buffer first.
+  void release_borrowed_();
+
+  // Start of the ring buffer block currently borrowed, nullptr if the data is in the transfer buffer
+  uint8_t *borrowed_{nullptr};
+  bool borrow_blocks_{false};
 };
 
 }  // namespace audio
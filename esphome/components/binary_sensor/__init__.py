@@ -99,6 +99,9 @@ DEVICE_CLASSES = [
 
 IS_PLATFORM_COMPONENT = True
 
+DOMAIN = "binary_sensor"
+KEY_FILTER_TIMERS = "filter_timers"
+
 CONF_TIME_OFF = "time_off"
 CONF_TIME_ON = "time_on"
 CONF_TRIGGER_ON_INITIAL_STATE = "trigger_on_initial_state"
@@ -148,14 +151,15 @@ BinarySensorCondition = binary_sensor_ns.class_("BinarySensorCondition", Conditi
 
 # Filters
 Filter = binary_sensor_ns.class_("Filter")
-TimeoutFilter = binary_sensor_ns.class_("TimeoutFilter", Filter, cg.Component)
-DelayedOnOffFilter = binary_sensor_ns.class_("DelayedOnOffFilter", Filter, cg.Component)
-DelayedOnFilter = binary_sensor_ns.class_("DelayedOnFilter", Filter, cg.Component)
-DelayedOffFilter = binary_sensor_ns.class_("DelayedOffFilter", Filter, cg.Component)
+FilterTimers = binary_sensor_ns.class_("FilterTimers", cg.Component)
+TimeoutFilter = binary_sensor_ns.class_("TimeoutFilter", Filter)
+DelayedOnOffFilter = binary_sensor_ns.class_("DelayedOnOffFilter", Filter)
+DelayedOnFilter = binary_sensor_ns.class_("DelayedOnFilter", Filter)
+DelayedOffFilter = binary_sensor_ns.class_("DelayedOffFilter", Filter)
 InvertFilter = binary_sensor_ns.class_("InvertFilter", Filter)
-AutorepeatFilter = binary_sensor_ns.class_("AutorepeatFilter", Filter, cg.Component)
+AutorepeatFilter = binary_sensor_ns.class_("AutorepeatFilter", Filter)
 LambdaFilter = binary_sensor_ns.class_("LambdaFilter", Filter)
-SettleFilter = binary_sensor_ns.class_("SettleFilter", Filter, cg.Component)
+SettleFilter = binary_sensor_ns.class_("SettleFilter", Filter)
 
 _LOGGER = getLogger(__name__)
 
@@ -167,6 +171,17 @@ def register_filter(name, filter_type, schema):
     return FILTER_REGISTRY.register(name, filter_type, schema)
 
 
+async def _register_filter_timers():
+    """Creates the component running the timers of all filters, once per build."""
+    if CORE.data.setdefault(DOMAIN, {}).get(KEY_FILTER_TIMERS):
+        return
+    CORE.data[DOMAIN][KEY_FILTER_TIMERS] = True
+    var = cg.new_Pvariable(
+        core.ID("binary_sensor_filter_timers", is_declaration=True, type=FilterTimers)
+    )
+    await cg.register_component(var, {})
+
+
 @register_filter("invert", InvertFilter, {})
 async def invert_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id)
@@ -178,8 +193,8 @@ async def invert_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def timeout_filter_to_code(config, filter_id):
+    await _register_filter_timers()
     var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_timeout_value(template_))
     return var
@@ -206,8 +221,8 @@ async def timeout_filter_to_code(config, filter_id):
     ),
 )
 async def delayed_on_off_filter_to_code(config, filter_id):
+    await _register_filter_timers()
     var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
     if isinstance(config, dict):
         template_ = await cg.templatable(config[CONF_TIME_ON], [], cg.uint32)
         cg.add(var.set_on_delay(template_))
@@ -224,8 +239,8 @@ async def delayed_on_off_filter_to_code(config, filter_id):
     "delayed_on", DelayedOnFilter, cv.templatable(cv.positive_time_period_milliseconds)
 )
 async def delayed_on_filter_to_code(config, filter_id):
+    await _register_filter_timers()
     var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
@@ -237,8 +252,8 @@ async def delayed_on_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def delayed_off_filter_to_code(config, filter_id):
+    await _register_filter_timers()
     var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
@@ -278,9 +293,8 @@ async def autorepeat_filter_to_code(config, filter_id):
                 cv.time_period_str_unit(DEFAULT_TIME_ON).total_milliseconds,
             )
         )
-    var = cg.new_Pvariable(filter_id, timings)
-    await cg.register_component(var, {})
-    return var
+    await _register_filter_timers()
+    return cg.new_Pvariable(filter_id, timings)
 
 
 @register_filter("lambda", LambdaFilter, cv.returning_lambda)
@@ -297,8 +311,8 @@ async def lambda_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def settle_filter_to_code(config, filter_id):
+    await _register_filter_timers()
     var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
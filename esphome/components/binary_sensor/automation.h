@@ -142,6 +142,10 @@ template<typename... Ts> class BinarySensorCondition : public Condition<Ts...> {
  public:
   BinarySensorCondition(BinarySensor *parent, bool state) : parent_(parent), state_(state) {}
   bool check(Ts... x) override { return this->parent_->state == this->state_; }
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    this->parent_->add_on_state_callback([callback = std::move(callback)](bool /*state*/) { callback(); });
+    return true;
+  }
 
  protected:
   BinarySensor *parent_;
@@ -1,6 +1,7 @@
 #include "filter.h"
 
 #include "binary_sensor.h"
+#include "esphome/core/hal.h"
 #include <utility>
 
 namespace esphome {
@@ -9,6 +10,62 @@ namespace binary_sensor {
 
 static const char *const TAG = "sensor.filter";
 
+FilterTimers *global_filter_timers = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void FilterTimer::start(uint32_t delay) {
+  if (!this->running_)
+    global_filter_timers->add_(this);
+  this->start_ = millis();
+  this->delay_ = delay;
+  this->pass_ = global_filter_timers->pass_;
+}
+
+void FilterTimer::cancel() {
+  if (this->running_)
+    global_filter_timers->remove_(this);
+}
+
+FilterTimers::FilterTimers() { global_filter_timers = this; }
+
+void FilterTimers::add_(FilterTimer *timer) {
+  timer->next_ = this->head_;
+  timer->running_ = true;
+  this->head_ = timer;
+  this->enable_loop();
+}
+
+void FilterTimers::remove_(FilterTimer *timer) {
+  for (FilterTimer **link = &this->head_; *link != nullptr; link = &(*link)->next_) {
+    if (*link == timer) {
+      *link = timer->next_;
+      break;
+    }
+  }
+  timer->next_ = nullptr;
+  timer->running_ = false;
+}
+
+void FilterTimers::loop() {
+  const uint32_t now = millis();
+  const uint32_t pass = ++this->pass_;
+  FilterTimer **link = &this->head_;
+  while (*link != nullptr) {
+    FilterTimer *timer = *link;
+    if (timer->pass_ == pass || now - timer->start_ < timer->delay_) {
+      link = &timer->next_;
+      continue;
+    }
+    *link = timer->next_;
+    timer->next_ = nullptr;
+    timer->running_ = false;
+    timer->filter_->on_timeout_(timer->id_);
+    // The filter may have started or cancelled any timer, walk the list again
+    link = &this->head_;
+  }
+  if (this->head_ == nullptr)
+    this->disable_loop();
+}
+
 void Filter::output(bool value) {
   if (this->next_ == nullptr) {
     this->parent_->send_state_internal(value);
@@ -26,46 +83,39 @@ void Filter::input(bool value) {
 }
 
 void TimeoutFilter::input(bool value) {
-  this->set_timeout("timeout", this->timeout_delay_.value(), [this]() { this->parent_->invalidate_state(); });
+  this->timer_.start(this->timeout_delay_.value());
   // we do not de-dup here otherwise changes from invalid to valid state will not be output
   this->output(value);
 }
 
+void TimeoutFilter::on_timeout_(uint8_t id) { this->parent_->invalidate_state(); }
+
 optional<bool> DelayedOnOffFilter::new_value(bool value) {
-  if (value) {
-    this->set_timeout("ON_OFF", this->on_delay_.value(), [this]() { this->output(true); });
-  } else {
-    this->set_timeout("ON_OFF", this->off_delay_.value(), [this]() { this->output(false); });
-  }
+  this->pending_value_ = value;
+  this->timer_.start(value ? this->on_delay_.value() : this->off_delay_.value());
   return {};
 }
 
-float DelayedOnOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
-
 optional<bool> DelayedOnFilter::new_value(bool value) {
   if (value) {
-    this->set_timeout("ON", this->delay_.value(), [this]() { this->output(true); });
+    this->timer_.start(this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("ON");
+    this->timer_.cancel();
     return false;
   }
 }
 
-float DelayedOnFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
-
 optional<bool> DelayedOffFilter::new_value(bool value) {
   if (!value) {
-    this->set_timeout("OFF", this->delay_.value(), [this]() { this->output(false); });
+    this->timer_.start(this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("OFF");
+    this->timer_.cancel();
     return true;
   }
 }
 
-float DelayedOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
-
 optional<bool> InvertFilter::new_value(bool value) { return !value; }
 
 AutorepeatFilter::AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings) : timings_(std::move(timings)) {}
@@ -79,20 +129,28 @@ optional<bool> AutorepeatFilter::new_value(bool value) {
     this->next_timing_();
     return true;
   } else {
-    this->cancel_timeout("TIMING");
-    this->cancel_timeout("ON_OFF");
+    this->timing_timer_.cancel();
+    this->on_off_timer_.cancel();
     this->active_timing_ = 0;
     return false;
   }
 }
 
+void AutorepeatFilter::on_timeout_(uint8_t id) {
+  if (id == TIMER_TIMING) {
+    this->next_timing_();
+  } else {
+    this->next_value_(this->pending_value_);
+  }
+}
+
 void AutorepeatFilter::next_timing_() {
   // Entering this method
   // 1st time: starts waiting the first delay
   // 2nd time: starts waiting the second delay and starts toggling with the first time_off / _on
   // last time: no delay to start but have to bump the index to reflect the last
   if (this->active_timing_ < this->timings_.size())
-    this->set_timeout("TIMING", this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
+    this->timing_timer_.start(this->timings_[this->active_timing_].delay);
 
   if (this->active_timing_ <= this->timings_.size()) {
     this->active_timing_++;
@@ -107,31 +165,33 @@ void AutorepeatFilter::next_timing_() {
 void AutorepeatFilter::next_value_(bool val) {
   const AutorepeatFilterTiming &timing = this->timings_[this->active_timing_ - 2];
   this->output(val);  // This is at least the second one so not initial
-  this->set_timeout("ON_OFF", val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
+  this->pending_value_ = !val;
+  this->on_off_timer_.start(val ? timing.time_on : timing.time_off);
 }
 
-float AutorepeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
-
 LambdaFilter::LambdaFilter(std::function<optional<bool>(bool)> f) : f_(std::move(f)) {}
 
 optional<bool> LambdaFilter::new_value(bool value) { return this->f_(value); }
 
 optional<bool> SettleFilter::new_value(bool value) {
   if (!this->steady_) {
-    this->set_timeout("SETTLE", this->delay_.value(), [this, value]() {
-      this->steady_ = true;
-      this->output(value);
-    });
+    this->settled_value_ = value;
+    this->timer_.start(this->delay_.value());
     return {};
   } else {
     this->steady_ = false;
     this->output(value);
-    this->set_timeout("SETTLE", this->delay_.value(), [this]() { this->steady_ = true; });
+    this->settled_value_.reset();
+    this->timer_.start(this->delay_.value());
     return value;
   }
 }
 
-float SettleFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void SettleFilter::on_timeout_(uint8_t id) {
+  this->steady_ = true;
+  if (this->settled_value_.has_value())
+    this->output(*this->settled_value_);
+}
 
 }  // namespace binary_sensor
 
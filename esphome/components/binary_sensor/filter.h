@@ -11,6 +11,56 @@ namespace esphome {
 namespace binary_sensor {
 
 class BinarySensor;
+class Filter;
+class FilterTimers;
+
+/** One shot timer of a filter.
+ *
+ * Timed filters used to be components each, with a named scheduler item per edge. Their timers are now plain members
+ * run by the single FilterTimers component, so a debounced input costs neither a component nor an allocation.
+ */
+class FilterTimer {
+ public:
+  explicit FilterTimer(Filter *filter, uint8_t id = 0) : filter_(filter), id_(id) {}
+
+  /// Starts the timer, a pending timeout is replaced like with a named set_timeout().
+  void start(uint32_t delay);
+  void cancel();
+  bool is_running() const { return this->running_; }
+
+ protected:
+  friend FilterTimers;
+
+  FilterTimer *next_{nullptr};
+  Filter *filter_;
+  uint32_t start_{0};
+  uint32_t delay_{0};
+  uint32_t pass_{0};
+  uint8_t id_;
+  bool running_{false};
+};
+
+/// Runs the timers of all binary sensor filters, the loop is disabled while none is running.
+class FilterTimers : public Component {
+ public:
+  FilterTimers();
+
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+ protected:
+  friend FilterTimer;
+
+  void add_(FilterTimer *timer);
+  void remove_(FilterTimer *timer);
+
+  // Running timers, linked through the timers themselves
+  FilterTimer *head_{nullptr};
+  // Timers started during a pass wait for the next one, like scheduler timeouts set from a callback
+  uint32_t pass_{0};
+};
+
+extern FilterTimers *global_filter_timers;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 class Filter {
  public:
@@ -22,58 +72,69 @@ class Filter {
 
  protected:
   friend BinarySensor;
+  friend FilterTimers;
+
+  /// Called when the timer with the given id expires.
+  virtual void on_timeout_(uint8_t id) {}
 
   Filter *next_{nullptr};
   BinarySensor *parent_{nullptr};
   Deduplicator<bool> dedup_;
 };
 
-class TimeoutFilter : public Filter, public Component {
+class TimeoutFilter : public Filter {
  public:
   optional<bool> new_value(bool value) override { return value; }
   void input(bool value) override;
   template<typename T> void set_timeout_value(T timeout) { this->timeout_delay_ = timeout; }
 
  protected:
+  void on_timeout_(uint8_t id) override;
+
   TemplatableValue<uint32_t> timeout_delay_{};
+  FilterTimer timer_{this};
 };
 
-class DelayedOnOffFilter : public Filter, public Component {
+class DelayedOnOffFilter : public Filter {
  public:
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_on_delay(T delay) { this->on_delay_ = delay; }
   template<typename T> void set_off_delay(T delay) { this->off_delay_ = delay; }
 
  protected:
+  void on_timeout_(uint8_t id) override { this->output(this->pending_value_); }
+
   TemplatableValue<uint32_t> on_delay_{};
   TemplatableValue<uint32_t> off_delay_{};
+  FilterTimer timer_{this};
+  bool pending_value_{false};
 };
 
-class DelayedOnFilter : public Filter, public Component {
+class DelayedOnFilter : public Filter {
  public:
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timeout_(uint8_t id) override { this->output(true); }
+
   TemplatableValue<uint32_t> delay_{};
+  FilterTimer timer_{this};
 };
 
-class DelayedOffFilter : public Filter, public Component {
+class DelayedOffFilter : public Filter {
  public:
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timeout_(uint8_t id) override { this->output(false); }
+
   TemplatableValue<uint32_t> delay_{};
+  FilterTimer timer_{this};
 };
 
 class InvertFilter : public Filter {
@@ -92,20 +153,24 @@ struct AutorepeatFilterTiming {
   uint32_t time_on;
 };
 
-class AutorepeatFilter : public Filter, public Component {
+class AutorepeatFilter : public Filter {
  public:
   explicit AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings);
 
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
  protected:
+  enum TimerId : uint8_t { TIMER_TIMING = 0, TIMER_ON_OFF };
+
+  void on_timeout_(uint8_t id) override;
   void next_timing_();
   void next_value_(bool val);
 
   std::vector<AutorepeatFilterTiming> timings_;
+  FilterTimer timing_timer_{this, TIMER_TIMING};
+  FilterTimer on_off_timer_{this, TIMER_ON_OFF};
   uint8_t active_timing_{0};
+  bool pending_value_{false};
 };
 
 class LambdaFilter : public Filter {
@@ -118,16 +183,19 @@ class LambdaFilter : public Filter {
   std::function<optional<bool>(bool)> f_;
 };
 
-class SettleFilter : public Filter, public Component {
+class SettleFilter : public Filter {
  public:
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timeout_(uint8_t id) override;
+
   TemplatableValue<uint32_t> delay_{};
+  FilterTimer timer_{this};
+  // Value to output once the input settled, none when it did not change while unsteady
+  optional<bool> settled_value_{};
   bool steady_{true};
 };
 
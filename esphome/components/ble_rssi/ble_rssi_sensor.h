@@ -65,20 +65,19 @@ class BLERSSISensor : public sensor::Sensor, public esp32_ble_tracker::ESPBTDevi
         }
         break;
       case MATCH_BY_SERVICE_UUID:
-        for (auto uuid : device.get_service_uuids()) {
-          if (this->uuid_ == uuid) {
-            this->publish_state(device.get_rssi());
-            this->found_ = true;
-            return true;
-          }
+        if (device.has_service_uuid(this->uuid_)) {
+          this->publish_state(device.get_rssi());
+          this->found_ = true;
+          return true;
         }
         break;
       case MATCH_BY_IBEACON_UUID:
-        if (!device.get_ibeacon().has_value()) {
+        auto found_ibeacon = device.get_ibeacon();
+        if (!found_ibeacon.has_value()) {
           return false;
         }
 
-        auto ibeacon = device.get_ibeacon().value();
+        auto ibeacon = found_ibeacon.value();
 
         if (this->ibeacon_uuid_ != ibeacon.get_uuid()) {
           return false;
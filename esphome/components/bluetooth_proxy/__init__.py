@@ -16,7 +16,11 @@ _LOGGER = logging.getLogger(__name__)
 CONF_CONNECTION_SLOTS = "connection_slots"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_ADVERTISEMENT_DEDUP_TTL = "advertisement_dedup_ttl"
+CONF_ADVERTISEMENT_MIN_INTERVAL = "advertisement_min_interval"
 DEFAULT_CONNECTION_SLOTS = 3
+# Devices tracked by the advertisement filter, the least recently forwarded is replaced
+ADVERTISEMENT_CACHE_SIZE = 64
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
 
@@ -69,6 +73,12 @@ CONFIG_SCHEMA = cv.All(
                     cv.ensure_list(CONNECTION_SCHEMA),
                     cv.Length(min=1, max=esp32_ble.IDF_MAX_CONNECTIONS),
                 ),
+                cv.Optional(
+                    CONF_ADVERTISEMENT_DEDUP_TTL, default="0s"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(
+                    CONF_ADVERTISEMENT_MIN_INTERVAL, default="0s"
+                ): cv.positive_time_period_milliseconds,
             }
         )
         .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -98,6 +108,17 @@ async def to_code(config):
     # This achieves ~97% WiFi MTU utilization while staying under the limit
     cg.add_define("BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE", 16)
 
+    # Only pay for the filter cache when duplicate suppression or rate limiting is on
+    dedup_ttl = config[CONF_ADVERTISEMENT_DEDUP_TTL].total_milliseconds
+    min_interval = config[CONF_ADVERTISEMENT_MIN_INTERVAL].total_milliseconds
+    if dedup_ttl or min_interval:
+        cg.add_define("USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER")
+        cg.add_define(
+            "BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE", ADVERTISEMENT_CACHE_SIZE
+        )
+        cg.add(var.set_advertisement_dedup_ttl(dedup_ttl))
+        cg.add(var.set_advertisement_min_interval(min_interval))
+
     for connection_conf in config.get(CONF_CONNECTIONS, []):
         connection_var = cg.new_Pvariable(connection_conf[CONF_ID])
         await cg.register_component(connection_var, connection_conf)
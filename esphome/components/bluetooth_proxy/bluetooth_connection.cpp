@@ -4,6 +4,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #ifdef USE_ESP32
 
 #include "bluetooth_proxy.h"
@@ -12,6 +14,14 @@ namespace esphome::bluetooth_proxy {
 
 static const char *const TAG = "bluetooth_proxy.connection";
 
+// Reads and writes, or write chunks, a connection holds before the API gets errors
+static const size_t GATT_OPERATION_QUEUE_SIZE = 32;
+// Writes without response in flight in the stack, it buffers a few per connection
+static const uint8_t MAX_UNACKED_WRITES = 4;
+// A request not answered within the ATT transaction timeout is given up, so the queue moves on
+static const uint32_t GATT_REQUEST_TIMEOUT_MS = 30000;
+static const char *const GATT_REQUEST_TIMEOUT = "gatt_request";
+
 // This function is allocation-free and directly packs UUIDs into the output array
 // using precalculated constants for the Bluetooth base UUID
 static void fill_128bit_uuid_array(std::array<uint64_t, 2> &out, esp_bt_uuid_t uuid_source) {
@@ -153,6 +163,7 @@ void BluetoothConnection::reset_connection_(esp_err_t reason) {
   // tell them about a partial list.
   this->set_address(0);
   this->send_service_ = INIT_SENDING_SERVICES;
+  this->clear_operations_();
   this->proxy_->send_connections_free();
 }
 
@@ -376,6 +387,7 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
                param->disconnect.reason);
       // Send disconnection notification but don't free the slot yet
       this->proxy_->send_device_connection(this->address_, false, 0, param->disconnect.reason);
+      this->clear_operations_();
       break;
     }
     case ESP_GATTC_CLOSE_EVT: {
@@ -411,29 +423,45 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
     }
     case ESP_GATTC_READ_DESCR_EVT:
     case ESP_GATTC_READ_CHAR_EVT: {
+      if (param->read.handle == this->pending_handle_) {
+        this->request_pending_ = false;
+        this->cancel_timeout(GATT_REQUEST_TIMEOUT);
+      }
       if (param->read.status != ESP_GATT_OK) {
         this->log_gatt_operation_error_("reading char/descriptor", param->read.handle, param->read.status);
         this->proxy_->send_gatt_error(this->address_, param->read.handle, param->read.status);
-        break;
+      } else {
+        api::BluetoothGATTReadResponse resp;
+        resp.address = this->address_;
+        resp.handle = param->read.handle;
+        resp.set_data(param->read.value, param->read.value_len);
+        this->proxy_->get_api_connection()->send_message(resp, api::BluetoothGATTReadResponse::MESSAGE_TYPE);
       }
-      api::BluetoothGATTReadResponse resp;
-      resp.address = this->address_;
-      resp.handle = param->read.handle;
-      resp.set_data(param->read.value, param->read.value_len);
-      this->proxy_->get_api_connection()->send_message(resp, api::BluetoothGATTReadResponse::MESSAGE_TYPE);
+      this->process_operations_();
       break;
     }
     case ESP_GATTC_WRITE_CHAR_EVT:
     case ESP_GATTC_WRITE_DESCR_EVT: {
-      if (param->write.status != ESP_GATT_OK) {
-        this->log_gatt_operation_error_("writing char/descriptor", param->write.handle, param->write.status);
-        this->proxy_->send_gatt_error(this->address_, param->write.handle, param->write.status);
-        break;
+      // Requests are only issued once all writes without response were reported. Legacy connections also see
+      // the notify descriptor writes of BLEClientBase, which don't match the pending handle.
+      bool last = true;
+      if (this->unacked_writes_ > 0) {
+        this->unacked_writes_--;
+        last = this->unacked_last_mask_ & 1;
+        this->unacked_last_mask_ >>= 1;
+      } else if (param->write.handle == this->pending_handle_) {
+        this->request_pending_ = false;
+        this->cancel_timeout(GATT_REQUEST_TIMEOUT);
       }
-      api::BluetoothGATTWriteResponse resp;
-      resp.address = this->address_;
-      resp.handle = param->write.handle;
-      this->proxy_->get_api_connection()->send_message(resp, api::BluetoothGATTWriteResponse::MESSAGE_TYPE);
+      if (param->write.status != ESP_GATT_OK)
+        this->log_gatt_operation_error_("writing char/descriptor", param->write.handle, param->write.status);
+      this->report_write_(param->write.handle, last, param->write.status);
+      this->process_operations_();
+      break;
+    }
+    case ESP_GATTC_CONGEST_EVT: {
+      this->congested_ = param->congest.congested;
+      this->process_operations_();
       break;
     }
     case ESP_GATTC_UNREG_FOR_NOTIFY_EVT: {
@@ -504,9 +532,7 @@ esp_err_t BluetoothConnection::read_characteristic(uint16_t handle) {
 
   ESP_LOGV(TAG, "[%d] [%s] Reading GATT characteristic handle %d", this->connection_index_, this->address_str_.c_str(),
            handle);
-
-  esp_err_t err = esp_ble_gattc_read_char(this->gattc_if_, this->conn_id_, handle, ESP_GATT_AUTH_REQ_NONE);
-  return this->check_and_log_error_("esp_ble_gattc_read_char", err);
+  return this->queue_operation_(GattOperation::READ_CHARACTERISTIC, handle, nullptr, 0, true);
 }
 
 esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const uint8_t *data, size_t length,
@@ -517,14 +543,7 @@ esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const uint8
   }
   ESP_LOGV(TAG, "[%d] [%s] Writing GATT characteristic handle %d", this->connection_index_, this->address_str_.c_str(),
            handle);
-
-  // ESP-IDF's API requires a non-const uint8_t* but it doesn't modify the data
-  // The BTC layer immediately copies the data to its own buffer (see btc_gattc.c)
-  // const_cast is safe here and was previously hidden by a C-style cast
-  esp_err_t err =
-      esp_ble_gattc_write_char(this->gattc_if_, this->conn_id_, handle, length, const_cast<uint8_t *>(data),
-                               response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
-  return this->check_and_log_error_("esp_ble_gattc_write_char", err);
+  return this->queue_operation_(GattOperation::WRITE_CHARACTERISTIC, handle, data, length, response);
 }
 
 esp_err_t BluetoothConnection::read_descriptor(uint16_t handle) {
@@ -534,9 +553,7 @@ esp_err_t BluetoothConnection::read_descriptor(uint16_t handle) {
   }
   ESP_LOGV(TAG, "[%d] [%s] Reading GATT descriptor handle %d", this->connection_index_, this->address_str_.c_str(),
            handle);
-
-  esp_err_t err = esp_ble_gattc_read_char_descr(this->gattc_if_, this->conn_id_, handle, ESP_GATT_AUTH_REQ_NONE);
-  return this->check_and_log_error_("esp_ble_gattc_read_char_descr", err);
+  return this->queue_operation_(GattOperation::READ_DESCRIPTOR, handle, nullptr, 0, true);
 }
 
 esp_err_t BluetoothConnection::write_descriptor(uint16_t handle, const uint8_t *data, size_t length, bool response) {
@@ -546,14 +563,112 @@ esp_err_t BluetoothConnection::write_descriptor(uint16_t handle, const uint8_t *
   }
   ESP_LOGV(TAG, "[%d] [%s] Writing GATT descriptor handle %d", this->connection_index_, this->address_str_.c_str(),
            handle);
+  return this->queue_operation_(GattOperation::WRITE_DESCRIPTOR, handle, data, length, response);
+}
+
+esp_err_t BluetoothConnection::queue_operation_(GattOperation::Type type, uint16_t handle, const uint8_t *data,
+                                                size_t length, bool response) {
+  // A write without response has to fit in a single ATT packet, split larger ones at the MTU
+  const bool is_write = type == GattOperation::WRITE_CHARACTERISTIC || type == GattOperation::WRITE_DESCRIPTOR;
+  const size_t chunk_size = is_write && !response ? this->mtu_ - 3 : std::max<size_t>(length, 1);
+  const size_t chunks = std::max<size_t>((length + chunk_size - 1) / chunk_size, 1);
+  if (this->operations_.size() + chunks > GATT_OPERATION_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "[%d] [%s] GATT operation queue full, dropping handle %d", this->connection_index_,
+             this->address_str_.c_str(), handle);
+    return ESP_ERR_NO_MEM;
+  }
+  for (size_t offset = 0, i = 0; i < chunks; i++, offset += chunk_size) {
+    const size_t size = std::min(chunk_size, length - offset);
+    this->operations_.push_back(
+        {type, response, i + 1 == chunks, handle, std::vector<uint8_t>(data + offset, data + offset + size)});
+  }
+  this->process_operations_();
+  return ESP_OK;
+}
+
+void BluetoothConnection::process_operations_() {
+  // The stack only takes one request per connection, writes without response are pipelined up to
+  // MAX_UNACKED_WRITES while the link isn't congested. A request waits until they are all reported back,
+  // so every write event can be matched to what is outstanding.
+  while (!this->operations_.empty() && !this->request_pending_) {
+    const auto &op = this->operations_.front();
+    const bool is_write = op.type == GattOperation::WRITE_CHARACTERISTIC || op.type == GattOperation::WRITE_DESCRIPTOR;
+    const bool is_command = is_write && !op.response;
+    if (is_command ? this->congested_ || this->unacked_writes_ >= MAX_UNACKED_WRITES : this->unacked_writes_ != 0)
+      return;
+    esp_err_t err = this->issue_operation_(op);
+    if (err != ESP_OK && is_write) {
+      this->report_write_(op.handle, op.last, err);
+    } else if (err != ESP_OK) {
+      this->proxy_->send_gatt_error(this->address_, op.handle, err);
+    } else if (is_command) {
+      if (op.last)
+        this->unacked_last_mask_ |= 1 << this->unacked_writes_;
+      this->unacked_writes_++;
+    } else {
+      this->request_pending_ = true;
+      this->pending_handle_ = op.handle;
+      this->set_timeout(GATT_REQUEST_TIMEOUT, GATT_REQUEST_TIMEOUT_MS, [this]() { this->request_timed_out_(); });
+    }
+    this->operations_.pop_front();
+  }
+}
 
+esp_err_t BluetoothConnection::issue_operation_(const GattOperation &op) {
   // ESP-IDF's API requires a non-const uint8_t* but it doesn't modify the data
   // The BTC layer immediately copies the data to its own buffer (see btc_gattc.c)
-  // const_cast is safe here and was previously hidden by a C-style cast
-  esp_err_t err = esp_ble_gattc_write_char_descr(
-      this->gattc_if_, this->conn_id_, handle, length, const_cast<uint8_t *>(data),
-      response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
-  return this->check_and_log_error_("esp_ble_gattc_write_char_descr", err);
+  auto *data = const_cast<uint8_t *>(op.data.data());
+  const esp_gatt_write_type_t write_type = op.response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP;
+  esp_err_t err;
+  switch (op.type) {
+    case GattOperation::READ_CHARACTERISTIC:
+      err = esp_ble_gattc_read_char(this->gattc_if_, this->conn_id_, op.handle, ESP_GATT_AUTH_REQ_NONE);
+      return this->check_and_log_error_("esp_ble_gattc_read_char", err);
+    case GattOperation::WRITE_CHARACTERISTIC:
+      err = esp_ble_gattc_write_char(this->gattc_if_, this->conn_id_, op.handle, op.data.size(), data, write_type,
+                                     ESP_GATT_AUTH_REQ_NONE);
+      return this->check_and_log_error_("esp_ble_gattc_write_char", err);
+    case GattOperation::READ_DESCRIPTOR:
+      err = esp_ble_gattc_read_char_descr(this->gattc_if_, this->conn_id_, op.handle, ESP_GATT_AUTH_REQ_NONE);
+      return this->check_and_log_error_("esp_ble_gattc_read_char_descr", err);
+    case GattOperation::WRITE_DESCRIPTOR:
+    default:
+      err = esp_ble_gattc_write_char_descr(this->gattc_if_, this->conn_id_, op.handle, op.data.size(), data,
+                                           write_type, ESP_GATT_AUTH_REQ_NONE);
+      return this->check_and_log_error_("esp_ble_gattc_write_char_descr", err);
+  }
+}
+
+void BluetoothConnection::clear_operations_() {
+  this->operations_.clear();
+  this->unacked_writes_ = 0;
+  this->unacked_last_mask_ = 0;
+  this->chunk_failed_ = false;
+  this->request_pending_ = false;
+  this->congested_ = false;
+  this->cancel_timeout(GATT_REQUEST_TIMEOUT);
+}
+
+void BluetoothConnection::report_write_(uint16_t handle, bool last, esp_err_t err) {
+  // A write split into chunks gets a single reply: the first error, or the response once the last chunk is out
+  if (err != ESP_OK && !this->chunk_failed_) {
+    this->proxy_->send_gatt_error(this->address_, handle, err);
+  } else if (err == ESP_OK && last && !this->chunk_failed_) {
+    api::BluetoothGATTWriteResponse resp;
+    resp.address = this->address_;
+    resp.handle = handle;
+    this->proxy_->get_api_connection()->send_message(resp, api::BluetoothGATTWriteResponse::MESSAGE_TYPE);
+  }
+  this->chunk_failed_ = (this->chunk_failed_ || err != ESP_OK) && !last;
+}
+
+void BluetoothConnection::request_timed_out_() {
+  // The reply never came or named another handle; without this the queue would wait for it forever
+  ESP_LOGW(TAG, "[%d] [%s] No reply for handle 0x%2X, giving up", this->connection_index_, this->address_str_.c_str(),
+           this->pending_handle_);
+  this->request_pending_ = false;
+  this->proxy_->send_gatt_error(this->address_, this->pending_handle_, ESP_ERR_TIMEOUT);
+  this->process_operations_();
 }
 
 esp_err_t BluetoothConnection::notify_characteristic(uint16_t handle, bool enable) {
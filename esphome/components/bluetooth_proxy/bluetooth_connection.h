@@ -4,6 +4,9 @@
 
 #include "esphome/components/esp32_ble_client/ble_client_base.h"
 
+#include <deque>
+#include <vector>
+
 namespace esphome::bluetooth_proxy {
 
 class BluetoothProxy;
@@ -29,6 +32,27 @@ class BluetoothConnection final : public esp32_ble_client::BLEClientBase {
  protected:
   friend class BluetoothProxy;
 
+  // A GATT read or write waiting for its turn on the connection
+  struct GattOperation {
+    enum Type : uint8_t { READ_CHARACTERISTIC, WRITE_CHARACTERISTIC, READ_DESCRIPTOR, WRITE_DESCRIPTOR };
+    Type type;
+    bool response;
+    // Whole operation, or the final chunk of a split write; only that one answers the API request
+    bool last;
+    uint16_t handle;
+    std::vector<uint8_t> data;
+  };
+
+  esp_err_t queue_operation_(GattOperation::Type type, uint16_t handle, const uint8_t *data, size_t length,
+                             bool response);
+  /// Issue queued operations as far as the pending request, unacknowledged writes and congestion allow.
+  void process_operations_();
+  esp_err_t issue_operation_(const GattOperation &op);
+  void clear_operations_();
+  void request_timed_out_();
+  /// Answer the API for a written operation or chunk.
+  void report_write_(uint16_t handle, bool last, esp_err_t err);
+
   bool supports_efficient_uuids_() const;
   void send_service_for_discovery_();
   void reset_connection_(esp_err_t reason);
@@ -43,12 +67,25 @@ class BluetoothConnection final : public esp32_ble_client::BLEClientBase {
   // Group 1: Pointers (4 bytes each, naturally aligned)
   BluetoothProxy *proxy_;
 
+  // Operations not handed to the stack yet, in the order the API sent them
+  std::deque<GattOperation> operations_;
+
   // Group 2: 2-byte types
   int16_t send_service_{-3};  // -3 = INIT_SENDING_SERVICES, -2 = DONE_SENDING_SERVICES, >=0 = service index
+  // Handle of the request waiting for its reply
+  uint16_t pending_handle_{0};
 
   // Group 3: 1-byte types
   bool seen_mtu_or_services_{false};
-  // 1 byte used, 1 byte padding
+  // Writes without response handed to the stack and not reported back yet
+  uint8_t unacked_writes_{0};
+  // One bit per unacknowledged write, oldest first: set if it is the last chunk of its write
+  uint8_t unacked_last_mask_{0};
+  // A chunk of the split write being reported failed, its remaining chunks stay quiet
+  bool chunk_failed_{false};
+  // A read or a write with response is waiting for its reply
+  bool request_pending_{false};
+  bool congested_{false};
 };
 
 }  // namespace esphome::bluetooth_proxy
@@ -3,6 +3,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 #include "esphome/core/application.h"
+#include <cinttypes>
 #include <cstring>
 
 #ifdef USE_ESP32
@@ -78,9 +79,18 @@ bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *scan_results,
     return false;
 
   auto &advertisements = this->response_.advertisements;
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  const uint32_t now = App.get_loop_component_start_time();
+#endif
 
   for (size_t i = 0; i < count; i++) {
     auto &result = scan_results[i];
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+    if (!this->should_forward_(result, now)) {
+      this->advertisements_dropped_++;
+      continue;
+    }
+#endif
     uint8_t length = result.adv_data_len + result.scan_rsp_len;
 
     // Fill in the data directly at current position
@@ -105,15 +115,71 @@ bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *scan_results,
   return true;
 }
 
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+// Slots probed for a key before the oldest of them is replaced
+static const size_t ADVERTISEMENT_CACHE_PROBES = 4;
+static const uint64_t ADVERTISEMENT_CACHE_SCAN_RESPONSE = 1ULL << 48;
+
+bool BluetoothProxy::should_forward_(const esp32_ble::BLEScanResult &result, uint32_t now) {
+  // Advertisements and scan responses of a device alternate, track them separately
+  uint64_t key = esp32_ble::ble_addr_to_uint64(result.bda);
+  if (result.scan_rsp_len != 0)
+    key |= ADVERTISEMENT_CACHE_SCAN_RESPONSE;
+  // FNV-1a over the payload
+  uint32_t hash = 2166136261UL;
+  const uint8_t length = result.adv_data_len + result.scan_rsp_len;
+  for (uint8_t i = 0; i < length; i++) {
+    hash ^= result.ble_adv[i];
+    hash *= 16777619UL;
+  }
+
+  auto &cache = this->advertisement_cache_;
+  // Fibonacci hashing, addresses of one vendor only differ in the low bytes
+  size_t slot = ((key * 0x9E3779B97F4A7C15ULL) >> 32) % cache.size();
+  AdvertisementCacheEntry *oldest = nullptr;
+  for (size_t probe = 0; probe < ADVERTISEMENT_CACHE_PROBES; probe++, slot = (slot + 1) % cache.size()) {
+    auto &entry = cache[slot];
+    if (entry.key == key) {
+      const uint32_t elapsed = now - entry.last_sent;
+      if (elapsed < this->advertisement_min_interval_)
+        return false;
+      if (entry.hash == hash && elapsed < this->advertisement_dedup_ttl_)
+        return false;
+      entry.hash = hash;
+      entry.last_sent = now;
+      return true;
+    }
+    // Slots are never freed, the key can't be further along
+    if (entry.key == 0) {
+      entry = {key, hash, now};
+      return true;
+    }
+    if (oldest == nullptr || now - entry.last_sent > now - oldest->last_sent)
+      oldest = &entry;
+  }
+  *oldest = {key, hash, now};
+  return true;
+}
+#endif
+
 void BluetoothProxy::flush_pending_advertisements() {
   if (this->response_.advertisements_len == 0 || !api::global_api_server->is_connected() ||
       this->api_connection_ == nullptr)
     return;
 
   // Send the message
-  this->api_connection_->send_message(this->response_, api::BluetoothLERawAdvertisementsResponse::MESSAGE_TYPE);
+  if (!this->api_connection_->send_message(this->response_, api::BluetoothLERawAdvertisementsResponse::MESSAGE_TYPE)) {
+    // The network can't keep up, leave it more airtime
+    this->parent_->report_radio_demand();
+  }
 
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  ESP_LOGV(TAG, "Sent batch of %u BLE advertisements, %" PRIu32 " filtered",
+           this->response_.advertisements_len, this->advertisements_dropped_);
+  this->advertisements_dropped_ = 0;
+#else
   ESP_LOGV(TAG, "Sent batch of %u BLE advertisements", this->response_.advertisements_len);
+#endif
 
   // Reset the length for the next batch
   this->response_.advertisements_len = 0;
@@ -125,6 +191,12 @@ void BluetoothProxy::dump_config() {
                 "  Active: %s\n"
                 "  Connections: %d",
                 YESNO(this->active_), this->connection_count_);
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  ESP_LOGCONFIG(TAG,
+                "  Advertisement dedup TTL: %" PRIu32 " ms\n"
+                "  Advertisement min interval: %" PRIu32 " ms",
+                this->advertisement_dedup_ttl_, this->advertisement_min_interval_);
+#endif
 }
 
 void BluetoothProxy::loop() {
@@ -371,6 +443,10 @@ void BluetoothProxy::subscribe_api_connection(api::APIConnection *api_connection
     return;
   }
   this->api_connection_ = api_connection;
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  // A new subscriber has not seen anything yet
+  this->advertisement_cache_ = {};
+#endif
   this->parent_->recalculate_advertisement_parser_types();
 
   this->send_bluetooth_scanner_state_(this->parent_->get_scanner_state());
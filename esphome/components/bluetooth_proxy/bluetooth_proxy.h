@@ -106,6 +106,12 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
   }
 
   void set_active(bool active) { this->active_ = active; }
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  /// Drop an advertisement identical to the last one forwarded for the address within this time, 0 to disable.
+  void set_advertisement_dedup_ttl(uint32_t ttl) { this->advertisement_dedup_ttl_ = ttl; }
+  /// Forward at most one advertisement (and one scan response) per address within this time, 0 to disable.
+  void set_advertisement_min_interval(uint32_t interval) { this->advertisement_min_interval_ = interval; }
+#endif
   bool has_active() { return this->active_; }
 
   uint32_t get_legacy_version() const {
@@ -145,6 +151,10 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
   void log_connection_info_(BluetoothConnection *connection, const char *message);
   void log_not_connected_gatt_(const char *action, const char *type);
   void handle_gatt_not_connected_(uint64_t address, uint16_t handle, const char *action, const char *type);
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  /// Whether the scan result has to be forwarded, records it as forwarded if so.
+  bool should_forward_(const esp32_ble::BLEScanResult &result, uint32_t now);
+#endif
 
   // Memory optimized layout for 32-bit systems
   // Group 1: Pointers (4 bytes each, naturally aligned)
@@ -156,8 +166,23 @@ class BluetoothProxy final : public esp32_ble_tracker::ESPBTDeviceListener, publ
   // BLE advertisement batching
   api::BluetoothLERawAdvertisementsResponse response_;
 
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  // Last forwarded advertisement or scan response of an address, open addressed on the key
+  struct AdvertisementCacheEntry {
+    uint64_t key;  // address, bit 48 set for scan responses, 0 when unused
+    uint32_t hash;
+    uint32_t last_sent;
+  };
+  std::array<AdvertisementCacheEntry, BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE> advertisement_cache_{};
+#endif
+
   // Group 3: 4-byte types
   uint32_t last_advertisement_flush_time_{0};
+#ifdef USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+  uint32_t advertisement_dedup_ttl_{0};
+  uint32_t advertisement_min_interval_{0};
+  uint32_t advertisements_dropped_{0};
+#endif
 
   // Pre-allocated response message - always ready to send
   api::BluetoothConnectionsFreeResponse connections_free_response_;
@@ -1,7 +1,11 @@
 import esphome.codegen as cg
-from esphome.components.esp32 import add_idf_component
+from esphome.components.esp32 import (
+    VARIANT_ESP32P4,
+    add_idf_component,
+    only_on_variant,
+)
 import esphome.config_validation as cv
-from esphome.const import CONF_BUFFER_SIZE, CONF_ID, CONF_TYPE
+from esphome.const import CONF_BUFFER_SIZE, CONF_ID, CONF_TIMEOUT, CONF_TYPE
 from esphome.types import ConfigType
 
 CODEOWNERS = ["@DT-art1"]
@@ -13,14 +17,19 @@ CONF_ENCODER_BUFFER_ID = "encoder_buffer_id"
 CONF_QUALITY = "quality"
 
 ESP32_CAMERA_ENCODER = "esp32_camera"
+ESP32_HARDWARE_ENCODER = "esp32_hardware"
 
 camera_ns = cg.esphome_ns.namespace("camera")
 camera_encoder_ns = cg.esphome_ns.namespace("camera_encoder")
 
 Encoder = camera_ns.class_("Encoder")
 EncoderBufferImpl = camera_encoder_ns.class_("EncoderBufferImpl")
+DMAEncoderBuffer = camera_encoder_ns.class_("DMAEncoderBuffer")
 
 ESP32CameraJPEGEncoder = camera_encoder_ns.class_("ESP32CameraJPEGEncoder", Encoder)
+ESP32HardwareJPEGEncoder = camera_encoder_ns.class_(
+    "ESP32HardwareJPEGEncoder", Encoder
+)
 
 MAX_JPEG_BUFFER_SIZE_2MB = 2 * 1024 * 1024
 
@@ -38,9 +47,31 @@ ESP32_CAMERA_ENCODER_SCHEMA = cv.Schema(
     }
 )
 
+ESP32_HARDWARE_ENCODER_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ESP32HardwareJPEGEncoder),
+            cv.Optional(CONF_QUALITY, default=80): cv.int_range(1, 100),
+            cv.Optional(CONF_BUFFER_SIZE, default=4096): cv.int_range(
+                1024, MAX_JPEG_BUFFER_SIZE_2MB
+            ),
+            cv.Optional(CONF_BUFFER_EXPAND_SIZE, default=1024): cv.int_range(
+                0, MAX_JPEG_BUFFER_SIZE_2MB
+            ),
+            cv.Optional(
+                CONF_TIMEOUT, default="100ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.GenerateID(CONF_ENCODER_BUFFER_ID): cv.declare_id(DMAEncoderBuffer),
+        }
+    ),
+    cv.only_with_esp_idf,
+    only_on_variant(supported=[VARIANT_ESP32P4]),
+)
+
 CONFIG_SCHEMA = cv.typed_schema(
     {
         ESP32_CAMERA_ENCODER: ESP32_CAMERA_ENCODER_SCHEMA,
+        ESP32_HARDWARE_ENCODER: ESP32_HARDWARE_ENCODER_SCHEMA,
     },
     default_type=ESP32_CAMERA_ENCODER,
 )
@@ -58,3 +89,12 @@ async def to_code(config: ConfigType) -> None:
             buffer,
         )
         cg.add(var.set_buffer_expand_size(config[CONF_BUFFER_EXPAND_SIZE]))
+    elif config[CONF_TYPE] == ESP32_HARDWARE_ENCODER:
+        cg.add_define("USE_ESP32_HARDWARE_JPEG_ENCODER")
+        var = cg.new_Pvariable(
+            config[CONF_ID],
+            config[CONF_QUALITY],
+            buffer,
+        )
+        cg.add(var.set_buffer_expand_size(config[CONF_BUFFER_EXPAND_SIZE]))
+        cg.add(var.set_timeout(config[CONF_TIMEOUT]))
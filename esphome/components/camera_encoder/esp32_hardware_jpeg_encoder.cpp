@@ -0,0 +1,126 @@
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32_HARDWARE_JPEG_ENCODER
+
+#include "esp32_hardware_jpeg_encoder.h"
+
+#include <esp_heap_caps.h>
+
+#include "esphome/core/log.h"
+
+namespace esphome::camera_encoder {
+
+static const char *const TAG = "camera_encoder";
+
+bool DMAEncoderBuffer::set_buffer_size(size_t size) {
+  if (size > this->capacity_) {
+    jpeg_encode_memory_alloc_cfg_t mem_cfg = {
+        .buffer_direction = JPEG_ENC_ALLOC_OUTPUT_BUFFER,
+    };
+    size_t allocated = 0;
+    // The buffer is aligned for DMA, it can't be reallocated in place
+    auto *p = static_cast<uint8_t *>(jpeg_alloc_encoder_mem(size, &mem_cfg, &allocated));
+    if (p == nullptr)
+      return false;
+
+    if (this->data_ != nullptr)
+      heap_caps_free(this->data_);
+    this->data_ = p;
+    this->capacity_ = allocated;
+  }
+  this->size_ = size;
+  return true;
+}
+
+DMAEncoderBuffer::~DMAEncoderBuffer() {
+  if (this->data_ != nullptr)
+    heap_caps_free(this->data_);
+}
+
+ESP32HardwareJPEGEncoder::ESP32HardwareJPEGEncoder(uint8_t quality, DMAEncoderBuffer *output) {
+  this->quality_ = quality;
+  this->output_ = output;
+}
+
+ESP32HardwareJPEGEncoder::~ESP32HardwareJPEGEncoder() {
+  if (this->engine_ != nullptr)
+    jpeg_del_encoder_engine(this->engine_);
+}
+
+camera::EncoderError ESP32HardwareJPEGEncoder::encode_pixels(camera::CameraImageSpec *spec, camera::Buffer *pixels) {
+  if (this->engine_ == nullptr) {
+    jpeg_encode_engine_cfg_t engine_cfg = {
+        .intr_priority = 0,
+        .timeout_ms = static_cast<int>(this->timeout_ms_),
+    };
+    esp_err_t err = jpeg_new_encoder_engine(&engine_cfg, &this->engine_);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to create the JPEG encoder engine: %s", esp_err_to_name(err));
+      this->engine_ = nullptr;
+      return camera::ENCODER_ERROR_CONFIGURATION;
+    }
+  }
+
+  bool gray = spec->format == camera::PIXEL_FORMAT_GRAYSCALE;
+  jpeg_encode_cfg_t enc_cfg = {
+      .height = spec->height,
+      .width = spec->width,
+      .src_type = to_internal_(spec->format),
+      .sub_sample = gray ? JPEG_DOWN_SAMPLING_GRAY : JPEG_DOWN_SAMPLING_YUV420,
+      .image_quality = this->quality_,
+  };
+  uint32_t out_size = 0;
+  esp_err_t err = jpeg_encoder_process(this->engine_, &enc_cfg, pixels->get_data_buffer(), pixels->get_data_length(),
+                                       this->output_->get_data(), this->output_->get_max_size(), &out_size);
+  if (err == ESP_ERR_INVALID_ARG) {
+    ESP_LOGE(TAG, "Frame rejected by the JPEG encoder: %s", esp_err_to_name(err));
+    return camera::ENCODER_ERROR_CONFIGURATION;
+  }
+
+  if (err != ESP_OK) {
+    // The peripheral stops when the output buffer is full, grow it like the software encoder does
+    if (this->buffer_expand_size_ <= 0)
+      return camera::ENCODER_ERROR_SKIP_FRAME;
+
+    size_t current_size = this->output_->get_max_size();
+    if (!this->output_->set_buffer_size(current_size + this->buffer_expand_size_)) {
+      ESP_LOGE(TAG, "Failed to expand output buffer.");
+      this->buffer_expand_size_ = 0;
+      return camera::ENCODER_ERROR_SKIP_FRAME;
+    }
+
+    ESP_LOGD(TAG, "Output buffer expanded (%zu -> %zu).", current_size, this->output_->get_max_size());
+    return camera::ENCODER_ERROR_RETRY_FRAME;
+  }
+
+  this->output_->set_buffer_size(out_size);
+  return camera::ENCODER_ERROR_SUCCESS;
+}
+
+void ESP32HardwareJPEGEncoder::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ESP32 Hardware JPEG Encoder:\n"
+                "  Size: %zu\n"
+                "  Quality: %d\n"
+                "  Expand: %zu\n"
+                "  Timeout: %" PRIu32 " ms",
+                this->output_->get_max_size(), this->quality_, this->buffer_expand_size_, this->timeout_ms_);
+}
+
+jpeg_enc_input_format_t ESP32HardwareJPEGEncoder::to_internal_(camera::PixelFormat format) {
+  switch (format) {
+    case camera::PIXEL_FORMAT_GRAYSCALE:
+      return JPEG_ENCODE_IN_FORMAT_GRAY;
+    case camera::PIXEL_FORMAT_RGB565:
+      return JPEG_ENCODE_IN_FORMAT_RGB565;
+    // Internal representation for RGB is in byte order: B, G, R
+    case camera::PIXEL_FORMAT_BGR888:
+      return JPEG_ENCODE_IN_FORMAT_RGB888;
+  }
+
+  return JPEG_ENCODE_IN_FORMAT_GRAY;
+}
+
+}  // namespace esphome::camera_encoder
+
+#endif
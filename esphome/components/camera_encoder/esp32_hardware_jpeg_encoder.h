@@ -0,0 +1,64 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32_HARDWARE_JPEG_ENCODER
+
+#include <driver/jpeg_encode.h>
+
+#include "esphome/components/camera/encoder.h"
+
+namespace esphome::camera_encoder {
+
+/// Encoder output buffer allocated for the JPEG peripheral, which writes through DMA and needs cache line alignment.
+class DMAEncoderBuffer : public camera::EncoderBuffer {
+ public:
+  // --- EncoderBuffer  ---
+  bool set_buffer_size(size_t size) override;
+  uint8_t *get_data() const override { return this->data_; }
+  size_t get_size() const override { return this->size_; }
+  size_t get_max_size() const override { return this->capacity_; }
+  // ----------------------
+  ~DMAEncoderBuffer() override;
+
+ protected:
+  size_t capacity_{};
+  size_t size_{};
+  uint8_t *data_{};
+};
+
+/// Encoder that uses the hardware JPEG codec of the ESP32-P4.
+///
+/// The peripheral reads the frame and writes the encoded image straight into the output buffer, so the CPU is free
+/// while a frame is encoded and no intermediate copy of the compressed data is made.
+class ESP32HardwareJPEGEncoder : public camera::Encoder {
+ public:
+  /// Constructs a ESP32HardwareJPEGEncoder instance.
+  /// @param quality Sets the quality of the encoded image (1-100).
+  /// @param output Pointer to preallocated output buffer.
+  ESP32HardwareJPEGEncoder(uint8_t quality, DMAEncoderBuffer *output);
+  /// Sets the number of bytes to expand the output buffer when an encoded frame doesn't fit.
+  /// @param buffer_expand_size Number of bytes to expand the buffer.
+  void set_buffer_expand_size(size_t buffer_expand_size) { this->buffer_expand_size_ = buffer_expand_size; }
+  /// Sets the longest time to wait for the peripheral to encode a frame.
+  void set_timeout(uint32_t timeout_ms) { this->timeout_ms_ = timeout_ms; }
+  // -------- Encoder --------
+  camera::EncoderError encode_pixels(camera::CameraImageSpec *spec, camera::Buffer *pixels) override;
+  camera::EncoderBuffer *get_output_buffer() override { return output_; }
+  void dump_config() override;
+  // -------------------------
+  ~ESP32HardwareJPEGEncoder() override;
+
+ protected:
+  static jpeg_enc_input_format_t to_internal_(camera::PixelFormat format);
+
+  DMAEncoderBuffer *output_{};
+  jpeg_encoder_handle_t engine_{};
+  size_t buffer_expand_size_{};
+  uint32_t timeout_ms_{100};
+  uint8_t quality_{};
+};
+
+}  // namespace esphome::camera_encoder
+
+#endif
@@ -16,6 +16,7 @@ CONF_REMOTE_TRANSMISSION_REQUEST = "remote_transmission_request"
 CONF_CANBUS_ID = "canbus_id"
 CONF_BIT_RATE = "bit_rate"
 CONF_ON_FRAME = "on_frame"
+CONF_HARDWARE_FILTER = "hardware_filter"
 
 
 def validate_id(config):
@@ -27,6 +28,12 @@ def validate_id(config):
     return config
 
 
+def validate_hardware_filter(config):
+    if config.get(CONF_HARDWARE_FILTER) and CONF_ON_FRAME not in config:
+        raise cv.Invalid(f"{CONF_HARDWARE_FILTER} filters for the {CONF_ON_FRAME} ids")
+    return config
+
+
 def validate_raw_data(value):
     if isinstance(value, str):
         return value.encode("utf-8")
@@ -85,6 +92,7 @@ CANBUS_SCHEMA = cv.Schema(
         cv.Required(CONF_CAN_ID): cv.int_range(min=0, max=0x1FFFFFFF),
         cv.Optional(CONF_BIT_RATE, default="125KBPS"): cv.enum(CAN_SPEEDS, upper=True),
         cv.Optional(CONF_USE_EXTENDED_ID, default=False): cv.boolean,
+        cv.Optional(CONF_HARDWARE_FILTER, default=False): cv.boolean,
         cv.Optional(CONF_ON_FRAME): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CanbusTrigger),
@@ -101,6 +109,7 @@ CANBUS_SCHEMA = cv.Schema(
 ).extend(cv.COMPONENT_SCHEMA)
 
 CANBUS_SCHEMA.add_extra(validate_id)
+CANBUS_SCHEMA.add_extra(validate_hardware_filter)
 
 
 async def setup_canbus_core_(var, config):
@@ -113,6 +122,10 @@ async def setup_canbus_core_(var, config):
         can_id = conf[CONF_CAN_ID]
         can_id_mask = conf[CONF_CAN_ID_MASK]
         ext_id = conf[CONF_USE_EXTENDED_ID]
+        if config[CONF_HARDWARE_FILTER]:
+            # Frames none of the triggers wants are dropped by the controller
+            id_bits = 0x1FFFFFFF if ext_id else 0x7FF
+            cg.add(var.add_hardware_filter(can_id, can_id_mask & id_bits, ext_id))
         trigger = cg.new_Pvariable(
             conf[CONF_TRIGGER_ID], var, can_id, can_id_mask, ext_id
         )
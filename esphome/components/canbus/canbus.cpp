@@ -66,41 +66,56 @@ void Canbus::add_trigger(CanbusTrigger *trigger) {
 };
 
 void Canbus::loop() {
-  struct CanFrame can_message;
-  // read all messages until queue is empty
-  int message_counter = 0;
-  while (this->read_message(&can_message) == canbus::ERROR_OK) {
-    message_counter++;
-    if (can_message.use_extended_id) {
-      ESP_LOGD(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
-               can_message.can_id, can_message.can_data_length_code);
-    } else {
-      ESP_LOGD(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
-               can_message.can_data_length_code);
-    }
+  struct CanFrame frames[RX_BATCH_SIZE];
+  std::vector<uint8_t> data;
+  data.reserve(CAN_MAX_DATA_LENGTH);
+  size_t count;
+  // Drain the controller before running the triggers, so its receive buffers don't overrun meanwhile
+  do {
+    count = 0;
+    while (count < RX_BATCH_SIZE && this->read_message(&frames[count]) == canbus::ERROR_OK)
+      count++;
+    for (size_t i = 0; i < count; i++)
+      this->dispatch_(frames[i], data);
+  } while (count == RX_BATCH_SIZE);
+}
+
+void Canbus::dispatch_(const struct CanFrame &frame, std::vector<uint8_t> &data) {
+  if (frame.use_extended_id) {
+    ESP_LOGD(TAG, "received can message extended can_id=0x%" PRIx32 " size=%d", frame.can_id,
+             frame.can_data_length_code);
+  } else {
+    ESP_LOGD(TAG, "received can message std can_id=0x%" PRIx32 " size=%d", frame.can_id, frame.can_data_length_code);
+  }
 
-    std::vector<uint8_t> data;
+  // show data received
+  data.assign(frame.data, frame.data + frame.can_data_length_code);
+  for (int i = 0; i < frame.can_data_length_code; i++) {
+    ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, frame.data[i]);
+  }
 
-    // show data received
-    for (int i = 0; i < can_message.can_data_length_code; i++) {
-      ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
-    }
+  this->callback_manager_(frame.can_id, frame.use_extended_id, frame.remote_transmission_request, data);
 
-    this->callback_manager_(can_message.can_id, can_message.use_extended_id, can_message.remote_transmission_request,
-                            data);
-
-    // fire all triggers
-    for (auto *trigger : this->triggers_) {
-      if ((trigger->can_id_ == (can_message.can_id & trigger->can_id_mask_)) &&
-          (trigger->use_extended_id_ == can_message.use_extended_id) &&
-          (!trigger->remote_transmission_request_.has_value() ||
-           trigger->remote_transmission_request_.value() == can_message.remote_transmission_request)) {
-        trigger->trigger(data, can_message.can_id, can_message.remote_transmission_request);
-      }
+  // fire all triggers
+  for (auto *trigger : this->triggers_) {
+    if ((trigger->can_id_ == (frame.can_id & trigger->can_id_mask_)) &&
+        (trigger->use_extended_id_ == frame.use_extended_id) &&
+        (!trigger->remote_transmission_request_.has_value() ||
+         trigger->remote_transmission_request_.value() == frame.remote_transmission_request)) {
+      trigger->trigger(data, frame.can_id, frame.remote_transmission_request);
     }
   }
 }
 
+CanFilter CanFilter::merge(const CanFilter *filters, size_t count) {
+  CanFilter merged = filters[0];
+  for (size_t i = 1; i < count; i++) {
+    // Only the bits all filters check and agree on are left
+    merged.can_id_mask &= filters[i].can_id_mask & ~(filters[i].can_id ^ merged.can_id);
+    merged.can_id &= merged.can_id_mask;
+  }
+  return merged;
+}
+
 }  // namespace canbus
 }  // namespace esphome
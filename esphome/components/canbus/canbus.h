@@ -62,6 +62,19 @@ struct CanFrame {
   uint8_t data[CAN_MAX_DATA_LENGTH] __attribute__((aligned(8)));
 };
 
+/// Acceptance filter, a frame passes if (frame can_id & can_id_mask) == can_id and the id type matches.
+struct CanFilter {
+  uint32_t can_id;
+  uint32_t can_id_mask;
+  bool use_extended_id;
+
+  /// Single filter that passes everything at least one of the filters passes, they have to share the id type.
+  static CanFilter merge(const CanFilter *filters, size_t count);
+};
+
+/// Frames read from the controller at once, before they are dispatched to the callbacks and triggers.
+static const size_t RX_BATCH_SIZE = 16;
+
 class Canbus : public Component {
  public:
   Canbus(){};
@@ -81,6 +94,10 @@ class Canbus : public Component {
   void set_bitrate(CanSpeed bit_rate) { this->bit_rate_ = bit_rate; }
 
   void add_trigger(CanbusTrigger *trigger);
+  /// Accept only frames passing one of the filters in hardware, if the controller can. Set before setup().
+  void add_hardware_filter(uint32_t can_id, uint32_t can_id_mask, bool use_extended_id) {
+    this->hardware_filters_.push_back({can_id & can_id_mask, can_id_mask, use_extended_id});
+  }
   /**
    * Add a callback to be called when a CAN message is received. All received messages
    * are passed to the callback without filtering.
@@ -99,6 +116,8 @@ class Canbus : public Component {
  protected:
   template<typename... Ts> friend class CanbusSendAction;
   std::vector<CanbusTrigger *> triggers_{};
+  // Empty accepts all frames
+  std::vector<CanFilter> hardware_filters_{};
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
@@ -108,6 +127,7 @@ class Canbus : public Component {
   virtual bool setup_internal() = 0;
   virtual Error send_message(struct CanFrame *frame) = 0;
   virtual Error read_message(struct CanFrame *frame) = 0;
+  void dispatch_(const struct CanFrame &frame, std::vector<uint8_t> &data);
 };
 
 template<typename... Ts> class CanbusSendAction : public Action<Ts...>, public Parented<Canbus> {
@@ -51,7 +51,12 @@ void CaptivePortal::handle_wifisave(AsyncWebServerRequest *request) {
   ESP_LOGI(TAG, "  SSID='%s'", ssid.c_str());
   ESP_LOGI(TAG, "  Password=" LOG_SECRET("'%s'"), psk.c_str());
   wifi::global_wifi_component->save_wifi_sta(ssid, psk);
-  wifi::global_wifi_component->start_scanning();
+  // The network was picked from the scan results the page showed, only scan again if it isn't in them
+  wifi::WiFiAP sta{};
+  sta.set_ssid(ssid);
+  sta.set_password(psk);
+  if (!wifi::global_wifi_component->connect_from_scan_results(sta))
+    wifi::global_wifi_component->start_scanning();
   request->redirect(ESPHOME_F("/?save"));
 }
 
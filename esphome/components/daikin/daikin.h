@@ -36,6 +36,7 @@ const uint32_t DAIKIN_BIT_MARK = 520;
 const uint32_t DAIKIN_ONE_SPACE = 1370;
 const uint32_t DAIKIN_ZERO_SPACE = 360;
 const uint32_t DAIKIN_MESSAGE_SPACE = 32300;
+constexpr remote_base::PulseDistanceTimings DAIKIN_BIT_TIMINGS{DAIKIN_BIT_MARK, DAIKIN_ONE_SPACE, DAIKIN_ZERO_SPACE};
 
 // State Frame size
 const uint8_t DAIKIN_STATE_FRAME_SIZE = 19;
@@ -1,6 +1,9 @@
 #include "dallas_temp.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace esphome {
 namespace dallas_temp {
 
@@ -12,6 +15,26 @@ static const uint8_t DALLAS_COMMAND_READ_SCRATCH_PAD = 0xBE;
 static const uint8_t DALLAS_COMMAND_WRITE_SCRATCH_PAD = 0x4E;
 static const uint8_t DALLAS_COMMAND_COPY_SCRATCH_PAD = 0x48;
 
+/// Last conversion started on a bus, the sensors that update while it runs read its result instead of starting another.
+struct BusConversion {
+  one_wire::OneWireBus *bus;
+  uint32_t start;
+  // Longest conversion time of the sensors on the bus
+  uint16_t duration;
+  bool started;
+};
+
+static BusConversion &get_bus_conversion(one_wire::OneWireBus *bus) {
+  // Usually a single bus, and there are only a few
+  static std::vector<BusConversion> conversions;
+  for (auto &conversion : conversions) {
+    if (conversion.bus == bus)
+      return conversion;
+  }
+  conversions.push_back({bus, 0, 0, false});
+  return conversions.back();
+}
+
 uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion_() const {
   switch (this->resolution_) {
     case 9:
@@ -42,9 +65,26 @@ void DallasTemperatureSensor::update() {
 
   this->status_clear_warning();
 
-  this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  // One Skip ROM conversion starts all sensors on the bus. Until the slowest of them is done, the others reuse it and
+  // only read their scratch pad, instead of waiting for a conversion of their own one after the other.
+  auto &conversion = get_bus_conversion(this->bus_);
+  const uint32_t now = millis();
+  uint32_t elapsed = now - conversion.start;
+  if (!conversion.started || elapsed >= conversion.duration) {
+    if (!this->bus_->broadcast(DALLAS_COMMAND_START_CONVERSION)) {
+      ESP_LOGW(TAG, "'%s' - starting conversion failed bus reset", this->get_name().c_str());
+      this->status_set_warning(LOG_STR("bus reset failed"));
+      this->publish_state(NAN);
+      return;
+    }
+    conversion.start = now;
+    conversion.started = true;
+    elapsed = 0;
+  }
+  const uint16_t conversion_time = this->millis_to_wait_for_conversion_();
+  const uint32_t wait = elapsed < conversion_time ? conversion_time - elapsed : 0;
 
-  this->set_timeout(this->get_address_name(), this->millis_to_wait_for_conversion_(), [this] {
+  this->set_timeout(this->get_address_name(), wait, [this] {
     if (!this->read_scratch_pad_() || !this->check_scratch_pad_()) {
       this->publish_state(NAN);
       return;
@@ -72,6 +112,8 @@ bool DallasTemperatureSensor::read_scratch_pad_() {
 void DallasTemperatureSensor::setup() {
   if (!this->check_address_())
     return;
+  auto &conversion = get_bus_conversion(this->bus_);
+  conversion.duration = std::max(conversion.duration, this->millis_to_wait_for_conversion_());
   if (!this->read_scratch_pad_())
     return;
   if (!this->check_scratch_pad_())
@@ -1,4 +1,5 @@
 import esphome.codegen as cg
+from esphome.components.esp32 import add_idf_sdkconfig_option
 from esphome.components.zephyr import zephyr_add_prj_conf
 from esphome.config_helpers import filter_source_files_from_platform
 import esphome.config_validation as cv
@@ -17,6 +18,7 @@ CODEOWNERS = ["@esphome/core"]
 DEPENDENCIES = ["logger"]
 
 CONF_DEBUG_ID = "debug_id"
+CONF_HEAP_TRACING = "heap_tracing"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 
@@ -40,11 +42,18 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOOP_TIME): cv.invalid(
                 "The 'loop_time' option has been moved to the 'debug' sensor component"
             ),
+            cv.Optional(CONF_HEAP_TRACING): cv.All(cv.only_with_esp_idf, cv.boolean),
         }
     ).extend(cv.polling_component_schema("60s")),
 )
 
 
+def enable_heap_hooks():
+    """Counts every heap allocation from the ESP-IDF allocation hook."""
+    add_idf_sdkconfig_option("CONFIG_HEAP_USE_HOOKS", True)
+    cg.add_define("USE_DEBUG_HEAP_HOOKS")
+
+
 async def to_code(config):
     if CORE.using_zephyr:
         zephyr_add_prj_conf("HWINFO", True)
@@ -57,6 +66,9 @@ async def to_code(config):
         zephyr_add_prj_conf("LOG_BLOCK_IN_THREAD", True)
         zephyr_add_prj_conf("LOG_BUFFER_SIZE", 4096)
         zephyr_add_prj_conf("SEGGER_RTT_MODE_BLOCK_IF_FIFO_FULL", True)
+    if config.get(CONF_HEAP_TRACING):
+        enable_heap_hooks()
+        cg.add_define("USE_DEBUG_HEAP_TRACING")
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
@@ -29,12 +29,21 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
   void set_block_sensor(sensor::Sensor *block_sensor) { block_sensor_ = block_sensor; }
-#if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+#if (defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)) || defined(USE_ESP32)
   void set_fragmentation_sensor(sensor::Sensor *fragmentation_sensor) { fragmentation_sensor_ = fragmentation_sensor; }
 #endif
   void set_loop_time_sensor(sensor::Sensor *loop_time_sensor) { loop_time_sensor_ = loop_time_sensor; }
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
+#ifdef USE_DEBUG_HEAP_HOOKS
+  void set_allocation_rate_sensor(sensor::Sensor *allocation_rate_sensor) {
+    this->allocation_rate_sensor_ = allocation_rate_sensor;
+  }
+#endif  // USE_DEBUG_HEAP_HOOKS
+  /// Publishes the bytes the subsystem has allocated.
+  void set_ram_usage_sensor(RAMSubsystem subsystem, sensor::Sensor *ram_usage_sensor) {
+    this->ram_usage_sensors_[static_cast<size_t>(subsystem)] = ram_usage_sensor;
+  }
 #endif  // USE_ESP32
   void set_cpu_frequency_sensor(sensor::Sensor *cpu_frequency_sensor) {
     this->cpu_frequency_sensor_ = cpu_frequency_sensor;
@@ -43,6 +52,9 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   void on_shutdown() override;
 #endif  // USE_ESP32
+#ifdef USE_DEBUG_HEAP_HOOKS
+  void setup() override;
+#endif  // USE_DEBUG_HEAP_HOOKS
  protected:
   uint32_t free_heap_{};
 
@@ -52,12 +64,16 @@ class DebugComponent : public PollingComponent {
 
   sensor::Sensor *free_sensor_{nullptr};
   sensor::Sensor *block_sensor_{nullptr};
-#if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
+#if (defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)) || defined(USE_ESP32)
   sensor::Sensor *fragmentation_sensor_{nullptr};
 #endif
   sensor::Sensor *loop_time_sensor_{nullptr};
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
+#ifdef USE_DEBUG_HEAP_HOOKS
+  sensor::Sensor *allocation_rate_sensor_{nullptr};
+#endif  // USE_DEBUG_HEAP_HOOKS
+  std::array<sensor::Sensor *, static_cast<size_t>(RAMSubsystem::COUNT)> ram_usage_sensors_{};
 #endif  // USE_ESP32
   sensor::Sensor *cpu_frequency_sensor_{nullptr};
 #endif  // USE_SENSOR
@@ -75,6 +91,14 @@ class DebugComponent : public PollingComponent {
    */
   void log_partition_info_();
 #endif  // USE_ESP32
+#ifdef USE_DEBUG_HEAP_HOOKS
+  uint32_t last_allocations_{0};
+  uint32_t last_allocations_time_{0};
+#endif  // USE_DEBUG_HEAP_HOOKS
+#ifdef USE_DEBUG_HEAP_TRACING
+  /// Logs the components that allocated the most since the last call.
+  void log_heap_trace_();
+#endif  // USE_DEBUG_HEAP_TRACING
 
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
@@ -11,8 +11,16 @@
 #include <esp_chip_info.h>
 #include <esp_partition.h>
 
+#include <algorithm>
+#include <array>
 #include <map>
 
+#ifdef USE_DEBUG_HEAP_HOOKS
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #ifdef USE_ARDUINO
 #include <Esp.h>
 #endif
@@ -22,6 +30,28 @@ namespace debug {
 
 static const char *const TAG = "debug";
 
+#ifdef USE_DEBUG_HEAP_HOOKS
+// Every allocation of every task, counted by the heap hook
+static std::atomic<uint32_t> heap_allocations{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_DEBUG_HEAP_TRACING
+/// Allocations made by a component from the loop since the last trace was logged.
+struct HeapTraceEntry {
+  // nullptr for allocations outside of any component
+  Component *component;
+  uint32_t allocations;
+  uint32_t bytes;
+};
+// Components that allocate in the loop, more than that are not traced
+static const size_t HEAP_TRACE_SIZE = 24;
+static const size_t HEAP_TRACE_LOG_COUNT = 5;
+// Only written and read by the loop task, so no locking
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static std::array<HeapTraceEntry, HEAP_TRACE_SIZE> heap_trace{};
+static uint8_t heap_trace_count = 0;           // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static TaskHandle_t loop_task_handle = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
 // index by values returned by esp_reset_reason
 
 static const char *const RESET_REASONS[] = {
@@ -220,14 +250,96 @@ void DebugComponent::get_device_info_(std::string &device_info) {
   device_info += wakeup_reason;
 }
 
+#ifdef USE_DEBUG_HEAP_HOOKS
+}  // namespace debug
+}  // namespace esphome
+
+// Called by the heap for every allocation with CONFIG_HEAP_USE_HOOKS, also from other tasks. Must not allocate.
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps) {
+  using namespace esphome::debug;
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef USE_DEBUG_HEAP_TRACING
+  if (loop_task_handle == nullptr || xTaskGetCurrentTaskHandle() != loop_task_handle)
+    return;
+  esphome::Component *component = esphome::App.get_current_component();
+  uint8_t i = 0;
+  while (i < heap_trace_count && heap_trace[i].component != component)
+    i++;
+  if (i == heap_trace_count) {
+    if (heap_trace_count == HEAP_TRACE_SIZE)
+      return;
+    heap_trace[heap_trace_count++] = {component, 0, 0};
+  }
+  heap_trace[i].allocations++;
+  heap_trace[i].bytes += size;
+#endif
+}
+
+namespace esphome {
+namespace debug {
+
+void DebugComponent::setup() {
+#ifdef USE_DEBUG_HEAP_TRACING
+  loop_task_handle = xTaskGetCurrentTaskHandle();
+#endif
+  this->last_allocations_ = heap_allocations.load(std::memory_order_relaxed);
+  this->last_allocations_time_ = millis();
+}
+#endif  // USE_DEBUG_HEAP_HOOKS
+
+#ifdef USE_DEBUG_HEAP_TRACING
+void DebugComponent::log_heap_trace_() {
+  // Copied first, logging allocates itself
+  std::array<HeapTraceEntry, HEAP_TRACE_SIZE> trace = heap_trace;
+  const size_t count = heap_trace_count;
+  heap_trace_count = 0;
+
+  const size_t log_count = std::min(count, HEAP_TRACE_LOG_COUNT);
+  std::partial_sort(trace.begin(), trace.begin() + log_count, trace.begin() + count,
+                    [](const HeapTraceEntry &a, const HeapTraceEntry &b) { return a.allocations > b.allocations; });
+  ESP_LOGD(TAG, "Heap allocations in the loop since the last update:");
+  for (size_t i = 0; i < log_count; i++) {
+    const Component *component = trace[i].component;
+    ESP_LOGD(TAG, "  %s: %" PRIu32 " allocations, %" PRIu32 " bytes",
+             component != nullptr ? LOG_STR_ARG(component->get_component_log_str()) : "(no component)",
+             trace[i].allocations, trace[i].bytes);
+  }
+}
+#endif  // USE_DEBUG_HEAP_TRACING
+
 void DebugComponent::update_platform_() {
 #ifdef USE_SENSOR
   if (this->block_sensor_ != nullptr) {
     this->block_sensor_->publish_state(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
   }
+  if (this->fragmentation_sensor_ != nullptr) {
+    // Share of the free internal heap that is not in the largest block
+    const size_t free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    const size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    this->fragmentation_sensor_->publish_state(free == 0 ? 0.0f : 100.0f - 100.0f * largest / free);
+  }
+#ifdef USE_DEBUG_HEAP_HOOKS
+  if (this->allocation_rate_sensor_ != nullptr) {
+    const uint32_t allocations = heap_allocations.load(std::memory_order_relaxed);
+    const uint32_t now = millis();
+    if (now != this->last_allocations_time_) {
+      this->allocation_rate_sensor_->publish_state((allocations - this->last_allocations_) * 1000.0f /
+                                                   (now - this->last_allocations_time_));
+    }
+    this->last_allocations_ = allocations;
+    this->last_allocations_time_ = now;
+  }
+#endif  // USE_DEBUG_HEAP_HOOKS
   if (this->psram_sensor_ != nullptr) {
     this->psram_sensor_->publish_state(heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
   }
+  for (size_t i = 0; i < this->ram_usage_sensors_.size(); i++) {
+    if (this->ram_usage_sensors_[i] != nullptr)
+      this->ram_usage_sensors_[i]->publish_state(get_ram_usage(static_cast<RAMSubsystem>(i)));
+  }
+#endif
+#ifdef USE_DEBUG_HEAP_TRACING
+  this->log_heap_trace_();
 #endif
 }
 
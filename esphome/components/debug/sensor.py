@@ -1,7 +1,7 @@
 import esphome.codegen as cg
 from esphome.components import sensor
 from esphome.components.esp32 import CONF_CPU_FREQUENCY
-from esphome.components.psram import DOMAIN as PSRAM_DOMAIN
+from esphome.components.psram import DOMAIN as PSRAM_DOMAIN, RAM_SUBSYSTEMS
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_BLOCK,
@@ -11,17 +11,22 @@ from esphome.const import (
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_COUNTER,
     ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
     UNIT_BYTES,
     UNIT_HERTZ,
     UNIT_MILLISECOND,
     UNIT_PERCENT,
 )
 
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, DebugComponent, enable_heap_hooks
 
 DEPENDENCIES = ["debug"]
 
+UNIT_ALLOCATIONS_PER_SECOND = "allocs/s"
+
+CONF_ALLOCATION_RATE = "allocation_rate"
 CONF_PSRAM = "psram"
+CONF_RAM_USAGE = "ram_usage"
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -38,8 +43,13 @@ CONFIG_SCHEMA = {
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
     cv.Optional(CONF_FRAGMENTATION): cv.All(
-        cv.only_on_esp8266,
-        cv.require_framework_version(esp8266_arduino=cv.Version(2, 5, 2)),
+        cv.Any(
+            cv.only_on_esp32,
+            cv.All(
+                cv.only_on_esp8266,
+                cv.require_framework_version(esp8266_arduino=cv.Version(2, 5, 2)),
+            ),
+        ),
         sensor.sensor_schema(
             unit_of_measurement=UNIT_PERCENT,
             icon=ICON_COUNTER,
@@ -63,6 +73,30 @@ CONFIG_SCHEMA = {
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
     ),
+    cv.Optional(CONF_RAM_USAGE): cv.All(
+        cv.only_on_esp32,
+        cv.Schema(
+            {
+                cv.Optional(subsystem): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_BYTES,
+                    icon=ICON_COUNTER,
+                    accuracy_decimals=0,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+                )
+                for subsystem in RAM_SUBSYSTEMS
+            }
+        ),
+    ),
+    cv.Optional(CONF_ALLOCATION_RATE): cv.All(
+        cv.only_with_esp_idf,
+        sensor.sensor_schema(
+            unit_of_measurement=UNIT_ALLOCATIONS_PER_SECOND,
+            icon=ICON_COUNTER,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    ),
     cv.Optional(CONF_CPU_FREQUENCY): cv.All(
         sensor.sensor_schema(
             unit_of_measurement=UNIT_HERTZ,
@@ -97,6 +131,17 @@ async def to_code(config):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
 
+    for subsystem, ram_usage_conf in config.get(CONF_RAM_USAGE, {}).items():
+        sens = await sensor.new_sensor(ram_usage_conf)
+        cg.add(
+            debug_component.set_ram_usage_sensor(RAM_SUBSYSTEMS[subsystem], sens)
+        )
+
+    if allocation_rate_conf := config.get(CONF_ALLOCATION_RATE):
+        enable_heap_hooks()
+        sens = await sensor.new_sensor(allocation_rate_conf)
+        cg.add(debug_component.set_allocation_rate_sensor(sens))
+
     if cpu_freq_conf := config.get(CONF_CPU_FREQUENCY):
         sens = await sensor.new_sensor(cpu_freq_conf)
         cg.add(debug_component.set_cpu_frequency_sensor(sens))
@@ -11,9 +11,11 @@ from esphome.components.esp32.const import (
     VARIANT_ESP32S2,
     VARIANT_ESP32S3,
 )
+from esphome.config import iter_ids
 from esphome.config_helpers import filter_source_files_from_platform
 import esphome.config_validation as cv
 from esphome.const import (
+    CONF_COMPONENTS,
     CONF_DEFAULT,
     CONF_HOUR,
     CONF_ID,
@@ -21,6 +23,7 @@ from esphome.const import (
     CONF_MODE,
     CONF_NUMBER,
     CONF_PINS,
+    CONF_PLATFORM,
     CONF_RUN_DURATION,
     CONF_SECOND,
     CONF_SLEEP_DURATION,
@@ -30,6 +33,8 @@ from esphome.const import (
     PLATFORM_ESP8266,
     PlatformFramework,
 )
+from esphome.core import CORE, ID
+from esphome.loader import get_component, get_platform
 
 WAKEUP_PINS = {
     VARIANT_ESP32: [
@@ -168,6 +173,10 @@ CONF_TOUCH_WAKEUP = "touch_wakeup"
 CONF_GPIO_WAKEUP_REASON = "gpio_wakeup_reason"
 CONF_TOUCH_WAKEUP_REASON = "touch_wakeup_reason"
 CONF_UNTIL = "until"
+CONF_FAST_WAKE = "fast_wake"
+
+# Components that bring up the network for the ones depending on "network"
+NETWORK_PROVIDERS = ("wifi", "ethernet", "openthread")
 
 WAKEUP_CAUSES_SCHEMA = cv.Schema(
     {
@@ -212,6 +221,16 @@ CONFIG_SCHEMA = cv.All(
                     }
                 ),
             ),
+            cv.Optional(CONF_FAST_WAKE): cv.Schema(
+                {
+                    cv.Required(CONF_COMPONENTS): cv.ensure_list(
+                        cv.use_id(cg.Component)
+                    ),
+                    cv.Optional(
+                        CONF_RUN_DURATION
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
             cv.Optional(CONF_TOUCH_WAKEUP): cv.All(
                 cv.only_on_esp32,
                 esp32.only_on_variant(
@@ -279,9 +298,69 @@ async def to_code(config):
     if CONF_TOUCH_WAKEUP in config:
         cg.add(var.set_touch_wakeup(config[CONF_TOUCH_WAKEUP]))
 
+    if fast_wake := config.get(CONF_FAST_WAKE):
+        ids = list(fast_wake[CONF_COMPONENTS])
+        # Keep the logs of the short wake
+        if (logger := CORE.config.get("logger")) is not None:
+            ids.insert(0, logger[CONF_ID])
+        components = [await cg.get_variable(id_) for id_ in _fast_wake_closure(ids)]
+        cg.add(var.set_fast_wake_components(components))
+        if CONF_RUN_DURATION in fast_wake:
+            cg.add(var.set_fast_wake_run_duration(fast_wake[CONF_RUN_DURATION]))
+        cg.add_define("USE_FAST_WAKE")
+
     cg.add_define("USE_DEEP_SLEEP")
 
 
+def _fast_wake_closure(ids: list[ID]) -> list[ID]:
+    """Add what the fast wake components need to run.
+
+    That is every component their configuration refers to, like the bus of a
+    sensor, and the network for components that depend on it, repeated for
+    the added ones. Anything left out would run without being set up.
+    """
+    # Declared component IDs and the path of their configuration
+    declared: dict[str, list] = {}
+    for id_, path in iter_ids(CORE.config):
+        if (
+            id_.is_declaration
+            and id_.type is not None
+            and id_.type.inherits_from(cg.Component)
+            and path
+        ):
+            declared.setdefault(id_.id, path[:-1])
+
+    def config_at(path):
+        conf = CORE.config
+        for key in path:
+            conf = conf[key]
+        return conf
+
+    result: list[ID] = []
+    seen: set[str] = set()
+    pending = list(ids)
+    while pending:
+        id_ = pending.pop(0)
+        if id_.id in seen or id_.id not in declared:
+            continue
+        seen.add(id_.id)
+        result.append(id_)
+        path = declared[id_.id]
+        conf = config_at(path)
+        pending.extend(ref for ref, _ in iter_ids(conf) if not ref.is_declaration)
+
+        domain = path[0]
+        if isinstance(conf, dict) and CONF_PLATFORM in conf:
+            manifest = get_platform(domain, conf[CONF_PLATFORM])
+        else:
+            manifest = get_component(domain)
+        if manifest is not None and "network" in manifest.dependencies:
+            for provider in NETWORK_PROVIDERS:
+                if (provider_conf := CORE.config.get(provider)) is not None:
+                    pending.append(provider_conf[CONF_ID])
+    return result
+
+
 DEEP_SLEEP_ACTION_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.use_id(DeepSleepComponent),
@@ -14,7 +14,11 @@ bool global_has_deep_sleep = false;  // NOLINT(cppcoreguidelines-avoid-non-const
 void DeepSleepComponent::setup() {
   global_has_deep_sleep = true;
 
-  const optional<uint32_t> run_duration = get_run_duration_();
+  optional<uint32_t> run_duration = get_run_duration_();
+#ifdef USE_FAST_WAKE
+  if (App.is_fast_wake() && this->fast_wake_run_duration_.has_value())
+    run_duration = this->fast_wake_run_duration_;
+#endif
   if (run_duration.has_value()) {
     ESP_LOGI(TAG, "Scheduling in %" PRIu32 " ms", *run_duration);
     this->set_timeout(*run_duration, [this]() { this->begin_sleep(); });
@@ -32,6 +36,11 @@ void DeepSleepComponent::dump_config() {
   if (this->run_duration_.has_value()) {
     ESP_LOGCONFIG(TAG, "  Run Duration: %" PRIu32 " ms", *this->run_duration_);
   }
+#ifdef USE_FAST_WAKE
+  if (this->fast_wake_run_duration_.has_value()) {
+    ESP_LOGCONFIG(TAG, "  Fast Wake Run Duration: %" PRIu32 " ms", *this->fast_wake_run_duration_);
+  }
+#endif
   this->dump_config_platform_();
 }
 
@@ -48,6 +57,16 @@ void DeepSleepComponent::set_sleep_duration(uint32_t time_ms) { this->sleep_dura
 
 void DeepSleepComponent::set_run_duration(uint32_t time_ms) { this->run_duration_ = time_ms; }
 
+#ifdef USE_FAST_WAKE
+void DeepSleepComponent::set_fast_wake_components(std::vector<Component *> components) {
+  // Called before App.setup(), a normal boot sets up everything
+  if (!this->woke_from_deep_sleep_())
+    return;
+  components.push_back(this);
+  App.set_wake_essential_components(std::move(components));
+}
+#endif
+
 void DeepSleepComponent::begin_sleep(bool manual) {
   if (this->prevent_ && !manual) {
     this->next_enter_deep_sleep_ = true;
@@ -15,6 +15,7 @@
 #endif
 
 #include <cinttypes>
+#include <vector>
 
 namespace esphome {
 namespace deep_sleep {
@@ -93,6 +94,13 @@ class DeepSleepComponent : public Component {
   /// Set a duration in ms for how long the code should run before entering deep sleep mode.
   void set_run_duration(uint32_t time_ms);
 
+#ifdef USE_FAST_WAKE
+  /// On a wake from deep sleep, set up only these components and this one, the others stay idle until the next boot.
+  void set_fast_wake_components(std::vector<Component *> components);
+  /// Set the run duration used instead of the others when only the fast wake components were set up.
+  void set_fast_wake_run_duration(uint32_t time_ms) { this->fast_wake_run_duration_ = time_ms; }
+#endif
+
   void setup() override;
   void dump_config() override;
   void loop() override;
@@ -110,6 +118,8 @@ class DeepSleepComponent : public Component {
   // duration before entering deep sleep.
   optional<uint32_t> get_run_duration_() const;
 
+  // Whether this boot is a wake from deep sleep, not a power on or reset.
+  bool woke_from_deep_sleep_() const;
   void dump_config_platform_();
   bool prepare_to_sleep_();
   void deep_sleep_();
@@ -127,6 +137,9 @@ class DeepSleepComponent : public Component {
   optional<WakeupCauseToRunDuration> wakeup_cause_to_run_duration_;
 #endif  // USE_ESP32
   optional<uint32_t> run_duration_;
+#ifdef USE_FAST_WAKE
+  optional<uint32_t> fast_wake_run_duration_;
+#endif
   bool next_enter_deep_sleep_{false};
   bool prevent_{false};
 };
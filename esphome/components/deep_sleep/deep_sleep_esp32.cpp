@@ -46,6 +46,10 @@ optional<uint32_t> DeepSleepComponent::get_run_duration_() const {
   return this->run_duration_;
 }
 
+bool DeepSleepComponent::woke_from_deep_sleep_() const {
+  return esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
 void DeepSleepComponent::set_wakeup_pin_mode(WakeupPinMode wakeup_pin_mode) {
   this->wakeup_pin_mode_ = wakeup_pin_mode;
 }
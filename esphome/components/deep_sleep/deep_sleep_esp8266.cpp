@@ -2,6 +2,7 @@
 #include "deep_sleep_component.h"
 
 #include <Esp.h>
+#include <user_interface.h>
 
 namespace esphome {
 namespace deep_sleep {
@@ -10,6 +11,10 @@ static const char *const TAG = "deep_sleep";
 
 optional<uint32_t> DeepSleepComponent::get_run_duration_() const { return this->run_duration_; }
 
+bool DeepSleepComponent::woke_from_deep_sleep_() const {
+  return system_get_rst_info()->reason == REASON_DEEP_SLEEP_AWAKE;
+}
+
 void DeepSleepComponent::dump_config_platform_() {}
 
 bool DeepSleepComponent::prepare_to_sleep_() { return true; }
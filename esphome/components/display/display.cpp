@@ -17,6 +17,10 @@ void Display::fill(Color color) { this->filled_rectangle(0, 0, this->get_width()
 void Display::clear() { this->fill(COLOR_OFF); }
 void Display::set_rotation(DisplayRotation rotation) { this->rotation_ = rotation; }
 void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
+  if (y1 == y2) {
+    this->horizontal_line(std::min(x1, x2), y1, abs(x2 - x1) + 1, color);
+    return;
+  }
   const int32_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
   const int32_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
   int32_t err = dx + dy;
@@ -86,8 +90,8 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
+void HOT Display::fill_span(int x, int y, int width, Color color) {
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
@@ -103,9 +107,8 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+    this->fill_span(x1, i, width, color);
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
@@ -648,6 +651,10 @@ void Display::show_page(DisplayPage *page) {
 void Display::show_next_page() { this->page_->show_next(); }
 void Display::show_prev_page() { this->page_->show_prev(); }
 void Display::do_update_() {
+#ifdef USE_POWER_MANAGEMENT
+  // Drawing the page is the CPU bound part of a refresh, the transfer to the panel is left to the bus
+  this->performance_lock_.acquire();
+#endif
   if (this->auto_clear_enabled_) {
     this->clear();
   }
@@ -659,6 +666,9 @@ void Display::do_update_() {
     (*this->writer_)(*this);
   }
   this->clear_clipping_();
+#ifdef USE_POWER_MANAGEMENT
+  this->performance_lock_.release();
+#endif
 }
 void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
   if ((this->from_ == nullptr || this->from_ == from) && (this->to_ == nullptr || this->to_ == to))
@@ -23,6 +23,10 @@
 #include "esphome/components/graphical_display_menu/graphical_display_menu.h"
 #endif
 
+#ifdef USE_POWER_MANAGEMENT
+#include "esphome/components/power_management/power_management.h"
+#endif
+
 namespace esphome {
 namespace display {
 
@@ -250,12 +254,27 @@ class Display : public PollingComponent {
   virtual void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
                               ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad);
 
+  /** Set the pixels [x,y] to [x+width-1,y] to the given color, clipped like draw_pixel_at().
+   * The naive implementation here draws the pixels one by one, displays with a frame buffer override it to write
+   * the whole run at once. Horizontal lines, filled shapes and glyphs are drawn through this.
+   */
+  virtual void fill_span(int x, int y, int width, Color color);
+
   /// Convenience overload for base case where the pixels are packed into the buffer with no gaps (e.g. suits LVGL.)
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
                       ColorBitness bitness, bool big_endian) {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Let draw_pixels_at() return while the pixels are still being sent to the panel, e.g. by DMA. The caller must
+   * then keep the source data unchanged until wait_draw_complete() has returned.
+   * Returns false if the display always finishes drawing before draw_pixels_at() returns.
+   */
+  virtual bool enable_async_draw() { return false; }
+
+  /// Wait until the data passed to draw_pixels_at() is no longer needed.
+  virtual void wait_draw_complete() {}
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -685,6 +704,9 @@ class Display : public PollingComponent {
   bool auto_clear_enabled_{true};
   std::vector<Rect> clipping_rectangle_;
   bool show_test_card_{false};
+#ifdef USE_POWER_MANAGEMENT
+  power_management::PerformanceLock performance_lock_{"display"};
+#endif
 };
 
 class DisplayPage {
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -11,7 +12,7 @@ namespace display {
 static const char *const TAG = "display";
 
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(RAMSubsystem::DISPLAY);
   this->buffer_ = allocator.allocate(buffer_length);
   if (this->buffer_ == nullptr) {
     ESP_LOGE(TAG, "Could not allocate buffer for display!");
@@ -68,5 +69,47 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  int min_x = std::max(x, 0);
+  int max_x = std::min(x + width, this->get_width());
+  if (y < 0 || y >= this->get_height())
+    return;
+  const Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    if (y < clipping.y || y >= clipping.y2())
+      return;
+    min_x = std::max(min_x, (int) clipping.x);
+    max_x = std::min(max_x, (int) clipping.x2());
+  }
+  if (min_x >= max_x)
+    return;
+
+  const int native_width = this->get_width_internal();
+  const int native_height = this->get_height_internal();
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_absolute_span_internal(min_x, y, max_x - min_x, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_absolute_span_internal(native_width - max_x, native_height - y - 1, max_x - min_x, color);
+      break;
+    // The span is a native column, there is no run to write
+    case DISPLAY_ROTATION_90_DEGREES:
+      for (int i = min_x; i < max_x; i++)
+        this->draw_absolute_pixel_internal(native_width - y - 1, i, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = min_x; i < max_x; i++)
+        this->draw_absolute_pixel_internal(y, native_height - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void DisplayBuffer::fill_absolute_span_internal(int x, int y, int width, Color color) {
+  for (int i = x; i < x + width; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+
 }  // namespace display
 }  // namespace esphome
@@ -21,13 +21,28 @@ class DisplayBuffer : public Display {
 
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
+  void fill_span(int x, int y, int width, Color color) override;
 
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /// Set width pixels of the native row y starting at x, all of them inside the display. Drivers override this to
+  /// write the row into their buffer in one go.
+  virtual void fill_absolute_span_internal(int x, int y, int width, Color color);
 
   void init_internal_(uint32_t buffer_length);
 
+  /// Grow the region of the buffer that changed since the last take_dirty_region_(), in native coordinates. Drivers
+  /// that only send the changed part of the buffer call this for the pixels they actually modify.
+  void mark_dirty_(int x, int y, int width = 1, int height = 1) { this->dirty_.extend(Rect(x, y, width, height)); }
+  /// The bounding box of all changes since the last call, unset if nothing changed.
+  Rect take_dirty_region_() {
+    Rect dirty = this->dirty_;
+    this->dirty_ = Rect();
+    return dirty;
+  }
+
   uint8_t *buffer_{nullptr};
+  Rect dirty_{};
 };
 
 }  // namespace display
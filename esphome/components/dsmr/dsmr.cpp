@@ -128,6 +128,7 @@ void Dsmr::reset_telegram_() {
   this->header_found_ = false;
   this->footer_found_ = false;
   this->bytes_read_ = 0;
+  this->telegram_offset_ = 0;
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
   this->last_read_time_ = 0;
@@ -209,13 +210,14 @@ void Dsmr::receive_encrypted_telegram_() {
     }
 
     // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
+    uint8_t *crypt_telegram = reinterpret_cast<uint8_t *>(this->telegram_);
+    crypt_telegram[this->crypt_bytes_read_] = c;
     this->crypt_bytes_read_++;
 
     // Read the length of the incoming encrypted telegram.
     if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
       // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
+      this->crypt_telegram_len_ = 13 + (crypt_telegram[11] << 8 | crypt_telegram[12]);
       ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
     }
 
@@ -225,25 +227,24 @@ void Dsmr::receive_encrypted_telegram_() {
     }
     ESP_LOGV(TAG, "End of encrypted telegram found");
 
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
+    // Decrypt the encrypted telegram in place, the plain text replaces the ciphertext that starts at byte 18
+    constexpr size_t ciphertext_offset{18};
+    GCM<AES128> gcmaes128;
+    gcmaes128.setKey(this->decryption_key_.data(), gcmaes128.keySize());
     // the iv is 8 bytes of the system title + 4 bytes frame counter
     // system title is at byte 2 and frame counter at byte 15
     for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
+      crypt_telegram[i] = crypt_telegram[i + 4];
     constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
+    gcmaes128.setIV(&crypt_telegram[2], iv_size);
+    uint8_t *ciphertext = &crypt_telegram[ciphertext_offset];
+    const size_t ciphertext_len = this->crypt_bytes_read_ - ciphertext_offset;
+    gcmaes128.decrypt(ciphertext, ciphertext, ciphertext_len);
+
+    this->telegram_offset_ = ciphertext_offset;
+    this->bytes_read_ = strnlen(this->telegram_ + ciphertext_offset, ciphertext_len);
     ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
+    ESP_LOGVV(TAG, "Decrypted telegram: %.*s", this->bytes_read_, this->telegram_ + ciphertext_offset);
 
     // Parse the decrypted telegram and publish sensor values.
     this->parse_telegram();
@@ -257,12 +258,13 @@ bool Dsmr::parse_telegram() {
   ESP_LOGV(TAG, "Trying to parse telegram");
   this->stop_requesting_data_();
 
+  const char *telegram = this->telegram_ + this->telegram_offset_;
   ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
+      ::dsmr::P1Parser::parse(&data, telegram, this->bytes_read_, false,
                               this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
   if (res.err) {
     // Parsing error, show it
-    auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
+    auto err_str = res.fullError(telegram, telegram + this->bytes_read_);
     ESP_LOGE(TAG, "%s", err_str.c_str());
     return false;
   } else {
@@ -271,7 +273,7 @@ bool Dsmr::parse_telegram() {
 
     // publish the telegram, after publishing the sensors so it can also trigger action based on latest values
     if (this->s_telegram_ != nullptr) {
-      this->s_telegram_->publish_state(std::string(this->telegram_, this->bytes_read_));
+      this->s_telegram_->publish_state(std::string(telegram, this->bytes_read_));
     }
     return true;
   }
@@ -301,10 +303,6 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
   if (decryption_key.empty()) {
     ESP_LOGI(TAG, "Disabling decryption");
     this->decryption_key_.clear();
-    if (this->crypt_telegram_ != nullptr) {
-      delete[] this->crypt_telegram_;
-      this->crypt_telegram_ = nullptr;
-    }
     return;
   }
 
@@ -323,10 +321,6 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
     strncpy(temp, &(decryption_key.c_str()[i * 2]), 2);
     this->decryption_key_.push_back(std::strtoul(temp, nullptr, 16));
   }
-
-  if (this->crypt_telegram_ == nullptr) {
-    this->crypt_telegram_ = new uint8_t[this->max_telegram_len_];  // NOLINT
-  }
 }
 
 }  // namespace dsmr
@@ -118,9 +118,11 @@ class Dsmr : public Component, public uart::UARTDevice {
   uint32_t receive_timeout_;
   bool receive_timeout_reached_();
   size_t max_telegram_len_;
+  // Holds the plain text telegram, or the encrypted one which is then decrypted in place
   char *telegram_{nullptr};
+  // Start of the plain text in telegram_, behind the header of a decrypted telegram
+  size_t telegram_offset_{0};
   size_t bytes_read_{0};
-  uint8_t *crypt_telegram_{nullptr};
   size_t crypt_telegram_len_{0};
   size_t crypt_bytes_read_{0};
   uint32_t last_read_time_{0};
@@ -3,11 +3,16 @@
 #include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
+// Datagrams handled per socket and loop, enough to drain a frame of many universes without starving other components
+static const uint8_t MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -15,64 +20,155 @@ E131Component::~E131Component() {
   if (this->socket_) {
     this->socket_->close();
   }
+  if (this->ddp_socket_) {
+    this->ddp_socket_->close();
+  }
 }
 
-void E131Component::setup() {
-  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+std::unique_ptr<socket::Socket> E131Component::bind_socket_(uint16_t port) {
+  auto sock = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return nullptr;
+  }
 
   int enable = 1;
-  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  int err = sock->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
     // we can still continue
   }
-  err = this->socket_->setblocking(false);
+  err = sock->setblocking(false);
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
   struct sockaddr_storage server;
 
-  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), port);
   if (sl == 0) {
     ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
-  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  err = sock->bind((struct sockaddr *) &server, sizeof(server));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    return nullptr;
+  }
+  return sock;
+}
+
+void E131Component::setup() {
+  this->socket_ = this->bind_socket_(PORT);
+  if (this->socket_ == nullptr) {
     this->mark_failed();
     return;
   }
+  if (this->ddp_) {
+    this->ddp_socket_ = this->bind_socket_(DDP_PORT);
+    if (this->ddp_socket_ == nullptr) {
+      this->mark_failed();
+      return;
+    }
+  }
 
   join_igmp_groups_();
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
+  this->read_e131_();
+  if (this->ddp_socket_ != nullptr)
+    this->read_ddp_();
+}
+
+void E131Component::read_e131_() {
   E131Packet packet;
   int universe = 0;
+  uint8_t sequence = 0;
   uint8_t buf[1460];
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
+  // Packets are parsed in place and drained as long as they keep coming, one per loop can't keep up with several
+  // universes at full frame rate
+  for (uint8_t i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0)
+      return;
+
+    if (!this->packet_(buf, len, universe, sequence, packet)) {
+      this->invalid_packets_++;
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    E131Universe *slot = this->find_universe_(universe);
+    if (slot != nullptr && !this->check_sequence_(*slot, sequence)) {
+      ESP_LOGV(TAG, "Discarded late packet %u for %d universe.", sequence, universe);
+      continue;
+    }
+
+    if (!this->process_(universe, packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    }
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
+}
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
+void E131Component::read_ddp_() {
+  uint32_t offset = 0;
+  const uint8_t *payload = nullptr;
+  uint16_t length = 0;
+  uint8_t buf[1460];
+
+  for (uint8_t i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->ddp_socket_->read(buf, sizeof(buf));
+    if (len <= 0)
+      return;
+
+    if (!this->ddp_packet_(buf, len, offset, payload, length)) {
+      this->invalid_packets_++;
+      ESP_LOGV(TAG, "Invalid DDP packet received of size %zd.", len);
+      continue;
+    }
+
+    if (!this->process_ddp_(offset, payload, length)) {
+      ESP_LOGV(TAG, "Ignored DDP packet for offset %" PRIu32 " of size %u.", offset, length);
+    }
   }
+}
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+void E131Component::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "E1.31:\n"
+                "  Method: %s\n"
+                "  DDP: %s",
+                this->listen_method_ == E131_MULTICAST ? "multicast" : "unicast", YESNO(this->ddp_));
+}
+
+bool E131Component::check_sequence_(E131Universe &slot, uint8_t sequence) {
+  if (!slot.has_sequence) {
+    slot.has_sequence = true;
+    slot.last_sequence = sequence;
+    return true;
+  }
+  // Like E1.31 section 6.7.2, a packet up to 20 behind the last one is late, anything further back is a restart
+  const int8_t diff = static_cast<int8_t>(sequence - slot.last_sequence);
+  if (diff <= 0 && diff > -20) {
+    this->dropped_packets_++;
+    return false;
   }
+  if (diff > 1)
+    this->dropped_packets_ += diff - 1;
+  slot.last_sequence = sequence;
+  return true;
+}
+
+E131Universe *E131Component::find_universe_(int universe) {
+  auto it = std::lower_bound(this->universes_.begin(), this->universes_.end(), universe,
+                             [](const E131Universe &slot, int value) { return slot.universe < value; });
+  if (it == this->universes_.end() || it->universe != universe)
+    return nullptr;
+  return &*it;
 }
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
@@ -117,6 +213,18 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+bool E131Component::process_ddp_(uint32_t offset, const uint8_t *data, uint16_t length) {
+  bool handled = false;
+
+  ESP_LOGV(TAG, "Received DDP packet for offset %" PRIu32 ", with %u bytes", offset, length);
+
+  for (auto *light_effect : light_effects_) {
+    handled = light_effect->process_ddp_(offset, data, length) || handled;
+  }
+
+  return handled;
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
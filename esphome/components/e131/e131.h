@@ -5,7 +5,6 @@
 #include "esphome/core/component.h"
 
 #include <cinttypes>
-#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -21,7 +20,16 @@ const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  /// Start code followed by the channel values, points into the received datagram
+  const uint8_t *values;
+};
+
+/// Entry of the universe table, kept sorted by universe.
+struct E131Universe {
+  uint16_t universe;
+  uint16_t consumers;
+  uint8_t last_sequence;
+  bool has_sequence;
 };
 
 class E131Component : public esphome::Component {
@@ -31,25 +39,45 @@ class E131Component : public esphome::Component {
 
   void setup() override;
   void loop() override;
+  void dump_config() override;
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
 
   void add_effect(E131AddressableLightEffect *light_effect);
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  /// Also receive DDP (Distributed Display Protocol) frames on UDP port 4048.
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
+
+  /// Packets lost or arrived out of order according to the sequence numbers of the senders.
+  uint32_t get_dropped_packets() const { return this->dropped_packets_; }
+  /// Datagrams that were neither valid E1.31 nor DDP.
+  uint32_t get_invalid_packets() const { return this->invalid_packets_; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  std::unique_ptr<socket::Socket> bind_socket_(uint16_t port);
+  void read_e131_();
+  void read_ddp_();
+  bool packet_(const uint8_t *data, size_t len, int &universe, uint8_t &sequence, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
+  bool ddp_packet_(const uint8_t *data, size_t len, uint32_t &offset, const uint8_t *&payload, uint16_t &length);
+  bool process_ddp_(uint32_t offset, const uint8_t *data, uint16_t length);
+  /// Track the sequence number of a universe, returns false when the packet is late and must be discarded.
+  bool check_sequence_(E131Universe &slot, uint8_t sequence);
+  E131Universe *find_universe_(int universe);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
   std::unique_ptr<socket::Socket> socket_;
+  std::unique_ptr<socket::Socket> ddp_socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
-  std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  std::vector<E131Universe> universes_;
+  uint32_t dropped_packets_{0};
+  uint32_t invalid_packets_{0};
+  uint8_t ddp_last_sequence_{0};
+  bool ddp_{false};
 };
 
 }  // namespace e131
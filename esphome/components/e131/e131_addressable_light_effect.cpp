@@ -7,7 +7,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -46,47 +46,49 @@ void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color
 }
 
 bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
-  auto *it = get_addressable_();
-
   // check if this is our universe and data are valid
   if (universe < first_universe_ || universe > get_last_universe())
     return false;
 
   int32_t output_offset = (universe - first_universe_) * get_lights_per_universe();
   // limit amount of lights per universe and received
-  int output_end =
-      std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
-  auto *input_data = packet.values + 1;
-
-  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
-           output_offset, output_end);
-
-  switch (channels_) {
-    case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
-      break;
-
-    case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
-      break;
-
-    case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
-      break;
+  int32_t count = std::min(get_lights_per_universe(), (packet.count - 1) / static_cast<int>(channels_));
+
+  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%" PRId32 ".", get_name().c_str(), universe,
+           output_offset, output_offset + count);
+
+  this->write_lights_(output_offset, packet.values + 1, count);
+  return true;
+}
+
+bool E131AddressableLightEffect::process_ddp_(uint32_t offset, const uint8_t *data, size_t len) {
+  // skip the rest of a light split by the previous packet
+  const uint32_t skip = (channels_ - offset % channels_) % channels_;
+  if (skip >= len)
+    return false;
+  const int32_t first_light = (offset + skip) / channels_;
+  if (first_light >= get_addressable_()->size())
+    return false;
+
+  this->write_lights_(first_light, data + skip, (len - skip) / channels_);
+  return true;
+}
+
+void E131AddressableLightEffect::write_lights_(int32_t first_light, const uint8_t *data, int32_t count) {
+  auto *it = get_addressable_();
+  const int32_t end = std::min(it->size(), first_light + count);
+
+  light::PixelBuffer buffer;
+  if (it->get_pixel_buffer(&buffer)) {
+    const light::ESPColorCorrection &correction = it->get_correction();
+    for (int32_t i = first_light; i < end; i++, data += channels_)
+      buffer.set(i, correction.color_correct(this->color_from_data_(data)));
+  } else {
+    for (int32_t i = first_light; i < end; i++, data += channels_)
+      (*it)[i].set(this->color_from_data_(data));
   }
 
   it->schedule_show();
-  return true;
 }
 
 }  // namespace e131
@@ -31,6 +31,21 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  /// Apply DDP pixel data starting at byte offset of the strip.
+  bool process_ddp_(uint32_t offset, const uint8_t *data, size_t len);
+  /// Write count lights of channel data starting at first_light, straight into the driver buffer when it has one.
+  void write_lights_(int32_t first_light, const uint8_t *data, int32_t count);
+  inline Color color_from_data_(const uint8_t *data) const {
+    switch (this->channels_) {
+      case E131_MONO:
+        return Color(data[0], data[0], data[0], data[0]);
+      case E131_RGBW:
+        return Color(data[0], data[1], data[2], data[3]);
+      case E131_RGB:
+      default:
+        return Color(data[0], data[1], data[2], (data[0] + data[1] + data[2]) / 3);
+    }
+  }
 
   int first_universe_{0};
   int last_universe_{0};
@@ -6,6 +6,8 @@
 #include "esphome/core/util.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+
 #include <lwip/igmp.h>
 #include <lwip/init.h>
 #include <lwip/ip4_addr.h>
@@ -55,6 +57,15 @@ union E131RawPacket {
   uint8_t raw[638];
 };
 
+static const size_t DDP_HEADER_SIZE = 10;
+static const uint8_t DDP_FLAGS_VERSION_MASK = 0xC0;
+static const uint8_t DDP_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAGS_TIMECODE = 0x10;
+static const uint8_t DDP_FLAGS_STORAGE = 0x08;
+static const uint8_t DDP_FLAGS_REPLY = 0x04;
+static const uint8_t DDP_FLAGS_QUERY = 0x02;
+static const uint8_t DDP_ID_DISPLAY = 1;
+
 // We need to have at least one `1` value
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
@@ -65,12 +76,12 @@ bool E131Component::join_igmp_groups_() {
   if (this->socket_ == nullptr)
     return false;
 
-  for (auto universe : universe_consumers_) {
-    if (!universe.second)
+  for (auto &slot : this->universes_) {
+    if (!slot.consumers)
       continue;
 
     ip4_addr_t multicast_addr =
-        network::IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff));
+        network::IPAddress(239, 255, ((slot.universe >> 8) & 0xff), ((slot.universe >> 0) & 0xff));
 
     err_t err;
     {
@@ -79,7 +90,7 @@ bool E131Component::join_igmp_groups_() {
     }
 
     if (err) {
-      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.first);
+      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", slot.universe);
     }
   }
 
@@ -87,8 +98,13 @@ bool E131Component::join_igmp_groups_() {
 }
 
 void E131Component::join_(int universe) {
-  // store only latest received packet for the given universe
-  auto consumers = ++universe_consumers_[universe];
+  E131Universe *slot = this->find_universe_(universe);
+  if (slot == nullptr) {
+    auto it = std::lower_bound(this->universes_.begin(), this->universes_.end(), universe,
+                               [](const E131Universe &entry, int value) { return entry.universe < value; });
+    slot = &*this->universes_.insert(it, E131Universe{static_cast<uint16_t>(universe), 0, 0, false});
+  }
+  auto consumers = ++slot->consumers;
 
   if (consumers > 1) {
     return;  // we already joined before
@@ -100,11 +116,16 @@ void E131Component::join_(int universe) {
 }
 
 void E131Component::leave_(int universe) {
-  auto consumers = --universe_consumers_[universe];
+  E131Universe *slot = this->find_universe_(universe);
+  if (slot == nullptr || slot->consumers == 0)
+    return;
+  auto consumers = --slot->consumers;
 
   if (consumers > 0) {
     return;  // we have other consumers of the given universe
   }
+  // start over with the sequence of the next sender
+  slot->has_sequence = false;
 
   if (listen_method_ == E131_MULTICAST) {
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
@@ -116,11 +137,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, uint8_t &sequence, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -134,11 +155,45 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
     return false;
 
   universe = htons(sbuff->universe);
+  sequence = sbuff->sequence_number;
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  // the values are used in place, they must all be in the datagram
+  if (E131_MIN_PACKET_SIZE - 1 + packet.count > len)
+    return false;
+
+  packet.values = sbuff->property_values;
+  return true;
+}
+
+bool E131Component::ddp_packet_(const uint8_t *data, size_t len, uint32_t &offset, const uint8_t *&payload,
+                                uint16_t &length) {
+  if (len < DDP_HEADER_SIZE || (data[0] & DDP_FLAGS_VERSION_MASK) != DDP_VERSION_1)
+    return false;
+  const uint8_t flags = data[0];
+  // status, configuration and storage requests are not supported
+  if (flags & (DDP_FLAGS_QUERY | DDP_FLAGS_REPLY | DDP_FLAGS_STORAGE))
+    return false;
+  if (data[3] != DDP_ID_DISPLAY)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  const size_t header_size = (flags & DDP_FLAGS_TIMECODE) ? DDP_HEADER_SIZE + 4 : DDP_HEADER_SIZE;
+  offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  length = encode_uint16(data[8], data[9]);
+  if (header_size + length > len)
+    return false;
+  payload = data + header_size;
+
+  // 4-bit sequence numbers, 0 when the sender does not use them
+  const uint8_t sequence = data[1] & 0x0F;
+  if (sequence != 0) {
+    if (this->ddp_last_sequence_ != 0) {
+      const uint8_t expected = this->ddp_last_sequence_ % 15 + 1;
+      this->dropped_packets_ += (sequence + 15 - expected) % 15;
+    }
+    this->ddp_last_sequence_ = sequence;
+  }
   return true;
 }
 
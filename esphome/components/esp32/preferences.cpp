@@ -4,6 +4,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/preferences.h"
 #include <nvs_flash.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <cstring>
 #include <cinttypes>
 #include <vector>
@@ -15,10 +17,26 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
+static const uint32_t WRITER_TASK_STACK_SIZE = 3072;
+static const UBaseType_t WRITER_TASK_PRIORITY = 1;
+
+class ESP32PreferenceBackend;
+
+static uint32_t blob_hash(const uint8_t *data, size_t len) {
+  // FNV-1a, only used to tell whether a blob differs from the one already in NVS
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
 struct NVSData {
   std::string key;
   std::unique_ptr<uint8_t[]> data;
   size_t len;
+  ESP32PreferenceBackend *backend;
 
   void set_data(const uint8_t *src, size_t size) {
     data = std::make_unique<uint8_t[]>(size);
@@ -28,11 +46,27 @@ struct NVSData {
 };
 
 static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Batch handed to the writer task. Guarded by s_writing_lock, s_writing_done is set once the task has written it and
+// whatever is left in s_writing at that point failed.
+static std::vector<NVSData> s_writing;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static bool s_writing_done = true;      // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static Mutex s_writing_lock;            // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
   std::string key;
   uint32_t nvs_handle;
+  // Hash and length of the blob in NVS, valid once it was loaded or written. Only touched from the main loop.
+  bool stored_known{false};
+  uint32_t stored_hash{0};
+  size_t stored_len{0};
+
+  void set_stored(const uint8_t *data, size_t len) {
+    this->stored_known = true;
+    this->stored_hash = blob_hash(data, len);
+    this->stored_len = len;
+  }
+
   bool save(const uint8_t *data, size_t len) override {
     // try find in pending saves and update that
     for (auto &obj : s_pending_save) {
@@ -41,8 +75,13 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
         return true;
       }
     }
+    if (this->stored_known && this->stored_len == len && this->stored_hash == blob_hash(data, len)) {
+      ESP_LOGVV(TAG, "NVS data not changed, not queueing key: %s", key.c_str());
+      return true;
+    }
     NVSData save{};
     save.key = key;
+    save.backend = this;
     save.set_data(data, len);
     s_pending_save.emplace_back(std::move(save));
     ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %zu", key.c_str(), len);
@@ -60,6 +99,8 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
         return true;
       }
     }
+    if (this->load_writing_(data, len))
+      return true;
 
     size_t actual_len;
     esp_err_t err = nvs_get_blob(nvs_handle, key.c_str(), nullptr, &actual_len);
@@ -78,8 +119,26 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
     } else {
       ESP_LOGVV(TAG, "nvs_get_blob: key: %s, len: %zu", key.c_str(), len);
     }
+    this->set_stored(data, len);
     return true;
   }
+
+ protected:
+  bool load_writing_(uint8_t *data, size_t len) {
+    // A batch that is still being written holds newer data than NVS
+    LockGuard guard(s_writing_lock);
+    if (s_writing_done)
+      return false;
+    for (auto &obj : s_writing) {
+      if (obj.key == key) {
+        if (obj.len != len)
+          return false;
+        memcpy(data, obj.data.get(), len);
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
 class ESP32Preferences : public ESPPreferences {
@@ -116,18 +175,117 @@ class ESP32Preferences : public ESPPreferences {
   }
 
   bool sync() override {
+    // Finish the batch the writer task may still be working on before the pending saves, so writes stay ordered
+    LockGuard guard(s_writing_lock);
+    bool success = this->collect_writing_();
     if (s_pending_save.empty())
-      return true;
+      return success;
 
     ESP_LOGV(TAG, "Saving %zu items...", s_pending_save.size());
+    for (auto &save : s_pending_save) {
+      if (save.backend != nullptr)
+        save.backend->set_stored(save.data.get(), save.len);
+    }
+    success &= this->write_items_(s_pending_save);
+    // Whatever is left failed, forget its hash so the next save queues it again
+    for (auto &save : s_pending_save) {
+      if (save.backend != nullptr)
+        save.backend->stored_known = false;
+    }
+    return success;
+  }
+
+  bool sync_async() override {
+    if (this->writer_task_ == nullptr &&
+        xTaskCreate(writer_task, "nvs_writer", WRITER_TASK_STACK_SIZE, (void *) this, WRITER_TASK_PRIORITY,
+                    &this->writer_task_) != pdPASS) {
+      this->writer_task_ = nullptr;
+      return this->sync();
+    }
+    if (s_pending_save.empty())
+      return this->writing_success_;
+    if (!s_writing_lock.try_lock())
+      return this->writing_success_;
+    if (!s_writing_done) {
+      // Previous batch not picked up yet, the pending saves go with the next one
+      s_writing_lock.unlock();
+      return this->writing_success_;
+    }
+    this->writing_success_ = this->collect_writing_();
+
+    ESP_LOGV(TAG, "Saving %zu items in the background...", s_pending_save.size());
+    // The hashes are taken now, a failed write clears them again in collect_writing_()
+    for (auto &save : s_pending_save) {
+      if (save.backend != nullptr)
+        save.backend->set_stored(save.data.get(), save.len);
+    }
+    s_writing = std::move(s_pending_save);
+    s_pending_save.clear();
+    s_writing_done = false;
+    s_writing_lock.unlock();
+    xTaskNotifyGive(this->writer_task_);
+    return this->writing_success_;
+  }
+
+  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
+    size_t actual_len;
+    esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
+    if (err != 0) {
+      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
+      return true;
+    }
+    // Check size first before allocating memory
+    if (actual_len != to_save.len) {
+      return true;
+    }
+    auto stored_data = std::make_unique<uint8_t[]>(actual_len);
+    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.get(), &actual_len);
+    if (err != 0) {
+      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
+      return true;
+    }
+    return memcmp(to_save.data.get(), stored_data.get(), to_save.len) != 0;
+  }
+
+  bool reset() override {
+    ESP_LOGD(TAG, "Erasing storage");
+    LockGuard guard(s_writing_lock);
+    s_pending_save.clear();
+    s_writing.clear();
+    s_writing_done = true;
+
+    nvs_flash_deinit();
+    nvs_flash_erase();
+    // Make the handle invalid to prevent any saves until restart
+    nvs_handle = 0;
+    return true;
+  }
+
+ protected:
+  static void writer_task(void *params) {
+    auto *prefs = static_cast<ESP32Preferences *>(params);
+    while (true) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      LockGuard guard(s_writing_lock);
+      // sync() may have written the batch already
+      if (s_writing_done)
+        continue;
+      prefs->write_items_(s_writing);
+      s_writing_done = true;
+    }
+  }
+
+  /// Write the items and commit once, the items that were written or turned out unchanged are removed.
+  /// Must hold s_writing_lock.
+  bool write_items_(std::vector<NVSData> &items) {
     // goal try write all pending saves even if one fails
     int cached = 0, written = 0, failed = 0;
     esp_err_t last_err = ESP_OK;
     std::string last_key{};
 
     // go through vector from back to front (makes erase easier/more efficient)
-    for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
+    for (ssize_t i = items.size() - 1; i >= 0; i--) {
+      const auto &save = items[i];
       ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
       if (is_changed(nvs_handle, save)) {
         esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.get(), save.len);
@@ -144,7 +302,7 @@ class ESP32Preferences : public ESPPreferences {
         ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%zu", save.key.c_str(), save.len);
         cached++;
       }
-      s_pending_save.erase(s_pending_save.begin() + i);
+      items.erase(items.begin() + i);
     }
     ESP_LOGD(TAG, "Writing %d items: %d cached, %d written, %d failed", cached + written + failed, cached, written,
              failed);
@@ -162,36 +320,36 @@ class ESP32Preferences : public ESPPreferences {
 
     return failed == 0;
   }
-  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
-    size_t actual_len;
-    esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
-      return true;
-    }
-    // Check size first before allocating memory
-    if (actual_len != to_save.len) {
-      return true;
+
+  /// Finish the batch handed to the writer task, writing it here if the task has not started on it. Failed items go
+  /// back to the pending saves unless a newer save of the same key is already waiting there. Must hold
+  /// s_writing_lock.
+  bool collect_writing_() {
+    if (!s_writing_done) {
+      this->write_items_(s_writing);
+      s_writing_done = true;
     }
-    auto stored_data = std::make_unique<uint8_t[]>(actual_len);
-    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.get(), &actual_len);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
+    if (s_writing.empty())
       return true;
+    for (auto &failed : s_writing) {
+      if (failed.backend != nullptr)
+        failed.backend->stored_known = false;
+      bool pending = false;
+      for (auto &obj : s_pending_save) {
+        if (obj.key == failed.key) {
+          pending = true;
+          break;
+        }
+      }
+      if (!pending)
+        s_pending_save.emplace_back(std::move(failed));
     }
-    return memcmp(to_save.data.get(), stored_data.get(), to_save.len) != 0;
+    s_writing.clear();
+    return false;
   }
 
-  bool reset() override {
-    ESP_LOGD(TAG, "Erasing storage");
-    s_pending_save.clear();
-
-    nvs_flash_deinit();
-    nvs_flash_erase();
-    // Make the handle invalid to prevent any saves until restart
-    nvs_handle = 0;
-    return true;
-  }
+  TaskHandle_t writer_task_{nullptr};
+  bool writing_success_{true};
 };
 
 void setup_preferences() {
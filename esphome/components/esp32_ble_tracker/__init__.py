@@ -31,7 +31,7 @@ from esphome.const import (
     CONF_SERVICE_UUID,
     CONF_TRIGGER_ID,
 )
-from esphome.core import CORE, CoroPriority, coroutine_with_priority
+from esphome.core import CORE, CoroPriority, MACAddress, coroutine_with_priority
 from esphome.enum import StrEnum
 from esphome.types import ConfigType
 
@@ -42,6 +42,7 @@ CODEOWNERS = ["@bdraco"]
 CONF_ESP32_BLE_ID = "esp32_ble_id"
 CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
+CONF_BUSY_WINDOW = "busy_window"
 CONF_ON_SCAN_END = "on_scan_end"
 CONF_SOFTWARE_COEXISTENCE = "software_coexistence"
 
@@ -133,6 +134,13 @@ def validate_scan_parameters(config):
             f"Scan window ({window}) needs to be smaller than scan interval ({interval})"
         )
 
+    busy_window = config.get(CONF_BUSY_WINDOW)
+    if busy_window is not None and busy_window > window:
+        raise cv.Invalid(
+            f"Busy scan window ({busy_window}) needs to be smaller than scan window "
+            f"({window})"
+        )
+
     if interval.total_milliseconds * 3 > duration.total_milliseconds:
         raise cv.Invalid(
             "Scan duration needs to be at least three times the scan interval to"
@@ -193,6 +201,11 @@ CONFIG_SCHEMA = cv.All(
                         cv.Optional(
                             CONF_WINDOW, default="30ms"
                         ): cv.positive_time_period_milliseconds,
+                        # Scan window while GATT connections or the network need
+                        # the shared radio
+                        cv.Optional(
+                            CONF_BUSY_WINDOW
+                        ): cv.positive_time_period_milliseconds,
                         cv.Optional(CONF_ACTIVE, default=True): cv.boolean,
                         cv.Optional(CONF_CONTINUOUS, default=True): cv.boolean,
                     }
@@ -266,6 +279,10 @@ async def to_code(config):
     cg.add(var.set_scan_duration(params[CONF_DURATION]))
     cg.add(var.set_scan_interval(int(params[CONF_INTERVAL].total_milliseconds / 0.625)))
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
+    if CONF_BUSY_WINDOW in params:
+        cg.add_define("USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN")
+        busy_window = int(params[CONF_BUSY_WINDOW].total_milliseconds / 0.625)
+        cg.add(var.set_busy_scan_window(busy_window))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
 
@@ -285,6 +302,8 @@ async def to_code(config):
         if CONF_MAC_ADDRESS in conf:
             addr_list = [it.as_hex for it in conf[CONF_MAC_ADDRESS]]
             cg.add(trigger.set_addresses(addr_list))
+            for addr in addr_list:
+                cg.add(var.add_address_filter(trigger, addr))
         await automation.build_automation(trigger, [(ESPBTDeviceConstRef, "x")], conf)
     for conf in config.get(CONF_ON_BLE_SERVICE_DATA_ADVERTISE, []):
         registration_counts.listeners += 1
@@ -298,6 +317,11 @@ async def to_code(config):
             cg.add(trigger.set_service_uuid128(uuid128))
         if CONF_MAC_ADDRESS in conf:
             cg.add(trigger.set_address(conf[CONF_MAC_ADDRESS].as_hex))
+            cg.add(var.add_address_filter(trigger, conf[CONF_MAC_ADDRESS].as_hex))
+        elif len(conf[CONF_SERVICE_UUID]) == len(bt_uuid16_format):
+            cg.add(
+                var.add_service_data_filter(trigger, as_hex(conf[CONF_SERVICE_UUID]))
+            )
         await automation.build_automation(trigger, [(adv_data_t_const_ref, "x")], conf)
     for conf in config.get(CONF_ON_BLE_MANUFACTURER_DATA_ADVERTISE, []):
         registration_counts.listeners += 1
@@ -311,6 +335,11 @@ async def to_code(config):
             cg.add(trigger.set_manufacturer_uuid128(uuid128))
         if CONF_MAC_ADDRESS in conf:
             cg.add(trigger.set_address(conf[CONF_MAC_ADDRESS].as_hex))
+            cg.add(var.add_address_filter(trigger, conf[CONF_MAC_ADDRESS].as_hex))
+        elif len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid16_format):
+            cg.add(
+                var.add_manufacturer_filter(trigger, as_hex(conf[CONF_MANUFACTURER_ID]))
+            )
         await automation.build_automation(trigger, [(adv_data_t_const_ref, "x")], conf)
     for conf in config.get(CONF_ON_SCAN_END, []):
         registration_counts.listeners += 1
@@ -406,12 +435,29 @@ async def esp32_ble_tracker_stop_scan_action_to_code(
 
 
 async def register_ble_device(
-    var: cg.SafeExpType, config: ConfigType
+    var: cg.SafeExpType,
+    config: ConfigType,
+    *,
+    service_data_uuids: list[int] | None = None,
+    manufacturer_ids: list[int] | None = None,
 ) -> cg.SafeExpType:
+    """Register a device listener with the tracker.
+
+    The tracker only hands the listener advertisements matching one of its filters:
+    the single mac_address of the config, and the given 16-bit service data UUIDs and
+    manufacturer company IDs. Without any of them it receives every advertisement.
+    """
     register_ble_features({BLEFeatures.ESP_BT_DEVICE})
     _get_registration_counts().listeners += 1
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    mac_address = config.get(CONF_MAC_ADDRESS)
+    if isinstance(mac_address, MACAddress):
+        cg.add(paren.add_address_filter(var, mac_address.as_hex))
+    for uuid in service_data_uuids or []:
+        cg.add(paren.add_service_data_filter(var, uuid))
+    for company_id in manufacturer_ids or []:
+        cg.add(paren.add_manufacturer_filter(var, company_id))
     return var
 
 
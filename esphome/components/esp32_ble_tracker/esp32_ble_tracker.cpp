@@ -17,7 +17,9 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 #ifdef USE_OTA
 #include "esphome/components/ota/ota_backend.h"
@@ -37,6 +39,14 @@ namespace esphome::esp32_ble_tracker {
 
 static const char *const TAG = "esp32_ble_tracker";
 
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+// How long the busy scan window is kept after radio demand was last reported
+static const uint32_t RADIO_DEMAND_HOLD_MS = 10000;
+#endif
+#ifdef USE_SENSOR
+static const uint32_t SCAN_STATS_INTERVAL_MS = 60000;
+#endif
+
 ESP32BLETracker *global_esp32_ble_tracker = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 const char *client_state_to_string(ClientState state) {
@@ -132,10 +142,18 @@ void ESP32BLETracker::loop() {
   ClientStateCounts counts = this->count_client_states_();
   if (counts != this->client_state_counts_) {
     this->client_state_counts_ = counts;
-    ESP_LOGD(TAG, "connecting: %d, discovered: %d, disconnecting: %d", this->client_state_counts_.connecting,
-             this->client_state_counts_.discovered, this->client_state_counts_.disconnecting);
+    ESP_LOGD(TAG, "connecting: %d, discovered: %d, disconnecting: %d, connected: %d",
+             this->client_state_counts_.connecting, this->client_state_counts_.discovered,
+             this->client_state_counts_.disconnecting, this->client_state_counts_.connected);
   }
 
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  this->update_adaptive_scan_(counts, App.get_loop_component_start_time());
+#endif
+#ifdef USE_SENSOR
+  this->publish_scan_stats_(App.get_loop_component_start_time());
+#endif
+
   if (this->scanner_state_ == ScannerState::FAILED ||
       (this->scan_set_param_failed_ && this->scanner_state_ == ScannerState::RUNNING)) {
     this->handle_scanner_failure_();
@@ -175,6 +193,47 @@ void ESP32BLETracker::loop() {
 
 void ESP32BLETracker::start_scan() { this->start_scan_(true); }
 
+void ESP32BLETracker::report_radio_demand() {
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  this->last_radio_demand_ = millis();
+  this->radio_demand_ = true;
+#endif
+}
+
+float ESP32BLETracker::get_scan_duty_cycle() const {
+  if (this->scanner_state_ != ScannerState::RUNNING || this->scan_params_.scan_interval == 0)
+    return 0.0f;
+  return this->scan_params_.scan_window * 100.0f / this->scan_params_.scan_interval;
+}
+
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+void ESP32BLETracker::update_adaptive_scan_(const ClientStateCounts &counts, uint32_t now) {
+  if (this->radio_demand_ && now - this->last_radio_demand_ > RADIO_DEMAND_HOLD_MS)
+    this->radio_demand_ = false;
+  const bool busy = this->radio_demand_ || counts.connected != 0;
+  if (busy == this->scan_busy_ || this->scanner_state_ != ScannerState::RUNNING || !this->scan_continuous_ ||
+      counts.connecting || counts.discovered || counts.disconnecting)
+    return;
+  // The scan parameters only apply to a new scan, the loop starts it again once this one stopped
+  ESP_LOGD(TAG, "Radio %s, restarting scan", busy ? "busy" : "idle");
+  this->stop_scan_();
+}
+#endif
+
+#ifdef USE_SENSOR
+void ESP32BLETracker::publish_scan_stats_(uint32_t now) {
+  const uint32_t elapsed = now - this->last_stats_time_;
+  if (elapsed < SCAN_STATS_INTERVAL_MS)
+    return;
+  if (this->advertisement_rate_sensor_ != nullptr)
+    this->advertisement_rate_sensor_->publish_state(this->advertisement_count_ * 1000.0f / elapsed);
+  if (this->scan_duty_cycle_sensor_ != nullptr)
+    this->scan_duty_cycle_sensor_->publish_state(this->get_scan_duty_cycle());
+  this->advertisement_count_ = 0;
+  this->last_stats_time_ = now;
+}
+#endif
+
 void ESP32BLETracker::stop_scan() {
   ESP_LOGD(TAG, "Stopping scan.");
   this->scan_continuous_ = false;
@@ -223,6 +282,13 @@ void ESP32BLETracker::start_scan_(bool first) {
   this->scan_params_.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
   this->scan_params_.scan_interval = this->scan_interval_;
   this->scan_params_.scan_window = this->scan_window_;
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  this->scan_busy_ = this->radio_demand_ || this->count_client_states_().connected != 0;
+  if (this->scan_busy_) {
+    this->scan_params_.scan_window = std::min(this->busy_scan_window_, this->scan_window_);
+    ESP_LOGD(TAG, "Radio busy, scan window %.1f ms", this->scan_params_.scan_window * 0.625f);
+  }
+#endif
 
   // Start timeout monitoring in loop() instead of using scheduler
   // This prevents false reboots when the loop is blocked
@@ -253,10 +319,90 @@ void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
 #ifdef ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT
   listener->set_parent(this);
   this->listeners_.push_back(listener);
+#ifdef USE_ESP32_BLE_DEVICE
+  this->unfiltered_listeners_.push_back(listener);
+#endif
   this->recalculate_advertisement_parser_types();
 #endif
 }
 
+#if defined(ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT) && defined(USE_ESP32_BLE_DEVICE)
+// 00000000-0000-1000-8000-00805F9B34FB in over-the-air byte order, without the 32-bit value at the end
+static const uint8_t BLUETOOTH_BASE_UUID[12] = {0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00};
+
+void ESP32BLETracker::add_address_filter(ESPBTDeviceListener *listener, uint64_t address) {
+  this->add_filtered_(this->address_index_[address], listener);
+}
+
+void ESP32BLETracker::add_service_data_filter(ESPBTDeviceListener *listener, uint16_t uuid) {
+  this->add_filtered_(this->service_data_index_[uuid], listener);
+}
+
+void ESP32BLETracker::add_manufacturer_filter(ESPBTDeviceListener *listener, uint16_t company_id) {
+  this->add_filtered_(this->manufacturer_index_[company_id], listener);
+}
+
+void ESP32BLETracker::add_filtered_(std::vector<ESPBTDeviceListener *> &index, ESPBTDeviceListener *listener) {
+  if (std::find(index.begin(), index.end(), listener) == index.end())
+    index.push_back(listener);
+  auto &unfiltered = this->unfiltered_listeners_;
+  unfiltered.erase(std::remove(unfiltered.begin(), unfiltered.end(), listener), unfiltered.end());
+}
+
+void ESP32BLETracker::add_matching_(const std::vector<ESPBTDeviceListener *> &index) {
+  for (auto *listener : index) {
+    if (std::find(this->matched_listeners_.begin(), this->matched_listeners_.end(), listener) ==
+        this->matched_listeners_.end())
+      this->matched_listeners_.push_back(listener);
+  }
+}
+
+bool ESP32BLETracker::dispatch_to_listeners_(const ESPBTDevice &device) {
+  bool found = false;
+  for (auto *listener : this->unfiltered_listeners_) {
+    if (listener->parse_device(device))
+      found = true;
+  }
+
+  this->matched_listeners_.clear();
+  if (!this->address_index_.empty()) {
+    auto it = this->address_index_.find(device.address_uint64());
+    if (it != this->address_index_.end())
+      this->add_matching_(it->second);
+  }
+  if (!this->service_data_index_.empty() || !this->manufacturer_index_.empty()) {
+    device.for_each_record([this](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+      const std::unordered_map<uint16_t, std::vector<ESPBTDeviceListener *>> *index = &this->service_data_index_;
+      if (record_type == ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE) {
+        index = &this->manufacturer_index_;
+      } else if (record_type == ESP_BLE_AD_TYPE_32SERVICE_DATA) {
+        // 32-bit UUIDs still match a 16-bit filter when their upper half is zero
+        if (record_length < 4 || record[2] != 0 || record[3] != 0)
+          return true;
+      } else if (record_type == ESP_BLE_AD_TYPE_128SERVICE_DATA) {
+        // As do 128-bit UUIDs derived from the Bluetooth base UUID
+        if (record_length < 16 || memcmp(record, BLUETOOTH_BASE_UUID, 12) != 0 || record[14] != 0 || record[15] != 0)
+          return true;
+        record += 12;
+      } else if (record_type != ESP_BLE_AD_TYPE_SERVICE_DATA) {
+        return true;
+      }
+      if (record_length < 2)
+        return true;
+      auto it = index->find(encode_uint16(record[1], record[0]));
+      if (it != index->end())
+        this->add_matching_(it->second);
+      return true;
+    });
+  }
+  for (auto *listener : this->matched_listeners_) {
+    if (listener->parse_device(device))
+      found = true;
+  }
+  return found;
+}
+#endif
+
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
@@ -310,6 +456,9 @@ void ESP32BLETracker::gap_scan_event_handler(const BLEScanResult &scan_result) {
   ESP_LOGVV(TAG, "gap_scan_result - event %d", scan_result.search_evt);
 
   if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
+#ifdef USE_SENSOR
+    this->advertisement_count_++;
+#endif
     // Process the scan result immediately
     this->process_scan_result_(scan_result);
   } else if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
@@ -394,9 +543,15 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
   this->address_type_ = static_cast<esp_ble_addr_type_t>(scan_result.ble_addr_type);
   this->rssi_ = scan_result.rssi;
 
-  // Parse advertisement data directly
-  uint8_t total_len = scan_result.adv_data_len + scan_result.scan_rsp_len;
-  this->parse_adv_(scan_result.ble_adv, total_len);
+  // The advertisement records are only parsed when asked for
+  this->parsed_ = 0;
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "Parse Result:");
@@ -422,20 +577,20 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
             this->address_[2], this->address_[3], this->address_[4], this->address_[5], address_type);
 
   ESP_LOGVV(TAG, "  RSSI: %d", this->rssi_);
-  ESP_LOGVV(TAG, "  Name: '%s'", this->name_.c_str());
-  for (auto &it : this->tx_powers_) {
+  ESP_LOGVV(TAG, "  Name: '%s'", this->get_name().c_str());
+  for (auto &it : this->get_tx_powers()) {
     ESP_LOGVV(TAG, "  TX Power: %d", it);
   }
-  if (this->appearance_.has_value()) {
+  if (this->get_appearance().has_value()) {
     ESP_LOGVV(TAG, "  Appearance: %u", *this->appearance_);
   }
-  if (this->ad_flag_.has_value()) {
+  if (this->get_ad_flag().has_value()) {
     ESP_LOGVV(TAG, "  Ad Flag: %u", *this->ad_flag_);
   }
-  for (auto &uuid : this->service_uuids_) {
+  for (auto &uuid : this->get_service_uuids()) {
     ESP_LOGVV(TAG, "  Service UUID: %s", uuid.to_string().c_str());
   }
-  for (auto &data : this->manufacturer_datas_) {
+  for (auto &data : this->get_manufacturer_datas()) {
     auto ibeacon = ESPBLEiBeacon::from_manufacturer_data(data);
     if (ibeacon.has_value()) {
       ESP_LOGVV(TAG, "  Manufacturer iBeacon:");
@@ -448,7 +603,7 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
                 format_hex_pretty(data.data).c_str());
     }
   }
-  for (auto &data : this->service_datas_) {
+  for (auto &data : this->get_service_datas()) {
     ESP_LOGVV(TAG, "  Service data:");
     ESP_LOGVV(TAG, "    UUID: %s", data.uuid.to_string().c_str());
     ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data).c_str());
@@ -459,21 +614,9 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
 #endif
 }
 
-void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
-  size_t offset = 0;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
-
+void ESPBTDevice::parse_adv_(uint8_t fields) const {
+  this->parsed_ |= fields;
+  this->for_each_record([this, fields](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
     // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
@@ -489,7 +632,7 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // SHORTENED LOCAL NAME
         // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
         // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
-        if (record_length > this->name_.length()) {
+        if ((fields & PARSED_NAME) && record_length > this->name_.length()) {
           this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
         }
         break;
@@ -498,7 +641,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        if (fields & PARSED_TX_POWERS)
+          this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -507,7 +651,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // See also https://www.bluetooth.com/specifications/gatt/characteristics/
         // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
         // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+        if (fields & PARSED_FLAGS)
+          this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
         break;
       }
       case ESP_BLE_AD_TYPE_FLAG: {
@@ -516,7 +661,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
         // omitted."
         // CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->ad_flag_ = *record;
+        if (fields & PARSED_FLAGS)
+          this->ad_flag_ = *record;
         break;
       }
       // CSS 1.1 SERVICE UUID
@@ -526,6 +672,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
       case ESP_BLE_AD_TYPE_16SRV_CMPL:
       case ESP_BLE_AD_TYPE_16SRV_PART: {
         // • 16-bit Bluetooth Service UUIDs
+        if (!(fields & PARSED_SERVICE_UUIDS))
+          break;
         for (uint8_t i = 0; i < record_length / 2; i++) {
           this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
         }
@@ -534,6 +682,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
       case ESP_BLE_AD_TYPE_32SRV_CMPL:
       case ESP_BLE_AD_TYPE_32SRV_PART: {
         // • 32-bit Bluetooth Service UUIDs
+        if (!(fields & PARSED_SERVICE_UUIDS))
+          break;
         for (uint8_t i = 0; i < record_length / 4; i++) {
           this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
         }
@@ -542,7 +692,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
       case ESP_BLE_AD_TYPE_128SRV_CMPL:
       case ESP_BLE_AD_TYPE_128SRV_PART: {
         // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+        if (fields & PARSED_SERVICE_UUIDS)
+          this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
         break;
       }
       case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
@@ -551,6 +702,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
         // shall be defined by the manufacturer specified by the company identifier."
         // CSS 1: Optional in this context (may appear more than once in a block).
+        if (!(fields & PARSED_MANUFACTURER_DATAS))
+          break;
         if (record_length < 2) {
           ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
           break;
@@ -566,6 +719,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
       // "The Service Data data type consists of a service UUID with the data associated with that service."
       // CSS 1: Optional in this context (may appear more than once in a block).
       case ESP_BLE_AD_TYPE_SERVICE_DATA: {
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         // «Service Data - 16 bit UUID»
         // Size: 2 or more octets
         // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
@@ -580,6 +735,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         break;
       }
       case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         // «Service Data - 32 bit UUID»
         // Size: 4 or more octets
         // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
@@ -594,6 +751,8 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         break;
       }
       case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         // «Service Data - 128 bit UUID»
         // Size: 16 or more octets
         // The first 16 octets contain the 128 bit Service UUID followed by additional service data
@@ -615,7 +774,86 @@ void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
         break;
       }
     }
-  }
+    return true;
+  });
+}
+
+bool ESPBTDevice::has_service_uuid(const ESPBTUUID &uuid) const {
+  bool found = false;
+  this->for_each_record([&uuid, &found](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+    switch (record_type) {
+      case ESP_BLE_AD_TYPE_16SRV_CMPL:
+      case ESP_BLE_AD_TYPE_16SRV_PART:
+        for (uint8_t i = 0; !found && i < record_length / 2; i++)
+          found = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)) == uuid;
+        break;
+      case ESP_BLE_AD_TYPE_32SRV_CMPL:
+      case ESP_BLE_AD_TYPE_32SRV_PART:
+        for (uint8_t i = 0; !found && i < record_length / 4; i++)
+          found = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)) == uuid;
+        break;
+      case ESP_BLE_AD_TYPE_128SRV_CMPL:
+      case ESP_BLE_AD_TYPE_128SRV_PART:
+        found = record_length >= 16 && ESPBTUUID::from_raw(record) == uuid;
+        break;
+      default:
+        break;
+    }
+    return !found;
+  });
+  return found;
+}
+
+optional<ServiceDataRef> ESPBTDevice::find_manufacturer_data(const ESPBTUUID &uuid) const {
+  optional<ServiceDataRef> result{};
+  this->for_each_record([&uuid, &result](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+    if (record_type != ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE || record_length < 2)
+      return true;
+    auto id = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+    if (!(id == uuid))
+      return true;
+    result = ServiceDataRef{id, record + 2, static_cast<uint8_t>(record_length - 2)};
+    return false;
+  });
+  return result;
+}
+
+optional<ServiceDataRef> ESPBTDevice::find_service_data(const ESPBTUUID &uuid) const {
+  optional<ServiceDataRef> result{};
+  this->for_each_record([&uuid, &result](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+    ESPBTUUID id;
+    uint8_t uuid_length;
+    if (record_type == ESP_BLE_AD_TYPE_SERVICE_DATA && record_length >= 2) {
+      id = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+      uuid_length = 2;
+    } else if (record_type == ESP_BLE_AD_TYPE_32SERVICE_DATA && record_length >= 4) {
+      id = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
+      uuid_length = 4;
+    } else if (record_type == ESP_BLE_AD_TYPE_128SERVICE_DATA && record_length >= 16) {
+      id = ESPBTUUID::from_raw(record);
+      uuid_length = 16;
+    } else {
+      return true;
+    }
+    if (!(id == uuid))
+      return true;
+    result = ServiceDataRef{id, record + uuid_length, static_cast<uint8_t>(record_length - uuid_length)};
+    return false;
+  });
+  return result;
+}
+
+optional<ESPBLEiBeacon> ESPBTDevice::get_ibeacon() const {
+  optional<ESPBLEiBeacon> result{};
+  this->for_each_record([&result](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+    // Apple company identifier, followed by the 23 bytes of beacon data
+    if (record_type != ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE || record_length != 25 || record[0] != 0x4C ||
+        record[1] != 0x00)
+      return true;
+    result = ESPBLEiBeacon(record + 2);
+    return false;
+  });
+  return result;
 }
 
 std::string ESPBTDevice::address_str() const {
@@ -637,9 +875,13 @@ void ESP32BLETracker::dump_config() {
                 "  Continuous Scanning: %s",
                 this->scan_duration_, this->scan_interval_ * 0.625f, this->scan_window_ * 0.625f,
                 this->scan_active_ ? "ACTIVE" : "PASSIVE", YESNO(this->scan_continuous_));
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  ESP_LOGCONFIG(TAG, "  Busy Scan Window: %.1f ms", this->busy_scan_window_ * 0.625f);
+#endif
   ESP_LOGCONFIG(TAG, "  Scanner State: %s", this->scanner_state_to_string_(this->scanner_state_));
-  ESP_LOGCONFIG(TAG, "  Connecting: %d, discovered: %d, disconnecting: %d", this->client_state_counts_.connecting,
-                this->client_state_counts_.discovered, this->client_state_counts_.disconnecting);
+  ESP_LOGCONFIG(TAG, "  Connecting: %d, discovered: %d, disconnecting: %d, connected: %d",
+                this->client_state_counts_.connecting, this->client_state_counts_.discovered,
+                this->client_state_counts_.disconnecting, this->client_state_counts_.connected);
   if (this->scan_start_fail_count_) {
     ESP_LOGCONFIG(TAG, "  Scan Start Fail Count: %d", this->scan_start_fail_count_);
   }
@@ -742,10 +984,8 @@ void ESP32BLETracker::process_scan_result_(const BLEScanResult &scan_result) {
 
     bool found = false;
 #ifdef ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT
-    for (auto *listener : this->listeners_) {
-      if (listener->parse_device(device))
-        found = true;
-    }
+    if (this->dispatch_to_listeners_(device))
+      found = true;
 #endif
 
 #ifdef ESPHOME_ESP32_BLE_TRACKER_CLIENT_COUNT
@@ -7,6 +7,7 @@
 
 #include <array>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifdef USE_ESP32
@@ -22,6 +23,10 @@
 #include "esphome/components/esp32_ble/ble_uuid.h"
 #include "esphome/components/esp32_ble/ble_scan_result.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
 namespace esphome::esp32_ble_tracker {
 
 using namespace esp32_ble;
@@ -63,6 +68,18 @@ class ESPBLEiBeacon {
   } PACKED beacon_data_;
 };
 
+/// Manufacturer or service data of an advertisement, pointing into the scan result it was found in.
+struct ServiceDataRef {
+  ESPBTUUID uuid;
+  const uint8_t *data;
+  uint8_t length;
+
+  adv_data_t to_vector() const { return adv_data_t(this->data, this->data + this->length); }
+};
+
+/// A view of one scan result. Only the address, address type and RSSI are copied out, the advertisement records
+/// are parsed on first use of each accessor. The find_ and has_ lookups walk the raw data without allocating.
+/// A device must not outlive the scan result it was parsed from.
 class ESPBTDevice {
  public:
   void parse_scan_rst(const BLEScanResult &scan_result);
@@ -75,48 +92,104 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  const std::string &get_name() const {
+    this->parse_(PARSED_NAME);
+    return this->name_;
+  }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->parse_(PARSED_TX_POWERS);
+    return tx_powers_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const optional<uint16_t> &get_appearance() const {
+    this->parse_(PARSED_FLAGS);
+    return appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->parse_(PARSED_FLAGS);
+    return ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->parse_(PARSED_SERVICE_UUIDS);
+    return service_uuids_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->parse_(PARSED_MANUFACTURER_DATAS);
+    return manufacturer_datas_;
+  }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->parse_(PARSED_SERVICE_DATAS);
+    return service_datas_;
+  }
+
+  /// True if the service UUID is advertised.
+  bool has_service_uuid(const ESPBTUUID &uuid) const;
+  /// The first manufacturer data record with the given company identifier.
+  optional<ServiceDataRef> find_manufacturer_data(const ESPBTUUID &uuid) const;
+  /// The first service data record for the given service.
+  optional<ServiceDataRef> find_service_data(const ESPBTUUID &uuid) const;
 
   // Exposed through a function for use in lambdas
   const BLEScanResult &get_scan_result() const { return *scan_result_; }
 
   bool resolve_irk(const uint8_t *irk) const;
 
-  optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
-      auto res = ESPBLEiBeacon::from_manufacturer_data(it);
-      if (res.has_value())
-        return *res;
+  optional<ESPBLEiBeacon> get_ibeacon() const;
+
+  /// Call callback(type, record, length) for each AD structure until it returns false.
+  template<typename F> void for_each_record(F &&callback) const {
+    if (this->scan_result_ == nullptr)
+      return;
+    const uint8_t *payload = this->scan_result_->ble_adv;
+    const size_t len = this->scan_result_->adv_data_len + this->scan_result_->scan_rsp_len;
+    size_t offset = 0;
+    while (offset + 2 < len) {
+      const uint8_t field_length = payload[offset++];  // First byte is length of adv record
+      if (field_length == 0) {
+        continue;  // Possible zero padded advertisement data
+      }
+      // first byte of adv record is adv record type
+      const uint8_t record_type = payload[offset++];
+      const uint8_t *record = &payload[offset];
+      const uint8_t record_length = field_length - 1;
+      offset += record_length;
+      if (offset > len || !callback(record_type, record, record_length))
+        return;
     }
-    return {};
   }
 
  protected:
-  void parse_adv_(const uint8_t *payload, uint8_t len);
+  // Fields of the advertisement filled in by parse_adv_()
+  static constexpr uint8_t PARSED_NAME = 1 << 0;
+  static constexpr uint8_t PARSED_TX_POWERS = 1 << 1;
+  static constexpr uint8_t PARSED_FLAGS = 1 << 2;  // appearance and AD flags
+  static constexpr uint8_t PARSED_SERVICE_UUIDS = 1 << 3;
+  static constexpr uint8_t PARSED_MANUFACTURER_DATAS = 1 << 4;
+  static constexpr uint8_t PARSED_SERVICE_DATAS = 1 << 5;
+
+  void parse_(uint8_t fields) const {
+    if ((this->parsed_ & fields) != fields)
+      this->parse_adv_(fields & ~this->parsed_);
+  }
+  void parse_adv_(uint8_t fields) const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_{};
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
   const BLEScanResult *scan_result_{nullptr};
+  mutable uint8_t parsed_{0};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_{};
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
 };
 #endif  // USE_ESP32_BLE_DEVICE
 
@@ -142,9 +215,11 @@ struct ClientStateCounts {
   uint8_t connecting = 0;
   uint8_t discovered = 0;
   uint8_t disconnecting = 0;
+  uint8_t connected = 0;  // connected or established
 
   bool operator==(const ClientStateCounts &other) const {
-    return connecting == other.connecting && discovered == other.discovered && disconnecting == other.disconnecting;
+    return connecting == other.connecting && discovered == other.discovered && disconnecting == other.disconnecting &&
+           connected == other.connected;
   }
 
   bool operator!=(const ClientStateCounts &other) const { return !(*this == other); }
@@ -239,6 +314,20 @@ class ESP32BLETracker : public Component,
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   bool get_scan_active() const { return scan_active_; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  /// Scan window used while a GATT connection or the network needs the radio.
+  void set_busy_scan_window(uint32_t busy_scan_window) { busy_scan_window_ = busy_scan_window; }
+#endif
+#ifdef USE_SENSOR
+  void set_advertisement_rate_sensor(sensor::Sensor *sensor) { advertisement_rate_sensor_ = sensor; }
+  void set_scan_duty_cycle_sensor(sensor::Sensor *sensor) { scan_duty_cycle_sensor_ = sensor; }
+#endif
+
+  /// Tell the scanner that the shared radio is needed for something else, like network traffic backing up.
+  /// With adaptive scanning the busy scan window is used until no demand was reported for a while.
+  void report_radio_demand();
+  /// Percentage of the time the radio is listening for advertisements.
+  float get_scan_duty_cycle() const;
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -251,6 +340,17 @@ class ESP32BLETracker : public Component,
   void register_client(ESPBTClient *client);
   void recalculate_advertisement_parser_types();
 
+#if defined(ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT) && defined(USE_ESP32_BLE_DEVICE)
+  /// Only hand advertisements to a registered listener if they match one of its filters, call after register_listener.
+  /// The filters are a pre-selection, the listener still checks the devices it is given. A listener without
+  /// filters receives every advertisement.
+  void add_address_filter(ESPBTDeviceListener *listener, uint64_t address);
+  /// Match advertisements carrying service data for this 16-bit UUID.
+  void add_service_data_filter(ESPBTDeviceListener *listener, uint16_t uuid);
+  /// Match advertisements carrying manufacturer data with this company ID.
+  void add_manufacturer_filter(ESPBTDeviceListener *listener, uint16_t company_id);
+#endif
+
 #ifdef USE_ESP32_BLE_DEVICE
   void print_bt_device_info(const ESPBTDevice &device);
 #endif
@@ -287,6 +387,19 @@ class ESP32BLETracker : public Component,
   void cleanup_scan_state_(bool is_stop_complete);
   /// Process a single scan result immediately
   void process_scan_result_(const BLEScanResult &scan_result);
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  /// Restart the scan with the other scan window when the radio got busy or idle
+  void update_adaptive_scan_(const ClientStateCounts &counts, uint32_t now);
+#endif
+#ifdef USE_SENSOR
+  void publish_scan_stats_(uint32_t now);
+#endif
+#if defined(ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT) && defined(USE_ESP32_BLE_DEVICE)
+  /// Hand the device to the unfiltered listeners and to those with a matching filter, each at most once.
+  bool dispatch_to_listeners_(const ESPBTDevice &device);
+  void add_filtered_(std::vector<ESPBTDeviceListener *> &index, ESPBTDeviceListener *listener);
+  void add_matching_(const std::vector<ESPBTDeviceListener *> &index);
+#endif
   /// Handle scanner failure states
   void handle_scanner_failure_();
   /// Try to promote discovered clients to ready to connect
@@ -314,6 +427,10 @@ class ESP32BLETracker : public Component,
         case ClientState::CONNECTING:
           counts.connecting++;
           break;
+        case ClientState::CONNECTED:
+        case ClientState::ESTABLISHED:
+          counts.connected++;
+          break;
         default:
           break;
       }
@@ -325,6 +442,15 @@ class ESP32BLETracker : public Component,
   // Group 1: Large objects (12+ bytes) - vectors and callback manager
 #ifdef ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT
   StaticVector<ESPBTDeviceListener *, ESPHOME_ESP32_BLE_TRACKER_LISTENER_COUNT> listeners_;
+#ifdef USE_ESP32_BLE_DEVICE
+  /// Listeners without filters, they see every advertisement
+  std::vector<ESPBTDeviceListener *> unfiltered_listeners_;
+  std::unordered_map<uint64_t, std::vector<ESPBTDeviceListener *>> address_index_;
+  std::unordered_map<uint16_t, std::vector<ESPBTDeviceListener *>> service_data_index_;
+  std::unordered_map<uint16_t, std::vector<ESPBTDeviceListener *>> manufacturer_index_;
+  /// Filtered listeners matching the advertisement being dispatched, reused between advertisements
+  std::vector<ESPBTDeviceListener *> matched_listeners_;
+#endif
 #endif
 #ifdef ESPHOME_ESP32_BLE_TRACKER_CLIENT_COUNT
   StaticVector<ESPBTClient *, ESPHOME_ESP32_BLE_TRACKER_CLIENT_COUNT> clients_;
@@ -345,6 +471,17 @@ class ESP32BLETracker : public Component,
   uint32_t scan_duration_;
   uint32_t scan_interval_;
   uint32_t scan_window_;
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  uint32_t busy_scan_window_{0};
+  uint32_t last_radio_demand_{0};
+#endif
+#ifdef USE_SENSOR
+  /// Advertisements received since the stats were last published
+  uint32_t advertisement_count_{0};
+  uint32_t last_stats_time_{0};
+  sensor::Sensor *advertisement_rate_sensor_{nullptr};
+  sensor::Sensor *scan_duty_cycle_sensor_{nullptr};
+#endif
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
 
@@ -359,6 +496,12 @@ class ESP32BLETracker : public Component,
   bool parse_advertisements_{false};
 #ifdef USE_ESP32_BLE_SOFTWARE_COEXISTENCE
   bool coex_prefer_ble_{false};
+#endif
+#ifdef USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
+  /// The running scan uses the busy scan window
+  bool scan_busy_{false};
+  /// Demand was reported within RADIO_DEMAND_HOLD_MS
+  bool radio_demand_{false};
 #endif
   // Scan timeout state machine
   enum class ScanTimeoutState : uint8_t {
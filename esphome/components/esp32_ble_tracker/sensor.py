@@ -0,0 +1,47 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_BLUETOOTH,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_PERCENT,
+)
+
+from . import CONF_ESP32_BLE_ID, ESP32BLETracker
+
+DEPENDENCIES = ["esp32_ble_tracker"]
+
+CONF_ADVERTISEMENT_RATE = "advertisement_rate"
+CONF_SCAN_DUTY_CYCLE = "scan_duty_cycle"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ESP32_BLE_ID): cv.use_id(ESP32BLETracker),
+        # Advertisements received per second, averaged over a minute
+        cv.Optional(CONF_ADVERTISEMENT_RATE): sensor.sensor_schema(
+            unit_of_measurement="adv/s",
+            icon=ICON_BLUETOOTH,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_SCAN_DUTY_CYCLE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon=ICON_BLUETOOTH,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_ESP32_BLE_ID])
+    if conf := config.get(CONF_ADVERTISEMENT_RATE):
+        sens = await sensor.new_sensor(conf)
+        cg.add(parent.set_advertisement_rate_sensor(sens))
+    if conf := config.get(CONF_SCAN_DUTY_CYCLE):
+        sens = await sensor.new_sensor(conf)
+        cg.add(parent.set_scan_duty_cycle_sensor(sens))
@@ -235,7 +235,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_IDLE_FRAMERATE, default="0.1 fps"): cv.All(
                 cv.framerate, cv.Range(min=0, max=1)
             ),
-            cv.Optional(CONF_FRAME_BUFFER_COUNT, default=1): cv.int_range(min=1, max=2),
+            cv.Optional(CONF_FRAME_BUFFER_COUNT, default=1): cv.int_range(min=1, max=3),
             cv.Optional(CONF_FRAME_BUFFER_LOCATION, default="PSRAM"): cv.enum(
                 ENUM_FB_LOCATION, upper=True
             ),
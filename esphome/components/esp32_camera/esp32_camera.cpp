@@ -7,6 +7,9 @@
 
 #include <freertos/task.h>
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace esp32_camera {
 
@@ -36,8 +39,9 @@ void ESP32Camera::setup() {
   this->update_camera_parameters();
 
   /* initialize RTOS */
-  this->framebuffer_get_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
-  this->framebuffer_return_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
+  this->images_.resize(this->config_.fb_count);
+  this->framebuffer_get_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
+  this->framebuffer_return_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
   xTaskCreatePinnedToCore(&ESP32Camera::framebuffer_task,
                           "framebuffer_task",  // name
                           1024,                // stack size
@@ -164,13 +168,8 @@ void ESP32Camera::dump_config() {
 }
 
 void ESP32Camera::loop() {
-  // check if we can return the image
-  if (this->can_return_image_()) {
-    // return image
-    auto *fb = this->current_image_->get_raw_buffer();
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
-    this->current_image_.reset();
-  }
+  this->return_unused_images_();
+  this->take_newest_framebuffer_();
 
   // request idle image every idle_update_interval
   const uint32_t now = App.get_loop_component_start_time();
@@ -179,33 +178,29 @@ void ESP32Camera::loop() {
     this->request_image(camera::IDLE);
   }
 
-  // Check if we should fetch a new image
+  // Check if we should publish a new image
   if (!this->has_requested_image_())
     return;
-  if (this->current_image_.use_count() > 1) {
-    // image is still in use
-    return;
-  }
   if (now - this->last_update_ <= this->max_update_interval_)
     return;
-
-  // request new image
-  camera_fb_t *fb;
-  if (xQueueReceive(this->framebuffer_get_queue_, &fb, 0L) != pdTRUE) {
+  if (this->pending_framebuffer_ == nullptr) {
     // no frame ready
     ESP_LOGVV(TAG, "No frame ready");
     return;
   }
 
-  if (fb == nullptr) {
-    ESP_LOGW(TAG, "Got invalid frame from camera!");
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+  auto slot = std::find(this->images_.begin(), this->images_.end(), nullptr);
+  if (slot == this->images_.end()) {
+    // all frames are still in use
     return;
   }
-  this->current_image_ = std::make_shared<ESP32CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
+
+  camera_fb_t *fb = this->pending_framebuffer_;
+  this->pending_framebuffer_ = nullptr;
+  *slot = std::make_shared<ESP32CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
 
   ESP_LOGD(TAG, "Got Image: len=%u", fb->len);
-  this->new_image_callback_.call(this->current_image_);
+  this->new_image_callback_.call(*slot);
   this->last_update_ = now;
   this->single_requesters_ = 0;
 }
@@ -402,15 +397,51 @@ void ESP32Camera::update_camera_parameters() {
 
 /* ---------------- Internal methods ---------------- */
 bool ESP32Camera::has_requested_image_() const { return this->single_requesters_ || this->stream_requesters_; }
-bool ESP32Camera::can_return_image_() const { return this->current_image_.use_count() == 1; }
+void ESP32Camera::return_unused_images_() {
+  for (auto &image : this->images_) {
+    if (image && image.use_count() == 1) {
+      auto *fb = image->get_raw_buffer();
+      xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+      image.reset();
+    }
+  }
+}
+void ESP32Camera::take_newest_framebuffer_() {
+  camera_fb_t *fb;
+  while (xQueueReceive(this->framebuffer_get_queue_, &fb, 0L) == pdTRUE) {
+    if (fb == nullptr) {
+      ESP_LOGW(TAG, "Got invalid frame from camera!");
+      xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+      continue;
+    }
+    if (this->pending_framebuffer_ != nullptr) {
+      // A newer frame superseded the unpublished one, give the buffer back so the driver can refill it
+      xQueueSend(this->framebuffer_return_queue_, &this->pending_framebuffer_, portMAX_DELAY);
+      this->skipped_frames_++;
+      ESP_LOGVV(TAG, "Skipped frame, %" PRIu32 " in total", this->skipped_frames_);
+    }
+    this->pending_framebuffer_ = fb;
+  }
+}
 void ESP32Camera::framebuffer_task(void *pv) {
   ESP32Camera *that = (ESP32Camera *) pv;
+  const uint8_t fb_count = that->config_.fb_count;
+  uint8_t held = 0;
   while (true) {
-    camera_fb_t *framebuffer = esp_camera_fb_get();
-    xQueueSend(that->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
-    // return is no-op for config with 1 fb
-    xQueueReceive(that->framebuffer_return_queue_, &framebuffer, portMAX_DELAY);
-    esp_camera_fb_return(framebuffer);
+    camera_fb_t *framebuffer;
+    if (held < fb_count) {
+      framebuffer = esp_camera_fb_get();
+      held++;
+      xQueueSend(that->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
+    }
+    // Only block for a returned frame once every buffer is handed out, otherwise keep capturing
+    TickType_t wait = held < fb_count ? 0 : portMAX_DELAY;
+    while (xQueueReceive(that->framebuffer_return_queue_, &framebuffer, wait) == pdTRUE) {
+      // return is no-op for config with 1 fb
+      esp_camera_fb_return(framebuffer);
+      held--;
+      wait = 0;
+    }
   }
 }
 
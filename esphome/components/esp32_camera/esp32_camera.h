@@ -5,6 +5,7 @@
 #include <esp_camera.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <vector>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/components/camera/camera.h"
@@ -173,7 +174,10 @@ class ESP32Camera : public camera::Camera {
  protected:
   /* internal methods */
   bool has_requested_image_() const;
-  bool can_return_image_() const;
+  /// Hands the frames no consumer holds anymore back to the framebuffer task.
+  void return_unused_images_();
+  /// Keeps the newest frame waiting in the get queue and returns the older ones.
+  void take_newest_framebuffer_();
 
   static void framebuffer_task(void *pv);
 
@@ -205,7 +209,12 @@ class ESP32Camera : public camera::Camera {
   uint32_t idle_update_interval_{15000};
 
   esp_err_t init_error_{ESP_OK};
-  std::shared_ptr<ESP32CameraImage> current_image_;
+  // One slot per frame buffer. Every consumer reads the same refcounted frame, a frame goes back to the driver when
+  // the slot holds its last reference, so a slow consumer only keeps its own frame and never stalls the others.
+  std::vector<std::shared_ptr<ESP32CameraImage>> images_;
+  // Newest frame received from the framebuffer task that has not been published yet
+  camera_fb_t *pending_framebuffer_{nullptr};
+  uint32_t skipped_frames_{0};
   uint8_t single_requesters_{0};
   uint8_t stream_requesters_{0};
   QueueHandle_t framebuffer_get_queue_;
@@ -4,6 +4,8 @@
 
 #include <driver/twai.h>
 
+#include <algorithm>
+
 // WORKAROUND, because CAN_IO_UNUSED is just defined as (-1) in this version
 // of the framework which does not work with -fpermissive
 #undef CAN_IO_UNUSED
@@ -85,6 +87,18 @@ bool ESP32Can::setup_internal() {
   }
 
   twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+  const bool extended = !this->hardware_filters_.empty() && this->hardware_filters_[0].use_extended_id;
+  if (!this->hardware_filters_.empty() &&
+      std::all_of(this->hardware_filters_.begin(), this->hardware_filters_.end(),
+                  [extended](const canbus::CanFilter &filter) { return filter.use_extended_id == extended; })) {
+    // A single filter for all, the controller can't keep more than two apart. Mask bits set to 1 are ignored, a
+    // standard id is followed by RTR and the first two data bytes, an extended id by RTR.
+    auto filter = canbus::CanFilter::merge(this->hardware_filters_.data(), this->hardware_filters_.size());
+    const uint8_t shift = extended ? 3 : 21;
+    f_config.acceptance_code = filter.can_id << shift;
+    f_config.acceptance_mask = ~(filter.can_id_mask << shift);
+    f_config.single_filter = true;
+  }
   twai_timing_config_t t_config;
 
   if (!get_bitrate(this->bit_rate_, &t_config)) {
@@ -22,6 +22,8 @@ static const uint8_t RMT_CLK_DIV = 2;
 #endif
 
 static const size_t RMT_SYMBOLS_PER_BYTE = 8;
+// A frame not done after this long is reported, the next one is sent as soon as it is
+static const uint32_t TX_TIMEOUT_US = 1000000;
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
 static size_t IRAM_ATTR HOT encoder_callback(const void *data, size_t size, size_t symbols_written, size_t symbols_free,
@@ -58,6 +60,67 @@ static size_t IRAM_ATTR HOT encoder_callback(const void *data, size_t size, size
   *done = true;
   return 1;
 }
+#else
+// Bytes encoder for the pixels followed by a copy encoder for the reset symbol, both run from the RMT ISR as the
+// channel memory drains, so no symbol buffer for the whole frame is needed
+struct LedStripEncoder {
+  rmt_encoder_t base;
+  rmt_encoder_t *bytes_encoder;
+  rmt_encoder_t *copy_encoder;
+  rmt_symbol_word_t reset;
+  bool send_reset;
+  bool sending_reset;
+};
+
+static size_t IRAM_ATTR HOT led_strip_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *data,
+                                             size_t size, rmt_encode_state_t *ret_state) {
+  auto *led = __containerof(encoder, LedStripEncoder, base);
+  rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+  int state = RMT_ENCODING_RESET;
+  size_t encoded = 0;
+  if (!led->sending_reset) {
+    encoded += led->bytes_encoder->encode(led->bytes_encoder, channel, data, size, &session_state);
+    if (session_state & RMT_ENCODING_COMPLETE) {
+      if (led->send_reset) {
+        led->sending_reset = true;
+      } else {
+        state |= RMT_ENCODING_COMPLETE;
+      }
+    }
+    if (session_state & RMT_ENCODING_MEM_FULL)
+      state |= RMT_ENCODING_MEM_FULL;
+    // Out of channel memory, or done without a reset symbol
+    if (!led->sending_reset || (state & RMT_ENCODING_MEM_FULL)) {
+      *ret_state = static_cast<rmt_encode_state_t>(state);
+      return encoded;
+    }
+  }
+  encoded += led->copy_encoder->encode(led->copy_encoder, channel, &led->reset, sizeof(led->reset), &session_state);
+  if (session_state & RMT_ENCODING_COMPLETE) {
+    led->sending_reset = false;
+    state |= RMT_ENCODING_COMPLETE;
+  }
+  if (session_state & RMT_ENCODING_MEM_FULL)
+    state |= RMT_ENCODING_MEM_FULL;
+  *ret_state = static_cast<rmt_encode_state_t>(state);
+  return encoded;
+}
+
+static esp_err_t led_strip_encoder_reset(rmt_encoder_t *encoder) {
+  auto *led = __containerof(encoder, LedStripEncoder, base);
+  rmt_encoder_reset(led->bytes_encoder);
+  rmt_encoder_reset(led->copy_encoder);
+  led->sending_reset = false;
+  return ESP_OK;
+}
+
+static esp_err_t led_strip_encoder_del(rmt_encoder_t *encoder) {
+  auto *led = __containerof(encoder, LedStripEncoder, base);
+  rmt_del_encoder(led->bytes_encoder);
+  rmt_del_encoder(led->copy_encoder);
+  delete led;  // NOLINT(cppcoreguidelines-owning-memory)
+  return ESP_OK;
+}
 #endif
 
 void ESP32RMTLEDStripLightOutput::setup() {
@@ -79,15 +142,13 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  // copy of the led buffer
+  // Frame being transmitted, the encoder turns it into symbols from the ISR while effects draw the next one in buf_
   this->rmt_buf_ = allocator.allocate(buffer_size);
-#else
-  RAMAllocator<rmt_symbol_word_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_symbol_word_t>::ALLOC_INTERNAL);
-
-  // 8 bits per byte, 1 rmt_symbol_word_t per bit + 1 rmt_symbol_word_t for reset
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 + 1);
-#endif
+  if (this->rmt_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate transmit buffer!");
+    this->mark_failed();
+    return;
+  }
 
   rmt_tx_channel_config_t channel;
   memset(&channel, 0, sizeof(channel));
@@ -119,13 +180,32 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 #else
-  rmt_copy_encoder_config_t encoder;
-  memset(&encoder, 0, sizeof(encoder));
-  if (rmt_new_copy_encoder(&encoder, &this->encoder_) != ESP_OK) {
+  auto *led_encoder = new LedStripEncoder();  // NOLINT(cppcoreguidelines-owning-memory)
+  led_encoder->base.encode = led_strip_encode;
+  led_encoder->base.reset = led_strip_encoder_reset;
+  led_encoder->base.del = led_strip_encoder_del;
+  led_encoder->reset = this->params_.reset;
+  led_encoder->send_reset = this->params_.reset.duration0 > 0 || this->params_.reset.duration1 > 0;
+  rmt_bytes_encoder_config_t bytes_encoder;
+  memset(&bytes_encoder, 0, sizeof(bytes_encoder));
+  bytes_encoder.bit0 = this->params_.bit0;
+  bytes_encoder.bit1 = this->params_.bit1;
+  bytes_encoder.flags.msb_first = 1;
+  rmt_copy_encoder_config_t copy_encoder;
+  memset(&copy_encoder, 0, sizeof(copy_encoder));
+  if (rmt_new_bytes_encoder(&bytes_encoder, &led_encoder->bytes_encoder) != ESP_OK ||
+      rmt_new_copy_encoder(&copy_encoder, &led_encoder->copy_encoder) != ESP_OK) {
     ESP_LOGE(TAG, "Encoder creation failed");
+    // Only the sub-encoders created before the failure exist, the others are still nullptr
+    if (led_encoder->bytes_encoder != nullptr)
+      rmt_del_encoder(led_encoder->bytes_encoder);
+    if (led_encoder->copy_encoder != nullptr)
+      rmt_del_encoder(led_encoder->copy_encoder);
+    delete led_encoder;  // NOLINT(cppcoreguidelines-owning-memory)
     this->mark_failed();
     return;
   }
+  this->encoder_ = &led_encoder->base;
 #endif
 
   if (rmt_enable(this->channel_) != ESP_OK) {
@@ -164,53 +244,27 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+
+  // The previous frame is still going out of rmt_buf_, keep drawing into buf_ and send it on a later loop
+  if (rmt_tx_wait_all_done(this->channel_, 0) != ESP_OK) {
+    if (now - this->last_refresh_ > TX_TIMEOUT_US && !this->status_has_warning()) {
+      ESP_LOGE(TAG, "RMT TX timeout");
+      this->status_set_warning();
+    }
+    this->schedule_show();
+    return;
+  }
   this->last_refresh_ = now;
   this->mark_shown_();
 
   ESP_LOGVV(TAG, "Writing RGB values to bus");
-
-  esp_err_t error = rmt_tx_wait_all_done(this->channel_, 1000);
-  if (error != ESP_OK) {
-    ESP_LOGE(TAG, "RMT TX timeout");
-    this->status_set_warning();
-    return;
-  }
   delayMicroseconds(50);
 
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
   memcpy(this->rmt_buf_, this->buf_, this->get_buffer_size_());
-#else
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_symbol_word_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->params_.bit1.val : this->params_.bit0.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (this->params_.reset.duration0 > 0 || this->params_.reset.duration1 > 0) {
-    pdest->val = this->params_.reset.val;
-    pdest++;
-    len++;
-  }
-#endif
 
   rmt_transmit_config_t config;
   memset(&config, 0, sizeof(config));
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
-  error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, this->get_buffer_size_(), &config);
-#else
-  error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, len * sizeof(rmt_symbol_word_t), &config);
-#endif
+  esp_err_t error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, this->get_buffer_size_(), &config);
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
     this->status_set_warning();
@@ -219,47 +273,65 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   this->status_clear_warning();
 }
 
-light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0;
+light::PixelBuffer ESP32RMTLEDStripLightOutput::pixel_buffer_() const {
+  light::PixelBuffer buffer;
   switch (this->rgb_order_) {
     case ORDER_RGB:
-      r = 0;
-      g = 1;
-      b = 2;
+      buffer.red = 0;
+      buffer.green = 1;
+      buffer.blue = 2;
       break;
     case ORDER_RBG:
-      r = 0;
-      g = 2;
-      b = 1;
+      buffer.red = 0;
+      buffer.green = 2;
+      buffer.blue = 1;
       break;
     case ORDER_GRB:
-      r = 1;
-      g = 0;
-      b = 2;
+      buffer.red = 1;
+      buffer.green = 0;
+      buffer.blue = 2;
       break;
     case ORDER_GBR:
-      r = 2;
-      g = 0;
-      b = 1;
+      buffer.red = 2;
+      buffer.green = 0;
+      buffer.blue = 1;
       break;
     case ORDER_BGR:
-      r = 2;
-      g = 1;
-      b = 0;
+      buffer.red = 2;
+      buffer.green = 1;
+      buffer.blue = 0;
       break;
     case ORDER_BRG:
-      r = 1;
-      g = 2;
-      b = 0;
+      buffer.red = 1;
+      buffer.green = 2;
+      buffer.blue = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
-  uint8_t white = this->is_wrgb_ ? 0 : 3;
+  const bool has_white = this->is_rgbw_ || this->is_wrgb_;
+  buffer.data = this->buf_;
+  buffer.effect_data = this->effect_data_;
+  buffer.stride = has_white ? 4 : 3;
+  buffer.red += this->is_wrgb_;
+  buffer.green += this->is_wrgb_;
+  buffer.blue += this->is_wrgb_;
+  buffer.white = has_white ? (this->is_wrgb_ ? 0 : 3) : -1;
+  return buffer;
+}
 
-  return {this->buf_ + (index * multiplier) + r + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + g + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + b + this->is_wrgb_,
-          this->is_rgbw_ || this->is_wrgb_ ? this->buf_ + (index * multiplier) + white : nullptr,
+bool ESP32RMTLEDStripLightOutput::get_pixel_buffer(light::PixelBuffer *buffer) {
+  if (this->buf_ == nullptr || this->effect_data_ == nullptr)
+    return false;
+  *buffer = this->pixel_buffer_();
+  return true;
+}
+
+light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+  const light::PixelBuffer buffer = this->pixel_buffer_();
+  uint8_t *pixel = buffer.data + index * buffer.stride;
+  return {pixel + buffer.red,
+          pixel + buffer.green,
+          pixel + buffer.blue,
+          buffer.white >= 0 ? pixel + buffer.white : nullptr,
           &this->effect_data_[index],
           &this->correction_};
 }
@@ -71,8 +71,11 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
   void dump_config() override;
 
+  bool get_pixel_buffer(light::PixelBuffer *buffer) override;
+
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::PixelBuffer pixel_buffer_() const;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
@@ -81,11 +84,7 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   LedParams params_;
   rmt_channel_handle_t channel_{nullptr};
   rmt_encoder_handle_t encoder_{nullptr};
-#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
   uint8_t *rmt_buf_{nullptr};
-#else
-  rmt_symbol_word_t *rmt_buf_{nullptr};
-#endif
   uint32_t rmt_symbols_{48};
   uint8_t pin_;
   uint16_t num_leds_;
@@ -5,6 +5,7 @@ from esphome.components.ota import BASE_OTA_SCHEMA, OTAComponent, ota_to_code
 from esphome.config_helpers import merge_config
 import esphome.config_validation as cv
 from esphome.const import (
+    CONF_DELTA,
     CONF_ESPHOME,
     CONF_ID,
     CONF_NUM_ATTEMPTS,
@@ -118,6 +119,10 @@ CONFIG_SCHEMA = (
                 rtl87xx=8892,
             ): cv.port,
             cv.Optional(CONF_PASSWORD): cv.string,
+            # Reads the running image back from its app partition
+            cv.SplitDefault(CONF_DELTA, esp32=False): cv.All(
+                cv.boolean, cv.only_on_esp32
+            ),
             cv.Optional(CONF_NUM_ATTEMPTS): cv.invalid(
                 f"'{CONF_SAFE_MODE}' (and its related configuration variables) has moved from 'ota' to its own component. See https://esphome.io/components/safe_mode"
             ),
@@ -151,6 +156,8 @@ async def to_code(config: ConfigType) -> None:
         if supports_sha256():
             cg.add_define("USE_OTA_SHA256")
     cg.add_define("USE_OTA_VERSION", config[CONF_VERSION])
+    if config.get(CONF_DELTA):
+        cg.add_define("USE_OTA_DELTA")
 
     await cg.register_component(var, config)
     await ota_to_code(var, config)
@@ -87,6 +87,8 @@ void ESPHomeOTAComponent::setup() {
     this->mark_failed();
     return;
   }
+
+  this->server_notifies_ = this->server_->set_ready_listener(this);
 }
 
 void ESPHomeOTAComponent::dump_config() {
@@ -109,6 +111,9 @@ void ESPHomeOTAComponent::loop() {
   // if server_ creation fails
   if (this->client_ != nullptr || this->server_->ready()) {
     this->handle_handshake_();
+  } else if (this->server_notifies_) {
+    // Woken again by select() once a connection is waiting
+    this->disable_loop();
   }
 }
 
@@ -116,6 +121,9 @@ static const uint8_t FEATURE_SUPPORTS_COMPRESSION = 0x01;
 #ifdef USE_OTA_SHA256
 static const uint8_t FEATURE_SUPPORTS_SHA256_AUTH = 0x02;
 #endif
+#ifdef USE_OTA_DELTA
+static const uint8_t FEATURE_SUPPORTS_DELTA = 0x04;
+#endif
 
 // Temporary flag to allow MD5 downgrade for ~3 versions (until 2026.1.0)
 // This allows users to downgrade via OTA if they encounter issues after updating.
@@ -211,12 +219,24 @@ void ESPHomeOTAComponent::handle_handshake_() {
           ((this->ota_features_ & FEATURE_SUPPORTS_COMPRESSION) != 0 && this->backend_->supports_compression())
               ? ota::OTA_RESPONSE_SUPPORTS_COMPRESSION
               : ota::OTA_RESPONSE_HEADER_OK;
+#ifdef USE_OTA_DELTA
+      // The client needs the digest of the running image to pick the delta to send
+      this->delta_offered_ = (this->ota_features_ & FEATURE_SUPPORTS_DELTA) != 0 &&
+                             ota::get_running_image_digest(this->handshake_buf_ + 1);
+      if (this->delta_offered_)
+        this->handshake_buf_[0] = ota::OTA_RESPONSE_SUPPORTS_DELTA;
+#endif
       [[fallthrough]];
     }
 
     case OTAState::FEATURE_ACK: {
-      // Acknowledge header - 1 byte
-      if (!this->try_write_(1, LOG_STR("ack feature"))) {
+      // Acknowledge header - 1 byte, followed by the running image digest when offering a delta
+      size_t ack_size = 1;
+#ifdef USE_OTA_DELTA
+      if (this->delta_offered_)
+        ack_size += ota::OTA_DELTA_DIGEST_SIZE;
+#endif
+      if (!this->try_write_(ack_size, LOG_STR("ack feature"))) {
         return;
       }
 #ifdef USE_OTA_PASSWORD
@@ -279,6 +299,10 @@ void ESPHomeOTAComponent::handle_data_() {
 #if USE_OTA_VERSION == 2
   size_t size_acknowledged = 0;
 #endif
+#ifdef USE_OTA_DELTA
+  size_t image_size;
+  std::unique_ptr<ota::OTADeltaDecoder> delta;
+#endif
 
   // Acknowledge auth OK - 1 byte
   buf[0] = ota::OTA_RESPONSE_AUTH_OK;
@@ -295,6 +319,23 @@ void ESPHomeOTAComponent::handle_data_() {
     ota_size |= buf[i];
   }
   ESP_LOGV(TAG, "Size is %u bytes", ota_size);
+#ifdef USE_OTA_DELTA
+  image_size = ota_size;
+  if (this->delta_offered_) {
+    // Size of the image the delta builds, 4 bytes MSB first, 0 if the upload is a full image
+    if (!this->readall_(buf, 4)) {
+      this->log_read_error_(LOG_STR("image size"));
+      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+    }
+    image_size = encode_uint32(buf[0], buf[1], buf[2], buf[3]);
+    if (image_size != 0) {
+      ESP_LOGD(TAG, "Receiving a delta of %zu bytes for a %zu byte image", ota_size, image_size);
+      delta = make_unique<ota::OTADeltaDecoder>(this->backend_.get());
+    } else {
+      image_size = ota_size;
+    }
+  }
+#endif
 
   // Now that we've passed authentication and are actually
   // starting the update, set the warning status and notify
@@ -307,7 +348,11 @@ void ESPHomeOTAComponent::handle_data_() {
 #endif
 
   // This will block for a few seconds as it locks flash
+#ifdef USE_OTA_DELTA
+  error_code = this->backend_->begin(image_size);
+#else
   error_code = this->backend_->begin(ota_size);
+#endif
   if (error_code != ota::OTA_RESPONSE_OK)
     goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
   update_started = true;
@@ -332,8 +377,17 @@ void ESPHomeOTAComponent::handle_data_() {
   while (total < ota_size) {
     // TODO: timeout check
     size_t remaining = ota_size - total;
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+    // Write to flash straight from the receive segment instead of copying it into buf first
+    uint8_t *data;
+    ssize_t read = this->client_->peek_segment(&data);
+    if (read > 0 && static_cast<size_t>(read) > remaining)
+      read = remaining;
+#else
     size_t requested = remaining < OTA_BUFFER_SIZE ? remaining : OTA_BUFFER_SIZE;
+    uint8_t *data = buf;
     ssize_t read = this->client_->read(buf, requested);
+#endif
     if (read == -1) {
       if (this->would_block_(errno)) {
         this->yield_and_feed_watchdog_();
@@ -346,7 +400,17 @@ void ESPHomeOTAComponent::handle_data_() {
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
     }
 
-    error_code = this->backend_->write(buf, read);
+#ifdef USE_OTA_DELTA
+    if (delta) {
+      error_code = delta->write(data, read);
+    } else
+#endif
+    {
+      error_code = this->backend_->write(data, read);
+    }
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+    this->client_->consume(read);
+#endif
     if (error_code != ota::OTA_RESPONSE_OK) {
       ESP_LOGW(TAG, "Flash write err %d", error_code);
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
@@ -373,6 +437,14 @@ void ESPHomeOTAComponent::handle_data_() {
     }
   }
 
+#ifdef USE_OTA_DELTA
+  if (delta) {
+    error_code = delta->finish(image_size);
+    if (error_code != ota::OTA_RESPONSE_OK)
+      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+  }
+#endif
+
   // Acknowledge receive OK - 1 byte
   buf[0] = ota::OTA_RESPONSE_RECEIVE_OK;
   this->writeall_(buf, 1);
@@ -3,6 +3,9 @@
 #include "esphome/core/defines.h"
 #ifdef USE_OTA
 #include "esphome/components/ota/ota_backend.h"
+#ifdef USE_OTA_DELTA
+#include "esphome/components/ota/ota_delta.h"
+#endif
 #include "esphome/components/socket/socket.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -87,10 +90,19 @@ class ESPHomeOTAComponent : public ota::OTAComponent {
 
   uint32_t client_connect_time_{0};
   uint16_t port_;
+#ifdef USE_OTA_DELTA
+  // Also holds the delta ack: response byte and running image digest
+  uint8_t handshake_buf_[1 + ota::OTA_DELTA_DIGEST_SIZE];
+#else
   uint8_t handshake_buf_[5];
+#endif
   OTAState ota_state_{OTAState::IDLE};
   uint8_t handshake_buf_pos_{0};
   uint8_t ota_features_{0};
+  bool server_notifies_{false};  // Whether select() wakes the loop for new connections
+#ifdef USE_OTA_DELTA
+  bool delta_offered_{false};  // Whether the client was told it may send a delta
+#endif
 #ifdef USE_OTA_PASSWORD
   std::unique_ptr<uint8_t[]> auth_buf_;
   uint8_t auth_buf_pos_{0};
@@ -57,12 +57,14 @@ OnBroadcastedTrigger = espnow_ns.class_(
 CONF_AUTO_ADD_PEER = "auto_add_peer"
 CONF_PEERS = "peers"
 CONF_ON_SENT = "on_sent"
+CONF_MAX_IN_FLIGHT = "max_in_flight"
 CONF_ON_UNKNOWN_PEER = "on_unknown_peer"
 CONF_ON_BROADCAST = "on_broadcast"
 CONF_CONTINUE_ON_ERROR = "continue_on_error"
 CONF_WAIT_FOR_SENT = "wait_for_sent"
 
 MAX_ESPNOW_PACKET_SIZE = 250  # Maximum size of the payload in bytes
+MAX_ESPNOW_IN_FLIGHT = 8  # Must match MAX_ESP_NOW_IN_FLIGHT in espnow_component.h
 
 
 CONFIG_SCHEMA = cv.All(
@@ -72,6 +74,9 @@ CONFIG_SCHEMA = cv.All(
             cv.OnlyWithout(CONF_CHANNEL, CONF_WIFI): wifi.validate_channel,
             cv.Optional(CONF_ENABLE_ON_BOOT, default=True): cv.boolean,
             cv.Optional(CONF_AUTO_ADD_PEER, default=False): cv.boolean,
+            cv.Optional(CONF_MAX_IN_FLIGHT, default=1): cv.int_range(
+                min=1, max=MAX_ESPNOW_IN_FLIGHT
+            ),
             cv.Optional(CONF_PEERS): cv.ensure_list(cv.mac_address),
             cv.Optional(CONF_ON_UNKNOWN_PEER): automation.validate_automation(
                 {
@@ -98,9 +103,7 @@ CONFIG_SCHEMA = cv.All(
 
 
 async def _trigger_to_code(config):
-    if address := config.get(CONF_ADDRESS):
-        address = address.parts
-    trigger = cg.new_Pvariable(config[CONF_TRIGGER_ID], address)
+    trigger = cg.new_Pvariable(config[CONF_TRIGGER_ID])
     await automation.build_automation(
         trigger,
         [
@@ -125,6 +128,7 @@ async def to_code(config):
         cg.add(var.set_wifi_channel(wifi_channel))
 
     cg.add(var.set_auto_add_peer(config[CONF_AUTO_ADD_PEER]))
+    cg.add(var.set_max_in_flight(config[CONF_MAX_IN_FLIGHT]))
 
     for peer in config.get(CONF_PEERS, []):
         cg.add(var.add_peer(peer.parts))
@@ -135,11 +139,18 @@ async def to_code(config):
 
     for on_receive in config.get(CONF_ON_RECEIVE, []):
         trigger = await _trigger_to_code(on_receive)
-        cg.add(var.register_received_handler(trigger))
+        # Triggers for one address are only dispatched packets from that peer
+        if address := on_receive.get(CONF_ADDRESS):
+            cg.add(var.register_received_handler(trigger, address.parts))
+        else:
+            cg.add(var.register_received_handler(trigger))
 
     for on_receive in config.get(CONF_ON_BROADCAST, []):
         trigger = await _trigger_to_code(on_receive)
-        cg.add(var.register_broadcasted_handler(trigger))
+        if address := on_receive.get(CONF_ADDRESS):
+            cg.add(var.register_broadcasted_handler(trigger, address.parts))
+        else:
+            cg.add(var.register_broadcasted_handler(trigger))
 
 
 # ========================================== A C T I O N S ================================================
@@ -130,8 +130,10 @@ void ESPNowComponent::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "  Own address: %s\n"
                 "  Version: v%" PRIu32 "\n"
-                "  Wi-Fi channel: %d",
-                format_mac_address_pretty(this->own_address_).c_str(), version, this->wifi_channel_);
+                "  Wi-Fi channel: %d\n"
+                "  Max in flight: %u",
+                format_mac_address_pretty(this->own_address_).c_str(), version, this->wifi_channel_,
+                this->max_in_flight_);
 #ifdef USE_WIFI
   ESP_LOGCONFIG(TAG, "  Wi-Fi enabled: %s", YESNO(this->is_wifi_enabled()));
 #endif
@@ -229,6 +231,9 @@ void ESPNowComponent::disable() {
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "esp_now_deinit failed! 0x%x", err);
   }
+  // No reports will arrive for the packets still in flight
+  while (this->in_flight_count_ > 0)
+    this->complete_in_flight_(0, ESP_ERR_ESPNOW_NOT_INIT);
 }
 
 void ESPNowComponent::apply_wifi_channel() {
@@ -285,16 +290,17 @@ void ESPNowComponent::loop() {
                    format_mac_address_pretty(info.des_addr).c_str(),
                    format_hex_pretty(packet->packet_.receive.data, packet->packet_.receive.size).c_str());
 #endif
+          // If a handler returns true, stop processing further handlers
+          const uint8_t *data = packet->packet_.receive.data;
+          const uint8_t size = packet->packet_.receive.size;
           if (memcmp(info.des_addr, ESPNOW_BROADCAST_ADDR, ESP_NOW_ETH_ALEN) == 0) {
-            for (auto *handler : this->broadcasted_handlers_) {
-              if (handler->on_broadcasted(info, packet->packet_.receive.data, packet->packet_.receive.size))
-                break;  // If a handler returns true, stop processing further handlers
-            }
+            this->broadcasted_handlers_.dispatch(info.src_addr, [&](ESPNowBroadcastedHandler *handler) {
+              return handler->on_broadcasted(info, data, size);
+            });
           } else {
-            for (auto *handler : this->received_handlers_) {
-              if (handler->on_received(info, packet->packet_.receive.data, packet->packet_.receive.size))
-                break;  // If a handler returns true, stop processing further handlers
-            }
+            this->received_handlers_.dispatch(info.src_addr, [&](ESPNowReceivedPacketHandler *handler) {
+              return handler->on_received(info, data, size);
+            });
           }
         }
         break;
@@ -304,10 +310,8 @@ void ESPNowComponent::loop() {
         ESP_LOGV(TAG, ">>> [%s] %s", format_mac_address_pretty(packet->packet_.sent.address).c_str(),
                  LOG_STR_ARG(espnow_error_to_str(packet->packet_.sent.status)));
 #endif
-        if (this->current_send_packet_ != nullptr) {
-          this->current_send_packet_->callback_(packet->packet_.sent.status);
-          this->send_packet_pool_.release(this->current_send_packet_);
-          this->current_send_packet_ = nullptr;  // Reset current packet after sending
+        if (!this->complete_send_(packet->packet_.sent.address, packet->packet_.sent.status)) {
+          ESP_LOGV(TAG, "Send report without a packet in flight");
         }
         break;
       }
@@ -320,9 +324,7 @@ void ESPNowComponent::loop() {
   }
 
   // Process sending packet queue
-  if (this->current_send_packet_ == nullptr) {
-    this->send_();
-  }
+  this->send_();
 
   // Log dropped received packets periodically
   uint16_t received_dropped = this->receive_packet_queue_.get_and_reset_dropped_count();
@@ -381,24 +383,57 @@ esp_err_t ESPNowComponent::send(const uint8_t *peer_address, const uint8_t *payl
 }
 
 void ESPNowComponent::send_() {
-  ESPNowSendPacket *packet = this->send_packet_queue_.pop();
-  if (packet == nullptr) {
-    return;  // No packets to send
+  while (this->in_flight_count_ < this->max_in_flight_) {
+    ESPNowSendPacket *packet = this->retry_send_packet_;
+    this->retry_send_packet_ = nullptr;
+    if (packet == nullptr)
+      packet = this->send_packet_queue_.pop();
+    if (packet == nullptr) {
+      return;  // No packets to send
+    }
+
+    esp_err_t err = esp_now_send(packet->address_, packet->data_, packet->size_);
+    if (err == ESP_ERR_ESPNOW_NO_MEM && this->in_flight_count_ > 0) {
+      // The driver queue is full, try again once an acknowledgement made room
+      this->retry_send_packet_ = packet;
+      return;
+    }
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to send packet to %s - %s", format_mac_address_pretty(packet->address_).c_str(),
+               LOG_STR_ARG(espnow_error_to_str(err)));
+      if (packet->callback_ != nullptr) {
+        packet->callback_(err);
+      }
+      this->status_momentary_warning("send-failed");
+      this->send_packet_pool_.release(packet);
+      return;
+    }
+    this->in_flight_[this->in_flight_count_++] = packet;
   }
+}
 
-  this->current_send_packet_ = packet;
-  esp_err_t err = esp_now_send(packet->address_, packet->data_, packet->size_);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Failed to send packet to %s - %s", format_mac_address_pretty(packet->address_).c_str(),
-             LOG_STR_ARG(espnow_error_to_str(err)));
-    if (packet->callback_ != nullptr) {
-      packet->callback_(err);
+bool ESPNowComponent::complete_send_(const uint8_t *address, esp_err_t status) {
+  for (size_t i = 0; i < this->in_flight_count_; i++) {
+    if (memcmp(this->in_flight_[i]->address_, address, ESP_NOW_ETH_ALEN) == 0) {
+      this->complete_in_flight_(i, status);
+      return true;
     }
-    this->status_momentary_warning("send-failed");
-    this->send_packet_pool_.release(packet);
-    this->current_send_packet_ = nullptr;  // Reset current packet
-    return;
   }
+  if (this->in_flight_count_ == 0)
+    return false;
+  // Reports arrive in the order of the sends, so without a matching address the oldest one is reported
+  this->complete_in_flight_(0, status);
+  return true;
+}
+
+void ESPNowComponent::complete_in_flight_(size_t index, esp_err_t status) {
+  ESPNowSendPacket *packet = this->in_flight_[index];
+  for (size_t i = index + 1; i < this->in_flight_count_; i++)
+    this->in_flight_[i - 1] = this->in_flight_[i];
+  this->in_flight_count_--;
+  if (packet->callback_ != nullptr)
+    packet->callback_(status);
+  this->send_packet_pool_.release(packet);
 }
 
 esp_err_t ESPNowComponent::add_peer(const uint8_t *peer) {
@@ -25,6 +25,8 @@ namespace esphome::espnow {
 // Maximum size of the ESPNow event queue - must be power of 2 for lock-free queue
 static constexpr size_t MAX_ESP_NOW_SEND_QUEUE_SIZE = 16;
 static constexpr size_t MAX_ESP_NOW_RECEIVE_QUEUE_SIZE = 16;
+// Maximum number of packets handed to esp_now_send() that are not yet acknowledged
+static constexpr size_t MAX_ESP_NOW_IN_FLIGHT = 8;
 
 using peer_address_t = std::array<uint8_t, ESP_NOW_ETH_ALEN>;
 
@@ -88,6 +90,49 @@ class ESPNowBroadcastedHandler {
   virtual bool on_broadcasted(const ESPNowRecvInfo &info, const uint8_t *data, uint8_t size) = 0;
 };
 
+/// Handlers of one kind, those registered for a peer are only called for packets from that peer.
+template<typename H> class ESPNowHandlers {
+ public:
+  void add(H *handler) { this->any_peer_.push_back(handler); }
+  void add(const uint8_t *peer, H *handler) {
+    for (auto &entry : this->by_peer_) {
+      if (memcmp(entry.address.data(), peer, ESP_NOW_ETH_ALEN) == 0) {
+        entry.handlers.push_back(handler);
+        return;
+      }
+    }
+    PeerHandlers entry{};
+    memcpy(entry.address.data(), peer, ESP_NOW_ETH_ALEN);
+    entry.handlers.push_back(handler);
+    this->by_peer_.push_back(std::move(entry));
+  }
+
+  /// Calls handle for the handlers of the source peer, then for those of any peer, until one returns true.
+  template<typename F> void dispatch(const uint8_t *source, F &&handle) const {
+    for (const auto &entry : this->by_peer_) {
+      if (memcmp(entry.address.data(), source, ESP_NOW_ETH_ALEN) == 0) {
+        for (auto *handler : entry.handlers) {
+          if (handle(handler))
+            return;
+        }
+        break;
+      }
+    }
+    for (auto *handler : this->any_peer_) {
+      if (handle(handler))
+        return;
+    }
+  }
+
+ protected:
+  struct PeerHandlers {
+    std::array<uint8_t, ESP_NOW_ETH_ALEN> address;
+    std::vector<H *> handlers;
+  };
+  std::vector<H *> any_peer_;
+  std::vector<PeerHandlers> by_peer_;
+};
+
 class ESPNowComponent : public Component {
  public:
   ESPNowComponent();
@@ -113,6 +158,8 @@ class ESPNowComponent : public Component {
   uint8_t get_wifi_channel();
 
   void set_auto_add_peer(bool value) { this->auto_add_peer_ = value; }
+  /// Number of packets sent without waiting for the acknowledgement of the previous ones, 1 to MAX_ESP_NOW_IN_FLIGHT.
+  void set_max_in_flight(uint8_t max_in_flight) { this->max_in_flight_ = max_in_flight; }
 
   void enable();
   void disable();
@@ -123,8 +170,8 @@ class ESPNowComponent : public Component {
   /// @brief Queue a packet to be sent to a specific peer address.
   /// This method will add the packet to the internal queue and
   /// call the callback when the packet is sent.
-  /// Only one packet will be sent at any given time and the next one will not be sent until
-  /// the previous one has been acknowledged or failed.
+  /// Up to max_in_flight packets are sent before the first one has been acknowledged or failed,
+  /// the callbacks are called in the order of the acknowledgements.
   /// @param peer_address MAC address of the peer to send the packet to
   /// @param payload Data payload to send
   /// @param callback Callback to call when the send operation is complete
@@ -136,12 +183,18 @@ class ESPNowComponent : public Component {
   esp_err_t send(const uint8_t *peer_address, const uint8_t *payload, size_t size,
                  const send_callback_t &callback = nullptr);
 
-  void register_received_handler(ESPNowReceivedPacketHandler *handler) { this->received_handlers_.push_back(handler); }
+  void register_received_handler(ESPNowReceivedPacketHandler *handler) { this->received_handlers_.add(handler); }
+  /// Register a handler only called for packets from peer
+  void register_received_handler(ESPNowReceivedPacketHandler *handler, peer_address_t peer) {
+    this->received_handlers_.add(peer.data(), handler);
+  }
   void register_unknown_peer_handler(ESPNowUnknownPeerHandler *handler) {
     this->unknown_peer_handlers_.push_back(handler);
   }
-  void register_broadcasted_handler(ESPNowBroadcastedHandler *handler) {
-    this->broadcasted_handlers_.push_back(handler);
+  void register_broadcasted_handler(ESPNowBroadcastedHandler *handler) { this->broadcasted_handlers_.add(handler); }
+  /// Register a handler only called for broadcasts from peer
+  void register_broadcasted_handler(ESPNowBroadcastedHandler *handler, peer_address_t peer) {
+    this->broadcasted_handlers_.add(peer.data(), handler);
   }
 
  protected:
@@ -154,10 +207,13 @@ class ESPNowComponent : public Component {
 
   void enable_();
   void send_();
+  /// Completes the oldest in flight packet sent to address, returns false if there is none.
+  bool complete_send_(const uint8_t *address, esp_err_t status);
+  void complete_in_flight_(size_t index, esp_err_t status);
 
   std::vector<ESPNowUnknownPeerHandler *> unknown_peer_handlers_;
-  std::vector<ESPNowReceivedPacketHandler *> received_handlers_;
-  std::vector<ESPNowBroadcastedHandler *> broadcasted_handlers_;
+  ESPNowHandlers<ESPNowReceivedPacketHandler> received_handlers_;
+  ESPNowHandlers<ESPNowBroadcastedHandler> broadcasted_handlers_;
 
   std::vector<ESPNowPeer> peers_{};
 
@@ -167,7 +223,12 @@ class ESPNowComponent : public Component {
 
   LockFreeQueue<ESPNowSendPacket, MAX_ESP_NOW_SEND_QUEUE_SIZE> send_packet_queue_{};
   EventPool<ESPNowSendPacket, MAX_ESP_NOW_SEND_QUEUE_SIZE> send_packet_pool_{};
-  ESPNowSendPacket *current_send_packet_{nullptr};  // Currently sending packet, nullptr if none
+  // Packets sent and waiting for their acknowledgement, oldest first
+  std::array<ESPNowSendPacket *, MAX_ESP_NOW_IN_FLIGHT> in_flight_{};
+  uint8_t in_flight_count_{0};
+  uint8_t max_in_flight_{1};
+  // Packet esp_now_send() had no room for, sent again before the queue
+  ESPNowSendPacket *retry_send_packet_{nullptr};
 
   uint8_t wifi_channel_{0};
   ESPNowState state_{ESPNOW_STATE_OFF};
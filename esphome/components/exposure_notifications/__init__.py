@@ -36,4 +36,6 @@ async def to_code(config):
     for conf in config.get(CONF_ON_EXPOSURE_NOTIFICATION, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
         await automation.build_automation(trigger, [(ExposureNotification, "x")], conf)
-        await esp32_ble_tracker.register_ble_device(trigger, conf)
+        await esp32_ble_tracker.register_ble_device(
+            trigger, conf, service_data_uuids=[0xFD6F]
+        )
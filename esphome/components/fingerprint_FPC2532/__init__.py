@@ -1,9 +1,24 @@
 from esphome import automation, pins
 import esphome.codegen as cg
 from esphome.components import uart
+from esphome.components.fingerprint_base import (
+    CONF_ON_USER_MATCHED,
+    CONF_USERS,
+    USER_MATCHED_SCHEMA,
+    USERS_SCHEMA,
+    EnrollmentDoneTrigger,
+    EnrollmentFailedTrigger,
+    FingerprintReader,
+    FingerScanMatchedTrigger,
+    FingerScanStartTrigger,
+    FingerScanUnmatchedTrigger,
+    register_user_actions,
+    setup_users,
+)
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_FINGER_ID,
+    CONF_DATA,
     CONF_ID,
     CONF_ON_ENROLLMENT_DONE,
     CONF_ON_ENROLLMENT_FAILED,
@@ -13,33 +28,94 @@ from esphome.const import (
     CONF_ON_FINGER_SCAN_START,
     CONF_ON_FINGER_SCAN_UNMATCHED,
     CONF_PASSWORD,
+    CONF_RX_BUFFER_SIZE,
+    CONF_SENSING_PIN,
+    CONF_SIZE,
+    CONF_TAG,
     CONF_TRIGGER_ID,
+    CONF_TYPE,
 )
+from esphome.core import CORE
+from esphome.core.entity_helpers import setup_entity
+from esphome.types import ConfigType
 
 CODEOWNERS = ["@luigi-pi"]
 DEPENDENCIES = ["uart"]
-AUTO_LOAD = ["binary_sensor", "sensor", "text_sensor"]
 MULTI_CONF = True
 
+
+def AUTO_LOAD(config: ConfigType) -> list[str]:
+    load = ["binary_sensor", "fingerprint_base", "sensor", "text_sensor"]
+    # The camera component is only compiled in for readers with a diagnostic camera
+    confs = config if isinstance(config, list) else [config]
+    if not config or any(CONF_CAMERA in conf for conf in confs if conf):
+        return load + ["camera"]
+    return load
+
+
 CONF_FINGERPRINT_FPC2532_ID = "fingerprint_FPC2532_id"
 CONF_SENSOR_POWER_PIN = "sensor_power_pin"
 CONF_IDLE_PERIOD_TO_SLEEP = "idle_period_to_sleep"
 CONF_ENROLL_TIMEOUT = "enroll_timeout"
+CONF_MATCH_DEBOUNCE = "match_debounce"
+CONF_BIST_INTERVAL = "bist_interval"
 CONF_LOCKOUT_TIME = "lockout_time_s"
 CONF_UART_IRQ_BEFORE_TX = "uart_irq_before_tx"
 CONF_STATUS_AT_BOOT = "status_at_boot"
 CONF_STOP_MODE_UART = "stop_mode_uart"
 CONF_UART_BAUDRATE = "uart_baudrate"
+CONF_AUTO_BAUD_RATE = "auto_baud_rate"
+CONF_LIGHT_SLEEP_DURATION = "light_sleep_duration"
 CONF_MAX_CONSECUTIVE_FAILS = "max_consecutive_fails"
 CONF_TIME_BEFORE_SLEEP = "time_before_sleep_ms"
 CONF_DELAY_BEFORE_IRQ = "delay_before_irq_ms"
 CONF_FINGER_SCAN_INTERVAL = "finger_scan_interval_ms"
+CONF_ON_TEMPLATE_EXPORT_CHUNK = "on_template_export_chunk"
+CONF_CAMERA = "camera"
+CONF_NAVIGATION = "navigation"
+CONF_ORIENTATION = "orientation"
+CONF_SKIP_FINGER_STABLE = "skip_finger_stable"
+CONF_ON_NAVIGATION = "on_navigation"
+CONF_FINGER_IDS = "finger_ids"
+CONF_FALLBACK = "fallback"
+CONF_GESTURE = "gesture"
+CONF_TEMPLATE_CAPACITY = "template_capacity"
+CONF_EVICTION_POLICY = "eviction_policy"
+CONF_ON_TEMPLATE_EVICTED = "on_template_evicted"
+MAX_NUMBER_OF_TEMPLATES = 30
 INITIAL_PASSWORD = "0"
 CFG_UART_BAUDRATE_9600 = 1
 CFG_UART_BAUDRATE_19200 = 2
 CFG_UART_BAUDRATE_57600 = 3
 CFG_UART_BAUDRATE_115200 = 4
 CFG_UART_BAUDRATE_921600 = 5
+MAX_HOST_PACKET_SIZE_DEFAULT = 2 * 1024
+CMD_IMAGE_REQUEST_TYPE_GET_RAW = 2
+CMD_IMAGE_REQUEST_TYPE_GET_FMI = 3
+
+CMD_NAV_CFG_SKIP_FINGER_STABLE = 0x00000004
+
+NAVIGATION_ORIENTATION_OPTIONS = {
+    0: 0x00000000,
+    90: 0x00000001,
+    180: 0x00000002,
+    270: 0x00000003,
+}
+
+NAVIGATION_GESTURE_OPTIONS = {
+    "ANY": 0,
+    "UP": 1,
+    "DOWN": 2,
+    "RIGHT": 3,
+    "LEFT": 4,
+    "PRESS": 5,
+    "LONG_PRESS": 6,
+}
+
+IMAGE_TYPE_OPTIONS = {
+    "RAW": CMD_IMAGE_REQUEST_TYPE_GET_RAW,
+    "FMI": CMD_IMAGE_REQUEST_TYPE_GET_FMI,
+}
 
 UART_BAUDRATE_OPTIONS = {
     "9600": CFG_UART_BAUDRATE_9600,
@@ -51,19 +127,14 @@ UART_BAUDRATE_OPTIONS = {
 
 fingerprint_FPC2532_ns = cg.esphome_ns.namespace("fingerprint_FPC2532")
 FingerprintFPC2532Component = fingerprint_FPC2532_ns.class_(
-    "FingerprintFPC2532Component", cg.PollingComponent, uart.UARTDevice
+    "FingerprintFPC2532Component",
+    cg.PollingComponent,
+    uart.UARTDevice,
+    FingerprintReader,
 )
 
-FingerScanStartTrigger = fingerprint_FPC2532_ns.class_(
-    "FingerScanStartTrigger", automation.Trigger.template()
-)
-
-FingerScanMatchedTrigger = fingerprint_FPC2532_ns.class_(
-    "FingerScanMatchedTrigger", automation.Trigger.template(cg.uint16, cg.uint16)
-)
-
-FingerScanUnmatchedTrigger = fingerprint_FPC2532_ns.class_(
-    "FingerScanUnmatchedTrigger", automation.Trigger.template()
+FingerprintFPC2532Camera = fingerprint_FPC2532_ns.class_(
+    "FingerprintFPC2532Camera", cg.Component, cg.EntityBase
 )
 
 FingerScanInvalidTrigger = fingerprint_FPC2532_ns.class_(
@@ -74,26 +145,100 @@ EnrollmentScanTrigger = fingerprint_FPC2532_ns.class_(
     "EnrollmentScanTrigger", automation.Trigger.template(cg.uint8, cg.uint16)
 )
 
-EnrollmentDoneTrigger = fingerprint_FPC2532_ns.class_(
-    "EnrollmentDoneTrigger", automation.Trigger.template(cg.uint16)
+NavigationTrigger = fingerprint_FPC2532_ns.class_(
+    "NavigationTrigger", automation.Trigger.template(cg.uint16)
+)
+
+TemplateExportChunkTrigger = fingerprint_FPC2532_ns.class_(
+    "TemplateExportChunkTrigger",
+    automation.Trigger.template(
+        cg.uint16,
+        cg.uint32,
+        cg.uint32,
+        cg.uint8.operator("const").operator("ptr"),
+        cg.uint16,
+    ),
 )
 
-EnrollmentFailedTrigger = fingerprint_FPC2532_ns.class_(
-    "EnrollmentFailedTrigger", automation.Trigger.template(cg.uint16)
+TemplateEvictedTrigger = fingerprint_FPC2532_ns.class_(
+    "TemplateEvictedTrigger", automation.Trigger.template(cg.uint16)
 )
 
+FpcEvictionPolicy = fingerprint_FPC2532_ns.enum("FpcEvictionPolicy")
+EVICTION_POLICY_OPTIONS = {
+    "NONE": FpcEvictionPolicy.FPC_EVICTION_NONE,
+    "LEAST_RECENTLY_MATCHED": FpcEvictionPolicy.FPC_EVICTION_LEAST_RECENTLY_MATCHED,
+}
+
 EnrollmentAction = fingerprint_FPC2532_ns.class_("EnrollmentAction", automation.Action)
 CancelEnrollmentAction = fingerprint_FPC2532_ns.class_(
     "CancelEnrollmentAction", automation.Action
 )
 DeleteAction = fingerprint_FPC2532_ns.class_("DeleteAction", automation.Action)
+StartNavigationAction = fingerprint_FPC2532_ns.class_(
+    "StartNavigationAction", automation.Action
+)
+StopNavigationAction = fingerprint_FPC2532_ns.class_(
+    "StopNavigationAction", automation.Action
+)
+UartBenchmarkAction = fingerprint_FPC2532_ns.class_(
+    "UartBenchmarkAction", automation.Action
+)
+BistAction = fingerprint_FPC2532_ns.class_("BistAction", automation.Action)
+SetIdentifySubsetAction = fingerprint_FPC2532_ns.class_(
+    "SetIdentifySubsetAction", automation.Action
+)
+ClearIdentifySubsetAction = fingerprint_FPC2532_ns.class_(
+    "ClearIdentifySubsetAction", automation.Action
+)
+ExportTemplateAction = fingerprint_FPC2532_ns.class_(
+    "ExportTemplateAction", automation.Action
+)
+ImportTemplateAction = fingerprint_FPC2532_ns.class_(
+    "ImportTemplateAction", automation.Action
+)
+ImportTemplateChunkAction = fingerprint_FPC2532_ns.class_(
+    "ImportTemplateChunkAction", automation.Action
+)
+
+def _validate_sensing_pin(config):
+    # In event-driven mode the loop only wakes up on the IRQ raised before each UART transmission
+    if CONF_SENSING_PIN in config and not config[CONF_UART_IRQ_BEFORE_TX]:
+        raise cv.Invalid(
+            f"'{CONF_SENSING_PIN}' requires '{CONF_UART_IRQ_BEFORE_TX}' to be enabled"
+        )
+    return config
+
+
+def _validate_light_sleep(config):
+    # The host sleeps until the sensor raises its IRQ line; the delay before TX covers the wakeup time
+    if CONF_LIGHT_SLEEP_DURATION not in config:
+        return config
+    if not CORE.is_esp32:
+        raise cv.Invalid(f"'{CONF_LIGHT_SLEEP_DURATION}' is only available on ESP32")
+    if CONF_SENSING_PIN not in config:
+        raise cv.Invalid(f"'{CONF_LIGHT_SLEEP_DURATION}' requires '{CONF_SENSING_PIN}'")
+    if config[CONF_DELAY_BEFORE_IRQ].total_milliseconds < 1:
+        raise cv.Invalid(
+            f"'{CONF_LIGHT_SLEEP_DURATION}' requires '{CONF_DELAY_BEFORE_IRQ}' of at least 1ms"
+        )
+    return config
+
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(FingerprintFPC2532Component),
+            cv.Optional(CONF_SENSING_PIN): pins.internal_gpio_input_pin_schema,
             cv.Optional(CONF_SENSOR_POWER_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_ENROLL_TIMEOUT): cv.positive_time_period_seconds,
+            cv.Optional(
+                CONF_MATCH_DEBOUNCE, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_BIST_INTERVAL): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(minutes=1)),
+            ),
             cv.Optional(
                 CONF_LOCKOUT_TIME, default="15s"
             ): cv.positive_time_period_seconds,
@@ -103,6 +248,11 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_UART_BAUDRATE, default="921600"): cv.enum(
                 UART_BAUDRATE_OPTIONS
             ),
+            cv.Optional(CONF_AUTO_BAUD_RATE, default=False): cv.boolean,
+            cv.Optional(CONF_LIGHT_SLEEP_DURATION): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=1)),
+            ),
             cv.Optional(CONF_MAX_CONSECUTIVE_FAILS, default=5): cv.uint8_t,
             cv.Optional(
                 CONF_TIME_BEFORE_SLEEP, default="0ms"
@@ -114,6 +264,39 @@ CONFIG_SCHEMA = cv.All(
                 CONF_FINGER_SCAN_INTERVAL, default="34ms"
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_PASSWORD, default=INITIAL_PASSWORD): cv.string_strict,
+            cv.Optional(
+                CONF_TEMPLATE_CAPACITY, default=MAX_NUMBER_OF_TEMPLATES
+            ): cv.int_range(min=1, max=MAX_NUMBER_OF_TEMPLATES),
+            cv.Optional(CONF_EVICTION_POLICY, default="NONE"): cv.enum(
+                EVICTION_POLICY_OPTIONS, upper=True, space="_"
+            ),
+            cv.Optional(
+                CONF_RX_BUFFER_SIZE, default=MAX_HOST_PACKET_SIZE_DEFAULT
+            ): cv.All(cv.validate_bytes, cv.int_range(min=128, max=65535)),
+            cv.Optional(CONF_CAMERA): cv.ENTITY_BASE_SCHEMA.extend(
+                {
+                    cv.GenerateID(): cv.declare_id(FingerprintFPC2532Camera),
+                    cv.Optional(CONF_TYPE, default="RAW"): cv.enum(
+                        IMAGE_TYPE_OPTIONS, upper=True
+                    ),
+                }
+            ).extend(cv.COMPONENT_SCHEMA),
+            cv.Optional(CONF_NAVIGATION): cv.Schema(
+                {
+                    cv.Optional(CONF_ORIENTATION, default=0): cv.enum(
+                        NAVIGATION_ORIENTATION_OPTIONS, int=True
+                    ),
+                    cv.Optional(CONF_SKIP_FINGER_STABLE, default=False): cv.boolean,
+                }
+            ),
+            cv.Optional(CONF_ON_NAVIGATION): automation.validate_automation(
+                {
+                    cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(NavigationTrigger),
+                    cv.Optional(CONF_GESTURE, default="ANY"): cv.enum(
+                        NAVIGATION_GESTURE_OPTIONS, upper=True, space="_"
+                    ),
+                }
+            ),
             cv.Optional(CONF_ON_FINGER_SCAN_START): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -128,6 +311,8 @@ CONFIG_SCHEMA = cv.All(
                     ),
                 }
             ),
+            cv.Optional(CONF_USERS): USERS_SCHEMA,
+            cv.Optional(CONF_ON_USER_MATCHED): USER_MATCHED_SCHEMA,
             cv.Optional(CONF_ON_FINGER_SCAN_UNMATCHED): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -163,10 +348,28 @@ CONFIG_SCHEMA = cv.All(
                     ),
                 }
             ),
+            cv.Optional(CONF_ON_TEMPLATE_EVICTED): automation.validate_automation(
+                {
+                    cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
+                        TemplateEvictedTrigger
+                    ),
+                }
+            ),
+            cv.Optional(
+                CONF_ON_TEMPLATE_EXPORT_CHUNK
+            ): automation.validate_automation(
+                {
+                    cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
+                        TemplateExportChunkTrigger
+                    ),
+                }
+            ),
         }
     )
     .extend(cv.polling_component_schema("500ms"))
-    .extend(uart.UART_DEVICE_SCHEMA)
+    .extend(uart.UART_DEVICE_SCHEMA),
+    _validate_sensing_pin,
+    _validate_light_sleep,
 )
 
 
@@ -202,6 +405,8 @@ async def to_code(config):
         uart_baudrate = config[CONF_UART_BAUDRATE]
         cg.add(var.set_uart_baudrate(uart_baudrate))
 
+    cg.add(var.set_auto_baud_rate(config[CONF_AUTO_BAUD_RATE]))
+
     if CONF_STOP_MODE_UART in config:
         stop_mode_uart = config[CONF_STOP_MODE_UART]
         cg.add(var.set_stop_mode_uart(stop_mode_uart))
@@ -214,14 +419,49 @@ async def to_code(config):
         uart_irq_before_tx = config[CONF_UART_IRQ_BEFORE_TX]
         cg.add(var.set_uart_irq_before_tx(uart_irq_before_tx))
 
+    cg.add(var.set_rx_buffer_size(config[CONF_RX_BUFFER_SIZE]))
+
+    if CONF_SENSING_PIN in config:
+        sensing_pin = await cg.gpio_pin_expression(config[CONF_SENSING_PIN])
+        cg.add(var.set_sensing_pin(sensing_pin))
+
+    if CONF_LIGHT_SLEEP_DURATION in config:
+        cg.add(var.set_light_sleep_duration_ms(config[CONF_LIGHT_SLEEP_DURATION]))
+
     if CONF_SENSOR_POWER_PIN in config:
         sensor_power_pin = await cg.gpio_pin_expression(config[CONF_SENSOR_POWER_PIN])
         cg.add(var.set_sensor_power_pin(sensor_power_pin))
 
+    cg.add(var.set_match_debounce_ms(config[CONF_MATCH_DEBOUNCE]))
+    cg.add(var.set_template_capacity(config[CONF_TEMPLATE_CAPACITY]))
+    cg.add(var.set_eviction_policy(config[CONF_EVICTION_POLICY]))
+    if CONF_BIST_INTERVAL in config:
+        cg.add(var.set_bist_interval_ms(config[CONF_BIST_INTERVAL]))
+
     if CONF_ENROLL_TIMEOUT in config:
         enroll_timeout_ms = config[CONF_ENROLL_TIMEOUT]
         cg.add(var.set_enroll_timeout_ms(enroll_timeout_ms))
 
+    if camera_config := config.get(CONF_CAMERA):
+        cg.add_define("USE_CAMERA")
+        camera = cg.new_Pvariable(camera_config[CONF_ID])
+        await setup_entity(camera, camera_config, "camera")
+        await cg.register_component(camera, camera_config)
+        await cg.register_parented(camera, var)
+        cg.add(camera.set_image_type(camera_config[CONF_TYPE]))
+        cg.add(var.set_camera(camera))
+
+    if navigation_config := config.get(CONF_NAVIGATION):
+        navigation_flags = navigation_config[CONF_ORIENTATION].enum_value
+        if navigation_config[CONF_SKIP_FINGER_STABLE]:
+            navigation_flags |= CMD_NAV_CFG_SKIP_FINGER_STABLE
+        cg.add(var.set_navigation_config(navigation_flags))
+        cg.add(var.set_navigation_enabled(True))
+
+    for conf in config.get(CONF_ON_NAVIGATION, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var, conf[CONF_GESTURE])
+        await automation.build_automation(trigger, [(cg.uint16, "gesture")], conf)
+
     for conf in config.get(CONF_ON_FINGER_SCAN_START, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [], conf)
@@ -232,6 +472,8 @@ async def to_code(config):
             trigger, [(cg.uint16, "finger_id"), (cg.uint16, "tag")], conf
         )
 
+    await setup_users(var, config)
+
     for conf in config.get(CONF_ON_FINGER_SCAN_UNMATCHED, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [], conf)
@@ -252,6 +494,27 @@ async def to_code(config):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [(cg.uint16, "finger_id")], conf)
 
+    for conf in config.get(CONF_ON_TEMPLATE_EVICTED, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(cg.uint16, "finger_id")], conf)
+
+    for conf in config.get(CONF_ON_TEMPLATE_EXPORT_CHUNK, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(
+            trigger,
+            [
+                (cg.uint16, "finger_id"),
+                (cg.uint32, "offset"),
+                (cg.uint32, "total_size"),
+                (cg.uint8.operator("const").operator("ptr"), "data"),
+                (cg.uint16, "size"),
+            ],
+            conf,
+        )
+
+
+register_user_actions("fingerprint_FPC2532", FingerprintFPC2532Component)
+
 
 @automation.register_action(
     "fingerprint_FPC2532.enroll",
@@ -311,3 +574,187 @@ async def fingerprint_FPC2532_delete_to_code(config, action_id, template_arg, ar
     template_ = await cg.templatable(config[CONF_FINGER_ID], args, cg.uint16)
     cg.add(var.set_finger_id(template_))
     return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.export_template",
+    ExportTemplateAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+            cv.Required(CONF_FINGER_ID): cv.templatable(cv.uint16_t),
+        },
+        key=CONF_FINGER_ID,
+    ),
+)
+async def fingerprint_FPC2532_export_template_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    template_ = await cg.templatable(config[CONF_FINGER_ID], args, cg.uint16)
+    cg.add(var.set_finger_id(template_))
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.import_template",
+    ImportTemplateAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+            cv.Required(CONF_FINGER_ID): cv.templatable(cv.uint16_t),
+            cv.Required(CONF_SIZE): cv.templatable(cv.uint16_t),
+        }
+    ),
+)
+async def fingerprint_FPC2532_import_template_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    template_ = await cg.templatable(config[CONF_FINGER_ID], args, cg.uint16)
+    cg.add(var.set_finger_id(template_))
+    template_ = await cg.templatable(config[CONF_SIZE], args, cg.uint16)
+    cg.add(var.set_size(template_))
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.import_template_chunk",
+    ImportTemplateChunkAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+            cv.Required(CONF_DATA): cv.templatable(cv.ensure_list(cv.hex_uint8_t)),
+        },
+        key=CONF_DATA,
+    ),
+)
+async def fingerprint_FPC2532_import_template_chunk_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    data = config[CONF_DATA]
+    if cg.is_template(data):
+        template_ = await cg.templatable(data, args, cg.std_vector.template(cg.uint8))
+    else:
+        template_ = cg.std_vector.template(cg.uint8)(data)
+    cg.add(var.set_data(template_))
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.start_navigation",
+    StartNavigationAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+        }
+    ),
+)
+@automation.register_action(
+    "fingerprint_FPC2532.stop_navigation",
+    StopNavigationAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+        }
+    ),
+)
+async def fingerprint_FPC2532_navigation_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.uart_benchmark",
+    UartBenchmarkAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+        }
+    ),
+)
+async def fingerprint_FPC2532_uart_benchmark_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.bist",
+    BistAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+        }
+    ),
+)
+async def fingerprint_FPC2532_bist_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.set_identify_subset",
+    SetIdentifySubsetAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+            cv.Required(CONF_FINGER_IDS): cv.templatable(
+                cv.All(cv.ensure_list(cv.uint16_t), cv.Length(min=1))
+            ),
+            cv.Optional(CONF_TAG, default=1): cv.templatable(
+                cv.int_range(min=1, max=65535)
+            ),
+            cv.Optional(CONF_FALLBACK, default=True): cv.templatable(cv.boolean),
+        }
+    ),
+)
+async def fingerprint_FPC2532_set_identify_subset_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    finger_ids = config[CONF_FINGER_IDS]
+    if cg.is_template(finger_ids):
+        template_ = await cg.templatable(
+            finger_ids, args, cg.std_vector.template(cg.uint16)
+        )
+    else:
+        template_ = cg.std_vector.template(cg.uint16)(finger_ids)
+    cg.add(var.set_finger_ids(template_))
+    template_ = await cg.templatable(config[CONF_TAG], args, cg.uint16)
+    cg.add(var.set_tag(template_))
+    template_ = await cg.templatable(config[CONF_FALLBACK], args, cg.bool_)
+    cg.add(var.set_fallback(template_))
+    return var
+
+
+@automation.register_action(
+    "fingerprint_FPC2532.clear_identify_subset",
+    ClearIdentifySubsetAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintFPC2532Component),
+        }
+    ),
+)
+async def fingerprint_FPC2532_clear_identify_subset_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
@@ -0,0 +1,43 @@
+import esphome.codegen as cg
+from esphome.components import event
+import esphome.config_validation as cv
+
+from . import CONF_FINGERPRINT_FPC2532_ID, FingerprintFPC2532Component
+
+DEPENDENCIES = ["fingerprint_FPC2532"]
+
+CONF_ENROLLMENT = "enrollment"
+ICON_ENROLL = "mdi:key-plus"
+
+# One event per enrollment step; samples remaining is available from get_enrollment_session()
+ENROLLMENT_EVENT_TYPES = [
+    "started",
+    "progress",
+    "progress_immobile",
+    "rejected_low_quality",
+    "rejected_low_coverage",
+    "rejected_low_mobility",
+    "rejected_other",
+    "done",
+    "failed",
+    "cancelled",
+]
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_FINGERPRINT_FPC2532_ID): cv.use_id(
+            FingerprintFPC2532Component
+        ),
+        cv.Optional(CONF_ENROLLMENT): event.event_schema(icon=ICON_ENROLL),
+    }
+)
+
+
+async def to_code(config):
+    hub = await cg.get_variable(config[CONF_FINGERPRINT_FPC2532_ID])
+
+    if CONF_ENROLLMENT in config:
+        evt = await event.new_event(
+            config[CONF_ENROLLMENT], event_types=ENROLLMENT_EVENT_TYPES
+        )
+        cg.add(hub.set_enrollment_event(evt))
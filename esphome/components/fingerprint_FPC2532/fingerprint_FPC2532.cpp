@@ -1,16 +1,28 @@
 #include "fingerprint_FPC2532.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
 //#include "esphome.h"
+#include <algorithm>
 #include <cinttypes>
 #include <vector>
 #include <string>
 #include "fpc_api.h"
+#include "fpc_camera.h"
+
+#ifdef USE_ESP32
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
 
 namespace esphome {
 namespace fingerprint_FPC2532 {
 
 static const char *const TAG = "fingerprint_FPC2532";
 
+// Host baud rate of each CFG_UART_BAUDRATE_* index
+static const uint32_t FPC_BAUD_RATES[] = {0, 9600, 19200, 57600, 115200, 921600};
+static const uint8_t FPC_BAUD_RATES_COUNT = sizeof(FPC_BAUD_RATES) / sizeof(FPC_BAUD_RATES[0]);
+
 /*Helper functions*/
 
 static const char *get_id_type_str_(uint16_t id_type) {
@@ -208,13 +220,26 @@ static const char *app_state_wait_str_(uint16_t app_state) {
       return "wait to receive config";
     case APP_STATE_SET_CONFIG:
       return "wait to SET config";
+    case APP_STATE_WAIT_TEMPLATE_EXPORT:
+      return "wait for Template Export";
+    case APP_STATE_WAIT_TEMPLATE_IMPORT:
+      return "wait for Template Import";
+    case APP_STATE_WAIT_IMAGE_CAPTURE:
+      return "wait for Image Capture";
+    case APP_STATE_WAIT_IMAGE_DATA:
+      return "wait for Image Data";
+    case APP_STATE_WAIT_BAUD_SWITCH:
+      return "wait for Baud Rate Switch";
+    case APP_STATE_WAIT_BENCHMARK:
+      return "wait for UART Benchmark";
+    case APP_STATE_WAIT_NAVIGATION:
+      return "wait for Navigation";
+    case APP_STATE_WAIT_BIST:
+      return "wait for Self Test";
   }
   return "app state Unknown";
 }
 
-/** Command callback functions. */
-FingerprintFPC2532Component::fpc_cmd_callbacks_t cmd_callbacks;
-
 void FingerprintFPC2532Component::on_error(uint16_t error) {
   ESP_LOGI(TAG, "Got error %d.\n", error);
   // quit = 1;
@@ -253,25 +278,111 @@ void FingerprintFPC2532Component::on_list_templates(int num_templates, uint16_t
 }
 
 void FingerprintFPC2532Component::update() {
-  fpc::fpc_result_t result;
-  size_t n = this->available();
-  if (n) {
-    ESP_LOGVV(TAG, "number of bytes available to read: %d", n);
-    result = fpc_host_sample_handle_rx_data();
-    if (result != FPC_RESULT_OK && result != FPC_PENDING_OPERATION) {
-      ESP_LOGE(TAG, "Bad incoming data (%d). Wait and try again", result);
-      this->fpc_hal_delay_ms(10);
+  this->cmd_batching_ = true;
+  this->process_state();
+  this->cmd_batching_ = false;
+  this->fpc_cmd_send_next_();
+}
+
+void IRAM_ATTR FingerprintFPC2532Component::gpio_intr(FingerprintFPC2532Component *arg) {
+  // The sensor raises its IRQ line before every UART transmission
+  arg->enable_loop_soon_any_context();
+}
+
+bool FingerprintFPC2532Component::loop_can_idle_() {
+  // Only sleep while armed for the idle operation with nothing on the wire; everything else needs the loop to advance.
+  return this->cmds_in_flight_ == 0 && this->cmd_queue_count_ == 0 && this->available() == 0 &&
+         this->rx_state_ == RX_STATE_HEADER && this->rx_pos_ == 0 && this->delay_until_ == 0 &&
+         ((this->app_state == APP_STATE_WAIT_IDENTIFY && (this->device_state_ & STATE_IDENTIFY)) ||
+          (this->app_state == APP_STATE_WAIT_NAVIGATION && (this->device_state_ & STATE_NAVIGATION)));
+}
+
+void FingerprintFPC2532Component::loop() {
+  // Requests made while handling the responses and advancing the state machine go out as one burst
+  this->cmd_batching_ = true;
+  this->loop_steps_();
+  this->cmd_batching_ = false;
+  this->fpc_cmd_send_next_();
+#ifdef USE_POWER_MANAGEMENT
+  this->performance_lock_.set(!this->loop_can_idle_());
+#endif
+}
+
+void FingerprintFPC2532Component::loop_steps_() {
+  // Responses are matched here so the command pipeline keeps moving between update() intervals.
+  if (this->available() > 0) {
+    fpc::fpc_result_t result = fpc_host_sample_handle_rx_data();
+    if (result == FPC_RESULT_IO_RUNTIME_FAILURE) {
+      // Framing errors are recovered by the parser itself; only a failing UART needs a new handshake.
+      ESP_LOGE(TAG, "UART read failed. Requesting status again");
       this->password_verified_ = false;
       this->app_state = APP_STATE_WAIT_READY;
       fpc_cmd_status_request();
     }
-  } else {
-    ESP_LOGVV(TAG, "No data available");
   }
+
+  if (this->sensing_pin_ == nullptr)
+    return;
+
   this->process_state();
+  if (this->loop_can_idle_()) {
+#ifdef USE_ESP32
+    if (this->light_sleep_duration_ms_ > 0) {
+      // The loop keeps running so the host can go back to sleep after every other component had its turn
+      this->enter_light_sleep_();
+      return;
+    }
+#endif
+    ESP_LOGVV(TAG, "Idle, waiting for sensor IRQ");
+    this->disable_loop();
+  }
+}
+
+#ifdef USE_ESP32
+void FingerprintFPC2532Component::enter_light_sleep_() {
+  // Give the sensor the same grace period it takes before sleeping itself
+  if (millis() - this->last_activity_ms_ < this->time_before_sleep_ms_)
+    return;
+  // IRQ already raised: a frame is on its way
+  if (this->sensing_pin_->digital_read())
+    return;
+
+  const auto pin = static_cast<gpio_num_t>(this->sensing_pin_->get_pin());
+  gpio_wakeup_enable(pin, this->sensing_pin_->is_inverted() ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(this->light_sleep_duration_ms_) * 1000);
+
+  const uint32_t start = micros();
+  esp_light_sleep_start();
+  this->slept_us_ += micros() - start;
+
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  gpio_wakeup_disable(pin);
+  // The wakeup configuration replaced the edge interrupt of the pin
+  this->sensing_pin_->attach_interrupt(&FingerprintFPC2532Component::gpio_intr, this, gpio::INTERRUPT_RISING_EDGE);
+}
+#endif
+
+void FingerprintFPC2532Component::publish_wake_duty_cycle_() {
+  const uint32_t now = micros();
+  const uint32_t elapsed = now - this->duty_cycle_start_us_;
+  if (elapsed == 0)
+    return;
+  const float duty_cycle = 100.0f * (1.0f - std::min(1.0f, float(this->slept_us_) / float(elapsed)));
+  this->wake_duty_cycle_sensor_->publish_state(duty_cycle);
+  this->slept_us_ = 0;
+  this->duty_cycle_start_us_ = now;
 }
 
 void FingerprintFPC2532Component::setup() {
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  this->rx_buffer_ = allocator.allocate(this->rx_buffer_size_);
+  if (this->rx_buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate %u bytes for the rx buffer", (unsigned) this->rx_buffer_size_);
+    this->mark_failed();
+    return;
+  }
   this->hal_reset_device();
   this->fpc_hal_init();
   // this->fpc_cmd_abort();
@@ -294,10 +405,779 @@ void FingerprintFPC2532Component::setup() {
   if (this->enrolling_binary_sensor_ != nullptr) {
     this->enrolling_binary_sensor_->publish_state(false);
   }
+  if (this->sensing_pin_ != nullptr) {
+    // Event-driven mode: loop() runs the state machine and sleeps until the sensor raises its IRQ line.
+    this->sensing_pin_->setup();
+    this->sensing_pin_->attach_interrupt(&FingerprintFPC2532Component::gpio_intr, this, gpio::INTERRUPT_RISING_EDGE);
+    this->stop_poller();
+  }
+  // The password is the sensor unique ID, so it keys the cache to a single device.
+  uint32_t hash = fnv1_hash("fingerprint_FPC2532_templates") ^ fnv1_hash(this->password_);
+  this->template_cache_pref_ = global_preferences->make_preference<FpcTemplateCache>(hash);
+  if (this->template_cache_pref_.load(&this->template_cache_) &&
+      this->template_cache_.count <= MAX_NUMBER_OF_TEMPLATES) {
+    ESP_LOGD(TAG, "Loaded %u cached template(s), generation %" PRIu32, this->template_cache_.count,
+             this->template_cache_.generation);
+    this->template_cache_valid_ = true;
+    this->n_templates_on_device_ = this->template_cache_.count;
+    if (this->template_cache_.capacity > 0 && this->template_cache_.capacity < this->template_capacity_)
+      this->template_capacity_ = this->template_cache_.capacity;
+    this->publish_template_storage_();
+  } else {
+    this->template_cache_ = {};
+  }
   this->app_state = APP_STATE_WAIT_READY;
+  for (this->baud_probe_index_ = FPC_BAUD_RATES_COUNT - 1; this->baud_probe_index_ > 1; this->baud_probe_index_--) {
+    if (FPC_BAUD_RATES[this->baud_probe_index_] == this->parent_->get_baud_rate())
+      break;
+  }
+  if (this->wake_duty_cycle_sensor_ != nullptr) {
+    this->duty_cycle_start_us_ = micros();
+    this->set_interval("wake_duty_cycle", FPC_DUTY_CYCLE_INTERVAL_MS, [this]() { this->publish_wake_duty_cycle_(); });
+  }
+  if (this->uart_round_trip_time_sensor_ != nullptr || this->uart_frame_rate_sensor_ != nullptr) {
+    // Served once the boot sequence reaches its first dispatch point
+    this->request_uart_benchmark();
+  }
+  if (this->bist_interval_ms_ > 0) {
+    this->set_interval("bist", this->bist_interval_ms_, [this]() { this->schedule_bist_(); });
+  }
   this->fpc_cmd_status_request();
 }
 
+/*
+------------------------
+TEMPLATE CACHE
+------------------------
+*/
+
+bool FingerprintFPC2532Component::has_template(uint16_t id) const {
+  for (uint8_t i = 0; i < this->template_cache_.count; i++) {
+    if (this->template_cache_.ids[i] == id)
+      return true;
+  }
+  return false;
+}
+
+uint16_t FingerprintFPC2532Component::find_free_template_id() const {
+  if (!this->template_cache_valid_ || this->template_cache_.count >= this->template_capacity_)
+    return 0;
+  // With fewer than MAX_NUMBER_OF_TEMPLATES IDs in use, one of the first MAX_NUMBER_OF_TEMPLATES + 1 is free.
+  for (uint16_t id = 1; id <= MAX_NUMBER_OF_TEMPLATES + 1; id++) {
+    if (!this->has_template(id))
+      return id;
+  }
+  return 0;
+}
+
+uint8_t FingerprintFPC2532Component::get_free_template_slots() const {
+  if (this->n_templates_on_device_ >= this->template_capacity_)
+    return 0;
+  return this->template_capacity_ - this->n_templates_on_device_;
+}
+
+uint32_t FingerprintFPC2532Component::get_template_last_match(uint16_t id) const {
+  for (uint8_t i = 0; i < this->template_cache_.count; i++) {
+    if (this->template_cache_.ids[i] == id)
+      return this->template_cache_.last_match[i];
+  }
+  return 0;
+}
+
+uint16_t FingerprintFPC2532Component::find_eviction_candidate() const {
+  if (!this->template_cache_valid_ || this->template_cache_.count == 0)
+    return 0;
+  uint8_t oldest = 0;
+  for (uint8_t i = 1; i < this->template_cache_.count; i++) {
+    if (this->template_cache_.last_match[i] < this->template_cache_.last_match[oldest])
+      oldest = i;
+  }
+  return this->template_cache_.ids[oldest];
+}
+
+void FingerprintFPC2532Component::record_template_match_(uint16_t id) {
+  for (uint8_t i = 0; i < this->template_cache_.count; i++) {
+    if (this->template_cache_.ids[i] == id) {
+      this->template_cache_.last_match[i] = ++this->template_cache_.match_clock;
+      this->template_cache_pref_.save(&this->template_cache_);
+      return;
+    }
+  }
+}
+
+bool FingerprintFPC2532Component::learn_template_capacity_() {
+  const uint8_t count = this->template_cache_.count;
+  if (!this->template_cache_valid_ || count == 0 || count >= this->template_capacity_)
+    return false;
+  ESP_LOGW(TAG, "Sensor storage full with %u template(s), capacity lowered from %u", count, this->template_capacity_);
+  this->template_capacity_ = count;
+  this->template_cache_.capacity = count;
+  this->template_cache_pref_.save(&this->template_cache_);
+  this->publish_template_storage_();
+  return true;
+}
+
+bool FingerprintFPC2532Component::evict_for_enroll_(const FpcRequest &request) {
+  if (this->eviction_policy_ == FPC_EVICTION_NONE)
+    return false;
+  const uint16_t victim = this->find_eviction_candidate();
+  if (victim == 0 || this->requests_count_ + 2 > FPC_REQUEST_QUEUE_SIZE)
+    return false;
+  if (victim == this->evicted_id_) {
+    // The last eviction did not free its slot, deleting it again would loop
+    ESP_LOGE(TAG, "Template %u could not be evicted", victim);
+    this->evicted_id_ = 0;
+    return false;
+  }
+  ESP_LOGI(TAG, "Storage full, evicting template %u (last match %" PRIu32 " of %" PRIu32 ")", victim,
+           this->get_template_last_match(victim), this->template_cache_.match_clock);
+  this->evicted_id_ = victim;
+  // Deletes are served first; the enroll runs after them against a fresh template list.
+  this->requests_[this->requests_count_++] = request;
+  this->requests_[this->requests_count_++] = {FPC_REQUEST_DELETE, {ID_TYPE_SPECIFIED, victim}};
+  this->publish_request_queue_depth_();
+  this->template_evicted_callback_.call(victim);
+  return true;
+}
+
+void FingerprintFPC2532Component::publish_template_storage_() {
+  if (this->fingerprint_count_sensor_ != nullptr)
+    this->fingerprint_count_sensor_->publish_state(this->n_templates_on_device_);
+  if (this->capacity_sensor_ != nullptr)
+    this->capacity_sensor_->publish_state(this->template_capacity_);
+  if (this->free_template_slots_sensor_ != nullptr)
+    this->free_template_slots_sensor_->publish_state(this->get_free_template_slots());
+}
+
+void FingerprintFPC2532Component::update_template_cache_(uint16_t count, const uint16_t *ids) {
+  const uint8_t n = std::min<uint16_t>(count, MAX_NUMBER_OF_TEMPLATES);
+  const uint32_t device_hash = fnv1_hash(this->unique_id_);
+  bool changed = !this->template_cache_valid_ || this->template_cache_.device_hash != device_hash ||
+                 this->template_cache_.count != n ||
+                 memcmp(this->template_cache_.ids, ids, n * sizeof(uint16_t)) != 0;
+
+  this->template_cache_valid_ = true;
+  if (changed) {
+    // Templates keep their last match; new ones count as matched when enrolled, so they are not evicted first.
+    uint32_t last_match[MAX_NUMBER_OF_TEMPLATES]{};
+    const bool same_device = this->template_cache_.device_hash == device_hash;
+    // The sensor confirms deletes and evictions by leaving the templates out of the list, their users go with them
+    for (uint8_t j = 0; same_device && j < this->template_cache_.count; j++) {
+      if (std::find(ids, ids + n, this->template_cache_.ids[j]) == ids + n)
+        this->drop_user_(this->template_cache_.ids[j]);
+    }
+    for (uint8_t i = 0; i < n; i++) {
+      last_match[i] = this->template_cache_.match_clock;
+      for (uint8_t j = 0; same_device && j < this->template_cache_.count; j++) {
+        if (this->template_cache_.ids[j] == ids[i])
+          last_match[i] = this->template_cache_.last_match[j];
+      }
+    }
+    this->template_cache_.generation++;
+    if (!same_device)
+      this->template_cache_.capacity = 0;
+    this->template_cache_.device_hash = device_hash;
+    this->template_cache_.count = n;
+    memset(this->template_cache_.ids, 0, sizeof(this->template_cache_.ids));
+    memcpy(this->template_cache_.ids, ids, n * sizeof(uint16_t));
+    memcpy(this->template_cache_.last_match, last_match, sizeof(last_match));
+    this->template_cache_pref_.save(&this->template_cache_);
+    ESP_LOGD(TAG, "Template cache updated, generation %" PRIu32, this->template_cache_.generation);
+  }
+  if (this->evicted_id_ != 0 && !this->has_template(this->evicted_id_))
+    this->evicted_id_ = 0;
+}
+
+void FingerprintFPC2532Component::invalidate_template_cache_() { this->template_cache_valid_ = false; }
+
+void FingerprintFPC2532Component::request_enroll(uint16_t finger_id) {
+  if (finger_id && this->template_cache_valid_ && this->has_template(finger_id)) {
+    ESP_LOGW(TAG, "Template %u is already enrolled", finger_id);
+    this->enrollment_failed_(finger_id);
+    return;
+  }
+  // Without an ID the free slot is picked when the request is started, after earlier requests have run.
+  fpc::fpc_id_type_t id_type = {ID_TYPE_GENERATE_NEW, 0};
+  if (finger_id)
+    id_type = {ID_TYPE_SPECIFIED, finger_id};
+  this->queue_request_(FPC_REQUEST_ENROLL, id_type);
+}
+
+void FingerprintFPC2532Component::request_delete(uint16_t finger_id) {
+  if (this->template_cache_valid_ && !this->has_template(finger_id)) {
+    ESP_LOGW(TAG, "Template %u is not enrolled, nothing to delete", finger_id);
+    return;
+  }
+  this->queue_request_(FPC_REQUEST_DELETE, {ID_TYPE_SPECIFIED, finger_id});
+}
+
+void FingerprintFPC2532Component::request_delete_all() { this->queue_request_(FPC_REQUEST_DELETE, {ID_TYPE_ALL, 0}); }
+
+void FingerprintFPC2532Component::request_cancel_enroll() {
+  for (int8_t i = this->requests_count_ - 1; i >= 0; i--) {
+    if (this->requests_[i].type == FPC_REQUEST_ENROLL)
+      this->remove_request_(i);
+  }
+  this->publish_request_queue_depth_();
+  if (this->app_state == APP_STATE_WAIT_ENROLL) {
+    this->fpc_cmd_abort();
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+  this->enrollment_session_end_("cancelled");
+}
+
+/*
+------------------------
+ENROLLMENT SESSION
+------------------------
+*/
+
+void FingerprintFPC2532Component::enrollment_session_begin_(uint16_t finger_id) {
+  this->enrollment_session_ = {};
+  this->enrollment_session_.active = true;
+  this->enrollment_session_.finger_id = finger_id;
+  this->enrollment_session_.start_ms = millis();
+  this->publish_enrollment_event_("started");
+}
+
+void FingerprintFPC2532Component::enrollment_session_update_(uint8_t feedback, uint8_t samples_remaining) {
+  FpcEnrollmentSession &session = this->enrollment_session_;
+  session.feedback = feedback;
+  session.samples_remaining = samples_remaining;
+
+  const char *event_type;
+  switch (feedback) {
+    case ENROLL_FEEDBACK_PROGRESS:
+      session.samples_accepted++;
+      event_type = "progress";
+      break;
+    case ENROLL_FEEDBACK_PROGRESS_IMMOBILE:
+      session.samples_accepted++;
+      event_type = "progress_immobile";
+      break;
+    case ENROLL_FEEDBACK_REJECT_LOW_QUALITY:
+      session.samples_rejected++;
+      event_type = "rejected_low_quality";
+      break;
+    case ENROLL_FEEDBACK_REJECT_LOW_COVERAGE:
+      session.samples_rejected++;
+      event_type = "rejected_low_coverage";
+      break;
+    case ENROLL_FEEDBACK_REJECT_LOW_MOBILITY:
+      session.samples_rejected++;
+      event_type = "rejected_low_mobility";
+      break;
+    case ENROLL_FEEDBACK_REJECT_OTHER:
+      session.samples_rejected++;
+      event_type = "rejected_other";
+      break;
+    default:
+      // ENROLL_FEEDBACK_DONE is reported when the session ends
+      return;
+  }
+  this->publish_enrollment_event_(event_type);
+}
+
+void FingerprintFPC2532Component::enrollment_session_end_(const char *outcome) {
+  FpcEnrollmentSession &session = this->enrollment_session_;
+  // Failures before a session started (already enrolled, queue full) only go to on_enrollment_failed
+  if (!session.active)
+    return;
+  ESP_LOGI(TAG, "Enrollment of template %u %s: %u sample(s) accepted, %u rejected, %" PRIu32 " ms", session.finger_id,
+           outcome, session.samples_accepted, session.samples_rejected, millis() - session.start_ms);
+  session.active = false;
+  this->publish_enrollment_event_(outcome);
+}
+
+void FingerprintFPC2532Component::enrollment_failed_(uint16_t finger_id) {
+  this->enrollment_failed_callback_.call(finger_id);
+  this->enrollment_session_end_("failed");
+}
+
+void FingerprintFPC2532Component::publish_enrollment_event_(const char *event_type) {
+#ifdef USE_EVENT
+  if (this->enrollment_event_ != nullptr)
+    this->enrollment_event_->trigger(event_type);
+#endif
+}
+
+/*
+------------------------
+TEMPLATE TRANSFER
+------------------------
+*/
+
+void FingerprintFPC2532Component::request_template_export(uint16_t finger_id) {
+  if (this->template_cache_valid_ && !this->has_template(finger_id)) {
+    ESP_LOGW(TAG, "Template %u is not enrolled, nothing to export", finger_id);
+    return;
+  }
+  this->queue_request_(FPC_REQUEST_EXPORT, {ID_TYPE_SPECIFIED, finger_id});
+}
+
+void FingerprintFPC2532Component::request_template_import(uint16_t finger_id, uint16_t total_size) {
+  if (finger_id == 0 || total_size == 0) {
+    ESP_LOGE(TAG, "Template import needs a finger_id and a size");
+    return;
+  }
+  if (this->template_cache_valid_ && this->has_template(finger_id)) {
+    ESP_LOGW(TAG, "Template %u is already enrolled, delete it before importing", finger_id);
+    return;
+  }
+  this->queue_request_(FPC_REQUEST_IMPORT, {ID_TYPE_SPECIFIED, finger_id});
+  // The size travels with the request; coalescing above only compares type and id.
+  for (uint8_t i = 0; i < this->requests_count_; i++) {
+    if (this->requests_[i].type == FPC_REQUEST_IMPORT && this->requests_[i].id.id == finger_id)
+      this->requests_[i].size = total_size;
+  }
+}
+
+bool FingerprintFPC2532Component::write_template_chunk(const std::vector<uint8_t> &data) {
+  if (this->app_state != APP_STATE_WAIT_TEMPLATE_IMPORT) {
+    ESP_LOGE(TAG, "No template import in progress");
+    return false;
+  }
+  if (data.size() > this->transfer_remaining_ - this->import_buffer_.size()) {
+    ESP_LOGE(TAG, "Template chunk of %u bytes exceeds the %" PRIu32 " bytes announced", (unsigned) data.size(),
+             this->transfer_remaining_);
+    this->finish_template_transfer_(false);
+    return false;
+  }
+  // Only the data handed in is held, the template is never buffered in full on the host.
+  this->import_buffer_.insert(this->import_buffer_.end(), data.begin(), data.end());
+  if (!this->import_put_pending_)
+    this->send_template_chunk_();
+  return true;
+}
+
+// Called once the previous DATA_PUT (or the import request) was acknowledged, so the command queue never overflows.
+void FingerprintFPC2532Component::send_template_chunk_() {
+  if (this->import_buffer_.empty()) {
+    if (this->transfer_remaining_ == 0)
+      this->finish_template_transfer_(true);
+    return;
+  }
+  uint16_t n = std::min<size_t>(FPC_TEMPLATE_CHUNK_SIZE, this->import_buffer_.size());
+  this->transfer_remaining_ -= n;
+  if (this->fpc_cmd_data_put_request(this->import_buffer_.data(), n, this->transfer_remaining_) != FPC_RESULT_OK) {
+    this->finish_template_transfer_(false);
+    return;
+  }
+  this->import_buffer_.erase(this->import_buffer_.begin(), this->import_buffer_.begin() + n);
+  this->transfer_offset_ += n;
+  this->import_put_pending_ = true;
+}
+
+void FingerprintFPC2532Component::finish_template_transfer_(bool success) {
+  const bool is_import = this->app_state == APP_STATE_WAIT_TEMPLATE_IMPORT;
+  if (success) {
+    ESP_LOGI(TAG, "Template %s done (id=%u, %" PRIu32 " bytes)", is_import ? "import" : "export", this->transfer_id_,
+             this->transfer_offset_);
+  } else {
+    ESP_LOGE(TAG, "Template %s failed (id=%u)", is_import ? "import" : "export", this->transfer_id_);
+  }
+  this->transfer_remaining_ = 0;
+  this->import_buffer_.clear();
+  this->import_buffer_.shrink_to_fit();
+  this->import_put_pending_ = false;
+  if (is_import) {
+    this->invalidate_template_cache_();
+    this->fpc_cmd_list_templates_request();
+    this->app_state = APP_STATE_WAIT_LIST_TEMPLATES;
+  } else {
+    // The sensor is idle again; waiting for abort resumes the queue or identify.
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+}
+
+void FingerprintFPC2532Component::start_idle_operation_(app_state_t *next_state) {
+  if (this->navigation_enabled_) {
+    ESP_LOGI(TAG, "Starting navigation");
+    *next_state = APP_STATE_WAIT_NAVIGATION;
+    this->fpc_cmd_navigation_request(this->navigation_config_);
+    return;
+  }
+  ESP_LOGI(TAG, "Starting identify");
+  *next_state = APP_STATE_WAIT_IDENTIFY;
+  this->send_identify_request_();
+}
+
+/*
+------------------------
+NAVIGATION
+------------------------
+*/
+
+void FingerprintFPC2532Component::start_navigation() {
+  if (this->navigation_enabled_)
+    return;
+  this->navigation_enabled_ = true;
+  // Swap the idle operation; anything else picks navigation up when it is done
+  if (this->app_state == APP_STATE_WAIT_IDENTIFY) {
+    this->fpc_cmd_abort();
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+}
+
+void FingerprintFPC2532Component::stop_navigation() {
+  if (!this->navigation_enabled_)
+    return;
+  this->navigation_enabled_ = false;
+  if (this->app_state == APP_STATE_WAIT_NAVIGATION) {
+    this->fpc_cmd_abort();
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+}
+
+/*
+------------------------
+IDENTIFY SUBSET
+------------------------
+*/
+
+void FingerprintFPC2532Component::set_identify_subset(const std::vector<uint16_t> &finger_ids, uint16_t tag,
+                                                      bool fallback) {
+  if (tag == FPC_IDENTIFY_TAG_ALL) {
+    ESP_LOGW(TAG, "Identify subset tag must not be %u", FPC_IDENTIFY_TAG_ALL);
+    return;
+  }
+  this->identify_subset_ = finger_ids;
+  this->identify_subset_tag_ = tag;
+  this->identify_subset_fallback_ = fallback;
+  ESP_LOGI(TAG, "Identify subset of %u template(s), tag %u%s", (unsigned) finger_ids.size(), tag,
+           fallback ? ", falling back to all" : "");
+  this->restart_identify_();
+}
+
+void FingerprintFPC2532Component::clear_identify_subset() {
+  if (this->identify_subset_.empty())
+    return;
+  this->identify_subset_.clear();
+  ESP_LOGI(TAG, "Identify against all templates");
+  this->restart_identify_();
+}
+
+bool FingerprintFPC2532Component::in_identify_subset_(uint16_t finger_id) const {
+  return std::find(this->identify_subset_.begin(), this->identify_subset_.end(), finger_id) !=
+         this->identify_subset_.end();
+}
+
+void FingerprintFPC2532Component::send_identify_request_() {
+  fpc::fpc_id_type_t id_type = {ID_TYPE_ALL, 0};
+  uint16_t tag = FPC_IDENTIFY_TAG_ALL;
+  if (!this->identify_subset_.empty() && !this->identify_fallback_pending_) {
+    tag = this->identify_subset_tag_;
+    if (this->identify_subset_.size() == 1)
+      id_type = {ID_TYPE_SPECIFIED, this->identify_subset_[0]};
+  }
+  this->fpc_cmd_identify_request(&id_type, tag);
+}
+
+void FingerprintFPC2532Component::restart_identify_() {
+  this->identify_fallback_pending_ = false;
+  // The identify in progress was started with the previous subset
+  if (this->app_state == APP_STATE_WAIT_IDENTIFY) {
+    this->fpc_cmd_abort();
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+}
+
+/*
+------------------------
+UART BAUD RATE / BENCHMARK
+------------------------
+*/
+
+void FingerprintFPC2532Component::switch_host_baud_rate_(uint32_t baud_rate) {
+  this->parent_->flush();
+  this->parent_->set_baud_rate(baud_rate);
+#if defined(USE_ESP8266) || defined(USE_ESP32)
+  this->parent_->load_settings(false);
+#endif
+  // Whatever was half received belongs to the old rate
+  this->rx_state_ = RX_STATE_HEADER;
+  this->rx_pos_ = 0;
+}
+
+void FingerprintFPC2532Component::start_list_templates_(app_state_t *next_state) {
+  *next_state = APP_STATE_WAIT_LIST_TEMPLATES;
+  if (this->template_cache_valid_) {
+    // Templates only change through enroll/delete, which refresh the cache themselves.
+    ESP_LOGD(TAG, "Using %u cached template(s)", this->template_cache_.count);
+    this->list_templates_done_ = true;
+  } else {
+    this->fpc_cmd_list_templates_request();
+  }
+}
+
+void FingerprintFPC2532Component::request_uart_benchmark() {
+  this->queue_request_(FPC_REQUEST_BENCHMARK, {ID_TYPE_NONE, 0});
+}
+
+void FingerprintFPC2532Component::benchmark_frame_received_() {
+  uint32_t now = micros();
+  this->benchmark_rtt_sum_us_ += now - this->benchmark_sent_us_;
+  if (--this->benchmark_remaining_ > 0) {
+    this->benchmark_sent_us_ = now;
+    this->fpc_cmd_status_request();
+    return;
+  }
+
+  uint32_t elapsed_us = now - this->benchmark_start_us_;
+  float round_trip_us = float(this->benchmark_rtt_sum_us_) / FPC_BENCHMARK_FRAMES;
+  float frames_per_s = elapsed_us > 0 ? FPC_BENCHMARK_FRAMES * 1e6f / elapsed_us : 0.0f;
+  ESP_LOGI(TAG, "UART benchmark at %" PRIu32 " baud: %.0f us round trip, %.1f frames/s", this->parent_->get_baud_rate(),
+           round_trip_us, frames_per_s);
+  if (this->uart_round_trip_time_sensor_ != nullptr)
+    this->uart_round_trip_time_sensor_->publish_state(round_trip_us);
+  if (this->uart_frame_rate_sensor_ != nullptr)
+    this->uart_frame_rate_sensor_->publish_state(frames_per_s);
+  // The sensor is idle again; waiting for abort resumes the queue or identify.
+  this->app_state = APP_STATE_WAIT_ABORT;
+}
+
+/*
+------------------------
+BUILT-IN SELF TEST
+------------------------
+*/
+
+void FingerprintFPC2532Component::request_bist() { this->queue_request_(FPC_REQUEST_BIST, {ID_TYPE_NONE, 0}); }
+
+void FingerprintFPC2532Component::schedule_bist_() {
+  // Only the idle operation is given up for a self-test, and never while someone is touching the sensor
+  const bool idle = this->app_state == APP_STATE_WAIT_IDENTIFY || this->app_state == APP_STATE_WAIT_NAVIGATION;
+  if (!idle || this->requests_count_ > 0 || (this->device_state_ & STATE_FINGER_DOWN)) {
+    ESP_LOGD(TAG, "Sensor busy, self test postponed");
+    this->set_timeout("bist_retry", FPC_BIST_RETRY_MS, [this]() { this->schedule_bist_(); });
+    return;
+  }
+  this->request_bist();
+}
+
+void FingerprintFPC2532Component::finish_bist_(uint16_t sensor_test_result, uint16_t test_verdict) {
+  const bool passed = test_verdict == FPC_RESULT_OK;
+  this->bist_history_[this->bist_history_head_] = {sensor_test_result, test_verdict};
+  this->bist_history_head_ = (this->bist_history_head_ + 1) % FPC_BIST_HISTORY_SIZE;
+  if (this->bist_history_count_ < FPC_BIST_HISTORY_SIZE)
+    this->bist_history_count_++;
+  if (passed) {
+    this->bist_consecutive_failures_ = 0;
+  } else if (this->bist_consecutive_failures_ < UINT8_MAX) {
+    this->bist_consecutive_failures_++;
+  }
+
+  const float pass_rate = this->get_bist_pass_rate();
+  if (passed) {
+    ESP_LOGI(TAG, "Self test passed (%.0f%% of the last %u)", pass_rate, this->bist_history_count_);
+  } else {
+    ESP_LOGW(TAG, "Self test failed: verdict %s (%u), sensor test %u, %u failure(s) in a row",
+             fpc_result_to_string(test_verdict), test_verdict, sensor_test_result, this->bist_consecutive_failures_);
+  }
+  if (this->bist_verdict_sensor_ != nullptr)
+    this->bist_verdict_sensor_->publish_state(test_verdict);
+  if (this->bist_pass_rate_sensor_ != nullptr)
+    this->bist_pass_rate_sensor_->publish_state(pass_rate);
+  if (this->bist_consecutive_failures_sensor_ != nullptr)
+    this->bist_consecutive_failures_sensor_->publish_state(this->bist_consecutive_failures_);
+  if (this->cmd_callbacks_.on_bist_done)
+    this->cmd_callbacks_.on_bist_done(test_verdict);
+  // The sensor is idle again; waiting for abort resumes the queue or identify.
+  this->app_state = APP_STATE_WAIT_ABORT;
+}
+
+const FpcBistResult &FingerprintFPC2532Component::get_bist_result(uint8_t age) const {
+  const uint8_t index = (this->bist_history_head_ + FPC_BIST_HISTORY_SIZE - 1 - age) % FPC_BIST_HISTORY_SIZE;
+  return this->bist_history_[index];
+}
+
+float FingerprintFPC2532Component::get_bist_pass_rate() const {
+  if (this->bist_history_count_ == 0)
+    return NAN;
+  uint8_t passed = 0;
+  for (uint8_t i = 0; i < this->bist_history_count_; i++) {
+    if (this->bist_history_[i].test_verdict == FPC_RESULT_OK)
+      passed++;
+  }
+  return passed * 100.0f / this->bist_history_count_;
+}
+
+/*
+------------------------
+IMAGE CAPTURE
+------------------------
+*/
+
+#ifdef USE_CAMERA
+void FingerprintFPC2532Component::request_image_capture() {
+  if (this->camera_ == nullptr)
+    return;
+  // The image in progress will serve this request too
+  if (this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE || this->app_state == APP_STATE_WAIT_IMAGE_DATA)
+    return;
+  this->queue_request_(FPC_REQUEST_CAPTURE, {ID_TYPE_NONE, 0});
+}
+
+void FingerprintFPC2532Component::finish_image_capture_(bool success) {
+  if (success) {
+    ESP_LOGI(TAG, "Image capture done (%" PRIu32 " bytes)", this->transfer_offset_);
+  } else {
+    ESP_LOGE(TAG, "Image capture failed");
+  }
+  const bool capturing = this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE;
+  this->transfer_remaining_ = 0;
+  // The sensor is idle again; waiting for abort resumes the queue or identify.
+  this->app_state = APP_STATE_WAIT_ABORT;
+  if (capturing)
+    this->fpc_cmd_abort();
+  // Last, as a streaming camera queues the next capture from here
+  if (this->camera_ != nullptr)
+    this->camera_->finish_image(success);
+}
+#endif
+
+/*
+------------------------
+REQUEST QUEUE
+------------------------
+*/
+
+void FingerprintFPC2532Component::queue_request_(fpc_request_type_t type, fpc::fpc_id_type_t id) {
+  for (int8_t i = this->requests_count_ - 1; i >= 0; i--) {
+    const FpcRequest &queued = this->requests_[i];
+    if (queued.type != type)
+      continue;
+    if (queued.id.type == id.type && queued.id.id == id.id) {
+      ESP_LOGD(TAG, "Request already queued (%s, id=%u)", get_id_type_str_(id.type), id.id);
+      return;
+    }
+    if (type == FPC_REQUEST_DELETE) {
+      if (queued.id.type == ID_TYPE_ALL) {
+        ESP_LOGD(TAG, "Delete of all templates already queued");
+        return;
+      }
+      if (id.type == ID_TYPE_ALL)
+        this->remove_request_(i);  // superseded by deleting everything
+    }
+  }
+  if (this->requests_count_ == FPC_REQUEST_QUEUE_SIZE) {
+    ESP_LOGE(TAG, "Request queue full, dropping request");
+    if (type == FPC_REQUEST_ENROLL)
+      this->enrollment_failed_(id.id);
+    return;
+  }
+  this->requests_[this->requests_count_++] = {type, id};
+  this->publish_request_queue_depth_();
+
+  // Only an idle operation is interrupted. In every other state the queue is served at the next dispatch point,
+  // so a burst of requests shares a single abort cycle. An enrollment in progress runs to its end, the queue drains
+  // from the template list refresh that follows it.
+  // A capture waiting for a finger only holds up requests that matter more than a diagnostic image.
+  if (this->app_state == APP_STATE_WAIT_IDENTIFY || this->app_state == APP_STATE_WAIT_NAVIGATION ||
+      (this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE && type < FPC_REQUEST_CAPTURE)) {
+#ifdef USE_CAMERA
+    if (this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE && this->camera_ != nullptr)
+      this->camera_->finish_image(false);
+#endif
+    this->fpc_cmd_abort();
+    this->app_state = APP_STATE_WAIT_ABORT;
+  }
+}
+
+void FingerprintFPC2532Component::remove_request_(uint8_t index) {
+  for (uint8_t i = index; i + 1 < this->requests_count_; i++)
+    this->requests_[i] = this->requests_[i + 1];
+  this->requests_count_--;
+}
+
+int8_t FingerprintFPC2532Component::next_request_index_() const {
+  int8_t best = -1;
+  for (uint8_t i = 0; i < this->requests_count_; i++) {
+    if (best < 0 || this->requests_[i].type < this->requests_[best].type)
+      best = i;
+  }
+  return best;
+}
+
+bool FingerprintFPC2532Component::dispatch_next_request_(app_state_t *next_state) {
+  int8_t index = this->next_request_index_();
+  if (index < 0)
+    return false;
+  FpcRequest request = this->requests_[index];
+  this->remove_request_(index);
+  this->publish_request_queue_depth_();
+
+  if (request.type == FPC_REQUEST_DELETE) {
+    ESP_LOGI(TAG, "Starting delete templates");
+    *next_state = APP_STATE_WAIT_DELETE_TEMPLATES;
+    this->fpc_cmd_delete_template_request(&request.id);
+    return true;
+  }
+  if (request.type == FPC_REQUEST_EXPORT || request.type == FPC_REQUEST_IMPORT) {
+    const bool is_export = request.type == FPC_REQUEST_EXPORT;
+    ESP_LOGI(TAG, "Starting template %s (id=%u)", is_export ? "export" : "import", request.id.id);
+    this->transfer_id_ = request.id.id;
+    this->transfer_offset_ = 0;
+    this->transfer_remaining_ = is_export ? 0 : request.size;
+    // The first chunk waits for the sensor to accept the import
+    this->import_put_pending_ = !is_export;
+    *next_state = is_export ? APP_STATE_WAIT_TEMPLATE_EXPORT : APP_STATE_WAIT_TEMPLATE_IMPORT;
+    this->fpc_cmd_template_data_request(is_export ? CMD_GET_TEMPLATE_DATA : CMD_PUT_TEMPLATE_DATA, request.id.id,
+                                        request.size);
+    return true;
+  }
+  if (request.type == FPC_REQUEST_BENCHMARK) {
+    ESP_LOGI(TAG, "Starting UART benchmark at %" PRIu32 " baud", this->parent_->get_baud_rate());
+    *next_state = APP_STATE_WAIT_BENCHMARK;
+    this->benchmark_remaining_ = FPC_BENCHMARK_FRAMES;
+    this->benchmark_rtt_sum_us_ = 0;
+    this->benchmark_start_us_ = micros();
+    this->benchmark_sent_us_ = this->benchmark_start_us_;
+    this->fpc_cmd_status_request();
+    return true;
+  }
+  if (request.type == FPC_REQUEST_BIST) {
+    ESP_LOGI(TAG, "Starting self test");
+    *next_state = APP_STATE_WAIT_BIST;
+    this->fpc_cmd_bist_request();
+    return true;
+  }
+  if (request.type == FPC_REQUEST_CAPTURE) {
+    ESP_LOGI(TAG, "Starting image capture");
+    *next_state = APP_STATE_WAIT_IMAGE_CAPTURE;
+    this->fpc_cmd_capture_request();
+    return true;
+  }
+
+  if (this->template_cache_valid_ && this->template_cache_.count >= this->template_capacity_) {
+    if (this->evict_for_enroll_(request))
+      return this->dispatch_next_request_(next_state);
+    ESP_LOGW(TAG, "No space for new fingerprints. Consider deleting unused templates.");
+    this->enrollment_failed_(request.id.id);
+    return this->dispatch_next_request_(next_state);
+  }
+  if (request.id.type == ID_TYPE_GENERATE_NEW && this->template_cache_valid_) {
+    uint16_t free_id = this->find_free_template_id();
+    if (free_id == 0) {
+      ESP_LOGW(TAG, "No space for new fingerprints. Consider deleting unused templates.");
+      this->enrollment_failed_(0);
+      return this->dispatch_next_request_(next_state);
+    }
+    request.id = {ID_TYPE_SPECIFIED, free_id};
+  }
+  this->enroll_id = request.id.id;
+  ESP_LOGI(TAG, "Starting enroll");
+  this->enrollment_session_begin_(this->enroll_id);
+  *next_state = APP_STATE_WAIT_ENROLL;
+  this->fpc_cmd_enroll_request(&request.id);
+  return true;
+}
+
+void FingerprintFPC2532Component::publish_request_queue_depth_() {
+  if (this->request_queue_depth_sensor_ != nullptr)
+    this->request_queue_depth_sensor_->publish_state(this->requests_count_);
+}
+
 /*
 ------------------------
 STATE MACHINE PROCESSING
@@ -322,17 +1202,28 @@ void FingerprintFPC2532Component::process_state(void) {
 
   switch (app_state) {
     case APP_STATE_WAIT_READY:
-      ESP_LOGD(TAG, "APP_STATE_WAIT_READY");
+      ESP_LOGV(TAG, "APP_STATE_WAIT_READY");
       if (this->device_ready_) {
         if (this->delay_elapsed(5000)) {  // Wait for the device to be fully ready.
           next_state = APP_STATE_WAIT_VERSION;
           this->fpc_cmd_version_request();
           //  this->fpc_cmd_system_config_get_request(FPC_SYS_CFG_TYPE_DEFAULT);  // get current defaults
         }
+      } else if (this->auto_baud_rate_) {
+        // Nothing understood yet: the sensor may have been left at another rate, so walk through all of them.
+        if (this->baud_probe_start_ == 0) {
+          this->baud_probe_start_ = millis();
+        } else if (millis() - this->baud_probe_start_ >= FPC_BAUD_PROBE_TIMEOUT_MS) {
+          this->baud_probe_index_ = this->baud_probe_index_ % (FPC_BAUD_RATES_COUNT - 1) + 1;
+          ESP_LOGW(TAG, "No answer from the sensor, trying %" PRIu32 " baud", FPC_BAUD_RATES[this->baud_probe_index_]);
+          this->switch_host_baud_rate_(FPC_BAUD_RATES[this->baud_probe_index_]);
+          this->baud_probe_start_ = millis();
+          this->fpc_cmd_status_request();
+        }
       }
       break;
     case APP_STATE_WAIT_VERSION:
-      ESP_LOGD(TAG, "APP_STATE_WAIT_VERSION");
+      ESP_LOGV(TAG, "APP_STATE_WAIT_VERSION");
       if (this->version_read_) {
         this->version_read_ = false;
         if (!this->password_verified_) {
@@ -349,12 +1240,16 @@ void FingerprintFPC2532Component::process_state(void) {
             this->mark_failed();
           }
         }
+        if (this->template_cache_valid_ && this->template_cache_.device_hash != fnv1_hash(this->unique_id_)) {
+          ESP_LOGD(TAG, "Cached templates belong to another sensor, discarding");
+          this->invalidate_template_cache_();
+        }
         next_state = APP_STATE_WAIT_CONFIG;
         this->fpc_cmd_system_config_get_request(FPC_SYS_CFG_TYPE_CUSTOM);
       }
       break;
     case APP_STATE_WAIT_CONFIG:
-      ESP_LOGD(TAG, "APP_STATE_WAIT_CONFIG");
+      ESP_LOGV(TAG, "APP_STATE_WAIT_CONFIG");
       if (this->config_received) {
         ESP_LOGD(TAG, "CONFIG RECEIVED");
         ESP_LOGVV(TAG,
@@ -404,32 +1299,54 @@ void FingerprintFPC2532Component::process_state(void) {
           next_state = APP_STATE_SET_CONFIG;
           this->fpc_cmd_system_config_set_request(&this->current_config_);
         } else if (prev_state == APP_STATE_SET_CONFIG) {
-          next_state = APP_STATE_WAIT_LIST_TEMPLATES;
-          this->fpc_cmd_list_templates_request();
+          uint32_t baud_rate = this->uart_baudrate_ < FPC_BAUD_RATES_COUNT ? FPC_BAUD_RATES[this->uart_baudrate_] : 0;
+          if (baud_rate != 0 && baud_rate != this->parent_->get_baud_rate()) {
+            // The sensor answers SET_CONFIG at the old rate; follow it and check it is still there.
+            ESP_LOGI(TAG, "Switching UART to %" PRIu32 " baud", baud_rate);
+            this->baud_switch_prev_ = this->parent_->get_baud_rate();
+            this->baud_confirmed_ = false;
+            this->switch_host_baud_rate_(baud_rate);
+            this->baud_probe_start_ = millis();
+            next_state = APP_STATE_WAIT_BAUD_SWITCH;
+            this->fpc_cmd_status_request();
+          } else {
+            this->start_list_templates_(&next_state);
+          }
         }
       }
       break;
 
+    case APP_STATE_WAIT_BAUD_SWITCH:
+      ESP_LOGV(TAG, "APP_STATE_WAIT_BAUD_SWITCH");
+      if (this->baud_confirmed_) {
+        ESP_LOGI(TAG, "UART running at %" PRIu32 " baud", this->parent_->get_baud_rate());
+        this->start_list_templates_(&next_state);
+      } else if (millis() - this->baud_probe_start_ >= FPC_BAUD_PROBE_TIMEOUT_MS) {
+        ESP_LOGW(TAG, "No answer at %" PRIu32 " baud, staying at %" PRIu32, this->parent_->get_baud_rate(),
+                 this->baud_switch_prev_);
+        this->switch_host_baud_rate_(this->baud_switch_prev_);
+        this->start_list_templates_(&next_state);
+      }
+      break;
+
     case APP_STATE_WAIT_LIST_TEMPLATES:
-      ESP_LOGI(TAG, "APP_STATE_WAIT_LIST_TEMPLATES");
+      ESP_LOGV(TAG, "APP_STATE_WAIT_LIST_TEMPLATES");
       if (this->list_templates_done_) {
         this->list_templates_done_ = false;
-        if (this->n_templates_on_device_ == MAX_NUMBER_OF_TEMPLATES) {
+        if (this->dispatch_next_request_(&next_state)) {
+          break;
+        }
+        if (this->n_templates_on_device_ >= this->template_capacity_) {
           ESP_LOGW(TAG, "No space for new fingerprints. Consider deleting unused templates.");
-          fpc::fpc_id_type_t id_type = {ID_TYPE_ALL, 0};
-          ESP_LOGI(TAG, "Starting identify");
-          next_state = APP_STATE_WAIT_IDENTIFY;
-          this->fpc_cmd_identify_request(&id_type, 0);
-        } else if (this->n_templates_on_device_ == 0) {
+          this->start_idle_operation_(&next_state);
+        } else if (this->n_templates_on_device_ == 0 && !this->navigation_enabled_) {
           fpc::fpc_id_type_t id_type = {ID_TYPE_GENERATE_NEW, 0};
           ESP_LOGI(TAG, "Starting enroll");
+          this->enrollment_session_begin_(0);
           next_state = APP_STATE_WAIT_ENROLL;
           this->fpc_cmd_enroll_request(&id_type);
         } else {
-          fpc::fpc_id_type_t id_type = {ID_TYPE_ALL, 0};
-          ESP_LOGI(TAG, "Starting identify");
-          next_state = APP_STATE_WAIT_IDENTIFY;
-          this->fpc_cmd_identify_request(&id_type, 0);
+          this->start_idle_operation_(&next_state);
         }
       }
       break;
@@ -437,7 +1354,7 @@ void FingerprintFPC2532Component::process_state(void) {
     case APP_STATE_WAIT_ENROLL: {
       if (millis() - this->enroll_idle_time_ > this->enroll_timeout_ms_) {
         ESP_LOGW(TAG, "Enroll timeout. Aborting operation.");
-        this->enrollment_failed_callback_.call(0);
+        this->enrollment_failed_(0);
         fpc_cmd_abort();
         ESP_LOGI(TAG, "Aborting operation");
         next_state = APP_STATE_WAIT_ABORT;
@@ -461,51 +1378,50 @@ void FingerprintFPC2532Component::process_state(void) {
 
     case APP_STATE_WAIT_IDENTIFY:
       if (this->device_ready_ && ((this->device_state_ & STATE_IDENTIFY) == 0)) {
-        fpc::fpc_id_type_t id_type = {ID_TYPE_ALL, 0};
         if (this->delay_elapsed(300)) {
-          this->fpc_cmd_identify_request(&id_type, 0);
+          this->send_identify_request_();
         }
       }
       break;
+    case APP_STATE_WAIT_NAVIGATION:
+      // Re-armed right away: a gesture ends navigation and the next one should not be missed.
+      if (this->device_ready_ && ((this->device_state_ & STATE_NAVIGATION) == 0) && this->cmds_in_flight_ == 0 &&
+          this->cmd_queue_count_ == 0) {
+        this->fpc_cmd_navigation_request(this->navigation_config_);
+      }
+      break;
     case APP_STATE_WAIT_ABORT:
-      ESP_LOGI(TAG, "Aborting current operation..");
-      if (this->device_ready_ && ((this->device_state_ & (STATE_ENROLL | STATE_IDENTIFY)) == 0)) {
+      ESP_LOGV(TAG, "Aborting current operation..");
+      if (this->device_ready_ &&
+          ((this->device_state_ & (STATE_ENROLL | STATE_IDENTIFY | STATE_CAPTURE | STATE_NAVIGATION)) == 0)) {
         ESP_LOGI(TAG, "Operation aborted");
         enroll_status_received_ = false;
-        if (this->enroll_request == true) {
-          fpc::fpc_id_type_t id_type = this->id_type_enroll_request;
-          ESP_LOGI(TAG, "Starting enroll");
-          next_state = APP_STATE_WAIT_ENROLL;
-          this->fpc_cmd_enroll_request(&id_type);
-          this->enroll_request = false;
-        } else if (this->delete_request == true) {
-          fpc::fpc_id_type_t id_type = this->id_type_delete_request;
-          ESP_LOGI(TAG, "Starting delete templates");
-          next_state = APP_STATE_WAIT_DELETE_TEMPLATES;
-          this->fpc_cmd_delete_template_request(&id_type);
-          this->delete_request = false;
-        } else {
+        if (!this->dispatch_next_request_(&next_state)) {
           if (this->enrolling_binary_sensor_ != nullptr) {
             this->enrolling_binary_sensor_->publish_state(false);
           }
-          fpc::fpc_id_type_t id_type = {ID_TYPE_ALL, 0};
-          ESP_LOGI(TAG, "Starting identify");
-          next_state = APP_STATE_WAIT_IDENTIFY;
-          this->fpc_cmd_identify_request(&id_type, 0);
+          this->start_idle_operation_(&next_state);
         }
       }
       break;
     case APP_STATE_WAIT_DELETE_TEMPLATES: {
       if (this->device_ready_) {
-        ESP_LOGI(TAG, "template/s deleted.");
-        this->fpc_hal_delay_ms(20);
-        next_state = APP_STATE_WAIT_LIST_TEMPLATES;
-        this->fpc_cmd_list_templates_request();
+        if (this->delay_elapsed(20)) {
+          ESP_LOGI(TAG, "template/s deleted.");
+          int8_t index = this->next_request_index_();
+          if (index >= 0 && this->requests_[index].type == FPC_REQUEST_DELETE) {
+            // Batch queued deletes; the template list is refreshed once afterwards.
+            this->dispatch_next_request_(&next_state);
+          } else {
+            next_state = APP_STATE_WAIT_LIST_TEMPLATES;
+            this->fpc_cmd_list_templates_request();
+          }
+        }
       }
       break;
     }
     case APP_STATE_SET_CONFIG:
-      ESP_LOGI(TAG,
+      ESP_LOGV(TAG,
                "System Config in after SET:\n"
                "  version                     = %u\n"
                "  finger_scan_interval_ms     = %u\n"
@@ -546,62 +1462,108 @@ HOST FUNCTIONS DEFINITONS
 */
 
 void FingerprintFPC2532Component::sensor_wakeup_() {
-  // Immediately return if there is no power pin or the sensor is already on
-  if ((!this->has_power_pin_))
-    return;
-
+  this->sensor_waking_ = true;
   this->sensor_power_pin_->digital_write(true);
-  delay(1);  // datasheet set min 500uS to wake up device
-  this->sensor_power_pin_->digital_write(false);
+  // datasheet set min 500uS to wake up device, the scheduler ends the pulse instead of blocking the loop
+  this->set_timeout("sensor_wakeup", 1, [this]() {
+    this->sensor_power_pin_->digital_write(false);
+    this->sensor_waking_ = false;
+    this->fpc_cmd_send_next_();
+  });
 }
 
 /* Command Requests */
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_send_request(fpc::fpc_cmd_hdr_t *cmd, size_t size) {
-  fpc::fpc_result_t result = FPC_RESULT_OK;
-  fpc::fpc_frame_hdr_t frame = {0};
-
-  if (!cmd) {
+  if (!cmd || size > FPC_MAX_CMD_SIZE) {
     ESP_LOGE(TAG, "Invalid command");
-    result = FPC_RESULT_INVALID_PARAM;
+    return FPC_RESULT_INVALID_PARAM;
+  }
+  if (this->cmd_queue_count_ == FPC_CMD_QUEUE_SIZE) {
+    ESP_LOGE(TAG, "Command queue full, dropping cmd 0x%04X", cmd->cmd_id);
+    return FPC_RESULT_IO_BUSY;
   }
 
-  if (result == FPC_RESULT_OK) {
-    frame.version = FPC_FRAME_PROTOCOL_VERSION;
-    frame.type = FPC_FRAME_TYPE_CMD_REQUEST;
-    frame.flags = FPC_FRAME_FLAG_SENDER_HOST;
-    frame.payload_size = (uint16_t) size;
+  uint8_t tail = (this->cmd_queue_head_ + this->cmd_queue_count_) % FPC_CMD_QUEUE_SIZE;
+  FpcPendingCommand &pending = this->cmd_queue_[tail];
+  pending.cmd_id = cmd->cmd_id;
+  pending.size = (uint8_t) size;
+  memcpy(pending.data, cmd, size);
+  this->cmd_queue_count_++;
 
-    /* Send frame header. */
-    result = this->fpc_hal_tx((uint8_t *) &frame, sizeof(fpc::fpc_frame_hdr_t));
-    ESP_LOGVV(TAG, "frame header sent: version=%02X, flags=%02X, type=%02X, payload_size=%" PRIu32, frame.version,
-              frame.flags, frame.type, frame.payload_size);
+  // Inside loop()/update() the requests of one pass go out together once it ends
+  if (!this->cmd_batching_) {
+    this->fpc_cmd_send_next_();
   }
+  // Requests may come from actions while the loop is idle; keep it running until the response arrives.
+  this->enable_loop();
+  return FPC_RESULT_OK;
+}
+void FingerprintFPC2532Component::fpc_cmd_send_next_() {
+  if (this->cmd_queue_count_ == 0 || this->cmds_in_flight_ > 0 || this->sensor_waking_)
+    return;
 
-  if (result == FPC_RESULT_OK) {
-    sensor_wakeup_();
-    /* Send payload. */
-    result = this->fpc_hal_tx((uint8_t *) cmd, size);
-    ESP_LOGVV(TAG, "command payload sent");
+  // A sensor left idle past time_before_sleep_ms_ needs waking before it can receive the burst
+  if (this->has_power_pin_ && millis() - this->last_activity_ms_ >= this->time_before_sleep_ms_) {
+    this->last_activity_ms_ = millis();
+    this->sensor_wakeup_();
+    return;
   }
+  this->last_activity_ms_ = millis();
 
-  // Wait for response using cached loop start time
-  // const uint32_t start = App.get_loop_component_start_time();
-  const uint32_t start = millis();
-  const uint32_t timeout_ms = 100;
-  if (result == FPC_RESULT_OK) {
-    while (!available()) {
-      // if (App.get_loop_component_start_time() - start > timeout_ms) {
-      ESP_LOGV(TAG, "waiting time in while loop waiting command feedback %u", millis() - start);
-      if (millis() - start > timeout_ms) {
-        ESP_LOGE(TAG, "no feedback from sensor available (timeout)");
-        return FPC_RESULT_TIMEOUT;
-      }
-      delay(1);
+  const uint8_t count = std::min(this->cmd_queue_count_, FPC_CMD_BURST_SIZE);
+  size_t len = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const FpcPendingCommand &pending = this->cmd_queue_[(this->cmd_queue_head_ + i) % FPC_CMD_QUEUE_SIZE];
+    fpc::fpc_frame_hdr_t frame = {0};
+    frame.version = FPC_FRAME_PROTOCOL_VERSION;
+    frame.type = FPC_FRAME_TYPE_CMD_REQUEST;
+    frame.flags = FPC_FRAME_FLAG_SENDER_HOST;
+    frame.payload_size = pending.size;
+    memcpy(this->cmd_tx_buffer_ + len, &frame, sizeof(frame));
+    len += sizeof(frame);
+    memcpy(this->cmd_tx_buffer_ + len, pending.data, pending.size);
+    len += pending.size;
+    ESP_LOGVV(TAG, "frame queued: cmd 0x%04X, payload_size=%u", pending.cmd_id, frame.payload_size);
+  }
+  this->fpc_hal_tx(this->cmd_tx_buffer_, len);
+  ESP_LOGVV(TAG, "%u commands sent in %u bytes, %u queued", count, (unsigned) len, this->cmd_queue_count_ - count);
+
+  // The responses are matched in loop(); the scheduler releases the pipeline if the sensor stays silent.
+  this->cmds_in_flight_ = count;
+  this->fpc_cmd_arm_timeout_();
+}
+void FingerprintFPC2532Component::fpc_cmd_arm_timeout_() {
+  this->set_timeout("cmd_response", FPC_CMD_RESPONSE_TIMEOUT_MS, [this]() {
+    ESP_LOGE(TAG, "no feedback from sensor available (timeout) for cmd 0x%04X",
+             this->cmd_queue_[this->cmd_queue_head_].cmd_id);
+    // The rest of the burst is answered after the missing response if at all, give up on all of it
+    this->cmds_in_flight_ = std::min(this->cmds_in_flight_, this->cmd_queue_count_);
+    this->cmd_queue_head_ = (this->cmd_queue_head_ + this->cmds_in_flight_) % FPC_CMD_QUEUE_SIZE;
+    this->cmd_queue_count_ -= this->cmds_in_flight_;
+    this->cmds_in_flight_ = 0;
+    if (this->app_state == APP_STATE_WAIT_BENCHMARK) {
+      // The benchmark only sends its next status request from a response, it would wait forever
+      ESP_LOGW(TAG, "UART benchmark aborted, a status response was lost");
+      this->app_state = APP_STATE_WAIT_ABORT;
     }
-    ESP_LOGVV(TAG, "packet sent and sensor feedback available");
-    result = FPC_RESULT_OK;
+    this->fpc_cmd_send_next_();
+  });
+}
+void FingerprintFPC2532Component::fpc_cmd_complete_() {
+  if (this->cmds_in_flight_ > 0 && this->cmd_queue_count_ > 0) {
+    this->cmd_queue_head_ = (this->cmd_queue_head_ + 1) % FPC_CMD_QUEUE_SIZE;
+    this->cmd_queue_count_--;
+    this->cmds_in_flight_--;
+  } else {
+    this->cmds_in_flight_ = 0;
   }
-  return result;
+  if (this->cmds_in_flight_ > 0) {
+    // Every further response of the burst gets the full timeout
+    this->fpc_cmd_arm_timeout_();
+    return;
+  }
+  this->cancel_timeout("cmd_response");
+  this->fpc_cmd_send_next_();
 }
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_status_request(void) {
   fpc::fpc_result_t result = FPC_RESULT_OK;
@@ -734,6 +1696,7 @@ fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_delete_template_request(f
     cmd_req.tpl_id.id = id->id;
 
     ESP_LOGI(TAG, ">>> CMD_DELETE_TEMPLATE (id.type=%s, id=%d)", get_id_type_str_(id->type), id->id);
+    this->invalidate_template_cache_();
 
     result = fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_template_delete_request_t));
   }
@@ -774,6 +1737,89 @@ fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_system_config_set_request
 
   return result;
 }
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_template_data_request(uint16_t cmd_id, uint16_t id,
+                                                                            uint16_t total_size) {
+  fpc::fpc_cmd_template_data_request_t cmd_req;
+
+  cmd_req.cmd.cmd_id = cmd_id;
+  cmd_req.cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+  cmd_req.id = id;
+  cmd_req.total_size = cmd_id == CMD_PUT_TEMPLATE_DATA ? total_size : 0;
+
+  ESP_LOGI(TAG, ">>> %s (id=%d, size=%d)", cmd_id == CMD_PUT_TEMPLATE_DATA ? "CMD_PUT_TEMPLATE_DATA" : "CMD_GET_TEMPLATE_DATA",
+           id, cmd_req.total_size);
+  return fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_template_data_request_t));
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_data_get_request(uint32_t remaining_size) {
+  fpc::fpc_cmd_data_get_request_t cmd_req;
+
+  cmd_req.cmd.cmd_id = CMD_DATA_GET;
+  cmd_req.cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+  cmd_req.remaining_size = remaining_size;
+  cmd_req.max_chunk_size = this->rx_buffer_size_ - fpc::FPC_CMD_DATA_GET_RESPONSE_HDR_SIZE;
+
+  ESP_LOGV(TAG, ">>> CMD_DATA_GET (remaining=%" PRIu32 ")", remaining_size);
+  return fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_data_get_request_t));
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_data_put_request(const uint8_t *data, uint16_t size,
+                                                                       uint32_t remaining_size) {
+  uint8_t buf[FPC_MAX_CMD_SIZE];
+  auto *cmd_req = reinterpret_cast<fpc::fpc_cmd_data_put_request_t *>(buf);
+
+  if (size > FPC_TEMPLATE_CHUNK_SIZE) {
+    ESP_LOGE(TAG, "Data Put: Invalid parameter");
+    return FPC_RESULT_INVALID_PARAM;
+  }
+
+  cmd_req->cmd.cmd_id = CMD_DATA_PUT;
+  cmd_req->cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+  cmd_req->remaining_size = remaining_size;
+  cmd_req->data_size = size;
+  memcpy(cmd_req->data, data, size);
+
+  ESP_LOGV(TAG, ">>> CMD_DATA_PUT (size=%u, remaining=%" PRIu32 ")", size, remaining_size);
+  return fpc_send_request(&cmd_req->cmd, fpc::FPC_CMD_DATA_PUT_REQUEST_HDR_SIZE + size);
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_capture_request(void) {
+  fpc::fpc_cmd_capture_request_t cmd_req;
+
+  cmd_req.cmd.cmd_id = CMD_CAPTURE;
+  cmd_req.cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+
+  ESP_LOGI(TAG, ">>> CMD_CAPTURE");
+  return fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_capture_request_t));
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_bist_request(void) {
+  fpc::fpc_cmd_hdr_t cmd;
+
+  /* BIST Command Request has no payload */
+  cmd.cmd_id = CMD_BIST;
+  cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+
+  ESP_LOGI(TAG, ">>> CMD_BIST");
+  return this->fpc_send_request(&cmd, sizeof(fpc::fpc_cmd_hdr_t));
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_navigation_request(uint32_t config) {
+  fpc::fpc_cmd_navigation_request_t cmd_req;
+
+  cmd_req.cmd.cmd_id = CMD_NAVIGATION;
+  cmd_req.cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+  cmd_req.config = config;
+
+  ESP_LOGV(TAG, ">>> CMD_NAVIGATION (config=0x%08" PRIX32 ")", config);
+  return fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_navigation_request_t));
+}
+fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_image_data_request(uint16_t type) {
+  fpc::fpc_cmd_image_request_t cmd_req;
+
+  cmd_req.cmd.cmd_id = CMD_IMAGE_DATA;
+  cmd_req.cmd.type = FPC_FRAME_TYPE_CMD_REQUEST;
+  cmd_req.type = type;
+  cmd_req.total_size = 0;
+
+  ESP_LOGI(TAG, ">>> CMD_IMAGE_DATA (type=%d)", type);
+  return fpc_send_request(&cmd_req.cmd, sizeof(fpc::fpc_cmd_image_request_t));
+}
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_system_config_get_request(uint8_t type) {
   fpc::fpc_result_t result = FPC_RESULT_OK;
   fpc::fpc_cmd_get_config_request_t cmd_req;
@@ -796,55 +1842,161 @@ fpc::fpc_result_t FingerprintFPC2532Component::fpc_cmd_system_config_get_request
 }
 
 /* Command Responses / Events */
+static bool frame_hdr_is_valid(const fpc::fpc_frame_hdr_t &hdr) {
+  return hdr.version == FPC_FRAME_PROTOCOL_VERSION && (hdr.flags & FPC_FRAME_FLAG_SENDER_FW_APP) != 0 &&
+         (hdr.type == FPC_FRAME_TYPE_CMD_RESPONSE || hdr.type == FPC_FRAME_TYPE_CMD_EVENT) &&
+         hdr.payload_size >= sizeof(fpc::fpc_cmd_hdr_t);
+}
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_host_sample_handle_rx_data(void) {
-  fpc::fpc_result_t result;
-  fpc::fpc_frame_hdr_t frame_hdr;
-  // std::vector<uint8_t> frame_payload;
-  uint8_t *frame_payload = NULL;
-
-  /* Step 1: Read Frame Header */
-  result = this->fpc_hal_rx((uint8_t *) &frame_hdr, sizeof(fpc::fpc_frame_hdr_t));
-
-  if (result == FPC_RESULT_OK) {
-    ESP_LOGVV(TAG, "Sanity check started");
-    /* Sanity Check */
-    if (frame_hdr.version != FPC_FRAME_PROTOCOL_VERSION || ((frame_hdr.flags & FPC_FRAME_FLAG_SENDER_FW_APP) == 0) ||
-        (frame_hdr.type != FPC_FRAME_TYPE_CMD_RESPONSE && frame_hdr.type != FPC_FRAME_TYPE_CMD_EVENT)) {
-      ESP_LOGE(TAG, "Sanity check of rx data failed");
-      result = FPC_RESULT_IO_BAD_DATA;
-    } else {
-      ESP_LOGVV(TAG, "Received Header frame: version=%02X, flags=%02X, type=%02X, payload_size=%" PRIu32,
-                frame_hdr.version, frame_hdr.flags, frame_hdr.type, frame_hdr.payload_size);
-    }
-  }
-
-  if (result == FPC_RESULT_OK) {
-    frame_payload = static_cast<uint8_t *>(malloc(frame_hdr.payload_size));
-    if (!frame_payload) {
-      ESP_LOGE(TAG, "Failed to malloc");
-      result = FPC_RESULT_OUT_OF_MEMORY;
+  fpc::fpc_result_t result = FPC_PENDING_OPERATION;
+  int available = this->available();
+
+  while (available > 0 && result == FPC_PENDING_OPERATION) {
+    switch (this->rx_state_) {
+      case RX_STATE_HEADER: {
+        /* Step 1: Read Frame Header */
+        size_t chunk = std::min((size_t) available, sizeof(fpc::fpc_frame_hdr_t) - this->rx_pos_);
+        if (this->fpc_hal_rx(reinterpret_cast<uint8_t *>(&this->rx_frame_hdr_) + this->rx_pos_, chunk) !=
+            FPC_RESULT_OK) {
+          result = FPC_RESULT_IO_RUNTIME_FAILURE;
+          break;
+        }
+        available -= chunk;
+        this->rx_pos_ += chunk;
+        if (this->rx_pos_ < sizeof(fpc::fpc_frame_hdr_t))
+          break;
+
+        const fpc::fpc_frame_hdr_t &hdr = this->rx_frame_hdr_;
+        /* Sanity Check */
+        if (!frame_hdr_is_valid(hdr)) {
+          // Slide the header window by one byte and keep scanning for the next valid header.
+          if (!this->rx_resyncing_) {
+            ESP_LOGW(TAG, "Sanity check of rx data failed, resynchronising");
+            this->rx_resyncing_ = true;
+          }
+          uint8_t *raw = reinterpret_cast<uint8_t *>(&this->rx_frame_hdr_);
+          memmove(raw, raw + 1, sizeof(fpc::fpc_frame_hdr_t) - 1);
+          this->rx_pos_ = sizeof(fpc::fpc_frame_hdr_t) - 1;
+          this->rx_dropped_bytes_++;
+          break;
+        }
+        this->rx_pos_ = 0;
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+        this->rx_frame_start_us_ = micros();
+#endif
+        if (this->rx_resyncing_) {
+          this->rx_resyncing_ = false;
+          this->rx_resyncs_++;
+          ESP_LOGW(TAG, "Resynchronised after %" PRIu32 " dropped byte(s) in total", this->rx_dropped_bytes_);
+          if (this->rx_dropped_bytes_sensor_ != nullptr)
+            this->rx_dropped_bytes_sensor_->publish_state(this->rx_dropped_bytes_);
+          if (this->rx_resyncs_sensor_ != nullptr)
+            this->rx_resyncs_sensor_->publish_state(this->rx_resyncs_);
+        }
+        ESP_LOGVV(TAG, "Received Header frame: version=%02X, flags=%02X, type=%02X, payload_size=%u", hdr.version,
+                  hdr.flags, hdr.type, hdr.payload_size);
+        if (hdr.payload_size > this->rx_buffer_size_) {
+          ESP_LOGE(TAG, "Frame payload of %u bytes exceeds rx buffer (%u bytes), discarding", hdr.payload_size,
+                   (unsigned) this->rx_buffer_size_);
+          this->rx_state_ = RX_STATE_DISCARD;
+        } else {
+          this->rx_state_ = RX_STATE_PAYLOAD;
+        }
+        break;
+      }
+      case RX_STATE_PAYLOAD:
+      case RX_STATE_DISCARD: {
+        /* Step 2: Read Frame Payload (Command) */
+        const size_t payload_size = this->rx_frame_hdr_.payload_size;
+        size_t chunk = std::min((size_t) available, payload_size - this->rx_pos_);
+        fpc::fpc_result_t rx_result;
+        if (this->rx_state_ == RX_STATE_PAYLOAD) {
+          rx_result = this->fpc_hal_rx(this->rx_buffer_ + this->rx_pos_, chunk);
+        } else {
+          uint8_t scratch[16];
+          chunk = std::min(chunk, sizeof(scratch));
+          rx_result = this->fpc_hal_rx(scratch, chunk);
+        }
+        if (rx_result != FPC_RESULT_OK) {
+          result = FPC_RESULT_IO_RUNTIME_FAILURE;
+          break;
+        }
+        available -= chunk;
+        this->rx_pos_ += chunk;
+        if (this->rx_pos_ < payload_size)
+          break;
+
+        const bool discard = this->rx_state_ == RX_STATE_DISCARD;
+        this->rx_state_ = RX_STATE_HEADER;
+        this->rx_pos_ = 0;
+        result = discard ? FPC_RESULT_OUT_OF_MEMORY : parse_cmd(this->rx_buffer_, payload_size);
+
+        // Events are unsolicited; only a response releases the command in flight.
+        this->last_activity_ms_ = millis();
+        if (this->rx_frame_hdr_.type == FPC_FRAME_TYPE_CMD_RESPONSE && this->cmds_in_flight_ > 0) {
+          this->fpc_cmd_complete_();
+        }
+        if (result == FPC_RESULT_OK && available > 0) {
+          // Keep draining: another frame may already be waiting.
+          result = FPC_PENDING_OPERATION;
+        }
+        break;
+      }
     }
   }
 
-  if (result == FPC_RESULT_OK) {
-    /* Step 2: Read Frame Payload (Command) */
-    result = this->fpc_hal_rx(frame_payload, frame_hdr.payload_size);
-  }
-
-  if (result == FPC_RESULT_OK) {
-    result = parse_cmd(frame_payload, frame_hdr.payload_size);
-  }
-
-  if (frame_payload) {
-    free(frame_payload);
-  }
-
-  if (result != FPC_RESULT_OK) {
+  if (result != FPC_RESULT_OK && result != FPC_PENDING_OPERATION) {
+    this->rx_state_ = RX_STATE_HEADER;
+    this->rx_pos_ = 0;
     ESP_LOGE(TAG, "Failed to handle RX data, error %d", result);
   }
 
   return result;
 }
+// Sorted by cmd_id. A new command only needs its entry here.
+constexpr FingerprintFPC2532Component::CmdHandler FingerprintFPC2532Component::CMD_HANDLERS[] = {
+    {CMD_STATUS, sizeof(fpc::fpc_cmd_status_response_t), false, &FingerprintFPC2532Component::parse_cmd_status},
+    {CMD_VERSION, sizeof(fpc::fpc_cmd_version_response_t), true, &FingerprintFPC2532Component::parse_cmd_version},
+    {CMD_BIST, sizeof(fpc::fpc_cmd_bist_response_t), false, &FingerprintFPC2532Component::parse_cmd_bist},
+    {CMD_IMAGE_DATA, sizeof(fpc::fpc_cmd_image_response_t), false, &FingerprintFPC2532Component::parse_cmd_image_data},
+    {CMD_ENROLL, sizeof(fpc::fpc_cmd_enroll_status_response_t), false,
+     &FingerprintFPC2532Component::parse_cmd_enroll_status},
+    {CMD_IDENTIFY, sizeof(fpc::fpc_cmd_identify_status_response_t), false,
+     &FingerprintFPC2532Component::parse_cmd_identify},
+    {CMD_LIST_TEMPLATES, sizeof(fpc::fpc_cmd_template_info_response_t), true,
+     &FingerprintFPC2532Component::parse_cmd_list_templates},
+    {CMD_GET_TEMPLATE_DATA, sizeof(fpc::fpc_cmd_template_data_response_t), false,
+     &FingerprintFPC2532Component::parse_cmd_get_template_data},
+    {CMD_GET_SYSTEM_CONFIG, sizeof(fpc::fpc_cmd_get_config_response_t), true,
+     &FingerprintFPC2532Component::parse_cmd_get_system_config},
+    {CMD_DATA_GET, fpc::FPC_CMD_DATA_GET_RESPONSE_HDR_SIZE, true,
+     &FingerprintFPC2532Component::parse_cmd_data_get},
+    {CMD_NAVIGATION, sizeof(fpc::fpc_cmd_navigation_status_event_t), true,
+     &FingerprintFPC2532Component::parse_cmd_navigation_event},
+};
+
+static constexpr bool cmd_handlers_valid(const FingerprintFPC2532Component::CmdHandler *handlers, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (handlers[i].size < sizeof(fpc::fpc_cmd_hdr_t) || handlers[i].parse == nullptr)
+      return false;
+    if (i > 0 && handlers[i - 1].cmd_id >= handlers[i].cmd_id)
+      return false;
+  }
+  return true;
+}
+static_assert(cmd_handlers_valid(FingerprintFPC2532Component::CMD_HANDLERS,
+                                 sizeof(FingerprintFPC2532Component::CMD_HANDLERS) /
+                                     sizeof(FingerprintFPC2532Component::CMD_HANDLERS[0])),
+              "CMD_HANDLERS must be sorted by cmd_id and hold complete response payloads");
+
+const FingerprintFPC2532Component::CmdHandler *FingerprintFPC2532Component::find_cmd_handler_(uint16_t cmd_id) {
+  const CmdHandler *first = std::begin(CMD_HANDLERS);
+  const CmdHandler *last = std::end(CMD_HANDLERS);
+  const CmdHandler *it =
+      std::lower_bound(first, last, cmd_id, [](const CmdHandler &handler, uint16_t id) { return handler.cmd_id < id; });
+  return (it != last && it->cmd_id == cmd_id) ? it : nullptr;
+}
+
 fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd(uint8_t *frame_payload, std::size_t size) {
   fpc::fpc_result_t result = FPC_RESULT_OK;
   fpc::fpc_cmd_hdr_t *cmd_hdr;
@@ -864,42 +2016,17 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd(uint8_t *frame_payload,
   }
 
   if (result == FPC_RESULT_OK) {
-    switch (cmd_hdr->cmd_id) {
-      case CMD_STATUS:
-        return parse_cmd_status(cmd_hdr, size);
-        break;
-      case CMD_VERSION:
-        return parse_cmd_version(cmd_hdr, size);
-        break;
-      case CMD_ENROLL:
-        return parse_cmd_enroll_status(cmd_hdr, size);
-        break;
-      case CMD_IDENTIFY:
-        return parse_cmd_identify(cmd_hdr, size);
-        break;
-      case CMD_LIST_TEMPLATES:
-        return parse_cmd_list_templates(cmd_hdr, size);
-        break;
-      /*
-      case CMD_NAVIGATION:
-        return parse_cmd_navigation_event(cmd_hdr, size);
-        break;
-      case CMD_GPIO_CONTROL:
-        return parse_cmd_gpio_control(cmd_hdr, size);
-        break;
-      */
-      case CMD_GET_SYSTEM_CONFIG:
-        return parse_cmd_get_system_config(cmd_hdr, size);
-        break;
-      /*
-      case CMD_BIST:
-        return parse_cmd_bist(cmd_hdr, size);
-        break;
-       */
-      default:
-        ESP_LOGE(TAG, "Parse Cmd: Unexpected Command ID");
-        break;
-    };
+    const CmdHandler *handler = find_cmd_handler_(cmd_hdr->cmd_id);
+    if (handler == nullptr) {
+      ESP_LOGE(TAG, "Parse Cmd: Unexpected Command ID (0x%04X)", cmd_hdr->cmd_id);
+      return FPC_RESULT_INVALID_PARAM;
+    }
+    // Payloads are checked against their fixed part here; handlers only check the length of trailing data.
+    if (size < handler->size || (!handler->variable_size && size != handler->size)) {
+      ESP_LOGE(TAG, "Parse Cmd: 0x%04X invalid size (%d vs %d)", cmd_hdr->cmd_id, size, handler->size);
+      return FPC_RESULT_INVALID_PARAM;
+    }
+    return (this->*handler->parse)(cmd_hdr, size);
   }
 
   return result;
@@ -915,15 +2042,27 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_status(fpc::fpc_cmd_hdr
     result = FPC_RESULT_INVALID_PARAM;
   }
 
-  if (result == FPC_RESULT_OK) {
-    if (size != sizeof(fpc::fpc_cmd_status_response_t)) {
-      ESP_LOGE(TAG, "CMD_STATUS invalid size (%d vs %d)", size, sizeof(fpc::fpc_cmd_status_response_t));
-      result = FPC_RESULT_INVALID_PARAM;
-    }
-  }
-
   if (result == FPC_RESULT_OK) {
     this->device_state_ = status->state;
+    if (this->app_state == APP_STATE_WAIT_BAUD_SWITCH) {
+      this->baud_confirmed_ = true;
+    } else if (this->app_state == APP_STATE_WAIT_BENCHMARK && cmd_hdr->type == FPC_FRAME_TYPE_CMD_RESPONSE) {
+      this->benchmark_frame_received_();
+    }
+    if (status->event == EVENT_FINGER_LOST && this->debounce_active_) {
+      ESP_LOGV(TAG, "Finger lost, match debounce reset");
+      this->debounce_active_ = false;
+    }
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+    if (status->state & STATE_IDENTIFY) {
+      if (status->event == EVENT_FINGER_DETECT) {
+        this->latency_finger_detect_us_ = micros();
+        this->latency_image_ready_us_ = 0;
+      } else if (status->event == EVENT_IMAGE_READY) {
+        this->latency_image_ready_us_ = micros();
+      }
+    }
+#endif
     ESP_LOGI(TAG, "CMD_STATUS.event = %s (%04X)", get_event_str_(status->event), status->event);
     ESP_LOGI(TAG, "CMD_STATUS.state = %s (%04X)", get_state_str_(status->state).c_str(), status->state);
     ESP_LOGI(TAG, "CMD_STATUS.error = %s (%d)", fpc_result_to_string(status->app_fail_code), status->app_fail_code);
@@ -933,6 +2072,20 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_status(fpc::fpc_cmd_hdr
     if (this->text_status_sensor_ != nullptr) {
       this->text_status_sensor_->publish_state(get_state_str_(status->state));
     }
+    // Storage full below the configured capacity: the real capacity is learned and the enrollment retried
+    // in the slot freed by the eviction policy.
+    bool enroll_retried = false;
+    if (this->app_state == APP_STATE_WAIT_ENROLL && status->app_fail_code == FPC_RESULT_STORAGE_IS_FULL &&
+        this->learn_template_capacity_()) {
+      fpc::fpc_id_type_t id = {ID_TYPE_GENERATE_NEW, 0};
+      if (this->enroll_id)
+        id = {ID_TYPE_SPECIFIED, this->enroll_id};
+      if (this->evict_for_enroll_({FPC_REQUEST_ENROLL, id})) {
+        enroll_retried = true;
+        this->fpc_cmd_abort();
+        this->app_state = APP_STATE_WAIT_ABORT;
+      }
+    }
     if (status->state & STATE_ENROLL) {
       if (status->state & STATE_APP_FW_READY && (status->event == EVENT_NONE)) {
         enrollment_scan_callback_.call(enroll_id);
@@ -943,8 +2096,8 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_status(fpc::fpc_cmd_hdr
       if (status->state & STATE_FINGER_DOWN) {
         this->enroll_idle_time_ = millis();
       }
-      if (status->app_fail_code != 0) {
-        this->enrollment_failed_callback_.call(enroll_id);
+      if (status->app_fail_code != 0 && !enroll_retried) {
+        this->enrollment_failed_(enroll_id);
         if (this->enrolling_binary_sensor_ != nullptr) {
           this->enrolling_binary_sensor_->publish_state(false);
         }
@@ -964,13 +2117,37 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_status(fpc::fpc_cmd_hdr
     if ((this->device_state_ & STATE_IDENTIFY) && (status->app_fail_code != FPC_RESULT_OK)) {
       this->finger_scan_invalid_callback_.call(status->app_fail_code);
     }
+    if ((this->app_state == APP_STATE_WAIT_TEMPLATE_EXPORT || this->app_state == APP_STATE_WAIT_TEMPLATE_IMPORT) &&
+        status->app_fail_code != FPC_RESULT_OK) {
+      this->finish_template_transfer_(false);
+    } else if (this->app_state == APP_STATE_WAIT_TEMPLATE_IMPORT && this->import_put_pending_ &&
+               cmd_hdr->type == FPC_FRAME_TYPE_CMD_RESPONSE) {
+      // Only a response acknowledges the last DATA_PUT, an event may arrive while it is still queued
+      this->import_put_pending_ = false;
+      this->send_template_chunk_();
+    }
+    if (this->app_state == APP_STATE_WAIT_BIST && status->app_fail_code != FPC_RESULT_OK) {
+      // The self test could not run at all, which says as much about the sensor as a failed verdict
+      this->finish_bist_(0, status->app_fail_code);
+    }
+#ifdef USE_CAMERA
+    if (this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE || this->app_state == APP_STATE_WAIT_IMAGE_DATA) {
+      if (status->app_fail_code != FPC_RESULT_OK) {
+        this->finish_image_capture_(false);
+      } else if (this->app_state == APP_STATE_WAIT_IMAGE_CAPTURE &&
+                 (status->event == EVENT_IMAGE_READY || (status->state & STATE_IMAGE_AVAILABLE))) {
+        this->app_state = APP_STATE_WAIT_IMAGE_DATA;
+        this->fpc_cmd_image_data_request(this->camera_->get_image_type());
+      }
+    }
+#endif
   }
   // modify if callbacks are needed for these events
 
-  if ((status->app_fail_code != 0) && cmd_callbacks.on_error) {
-    cmd_callbacks.on_error(status->app_fail_code);
-  } else if (cmd_callbacks.on_status) {
-    cmd_callbacks.on_status(status->event, status->state);
+  if ((status->app_fail_code != 0) && this->cmd_callbacks_.on_error) {
+    this->cmd_callbacks_.on_error(status->app_fail_code);
+  } else if (this->cmd_callbacks_.on_status) {
+    this->cmd_callbacks_.on_status(status->event, status->state);
   }
 
   return result;
@@ -1018,8 +2195,8 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_version(fpc::fpc_cmd_hd
       this->version_sensor_->publish_state(ver->version_str);
     }
   }
-  if (cmd_callbacks.on_version) {
-    cmd_callbacks.on_version(ver->version_str);
+  if (this->cmd_callbacks_.on_version) {
+    this->cmd_callbacks_.on_version(ver->version_str);
   }
 
   return result;
@@ -1036,13 +2213,6 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_enroll_status(fpc::fpc_
     result = FPC_RESULT_INVALID_PARAM;
   }
 
-  if (result == FPC_RESULT_OK) {
-    if (size != sizeof(fpc::fpc_cmd_enroll_status_response_t)) {
-      ESP_LOGE(TAG, "CMD_ENROLL invalid size (%d vs %d)", size, sizeof(fpc::fpc_cmd_enroll_status_response_t));
-      result = FPC_RESULT_INVALID_PARAM;
-    }
-  }
-
   if (result == FPC_RESULT_OK) {
     uint16_t enroll_id = status->id;
     ESP_LOGI(TAG, "CMD_ENROLL.id = %d", status->id);
@@ -1055,6 +2225,7 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_enroll_status(fpc::fpc_
     if (this->num_scans_ != nullptr) {
       this->num_scans_->publish_state((uint8_t) status->samples_remaining);
     }
+    this->enrollment_session_update_(status->feedback, status->samples_remaining);
   }
 
   if (status->feedback == ENROLL_FEEDBACK_REJECT_LOW_QUALITY ||
@@ -1064,7 +2235,9 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_enroll_status(fpc::fpc_
   }
 
   if (status->feedback == ENROLL_FEEDBACK_DONE) {
+    this->invalidate_template_cache_();
     this->enrollment_done_callback_.call(enroll_id);
+    this->enrollment_session_end_("done");
     this->fpc_cmd_list_templates_request();
     this->app_state = APP_STATE_WAIT_LIST_TEMPLATES;
     if (this->enrolling_binary_sensor_ != nullptr) {
@@ -1072,8 +2245,8 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_enroll_status(fpc::fpc_
     }
   }
 
-  if (cmd_callbacks.on_enroll) {
-    cmd_callbacks.on_enroll(status->feedback, status->samples_remaining);
+  if (this->cmd_callbacks_.on_enroll) {
+    this->cmd_callbacks_.on_enroll(status->feedback, status->samples_remaining);
   }
 
   return result;
@@ -1092,13 +2265,6 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_identify(fpc::fpc_cmd_h
     result = FPC_RESULT_INVALID_PARAM;
   }
 
-  if (result == FPC_RESULT_OK) {
-    if (size != sizeof(fpc::fpc_cmd_identify_status_response_t)) {
-      ESP_LOGE(TAG, "CMD_IDENTIFY invalid size (%d vs %d)", size, sizeof(fpc::fpc_cmd_identify_status_response_t));
-      result = FPC_RESULT_INVALID_PARAM;
-    }
-  }
-
   if (result == FPC_RESULT_OK) {
     ESP_LOGI(TAG, "CMD_IDENTIFY.result = %s (0x%04X)", (id_res->match == IDENTIFY_RESULT_MATCH) ? "MATCH" : "No Match",
              id_res->match);
@@ -1109,18 +2275,52 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_identify(fpc::fpc_cmd_h
     tag = id_res->tag;
   }
 
-  if (id_res->match == IDENTIFY_RESULT_MATCH && this->last_finger_id_sensor_ != nullptr) {
+  bool matched = id_res->match == IDENTIFY_RESULT_MATCH;
+  bool unmatched = id_res->match == IDENTIFY_RESULT_NO_MATCH;
+  if (tag == FPC_IDENTIFY_TAG_ALL) {
+    this->identify_fallback_pending_ = false;
+  } else if (tag == this->identify_subset_tag_ && !this->identify_subset_.empty()) {
+    if (matched && !this->in_identify_subset_(finger_id)) {
+      // Only larger subsets are matched against all templates and can hit one outside the subset
+      if (this->identify_subset_fallback_) {
+        tag = FPC_IDENTIFY_TAG_ALL;
+      } else {
+        ESP_LOGD(TAG, "Template %u is not in the identify subset", finger_id);
+        matched = false;
+        unmatched = true;
+      }
+    } else if (unmatched && this->identify_subset_fallback_ && this->identify_subset_.size() == 1) {
+      // The finger is usually still down when the identify is re-armed against all templates
+      ESP_LOGD(TAG, "No match in the identify subset, trying all templates");
+      this->identify_fallback_pending_ = true;
+      return result;
+    }
+  }
+
+  if (matched && this->last_finger_id_sensor_ != nullptr) {
     this->last_finger_id_sensor_->publish_state(id_res->tpl_id.id);
   }
 
-  if (id_res->match == IDENTIFY_RESULT_MATCH) {
-    this->finger_scan_matched_callback_.call(finger_id, tag);
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  const uint32_t response_us = micros();
+#endif
+  if (matched) {
+    if (this->is_repeated_match_(finger_id)) {
+      ESP_LOGD(TAG, "Repeated match of template %u within %" PRIu32 " ms, triggers suppressed", finger_id,
+               this->match_debounce_ms_);
+    } else {
+      this->record_template_match_(finger_id);
+      this->finger_scan_matched_callback_.call(finger_id, tag);
+    }
   }
-  if (id_res->match == IDENTIFY_RESULT_NO_MATCH) {
+  if (unmatched) {
     this->finger_scan_unmatched_callback_.call();
   }
-  if (cmd_callbacks.on_identify) {
-    cmd_callbacks.on_identify(id_res->match == IDENTIFY_RESULT_MATCH, id_res->tpl_id.id);
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  this->record_identify_latency_(response_us);
+#endif
+  if (this->cmd_callbacks_.on_identify) {
+    this->cmd_callbacks_.on_identify(matched, id_res->tpl_id.id);
   }
 
   return result;
@@ -1156,13 +2356,12 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_list_templates(fpc::fpc
     }
     this->list_templates_done_ = true;
     this->n_templates_on_device_ = list->number_of_templates;
-    if (this->fingerprint_count_sensor_ != nullptr) {
-      this->fingerprint_count_sensor_->publish_state((uint8_t) this->n_templates_on_device_);
-    }
+    this->update_template_cache_(list->number_of_templates, list->template_id_list);
+    this->publish_template_storage_();
   }
 
-  if (cmd_callbacks.on_list_templates) {
-    cmd_callbacks.on_list_templates(list->number_of_templates, list->template_id_list);
+  if (this->cmd_callbacks_.on_list_templates) {
+    this->cmd_callbacks_.on_list_templates(list->number_of_templates, list->template_id_list);
   }
 
   return result;
@@ -1177,13 +2376,6 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_get_system_config(fpc::
     result = FPC_RESULT_INVALID_PARAM;
   }
 
-  if (result == FPC_RESULT_OK) {
-    if (size < sizeof(fpc::fpc_cmd_get_config_response_t)) {
-      ESP_LOGE(TAG, "CMD_GET_SYSTEM_CONFIG invalid size (%d vs %d)", size, sizeof(fpc::fpc_cmd_get_config_response_t));
-      result = FPC_RESULT_INVALID_PARAM;
-    }
-  }
-
   if (result == FPC_RESULT_OK) {
     ESP_LOGV(TAG, "%s Config:", cmd_cfg->config_type == 0 ? "Default" : "Custom");
     ESP_LOGV(TAG, "CMD_GET_SYSTEM_CONFIG.ver = %d", cmd_cfg->cfg.version);
@@ -1242,28 +2434,142 @@ fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_get_system_config(fpc::
     this->current_config_ = cmd_cfg->cfg;
   }
 
-  if (cmd_callbacks.on_system_config_get) {
-    cmd_callbacks.on_system_config_get(&cmd_cfg->cfg);
+  if (this->cmd_callbacks_.on_system_config_get) {
+    this->cmd_callbacks_.on_system_config_get(&cmd_cfg->cfg);
   }
 
   return result;
 }
 
+fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_get_template_data(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size) {
+  auto *res = (fpc::fpc_cmd_template_data_response_t *) cmd_hdr;
+
+  ESP_LOGI(TAG, "CMD_GET_TEMPLATE_DATA.id = %d, size = %d", res->id, res->total_size);
+
+  if (this->app_state != APP_STATE_WAIT_TEMPLATE_EXPORT || res->id != this->transfer_id_) {
+    ESP_LOGW(TAG, "Unexpected template data response");
+    return FPC_RESULT_OK;
+  }
+  this->transfer_remaining_ = res->total_size;
+  if (this->transfer_remaining_ == 0) {
+    this->finish_template_transfer_(false);
+  } else {
+    this->fpc_cmd_data_get_request(this->transfer_remaining_);
+  }
+  return FPC_RESULT_OK;
+}
+
+fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_data_get(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size) {
+  auto *res = (fpc::fpc_cmd_data_get_response_t *) cmd_hdr;
+
+  if (size != fpc::FPC_CMD_DATA_GET_RESPONSE_HDR_SIZE + res->data_size) {
+    ESP_LOGE(TAG, "CMD_DATA_GET invalid size (%d)", size);
+    return FPC_RESULT_INVALID_PARAM;
+  }
+  ESP_LOGV(TAG, "CMD_DATA_GET.data_size = %d, remaining = %" PRIu32, res->data_size, res->remaining_size);
+
+#ifdef USE_CAMERA
+  if (this->app_state == APP_STATE_WAIT_IMAGE_DATA) {
+    // Copied once, from the receive buffer into its place in the camera frame
+    this->camera_->write_image_chunk(this->transfer_offset_, res->data, res->data_size);
+    this->transfer_offset_ += res->data_size;
+    this->transfer_remaining_ = res->remaining_size;
+    if (this->transfer_remaining_ > 0) {
+      this->fpc_cmd_data_get_request(this->transfer_remaining_);
+    } else {
+      this->finish_image_capture_(true);
+    }
+    return FPC_RESULT_OK;
+  }
+#endif
+  if (this->app_state != APP_STATE_WAIT_TEMPLATE_EXPORT) {
+    ESP_LOGW(TAG, "Unexpected data chunk");
+    return FPC_RESULT_OK;
+  }
+  // Chunks are handed to the automation straight from the receive buffer, as they arrive
+  this->template_export_chunk_callback_.call(this->transfer_id_, this->transfer_offset_, res->total_size, res->data,
+                                             res->data_size);
+  this->transfer_offset_ += res->data_size;
+  this->transfer_remaining_ = res->remaining_size;
+  if (this->transfer_remaining_ > 0) {
+    this->fpc_cmd_data_get_request(this->transfer_remaining_);
+  } else {
+    this->finish_template_transfer_(true);
+  }
+  return FPC_RESULT_OK;
+}
+
+fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_image_data(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size) {
+  auto *res = (fpc::fpc_cmd_image_response_t *) cmd_hdr;
+
+  ESP_LOGI(TAG, "CMD_IMAGE_DATA.size = %" PRIu32 ", %dx%d, type = %d", res->image_size, res->image_width,
+           res->image_height, res->type);
+
+#ifdef USE_CAMERA
+  if (this->app_state != APP_STATE_WAIT_IMAGE_DATA) {
+    ESP_LOGW(TAG, "Unexpected image data response");
+    return FPC_RESULT_OK;
+  }
+  if (res->image_size == 0 || !this->camera_->begin_image(res->image_width, res->image_height, res->image_size)) {
+    this->finish_image_capture_(false);
+    return FPC_RESULT_OK;
+  }
+  this->transfer_offset_ = 0;
+  this->transfer_remaining_ = res->image_size;
+  this->fpc_cmd_data_get_request(this->transfer_remaining_);
+#endif
+  return FPC_RESULT_OK;
+}
+
+fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_bist(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size) {
+  auto *res = (fpc::fpc_cmd_bist_response_t *) cmd_hdr;
+
+  ESP_LOGI(TAG, "CMD_BIST.sensor_test_result = %u, test_verdict = %u", res->sensor_test_result, res->test_verdict);
+  if (this->app_state != APP_STATE_WAIT_BIST) {
+    ESP_LOGW(TAG, "Unexpected self test response");
+    return FPC_RESULT_OK;
+  }
+  this->finish_bist_(res->sensor_test_result, res->test_verdict);
+  return FPC_RESULT_OK;
+}
+
+fpc::fpc_result_t FingerprintFPC2532Component::parse_cmd_navigation_event(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size) {
+  auto *event = (fpc::fpc_cmd_navigation_status_event_t *) cmd_hdr;
+
+  if (size != sizeof(fpc::fpc_cmd_navigation_status_event_t) + event->n_samples * sizeof(uint16_t)) {
+    ESP_LOGE(TAG, "CMD_NAVIGATION invalid size (%d)", size);
+    return FPC_RESULT_INVALID_PARAM;
+  }
+  ESP_LOGD(TAG, "CMD_NAVIGATION.gesture = %d", event->gesture);
+
+  // Fired straight from the receive path, in the same loop iteration the frame completed
+  if (event->gesture != CMD_NAV_EVENT_NONE)
+    this->navigation_callback_.call(event->gesture);
+  return FPC_RESULT_OK;
+}
+
 /*
 ------------------------
 HAL FUNCTIONS DEFINITONS
 ------------------------
 */
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_hal_init(void) {
+#ifdef USE_ARDUINO
   pinMode(RST_PIN_, OUTPUT);  // RST_N pin
   digitalWrite(RST_PIN_, HIGH);
+#endif
   return FPC_RESULT_OK;
 }
 void FingerprintFPC2532Component::hal_reset_device() {
+#ifdef USE_ARDUINO
   digitalWrite(RST_PIN_, LOW);
   delay(10);
   digitalWrite(RST_PIN_, HIGH);
   ESP_LOGI(TAG, "System Reset via RST_N pin");
+#else
+  // No RST_N pin without the Arduino HAL (e.g. against the host simulator), ask the firmware instead
+  this->fpc_cmd_reset_request();
+#endif
 }
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_hal_tx(uint8_t *data, std::size_t len) {
   if (!data || len == 0) {
@@ -1276,7 +2582,6 @@ fpc::fpc_result_t FingerprintFPC2532Component::fpc_hal_tx(uint8_t *data, std::si
   //  break;
   // }
   this->write_array(data, len);
-  delay(1);
   return FPC_RESULT_OK;  // doesn't guarantee array was actually sent: no timeout handling here
 }
 fpc::fpc_result_t FingerprintFPC2532Component::fpc_hal_rx(uint8_t *data, std::size_t len) {
@@ -1284,7 +2589,54 @@ fpc::fpc_result_t FingerprintFPC2532Component::fpc_hal_rx(uint8_t *data, std::si
 }
 void FingerprintFPC2532Component::fpc_hal_delay_ms(uint32_t ms) { delay(ms); }
 
-void FingerprintFPC2532Component::dump_config() {}
+bool FingerprintFPC2532Component::is_repeated_match_(uint16_t finger_id) {
+  if (this->match_debounce_ms_ == 0)
+    return false;
+  const uint32_t now = millis();
+  if (this->debounce_active_ && this->debounce_finger_id_ == finger_id &&
+      now - this->debounce_match_ms_ < this->match_debounce_ms_)
+    return true;
+  this->debounce_active_ = true;
+  this->debounce_finger_id_ = finger_id;
+  this->debounce_match_ms_ = now;
+  return false;
+}
+
+void FingerprintFPC2532Component::dump_config() {
+  ESP_LOGCONFIG(TAG, "FPC2532 Fingerprint Reader:");
+  if (this->match_debounce_ms_ > 0)
+    ESP_LOGCONFIG(TAG, "  Match Debounce: %" PRIu32 " ms", this->match_debounce_ms_);
+  if (this->bist_interval_ms_ > 0)
+    ESP_LOGCONFIG(TAG, "  Self Test Interval: %" PRIu32 " s", this->bist_interval_ms_ / 1000);
+  ESP_LOGCONFIG(TAG, "  Template Capacity: %u\n  Eviction Policy: %s", this->template_capacity_,
+                this->eviction_policy_ == FPC_EVICTION_LEAST_RECENTLY_MATCHED ? "least recently matched" : "none");
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  this->latency_stats_.dump_config(TAG);
+#endif
+}
+
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+void FingerprintFPC2532Component::record_identify_latency_(uint32_t response_us) {
+  const uint32_t dispatched_us = micros();
+  fingerprint_base::LatencyStats &stats = this->latency_stats_;
+
+  stats.record(fingerprint_base::LATENCY_STAGE_UART, response_us - this->rx_frame_start_us_);
+  stats.record(fingerprint_base::LATENCY_STAGE_DISPATCH, dispatched_us - response_us);
+  // Detect and image ready events are only seen when the sensor reports them, e.g. not on a re-armed identify
+  if (this->latency_image_ready_us_ != 0) {
+    stats.record(fingerprint_base::LATENCY_STAGE_MATCH, response_us - this->latency_image_ready_us_);
+    if (this->latency_finger_detect_us_ != 0) {
+      stats.record(fingerprint_base::LATENCY_STAGE_CAPTURE,
+                   this->latency_image_ready_us_ - this->latency_finger_detect_us_);
+    }
+  }
+  if (this->latency_finger_detect_us_ != 0)
+    stats.record(fingerprint_base::LATENCY_STAGE_TOTAL, dispatched_us - this->latency_finger_detect_us_);
+  this->latency_finger_detect_us_ = 0;
+  this->latency_image_ready_us_ = 0;
+  stats.publish();
+}
+#endif
 
 }  // namespace fingerprint_FPC2532
 }  // namespace esphome
@@ -2,6 +2,8 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/text_sensor/text_sensor.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
@@ -10,7 +12,16 @@
 #include "esphome/components/light/light_state.h"
 #include "esphome/components/light/automation.h"
 #include "esphome/components/monochromatic/monochromatic_light_output.h"
-
+#include "esphome/components/fingerprint_base/fingerprint_reader.h"
+#include "esphome/components/fingerprint_base/latency_stats.h"
+#ifdef USE_EVENT
+#include "esphome/components/event/event.h"
+#endif
+#ifdef USE_POWER_MANAGEMENT
+#include "esphome/components/power_management/power_management.h"
+#endif
+
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <vector>
@@ -22,6 +33,31 @@ namespace fingerprint_FPC2532 {
 const uint8_t MAX_NUMBER_OF_TEMPLATES = 30;
 static const uint32_t DEFAULT_ENROLL_TIMEOUT_MS = 5000;
 static const std::string INITIAL_PASSWORD = "0";
+// Commands waiting for the previous one to be answered by the sensor
+static const uint8_t FPC_CMD_QUEUE_SIZE = 8;
+// Max time the sensor is given to answer a command before the next one is sent
+static const uint32_t FPC_CMD_RESPONSE_TIMEOUT_MS = 100;
+// Queued commands written back to back in one UART burst, their responses arrive in order
+static const uint8_t FPC_CMD_BURST_SIZE = 4;
+// Pending enroll/delete requests from automations; sized so every template can be deleted in one burst
+static const uint8_t FPC_REQUEST_QUEUE_SIZE = MAX_NUMBER_OF_TEMPLATES + 2;
+// Template bytes sent per CMD_DATA_PUT during an import
+static const uint16_t FPC_TEMPLATE_CHUNK_SIZE = 128;
+// Largest request payload sent by the host (CMD_DATA_PUT with a full chunk)
+static const size_t FPC_MAX_CMD_SIZE = std::max(sizeof(fpc::fpc_cmd_set_config_request_t),
+                                                fpc::FPC_CMD_DATA_PUT_REQUEST_HDR_SIZE + FPC_TEMPLATE_CHUNK_SIZE);
+// Time the sensor is given to answer at a baud rate before the next one is tried
+static const uint32_t FPC_BAUD_PROBE_TIMEOUT_MS = 1000;
+// Window over which the host wake duty cycle is averaged
+static const uint32_t FPC_DUTY_CYCLE_INTERVAL_MS = 60000;
+// Status round trips timed by the UART benchmark
+static const uint8_t FPC_BENCHMARK_FRAMES = 20;
+// Self-test verdicts kept to follow the health of the sensor
+static const uint8_t FPC_BIST_HISTORY_SIZE = 16;
+// Delay before a scheduled self-test tries again when the sensor was busy
+static const uint32_t FPC_BIST_RETRY_MS = 30000;
+// Tag of identify requests matching against all templates; subsets use their own non-zero tag
+static const uint16_t FPC_IDENTIFY_TAG_ALL = 0;
 typedef enum {
   APP_STATE_WAIT_READY = 0,
   APP_STATE_WAIT_VERSION,
@@ -31,8 +67,92 @@ typedef enum {
   APP_STATE_WAIT_IDENTIFY,
   APP_STATE_WAIT_ABORT,
   APP_STATE_WAIT_DELETE_TEMPLATES,
-  APP_STATE_SET_CONFIG
+  APP_STATE_SET_CONFIG,
+  APP_STATE_WAIT_TEMPLATE_EXPORT,
+  APP_STATE_WAIT_TEMPLATE_IMPORT,
+  APP_STATE_WAIT_IMAGE_CAPTURE,
+  APP_STATE_WAIT_IMAGE_DATA,
+  APP_STATE_WAIT_BAUD_SWITCH,
+  APP_STATE_WAIT_BENCHMARK,
+  APP_STATE_WAIT_NAVIGATION,
+  APP_STATE_WAIT_BIST
 } app_state_t;
+
+typedef enum {
+  RX_STATE_HEADER = 0,
+  RX_STATE_PAYLOAD,
+  RX_STATE_DISCARD,
+} rx_state_t;
+
+/// What to do with an enrollment when every template slot of the sensor is in use.
+typedef enum : uint8_t {
+  /// Fail the enrollment.
+  FPC_EVICTION_NONE = 0,
+  /// Delete the template matched longest ago (or never) and enroll in its place.
+  FPC_EVICTION_LEAST_RECENTLY_MATCHED,
+} FpcEvictionPolicy;
+
+/// Host-side copy of the template IDs stored on the sensor, persisted across reboots.
+struct FpcTemplateCache {
+  /// Bumped every time the cached list changes.
+  uint32_t generation;
+  /// Hash of the sensor unique ID the list was read from.
+  uint32_t device_hash;
+  uint8_t count;
+  uint16_t ids[MAX_NUMBER_OF_TEMPLATES];
+  /// Slots found on the sensor when it reported FPC_RESULT_STORAGE_IS_FULL, 0 until then.
+  uint8_t capacity;
+  /// Matches counted over the life of the reader; it orders the templates by recency across reboots.
+  uint32_t match_clock;
+  /// match_clock at the last match of ids[i], or at its enrollment when never matched.
+  uint32_t last_match[MAX_NUMBER_OF_TEMPLATES];
+};
+
+/// Progress of the enrollment running on one reader.
+struct FpcEnrollmentSession {
+  bool active;
+  uint16_t finger_id;
+  /// Last ENROLL_FEEDBACK_* reported by the sensor.
+  uint8_t feedback;
+  uint8_t samples_remaining;
+  uint8_t samples_accepted;
+  uint8_t samples_rejected;
+  uint32_t start_ms;
+};
+
+/// One CMD_BIST run, as reported by the sensor.
+struct FpcBistResult {
+  uint16_t sensor_test_result;
+  /// FPC_RESULT_OK when the sensor passed.
+  uint16_t test_verdict;
+};
+
+/// Requests queued by actions, in priority order (lower value is served first).
+/// Aborts are never queued: they preempt the current operation immediately.
+/// Identify is the idle operation resumed once the queue is empty.
+typedef enum : uint8_t {
+  FPC_REQUEST_DELETE = 0,
+  FPC_REQUEST_ENROLL,
+  FPC_REQUEST_EXPORT,
+  FPC_REQUEST_IMPORT,
+  FPC_REQUEST_BENCHMARK,
+  FPC_REQUEST_BIST,
+  FPC_REQUEST_CAPTURE,
+} fpc_request_type_t;
+
+struct FpcRequest {
+  fpc_request_type_t type;
+  fpc::fpc_id_type_t id;
+  /// Template size, FPC_REQUEST_IMPORT only.
+  uint16_t size;
+};
+
+/// A request frame payload queued until the sensor has answered the command in flight.
+struct FpcPendingCommand {
+  uint16_t cmd_id;
+  uint8_t size;
+  uint8_t data[FPC_MAX_CMD_SIZE];
+};
 /*
 class FingerprintSwitch : public switch_::Switch {
  public:
@@ -48,23 +168,40 @@ class FingerprintSwitch : public switch_::Switch {
   std::function<void(bool)> callback_;
 };
 */
-class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDevice {
+#ifdef USE_CAMERA
+class FingerprintFPC2532Camera;
+#endif
+
+class FingerprintFPC2532Component : public PollingComponent,
+                                    public uart::UARTDevice,
+                                    public fingerprint_base::FingerprintReader {
  public:
   //--- State Machine Functions/declarations ---
   app_state_t app_state;
   app_state_t prev_state = APP_STATE_WAIT_READY;
-  fpc::fpc_id_type_t id_type_enroll_request{0, 0};
-  fpc::fpc_id_type_t id_type_delete_request{0, 0};
-  bool enroll_request = false;
-  bool delete_request = false;
 
   void update() override;
+  void loop() override;
+  // Frames are drained from the UART here, the receive buffer must not overflow under a loop budget
+  LoopClass get_loop_class() const override { return LoopClass::LATENCY_CRITICAL; }
   void setup() override;
   void dump_config() override;
-  void set_sensing_pin(GPIOPin *sensing_pin) { this->sensing_pin_ = sensing_pin; }
+  void set_sensing_pin(InternalGPIOPin *sensing_pin) { this->sensing_pin_ = sensing_pin; }
+#ifdef USE_ESP32
+  /// Longest light sleep taken while idle, so the rest of the application still runs at this pace.
+  void set_light_sleep_duration_ms(uint32_t light_sleep_duration_ms) {
+    this->light_sleep_duration_ms_ = light_sleep_duration_ms;
+  }
+#endif
   void set_password(const std::string &password) { this->password_ = password; }
   void set_sensor_power_pin(GPIOPin *sensor_power_pin) { this->sensor_power_pin_ = sensor_power_pin; }
   void set_enroll_timeout_ms(uint32_t period_ms) { this->enroll_timeout_ms_ = period_ms; }
+  /// Repeated matches of the same template within this window, while the finger stays down, do not fire triggers.
+  void set_match_debounce_ms(uint32_t match_debounce_ms) { this->match_debounce_ms_ = match_debounce_ms; }
+  /// Template slots of the sensor; lowered at runtime if the sensor reports a full storage with fewer templates.
+  void set_template_capacity(uint8_t template_capacity) { this->template_capacity_ = template_capacity; }
+  void set_eviction_policy(FpcEvictionPolicy eviction_policy) { this->eviction_policy_ = eviction_policy; }
+  void set_bist_interval_ms(uint32_t bist_interval_ms) { this->bist_interval_ms_ = bist_interval_ms; }
   void set_lockout_time_s(uint8_t lockout_time_s) { this->lockout_time_s_ = lockout_time_s; }
   void set_finger_scan_interval_ms(uint16_t finger_scan_interval_ms) {
     this->finger_scan_interval_ms_ = finger_scan_interval_ms;
@@ -78,6 +215,11 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   void set_stop_mode_uart(bool stop_mode_uart) { this->stop_mode_uart_ = stop_mode_uart; }
   void set_status_at_boot(bool status_at_boot) { this->status_at_boot_ = status_at_boot; }
   void set_uart_irq_before_tx(bool uart_irq_before_tx) { this->uart_irq_before_tx_ = uart_irq_before_tx; }
+  void set_auto_baud_rate(bool auto_baud_rate) { this->auto_baud_rate_ = auto_baud_rate; }
+  /// CMD_NAV_CFG_* flags sent with every navigation request.
+  void set_navigation_config(uint32_t navigation_config) { this->navigation_config_ = navigation_config; }
+  void set_navigation_enabled(bool navigation_enabled) { this->navigation_enabled_ = navigation_enabled; }
+  void set_rx_buffer_size(size_t rx_buffer_size) { this->rx_buffer_size_ = rx_buffer_size; }
   void set_status_sensor(sensor::Sensor *status_sensor) { this->status_sensor_ = status_sensor; }
   void set_text_status_sensor(text_sensor::TextSensor *text_status_sensor) {
     this->text_status_sensor_ = text_status_sensor;
@@ -87,6 +229,10 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   void set_fingerprint_count_sensor(sensor::Sensor *fingerprint_count_sensor) {
     this->fingerprint_count_sensor_ = fingerprint_count_sensor;
   }
+  void set_capacity_sensor(sensor::Sensor *capacity_sensor) { this->capacity_sensor_ = capacity_sensor; }
+  void set_free_template_slots_sensor(sensor::Sensor *free_template_slots_sensor) {
+    this->free_template_slots_sensor_ = free_template_slots_sensor;
+  }
   void set_enrollment_feedback_sensor(sensor::Sensor *enrollment_feedback) {
     this->enrollment_feedback_ = enrollment_feedback;
   }
@@ -97,6 +243,11 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   void set_enrolling_binary_sensor(binary_sensor::BinarySensor *enrolling_binary_sensor) {
     this->enrolling_binary_sensor_ = enrolling_binary_sensor;
   }
+#ifdef USE_EVENT
+  /// Fires one event per enrollment step instead of publishing every progress sensor.
+  void set_enrollment_event(event::Event *enrollment_event) { this->enrollment_event_ = enrollment_event; }
+#endif
+  const FpcEnrollmentSession &get_enrollment_session() const { return this->enrollment_session_; }
   void set_status_at_boot_binary_sensor(binary_sensor::BinarySensor *status_at_boot_binary_sensor) {
     this->status_at_boot_binary_sensor_ = status_at_boot_binary_sensor;
   }
@@ -126,8 +277,89 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   }
 
   void set_baud_rate_sensor(sensor::Sensor *baud_rate_sensor) { this->baud_rate_sensor_ = baud_rate_sensor; }
+  void set_rx_dropped_bytes_sensor(sensor::Sensor *rx_dropped_bytes_sensor) {
+    this->rx_dropped_bytes_sensor_ = rx_dropped_bytes_sensor;
+  }
+  void set_rx_resyncs_sensor(sensor::Sensor *rx_resyncs_sensor) { this->rx_resyncs_sensor_ = rx_resyncs_sensor; }
+  void set_request_queue_depth_sensor(sensor::Sensor *request_queue_depth_sensor) {
+    this->request_queue_depth_sensor_ = request_queue_depth_sensor;
+  }
+  void set_uart_round_trip_time_sensor(sensor::Sensor *uart_round_trip_time_sensor) {
+    this->uart_round_trip_time_sensor_ = uart_round_trip_time_sensor;
+  }
+  void set_uart_frame_rate_sensor(sensor::Sensor *uart_frame_rate_sensor) {
+    this->uart_frame_rate_sensor_ = uart_frame_rate_sensor;
+  }
+  void set_wake_duty_cycle_sensor(sensor::Sensor *wake_duty_cycle_sensor) {
+    this->wake_duty_cycle_sensor_ = wake_duty_cycle_sensor;
+  }
+  void set_bist_verdict_sensor(sensor::Sensor *bist_verdict_sensor) { this->bist_verdict_sensor_ = bist_verdict_sensor; }
+  void set_bist_pass_rate_sensor(sensor::Sensor *bist_pass_rate_sensor) {
+    this->bist_pass_rate_sensor_ = bist_pass_rate_sensor;
+  }
+  void set_bist_consecutive_failures_sensor(sensor::Sensor *bist_consecutive_failures_sensor) {
+    this->bist_consecutive_failures_sensor_ = bist_consecutive_failures_sensor;
+  }
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  void set_latency_sensor(fingerprint_base::LatencyStage stage, fingerprint_base::LatencyStatistic statistic,
+                          sensor::Sensor *sens) {
+    this->latency_stats_.set_sensor(stage, statistic, sens);
+  }
+#endif
 
   bool delay_elapsed(uint32_t duration_ms);
+
+  //--- Template cache ---
+  bool is_template_cache_valid() const { return this->template_cache_valid_; }
+  bool has_template(uint16_t id) const;
+  /// Lowest template ID not present in the cache, 0 if the storage is full or the cache is not valid.
+  uint16_t find_free_template_id() const;
+  uint8_t get_template_capacity() const { return this->template_capacity_; }
+  /// Slots left for enrollments, according to the cache.
+  uint8_t get_free_template_slots() const;
+  /// Match clock value at the last match of id, 0 if id is not enrolled. Larger is more recent.
+  uint32_t get_template_last_match(uint16_t id) const;
+  /// Template the eviction policy deletes next, 0 if there is none.
+  uint16_t find_eviction_candidate() const;
+  void request_enroll(uint16_t finger_id);
+  void request_delete(uint16_t finger_id);
+  void request_delete_all();
+  void request_cancel_enroll();
+  /// Time FPC_BENCHMARK_FRAMES status round trips at the current baud rate.
+  void request_uart_benchmark();
+  /// Run the sensor built-in self test once the sensor is idle.
+  void request_bist();
+  //--- Self-test history ---
+  uint8_t get_bist_history_count() const { return this->bist_history_count_; }
+  /// Result of a past self-test, 0 being the most recent.
+  const FpcBistResult &get_bist_result(uint8_t age) const;
+  /// Share of passed self-tests in the history, in percent.
+  float get_bist_pass_rate() const;
+  /// Make navigation the idle operation instead of identify.
+  void start_navigation();
+  void stop_navigation();
+  bool is_navigation_enabled() const { return this->navigation_enabled_; }
+
+  //--- Identify subset ---
+  /// Restrict identify to finger_ids, reported with tag in on_finger_scan_matched.
+  /// A single template is matched 1:1 on the sensor; larger subsets are matched against all and filtered.
+  /// With fallback, a miss is retried against all templates and matches outside the subset are reported with tag 0.
+  void set_identify_subset(const std::vector<uint16_t> &finger_ids, uint16_t tag, bool fallback);
+  void clear_identify_subset();
+
+  //--- Template transfer ---
+  /// Read a template off the sensor; chunks are delivered through on_template_export_chunk.
+  void request_template_export(uint16_t finger_id);
+  /// Start writing a template of total_size bytes; data follows with write_template_chunk().
+  void request_template_import(uint16_t finger_id, uint16_t total_size);
+  bool write_template_chunk(const std::vector<uint8_t> &data);
+
+#ifdef USE_CAMERA
+  //--- Image capture ---
+  void set_camera(FingerprintFPC2532Camera *camera) { this->camera_ = camera; }
+  /// Capture the next finger touch and stream the image into the camera; served after all other requests.
+  void request_image_capture();
+#endif
   // request public functions
   fpc::fpc_result_t fpc_cmd_abort(void);
   fpc::fpc_result_t fpc_cmd_system_config_get_request(uint8_t type);  // for debug?
@@ -145,6 +377,8 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
     void (*on_system_config_get)(fpc::fpc_system_config_t *cfg);
     void (*on_bist_done)(uint16_t test_verdict);
   } fpc_cmd_callbacks_t;
+  /** Command callback functions, per instance so several readers can share a node. */
+  fpc_cmd_callbacks_t cmd_callbacks_{};
 
   void on_list_templates(int num_templates, uint16_t *template_ids);
   void on_identify(int is_match, uint16_t id);
@@ -153,26 +387,21 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   void on_status(uint16_t event, uint16_t state);
   void on_error(uint16_t error);
 
-  void add_on_finger_scan_matched_callback(std::function<void(uint16_t, uint16_t)> callback) {
-    this->finger_scan_matched_callback_.add(std::move(callback));
-  }
-  void add_on_finger_scan_unmatched_callback(std::function<void()> callback) {
-    this->finger_scan_unmatched_callback_.add(std::move(callback));
-  }
-  void add_on_finger_scan_start_callback(std::function<void()> callback) {
-    this->finger_scan_start_callback_.add(std::move(callback));
-  }
   void add_on_finger_scan_invalid_callback(std::function<void(uint16_t)> callback) {
     this->finger_scan_invalid_callback_.add(std::move(callback));
   }
   void add_on_enrollment_scan_callback(std::function<void(uint16_t)> callback) {
     this->enrollment_scan_callback_.add(std::move(callback));
   }
-  void add_on_enrollment_done_callback(std::function<void(uint16_t)> callback) {
-    this->enrollment_done_callback_.add(std::move(callback));
+  void add_on_navigation_callback(std::function<void(uint16_t)> callback) {
+    this->navigation_callback_.add(std::move(callback));
+  }
+  void add_on_template_evicted_callback(std::function<void(uint16_t)> callback) {
+    this->template_evicted_callback_.add(std::move(callback));
   }
-  void add_on_enrollment_failed_callback(std::function<void(uint16_t)> callback) {
-    this->enrollment_failed_callback_.add(std::move(callback));
+  void add_on_template_export_chunk_callback(
+      std::function<void(uint16_t, uint32_t, uint32_t, const uint8_t *, uint16_t)> callback) {
+    this->template_export_chunk_callback_.add(std::move(callback));
   }
 
  protected:
@@ -191,6 +420,12 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   uint16_t enroll_id;
   uint32_t enroll_idle_time_{0};
   uint32_t enroll_timeout_ms_ = UINT32_MAX;
+  uint32_t match_debounce_ms_{0};
+  // Template of the last match that fired the triggers, cleared on EVENT_FINGER_LOST
+  uint16_t debounce_finger_id_{0};
+  bool debounce_active_{false};
+  uint32_t debounce_match_ms_{0};
+  bool is_repeated_match_(uint16_t finger_id);
   uint8_t lockout_time_s_ = UINT8_MAX;
   uint16_t finger_scan_interval_ms_ = 34;
   uint8_t delay_before_irq_ms_ = 0;
@@ -200,12 +435,44 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   bool stop_mode_uart_ = false;
   bool status_at_boot_ = true;
   bool uart_irq_before_tx_ = true;
+  bool auto_baud_rate_ = false;
+  bool navigation_enabled_ = false;
+  uint32_t navigation_config_ = CMD_NAV_CFG_ORIENTATION_0;
+
+  //--- Identify subset ---
+  std::vector<uint16_t> identify_subset_;
+  uint16_t identify_subset_tag_{FPC_IDENTIFY_TAG_ALL};
+  bool identify_subset_fallback_{false};
+  // Set after a 1:1 miss, the next identify runs against all templates
+  bool identify_fallback_pending_{false};
+  bool in_identify_subset_(uint16_t finger_id) const;
+  void send_identify_request_();
+  void restart_identify_();
 
   bool has_power_pin_ = false;
+  // Set while the wake-up pulse is on the power pin, the queued commands go out once it ends
+  bool sensor_waking_ = false;
+  /// Start the wake-up pulse on the power pin, returns without waiting for it.
   void sensor_wakeup_();
   const uint8_t RST_PIN_ =
       26;  // RST_N pin -evaluate if add it on init_py to set via yaml like sensing_pin and sensor_power_pin
-  GPIOPin *sensing_pin_{nullptr};
+  // IRQ line of the sensor; when set the component runs event-driven from loop() instead of polling
+  InternalGPIOPin *sensing_pin_{nullptr};
+  static void gpio_intr(FingerprintFPC2532Component *arg);
+  bool loop_can_idle_();
+  // Last frame sent or received; the sensor itself goes to sleep time_before_sleep_ms_ after it
+  uint32_t last_activity_ms_{0};
+  uint32_t slept_us_{0};
+  uint32_t duty_cycle_start_us_{0};
+  void publish_wake_duty_cycle_();
+#ifdef USE_ESP32
+  uint32_t light_sleep_duration_ms_{0};
+  void enter_light_sleep_();
+#endif
+#ifdef USE_POWER_MANAGEMENT
+  // Held while the loop can't idle: frames in flight, an enrollment or any request other than the idle operation
+  power_management::PerformanceLock performance_lock_{"fpc2532"};
+#endif
   GPIOPin *sensor_power_pin_{nullptr};
   sensor::Sensor *status_sensor_{nullptr};
   text_sensor::TextSensor *text_status_sensor_{nullptr};
@@ -220,8 +487,27 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   sensor::Sensor *lockout_after_nr_of_fails_sensor_{nullptr};
   sensor::Sensor *lockout_time_s_sensor_{nullptr};
   sensor::Sensor *baud_rate_sensor_{nullptr};
-
-  // sensor::Sensor *capacity_sensor_{nullptr};
+  sensor::Sensor *rx_dropped_bytes_sensor_{nullptr};
+  sensor::Sensor *rx_resyncs_sensor_{nullptr};
+  sensor::Sensor *request_queue_depth_sensor_{nullptr};
+  sensor::Sensor *uart_round_trip_time_sensor_{nullptr};
+  sensor::Sensor *uart_frame_rate_sensor_{nullptr};
+  sensor::Sensor *wake_duty_cycle_sensor_{nullptr};
+  sensor::Sensor *bist_verdict_sensor_{nullptr};
+  sensor::Sensor *bist_pass_rate_sensor_{nullptr};
+  sensor::Sensor *bist_consecutive_failures_sensor_{nullptr};
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  fingerprint_base::LatencyStats latency_stats_;
+  void record_identify_latency_(uint32_t response_us);
+  // micros() of the last EVENT_FINGER_DETECT / EVENT_IMAGE_READY of an identify, 0 when not seen
+  uint32_t latency_finger_detect_us_{0};
+  uint32_t latency_image_ready_us_{0};
+  // micros() when the header of the frame being received was completed
+  uint32_t rx_frame_start_us_{0};
+#endif
+
+  sensor::Sensor *capacity_sensor_{nullptr};
+  sensor::Sensor *free_template_slots_sensor_{nullptr};
   // sensor::Sensor *security_level_sensor_{nullptr};
   sensor::Sensor *last_finger_id_sensor_{nullptr};
   // sensor::Sensor *last_confidence_sensor_{nullptr};
@@ -229,13 +515,11 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   binary_sensor::BinarySensor *uart_irq_before_tx_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *stop_mode_uart_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *status_at_boot_binary_sensor_{nullptr};
-  CallbackManager<void(uint16_t, uint16_t)> finger_scan_matched_callback_;
-  CallbackManager<void()> finger_scan_unmatched_callback_;
   CallbackManager<void(uint16_t)> finger_scan_invalid_callback_;
-  CallbackManager<void()> finger_scan_start_callback_;
   CallbackManager<void(uint16_t)> enrollment_scan_callback_;
-  CallbackManager<void(uint16_t)> enrollment_done_callback_;
-  CallbackManager<void(uint16_t)> enrollment_failed_callback_;
+  CallbackManager<void(uint16_t, uint32_t, uint32_t, const uint8_t *, uint16_t)> template_export_chunk_callback_;
+  CallbackManager<void(uint16_t)> navigation_callback_;
+  CallbackManager<void(uint16_t)> template_evicted_callback_;
 
   //--- State Machine Functions/declarations ---
   bool device_ready_;
@@ -245,6 +529,118 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   uint16_t device_state_;
   uint8_t n_templates_on_device_;
   void process_state();
+  /// Body of loop(), runs with the requests batched.
+  void loop_steps_();
+  /// Arm the sensor with the operation it runs while no request is pending: navigation or identify.
+  void start_idle_operation_(app_state_t *next_state);
+
+  //--- Command pipeline ---
+  FpcPendingCommand cmd_queue_[FPC_CMD_QUEUE_SIZE];
+  uint8_t cmd_queue_head_{0};
+  uint8_t cmd_queue_count_{0};
+  // Commands of the last burst still waiting for their response
+  uint8_t cmds_in_flight_{0};
+  // Set while loop()/update() run, requests are then collected and sent as one burst at the end
+  bool cmd_batching_{false};
+  // Frame headers and payloads of one burst, written with a single write_array()
+  uint8_t cmd_tx_buffer_[FPC_CMD_BURST_SIZE * (sizeof(fpc::fpc_frame_hdr_t) + FPC_MAX_CMD_SIZE)];
+  void fpc_cmd_send_next_();
+  void fpc_cmd_arm_timeout_();
+  void fpc_cmd_complete_();
+
+  //--- Template cache ---
+  FpcTemplateCache template_cache_{};
+  bool template_cache_valid_{false};
+  ESPPreferenceObject template_cache_pref_;
+  uint8_t template_capacity_{MAX_NUMBER_OF_TEMPLATES};
+  FpcEvictionPolicy eviction_policy_{FPC_EVICTION_NONE};
+  // Template deleted by the last eviction, until it is gone from the template list
+  uint16_t evicted_id_{0};
+  void update_template_cache_(uint16_t count, const uint16_t *ids);
+  void invalidate_template_cache_();
+  void publish_template_storage_();
+  /// Stamp id with the next match clock value.
+  void record_template_match_(uint16_t id);
+  /// Lower the capacity to the templates in use after the sensor reported a full storage; false if already known.
+  bool learn_template_capacity_();
+  /// Queue the deletion of the eviction candidate ahead of the enroll request; false if the policy does not allow it.
+  bool evict_for_enroll_(const FpcRequest &request);
+
+  //--- Enrollment session ---
+  FpcEnrollmentSession enrollment_session_{};
+#ifdef USE_EVENT
+  event::Event *enrollment_event_{nullptr};
+#endif
+  void enrollment_session_begin_(uint16_t finger_id);
+  void enrollment_session_update_(uint8_t feedback, uint8_t samples_remaining);
+  /// Close the session with the outcome event ("done", "failed" or "cancelled").
+  void enrollment_session_end_(const char *outcome);
+  void enrollment_failed_(uint16_t finger_id);
+  void publish_enrollment_event_(const char *event_type);
+
+  //--- Request queue ---
+  FpcRequest requests_[FPC_REQUEST_QUEUE_SIZE];
+  uint8_t requests_count_{0};
+  void queue_request_(fpc_request_type_t type, fpc::fpc_id_type_t id);
+  void remove_request_(uint8_t index);
+  /// Index of the highest priority request, -1 if the queue is empty.
+  int8_t next_request_index_() const;
+  /// Start the highest priority request. Returns false if there is nothing to do.
+  bool dispatch_next_request_(app_state_t *next_state);
+  void publish_request_queue_depth_();
+
+  //--- Template transfer ---
+  uint16_t transfer_id_{0};
+  uint32_t transfer_offset_{0};
+  uint32_t transfer_remaining_{0};
+  // Import data handed in but not sent yet; one DATA_PUT is on the wire at a time
+  std::vector<uint8_t> import_buffer_;
+  bool import_put_pending_{false};
+  void send_template_chunk_();
+  void finish_template_transfer_(bool success);
+
+#ifdef USE_CAMERA
+  //--- Image capture ---
+  FingerprintFPC2532Camera *camera_{nullptr};
+  void finish_image_capture_(bool success);
+#endif
+
+  //--- UART baud rate ---
+  uint8_t baud_probe_index_{0};
+  uint32_t baud_probe_start_{0};
+  uint32_t baud_switch_prev_{0};
+  bool baud_confirmed_{false};
+  void switch_host_baud_rate_(uint32_t baud_rate);
+  /// Resume the boot sequence once the configuration is in place.
+  void start_list_templates_(app_state_t *next_state);
+
+  //--- UART benchmark ---
+  uint8_t benchmark_remaining_{0};
+  uint32_t benchmark_start_us_{0};
+  uint32_t benchmark_sent_us_{0};
+  uint32_t benchmark_rtt_sum_us_{0};
+  void benchmark_frame_received_();
+
+  //--- Built-in self test ---
+  uint32_t bist_interval_ms_{0};
+  FpcBistResult bist_history_[FPC_BIST_HISTORY_SIZE]{};
+  uint8_t bist_history_head_{0};
+  uint8_t bist_history_count_{0};
+  uint8_t bist_consecutive_failures_{0};
+  /// Queue a periodic self-test, or try again later if a finger is on the sensor or it is busy.
+  void schedule_bist_();
+  void finish_bist_(uint16_t sensor_test_result, uint16_t test_verdict);
+
+  //--- Receive path ---
+  // Frames are accumulated across loop() calls into a buffer allocated once in setup().
+  uint8_t *rx_buffer_{nullptr};
+  size_t rx_buffer_size_{MAX_HOST_PACKET_SIZE_DEFAULT};
+  fpc::fpc_frame_hdr_t rx_frame_hdr_{};
+  rx_state_t rx_state_{RX_STATE_HEADER};
+  size_t rx_pos_{0};
+  bool rx_resyncing_{false};
+  uint32_t rx_dropped_bytes_{0};
+  uint32_t rx_resyncs_{0};
 
   //--- HOST functions ---
 
@@ -259,16 +655,41 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   fpc::fpc_result_t fpc_cmd_delete_template_request(fpc::fpc_id_type_t *id);
   fpc::fpc_result_t fpc_cmd_reset_request(void);
   fpc::fpc_result_t fpc_cmd_system_config_set_request(fpc::fpc_system_config_t *cfg);
+  fpc::fpc_result_t fpc_cmd_template_data_request(uint16_t cmd_id, uint16_t id, uint16_t total_size);
+  fpc::fpc_result_t fpc_cmd_data_get_request(uint32_t remaining_size);
+  fpc::fpc_result_t fpc_cmd_data_put_request(const uint8_t *data, uint16_t size, uint32_t remaining_size);
+  fpc::fpc_result_t fpc_cmd_capture_request(void);
+  fpc::fpc_result_t fpc_cmd_navigation_request(uint32_t config);
+  fpc::fpc_result_t fpc_cmd_image_data_request(uint16_t type);
+  fpc::fpc_result_t fpc_cmd_bist_request(void);
   // receive
+ public:
+  /// Parser of one CMD_* payload. size is the fixed part of its response struct;
+  /// variable_size commands carry trailing data the handler validates itself.
+  struct CmdHandler {
+    uint16_t cmd_id;
+    uint16_t size;
+    bool variable_size;
+    fpc::fpc_result_t (FingerprintFPC2532Component::*parse)(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  };
+  static const CmdHandler CMD_HANDLERS[];
+
+ protected:
+  static const CmdHandler *find_cmd_handler_(uint16_t cmd_id);
   fpc::fpc_result_t fpc_host_sample_handle_rx_data(void);
   fpc::fpc_result_t parse_cmd(uint8_t *frame_payload, std::size_t size);
   fpc::fpc_result_t parse_cmd_status(fpc::fpc_cmd_hdr_t *cmd_hdr, std::size_t size);
 
   fpc::fpc_result_t parse_cmd_version(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  fpc::fpc_result_t parse_cmd_bist(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
   fpc::fpc_result_t parse_cmd_enroll_status(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
   fpc::fpc_result_t parse_cmd_identify(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
   fpc::fpc_result_t parse_cmd_list_templates(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
   fpc::fpc_result_t parse_cmd_get_system_config(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  fpc::fpc_result_t parse_cmd_get_template_data(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  fpc::fpc_result_t parse_cmd_data_get(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  fpc::fpc_result_t parse_cmd_image_data(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
+  fpc::fpc_result_t parse_cmd_navigation_event(fpc::fpc_cmd_hdr_t *cmd_hdr, size_t size);
 
   //--- HAL functions ---
   fpc::fpc_result_t fpc_hal_init(void);
@@ -278,108 +699,141 @@ class FingerprintFPC2532Component : public PollingComponent, public uart::UARTDe
   void fpc_hal_delay_ms(uint32_t ms);
 };
 
-class FingerScanMatchedTrigger : public Trigger<uint16_t, uint16_t> {
+class FingerScanInvalidTrigger : public Trigger<uint16_t> {
  public:
-  explicit FingerScanMatchedTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_finger_scan_matched_callback(
-        [this](uint16_t finger_id, uint16_t tag) { this->trigger(finger_id, tag); });
+  explicit FingerScanInvalidTrigger(FingerprintFPC2532Component *parent) {
+    parent->add_on_finger_scan_invalid_callback([this](uint16_t capture_error) { this->trigger(capture_error); });
   }
 };
 
-class FingerScanUnmatchedTrigger : public Trigger<> {
+class EnrollmentScanTrigger : public Trigger<uint16_t> {
  public:
-  explicit FingerScanUnmatchedTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_finger_scan_unmatched_callback([this]() { this->trigger(); });
+  explicit EnrollmentScanTrigger(FingerprintFPC2532Component *parent) {
+    parent->add_on_enrollment_scan_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
   }
 };
 
-class FingerScanStartTrigger : public Trigger<> {
+class NavigationTrigger : public Trigger<uint16_t> {
  public:
-  explicit FingerScanStartTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_finger_scan_start_callback([this]() { this->trigger(); });
+  /// gesture is one of CMD_NAV_EVENT_*, CMD_NAV_EVENT_NONE fires on every gesture.
+  explicit NavigationTrigger(FingerprintFPC2532Component *parent, uint16_t gesture) {
+    parent->add_on_navigation_callback([this, gesture](uint16_t event) {
+      if (gesture == CMD_NAV_EVENT_NONE || gesture == event)
+        this->trigger(event);
+    });
   }
 };
 
-class FingerScanInvalidTrigger : public Trigger<uint16_t> {
+class TemplateEvictedTrigger : public Trigger<uint16_t> {
  public:
-  explicit FingerScanInvalidTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_finger_scan_invalid_callback([this](uint16_t capture_error) { this->trigger(capture_error); });
+  explicit TemplateEvictedTrigger(FingerprintFPC2532Component *parent) {
+    parent->add_on_template_evicted_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
   }
 };
 
-class EnrollmentScanTrigger : public Trigger<uint16_t> {
+class TemplateExportChunkTrigger : public Trigger<uint16_t, uint32_t, uint32_t, const uint8_t *, uint16_t> {
  public:
-  explicit EnrollmentScanTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_enrollment_scan_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
+  explicit TemplateExportChunkTrigger(FingerprintFPC2532Component *parent) {
+    parent->add_on_template_export_chunk_callback(
+        [this](uint16_t finger_id, uint32_t offset, uint32_t total_size, const uint8_t *data, uint16_t size) {
+          this->trigger(finger_id, offset, total_size, data, size);
+        });
   }
 };
 
-class EnrollmentDoneTrigger : public Trigger<uint16_t> {
+template<typename... Ts> class EnrollmentAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
-  explicit EnrollmentDoneTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_enrollment_done_callback([this](uint16_t enroll_id) { this->trigger(enroll_id); });
-  }
+  TEMPLATABLE_VALUE(uint16_t, finger_id)
+
+  void play(Ts... x) override { this->parent_->request_enroll(this->finger_id_.value(x...)); }
 };
 
-class EnrollmentFailedTrigger : public Trigger<uint16_t> {
+template<typename... Ts> class DeleteAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
-  explicit EnrollmentFailedTrigger(FingerprintFPC2532Component *parent) {
-    parent->add_on_enrollment_failed_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
-  }
+  TEMPLATABLE_VALUE(uint16_t, finger_id)
+
+  void play(Ts... x) override { this->parent_->request_delete(this->finger_id_.value(x...)); }
 };
 
-template<typename... Ts> class EnrollmentAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+template<typename... Ts> class DeleteAllAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->request_delete_all(); }
+};
+
+template<typename... Ts>
+class ExportTemplateAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
   TEMPLATABLE_VALUE(uint16_t, finger_id)
 
-  void play(Ts... x) override {
-    auto finger_id = this->finger_id_.value(x...);
-    this->parent_->enroll_request = true;
-    if (finger_id) {
-      this->parent_->id_type_enroll_request.type = ID_TYPE_SPECIFIED;
-      this->parent_->id_type_enroll_request.id = finger_id;
-    } else {
-      this->parent_->id_type_enroll_request.type = ID_TYPE_GENERATE_NEW;
-      this->parent_->id_type_enroll_request.id = 0;
-    }
-    this->parent_->fpc_cmd_abort();
-    this->parent_->app_state = APP_STATE_WAIT_ABORT;
-  }
+  void play(Ts... x) override { this->parent_->request_template_export(this->finger_id_.value(x...)); }
 };
 
-template<typename... Ts> class DeleteAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+template<typename... Ts>
+class ImportTemplateAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
   TEMPLATABLE_VALUE(uint16_t, finger_id)
+  TEMPLATABLE_VALUE(uint16_t, size)
 
   void play(Ts... x) override {
-    auto finger_id = this->finger_id_.value(x...);
-    this->parent_->delete_request = true;
-    this->parent_->id_type_delete_request.type = ID_TYPE_SPECIFIED;
-    this->parent_->id_type_delete_request.id = finger_id;
-    this->parent_->fpc_cmd_abort();
-    this->parent_->app_state = APP_STATE_WAIT_ABORT;
+    this->parent_->request_template_import(this->finger_id_.value(x...), this->size_.value(x...));
   }
 };
 
-template<typename... Ts> class DeleteAllAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+template<typename... Ts>
+class ImportTemplateChunkAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  TEMPLATABLE_VALUE(std::vector<uint8_t>, data)
+
+  void play(Ts... x) override { this->parent_->write_template_chunk(this->data_.value(x...)); }
+};
+
+template<typename... Ts>
+class SetIdentifySubsetAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
+  TEMPLATABLE_VALUE(std::vector<uint16_t>, finger_ids)
+  TEMPLATABLE_VALUE(uint16_t, tag)
+  TEMPLATABLE_VALUE(bool, fallback)
+
   void play(Ts... x) override {
-    this->parent_->delete_request = true;
-    this->parent_->id_type_delete_request.type = ID_TYPE_ALL;
-    this->parent_->id_type_delete_request.id = 0;
-    this->parent_->fpc_cmd_abort();
-    this->parent_->app_state = APP_STATE_WAIT_ABORT;
+    this->parent_->set_identify_subset(this->finger_ids_.value(x...), this->tag_.value(x...),
+                                       this->fallback_.value(x...));
   }
 };
 
+template<typename... Ts>
+class ClearIdentifySubsetAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->clear_identify_subset(); }
+};
+
 template<typename... Ts>
 class CancelEnrollmentAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
  public:
-  void play(Ts... x) override {
-    this->parent_->fpc_cmd_abort();
-    this->parent_->fpc_cmd_system_config_get_request(FPC_SYS_CFG_TYPE_CUSTOM);  // DBUG only, delete this line
-    this->parent_->app_state = APP_STATE_WAIT_ABORT;
-  }
+  void play(Ts... x) override { this->parent_->request_cancel_enroll(); }
+};
+
+template<typename... Ts>
+class StartNavigationAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->start_navigation(); }
+};
+
+template<typename... Ts>
+class StopNavigationAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->stop_navigation(); }
+};
+
+template<typename... Ts>
+class UartBenchmarkAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->request_uart_benchmark(); }
+};
+
+template<typename... Ts>
+class BistAction : public Action<Ts...>, public Parented<FingerprintFPC2532Component> {
+ public:
+  void play(Ts... x) override { this->parent_->request_bist(); }
 };
 }  // namespace fingerprint_FPC2532
 }  // namespace esphome
@@ -0,0 +1,43 @@
+import esphome.codegen as cg
+from esphome.components.fingerprint_simulator import (
+    FingerprintSimulator,
+    fingerprint_simulator_schema,
+    register_fingerprint_simulator,
+)
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, PLATFORM_HOST
+
+from . import fingerprint_FPC2532_ns
+
+DEPENDENCIES = ["fingerprint_simulator"]
+
+CONF_UNIQUE_ID = "unique_id"
+
+FingerprintFPC2532Simulator = fingerprint_FPC2532_ns.class_(
+    "FingerprintFPC2532Simulator", FingerprintSimulator
+)
+
+
+def validate_unique_id(value):
+    value = cv.string_strict(value).upper()
+    if len(value) != 24 or any(c not in "0123456789ABCDEF" for c in value):
+        raise cv.Invalid("unique_id must be 24 hexadecimal digits")
+    return value
+
+
+CONFIG_SCHEMA = cv.All(
+    fingerprint_simulator_schema(FingerprintFPC2532Simulator, 921600).extend(
+        {
+            cv.Optional(
+                CONF_UNIQUE_ID, default="000000000000000000000000"
+            ): validate_unique_id,
+        }
+    ),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await register_fingerprint_simulator(var, config)
+    cg.add(var.set_unique_id(config[CONF_UNIQUE_ID]))
@@ -27,6 +27,7 @@ extern "C" {
 #ifndef FPC_API_H_
 #define FPC_API_H_
 
+#include <stddef.h>
 #include <stdint.h>
 namespace fpc {
 /* -----------------------------------------------------------------------------
@@ -155,11 +156,14 @@ typedef struct {
 #define CMD_IDENTIFY 0x0055
 #define CMD_LIST_TEMPLATES 0x0060
 #define CMD_DELETE_TEMPLATE 0x0061
+#define CMD_PUT_TEMPLATE_DATA 0x0062
+#define CMD_GET_TEMPLATE_DATA 0x0063
 #define CMD_GET_SYSTEM_CONFIG 0x006A
 #define CMD_SET_SYSTEM_CONFIG 0x006B
 #define CMD_RESET 0x0072
 #define CMD_SET_DBG_LOG_LEVEL 0x00B0
 #define CMD_DATA_GET 0x0101
+#define CMD_DATA_PUT 0x0102
 #define CMD_NAVIGATION 0x0200
 #define CMD_GPIO_CONTROL 0x0300
 
@@ -457,6 +461,87 @@ typedef struct {
   uint16_t samples[];
 } fpc_cmd_navigation_status_event_t;
 
+/* -----------------------------------------------------------------------------
+ Command Payload Definitions - Template Data Transfer
+------------------------------------------------------------------------------*/
+
+/**
+ * @brief Payload definition of the CMD_GET_TEMPLATE_DATA and
+ * CMD_PUT_TEMPLATE_DATA Requests.
+ *
+ * Note: The data itself is transferred with CMD_DATA_GET / CMD_DATA_PUT.
+ */
+typedef struct {
+  /** Command header. */
+  fpc_cmd_hdr_t cmd;
+  /** Template ID. */
+  uint16_t id;
+  /** Size of the template. Valid for PUT, set to 0 for GET */
+  uint16_t total_size;
+} fpc_cmd_template_data_request_t;
+
+/**
+ * @brief Payload definition of the CMD_GET_TEMPLATE_DATA Response.
+ */
+typedef struct {
+  /** Command header. */
+  fpc_cmd_hdr_t cmd;
+  /** Template ID. */
+  uint16_t id;
+  /** Size of the template. */
+  uint16_t total_size;
+} fpc_cmd_template_data_response_t;
+
+/**
+ * @brief Payload definition of the CMD_DATA_GET Request.
+ */
+typedef struct {
+  /** Command header. */
+  fpc_cmd_hdr_t cmd;
+  /** Bytes left to read of the ongoing transfer. */
+  uint32_t remaining_size;
+  /** Largest chunk the host can receive. */
+  uint32_t max_chunk_size;
+} fpc_cmd_data_get_request_t;
+
+/**
+ * @brief Payload definition of the CMD_DATA_GET Response.
+ */
+typedef struct {
+  /** Command header. */
+  fpc_cmd_hdr_t cmd;
+  /** Bytes left to read after this chunk. */
+  uint32_t remaining_size;
+  /** Total size of the transfer. */
+  uint32_t total_size;
+  /** Size of the data in this chunk. */
+  uint16_t data_size;
+  /** Chunk data. */
+  uint8_t data[];
+} fpc_cmd_data_get_response_t;
+
+/** Header size of the CMD_DATA_GET Response. sizeof() would include the tail padding in front of data. */
+static constexpr size_t FPC_CMD_DATA_GET_RESPONSE_HDR_SIZE = offsetof(fpc_cmd_data_get_response_t, data);
+
+/**
+ * @brief Payload definition of the CMD_DATA_PUT Request.
+ *
+ * Note, repsonse is of CMD_STATUS type
+ */
+typedef struct {
+  /** Command header. */
+  fpc_cmd_hdr_t cmd;
+  /** Bytes left to write after this chunk. */
+  uint32_t remaining_size;
+  /** Size of the data in this chunk. */
+  uint16_t data_size;
+  /** Chunk data. */
+  uint8_t data[];
+} fpc_cmd_data_put_request_t;
+
+/** Header size of the CMD_DATA_PUT Request. sizeof() would include the tail padding in front of data. */
+static constexpr size_t FPC_CMD_DATA_PUT_REQUEST_HDR_SIZE = offsetof(fpc_cmd_data_put_request_t, data);
+
 /* -----------------------------------------------------------------------------
  Command Payload Definitions - System Configuration
 ------------------------------------------------------------------------------*/
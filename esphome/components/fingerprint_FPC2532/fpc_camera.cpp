@@ -0,0 +1,190 @@
+#include "fpc_camera.h"
+
+#ifdef USE_CAMERA
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace fingerprint_FPC2532 {
+
+static const char *const TAG = "fingerprint_FPC2532.camera";
+// Delay before a stream asks for a new image after a failed upload
+static const uint32_t FPC_CAMERA_RETRY_MS = 1000;
+
+static void put_le16(uint8_t *dst, uint16_t value) {
+  dst[0] = value & 0xFF;
+  dst[1] = value >> 8;
+}
+
+static void put_le32(uint8_t *dst, uint32_t value) {
+  put_le16(dst, value & 0xFFFF);
+  put_le16(dst + 2, value >> 16);
+}
+
+/* ---------------- FingerprintFPC2532CameraImageReader class ---------------- */
+void FingerprintFPC2532CameraImageReader::set_image(std::shared_ptr<camera::CameraImage> image) {
+  this->image_ = std::move(image);
+  this->offset_ = 0;
+}
+size_t FingerprintFPC2532CameraImageReader::available() const {
+  if (!this->image_)
+    return 0;
+
+  return this->image_->get_data_length() - this->offset_;
+}
+uint8_t *FingerprintFPC2532CameraImageReader::peek_data_buffer() {
+  return this->image_->get_data_buffer() + this->offset_;
+}
+void FingerprintFPC2532CameraImageReader::consume_data(size_t consumed) { this->offset_ += consumed; }
+void FingerprintFPC2532CameraImageReader::return_image() { this->image_.reset(); }
+
+/* ---------------- FingerprintFPC2532Camera class ---------------- */
+void FingerprintFPC2532Camera::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "FPC2532 Camera:\n"
+                "  Name: %s\n"
+                "  Internal: %s\n"
+                "  Image type: %s",
+                this->name_.c_str(), YESNO(this->is_internal()),
+                this->image_type_ == CMD_IMAGE_REQUEST_TYPE_GET_FMI ? "FMI" : "RAW");
+}
+
+void FingerprintFPC2532Camera::add_image_callback(std::function<void(std::shared_ptr<camera::CameraImage>)> &&callback) {
+  this->new_image_callback_.add(std::move(callback));
+}
+
+camera::CameraImageReader *FingerprintFPC2532Camera::create_image_reader() {
+  return new FingerprintFPC2532CameraImageReader;  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+void FingerprintFPC2532Camera::request_image(camera::CameraRequester requester) {
+  this->single_requesters_ |= (1U << requester);
+  this->parent_->request_image_capture();
+}
+
+void FingerprintFPC2532Camera::start_stream(camera::CameraRequester requester) {
+  this->stream_requesters_ |= (1U << requester);
+  this->parent_->request_image_capture();
+}
+
+void FingerprintFPC2532Camera::stop_stream(camera::CameraRequester requester) {
+  this->stream_requesters_ &= ~(1U << requester);
+}
+
+bool FingerprintFPC2532Camera::begin_image(uint16_t width, uint16_t height, uint32_t size) {
+  if (this->current_image_ && this->current_image_.use_count() > 1) {
+    ESP_LOGW(TAG, "Previous image is still being sent, dropping this one");
+    return false;
+  }
+  this->current_image_.reset();
+
+  // FMI images and raw images of unexpected size are passed through untouched
+  const bool wrap = this->image_type_ == CMD_IMAGE_REQUEST_TYPE_GET_RAW && width > 0 &&
+                    size == static_cast<uint32_t>(width) * height;
+  const uint16_t stride = wrap ? (width + 3) & ~3 : 0;
+  const size_t needed = wrap ? FPC_BMP_HEADER_SIZE + static_cast<size_t>(stride) * height : size;
+
+  if (needed > this->frame_capacity_) {
+    RAMAllocator<uint8_t> allocator;
+    if (this->frame_ != nullptr)
+      allocator.deallocate(this->frame_, this->frame_capacity_);
+    this->frame_ = allocator.allocate(needed);
+    if (this->frame_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate %u bytes for the image", (unsigned) needed);
+      this->frame_capacity_ = 0;
+      return false;
+    }
+    this->frame_capacity_ = needed;
+  }
+
+  this->frame_length_ = needed;
+  this->pixel_offset_ = wrap ? FPC_BMP_HEADER_SIZE : 0;
+  this->width_ = wrap ? width : 0;
+  this->stride_ = stride;
+  if (wrap) {
+    this->write_bmp_header_(width, height);
+    if (stride != width)
+      memset(this->frame_ + FPC_BMP_HEADER_SIZE, 0, needed - FPC_BMP_HEADER_SIZE);
+  }
+  ESP_LOGD(TAG, "Receiving %ux%u image (%" PRIu32 " bytes)", width, height, size);
+  return true;
+}
+
+void FingerprintFPC2532Camera::write_image_chunk(uint32_t offset, const uint8_t *data, size_t length) {
+  if (this->frame_ == nullptr)
+    return;
+
+  if (this->pixel_offset_ == 0) {
+    if (offset + length <= this->frame_length_)
+      memcpy(this->frame_ + offset, data, length);
+    return;
+  }
+
+  // A chunk may span several rows, each of them lands at its padded position
+  while (length > 0) {
+    const size_t row = offset / this->width_;
+    const size_t col = offset % this->width_;
+    const size_t n = std::min<size_t>(length, this->width_ - col);
+    const size_t dst = this->pixel_offset_ + row * this->stride_ + col;
+    if (dst + n > this->frame_length_)
+      return;
+    memcpy(this->frame_ + dst, data, n);
+    offset += n;
+    data += n;
+    length -= n;
+  }
+}
+
+void FingerprintFPC2532Camera::finish_image(bool success) {
+  if (success && this->frame_ != nullptr) {
+    this->current_image_ = std::make_shared<FingerprintFPC2532CameraImage>(
+        this->frame_, this->frame_length_, this->single_requesters_ | this->stream_requesters_);
+    this->new_image_callback_.call(this->current_image_);
+  }
+  this->single_requesters_ = 0;
+
+  if (this->stream_requesters_ == 0)
+    return;
+  if (success) {
+    this->parent_->request_image_capture();
+  } else {
+    this->set_timeout("retry", FPC_CAMERA_RETRY_MS, [this]() {
+      if (this->has_requested_image_())
+        this->parent_->request_image_capture();
+    });
+  }
+}
+
+void FingerprintFPC2532Camera::write_bmp_header_(uint16_t width, uint16_t height) {
+  uint8_t *hdr = this->frame_;
+
+  memset(hdr, 0, FPC_BMP_HEADER_SIZE);
+  // BITMAPFILEHEADER
+  hdr[0] = 'B';
+  hdr[1] = 'M';
+  put_le32(hdr + 2, this->frame_length_);
+  put_le32(hdr + 10, FPC_BMP_HEADER_SIZE);
+  // BITMAPINFOHEADER, negative height stores the rows top-down as the sensor sends them
+  put_le32(hdr + 14, 40);
+  put_le32(hdr + 18, width);
+  put_le32(hdr + 22, static_cast<uint32_t>(-static_cast<int32_t>(height)));
+  put_le16(hdr + 26, 1);
+  put_le16(hdr + 28, 8);
+  put_le32(hdr + 34, this->frame_length_ - FPC_BMP_HEADER_SIZE);
+  put_le32(hdr + 46, 256);
+  // Grayscale palette
+  uint8_t *palette = hdr + 54;
+  for (uint16_t i = 0; i < 256; i++) {
+    palette[i * 4 + 0] = i;
+    palette[i * 4 + 1] = i;
+    palette[i * 4 + 2] = i;
+  }
+}
+
+}  // namespace fingerprint_FPC2532
+}  // namespace esphome
+
+#endif  // USE_CAMERA
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_CAMERA
+
+#include "esphome/core/helpers.h"
+#include "esphome/components/camera/camera.h"
+#include "fingerprint_FPC2532.h"
+
+namespace esphome {
+namespace fingerprint_FPC2532 {
+
+/// Grayscale raw images are wrapped in an 8-bit BMP so clients can display them without an encoder.
+static const size_t FPC_BMP_HEADER_SIZE = 14 + 40 + 256 * 4;
+
+/* ---------------- FingerprintFPC2532CameraImage class ---------------- */
+/// View on the camera frame buffer; the buffer is owned by FingerprintFPC2532Camera and reused once released.
+class FingerprintFPC2532CameraImage : public camera::CameraImage {
+ public:
+  FingerprintFPC2532CameraImage(uint8_t *data, size_t length, uint8_t requesters)
+      : data_(data), length_(length), requesters_(requesters) {}
+  uint8_t *get_data_buffer() override { return this->data_; }
+  size_t get_data_length() override { return this->length_; }
+  bool was_requested_by(camera::CameraRequester requester) const override {
+    return (this->requesters_ & (1 << requester)) != 0;
+  }
+
+ protected:
+  uint8_t *data_;
+  size_t length_;
+  uint8_t requesters_;
+};
+
+/* ---------------- FingerprintFPC2532CameraImageReader class ---------------- */
+class FingerprintFPC2532CameraImageReader : public camera::CameraImageReader {
+ public:
+  void set_image(std::shared_ptr<camera::CameraImage> image) override;
+  size_t available() const override;
+  uint8_t *peek_data_buffer() override;
+  void consume_data(size_t consumed) override;
+  void return_image() override;
+
+ protected:
+  std::shared_ptr<camera::CameraImage> image_;
+  size_t offset_{0};
+};
+
+/* ---------------- FingerprintFPC2532Camera class ---------------- */
+/// Diagnostic camera fed by the FPC2532 image upload.
+/// Chunks received from the sensor are written in place into a single frame buffer, so at most one frame is held.
+class FingerprintFPC2532Camera : public camera::Camera, public Parented<FingerprintFPC2532Component> {
+ public:
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_image_type(uint16_t image_type) { this->image_type_ = image_type; }
+  /// One of CMD_IMAGE_REQUEST_TYPE_GET_*.
+  uint16_t get_image_type() const { return this->image_type_; }
+
+  /* camera::Camera */
+  void add_image_callback(std::function<void(std::shared_ptr<camera::CameraImage>)> &&callback) override;
+  camera::CameraImageReader *create_image_reader() override;
+  void request_image(camera::CameraRequester requester) override;
+  void start_stream(camera::CameraRequester requester) override;
+  void stop_stream(camera::CameraRequester requester) override;
+
+  /* driven by the parent while an image is uploaded */
+  /// Prepare the frame buffer for an image of the given geometry. Returns false if no buffer is available.
+  bool begin_image(uint16_t width, uint16_t height, uint32_t size);
+  void write_image_chunk(uint32_t offset, const uint8_t *data, size_t length);
+  void finish_image(bool success);
+
+ protected:
+  bool has_requested_image_() const { return (this->single_requesters_ | this->stream_requesters_) != 0; }
+  void write_bmp_header_(uint16_t width, uint16_t height);
+
+  uint16_t image_type_{CMD_IMAGE_REQUEST_TYPE_GET_RAW};
+  uint8_t single_requesters_{0};
+  uint8_t stream_requesters_{0};
+
+  uint8_t *frame_{nullptr};
+  size_t frame_capacity_{0};
+  size_t frame_length_{0};
+  /// Bytes before the first pixel, 0 when the upload is passed through unchanged.
+  size_t pixel_offset_{0};
+  uint16_t width_{0};
+  /// BMP rows are padded to a multiple of four bytes.
+  uint16_t stride_{0};
+
+  std::shared_ptr<FingerprintFPC2532CameraImage> current_image_;
+  CallbackManager<void(std::shared_ptr<camera::CameraImage>)> new_image_callback_{};
+};
+
+}  // namespace fingerprint_FPC2532
+}  // namespace esphome
+
+#endif  // USE_CAMERA
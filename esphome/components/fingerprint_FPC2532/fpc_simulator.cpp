@@ -0,0 +1,278 @@
+#include "fpc_simulator.h"
+
+#ifdef USE_FINGERPRINT_SIMULATOR
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace esphome {
+namespace fingerprint_FPC2532 {
+
+static const char *const TAG = "fingerprint_FPC2532.simulator";
+static const char *const SIMULATOR_VERSION = "FPC2532 simulator";
+
+void FingerprintFPC2532Simulator::set_unique_id(const std::string &unique_id) {
+  for (uint8_t i = 0; i < 3; i++) {
+    auto word = parse_hex<uint32_t>(unique_id.substr(i * 8, 8));
+    this->unique_id_[i] = word.value_or(0);
+  }
+}
+
+void FingerprintFPC2532Simulator::receive_(const uint8_t *data, size_t len) {
+  this->rx_frame_.insert(this->rx_frame_.end(), data, data + len);
+  while (this->rx_frame_.size() >= sizeof(fpc::fpc_frame_hdr_t)) {
+    memcpy(&this->rx_hdr_, this->rx_frame_.data(), sizeof(fpc::fpc_frame_hdr_t));
+    if (this->rx_hdr_.version != FPC_FRAME_PROTOCOL_VERSION || this->rx_hdr_.type != FPC_FRAME_TYPE_CMD_REQUEST ||
+        (this->rx_hdr_.flags & FPC_FRAME_FLAG_SENDER_HOST) == 0) {
+      ESP_LOGW(TAG, "Invalid request header, dropping one byte");
+      this->rx_frame_.erase(this->rx_frame_.begin());
+      continue;
+    }
+    const size_t frame_size = sizeof(fpc::fpc_frame_hdr_t) + this->rx_hdr_.payload_size;
+    if (this->rx_frame_.size() < frame_size)
+      return;
+    this->frames_received_++;
+    this->handle_request_(this->rx_frame_.data() + sizeof(fpc::fpc_frame_hdr_t), this->rx_hdr_.payload_size);
+    this->rx_frame_.erase(this->rx_frame_.begin(), this->rx_frame_.begin() + frame_size);
+  }
+}
+
+void FingerprintFPC2532Simulator::handle_request_(const uint8_t *payload, size_t size) {
+  if (size < sizeof(fpc::fpc_cmd_hdr_t)) {
+    ESP_LOGW(TAG, "Request payload of %u bytes too short", (unsigned) size);
+    return;
+  }
+  fpc::fpc_cmd_hdr_t cmd;
+  memcpy(&cmd, payload, sizeof(cmd));
+  ESP_LOGV(TAG, "Request cmd_id=0x%04X, size=%u", cmd.cmd_id, (unsigned) size);
+
+  if (this->inject_error_()) {
+    ESP_LOGV(TAG, "Injecting failure for cmd_id=0x%04X", cmd.cmd_id);
+    this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_CMD_FAILED, FPC_RESULT_FAILURE);
+    return;
+  }
+
+  switch (cmd.cmd_id) {
+    case CMD_STATUS:
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    case CMD_VERSION: {
+      const size_t str_len = strlen(SIMULATOR_VERSION) + 1;
+      std::vector<uint8_t> buf(sizeof(fpc::fpc_cmd_version_response_t) + str_len);
+      auto *ver = reinterpret_cast<fpc::fpc_cmd_version_response_t *>(buf.data());
+      memcpy(ver->mcu_unique_id, this->unique_id_, sizeof(this->unique_id_));
+      ver->version_str_len = str_len;
+      memcpy(ver->version_str, SIMULATOR_VERSION, str_len);
+      this->send_cmd_(CMD_VERSION, FPC_FRAME_TYPE_CMD_RESPONSE, buf.data(), buf.size());
+      break;
+    }
+    case CMD_BIST: {
+      fpc::fpc_cmd_bist_response_t bist{};
+      bist.sensor_test_result = FPC_RESULT_OK;
+      bist.test_verdict = FPC_RESULT_OK;
+      this->send_cmd_(CMD_BIST, FPC_FRAME_TYPE_CMD_RESPONSE, &bist, sizeof(bist), this->match_time_ms_);
+      break;
+    }
+    case CMD_CAPTURE:
+      this->state_ |= STATE_CAPTURE;
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    case CMD_ABORT:
+      this->state_ &= ~(STATE_CAPTURE | STATE_ENROLL | STATE_IDENTIFY | STATE_NAVIGATION);
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    case CMD_ENROLL:
+      if (size < sizeof(fpc::fpc_cmd_enroll_request_t))
+        break;
+      this->handle_enroll_(reinterpret_cast<const fpc::fpc_cmd_enroll_request_t *>(payload));
+      break;
+    case CMD_IDENTIFY: {
+      if (size < sizeof(fpc::fpc_cmd_identify_request_t))
+        break;
+      fpc::fpc_cmd_identify_request_t req;
+      memcpy(&req, payload, sizeof(req));
+      this->identify_id_ = req.tpl_id;
+      this->identify_tag_ = req.tag;
+      this->state_ |= STATE_IDENTIFY;
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    }
+    case CMD_LIST_TEMPLATES: {
+      const uint16_t count = this->templates_.size();
+      std::vector<uint8_t> buf(sizeof(fpc::fpc_cmd_template_info_response_t) + count * sizeof(uint16_t));
+      auto *info = reinterpret_cast<fpc::fpc_cmd_template_info_response_t *>(buf.data());
+      info->number_of_templates = count;
+      memcpy(info->template_id_list, this->templates_.data(), count * sizeof(uint16_t));
+      this->send_cmd_(CMD_LIST_TEMPLATES, FPC_FRAME_TYPE_CMD_RESPONSE, buf.data(), buf.size());
+      break;
+    }
+    case CMD_DELETE_TEMPLATE:
+      if (size < sizeof(fpc::fpc_cmd_template_delete_request_t))
+        break;
+      this->handle_delete_(reinterpret_cast<const fpc::fpc_cmd_template_delete_request_t *>(payload));
+      break;
+    case CMD_GET_SYSTEM_CONFIG: {
+      if (size < sizeof(fpc::fpc_cmd_get_config_request_t))
+        break;
+      fpc::fpc_cmd_get_config_response_t rsp{};
+      rsp.config_type = reinterpret_cast<const fpc::fpc_cmd_get_config_request_t *>(payload)->config_type;
+      rsp.cfg = this->config_;
+      this->send_cmd_(CMD_GET_SYSTEM_CONFIG, FPC_FRAME_TYPE_CMD_RESPONSE, &rsp, sizeof(rsp));
+      break;
+    }
+    case CMD_SET_SYSTEM_CONFIG:
+      if (size < sizeof(fpc::fpc_cmd_set_config_request_t))
+        break;
+      memcpy(&this->config_, payload + offsetof(fpc::fpc_cmd_set_config_request_t, cfg), sizeof(this->config_));
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    case CMD_NAVIGATION:
+      this->state_ |= STATE_NAVIGATION;
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+      break;
+    case CMD_RESET:
+      // Answered once the firmware is back up
+      this->state_ = STATE_APP_FW_READY;
+      this->rx_frame_.clear();
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE, FPC_RESULT_OK, FPC_SIMULATOR_BOOT_MS);
+      return;
+    default:
+      this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE, FPC_RESULT_CMD_ID_NOT_SUPPORTED);
+      return;
+  }
+}
+
+void FingerprintFPC2532Simulator::handle_enroll_(const fpc::fpc_cmd_enroll_request_t *req) {
+  uint16_t id = req->tpl_id.id;
+  if (req->tpl_id.type == ID_TYPE_GENERATE_NEW) {
+    id = 1;
+    while (this->has_template(id))
+      id++;
+  } else if (this->has_template(id)) {
+    this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE, FPC_RESULT_USER_ID_EXISTS);
+    return;
+  }
+  this->enroll_id_ = id;
+  this->enroll_remaining_ = FPC_SIMULATOR_ENROLL_SAMPLES;
+  this->state_ |= STATE_ENROLL;
+  this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+}
+
+void FingerprintFPC2532Simulator::handle_delete_(const fpc::fpc_cmd_template_delete_request_t *req) {
+  if (req->tpl_id.type == ID_TYPE_ALL) {
+    this->templates_.clear();
+  } else if (this->has_template(req->tpl_id.id)) {
+    this->remove_template_(req->tpl_id.id);
+  } else {
+    this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE, FPC_RESULT_USER_ID_NOT_FOUND);
+    return;
+  }
+  this->send_status_(FPC_FRAME_TYPE_CMD_RESPONSE, EVENT_NONE);
+}
+
+void FingerprintFPC2532Simulator::on_finger_down_(uint16_t finger_id) {
+  this->state_ |= STATE_FINGER_DOWN;
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_FINGER_DETECT);
+  if ((this->state_ & (STATE_CAPTURE | STATE_ENROLL | STATE_IDENTIFY | STATE_NAVIGATION)) == 0)
+    return;
+
+  // Image capture and matching take match_time, all later frames queue up behind it
+  if (this->inject_error_()) {
+    if (this->state_ & STATE_ENROLL) {
+      fpc::fpc_cmd_enroll_status_response_t rsp{};
+      rsp.id = this->enroll_id_;
+      rsp.feedback = ENROLL_FEEDBACK_REJECT_LOW_QUALITY;
+      rsp.samples_remaining = this->enroll_remaining_;
+      this->send_cmd_(CMD_ENROLL, FPC_FRAME_TYPE_CMD_EVENT, &rsp, sizeof(rsp), this->match_time_ms_);
+      return;
+    }
+    this->state_ &= ~(STATE_CAPTURE | STATE_IDENTIFY);
+    this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_CMD_FAILED, FPC_RESULT_BAD_IMAGE_QUALITY, this->match_time_ms_);
+    return;
+  }
+
+  if (this->state_ & STATE_NAVIGATION) {
+    fpc::fpc_cmd_navigation_status_event_t nav{};
+    nav.gesture = CMD_NAV_EVENT_PRESS;
+    this->send_cmd_(CMD_NAVIGATION, FPC_FRAME_TYPE_CMD_EVENT, &nav, sizeof(nav), this->match_time_ms_);
+  } else if (this->state_ & STATE_ENROLL) {
+    this->finish_enroll_sample_(finger_id);
+  } else if (this->state_ & STATE_IDENTIFY) {
+    this->finish_identify_(finger_id);
+  } else {
+    this->state_ = (this->state_ & ~STATE_CAPTURE) | STATE_IMAGE_AVAILABLE;
+    this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_IMAGE_READY, FPC_RESULT_OK, this->match_time_ms_);
+  }
+}
+
+void FingerprintFPC2532Simulator::on_finger_up_() {
+  this->state_ &= ~STATE_FINGER_DOWN;
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_FINGER_LOST);
+}
+
+void FingerprintFPC2532Simulator::finish_identify_(uint16_t finger_id) {
+  const bool known = finger_id != fingerprint_simulator::UNKNOWN_FINGER && this->has_template(finger_id);
+  const bool match = known && (this->identify_id_.type == ID_TYPE_ALL ||
+                               (this->identify_id_.type == ID_TYPE_SPECIFIED && this->identify_id_.id == finger_id));
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_IMAGE_READY, FPC_RESULT_OK, this->match_time_ms_);
+
+  fpc::fpc_cmd_identify_status_response_t rsp{};
+  rsp.match = match ? IDENTIFY_RESULT_MATCH : IDENTIFY_RESULT_NO_MATCH;
+  rsp.tpl_id.type = match ? ID_TYPE_SPECIFIED : ID_TYPE_NONE;
+  rsp.tpl_id.id = match ? finger_id : 0;
+  rsp.tag = this->identify_tag_;
+  this->send_cmd_(CMD_IDENTIFY, FPC_FRAME_TYPE_CMD_EVENT, &rsp, sizeof(rsp));
+
+  this->state_ &= ~STATE_IDENTIFY;
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_NONE);
+}
+
+void FingerprintFPC2532Simulator::finish_enroll_sample_(uint16_t finger_id) {
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_IMAGE_READY, FPC_RESULT_OK, this->match_time_ms_);
+  this->enroll_remaining_--;
+
+  fpc::fpc_cmd_enroll_status_response_t rsp{};
+  rsp.id = this->enroll_id_;
+  rsp.feedback = this->enroll_remaining_ == 0 ? ENROLL_FEEDBACK_DONE : ENROLL_FEEDBACK_PROGRESS;
+  rsp.samples_remaining = this->enroll_remaining_;
+  if (this->enroll_remaining_ == 0) {
+    ESP_LOGD(TAG, "Enrolled template %u", this->enroll_id_);
+    this->add_template(this->enroll_id_);
+    this->state_ &= ~STATE_ENROLL;
+  }
+  this->send_cmd_(CMD_ENROLL, FPC_FRAME_TYPE_CMD_EVENT, &rsp, sizeof(rsp));
+  this->send_status_(FPC_FRAME_TYPE_CMD_EVENT, EVENT_NONE);
+}
+
+void FingerprintFPC2532Simulator::send_cmd_(uint16_t cmd_id, uint16_t type, const void *payload, size_t size,
+                                            uint32_t extra_delay_ms) {
+  fpc::fpc_frame_hdr_t hdr{};
+  hdr.version = FPC_FRAME_PROTOCOL_VERSION;
+  hdr.type = type;
+  hdr.flags = FPC_FRAME_FLAG_SENDER_FW_APP;
+  hdr.payload_size = size;
+
+  std::vector<uint8_t> frame(sizeof(hdr) + size);
+  memcpy(frame.data(), &hdr, sizeof(hdr));
+  memcpy(frame.data() + sizeof(hdr), payload, size);
+  fpc::fpc_cmd_hdr_t cmd{cmd_id, type};
+  memcpy(frame.data() + sizeof(hdr), &cmd, sizeof(cmd));
+  this->send_frame_(std::move(frame), extra_delay_ms);
+}
+
+void FingerprintFPC2532Simulator::send_status_(uint16_t type, uint16_t event, uint16_t app_fail_code,
+                                               uint32_t extra_delay_ms) {
+  fpc::fpc_cmd_status_response_t status{};
+  status.event = event;
+  status.state = this->state_;
+  status.app_fail_code = app_fail_code;
+  this->send_cmd_(CMD_STATUS, type, &status, sizeof(status), extra_delay_ms);
+}
+
+}  // namespace fingerprint_FPC2532
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_SIMULATOR
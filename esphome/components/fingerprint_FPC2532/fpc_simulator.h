@@ -0,0 +1,63 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_FINGERPRINT_SIMULATOR
+
+#include "esphome/components/fingerprint_simulator/fingerprint_simulator.h"
+#include "fpc_api.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace fingerprint_FPC2532 {
+
+// Accepted touches needed to complete a simulated enrollment
+static const uint8_t FPC_SIMULATOR_ENROLL_SAMPLES = 6;
+// Time the firmware takes to come back after CMD_RESET
+static const uint32_t FPC_SIMULATOR_BOOT_MS = 100;
+
+/* ---------------- FingerprintFPC2532Simulator class ---------------- */
+/// FPC2532 speaking the fpc_frame_hdr_t / fpc_cmd_hdr_t protocol.
+/// Template data, image and data transfer commands are answered with FPC_RESULT_CMD_ID_NOT_SUPPORTED.
+class FingerprintFPC2532Simulator : public fingerprint_simulator::FingerprintSimulator {
+ public:
+  /// 24 hex digits, the password of the fingerprint_FPC2532 component driving it.
+  void set_unique_id(const std::string &unique_id);
+
+ protected:
+  const char *model_name_() const override { return "FPC2532"; }
+  void receive_(const uint8_t *data, size_t len) override;
+  void on_finger_down_(uint16_t finger_id) override;
+  void on_finger_up_() override;
+
+  void handle_request_(const uint8_t *payload, size_t size);
+  void handle_enroll_(const fpc::fpc_cmd_enroll_request_t *req);
+  void handle_delete_(const fpc::fpc_cmd_template_delete_request_t *req);
+  void finish_identify_(uint16_t finger_id);
+  void finish_enroll_sample_(uint16_t finger_id);
+
+  void send_cmd_(uint16_t cmd_id, uint16_t type, const void *payload, size_t size, uint32_t extra_delay_ms = 0);
+  void send_status_(uint16_t type, uint16_t event, uint16_t app_fail_code = FPC_RESULT_OK,
+                    uint32_t extra_delay_ms = 0);
+
+  uint32_t unique_id_[3]{};
+  fpc::fpc_system_config_t config_{};
+  uint16_t state_{STATE_APP_FW_READY};
+
+  // Identify target and tag of the armed identify
+  fpc::fpc_id_type_t identify_id_{};
+  uint16_t identify_tag_{0};
+  uint16_t enroll_id_{0};
+  uint8_t enroll_remaining_{0};
+
+  // Request being received from the driver
+  fpc::fpc_frame_hdr_t rx_hdr_{};
+  std::vector<uint8_t> rx_frame_;
+};
+
+}  // namespace fingerprint_FPC2532
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_SIMULATOR
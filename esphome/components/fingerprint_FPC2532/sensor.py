@@ -1,5 +1,10 @@
 import esphome.codegen as cg
 from esphome.components import sensor
+from esphome.components.fingerprint_base import (
+    CONF_IDENTIFY_LATENCY,
+    latency_schema,
+    setup_latency_sensors,
+)
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_CAPACITY,
@@ -15,6 +20,10 @@ from esphome.const import (
     ICON_DATABASE,
     ICON_FINGERPRINT,
     ICON_SECURITY,
+    ICON_TIMER,
+    UNIT_PERCENT,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
 )
 
 from . import CONF_FINGERPRINT_FPC2532_ID, FingerprintFPC2532Component
@@ -33,6 +42,20 @@ CONF_IDLE_TIME_BEFORE_SLEEP = "idle_time_before_sleep_ms"
 CONF_UART_DLY_BEFORE_TX = "uart_dly_before_tx_ms"
 CONF_SCAN_INTERVAL = "scan_interval_ms"
 CONF_BAUD_RATE = "baud_rate"
+CONF_RX_DROPPED_BYTES = "rx_dropped_bytes"
+CONF_RX_RESYNCS = "rx_resyncs"
+CONF_REQUEST_QUEUE_DEPTH = "request_queue_depth"
+CONF_UART_ROUND_TRIP_TIME = "uart_round_trip_time"
+CONF_UART_FRAME_RATE = "uart_frame_rate"
+CONF_WAKE_DUTY_CYCLE = "wake_duty_cycle"
+CONF_BIST_VERDICT = "bist_verdict"
+CONF_BIST_PASS_RATE = "bist_pass_rate"
+CONF_BIST_CONSECUTIVE_FAILURES = "bist_consecutive_failures"
+CONF_FREE_TEMPLATE_SLOTS = "free_template_slots"
+ICON_HEART_PULSE = "mdi:heart-pulse"
+ICON_SLEEP = "mdi:sleep"
+UNIT_MICROSECOND = "µs"
+UNIT_FRAMES_PER_SECOND = "frames/s"
 
 VALID_BAUD_RATES = [9600, 19200, 38400, 57600, 115200, 230400, 460800, 921600]
 
@@ -55,6 +78,11 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_DATABASE,
             accuracy_decimals=0,
         ),
+        cv.Optional(CONF_FREE_TEMPLATE_SLOTS): sensor.sensor_schema(
+            icon=ICON_DATABASE,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
         cv.Optional(CONF_NUM_SCANS): sensor.sensor_schema(
             icon=ICON_DATABASE,
             accuracy_decimals=0,
@@ -109,6 +137,64 @@ CONFIG_SCHEMA = cv.Schema(
             accuracy_decimals=0,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_RX_DROPPED_BYTES): sensor.sensor_schema(
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_RX_RESYNCS): sensor.sensor_schema(
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_REQUEST_QUEUE_DEPTH): sensor.sensor_schema(
+            icon=ICON_DATABASE,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_UART_ROUND_TRIP_TIME): sensor.sensor_schema(
+            unit_of_measurement=UNIT_MICROSECOND,
+            icon=ICON_TIMER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_UART_FRAME_RATE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_FRAMES_PER_SECOND,
+            icon=ICON_TIMER,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_WAKE_DUTY_CYCLE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon=ICON_SLEEP,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_BIST_VERDICT): sensor.sensor_schema(
+            icon=ICON_HEART_PULSE,
+            accuracy_decimals=0,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_BIST_PASS_RATE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon=ICON_HEART_PULSE,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_BIST_CONSECUTIVE_FAILURES): sensor.sensor_schema(
+            icon=ICON_HEART_PULSE,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_IDENTIFY_LATENCY): latency_schema(
+            ["capture", "match", "uart", "dispatch", "total"]
+        ),
     }
 )
 
@@ -120,6 +206,7 @@ async def to_code(config):
         CONF_FINGERPRINT_COUNT,
         CONF_STATUS,
         CONF_CAPACITY,
+        CONF_FREE_TEMPLATE_SLOTS,
         CONF_SECURITY_LEVEL,
         CONF_LAST_FINGER_ID,
         CONF_LAST_CONFIDENCE,
@@ -131,6 +218,15 @@ async def to_code(config):
         CONF_LOCKOUT_AFTER_NR_OF_FAILS,
         CONF_LOCKOUT_TIME,
         CONF_BAUD_RATE,
+        CONF_RX_DROPPED_BYTES,
+        CONF_RX_RESYNCS,
+        CONF_REQUEST_QUEUE_DEPTH,
+        CONF_UART_ROUND_TRIP_TIME,
+        CONF_UART_FRAME_RATE,
+        CONF_WAKE_DUTY_CYCLE,
+        CONF_BIST_VERDICT,
+        CONF_BIST_PASS_RATE,
+        CONF_BIST_CONSECUTIVE_FAILURES,
     ]:
         if key not in config:
             continue
@@ -138,6 +234,9 @@ async def to_code(config):
         sens = await sensor.new_sensor(conf)
         cg.add(getattr(hub, f"set_{key}_sensor")(sens))
 
+    if CONF_IDENTIFY_LATENCY in config:
+        await setup_latency_sensors(hub, config[CONF_IDENTIFY_LATENCY])
+
 
 """
     for key in [CONF_UART_IRQ_BEFORE_TX, CONF_STOP_MODE_UART, CONF_SET_STATUS_AT_BOOT]:
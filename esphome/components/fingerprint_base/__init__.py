@@ -0,0 +1,289 @@
+import calendar
+
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import sensor, time as time_
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_DAY,
+    CONF_FINGER_ID,
+    CONF_GROUP,
+    CONF_HOUR,
+    CONF_ID,
+    CONF_MINUTE,
+    CONF_MONTH,
+    CONF_NAME,
+    CONF_SECOND,
+    CONF_TIME_ID,
+    CONF_TRIGGER_ID,
+    CONF_YEAR,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
+)
+from esphome.helpers import fnv1a_32bit_hash
+
+CODEOWNERS = ["@Luigi-pi"]
+AUTO_LOAD = ["sensor"]
+
+CONF_IDENTIFY_LATENCY = "identify_latency"
+CONF_USERS = "users"
+CONF_MAX_USERS = "max_users"
+CONF_RECORDS = "records"
+CONF_VALID_FROM = "valid_from"
+CONF_VALID_UNTIL = "valid_until"
+CONF_ON_USER_MATCHED = "on_user_matched"
+
+# Sizes of the name and group fields of UserRecord, including the terminator
+USER_NAME_SIZE = 20
+USER_GROUP_SIZE = 10
+
+fingerprint_base_ns = cg.esphome_ns.namespace("fingerprint_base")
+LatencyStage = fingerprint_base_ns.enum("LatencyStage")
+LatencyStatistic = fingerprint_base_ns.enum("LatencyStatistic")
+
+# Base class of the reader components, the triggers below attach to any of them
+FingerprintReader = fingerprint_base_ns.class_("FingerprintReader")
+
+FingerScanStartTrigger = fingerprint_base_ns.class_(
+    "FingerScanStartTrigger", automation.Trigger.template()
+)
+
+FingerScanMatchedTrigger = fingerprint_base_ns.class_(
+    "FingerScanMatchedTrigger", automation.Trigger.template(cg.uint16, cg.uint16)
+)
+
+FingerScanUnmatchedTrigger = fingerprint_base_ns.class_(
+    "FingerScanUnmatchedTrigger", automation.Trigger.template()
+)
+
+EnrollmentDoneTrigger = fingerprint_base_ns.class_(
+    "EnrollmentDoneTrigger", automation.Trigger.template(cg.uint16)
+)
+
+EnrollmentFailedTrigger = fingerprint_base_ns.class_(
+    "EnrollmentFailedTrigger", automation.Trigger.template(cg.uint16)
+)
+
+UserTable = fingerprint_base_ns.class_("UserTable", cg.Component)
+UserMatchedTrigger = fingerprint_base_ns.class_(
+    "UserMatchedTrigger",
+    automation.Trigger.template(cg.uint16, cg.std_string, cg.std_string, cg.bool_),
+)
+SetUserAction = fingerprint_base_ns.class_("SetUserAction", automation.Action)
+RemoveUserAction = fingerprint_base_ns.class_("RemoveUserAction", automation.Action)
+ClearUsersAction = fingerprint_base_ns.class_("ClearUsersAction", automation.Action)
+
+LATENCY_STAGES = {
+    "capture": LatencyStage.LATENCY_STAGE_CAPTURE,
+    "match": LatencyStage.LATENCY_STAGE_MATCH,
+    "uart": LatencyStage.LATENCY_STAGE_UART,
+    "dispatch": LatencyStage.LATENCY_STAGE_DISPATCH,
+    "total": LatencyStage.LATENCY_STAGE_TOTAL,
+}
+LATENCY_STATISTICS = {
+    "p50": LatencyStatistic.LATENCY_STATISTIC_P50,
+    "p95": LatencyStatistic.LATENCY_STATISTIC_P95,
+    "max": LatencyStatistic.LATENCY_STATISTIC_MAX,
+}
+
+
+def latency_schema(stages):
+    """Schema of the per-stage latency sensors, restricted to the stages a driver records."""
+    statistics = cv.Schema(
+        {
+            cv.Optional(statistic): sensor.sensor_schema(
+                unit_of_measurement=UNIT_MILLISECOND,
+                icon=ICON_TIMER,
+                accuracy_decimals=1,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            )
+            for statistic in LATENCY_STATISTICS
+        }
+    )
+    return cv.Schema({cv.Optional(stage): statistics for stage in stages})
+
+
+async def setup_latency_sensors(var, config):
+    # The instrumentation is only compiled in when at least one latency sensor is configured
+    cg.add_define("USE_FINGERPRINT_LATENCY_STATS")
+    for stage, statistics in config.items():
+        for statistic, conf in statistics.items():
+            sens = await sensor.new_sensor(conf)
+            cg.add(
+                var.set_latency_sensor(
+                    LATENCY_STAGES[stage], LATENCY_STATISTICS[statistic], sens
+                )
+            )
+
+
+def _unix_time(value):
+    """UTC unix time of a date_time() value."""
+    return calendar.timegm(
+        (
+            value[CONF_YEAR],
+            value[CONF_MONTH],
+            value[CONF_DAY],
+            value[CONF_HOUR],
+            value[CONF_MINUTE],
+            value[CONF_SECOND],
+        )
+    )
+
+
+def _validate_window(config):
+    if (
+        CONF_VALID_FROM in config
+        and CONF_VALID_UNTIL in config
+        and _unix_time(config[CONF_VALID_FROM]) >= _unix_time(config[CONF_VALID_UNTIL])
+    ):
+        raise cv.Invalid(f"'{CONF_VALID_FROM}' must be before '{CONF_VALID_UNTIL}'")
+    return config
+
+
+USER_RECORD_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_FINGER_ID): cv.int_range(min=0, max=0xFFFE),
+            cv.Required(CONF_NAME): cv.All(
+                cv.string_strict, cv.Length(max=USER_NAME_SIZE - 1)
+            ),
+            cv.Optional(CONF_GROUP, default=""): cv.All(
+                cv.string_strict, cv.Length(max=USER_GROUP_SIZE - 1)
+            ),
+            cv.Optional(CONF_VALID_FROM): cv.date_time(date=True, time=True),
+            cv.Optional(CONF_VALID_UNTIL): cv.date_time(date=True, time=True),
+        }
+    ),
+    _validate_window,
+)
+
+
+def _validate_users(config):
+    records = config[CONF_RECORDS]
+    finger_ids = [record[CONF_FINGER_ID] for record in records]
+    if len(set(finger_ids)) != len(finger_ids):
+        raise cv.Invalid(f"Each {CONF_FINGER_ID} can only have one user")
+    windowed = any(
+        CONF_VALID_FROM in record or CONF_VALID_UNTIL in record for record in records
+    )
+    if windowed and CONF_TIME_ID not in config:
+        raise cv.Invalid(f"Validity windows require '{CONF_TIME_ID}'")
+    return config
+
+
+# Table of the users the templates of a reader belong to, see UserTable
+USERS_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(UserTable),
+            cv.Optional(CONF_MAX_USERS, default=32): cv.int_range(min=1, max=1024),
+            cv.Optional(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+            cv.Optional(CONF_RECORDS, default=[]): cv.ensure_list(USER_RECORD_SCHEMA),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    _validate_users,
+)
+
+USER_MATCHED_SCHEMA = automation.validate_automation(
+    {
+        cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UserMatchedTrigger),
+    }
+)
+
+
+async def setup_users(reader, config):
+    """Code of the users and on_user_matched options of a reader configuration."""
+    if users_config := config.get(CONF_USERS):
+        table = cg.new_Pvariable(users_config[CONF_ID])
+        await cg.register_component(table, users_config)
+        cg.add(table.set_max_users(users_config[CONF_MAX_USERS]))
+        cg.add(table.set_preference_key(fnv1a_32bit_hash(str(config[CONF_ID]))))
+        for record in users_config[CONF_RECORDS]:
+            valid_from = record.get(CONF_VALID_FROM)
+            valid_until = record.get(CONF_VALID_UNTIL)
+            cg.add(
+                table.add_static_user(
+                    record[CONF_FINGER_ID],
+                    record[CONF_NAME],
+                    record[CONF_GROUP],
+                    _unix_time(valid_from) if valid_from else 0,
+                    _unix_time(valid_until) if valid_until else 0,
+                )
+            )
+        if CONF_TIME_ID in users_config:
+            clock = await cg.get_variable(users_config[CONF_TIME_ID])
+            cg.add(table.set_time(clock))
+        cg.add(reader.set_user_table(table))
+
+    for conf in config.get(CONF_ON_USER_MATCHED, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], reader)
+        await automation.build_automation(
+            trigger,
+            [
+                (cg.uint16, "finger_id"),
+                (cg.std_string, "name"),
+                (cg.std_string, "group"),
+                (cg.bool_, "valid"),
+            ],
+            conf,
+        )
+
+
+def register_user_actions(domain, reader_class):
+    """Register the set_user, remove_user and clear_users actions of a reader."""
+    set_user_schema = cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(reader_class),
+            cv.Required(CONF_FINGER_ID): cv.templatable(cv.uint16_t),
+            cv.Required(CONF_NAME): cv.templatable(cv.string),
+            cv.Optional(CONF_GROUP, default=""): cv.templatable(cv.string),
+            cv.Optional(CONF_VALID_FROM, default=0): cv.templatable(cv.uint32_t),
+            cv.Optional(CONF_VALID_UNTIL, default=0): cv.templatable(cv.uint32_t),
+        }
+    )
+
+    @automation.register_action(f"{domain}.set_user", SetUserAction, set_user_schema)
+    async def set_user_to_code(config, action_id, template_arg, args):
+        var = cg.new_Pvariable(action_id, template_arg)
+        await cg.register_parented(var, config[CONF_ID])
+        for key, type_ in (
+            (CONF_FINGER_ID, cg.uint16),
+            (CONF_NAME, cg.std_string),
+            (CONF_GROUP, cg.std_string),
+            (CONF_VALID_FROM, cg.uint32),
+            (CONF_VALID_UNTIL, cg.uint32),
+        ):
+            template_ = await cg.templatable(config[key], args, type_)
+            cg.add(getattr(var, f"set_{key}")(template_))
+        return var
+
+    @automation.register_action(
+        f"{domain}.remove_user",
+        RemoveUserAction,
+        cv.maybe_simple_value(
+            {
+                cv.GenerateID(): cv.use_id(reader_class),
+                cv.Required(CONF_FINGER_ID): cv.templatable(cv.uint16_t),
+            },
+            key=CONF_FINGER_ID,
+        ),
+    )
+    async def remove_user_to_code(config, action_id, template_arg, args):
+        var = cg.new_Pvariable(action_id, template_arg)
+        await cg.register_parented(var, config[CONF_ID])
+        template_ = await cg.templatable(config[CONF_FINGER_ID], args, cg.uint16)
+        cg.add(var.set_finger_id(template_))
+        return var
+
+    @automation.register_action(
+        f"{domain}.clear_users",
+        ClearUsersAction,
+        automation.maybe_simple_id({cv.GenerateID(): cv.use_id(reader_class)}),
+    )
+    async def clear_users_to_code(config, action_id, template_arg, args):
+        var = cg.new_Pvariable(action_id, template_arg)
+        await cg.register_parented(var, config[CONF_ID])
+        return var
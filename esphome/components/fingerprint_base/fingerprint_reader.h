@@ -0,0 +1,145 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+#include "user_table.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace esphome {
+namespace fingerprint_base {
+
+/// Events every fingerprint reader reports. Drivers fire the callbacks, the shared triggers below subscribe to them,
+/// so several readers on one node share the same automation plumbing.
+class FingerprintReader {
+ public:
+  void add_on_finger_scan_start_callback(std::function<void()> callback) {
+    this->finger_scan_start_callback_.add(std::move(callback));
+  }
+  /// The second argument is driver specific: match confidence on Grow readers, template tag on FPC2532.
+  void add_on_finger_scan_matched_callback(std::function<void(uint16_t, uint16_t)> callback) {
+    this->finger_scan_matched_callback_.add(std::move(callback));
+  }
+  void add_on_finger_scan_unmatched_callback(std::function<void()> callback) {
+    this->finger_scan_unmatched_callback_.add(std::move(callback));
+  }
+  void add_on_enrollment_done_callback(std::function<void(uint16_t)> callback) {
+    this->enrollment_done_callback_.add(std::move(callback));
+  }
+  void add_on_enrollment_failed_callback(std::function<void(uint16_t)> callback) {
+    this->enrollment_failed_callback_.add(std::move(callback));
+  }
+  /// Users of the templates enrolled on this reader, nullptr when none are configured.
+  void set_user_table(UserTable *user_table) { this->user_table_ = user_table; }
+  UserTable *get_user_table() const { return this->user_table_; }
+
+ protected:
+  /// Call once the reader confirmed that templates were deleted, so a template enrolled later into the ID does not
+  /// inherit the user. Configured users stay removed across reboots.
+  void drop_user_(uint16_t finger_id) {
+    if (this->user_table_ != nullptr)
+      this->user_table_->remove_user(finger_id);
+  }
+  void drop_all_users_() {
+    if (this->user_table_ != nullptr)
+      this->user_table_->clear_users();
+  }
+
+  UserTable *user_table_{nullptr};
+  CallbackManager<void()> finger_scan_start_callback_;
+  CallbackManager<void(uint16_t, uint16_t)> finger_scan_matched_callback_;
+  CallbackManager<void()> finger_scan_unmatched_callback_;
+  CallbackManager<void(uint16_t)> enrollment_done_callback_;
+  CallbackManager<void(uint16_t)> enrollment_failed_callback_;
+};
+
+class FingerScanStartTrigger : public Trigger<> {
+ public:
+  explicit FingerScanStartTrigger(FingerprintReader *parent) {
+    parent->add_on_finger_scan_start_callback([this]() { this->trigger(); });
+  }
+};
+
+class FingerScanMatchedTrigger : public Trigger<uint16_t, uint16_t> {
+ public:
+  explicit FingerScanMatchedTrigger(FingerprintReader *parent) {
+    parent->add_on_finger_scan_matched_callback(
+        [this](uint16_t finger_id, uint16_t extra) { this->trigger(finger_id, extra); });
+  }
+};
+
+/// Fires on matches of templates that belong to a user, with the validity window already checked.
+class UserMatchedTrigger : public Trigger<uint16_t, std::string, std::string, bool> {
+ public:
+  explicit UserMatchedTrigger(FingerprintReader *parent) {
+    parent->add_on_finger_scan_matched_callback([this, parent](uint16_t finger_id, uint16_t extra) {
+      const UserTable *users = parent->get_user_table();
+      const UserRecord *record = users != nullptr ? users->find(finger_id) : nullptr;
+      if (record != nullptr)
+        this->trigger(finger_id, record->name, record->group, users->is_valid(*record));
+    });
+  }
+};
+
+class FingerScanUnmatchedTrigger : public Trigger<> {
+ public:
+  explicit FingerScanUnmatchedTrigger(FingerprintReader *parent) {
+    parent->add_on_finger_scan_unmatched_callback([this]() { this->trigger(); });
+  }
+};
+
+class EnrollmentDoneTrigger : public Trigger<uint16_t> {
+ public:
+  explicit EnrollmentDoneTrigger(FingerprintReader *parent) {
+    parent->add_on_enrollment_done_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
+  }
+};
+
+class EnrollmentFailedTrigger : public Trigger<uint16_t> {
+ public:
+  explicit EnrollmentFailedTrigger(FingerprintReader *parent) {
+    parent->add_on_enrollment_failed_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
+  }
+};
+
+template<typename... Ts> class SetUserAction : public Action<Ts...>, public Parented<FingerprintReader> {
+ public:
+  TEMPLATABLE_VALUE(uint16_t, finger_id)
+  TEMPLATABLE_VALUE(std::string, name)
+  TEMPLATABLE_VALUE(std::string, group)
+  TEMPLATABLE_VALUE(uint32_t, valid_from)
+  TEMPLATABLE_VALUE(uint32_t, valid_until)
+
+  void play(Ts... x) override {
+    UserTable *users = this->parent_->get_user_table();
+    if (users == nullptr)
+      return;
+    users->set_user(UserRecord::make(this->finger_id_.value(x...), this->name_.value(x...), this->group_.value(x...),
+                                     this->valid_from_.value(x...), this->valid_until_.value(x...)));
+  }
+};
+
+template<typename... Ts> class RemoveUserAction : public Action<Ts...>, public Parented<FingerprintReader> {
+ public:
+  TEMPLATABLE_VALUE(uint16_t, finger_id)
+
+  void play(Ts... x) override {
+    UserTable *users = this->parent_->get_user_table();
+    if (users != nullptr)
+      users->remove_user(this->finger_id_.value(x...));
+  }
+};
+
+template<typename... Ts> class ClearUsersAction : public Action<Ts...>, public Parented<FingerprintReader> {
+ public:
+  void play(Ts... x) override {
+    UserTable *users = this->parent_->get_user_table();
+    if (users != nullptr)
+      users->clear_users();
+  }
+};
+
+}  // namespace fingerprint_base
+}  // namespace esphome
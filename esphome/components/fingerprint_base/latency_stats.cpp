@@ -0,0 +1,90 @@
+#include "latency_stats.h"
+
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+namespace fingerprint_base {
+
+const char *latency_stage_to_string(LatencyStage stage) {
+  switch (stage) {
+    case LATENCY_STAGE_CAPTURE:
+      return "Capture";
+    case LATENCY_STAGE_MATCH:
+      return "Match";
+    case LATENCY_STAGE_UART:
+      return "UART";
+    case LATENCY_STAGE_DISPATCH:
+      return "Dispatch";
+    case LATENCY_STAGE_TOTAL:
+      return "Total";
+    default:
+      return "Unknown";
+  }
+}
+
+void LatencyWindow::add(uint32_t us) {
+  this->samples_[this->head_] = us;
+  this->head_ = (this->head_ + 1) % SIZE;
+  if (this->count_ < SIZE)
+    this->count_++;
+}
+
+uint32_t LatencyWindow::percentile(uint8_t percent) const {
+  if (this->count_ == 0)
+    return 0;
+  uint32_t sorted[SIZE];
+  std::copy(this->samples_, this->samples_ + this->count_, sorted);
+  const uint8_t rank = (this->count_ * percent + 99) / 100;
+  uint32_t *nth = sorted + (rank > 0 ? rank - 1 : 0);
+  std::nth_element(sorted, nth, sorted + this->count_);
+  return *nth;
+}
+
+uint32_t LatencyWindow::max() const {
+  if (this->count_ == 0)
+    return 0;
+  return *std::max_element(this->samples_, this->samples_ + this->count_);
+}
+
+void LatencyStats::record(LatencyStage stage, uint32_t us) {
+  this->windows_[stage].add(us);
+  this->dirty_ |= 1 << stage;
+}
+
+void LatencyStats::publish() {
+  for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+    if ((this->dirty_ & (1 << stage)) == 0)
+      continue;
+    const LatencyWindow &window = this->windows_[stage];
+    sensor::Sensor **sensors = this->sensors_[stage];
+    if (sensors[LATENCY_STATISTIC_P50] != nullptr)
+      sensors[LATENCY_STATISTIC_P50]->publish_state(window.percentile(50) / 1000.0f);
+    if (sensors[LATENCY_STATISTIC_P95] != nullptr)
+      sensors[LATENCY_STATISTIC_P95]->publish_state(window.percentile(95) / 1000.0f);
+    if (sensors[LATENCY_STATISTIC_MAX] != nullptr)
+      sensors[LATENCY_STATISTIC_MAX]->publish_state(window.max() / 1000.0f);
+  }
+  this->dirty_ = 0;
+}
+
+void LatencyStats::dump_config(const char *tag) const {
+  ESP_LOGCONFIG(tag, "  Latency (last %u scans):", LatencyWindow::SIZE);
+  for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+    const LatencyWindow &window = this->windows_[stage];
+    if (window.size() == 0)
+      continue;
+    ESP_LOGCONFIG(tag, "    %s: p50=%" PRIu32 " us, p95=%" PRIu32 " us, max=%" PRIu32 " us (%u samples)",
+                  latency_stage_to_string(static_cast<LatencyStage>(stage)), window.percentile(50),
+                  window.percentile(95), window.max(), window.size());
+  }
+}
+
+}  // namespace fingerprint_base
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_LATENCY_STATS
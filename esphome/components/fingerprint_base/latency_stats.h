@@ -0,0 +1,76 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+
+#include "esphome/components/sensor/sensor.h"
+
+#include <cstdint>
+
+namespace esphome {
+namespace fingerprint_base {
+
+/// Stages of a scan, from the finger touching the sensor to the automations having run.
+enum LatencyStage : uint8_t {
+  /// Finger detected until the image is ready (or the image has been converted on Grow sensors).
+  LATENCY_STAGE_CAPTURE = 0,
+  /// Image ready until the identify/search result is known.
+  LATENCY_STAGE_MATCH,
+  /// Reception of the identify response frame over UART.
+  LATENCY_STAGE_UART,
+  /// Time spent in the matched/unmatched triggers.
+  LATENCY_STAGE_DISPATCH,
+  /// Finger detected until the triggers have returned.
+  LATENCY_STAGE_TOTAL,
+  LATENCY_STAGE_COUNT,
+};
+
+enum LatencyStatistic : uint8_t {
+  LATENCY_STATISTIC_P50 = 0,
+  LATENCY_STATISTIC_P95,
+  LATENCY_STATISTIC_MAX,
+  LATENCY_STATISTIC_COUNT,
+};
+
+const char *latency_stage_to_string(LatencyStage stage);
+
+/// Rolling window over the last LatencyWindow::SIZE samples of one stage, in microseconds.
+class LatencyWindow {
+ public:
+  static const uint8_t SIZE = 32;
+
+  void add(uint32_t us);
+  uint8_t size() const { return this->count_; }
+  /// Nearest-rank percentile of the samples in the window, 0 when empty.
+  uint32_t percentile(uint8_t percent) const;
+  uint32_t max() const;
+
+ protected:
+  uint32_t samples_[SIZE]{};
+  uint8_t head_{0};
+  uint8_t count_{0};
+};
+
+/// Latency statistics of all stages, published as p50/p95/max sensors in milliseconds.
+class LatencyStats {
+ public:
+  void set_sensor(LatencyStage stage, LatencyStatistic statistic, sensor::Sensor *sens) {
+    this->sensors_[stage][statistic] = sens;
+  }
+
+  void record(LatencyStage stage, uint32_t us);
+  /// Publish the stages that got new samples since the last call.
+  void publish();
+  void dump_config(const char *tag) const;
+
+ protected:
+  LatencyWindow windows_[LATENCY_STAGE_COUNT];
+  sensor::Sensor *sensors_[LATENCY_STAGE_COUNT][LATENCY_STATISTIC_COUNT]{};
+  uint8_t dirty_{0};
+};
+
+}  // namespace fingerprint_base
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_LATENCY_STATS
@@ -0,0 +1,163 @@
+#include "user_table.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace fingerprint_base {
+
+static const char *const TAG = "fingerprint_base.users";
+
+static void copy_field(char *dest, size_t size, const std::string &value) {
+  memset(dest, 0, size);
+  memcpy(dest, value.data(), std::min(value.size(), size - 1));
+}
+
+UserRecord UserRecord::make(uint16_t finger_id, const std::string &name, const std::string &group,
+                            uint32_t valid_from, uint32_t valid_until) {
+  UserRecord record{};
+  record.finger_id = finger_id;
+  copy_field(record.name, sizeof(record.name), name);
+  copy_field(record.group, sizeof(record.group), group);
+  record.valid_from = valid_from;
+  record.valid_until = valid_until;
+  return record;
+}
+
+UserRecord UserRecord::make_removed(const UserRecord &configured) {
+  UserRecord record = configured;
+  record.valid_from = REMOVED;
+  record.valid_until = REMOVED;
+  return record;
+}
+
+void UserTable::setup() {
+  // Room for a removal record of every configured user next to the added ones
+  const uint16_t max_records = this->max_users_ + this->static_users_.size();
+  if (!this->table_.init(max_records, fnv1_hash("fingerprint_users") ^ this->preference_key_)) {
+    ESP_LOGE(TAG, "Could not allocate the user table");
+    this->mark_failed();
+    return;
+  }
+  std::sort(this->static_users_.begin(), this->static_users_.end(),
+            [](const UserRecord &a, const UserRecord &b) { return a.finger_id < b.finger_id; });
+
+  // Removal records of users that left the configuration or were changed there have no effect anymore
+  std::vector<uint16_t> stale;
+  this->table_.for_each([this, &stale](const UserRecord &record) {
+    if (!record.is_removed())
+      return;
+    const UserRecord *configured = this->find_static_(record.finger_id);
+    if (configured == nullptr || strcmp(configured->name, record.name) != 0 ||
+        strcmp(configured->group, record.group) != 0) {
+      stale.push_back(record.finger_id);
+    } else {
+      this->removed_count_++;
+    }
+  });
+  for (uint16_t finger_id : stale)
+    this->table_.erase(finger_id);
+  this->table_.save();
+}
+
+void UserTable::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Fingerprint Users:\n"
+                "  Configured users: %u\n"
+                "  Added users: %u of %u",
+                (unsigned) this->static_users_.size(), this->get_added_count_(), this->max_users_);
+#ifdef USE_TIME
+  ESP_LOGCONFIG(TAG, "  Validity windows: %s", YESNO(this->time_ != nullptr));
+#endif
+}
+
+const UserRecord *UserTable::find(uint16_t finger_id) const {
+  if (finger_id == UserRecord::NO_FINGER)
+    return nullptr;
+  const UserRecord *record = this->table_.find(finger_id);
+  if (record != nullptr)
+    return record->is_removed() ? nullptr : record;
+  return this->find_static_(finger_id);
+}
+
+uint16_t UserTable::get_user_count() const {
+  uint16_t count = this->get_added_count_();
+  for (const UserRecord &record : this->static_users_) {
+    if (this->table_.find(record.finger_id) == nullptr)
+      count++;
+  }
+  return count;
+}
+
+bool UserTable::is_valid(const UserRecord &record) const {
+  if (!record.has_window())
+    return true;
+#ifdef USE_TIME
+  if (this->time_ != nullptr) {
+    const ESPTime now = this->time_->now();
+    if (!now.is_valid())
+      return false;
+    const uint32_t timestamp = now.timestamp;
+    return (record.valid_from == 0 || timestamp >= record.valid_from) &&
+           (record.valid_until == 0 || timestamp < record.valid_until);
+  }
+#endif
+  return false;
+}
+
+bool UserTable::set_user(const UserRecord &record) {
+  if (this->is_failed() || record.finger_id == UserRecord::NO_FINGER)
+    return false;
+  const UserRecord *existing = this->table_.find(record.finger_id);
+  const bool adds = existing == nullptr || existing->is_removed();
+  if (adds && this->get_added_count_() >= this->max_users_) {
+    ESP_LOGW(TAG, "User table full, user '%s' not added", record.name);
+    return false;
+  }
+  if (existing != nullptr && existing->is_removed())
+    this->removed_count_--;
+  this->table_.insert(record);
+  ESP_LOGD(TAG, "Template %u belongs to '%s' (%s)", record.finger_id, record.name, record.group);
+  this->table_.save();
+  return true;
+}
+
+bool UserTable::remove_user(uint16_t finger_id) {
+  if (finger_id == UserRecord::NO_FINGER)
+    return false;
+  const UserRecord *existing = this->table_.find(finger_id);
+  if (existing != nullptr && existing->is_removed())
+    return false;
+  const UserRecord *configured = this->find_static_(finger_id);
+  if (configured != nullptr) {
+    // Replaces a user set at runtime, if any
+    this->table_.insert(UserRecord::make_removed(*configured));
+    this->removed_count_++;
+    ESP_LOGD(TAG, "Removed configured user '%s' of template %u", configured->name, finger_id);
+  } else if (!this->table_.erase(finger_id)) {
+    return false;
+  }
+  this->table_.save();
+  return true;
+}
+
+void UserTable::clear_users() {
+  this->table_.clear();
+  for (const UserRecord &configured : this->static_users_)
+    this->table_.insert(UserRecord::make_removed(configured));
+  this->removed_count_ = this->static_users_.size();
+  this->table_.save();
+  ESP_LOGD(TAG, "Cleared all users");
+}
+
+const UserRecord *UserTable::find_static_(uint16_t finger_id) const {
+  auto it = std::lower_bound(this->static_users_.begin(), this->static_users_.end(), finger_id,
+                             [](const UserRecord &record, uint16_t id) { return record.finger_id < id; });
+  return it != this->static_users_.end() && it->finger_id == finger_id ? &*it : nullptr;
+}
+
+}  // namespace fingerprint_base
+}  // namespace esphome
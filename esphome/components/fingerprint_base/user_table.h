@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/persistent_table.h"
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+
+namespace esphome {
+namespace fingerprint_base {
+
+/// User a template ID on the reader belongs to.
+struct UserRecord {
+  static constexpr size_t NAME_SIZE = 20;
+  static constexpr size_t GROUP_SIZE = 10;
+  /// Marks an empty table slot; Grow readers number their templates from 0.
+  static constexpr uint16_t NO_FINGER = 0xFFFF;
+  /// Validity window bounds of a removal record, a window that never opens.
+  static constexpr uint32_t REMOVED = 0xFFFFFFFF;
+
+  uint16_t finger_id;
+  /// NUL terminated, longer names are truncated.
+  char name[NAME_SIZE];
+  char group[GROUP_SIZE];
+  /// UTC unix times bounding the validity window, 0 leaves that side open.
+  uint32_t valid_from;
+  uint32_t valid_until;
+
+  static UserRecord make(uint16_t finger_id, const std::string &name, const std::string &group, uint32_t valid_from,
+                         uint32_t valid_until);
+  /// Persisted in place of a removed configured user, so it stays removed across reboots. Keeps its name and group,
+  /// changing them in the configuration brings the user back.
+  static UserRecord make_removed(const UserRecord &configured);
+  bool has_window() const { return this->valid_from != 0 || this->valid_until != 0; }
+  bool is_removed() const { return this->valid_from == REMOVED && this->valid_until == REMOVED; }
+};
+
+/// User records are keyed by template ID, IDs are small and dense, so most lookups hit their home slot.
+struct UserRecordTraits {
+  using Key = uint16_t;
+  static uint16_t key(const UserRecord &record) { return record.finger_id; }
+  static bool is_empty(const UserRecord &record) { return record.finger_id == UserRecord::NO_FINGER; }
+  static void set_empty(UserRecord &record) { record.finger_id = UserRecord::NO_FINGER; }
+  /// Stored strings are trusted only up to their last byte.
+  static void sanitize(UserRecord &record) {
+    record.name[UserRecord::NAME_SIZE - 1] = '\0';
+    record.group[UserRecord::GROUP_SIZE - 1] = '\0';
+  }
+};
+
+/** Maps the template IDs of one reader to users, so matches are resolved on the device.
+ *
+ * Records live in an open addressed table keyed by template ID, allocated in PSRAM when available and persisted in
+ * chunks of USER_CHUNK_SIZE records.
+ */
+class UserTable : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  /// Largest number of users added at runtime, set before setup().
+  void set_max_users(uint16_t max_users) { this->max_users_ = max_users; }
+  /// Keeps the tables of several readers apart in the preferences.
+  void set_preference_key(uint32_t preference_key) { this->preference_key_ = preference_key; }
+  /// Users from the configuration. They are kept apart from the persisted table, so editing the configuration
+  /// changes them; a user set at runtime for the same template takes precedence.
+  void add_static_user(uint16_t finger_id, const std::string &name, const std::string &group, uint32_t valid_from,
+                       uint32_t valid_until) {
+    this->static_users_.push_back(UserRecord::make(finger_id, name, group, valid_from, valid_until));
+  }
+#ifdef USE_TIME
+  /// Clock the validity windows are checked against.
+  void set_time(time::RealTimeClock *time) { this->time_ = time; }
+#endif
+
+  /// @return nullptr if finger_id has no user.
+  const UserRecord *find(uint16_t finger_id) const;
+  /// Whether the record is inside its validity window. Records with a window are not valid until the time is synced.
+  bool is_valid(const UserRecord &record) const;
+  /// Adds the user of record.finger_id or replaces it. @return false if the table is full.
+  bool set_user(const UserRecord &record);
+  /// Configured users stay removed until they are set again or changed in the configuration.
+  /// @return false if finger_id had no user.
+  bool remove_user(uint16_t finger_id);
+  void clear_users();
+  uint16_t get_user_count() const;
+
+ protected:
+  static constexpr size_t USER_CHUNK_SIZE = 4;
+
+  /// @return nullptr if finger_id has no configured user.
+  const UserRecord *find_static_(uint16_t finger_id) const;
+
+  /// Users set at runtime, the table also holds the removed configured users.
+  uint16_t get_added_count_() const { return this->table_.size() - this->removed_count_; }
+
+  uint16_t max_users_{32};
+  uint16_t removed_count_{0};
+  uint32_t preference_key_{0};
+  PersistentTable<UserRecord, UserRecordTraits, USER_CHUNK_SIZE> table_;
+  // Sorted by finger_id, searched with a binary search
+  std::vector<UserRecord> static_users_;
+#ifdef USE_TIME
+  time::RealTimeClock *time_{nullptr};
+#endif
+};
+
+}  // namespace fingerprint_base
+}  // namespace esphome
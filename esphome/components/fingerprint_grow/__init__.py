@@ -1,6 +1,20 @@
 from esphome import automation, pins
 import esphome.codegen as cg
 from esphome.components import uart
+from esphome.components.fingerprint_base import (
+    CONF_ON_USER_MATCHED,
+    CONF_USERS,
+    USER_MATCHED_SCHEMA,
+    USERS_SCHEMA,
+    EnrollmentDoneTrigger,
+    EnrollmentFailedTrigger,
+    FingerprintReader,
+    FingerScanMatchedTrigger,
+    FingerScanStartTrigger,
+    FingerScanUnmatchedTrigger,
+    register_user_actions,
+    setup_users,
+)
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_COLOR,
@@ -26,7 +40,7 @@ from esphome.const import (
 
 CODEOWNERS = ["@Luigi-pi"]
 DEPENDENCIES = ["uart"]
-AUTO_LOAD = ["binary_sensor", "sensor"]
+AUTO_LOAD = ["binary_sensor", "fingerprint_base", "sensor"]
 MULTI_CONF = True
 
 CONF_FINGERPRINT_GROW_ID = "fingerprint_grow_id"
@@ -35,19 +49,10 @@ CONF_IDLE_PERIOD_TO_SLEEP = "idle_period_to_sleep"
 
 fingerprint_grow_ns = cg.esphome_ns.namespace("fingerprint_grow")
 FingerprintGrowComponent = fingerprint_grow_ns.class_(
-    "FingerprintGrowComponent", cg.PollingComponent, uart.UARTDevice
-)
-
-FingerScanStartTrigger = fingerprint_grow_ns.class_(
-    "FingerScanStartTrigger", automation.Trigger.template()
-)
-
-FingerScanMatchedTrigger = fingerprint_grow_ns.class_(
-    "FingerScanMatchedTrigger", automation.Trigger.template(cg.uint16, cg.uint16)
-)
-
-FingerScanUnmatchedTrigger = fingerprint_grow_ns.class_(
-    "FingerScanUnmatchedTrigger", automation.Trigger.template()
+    "FingerprintGrowComponent",
+    cg.PollingComponent,
+    uart.UARTDevice,
+    FingerprintReader,
 )
 
 FingerScanMisplacedTrigger = fingerprint_grow_ns.class_(
@@ -62,14 +67,6 @@ EnrollmentScanTrigger = fingerprint_grow_ns.class_(
     "EnrollmentScanTrigger", automation.Trigger.template(cg.uint8, cg.uint16)
 )
 
-EnrollmentDoneTrigger = fingerprint_grow_ns.class_(
-    "EnrollmentDoneTrigger", automation.Trigger.template(cg.uint16)
-)
-
-EnrollmentFailedTrigger = fingerprint_grow_ns.class_(
-    "EnrollmentFailedTrigger", automation.Trigger.template(cg.uint16)
-)
-
 EnrollmentAction = fingerprint_grow_ns.class_("EnrollmentAction", automation.Action)
 CancelEnrollmentAction = fingerprint_grow_ns.class_(
     "CancelEnrollmentAction", automation.Action
@@ -139,6 +136,8 @@ CONFIG_SCHEMA = cv.All(
                     ),
                 }
             ),
+            cv.Optional(CONF_USERS): USERS_SCHEMA,
+            cv.Optional(CONF_ON_USER_MATCHED): USER_MATCHED_SCHEMA,
             cv.Optional(CONF_ON_FINGER_SCAN_UNMATCHED): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -223,6 +222,8 @@ async def to_code(config):
             trigger, [(cg.uint16, "finger_id"), (cg.uint16, "confidence")], conf
         )
 
+    await setup_users(var, config)
+
     for conf in config.get(CONF_ON_FINGER_SCAN_UNMATCHED, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [], conf)
@@ -250,6 +251,9 @@ async def to_code(config):
         await automation.build_automation(trigger, [(cg.uint16, "finger_id")], conf)
 
 
+register_user_actions("fingerprint_grow", FingerprintGrowComponent)
+
+
 @automation.register_action(
     "fingerprint_grow.enroll",
     EnrollmentAction,
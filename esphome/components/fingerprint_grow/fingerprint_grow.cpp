@@ -10,8 +10,12 @@ static const char *const TAG = "fingerprint_grow";
 // Based on Adafruit's library: https://github.com/adafruit/Adafruit-Fingerprint-Sensor-Library
 
 void FingerprintGrowComponent::update() {
+  // Commands of the previous scan are still being exchanged with the reader
+  if (!this->is_ready_ || this->is_busy_())
+    return;
+
   if (this->enrollment_image_ > this->enrollment_buffers_) {
-    this->finish_enrollment(this->save_fingerprint_());
+    this->save_fingerprint_();
     return;
   }
 
@@ -31,9 +35,13 @@ void FingerprintGrowComponent::update() {
   }
 
   if (this->waiting_removal_) {
-    if ((!this->has_sensing_pin_) && (this->scan_image_(1) == NO_FINGER)) {
-      ESP_LOGD(TAG, "Finger removed");
-      this->waiting_removal_ = false;
+    if (!this->has_sensing_pin_) {
+      this->scan_image_(1, [this](uint8_t result) {
+        if (result == NO_FINGER) {
+          ESP_LOGD(TAG, "Finger removed");
+          this->waiting_removal_ = false;
+        }
+      });
     }
     return;
   }
@@ -43,17 +51,19 @@ void FingerprintGrowComponent::update() {
     return;
   }
 
-  uint8_t result = this->scan_image_(this->enrollment_image_);
-  if (result == NO_FINGER) {
-    return;
-  }
-  this->waiting_removal_ = true;
-  if (result != OK) {
-    this->finish_enrollment(result);
-    return;
-  }
-  this->enrollment_scan_callback_.call(this->enrollment_image_, this->enrollment_slot_);
-  ++this->enrollment_image_;
+  const uint8_t buffer = this->enrollment_image_;
+  this->scan_image_(buffer, [this, buffer](uint8_t result) {
+    // The enrollment was cancelled or restarted while the image was taken
+    if (this->enrollment_image_ != buffer || result == NO_FINGER)
+      return;
+    this->waiting_removal_ = true;
+    if (result != OK) {
+      this->finish_enrollment(result);
+      return;
+    }
+    this->enrollment_scan_callback_.call(this->enrollment_image_, this->enrollment_slot_);
+    ++this->enrollment_image_;
+  });
 }
 
 void FingerprintGrowComponent::setup() {
@@ -77,18 +87,36 @@ void FingerprintGrowComponent::setup() {
 
   // Place the sensor in a known (sleep/off) state and sync internal var state.
   this->sensor_sleep_();
-  delay(20);  // This delay guarantees the sensor will in fact be powered power.
+  // This delay guarantees the sensor will in fact be powered down before it is woken up again.
+  this->set_timeout("power_up", POWER_CYCLE_DELAY_MS, [this]() { this->check_password_(); });
+}
 
-  if (this->check_password_()) {
-    if (this->new_password_ != std::numeric_limits<uint32_t>::max()) {
-      if (this->set_password_())
+void FingerprintGrowComponent::loop() {
+  switch (this->link_state_) {
+    case GROW_LINK_IDLE:
+      if (this->cmd_queue_count_ == 0) {
+        this->disable_loop();
         return;
-    } else {
-      if (this->get_parameters_())
+      }
+      if (this->has_power_pin_ && !this->is_sensor_awake_) {
+        this->sensor_wakeup_();
         return;
-    }
+      }
+      this->transmit_(this->cmd_queue_[this->cmd_queue_head_]);
+      break;
+    case GROW_LINK_WAKING:
+      this->handle_wakeup_();
+      break;
+    case GROW_LINK_WAIT_RESPONSE:
+      if (this->receive_response_()) {
+        this->complete_command_(this->data_[0]);
+      } else if (millis() - this->link_start_ms_ > RESPONSE_TIMEOUT_MS) {
+        ESP_LOGE(TAG, "No response received from reader");
+        this->data_ = {TIMEOUT};
+        this->complete_command_(TIMEOUT);
+      }
+      break;
   }
-  this->mark_failed();
 }
 
 void FingerprintGrowComponent::enroll_fingerprint(uint16_t finger_id, uint8_t num_buffers) {
@@ -124,140 +152,185 @@ void FingerprintGrowComponent::scan_and_match_() {
   } else {
     ESP_LOGV(TAG, "Scan and match");
   }
-  if (this->scan_image_(1) == OK) {
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  this->scan_start_us_ = micros();
+#endif
+  this->scan_image_(1, [this](uint8_t result) {
+    if (result != OK)
+      return;
     this->waiting_removal_ = true;
-    this->data_ = {SEARCH, 0x01, 0x00, 0x00, (uint8_t) (this->capacity_ >> 8), (uint8_t) (this->capacity_ & 0xFF)};
-    switch (this->send_command_()) {
-      case OK: {
-        ESP_LOGD(TAG, "Fingerprint matched");
-        uint16_t finger_id = ((uint16_t) this->data_[1] << 8) | this->data_[2];
-        uint16_t confidence = ((uint16_t) this->data_[3] << 8) | this->data_[4];
-        if (this->last_finger_id_sensor_ != nullptr) {
-          this->last_finger_id_sensor_->publish_state(finger_id);
-        }
-        if (this->last_confidence_sensor_ != nullptr) {
-          this->last_confidence_sensor_->publish_state(confidence);
-        }
-        this->finger_scan_matched_callback_.call(finger_id, confidence);
-        break;
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+    this->scan_image_us_ = micros();
+#endif
+    this->send_command_(
+        {SEARCH, 0x01, 0x00, 0x00, (uint8_t) (this->capacity_ >> 8), (uint8_t) (this->capacity_ & 0xFF)},
+        [this](uint8_t result) { this->handle_search_result_(result); });
+  });
+}
+
+void FingerprintGrowComponent::handle_search_result_(uint8_t result) {
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  const uint32_t match_us = micros();
+#endif
+  switch (result) {
+    case OK: {
+      ESP_LOGD(TAG, "Fingerprint matched");
+      uint16_t finger_id = ((uint16_t) this->data_[1] << 8) | this->data_[2];
+      uint16_t confidence = ((uint16_t) this->data_[3] << 8) | this->data_[4];
+      if (this->last_finger_id_sensor_ != nullptr) {
+        this->last_finger_id_sensor_->publish_state(finger_id);
       }
-      case NOT_FOUND:
-        ESP_LOGD(TAG, "Fingerprint not matched to any saved slots");
-        this->finger_scan_unmatched_callback_.call();
-        break;
+      if (this->last_confidence_sensor_ != nullptr) {
+        this->last_confidence_sensor_->publish_state(confidence);
+      }
+      this->finger_scan_matched_callback_.call(finger_id, confidence);
+      break;
     }
+    case NOT_FOUND:
+      ESP_LOGD(TAG, "Fingerprint not matched to any saved slots");
+      this->finger_scan_unmatched_callback_.call();
+      break;
   }
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  const uint32_t dispatched_us = micros();
+  this->latency_stats_.record(fingerprint_base::LATENCY_STAGE_CAPTURE, this->scan_image_us_ - this->scan_start_us_);
+  this->latency_stats_.record(fingerprint_base::LATENCY_STAGE_MATCH, match_us - this->scan_image_us_);
+  this->latency_stats_.record(fingerprint_base::LATENCY_STAGE_DISPATCH, dispatched_us - match_us);
+  this->latency_stats_.record(fingerprint_base::LATENCY_STAGE_TOTAL, dispatched_us - this->scan_start_us_);
+  this->latency_stats_.publish();
+#endif
 }
 
-uint8_t FingerprintGrowComponent::scan_image_(uint8_t buffer) {
+void FingerprintGrowComponent::scan_image_(uint8_t buffer, std::function<void(uint8_t)> &&on_done) {
   if (this->has_sensing_pin_) {
     ESP_LOGD(TAG, "Getting image %d", buffer);
   } else {
     ESP_LOGV(TAG, "Getting image %d", buffer);
   }
-  this->data_ = {GET_IMAGE};
-  uint8_t send_result = this->send_command_();
-  switch (send_result) {
-    case OK:
-      break;
-    case NO_FINGER:
-      if (this->has_sensing_pin_) {
-        this->waiting_removal_ = true;
-        ESP_LOGD(TAG, "Finger Misplaced");
-        this->finger_scan_misplaced_callback_.call();
-      } else {
-        ESP_LOGV(TAG, "No finger");
-      }
-      return send_result;
-    case IMAGE_FAIL:
-      ESP_LOGE(TAG, "Imaging error");
-      this->finger_scan_invalid_callback_.call();
-      return send_result;
-    default:
-      ESP_LOGD(TAG, "Unknown Scan Error: %d", send_result);
-      return send_result;
-  }
+  this->send_command_({GET_IMAGE}, [this, buffer, on_done](uint8_t send_result) {
+    switch (send_result) {
+      case OK:
+        break;
+      case NO_FINGER:
+        if (this->has_sensing_pin_) {
+          this->waiting_removal_ = true;
+          ESP_LOGD(TAG, "Finger Misplaced");
+          this->finger_scan_misplaced_callback_.call();
+        } else {
+          ESP_LOGV(TAG, "No finger");
+        }
+        on_done(send_result);
+        return;
+      case IMAGE_FAIL:
+        ESP_LOGE(TAG, "Imaging error");
+        this->finger_scan_invalid_callback_.call();
+        on_done(send_result);
+        return;
+      default:
+        ESP_LOGD(TAG, "Unknown Scan Error: %d", send_result);
+        on_done(send_result);
+        return;
+    }
 
-  ESP_LOGD(TAG, "Processing image %d", buffer);
-  this->data_ = {IMAGE_2_TZ, buffer};
-  send_result = this->send_command_();
-  switch (send_result) {
-    case OK:
-      ESP_LOGI(TAG, "Processed image %d", buffer);
-      break;
-    case IMAGE_MESS:
-      ESP_LOGE(TAG, "Image too messy");
-      this->finger_scan_invalid_callback_.call();
-      break;
-    case FEATURE_FAIL:
-    case INVALID_IMAGE:
-      ESP_LOGE(TAG, "Could not find fingerprint features");
-      this->finger_scan_invalid_callback_.call();
-      break;
-  }
-  return send_result;
+    ESP_LOGD(TAG, "Processing image %d", buffer);
+    this->send_command_({IMAGE_2_TZ, buffer}, [this, buffer, on_done](uint8_t send_result) {
+      switch (send_result) {
+        case OK:
+          ESP_LOGI(TAG, "Processed image %d", buffer);
+          break;
+        case IMAGE_MESS:
+          ESP_LOGE(TAG, "Image too messy");
+          this->finger_scan_invalid_callback_.call();
+          break;
+        case FEATURE_FAIL:
+        case INVALID_IMAGE:
+          ESP_LOGE(TAG, "Could not find fingerprint features");
+          this->finger_scan_invalid_callback_.call();
+          break;
+      }
+      on_done(send_result);
+    });
+  });
 }
 
-uint8_t FingerprintGrowComponent::save_fingerprint_() {
+void FingerprintGrowComponent::save_fingerprint_() {
   ESP_LOGI(TAG, "Creating model");
-  this->data_ = {REG_MODEL};
-  switch (this->send_command_()) {
-    case OK:
-      break;
-    case ENROLL_MISMATCH:
-      ESP_LOGE(TAG, "Scans do not match");
-    default:
-      return this->data_[0];
-  }
+  this->send_command_({REG_MODEL}, [this](uint8_t result) {
+    switch (result) {
+      case OK:
+        break;
+      case ENROLL_MISMATCH:
+        ESP_LOGE(TAG, "Scans do not match");
+      default:
+        this->finish_enrollment(result);
+        return;
+    }
 
-  ESP_LOGI(TAG, "Storing model");
-  this->data_ = {STORE, 0x01, (uint8_t) (this->enrollment_slot_ >> 8), (uint8_t) (this->enrollment_slot_ & 0xFF)};
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGI(TAG, "Stored model");
-      break;
-    case BAD_LOCATION:
-      ESP_LOGE(TAG, "Invalid slot");
-      break;
-    case FLASH_ERR:
-      ESP_LOGE(TAG, "Error writing to flash");
-      break;
-  }
-  return this->data_[0];
+    ESP_LOGI(TAG, "Storing model");
+    this->send_command_(
+        {STORE, 0x01, (uint8_t) (this->enrollment_slot_ >> 8), (uint8_t) (this->enrollment_slot_ & 0xFF)},
+        [this](uint8_t result) {
+          switch (result) {
+            case OK:
+              ESP_LOGI(TAG, "Stored model");
+              break;
+            case BAD_LOCATION:
+              ESP_LOGE(TAG, "Invalid slot");
+              break;
+            case FLASH_ERR:
+              ESP_LOGE(TAG, "Error writing to flash");
+              break;
+          }
+          this->finish_enrollment(result);
+        });
+  });
 }
 
-/* bool FingerprintGrowComponent::check_password_() {
+void FingerprintGrowComponent::check_password_() {
   ESP_LOGD(TAG, "Checking password");
-  this->data_ = {VERIFY_PASSWORD, (uint8_t) (this->password_ >> 24), (uint8_t) (this->password_ >> 16),
-                 (uint8_t) (this->password_ >> 8), (uint8_t) (this->password_ & 0xFF)};
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGD(TAG, "Password verified");
-      return true;
-    case PASSWORD_FAIL:
-      ESP_LOGE(TAG, "Wrong password");
-      break;
-  }
-  return false;
+  this->send_command_({VERIFY_PASSWORD, (uint8_t) (this->password_ >> 24), (uint8_t) (this->password_ >> 16),
+                       (uint8_t) (this->password_ >> 8), (uint8_t) (this->password_ & 0xFF)},
+                      [this](uint8_t result) {
+                        switch (result) {
+                          case OK:
+                            ESP_LOGD(TAG, "Password verified");
+                            if (this->new_password_ != std::numeric_limits<uint32_t>::max()) {
+                              this->set_password_();
+                            } else {
+                              this->get_parameters_();
+                            }
+                            return;
+                          case PASSWORD_FAIL:
+                            ESP_LOGE(TAG, "Wrong password");
+                            break;
+                        }
+                        this->mark_failed();
+                      });
 }
 
-bool FingerprintGrowComponent::set_password_() {
+void FingerprintGrowComponent::set_password_() {
   ESP_LOGI(TAG, "Setting new password: %" PRIu32, this->new_password_);
-  this->data_ = {SET_PASSWORD, (uint8_t) (this->new_password_ >> 24), (uint8_t) (this->new_password_ >> 16),
-                 (uint8_t) (this->new_password_ >> 8), (uint8_t) (this->new_password_ & 0xFF)};
-  if (this->send_command_() == OK) {
-    ESP_LOGI(TAG, "New password successfully set");
-    ESP_LOGI(TAG, "Define the new password in your configuration and reflash now");
-    ESP_LOGW(TAG, "!!!Forgetting the password will render your device unusable!!!");
-    return true;
-  }
-  return false;
-} */
+  this->send_command_({SET_PASSWORD, (uint8_t) (this->new_password_ >> 24), (uint8_t) (this->new_password_ >> 16),
+                       (uint8_t) (this->new_password_ >> 8), (uint8_t) (this->new_password_ & 0xFF)},
+                      [this](uint8_t result) {
+                        if (result != OK) {
+                          this->mark_failed();
+                          return;
+                        }
+                        ESP_LOGI(TAG, "New password successfully set");
+                        ESP_LOGI(TAG, "Define the new password in your configuration and reflash now");
+                        ESP_LOGW(TAG, "!!!Forgetting the password will render your device unusable!!!");
+                        this->is_ready_ = true;
+                      });
+}
 
-bool FingerprintGrowComponent::get_parameters_() {
+void FingerprintGrowComponent::get_parameters_() {
   ESP_LOGD(TAG, "Getting parameters");
-  this->data_ = {READ_SYS_PARAM};
-  if (this->send_command_() == OK) {
+  this->send_command_({READ_SYS_PARAM}, [this](uint8_t result) {
+    if (result != OK) {
+      this->mark_failed();
+      return;
+    }
     ESP_LOGD(TAG, "Got parameters");        // Bear in mind data_[0] is the transfer status,
     if (this->status_sensor_ != nullptr) {  // the parameters table start at data_[1]
       this->status_sensor_->publish_state(((uint16_t) this->data_[1] << 8) | this->data_[2]);
@@ -273,94 +346,143 @@ bool FingerprintGrowComponent::get_parameters_() {
     if (this->enrolling_binary_sensor_ != nullptr) {
       this->enrolling_binary_sensor_->publish_state(false);
     }
+    this->is_ready_ = true;
     this->get_fingerprint_count_();
-    return true;
-  }
-  return false;
+  });
 }
 
 void FingerprintGrowComponent::get_fingerprint_count_() {
   ESP_LOGD(TAG, "Getting fingerprint count");
-  this->data_ = {TEMPLATE_COUNT};
-  if (this->send_command_() == OK) {
+  this->send_command_({TEMPLATE_COUNT}, [this](uint8_t result) {
+    if (result != OK)
+      return;
     ESP_LOGD(TAG, "Got fingerprint count");
     if (this->fingerprint_count_sensor_ != nullptr)
       this->fingerprint_count_sensor_->publish_state(((uint16_t) this->data_[1] << 8) | this->data_[2]);
-  }
+  });
 }
 
 void FingerprintGrowComponent::delete_fingerprint(uint16_t finger_id) {
   ESP_LOGI(TAG, "Deleting fingerprint in slot %d", finger_id);
-  this->data_ = {DELETE, (uint8_t) (finger_id >> 8), (uint8_t) (finger_id & 0xFF), 0x00, 0x01};
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGI(TAG, "Deleted fingerprint");
-      this->get_fingerprint_count_();
-      break;
-    case DELETE_FAIL:
-      ESP_LOGE(TAG, "Reader failed to delete fingerprint");
-      break;
-  }
+  this->send_command_({DELETE, (uint8_t) (finger_id >> 8), (uint8_t) (finger_id & 0xFF), 0x00, 0x01},
+                      [this, finger_id](uint8_t result) {
+                        switch (result) {
+                          case OK:
+                            ESP_LOGI(TAG, "Deleted fingerprint");
+                            this->drop_user_(finger_id);
+                            this->get_fingerprint_count_();
+                            break;
+                          case DELETE_FAIL:
+                            ESP_LOGE(TAG, "Reader failed to delete fingerprint");
+                            break;
+                        }
+                      });
 }
 
 void FingerprintGrowComponent::delete_all_fingerprints() {
   ESP_LOGI(TAG, "Deleting all stored fingerprints");
-  this->data_ = {DELETE_ALL};
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGI(TAG, "Deleted all fingerprints");
-      this->get_fingerprint_count_();
-      break;
-    case DB_CLEAR_FAIL:
-      ESP_LOGE(TAG, "Reader failed to clear fingerprint library");
-      break;
-  }
+  this->send_command_({DELETE_ALL}, [this](uint8_t result) {
+    switch (result) {
+      case OK:
+        ESP_LOGI(TAG, "Deleted all fingerprints");
+        this->drop_all_users_();
+        this->get_fingerprint_count_();
+        break;
+      case DB_CLEAR_FAIL:
+        ESP_LOGE(TAG, "Reader failed to clear fingerprint library");
+        break;
+    }
+  });
 }
 
 void FingerprintGrowComponent::led_control(bool state) {
   ESP_LOGD(TAG, "Setting LED");
-  if (state) {
-    this->data_ = {LED_ON};
-  } else {
-    this->data_ = {LED_OFF};
-  }
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGD(TAG, "LED set");
-      break;
-    case PACKET_RCV_ERR:
-    case TIMEOUT:
-      break;
-    default:
-      ESP_LOGE(TAG, "Try aura_led_control instead");
-      break;
-  }
+  this->send_command_({state ? (uint8_t) LED_ON : (uint8_t) LED_OFF}, [](uint8_t result) {
+    switch (result) {
+      case OK:
+        ESP_LOGD(TAG, "LED set");
+        break;
+      case PACKET_RCV_ERR:
+      case TIMEOUT:
+        break;
+      default:
+        ESP_LOGE(TAG, "Try aura_led_control instead");
+        break;
+    }
+  });
 }
 
 void FingerprintGrowComponent::aura_led_control(uint8_t state, uint8_t speed, uint8_t color, uint8_t count) {
-  const uint32_t now = millis();
-  const uint32_t elapsed = now - this->last_aura_led_control_;
+  if (this->aura_led_queue_count_ == AURA_LED_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Aura LED queue full, replacing the last queued command");
+    this->aura_led_queue_count_--;
+  }
+  const uint8_t index = (this->aura_led_queue_head_ + this->aura_led_queue_count_) % AURA_LED_QUEUE_SIZE;
+  this->aura_led_queue_[index] = {state, speed, color, count};
+  this->aura_led_queue_count_++;
+  this->process_aura_led_queue_();
+}
+
+void FingerprintGrowComponent::process_aura_led_queue_() {
+  if (this->aura_led_queue_count_ == 0 || this->aura_led_in_flight_)
+    return;
+
+  const uint32_t elapsed = millis() - this->last_aura_led_control_;
   if (elapsed < this->last_aura_led_duration_) {
-    delay(this->last_aura_led_duration_ - elapsed);
+    // Let the running animation finish before starting the next one
+    this->set_timeout("aura_led", this->last_aura_led_duration_ - elapsed,
+                      [this]() { this->process_aura_led_queue_(); });
+    return;
   }
+
+  const GrowAuraLedCommand led = this->aura_led_queue_[this->aura_led_queue_head_];
+  this->aura_led_queue_head_ = (this->aura_led_queue_head_ + 1) % AURA_LED_QUEUE_SIZE;
+  this->aura_led_queue_count_--;
+
   ESP_LOGD(TAG, "Setting Aura LED");
-  this->data_ = {AURA_CONFIG, state, speed, color, count};
-  switch (this->send_command_()) {
-    case OK:
-      ESP_LOGD(TAG, "Aura LED set");
-      this->last_aura_led_control_ = millis();
-      this->last_aura_led_duration_ = 10 * speed * count;
-      break;
-    case PACKET_RCV_ERR:
-    case TIMEOUT:
-      break;
-    default:
-      ESP_LOGE(TAG, "Try led_control instead");
-      break;
+  this->aura_led_in_flight_ =
+      this->send_command_({AURA_CONFIG, led.state, led.speed, led.color, led.count}, [this, led](uint8_t result) {
+        this->aura_led_in_flight_ = false;
+        switch (result) {
+          case OK:
+            ESP_LOGD(TAG, "Aura LED set");
+            this->last_aura_led_control_ = millis();
+            this->last_aura_led_duration_ = 10 * led.speed * led.count;
+            break;
+          case PACKET_RCV_ERR:
+          case TIMEOUT:
+            break;
+          default:
+            ESP_LOGE(TAG, "Try led_control instead");
+            break;
+        }
+        this->process_aura_led_queue_();
+      });
+}
+
+bool FingerprintGrowComponent::send_command_(std::initializer_list<uint8_t> data,
+                                             std::function<void(uint8_t)> &&on_response, bool urgent) {
+  if (this->cmd_queue_count_ == CMD_QUEUE_SIZE) {
+    ESP_LOGE(TAG, "Command queue full, dropping command 0x%.2X", *data.begin());
+    return false;
   }
+  uint8_t index;
+  if (urgent) {
+    this->cmd_queue_head_ = (this->cmd_queue_head_ + CMD_QUEUE_SIZE - 1) % CMD_QUEUE_SIZE;
+    index = this->cmd_queue_head_;
+  } else {
+    index = (this->cmd_queue_head_ + this->cmd_queue_count_) % CMD_QUEUE_SIZE;
+  }
+  GrowPendingCommand &cmd = this->cmd_queue_[index];
+  cmd.size = std::min<size_t>(data.size(), MAX_CMD_SIZE);
+  std::copy(data.begin(), data.begin() + cmd.size, cmd.data);
+  cmd.on_response = std::move(on_response);
+  this->cmd_queue_count_++;
+  this->enable_loop();
+  return true;
 }
 
-uint8_t FingerprintGrowComponent::transfer_(std::vector<uint8_t> *p_data_buffer) {
+void FingerprintGrowComponent::transmit_(const GrowPendingCommand &cmd) {
   while (this->available())
     this->read();
   this->write((uint8_t) (START_CODE >> 8));
@@ -371,40 +493,38 @@ uint8_t FingerprintGrowComponent::transfer_(std::vector<uint8_t> *p_data_buffer)
   this->write(this->address_[3]);
   this->write(COMMAND);
 
-  uint16_t wire_length = p_data_buffer->size() + 2;
+  uint16_t wire_length = cmd.size + 2;
   this->write((uint8_t) (wire_length >> 8));
   this->write((uint8_t) (wire_length & 0xFF));
 
   uint16_t sum = (wire_length >> 8) + (wire_length & 0xFF) + COMMAND;
-  for (auto data : *p_data_buffer) {
-    this->write(data);
-    sum += data;
+  for (uint8_t i = 0; i < cmd.size; i++) {
+    this->write(cmd.data[i]);
+    sum += cmd.data[i];
   }
 
   this->write((uint8_t) (sum >> 8));
   this->write((uint8_t) (sum & 0xFF));
 
-  p_data_buffer->clear();
-
-  uint8_t byte;
-  uint16_t idx = 0, length = 0;
-
-  for (uint16_t timer = 0; timer < 1000; timer++) {
-    if (this->available() == 0) {
-      delay(1);
-      continue;
-    }
+  this->data_.clear();
+  this->rx_idx_ = 0;
+  this->rx_length_ = 0;
+  this->link_state_ = GROW_LINK_WAIT_RESPONSE;
+  this->link_start_ms_ = millis();
+}
 
-    byte = this->read();
+bool FingerprintGrowComponent::receive_response_() {
+  while (this->available() > 0) {
+    uint8_t byte = this->read();
 
-    switch (idx) {
+    switch (this->rx_idx_) {
       case 0:
         if (byte != (uint8_t) (START_CODE >> 8))
           continue;
         break;
       case 1:
         if (byte != (uint8_t) (START_CODE & 0xFF)) {
-          idx = 0;
+          this->rx_idx_ = 0;
           continue;
         }
         break;
@@ -412,27 +532,33 @@ uint8_t FingerprintGrowComponent::transfer_(std::vector<uint8_t> *p_data_buffer)
       case 3:
       case 4:
       case 5:
-        if (byte != this->address_[idx - 2]) {
-          idx = 0;
+        if (byte != this->address_[this->rx_idx_ - 2]) {
+          this->rx_idx_ = 0;
           continue;
         }
         break;
       case 6:
         if (byte != ACK) {
-          idx = 0;
+          this->rx_idx_ = 0;
           continue;
         }
         break;
       case 7:
-        length = (uint16_t) byte << 8;
+        this->rx_length_ = (uint16_t) byte << 8;
         break;
       case 8:
-        length |= byte;
+        this->rx_length_ |= byte;
+        if (this->rx_length_ == 0 || this->rx_length_ > MAX_RESPONSE_SIZE) {
+          ESP_LOGE(TAG, "Invalid response length from reader: %u", this->rx_length_);
+          this->data_.clear();
+          this->rx_idx_ = 0;
+          continue;
+        }
         break;
       default:
-        p_data_buffer->push_back(byte);
-        if ((idx - 8) == length) {
-          switch ((*p_data_buffer)[0]) {
+        this->data_.push_back(byte);
+        if ((this->rx_idx_ - 8) == this->rx_length_) {
+          switch (this->data_[0]) {
             case OK:
             case NO_FINGER:
             case IMAGE_FAIL:
@@ -452,73 +578,77 @@ uint8_t FingerprintGrowComponent::transfer_(std::vector<uint8_t> *p_data_buffer)
               ESP_LOGE(TAG, "Reader failed to process request");
               break;
             default:
-              ESP_LOGE(TAG, "Unknown response received from reader: 0x%.2X", (*p_data_buffer)[0]);
+              ESP_LOGE(TAG, "Unknown response received from reader: 0x%.2X", this->data_[0]);
               break;
           }
-          this->last_transfer_ms_ = millis();
-          return (*p_data_buffer)[0];
+          return true;
         }
         break;
     }
-    idx++;
+    this->rx_idx_++;
   }
-  ESP_LOGE(TAG, "No response received from reader");
-  (*p_data_buffer)[0] = TIMEOUT;
-  this->last_transfer_ms_ = millis();
-  return TIMEOUT;
+  return false;
 }
 
-uint8_t FingerprintGrowComponent::send_command_() {
-  this->sensor_wakeup_();
-  return this->transfer_(&this->data_);
+void FingerprintGrowComponent::complete_command_(uint8_t result) {
+  // Pop first, the callback is free to queue the next step of its sequence
+  GrowPendingCommand &cmd = this->cmd_queue_[this->cmd_queue_head_];
+  std::function<void(uint8_t)> on_response = std::move(cmd.on_response);
+  cmd.on_response = nullptr;
+  this->cmd_queue_head_ = (this->cmd_queue_head_ + 1) % CMD_QUEUE_SIZE;
+  this->cmd_queue_count_--;
+  this->link_state_ = GROW_LINK_IDLE;
+  this->last_transfer_ms_ = millis();
+  if (on_response)
+    on_response(result);
 }
 
 void FingerprintGrowComponent::sensor_wakeup_() {
-  // Immediately return if there is no power pin or the sensor is already on
-  if ((!this->has_power_pin_) || (this->is_sensor_awake_))
-    return;
-
   this->sensor_power_pin_->digital_write(true);
   this->is_sensor_awake_ = true;
+  this->wakeup_byte_ = TIMEOUT;
+  this->link_state_ = GROW_LINK_WAKING;
+  this->link_start_ms_ = millis();
+}
 
-  uint8_t byte = TIMEOUT;
-
+void FingerprintGrowComponent::handle_wakeup_() {
   // Wait for the byte HANDSHAKE_SIGN from the sensor meaning it is operational.
-  for (uint16_t timer = 0; timer < WAIT_FOR_WAKE_UP_MS; timer++) {
-    if (this->available() > 0) {
-      byte = this->read();
-
-      /* If the received byte is zero, the UART probably misinterpreted a raising edge on
-       * the RX pin due the power up as byte "zero" - I verified this behaviour using
-       * the esp32-arduino lib. So here we just ignore this fake byte.
-       */
-      if (byte != 0)
-        break;
-    }
-    delay(1);
+  while (this->available() > 0 && this->wakeup_byte_ == TIMEOUT) {
+    uint8_t byte = this->read();
+
+    /* If the received byte is zero, the UART probably misinterpreted a raising edge on
+     * the RX pin due the power up as byte "zero" - I verified this behaviour using
+     * the esp32-arduino lib. So here we just ignore this fake byte.
+     */
+    if (byte != 0)
+      this->wakeup_byte_ = byte;
   }
+  if (this->wakeup_byte_ == TIMEOUT && millis() - this->link_start_ms_ < WAIT_FOR_WAKE_UP_MS)
+    return;
 
   /* Lets check if the received by is a HANDSHAKE_SIGN, otherwise log an error
    * message and try to continue on the best effort.
    */
-  if (byte == HANDSHAKE_SIGN) {
+  if (this->wakeup_byte_ == HANDSHAKE_SIGN) {
     ESP_LOGD(TAG, "Sensor has woken up!");
-  } else if (byte == TIMEOUT) {
+  } else if (this->wakeup_byte_ == TIMEOUT) {
     ESP_LOGE(TAG, "Timed out waiting for sensor wake-up");
   } else {
-    ESP_LOGE(TAG, "Received wrong byte from the sensor during wake-up: 0x%.2X", byte);
+    ESP_LOGE(TAG, "Received wrong byte from the sensor during wake-up: 0x%.2X", this->wakeup_byte_);
   }
+  this->link_state_ = GROW_LINK_IDLE;
 
-  /* Next step, we must authenticate with the password. We cannot call check_password_ here
-   * neither use data_ to store the command because it might be already in use by the caller
-   * of send_command_()
+  /* Next step, we must authenticate with the password. It is put in front of the queue
+   * so it goes out before the command that woke the sensor up.
    */
-  std::vector<uint8_t> buffer = {VERIFY_PASSWORD, (uint8_t) (this->password_ >> 24), (uint8_t) (this->password_ >> 16),
-                                 (uint8_t) (this->password_ >> 8), (uint8_t) (this->password_ & 0xFF)};
-
-  if (this->transfer_(&buffer) != OK) {
-    ESP_LOGE(TAG, "Wrong password");
-  }
+  this->send_command_({VERIFY_PASSWORD, (uint8_t) (this->password_ >> 24), (uint8_t) (this->password_ >> 16),
+                       (uint8_t) (this->password_ >> 8), (uint8_t) (this->password_ & 0xFF)},
+                      [](uint8_t result) {
+                        if (result != OK) {
+                          ESP_LOGE(TAG, "Wrong password");
+                        }
+                      },
+                      true);
 }
 
 void FingerprintGrowComponent::sensor_sleep_() {
@@ -570,6 +700,9 @@ void FingerprintGrowComponent::dump_config() {
     LOG_SENSOR("  ", "Last Confidence", this->last_confidence_sensor_);
     ESP_LOGCONFIG(TAG, "    Current Value: %" PRIu32, (uint32_t) this->last_confidence_sensor_->get_state());
   }
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  this->latency_stats_.dump_config(TAG);
+#endif
 }
 
 }  // namespace fingerprint_grow
@@ -5,7 +5,11 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/fingerprint_base/fingerprint_reader.h"
+#include "esphome/components/fingerprint_base/latency_stats.h"
 
+#include <functional>
+#include <initializer_list>
 #include <limits>
 #include <vector>
 
@@ -21,6 +25,18 @@ static const uint8_t WAIT_FOR_WAKE_UP_MS = 200;
 
 static const uint32_t DEFAULT_IDLE_PERIOD_TO_SLEEP_MS = 5000;
 
+// Time the sensor is kept powered off at boot before it is woken up again.
+static const uint32_t POWER_CYCLE_DELAY_MS = 20;
+static const uint32_t RESPONSE_TIMEOUT_MS = 1000;
+
+// A scan or enrollment step queues at most two commands at a time, the rest is headroom for actions.
+static const uint8_t CMD_QUEUE_SIZE = 8;
+// Largest command payload sent by this component (SEARCH).
+static const uint8_t MAX_CMD_SIZE = 8;
+// Largest response accepted, READ_SYS_PARAM is the biggest one used.
+static const uint16_t MAX_RESPONSE_SIZE = 64;
+static const uint8_t AURA_LED_QUEUE_SIZE = 4;
+
 enum GrowPacketType {
   COMMAND = 0x01,
   DATA = 0x02,
@@ -93,10 +109,36 @@ enum GrowAuraLEDColor {
   WHITE = 0x07,
 };
 
-class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevice {
+enum GrowLinkState : uint8_t {
+  GROW_LINK_IDLE,
+  // Powered up, waiting for the HANDSHAKE_SIGN byte
+  GROW_LINK_WAKING,
+  GROW_LINK_WAIT_RESPONSE,
+};
+
+struct GrowPendingCommand {
+  uint8_t size;
+  uint8_t data[MAX_CMD_SIZE];
+  // Called with the confirmation code, the full response is in data_
+  std::function<void(uint8_t)> on_response;
+};
+
+struct GrowAuraLedCommand {
+  uint8_t state;
+  uint8_t speed;
+  uint8_t color;
+  uint8_t count;
+};
+
+class FingerprintGrowComponent : public PollingComponent,
+                                 public uart::UARTDevice,
+                                 public fingerprint_base::FingerprintReader {
  public:
   void update() override;
   void setup() override;
+  void loop() override;
+  // Drives the UART command link, replies must be read before the receive buffer overflows
+  LoopClass get_loop_class() const override { return LoopClass::LATENCY_CRITICAL; }
   void dump_config() override;
 
   void set_address(uint32_t address) {
@@ -124,18 +166,15 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
   void set_last_confidence_sensor(sensor::Sensor *last_confidence_sensor) {
     this->last_confidence_sensor_ = last_confidence_sensor;
   }
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  void set_latency_sensor(fingerprint_base::LatencyStage stage, fingerprint_base::LatencyStatistic statistic,
+                          sensor::Sensor *sens) {
+    this->latency_stats_.set_sensor(stage, statistic, sens);
+  }
+#endif
   void set_enrolling_binary_sensor(binary_sensor::BinarySensor *enrolling_binary_sensor) {
     this->enrolling_binary_sensor_ = enrolling_binary_sensor;
   }
-  void add_on_finger_scan_start_callback(std::function<void()> callback) {
-    this->finger_scan_start_callback_.add(std::move(callback));
-  }
-  void add_on_finger_scan_matched_callback(std::function<void(uint16_t, uint16_t)> callback) {
-    this->finger_scan_matched_callback_.add(std::move(callback));
-  }
-  void add_on_finger_scan_unmatched_callback(std::function<void()> callback) {
-    this->finger_scan_unmatched_callback_.add(std::move(callback));
-  }
   void add_on_finger_scan_misplaced_callback(std::function<void()> callback) {
     this->finger_scan_misplaced_callback_.add(std::move(callback));
   }
@@ -145,13 +184,6 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
   void add_on_enrollment_scan_callback(std::function<void(uint8_t, uint16_t)> callback) {
     this->enrollment_scan_callback_.add(std::move(callback));
   }
-  void add_on_enrollment_done_callback(std::function<void(uint16_t)> callback) {
-    this->enrollment_done_callback_.add(std::move(callback));
-  }
-
-  void add_on_enrollment_failed_callback(std::function<void(uint16_t)> callback) {
-    this->enrollment_failed_callback_.add(std::move(callback));
-  }
 
   void enroll_fingerprint(uint16_t finger_id, uint8_t num_buffers);
   void finish_enrollment(uint8_t result);
@@ -163,21 +195,31 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
 
  protected:
   void scan_and_match_();
-  uint8_t scan_image_(uint8_t buffer);
-  uint8_t save_fingerprint_();
-  bool check_password_();
-  bool set_password_();
-  bool get_parameters_();
+  void handle_search_result_(uint8_t result);
+  /// Take an image into the given char buffer, on_done gets the result of the last command sent.
+  void scan_image_(uint8_t buffer, std::function<void(uint8_t)> &&on_done);
+  void save_fingerprint_();
+  void check_password_();
+  void set_password_();
+  void get_parameters_();
   void get_fingerprint_count_();
-  uint8_t transfer_(std::vector<uint8_t> *p_data_buffer);
-  uint8_t send_command_();
+  void process_aura_led_queue_();
+  /// Queue a command; urgent ones are sent before everything already queued. Returns false if the queue is full.
+  bool send_command_(std::initializer_list<uint8_t> data, std::function<void(uint8_t)> &&on_response,
+                     bool urgent = false);
+  void transmit_(const GrowPendingCommand &cmd);
+  /// Feed the available bytes into the response parser, true once a full response is in data_.
+  bool receive_response_();
+  void complete_command_(uint8_t result);
+  bool is_busy_() const { return this->link_state_ != GROW_LINK_IDLE || this->cmd_queue_count_ > 0; }
   void sensor_wakeup_();
+  void handle_wakeup_();
   void sensor_sleep_();
 
   std::vector<uint8_t> data_ = {};
   uint8_t address_[4] = {0xFF, 0xFF, 0xFF, 0xFF};
   uint16_t capacity_ = 64;
-  std::string password_;
+  uint32_t password_ = 0x0;
   uint32_t new_password_ = std::numeric_limits<uint32_t>::max();
   GPIOPin *sensing_pin_{nullptr};
   GPIOPin *sensor_power_pin_{nullptr};
@@ -188,7 +230,20 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
   bool has_sensing_pin_ = false;
   bool has_power_pin_ = false;
   bool is_sensor_awake_ = false;
+  bool is_ready_ = false;
   uint32_t last_transfer_ms_ = 0;
+  GrowLinkState link_state_{GROW_LINK_IDLE};
+  uint32_t link_start_ms_ = 0;
+  uint16_t rx_idx_ = 0;
+  uint16_t rx_length_ = 0;
+  uint8_t wakeup_byte_ = TIMEOUT;
+  GrowPendingCommand cmd_queue_[CMD_QUEUE_SIZE];
+  uint8_t cmd_queue_head_ = 0;
+  uint8_t cmd_queue_count_ = 0;
+  GrowAuraLedCommand aura_led_queue_[AURA_LED_QUEUE_SIZE];
+  uint8_t aura_led_queue_head_ = 0;
+  uint8_t aura_led_queue_count_ = 0;
+  bool aura_led_in_flight_ = false;
   uint32_t last_aura_led_control_ = 0;
   uint16_t last_aura_led_duration_ = 0;
   uint16_t system_identifier_code_ = 0;
@@ -200,36 +255,14 @@ class FingerprintGrowComponent : public PollingComponent, public uart::UARTDevic
   sensor::Sensor *last_finger_id_sensor_{nullptr};
   sensor::Sensor *last_confidence_sensor_{nullptr};
   binary_sensor::BinarySensor *enrolling_binary_sensor_{nullptr};
+#ifdef USE_FINGERPRINT_LATENCY_STATS
+  fingerprint_base::LatencyStats latency_stats_;
+  uint32_t scan_start_us_ = 0;
+  uint32_t scan_image_us_ = 0;
+#endif
   CallbackManager<void()> finger_scan_invalid_callback_;
-  CallbackManager<void()> finger_scan_start_callback_;
-  CallbackManager<void(uint16_t, uint16_t)> finger_scan_matched_callback_;
-  CallbackManager<void()> finger_scan_unmatched_callback_;
   CallbackManager<void()> finger_scan_misplaced_callback_;
   CallbackManager<void(uint8_t, uint16_t)> enrollment_scan_callback_;
-  CallbackManager<void(uint16_t)> enrollment_done_callback_;
-  CallbackManager<void(uint16_t)> enrollment_failed_callback_;
-};
-
-class FingerScanStartTrigger : public Trigger<> {
- public:
-  explicit FingerScanStartTrigger(FingerprintGrowComponent *parent) {
-    parent->add_on_finger_scan_start_callback([this]() { this->trigger(); });
-  }
-};
-
-class FingerScanMatchedTrigger : public Trigger<uint16_t, uint16_t> {
- public:
-  explicit FingerScanMatchedTrigger(FingerprintGrowComponent *parent) {
-    parent->add_on_finger_scan_matched_callback(
-        [this](uint16_t finger_id, uint16_t confidence) { this->trigger(finger_id, confidence); });
-  }
-};
-
-class FingerScanUnmatchedTrigger : public Trigger<> {
- public:
-  explicit FingerScanUnmatchedTrigger(FingerprintGrowComponent *parent) {
-    parent->add_on_finger_scan_unmatched_callback([this]() { this->trigger(); });
-  }
 };
 
 class FingerScanMisplacedTrigger : public Trigger<> {
@@ -254,20 +287,6 @@ class EnrollmentScanTrigger : public Trigger<uint8_t, uint16_t> {
   }
 };
 
-class EnrollmentDoneTrigger : public Trigger<uint16_t> {
- public:
-  explicit EnrollmentDoneTrigger(FingerprintGrowComponent *parent) {
-    parent->add_on_enrollment_done_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
-  }
-};
-
-class EnrollmentFailedTrigger : public Trigger<uint16_t> {
- public:
-  explicit EnrollmentFailedTrigger(FingerprintGrowComponent *parent) {
-    parent->add_on_enrollment_failed_callback([this](uint16_t finger_id) { this->trigger(finger_id); });
-  }
-};
-
 template<typename... Ts> class EnrollmentAction : public Action<Ts...>, public Parented<FingerprintGrowComponent> {
  public:
   TEMPLATABLE_VALUE(uint16_t, finger_id)
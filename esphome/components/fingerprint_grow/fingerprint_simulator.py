@@ -0,0 +1,33 @@
+import esphome.codegen as cg
+from esphome.components.fingerprint_simulator import (
+    FingerprintSimulator,
+    fingerprint_simulator_schema,
+    register_fingerprint_simulator,
+)
+import esphome.config_validation as cv
+from esphome.const import CONF_CAPACITY, CONF_ID, CONF_PASSWORD, PLATFORM_HOST
+
+from . import fingerprint_grow_ns
+
+DEPENDENCIES = ["fingerprint_simulator"]
+
+FingerprintGrowSimulator = fingerprint_grow_ns.class_(
+    "FingerprintGrowSimulator", FingerprintSimulator
+)
+
+CONFIG_SCHEMA = cv.All(
+    fingerprint_simulator_schema(FingerprintGrowSimulator, 57600).extend(
+        {
+            cv.Optional(CONF_PASSWORD, default=0): cv.uint32_t,
+            cv.Optional(CONF_CAPACITY, default=200): cv.int_range(min=1, max=65535),
+        }
+    ),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await register_fingerprint_simulator(var, config)
+    cg.add(var.set_password(config[CONF_PASSWORD]))
+    cg.add(var.set_capacity(config[CONF_CAPACITY]))
@@ -0,0 +1,199 @@
+#include "grow_simulator.h"
+
+#ifdef USE_FINGERPRINT_SIMULATOR
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace fingerprint_grow {
+
+static const char *const TAG = "fingerprint_grow.simulator";
+
+// Start code, address, packet type and length
+static const size_t PACKET_HEADER_SIZE = 9;
+
+void FingerprintGrowSimulator::receive_(const uint8_t *data, size_t len) {
+  this->rx_packet_.insert(this->rx_packet_.end(), data, data + len);
+  while (this->rx_packet_.size() >= PACKET_HEADER_SIZE) {
+    if (this->rx_packet_[0] != (uint8_t) (START_CODE >> 8) || this->rx_packet_[1] != (uint8_t) (START_CODE & 0xFF)) {
+      this->rx_packet_.erase(this->rx_packet_.begin());
+      continue;
+    }
+    const uint16_t wire_length = ((uint16_t) this->rx_packet_[7] << 8) | this->rx_packet_[8];
+    if (wire_length < 2) {
+      this->rx_packet_.erase(this->rx_packet_.begin());
+      continue;
+    }
+    if (this->rx_packet_.size() < PACKET_HEADER_SIZE + wire_length)
+      return;
+
+    std::copy_n(this->rx_packet_.begin() + 2, 4, this->address_);
+    const uint8_t *payload = this->rx_packet_.data() + PACKET_HEADER_SIZE;
+    const uint16_t payload_length = wire_length - 2;
+    uint16_t sum = this->rx_packet_[6] + this->rx_packet_[7] + this->rx_packet_[8];
+    for (uint16_t i = 0; i < payload_length; i++)
+      sum += payload[i];
+    const uint16_t checksum = ((uint16_t) payload[payload_length] << 8) | payload[payload_length + 1];
+
+    this->frames_received_++;
+    if (this->rx_packet_[6] != COMMAND || payload_length == 0 || sum != checksum) {
+      ESP_LOGW(TAG, "Invalid command packet received");
+      this->send_ack_({PACKET_RCV_ERR});
+    } else {
+      this->handle_command_(payload, payload_length);
+    }
+    this->rx_packet_.erase(this->rx_packet_.begin(), this->rx_packet_.begin() + PACKET_HEADER_SIZE + wire_length);
+  }
+}
+
+void FingerprintGrowSimulator::handle_command_(const uint8_t *data, uint16_t len) {
+  ESP_LOGV(TAG, "Command 0x%.2X, length %u", data[0], len);
+  if (this->inject_error_()) {
+    ESP_LOGV(TAG, "Injecting failure for command 0x%.2X", data[0]);
+    this->send_ack_({data[0] == GET_IMAGE ? (uint8_t) IMAGE_FAIL : (uint8_t) PACKET_RCV_ERR});
+    return;
+  }
+
+  switch (data[0]) {
+    case GET_IMAGE:
+      this->image_finger_ = this->finger_id_;
+      this->send_ack_({this->finger_down_ ? (uint8_t) OK : (uint8_t) NO_FINGER});
+      break;
+    case IMAGE_2_TZ: {
+      const uint8_t buffer = len > 1 ? data[1] : 0;
+      if (buffer == 0 || buffer > GROW_SIMULATOR_CHAR_BUFFERS) {
+        this->send_ack_({PACKET_RCV_ERR});
+        break;
+      }
+      this->char_buffers_[buffer - 1] = this->image_finger_;
+      this->char_buffer_used_[buffer - 1] = true;
+      this->send_ack_({OK});
+      break;
+    }
+    case SEARCH:
+    case HI_SPEED_SEARCH: {
+      const uint16_t finger_id = this->char_buffers_[0];
+      const uint16_t start = len > 3 ? ((uint16_t) data[2] << 8) | data[3] : 0;
+      const uint16_t count = len > 5 ? ((uint16_t) data[4] << 8) | data[5] : this->capacity_;
+      if (finger_id != fingerprint_simulator::UNKNOWN_FINGER && this->has_template(finger_id) && finger_id >= start &&
+          finger_id - start < count) {
+        this->send_ack_({OK, (uint8_t) (finger_id >> 8), (uint8_t) (finger_id & 0xFF),
+                         (uint8_t) (GROW_SIMULATOR_CONFIDENCE >> 8), (uint8_t) (GROW_SIMULATOR_CONFIDENCE & 0xFF)},
+                        this->match_time_ms_);
+      } else {
+        this->send_ack_({NOT_FOUND, 0, 0, 0, 0}, this->match_time_ms_);
+      }
+      break;
+    }
+    case REG_MODEL:
+      this->handle_reg_model_();
+      break;
+    case STORE: {
+      const uint16_t slot = len > 3 ? ((uint16_t) data[2] << 8) | data[3] : this->capacity_;
+      if (!this->model_valid_) {
+        this->send_ack_({PACKET_RCV_ERR});
+      } else if (slot >= this->capacity_) {
+        this->send_ack_({BAD_LOCATION});
+      } else {
+        // The slot number is the finger identity from now on
+        this->add_template(slot);
+        this->model_valid_ = false;
+        this->send_ack_({OK});
+      }
+      break;
+    }
+    case DELETE: {
+      const uint16_t slot = len > 2 ? ((uint16_t) data[1] << 8) | data[2] : 0;
+      const uint16_t count = len > 4 ? ((uint16_t) data[3] << 8) | data[4] : 1;
+      for (uint16_t i = 0; i < count; i++)
+        this->remove_template_(slot + i);
+      this->send_ack_({OK});
+      break;
+    }
+    case DELETE_ALL:
+      this->templates_.clear();
+      this->send_ack_({OK});
+      break;
+    case READ_SYS_PARAM:
+      // Status, system identifier, capacity, security level, address, packet size (128 bytes), baud rate (x 9600)
+      this->send_ack_({OK, 0x00, 0x00, 0x00, 0x00, (uint8_t) (this->capacity_ >> 8), (uint8_t) (this->capacity_ & 0xFF),
+                       0x00, 0x03, this->address_[0], this->address_[1], this->address_[2], this->address_[3], 0x00,
+                       0x01, 0x00, (uint8_t) (this->baud_rate_ / 9600)});
+      break;
+    case VERIFY_PASSWORD:
+    case SET_PASSWORD: {
+      if (len < 5) {
+        this->send_ack_({PACKET_RCV_ERR});
+        break;
+      }
+      const uint32_t password = encode_uint32(data[1], data[2], data[3], data[4]);
+      if (data[0] == SET_PASSWORD) {
+        this->password_ = password;
+        this->send_ack_({OK});
+      } else {
+        this->send_ack_({password == this->password_ ? (uint8_t) OK : (uint8_t) PASSWORD_FAIL});
+      }
+      break;
+    }
+    case TEMPLATE_COUNT: {
+      const uint16_t count = this->templates_.size();
+      this->send_ack_({OK, (uint8_t) (count >> 8), (uint8_t) (count & 0xFF)});
+      break;
+    }
+    case LOAD:
+    case AURA_CONFIG:
+    case LED_ON:
+    case LED_OFF:
+      this->send_ack_({OK});
+      break;
+    default:
+      this->send_ack_({PACKET_RCV_ERR});
+      break;
+  }
+}
+
+void FingerprintGrowSimulator::handle_reg_model_() {
+  bool found = false;
+  bool match = true;
+  uint16_t finger_id = fingerprint_simulator::UNKNOWN_FINGER;
+  for (uint8_t i = 0; i < GROW_SIMULATOR_CHAR_BUFFERS; i++) {
+    if (!this->char_buffer_used_[i])
+      continue;
+    if (found && this->char_buffers_[i] != finger_id)
+      match = false;
+    finger_id = this->char_buffers_[i];
+    found = true;
+    this->char_buffer_used_[i] = false;
+  }
+  this->model_valid_ = found && match;
+  this->send_ack_({this->model_valid_ ? (uint8_t) OK : (uint8_t) ENROLL_MISMATCH}, this->match_time_ms_);
+}
+
+void FingerprintGrowSimulator::send_ack_(std::initializer_list<uint8_t> data, uint32_t extra_delay_ms) {
+  const uint16_t wire_length = data.size() + 2;
+  std::vector<uint8_t> packet;
+  packet.reserve(PACKET_HEADER_SIZE + wire_length);
+  packet.push_back((uint8_t) (START_CODE >> 8));
+  packet.push_back((uint8_t) (START_CODE & 0xFF));
+  packet.insert(packet.end(), this->address_, this->address_ + 4);
+  packet.push_back(ACK);
+  packet.push_back((uint8_t) (wire_length >> 8));
+  packet.push_back((uint8_t) (wire_length & 0xFF));
+
+  uint16_t sum = ACK + (wire_length >> 8) + (wire_length & 0xFF);
+  for (uint8_t byte : data) {
+    packet.push_back(byte);
+    sum += byte;
+  }
+  packet.push_back((uint8_t) (sum >> 8));
+  packet.push_back((uint8_t) (sum & 0xFF));
+  this->send_frame_(std::move(packet), extra_delay_ms);
+}
+
+}  // namespace fingerprint_grow
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_SIMULATOR
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_FINGERPRINT_SIMULATOR
+
+#include "esphome/components/fingerprint_simulator/fingerprint_simulator.h"
+#include "fingerprint_grow.h"
+
+#include <initializer_list>
+#include <vector>
+
+namespace esphome {
+namespace fingerprint_grow {
+
+// Character buffers addressed by IMAGE_2_TZ, enrollments use up to MAX_ENROLLMENT_BUFFERS of them
+static const uint8_t GROW_SIMULATOR_CHAR_BUFFERS = 6;
+// Confidence reported for every match
+static const uint16_t GROW_SIMULATOR_CONFIDENCE = 100;
+
+/// R30x / R50x reader speaking the Grow packet protocol.
+/// Template upload and download are answered with PACKET_RCV_ERR, wake-up handshakes through a power pin are not
+/// simulated.
+class FingerprintGrowSimulator : public fingerprint_simulator::FingerprintSimulator {
+ public:
+  void set_password(uint32_t password) { this->password_ = password; }
+  void set_capacity(uint16_t capacity) { this->capacity_ = capacity; }
+
+ protected:
+  const char *model_name_() const override { return "Grow"; }
+  void receive_(const uint8_t *data, size_t len) override;
+  void on_finger_down_(uint16_t finger_id) override {}
+
+  void handle_command_(const uint8_t *data, uint16_t len);
+  void handle_reg_model_();
+  void send_ack_(std::initializer_list<uint8_t> data, uint32_t extra_delay_ms = 0);
+
+  uint32_t password_{0};
+  uint16_t capacity_{200};
+
+  // Finger currently held in the image buffer, the character buffers and the model built from them
+  uint16_t image_finger_{fingerprint_simulator::UNKNOWN_FINGER};
+  uint16_t char_buffers_[GROW_SIMULATOR_CHAR_BUFFERS]{};
+  bool char_buffer_used_[GROW_SIMULATOR_CHAR_BUFFERS]{};
+  bool model_valid_{false};
+
+  // Address of the last command, echoed in the answers
+  uint8_t address_[4]{0xFF, 0xFF, 0xFF, 0xFF};
+  std::vector<uint8_t> rx_packet_;
+};
+
+}  // namespace fingerprint_grow
+}  // namespace esphome
+
+#endif  // USE_FINGERPRINT_SIMULATOR
@@ -1,5 +1,10 @@
 import esphome.codegen as cg
 from esphome.components import sensor
+from esphome.components.fingerprint_base import (
+    CONF_IDENTIFY_LATENCY,
+    latency_schema,
+    setup_latency_sensors,
+)
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_CAPACITY,
@@ -52,6 +57,9 @@ CONFIG_SCHEMA = cv.Schema(
             accuracy_decimals=0,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_IDENTIFY_LATENCY): latency_schema(
+            ["capture", "match", "dispatch", "total"]
+        ),
     }
 )
 
@@ -72,3 +80,6 @@ async def to_code(config):
         conf = config[key]
         sens = await sensor.new_sensor(conf)
         cg.add(getattr(hub, f"set_{key}_sensor")(sens))
+
+    if CONF_IDENTIFY_LATENCY in config:
+        await setup_latency_sensors(hub, config[CONF_IDENTIFY_LATENCY])
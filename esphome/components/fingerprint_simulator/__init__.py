@@ -0,0 +1,120 @@
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import uart
+import esphome.config_validation as cv
+from esphome.const import CONF_BAUD_RATE, CONF_FINGER_ID, CONF_ID
+
+CODEOWNERS = ["@Luigi-pi"]
+AUTO_LOAD = ["uart"]
+IS_PLATFORM_COMPONENT = True
+
+CONF_LATENCY = "latency"
+CONF_MATCH_TIME = "match_time"
+CONF_TOUCH_DURATION = "touch_duration"
+CONF_ERROR_RATE = "error_rate"
+CONF_DROP_RATE = "drop_rate"
+CONF_CORRUPT_RATE = "corrupt_rate"
+CONF_TEMPLATES = "templates"
+CONF_TOUCH_INTERVAL = "touch_interval"
+CONF_MATCH_RATIO = "match_ratio"
+
+fingerprint_simulator_ns = cg.esphome_ns.namespace("fingerprint_simulator")
+FingerprintSimulator = fingerprint_simulator_ns.class_(
+    "FingerprintSimulator", uart.UARTComponent, cg.Component
+)
+TouchAction = fingerprint_simulator_ns.class_("TouchAction", automation.Action)
+SetFaultsAction = fingerprint_simulator_ns.class_("SetFaultsAction", automation.Action)
+
+
+def fingerprint_simulator_schema(class_, baud_rate):
+    return cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(class_),
+            cv.Optional(CONF_BAUD_RATE, default=baud_rate): cv.positive_int,
+            cv.Optional(
+                CONF_LATENCY, default="5ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_MATCH_TIME, default="50ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_TOUCH_DURATION, default="200ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_ERROR_RATE, default="0%"): cv.percentage,
+            cv.Optional(CONF_DROP_RATE, default="0%"): cv.percentage,
+            cv.Optional(CONF_CORRUPT_RATE, default="0%"): cv.percentage,
+            cv.Optional(CONF_TEMPLATES, default=[]): cv.ensure_list(
+                cv.int_range(min=1, max=65535)
+            ),
+            cv.Optional(CONF_TOUCH_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MATCH_RATIO, default="100%"): cv.percentage,
+        }
+    ).extend(cv.COMPONENT_SCHEMA)
+
+
+async def register_fingerprint_simulator(var, config):
+    cg.add_define("USE_FINGERPRINT_SIMULATOR")
+    await cg.register_component(var, config)
+    cg.add(var.set_baud_rate(config[CONF_BAUD_RATE]))
+    cg.add(var.set_latency_ms(config[CONF_LATENCY]))
+    cg.add(var.set_match_time_ms(config[CONF_MATCH_TIME]))
+    cg.add(var.set_touch_duration_ms(config[CONF_TOUCH_DURATION]))
+    cg.add(var.set_error_rate(config[CONF_ERROR_RATE]))
+    cg.add(var.set_drop_rate(config[CONF_DROP_RATE]))
+    cg.add(var.set_corrupt_rate(config[CONF_CORRUPT_RATE]))
+    for template_id in config[CONF_TEMPLATES]:
+        cg.add(var.add_template(template_id))
+    if CONF_TOUCH_INTERVAL in config:
+        cg.add(var.set_touch_interval_ms(config[CONF_TOUCH_INTERVAL]))
+        cg.add(var.set_match_ratio(config[CONF_MATCH_RATIO]))
+
+
+@automation.register_action(
+    "fingerprint_simulator.touch",
+    TouchAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintSimulator),
+            cv.Optional(CONF_FINGER_ID, default=0): cv.templatable(cv.uint16_t),
+        },
+        key=CONF_FINGER_ID,
+    ),
+)
+async def fingerprint_simulator_touch_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    template_ = await cg.templatable(config[CONF_FINGER_ID], args, cg.uint16)
+    cg.add(var.set_finger_id(template_))
+    return var
+
+
+@automation.register_action(
+    "fingerprint_simulator.set_faults",
+    SetFaultsAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(FingerprintSimulator),
+            cv.Optional(CONF_LATENCY): cv.templatable(
+                cv.positive_time_period_milliseconds
+            ),
+            cv.Optional(CONF_ERROR_RATE): cv.templatable(cv.percentage),
+            cv.Optional(CONF_DROP_RATE): cv.templatable(cv.percentage),
+            cv.Optional(CONF_CORRUPT_RATE): cv.templatable(cv.percentage),
+        }
+    ),
+)
+async def fingerprint_simulator_set_faults_to_code(
+    config, action_id, template_arg, args
+):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+
+    if CONF_LATENCY in config:
+        template_ = await cg.templatable(config[CONF_LATENCY], args, cg.uint32)
+        cg.add(var.set_latency(template_))
+    for key in [CONF_ERROR_RATE, CONF_DROP_RATE, CONF_CORRUPT_RATE]:
+        if key in config:
+            template_ = await cg.templatable(config[key], args, cg.float_)
+            cg.add(getattr(var, f"set_{key}")(template_))
+    return var
@@ -0,0 +1,125 @@
+#include "fingerprint_simulator.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace fingerprint_simulator {
+
+static const char *const TAG = "fingerprint_simulator";
+
+void FingerprintSimulator::setup() {
+  if (this->touch_interval_ms_ > 0) {
+    this->set_interval("touch", this->touch_interval_ms_, [this]() {
+      uint16_t finger_id = UNKNOWN_FINGER;
+      if (!this->templates_.empty() && random_float() < this->match_ratio_)
+        finger_id = this->templates_[random_uint32() % this->templates_.size()];
+      this->touch(finger_id);
+    });
+  }
+}
+
+void FingerprintSimulator::loop() {
+  const uint32_t now = millis();
+  while (!this->pending_.empty() && (int32_t) (now - this->pending_.front().due_ms) >= 0) {
+    const std::vector<uint8_t> &frame = this->pending_.front().data;
+    this->rx_.insert(this->rx_.end(), frame.begin(), frame.end());
+    this->pending_.pop_front();
+  }
+}
+
+void FingerprintSimulator::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Fingerprint Simulator:\n"
+                "  Model: %s\n"
+                "  Templates: %u\n"
+                "  Latency: %" PRIu32 " ms\n"
+                "  Match Time: %" PRIu32 " ms\n"
+                "  Touch Duration: %" PRIu32 " ms\n"
+                "  Error Rate: %.1f%%\n"
+                "  Drop Rate: %.1f%%\n"
+                "  Corrupt Rate: %.1f%%",
+                this->model_name_(), (unsigned) this->templates_.size(), this->latency_ms_, this->match_time_ms_,
+                this->touch_duration_ms_, this->error_rate_ * 100.0f, this->drop_rate_ * 100.0f,
+                this->corrupt_rate_ * 100.0f);
+  if (this->touch_interval_ms_ > 0) {
+    ESP_LOGCONFIG(TAG,
+                  "  Touch Interval: %" PRIu32 " ms\n"
+                  "  Match Ratio: %.0f%%",
+                  this->touch_interval_ms_, this->match_ratio_ * 100.0f);
+  }
+}
+
+void FingerprintSimulator::write_array(const uint8_t *data, size_t len) { this->receive_(data, len); }
+
+bool FingerprintSimulator::peek_byte(uint8_t *data) {
+  if (this->rx_.empty())
+    return false;
+  *data = this->rx_.front();
+  return true;
+}
+
+bool FingerprintSimulator::read_array(uint8_t *data, size_t len) {
+  if (this->rx_.size() < len)
+    return false;
+  std::copy_n(this->rx_.begin(), len, data);
+  this->rx_.erase(this->rx_.begin(), this->rx_.begin() + len);
+  return true;
+}
+
+void FingerprintSimulator::add_template(uint16_t id) {
+  if (!this->has_template(id))
+    this->templates_.push_back(id);
+}
+
+bool FingerprintSimulator::has_template(uint16_t id) const {
+  return std::find(this->templates_.begin(), this->templates_.end(), id) != this->templates_.end();
+}
+
+void FingerprintSimulator::remove_template_(uint16_t id) {
+  this->templates_.erase(std::remove(this->templates_.begin(), this->templates_.end(), id), this->templates_.end());
+}
+
+void FingerprintSimulator::touch(uint16_t finger_id) {
+  if (this->finger_down_) {
+    ESP_LOGV(TAG, "Finger already down, touch ignored");
+    return;
+  }
+  ESP_LOGV(TAG, "Touch with finger %u", finger_id);
+  this->touches_++;
+  this->finger_down_ = true;
+  this->finger_id_ = finger_id;
+  this->on_finger_down_(finger_id);
+  this->set_timeout("finger_up", this->touch_duration_ms_, [this]() {
+    this->finger_down_ = false;
+    this->on_finger_up_();
+  });
+}
+
+void FingerprintSimulator::send_frame_(std::vector<uint8_t> &&frame, uint32_t extra_delay_ms) {
+  if (this->drop_rate_ > 0.0f && random_float() < this->drop_rate_) {
+    ESP_LOGV(TAG, "Dropping frame of %u bytes", (unsigned) frame.size());
+    this->frames_dropped_++;
+    return;
+  }
+  if (this->corrupt_rate_ > 0.0f && random_float() < this->corrupt_rate_ && !frame.empty()) {
+    frame[random_uint32() % frame.size()] ^= 1 << (random_uint32() % 8);
+    this->frames_corrupted_++;
+  }
+  // Frames never overtake each other, whatever their delay
+  uint32_t due_ms = millis() + this->latency_ms_ + extra_delay_ms;
+  if (!this->pending_.empty() && (int32_t) (due_ms - this->last_due_ms_) < 0)
+    due_ms = this->last_due_ms_;
+  this->last_due_ms_ = due_ms;
+  this->pending_.push_back({due_ms, std::move(frame)});
+  this->frames_sent_++;
+}
+
+bool FingerprintSimulator::inject_error_() const {
+  return this->error_rate_ > 0.0f && random_float() < this->error_rate_;
+}
+
+}  // namespace fingerprint_simulator
+}  // namespace esphome
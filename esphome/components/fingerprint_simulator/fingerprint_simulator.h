@@ -0,0 +1,129 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/components/uart/uart_component.h"
+
+#include <deque>
+#include <vector>
+
+namespace esphome {
+namespace fingerprint_simulator {
+
+/// A touch with this finger ID matches no template.
+static const uint16_t UNKNOWN_FINGER = 0;
+
+/// Simulated fingerprint reader standing in for the UART bus of a reader component.
+/// Bytes written by the driver are parsed by the model implementation, its answers are delivered back after the
+/// configured latency and pass through the fault injection first. Template IDs double as finger identities: a touch
+/// with finger_id N matches the template stored at N.
+class FingerprintSimulator : public uart::UARTComponent, public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  /* uart::UARTComponent */
+  void write_array(const uint8_t *data, size_t len) override;
+  bool peek_byte(uint8_t *data) override;
+  bool read_array(uint8_t *data, size_t len) override;
+  int available() override { return static_cast<int>(this->rx_.size()); }
+  void flush() override {}
+
+  void set_latency_ms(uint32_t latency_ms) { this->latency_ms_ = latency_ms; }
+  void set_match_time_ms(uint32_t match_time_ms) { this->match_time_ms_ = match_time_ms; }
+  void set_touch_duration_ms(uint32_t touch_duration_ms) { this->touch_duration_ms_ = touch_duration_ms; }
+  void set_error_rate(float error_rate) { this->error_rate_ = error_rate; }
+  void set_drop_rate(float drop_rate) { this->drop_rate_ = drop_rate; }
+  void set_corrupt_rate(float corrupt_rate) { this->corrupt_rate_ = corrupt_rate; }
+  void set_touch_interval_ms(uint32_t touch_interval_ms) { this->touch_interval_ms_ = touch_interval_ms; }
+  void set_match_ratio(float match_ratio) { this->match_ratio_ = match_ratio; }
+  void add_template(uint16_t id);
+
+  /// Put a finger on the sensor for touch_duration; UNKNOWN_FINGER matches no template.
+  void touch(uint16_t finger_id);
+  bool is_finger_down() const { return this->finger_down_; }
+  bool has_template(uint16_t id) const;
+
+  uint32_t get_frames_received() const { return this->frames_received_; }
+  uint32_t get_frames_sent() const { return this->frames_sent_; }
+  uint32_t get_frames_dropped() const { return this->frames_dropped_; }
+  uint32_t get_frames_corrupted() const { return this->frames_corrupted_; }
+  uint32_t get_touches() const { return this->touches_; }
+
+ protected:
+  void check_logger_conflict() override {}
+
+  virtual const char *model_name_() const = 0;
+  /// Bytes written by the driver, in the order they were sent.
+  virtual void receive_(const uint8_t *data, size_t len) = 0;
+  /// A finger was placed on the sensor.
+  virtual void on_finger_down_(uint16_t finger_id) = 0;
+  /// The finger placed by the last touch was lifted.
+  virtual void on_finger_up_() {}
+
+  /// Queue a frame for the driver, delivered after latency plus extra_delay_ms and never before earlier frames.
+  void send_frame_(std::vector<uint8_t> &&frame, uint32_t extra_delay_ms = 0);
+  /// True with the configured error rate, the model then answers with an error instead.
+  bool inject_error_() const;
+  void remove_template_(uint16_t id);
+
+  struct PendingFrame {
+    uint32_t due_ms;
+    std::vector<uint8_t> data;
+  };
+
+  uint32_t latency_ms_{0};
+  uint32_t match_time_ms_{0};
+  uint32_t touch_duration_ms_{0};
+  float error_rate_{0.0f};
+  float drop_rate_{0.0f};
+  float corrupt_rate_{0.0f};
+  uint32_t touch_interval_ms_{0};
+  float match_ratio_{1.0f};
+
+  std::vector<uint16_t> templates_;
+  uint16_t finger_id_{UNKNOWN_FINGER};
+  bool finger_down_{false};
+
+  std::deque<PendingFrame> pending_;
+  // Bytes already delivered and readable by the driver
+  std::deque<uint8_t> rx_;
+  uint32_t last_due_ms_{0};
+
+  uint32_t frames_received_{0};
+  uint32_t frames_sent_{0};
+  uint32_t frames_dropped_{0};
+  uint32_t frames_corrupted_{0};
+  uint32_t touches_{0};
+};
+
+template<typename... Ts> class TouchAction : public Action<Ts...>, public Parented<FingerprintSimulator> {
+ public:
+  TEMPLATABLE_VALUE(uint16_t, finger_id)
+
+  void play(Ts... x) override { this->parent_->touch(this->finger_id_.value(x...)); }
+};
+
+template<typename... Ts> class SetFaultsAction : public Action<Ts...>, public Parented<FingerprintSimulator> {
+ public:
+  TEMPLATABLE_VALUE(uint32_t, latency)
+  TEMPLATABLE_VALUE(float, error_rate)
+  TEMPLATABLE_VALUE(float, drop_rate)
+  TEMPLATABLE_VALUE(float, corrupt_rate)
+
+  void play(Ts... x) override {
+    if (this->latency_.has_value())
+      this->parent_->set_latency_ms(this->latency_.value(x...));
+    if (this->error_rate_.has_value())
+      this->parent_->set_error_rate(this->error_rate_.value(x...));
+    if (this->drop_rate_.has_value())
+      this->parent_->set_drop_rate(this->drop_rate_.value(x...));
+    if (this->corrupt_rate_.has_value())
+      this->parent_->set_corrupt_rate(this->corrupt_rate_.value(x...));
+  }
+};
+
+}  // namespace fingerprint_simulator
+}  // namespace esphome
@@ -57,8 +57,29 @@ Font::Font(const GlyphData *data, int data_nr, int baseline, int height, int des
   glyphs_.reserve(data_nr);
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(&data[i]);
+  this->ascii_index_.fill(-1);
+  for (int i = 0; i < data_nr && i <= INT16_MAX; ++i) {
+    const uint8_t *a_char = data[i].a_char;
+    if (a_char[0] >= 0x80)
+      continue;
+    if (a_char[1] == '\0') {
+      this->ascii_index_[a_char[0]] = i;
+    } else {
+      // glyphs are sorted, the single character one comes first and must not shadow the longer match
+      this->ascii_index_[a_char[0]] = -1;
+    }
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  if (str[0] < 0x80) {
+    int16_t index = this->ascii_index_[str[0]];
+    if (index >= 0) {
+      *match_length = 1;
+      return index;
+    }
+  }
+  if (this->glyphs_.empty())
+    return -1;
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -75,6 +96,96 @@ int Font::match_next_glyph(const uint8_t *str, int *match_length) {
   return lo;
 }
 #ifdef USE_DISPLAY
+template<typename F> void Font::decode_glyph_(const GlyphData *glyph_data, F &&callback) const {
+  const uint8_t *data = glyph_data->data;
+  uint8_t bitmask = 0;
+  uint8_t pixel_data = 0;
+  const uint8_t bpp_max = (1 << this->bpp_) - 1;
+  for (int y = 0; y != glyph_data->height; y++) {
+    // Fully set pixels next to each other are drawn as one span
+    int run_start = -1;
+    for (int x = 0; x != glyph_data->width; x++) {
+      uint8_t pixel = 0;
+      for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
+        if (bitmask == 0) {
+          pixel_data = progmem_read_byte(data++);
+          bitmask = 0x80;
+        }
+        pixel <<= 1;
+        if ((pixel_data & bitmask) != 0)
+          pixel |= 1;
+        bitmask >>= 1;
+      }
+      if (pixel == bpp_max) {
+        if (run_start < 0)
+          run_start = x;
+        continue;
+      }
+      if (run_start >= 0) {
+        callback(GlyphSpan{static_cast<int16_t>(glyph_data->offset_x + run_start),
+                           static_cast<int16_t>(glyph_data->offset_y + y), static_cast<int16_t>(x - run_start),
+                           bpp_max});
+        run_start = -1;
+      }
+      if (pixel != 0) {
+        callback(GlyphSpan{static_cast<int16_t>(glyph_data->offset_x + x),
+                           static_cast<int16_t>(glyph_data->offset_y + y), 1, pixel});
+      }
+    }
+    if (run_start >= 0) {
+      callback(GlyphSpan{static_cast<int16_t>(glyph_data->offset_x + run_start),
+                         static_cast<int16_t>(glyph_data->offset_y + y),
+                         static_cast<int16_t>(glyph_data->width - run_start), bpp_max});
+    }
+  }
+}
+
+const std::vector<Font::GlyphSpan> *Font::glyph_spans_(int glyph_n) {
+  for (auto &entry : this->glyph_cache_) {
+    if (entry.glyph == glyph_n) {
+      entry.last_used = ++this->glyph_cache_uses_;
+      return &entry.spans;
+    }
+  }
+
+  // Count first, so a glyph that is not kept allocates nothing
+  const GlyphData *glyph_data = this->glyphs_[glyph_n].glyph_data_;
+  size_t count = 0;
+  this->decode_glyph_(glyph_data, [&count](const GlyphSpan & /*span*/) { count++; });
+  const size_t bytes = count * sizeof(GlyphSpan);
+  if (bytes > GLYPH_CACHE_BYTES)
+    return nullptr;
+
+  auto drop = [this](CachedGlyph *entry) {
+    this->glyph_cache_bytes_ -= entry->spans.capacity() * sizeof(GlyphSpan);
+    entry->glyph = -1;
+    entry->last_used = 0;
+    std::vector<GlyphSpan>().swap(entry->spans);
+  };
+  // The least recently printed glyph gives up its slot, more of them until the new one fits
+  CachedGlyph *slot = &this->glyph_cache_[0];
+  for (auto &entry : this->glyph_cache_) {
+    if (entry.last_used < slot->last_used)
+      slot = &entry;
+  }
+  drop(slot);
+  while (this->glyph_cache_bytes_ + bytes > GLYPH_CACHE_BYTES) {
+    CachedGlyph *oldest = nullptr;
+    for (auto &entry : this->glyph_cache_) {
+      if (entry.glyph >= 0 && (oldest == nullptr || entry.last_used < oldest->last_used))
+        oldest = &entry;
+    }
+    drop(oldest);
+  }
+
+  slot->glyph = glyph_n;
+  slot->last_used = ++this->glyph_cache_uses_;
+  slot->spans.reserve(count);
+  this->decode_glyph_(glyph_data, [slot](const GlyphSpan &span) { slot->spans.push_back(span); });
+  this->glyph_cache_bytes_ += slot->spans.capacity() * sizeof(GlyphSpan);
+  return &slot->spans;
+}
+
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
   *height = this->height_;
@@ -110,7 +221,17 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
   int i = 0;
   int x_at = x_start;
-  int scan_x1, scan_y1, scan_width, scan_height;
+  const uint8_t bpp_max = (1 << this->bpp_) - 1;
+  auto blend = [&](uint8_t alpha) {
+    auto on = (float) alpha / (float) bpp_max;
+    return Color((uint8_t) (((float) color.r - (float) background.r) * on + (float) background.r),
+                 (uint8_t) (((float) color.g - (float) background.g) * on + (float) background.g),
+                 (uint8_t) (((float) color.b - (float) background.b) * on + (float) background.b),
+                 (uint8_t) (((float) color.w - (float) background.w) * on + (float) background.w));
+  };
+  // Blended colors of the partial pixels, for up to 4 bpp they are only computed once per call
+  std::array<Color, 16> blended;
+  std::array<bool, 16> blended_set{};
   while (text[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
@@ -128,45 +249,27 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     }
 
     const Glyph &glyph = this->get_glyphs()[glyph_n];
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
-    const int max_y = y_start + scan_y1 + scan_height;
-
-    uint8_t bitmask = 0;
-    uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
-    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
-          }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
-        }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
-        }
+    auto draw = [&](const GlyphSpan &span) {
+      if (span.alpha == bpp_max) {
+        display->fill_span(x_at + span.x, y_start + span.y, span.length, color);
+        return;
+      }
+      if (span.alpha >= blended.size()) {
+        display->draw_pixel_at(x_at + span.x, y_start + span.y, blend(span.alpha));
+        return;
       }
+      if (!blended_set[span.alpha]) {
+        blended[span.alpha] = blend(span.alpha);
+        blended_set[span.alpha] = true;
+      }
+      display->draw_pixel_at(x_at + span.x, y_start + span.y, blended[span.alpha]);
+    };
+    const std::vector<GlyphSpan> *spans = this->glyph_spans_(glyph_n);
+    if (spans != nullptr) {
+      for (const auto &span : *spans)
+        draw(span);
+    } else {
+      this->decode_glyph_(glyph.glyph_data_, draw);
     }
     x_at += glyph.glyph_data_->advance;
 
@@ -7,11 +7,20 @@
 #include "esphome/components/display/display.h"
 #endif
 
+#include <array>
+#include <vector>
+
 namespace esphome {
 namespace font {
 
 class Font;
 
+/// Glyphs kept decoded per font, the least recently printed one is replaced
+static const uint8_t GLYPH_CACHE_SIZE = 16;
+/// Bytes of decoded glyphs kept per font. Least recently printed glyphs are dropped to stay below, a glyph larger
+/// than this on its own is drawn straight from the bitmap.
+static const size_t GLYPH_CACHE_BYTES = 4096;
+
 struct GlyphData {
   const uint8_t *a_char;
   const uint8_t *data;
@@ -81,6 +90,32 @@ class Font
   const std::vector<Glyph, RAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+#ifdef USE_DISPLAY
+  /// A run of fully set pixels, or a single partly set pixel when alpha is below the maximum.
+  struct GlyphSpan {
+    int16_t x;
+    int16_t y;
+    int16_t length;
+    uint8_t alpha;
+  };
+  struct CachedGlyph {
+    int glyph{-1};
+    uint32_t last_used{0};
+    std::vector<GlyphSpan> spans;
+  };
+
+  /// Calls callback with the pixels of a glyph relative to the text position.
+  template<typename F> void decode_glyph_(const GlyphData *glyph_data, F &&callback) const;
+  /// The decoded pixels of a glyph, decoded on first use. @return nullptr if the glyph is too large to keep.
+  const std::vector<GlyphSpan> *glyph_spans_(int glyph_n);
+
+  std::array<CachedGlyph, GLYPH_CACHE_SIZE> glyph_cache_{};
+  uint32_t glyph_cache_uses_{0};
+  size_t glyph_cache_bytes_{0};
+#endif
+  // Glyph of each single byte ASCII character, -1 when it has to be searched for (missing, or the first byte of a
+  // longer glyph)
+  std::array<int16_t, 128> ascii_index_{};
   std::vector<Glyph, RAMAllocator<Glyph>> glyphs_;
   int baseline_;
   int height_;
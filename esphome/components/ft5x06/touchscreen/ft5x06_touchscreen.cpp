@@ -52,25 +52,27 @@ void FT5x06Touchscreen::continue_setup_() {
 }
 
 void FT5x06Touchscreen::update_touches() {
-  uint8_t touch_cnt;
-  uint8_t data[MAX_TOUCHES][6];
+  // The touch data follows the status register, a single touch is read with the status in one transaction
+  uint8_t buffer[1 + MAX_TOUCHES * 6];
 
-  if (!this->read_byte(FT5X06_TD_STATUS, &touch_cnt) || touch_cnt > MAX_TOUCHES) {
+  if (!this->read_bytes(FT5X06_TD_STATUS, buffer, 1 + 6) || buffer[0] > MAX_TOUCHES) {
     ESP_LOGW(TAG, "Failed to read status");
     return;
   }
+  uint8_t touch_cnt = buffer[0];
   if (touch_cnt == 0)
     return;
 
-  if (!this->read_bytes(FT5X06_TOUCH_DATA, (uint8_t *) data, touch_cnt * 6)) {
+  if (touch_cnt > 1 && !this->read_bytes(FT5X06_TOUCH_DATA + 6, buffer + 1 + 6, (touch_cnt - 1) * 6)) {
     ESP_LOGW(TAG, "Failed to read touch data");
     return;
   }
   for (uint8_t i = 0; i != touch_cnt; i++) {
-    uint8_t status = data[i][0] >> 6;
-    uint8_t id = data[i][2] >> 3;
-    uint16_t x = encode_uint16(data[i][0] & 0x0F, data[i][1]);
-    uint16_t y = encode_uint16(data[i][2] & 0xF, data[i][3]);
+    const uint8_t *point = buffer + 1 + i * 6;
+    uint8_t status = point[0] >> 6;
+    uint8_t id = point[2] >> 3;
+    uint16_t x = encode_uint16(point[0] & 0x0F, point[1]);
+    uint16_t y = encode_uint16(point[2] & 0xF, point[3]);
 
     ESP_LOGD(TAG, "Read %X status, id: %d, pos %d/%d", status, id, x, y);
     if (status == 0 || status == 2) {
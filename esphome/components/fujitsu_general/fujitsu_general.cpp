@@ -79,6 +79,8 @@ const uint16_t FUJITSU_GENERAL_HEADER_SPACE = 1600;
 const uint16_t FUJITSU_GENERAL_BIT_MARK = 420;
 const uint16_t FUJITSU_GENERAL_ONE_SPACE = 1200;
 const uint16_t FUJITSU_GENERAL_ZERO_SPACE = 420;
+constexpr remote_base::PulseDistanceTimings FUJITSU_GENERAL_BIT_TIMINGS{
+    FUJITSU_GENERAL_BIT_MARK, FUJITSU_GENERAL_ONE_SPACE, FUJITSU_GENERAL_ZERO_SPACE};
 
 const uint16_t FUJITSU_GENERAL_TRL_MARK = 420;
 const uint16_t FUJITSU_GENERAL_TRL_SPACE = 8000;
@@ -212,20 +214,14 @@ void FujitsuGeneralClimate::transmit_(uint8_t const *message, uint8_t length) {
   auto *data = transmit.get_data();
 
   data->set_carrier_frequency(FUJITSU_GENERAL_CARRIER_FREQUENCY);
+  data->reserve(length * 16 + 4);
 
   // Header
   data->mark(FUJITSU_GENERAL_HEADER_MARK);
   data->space(FUJITSU_GENERAL_HEADER_SPACE);
 
   // Data
-  for (uint8_t i = 0; i < length; ++i) {
-    const uint8_t byte = message[i];
-    for (uint8_t mask = 0b00000001; mask > 0; mask <<= 1) {  // write from right to left
-      data->mark(FUJITSU_GENERAL_BIT_MARK);
-      bool bit = byte & mask;
-      data->space(bit ? FUJITSU_GENERAL_ONE_SPACE : FUJITSU_GENERAL_ZERO_SPACE);
-    }
-  }
+  data->encode_bytes(message, length, FUJITSU_GENERAL_BIT_TIMINGS);  // each byte from right to left
 
   // Footer
   data->mark(FUJITSU_GENERAL_TRL_MARK);
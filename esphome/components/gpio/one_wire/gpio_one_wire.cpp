@@ -24,7 +24,6 @@ void GPIOOneWireBus::dump_config() {
 }
 
 int HOT IRAM_ATTR GPIOOneWireBus::reset_int() {
-  InterruptLock lock;
   // See reset here:
   // https://www.maximintegrated.com/en/design/technical-documents/app-notes/1/126.html
   // Wait for communication to clear (delay G)
@@ -39,10 +38,13 @@ int HOT IRAM_ATTR GPIOOneWireBus::reset_int() {
   bool r = false;
 
   // Send 480µs LOW TX reset pulse (drive bus low, delay H)
+  // Only its minimum length matters, so interrupts may stretch it
   this->pin_.digital_write(false);
   this->pin_.pin_mode(gpio::FLAG_OUTPUT);
   delayMicroseconds(480);
 
+  // The presence pulse has to be sampled in time
+  InterruptLock lock;
   // Release the bus, delay I
   this->pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
   uint32_t start = micros();
@@ -64,9 +66,6 @@ int HOT IRAM_ATTR GPIOOneWireBus::reset_int() {
 }
 
 void HOT IRAM_ATTR GPIOOneWireBus::write_bit_(bool bit) {
-  // drive bus low
-  this->pin_.digital_write(false);
-
   // from datasheet:
   // write 0 low time: t_low0: min=60µs, max=120µs
   // write 1 low time: t_low1: min=1µs, max=15µs
@@ -76,27 +75,38 @@ void HOT IRAM_ATTR GPIOOneWireBus::write_bit_(bool bit) {
   uint32_t delay0 = bit ? 6 : 60;
   uint32_t delay1 = bit ? 64 : 10;
 
-  // delay A/C
-  delayMicroseconds(delay0);
-  // release bus
-  this->pin_.digital_write(true);
+  {
+    // Interrupts are only held off for the low time, the rest of the slot may be stretched
+    InterruptLock lock;
+    // drive bus low
+    this->pin_.digital_write(false);
+    // delay A/C
+    delayMicroseconds(delay0);
+    // release bus
+    this->pin_.digital_write(true);
+  }
   // delay B/D
   delayMicroseconds(delay1);
 }
 
 bool HOT IRAM_ATTR GPIOOneWireBus::read_bit_() {
-  // drive bus low
-  this->pin_.digital_write(false);
-
-  // datasheet says >= 1µs
-  delayMicroseconds(5);
-
-  // release bus, delay E
-  this->pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
-
-  delayMicroseconds(8);
-  // sample bus to read bit from peer
-  bool r = this->pin_.digital_read();
+  bool r;
+  {
+    // The bit has to be sampled within 15µs of the falling edge
+    InterruptLock lock;
+    // drive bus low
+    this->pin_.digital_write(false);
+
+    // datasheet says >= 1µs
+    delayMicroseconds(5);
+
+    // release bus, delay E
+    this->pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
+
+    delayMicroseconds(8);
+    // sample bus to read bit from peer
+    r = this->pin_.digital_read();
+  }
 
   // read slot is at least 60µs
   delayMicroseconds(50);
@@ -107,21 +117,18 @@ bool HOT IRAM_ATTR GPIOOneWireBus::read_bit_() {
 }
 
 void IRAM_ATTR GPIOOneWireBus::write8(uint8_t val) {
-  InterruptLock lock;
   for (uint8_t i = 0; i < 8; i++) {
     this->write_bit_(bool((1u << i) & val));
   }
 }
 
 void IRAM_ATTR GPIOOneWireBus::write64(uint64_t val) {
-  InterruptLock lock;
   for (uint8_t i = 0; i < 64; i++) {
     this->write_bit_(bool((1ULL << i) & val));
   }
 }
 
 uint8_t IRAM_ATTR GPIOOneWireBus::read8() {
-  InterruptLock lock;
   uint8_t ret = 0;
   for (uint8_t i = 0; i < 8; i++)
     ret |= (uint8_t(this->read_bit_()) << i);
@@ -129,7 +136,6 @@ uint8_t IRAM_ATTR GPIOOneWireBus::read8() {
 }
 
 uint64_t IRAM_ATTR GPIOOneWireBus::read64() {
-  InterruptLock lock;
   uint64_t ret = 0;
   for (uint8_t i = 0; i < 8; i++) {
     ret |= (uint64_t(this->read_bit_()) << i);
@@ -144,7 +150,6 @@ void GPIOOneWireBus::reset_search() {
 }
 
 uint64_t IRAM_ATTR GPIOOneWireBus::search_int() {
-  InterruptLock lock;
   if (this->last_device_flag_)
     return 0u;
 
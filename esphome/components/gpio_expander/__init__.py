@@ -0,0 +1,2 @@
+# Option of the expanders built on CachedGpioExpander that collect pin writes per loop
+CONF_WRITE_COMBINING = "write_combining"
@@ -48,7 +48,33 @@ class CachedGpioExpander {
     return this->digital_read_cache(pin);
   }
 
-  void digital_write(P pin, bool value) { this->digital_write_hw(pin, value); }
+  /// @brief Write the state of the given pin. With write combining the bank is only written by the next
+  ///        flush_writes(), so all pins of a bank set in one main loop iteration take a single bus write.
+  /// @param pin Pin number to write
+  /// @param value Pin state to write
+  void digital_write(P pin, bool value) {
+    if (!this->write_combining_) {
+      this->digital_write_hw(pin, value);
+      return;
+    }
+    this->digital_write_cache(pin, value);
+    this->write_pending_[pin / BANK_SIZE] = true;
+  }
+
+  /// @brief Collect pin writes until the next flush_writes() instead of writing each one to the bus.
+  ///        Only has an effect on components that implement digital_write_cache() and write_bank_hw().
+  void set_write_combining(bool write_combining) { this->write_combining_ = write_combining; }
+
+  /// @brief Write the banks changed since the last flush. Components call this at the start of their loop(),
+  ///        call it directly where the outputs must change at once, for example from a lambda.
+  void flush_writes() {
+    for (size_t bank = 0; bank < BANKS; bank++) {
+      if (this->write_pending_[bank]) {
+        this->write_pending_[bank] = false;
+        this->write_bank_hw(bank);
+      }
+    }
+  }
 
  protected:
   /// @brief Read GPIO bank from hardware into internal state
@@ -68,6 +94,15 @@ class CachedGpioExpander {
   /// @param value Pin state to write (true = HIGH, false = LOW)
   virtual void digital_write_hw(P pin, bool value) = 0;
 
+  /// @brief Set the pin state in internal state without writing it, used with write combining
+  /// @param pin Pin number to write
+  /// @param value Pin state to write (true = HIGH, false = LOW)
+  virtual void digital_write_cache(P pin, bool value) { this->digital_write_hw(pin, value); }
+
+  /// @brief Write the internal output state of a bank to hardware, used with write combining
+  /// @param bank Bank number to write
+  virtual void write_bank_hw(P bank) {}
+
   /// @brief Invalidate cache. This function should be called in component loop().
   void reset_pin_cache_() { memset(this->read_cache_valid_, 0x00, CACHE_SIZE_BYTES); }
 
@@ -77,6 +112,8 @@ class CachedGpioExpander {
   static constexpr size_t CACHE_SIZE_BYTES = BANKS * sizeof(T);
 
   T read_cache_valid_[BANKS]{0};
+  bool write_pending_[BANKS]{false};
+  bool write_combining_{false};
 };
 
 }  // namespace esphome::gpio_expander
@@ -15,9 +15,34 @@ static const char *const TAGL = "graphlegend";
 void HistoryData::init(int length) {
   this->length_ = length;
   this->samples_.resize(length, NAN);
+  const int buckets = (length + BUCKET_SIZE - 1) / BUCKET_SIZE;
+  this->bucket_min_.resize(buckets, NAN);
+  this->bucket_max_.resize(buckets, NAN);
   this->last_sample_ = millis();
 }
 
+void HistoryData::write_sample_(float data) {
+  const int bucket = this->count_ / BUCKET_SIZE;
+  float &bucket_min = this->bucket_min_[bucket];
+  float &bucket_max = this->bucket_max_[bucket];
+  const float old = this->samples_[this->count_];
+  this->samples_[this->count_] = data;
+  if (std::isnan(old) || (old > bucket_min && old < bucket_max)) {
+    // The replaced sample did not bound the bucket, folding in the new one is enough
+    bucket_min = std::fmin(bucket_min, data);
+    bucket_max = std::fmax(bucket_max, data);
+    return;
+  }
+  const int start = bucket * BUCKET_SIZE;
+  const int end = std::min(start + BUCKET_SIZE, this->length_);
+  bucket_min = NAN;
+  bucket_max = NAN;
+  for (int i = start; i < end; i++) {
+    bucket_min = std::fmin(bucket_min, this->samples_[i]);
+    bucket_max = std::fmax(bucket_max, this->samples_[i]);
+  }
+}
+
 void HistoryData::take_sample(float data) {
   uint32_t tm = millis();
   uint32_t dt = tm - last_sample_;
@@ -26,22 +51,18 @@ void HistoryData::take_sample(float data) {
   // Step data based on time
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
+    this->write_sample_(data);
     this->period_ -= this->update_time_;
     this->count_ = (this->count_ + 1) % this->length_;
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
   if (!std::isnan(data)) {
-    // Recalc recent max/min
+    // Recalc recent max/min from the buckets, fmin/fmax skip the empty ones
     this->recent_min_ = data;
     this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
+    for (size_t i = 0; i < this->bucket_min_.size(); i++) {
+      this->recent_min_ = std::fmin(this->recent_min_, this->bucket_min_[i]);
+      this->recent_max_ = std::fmax(this->recent_max_, this->bucket_max_[i]);
     }
   }
 }
@@ -178,26 +199,23 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
         bool b = (trace->get_line_type() & bit) == bit;
         if (b) {
           int16_t y = (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - thick / 2 + y_offset;
-          auto draw_pixel_at = [&buff, c, y_offset, this](int16_t x, int16_t y) {
-            if (y >= y_offset && static_cast<uint32_t>(y) < y_offset + this->height_)
-              buff->draw_pixel_at(x, y, c);
+          // Draws the rows [top, bottom) of column x clipped to the graph as one run
+          auto draw_run = [&buff, c, y_offset, this](int16_t x, int top, int bottom) {
+            top = std::max<int>(top, y_offset);
+            bottom = std::min<int>(bottom, y_offset + this->height_);
+            if (top < bottom)
+              buff->vertical_line(x, top, bottom - top, c);
           };
           if (!continuous || !has_prev || !prev_b || (abs(y - prev_y) <= thick)) {
-            for (int16_t t = 0; t < thick; t++) {
-              draw_pixel_at(x, y + t);
-            }
+            draw_run(x, y, y + thick);
           } else {
             int16_t mid_y = (y + prev_y + thick) / 2;
             if (y > prev_y) {
-              for (int16_t t = prev_y + thick; t <= mid_y; t++)
-                draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y + 1; t < y + thick; t++)
-                draw_pixel_at(x, t);
+              draw_run(x + 1, prev_y + thick, mid_y + 1);
+              draw_run(x, mid_y + 1, y + thick);
             } else {
-              for (int16_t t = prev_y - 1; t >= mid_y; t--)
-                draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y - 1; t >= y; t--)
-                draw_pixel_at(x, t);
+              draw_run(x + 1, mid_y, prev_y);
+              draw_run(x, y, mid_y);
             }
           }
           prev_y = y;
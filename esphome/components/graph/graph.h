@@ -95,6 +95,12 @@ class HistoryData {
   float get_recent_min() const { return recent_min_; }
 
  protected:
+  /// Samples summarized by one entry of bucket_min_ and bucket_max_
+  static constexpr int BUCKET_SIZE = 16;
+
+  /// Store a sample at the write position and keep the min/max of its bucket current.
+  void write_sample_(float data);
+
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
@@ -103,6 +109,9 @@ class HistoryData {
   float recent_min_{NAN};
   float recent_max_{NAN};
   std::vector<float> samples_;
+  // Min and max of every BUCKET_SIZE samples ignoring NAN, so the recent min/max never rescan the whole history
+  std::vector<float> bucket_min_;
+  std::vector<float> bucket_max_;
 };
 
 class GraphTrace {
@@ -12,7 +12,6 @@ static const uint8_t PRIMARY_ADDRESS = 0x5D;    // default I2C address for GT911
 static const uint8_t SECONDARY_ADDRESS = 0x14;  // secondary I2C address for GT911
 static const uint8_t GET_TOUCH_STATE[2] = {0x81, 0x4E};
 static const uint8_t CLEAR_TOUCH_STATE[3] = {0x81, 0x4E, 0x00};
-static const uint8_t GET_TOUCHES[2] = {0x81, 0x4F};
 static const uint8_t GET_SWITCHES[2] = {0x80, 0x4D};
 static const uint8_t GET_MAX_VALUES[2] = {0x80, 0x48};
 static const size_t MAX_TOUCHES = 5;  // max number of possible touches reported
@@ -97,35 +96,46 @@ void GT911Touchscreen::update_touches() {
     return;
   }
 
-  i2c::ErrorCode err;
-  uint8_t touch_state = 0;
-  uint8_t data[MAX_TOUCHES + 1][8];  // 8 bytes each for each point, plus extra space for the key byte
+  // The status byte, 8 bytes for each point and the key byte follow each other. The first read also covers a single
+  // touch, the most common case, so it needs one transaction.
+  uint8_t data[1 + MAX_TOUCHES * 8 + 1];
+  static const size_t FIRST_READ_SIZE = 1 + 8 + 1;
 
-  err = this->write(GET_TOUCH_STATE, sizeof(GET_TOUCH_STATE));
+  i2c::ErrorCode err = this->write(GET_TOUCH_STATE, sizeof(GET_TOUCH_STATE));
   ERROR_CHECK(err);
-  err = this->read(&touch_state, 1);
+  err = this->read(data, FIRST_READ_SIZE);
   ERROR_CHECK(err);
-  this->write(CLEAR_TOUCH_STATE, sizeof(CLEAR_TOUCH_STATE));
+  uint8_t touch_state = data[0];
   uint8_t num_of_touches = touch_state & 0x07;
 
-  if ((touch_state & 0x80) == 0 || num_of_touches > MAX_TOUCHES) {
+  if ((touch_state & 0x80) == 0) {
+    return;
+  }
+  if (num_of_touches > MAX_TOUCHES) {
+    this->write(CLEAR_TOUCH_STATE, sizeof(CLEAR_TOUCH_STATE));
     return;
   }
 
-  err = this->write(GET_TOUCHES, sizeof(GET_TOUCHES));
-  ERROR_CHECK(err);
-  // num_of_touches is guaranteed to be 0..5. Also read the key data
-  err = this->read(data[0], sizeof(data[0]) * num_of_touches + 1);
-  ERROR_CHECK(err);
+  if (num_of_touches > 1) {
+    // num_of_touches is guaranteed to be 2..5, read the other points and the key byte
+    const uint16_t reg = encode_uint16(GET_TOUCH_STATE[0], GET_TOUCH_STATE[1]) + FIRST_READ_SIZE;
+    const uint8_t get_rest[2] = {static_cast<uint8_t>(reg >> 8), static_cast<uint8_t>(reg)};
+    err = this->write(get_rest, sizeof(get_rest));
+    ERROR_CHECK(err);
+    err = this->read(data + FIRST_READ_SIZE, (num_of_touches - 1) * 8);
+    ERROR_CHECK(err);
+  }
+  this->write(CLEAR_TOUCH_STATE, sizeof(CLEAR_TOUCH_STATE));
 
   this->skip_update_ = false;  // All error checks passed, send touch events
   for (uint8_t i = 0; i != num_of_touches; i++) {
-    uint16_t id = data[i][0];
-    uint16_t x = encode_uint16(data[i][2], data[i][1]);
-    uint16_t y = encode_uint16(data[i][4], data[i][3]);
+    const uint8_t *point = data + 1 + i * 8;
+    uint16_t id = point[0];
+    uint16_t x = encode_uint16(point[2], point[1]);
+    uint16_t y = encode_uint16(point[4], point[3]);
     this->add_raw_touch_position_(id, x, y);
   }
-  auto keys = data[num_of_touches][0] & ((1 << MAX_BUTTONS) - 1);
+  auto keys = data[1 + num_of_touches * 8] & ((1 << MAX_BUTTONS) - 1);
   if (keys != this->button_state_) {
     this->button_state_ = keys;
     for (size_t i = 0; i != MAX_BUTTONS; i++) {
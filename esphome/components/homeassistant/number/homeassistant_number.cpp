@@ -9,8 +9,7 @@ namespace homeassistant {
 
 static const char *const TAG = "homeassistant.number";
 
-void HomeassistantNumber::state_changed_(const std::string &state) {
-  auto number_value = parse_number<float>(state);
+void HomeassistantNumber::state_changed_(const std::string &state, optional<float> number_value) {
   if (!number_value.has_value()) {
     ESP_LOGW(TAG, "'%s': Can't convert '%s' to number!", this->entity_id_.c_str(), state.c_str());
     this->publish_state(NAN);
@@ -54,8 +53,9 @@ void HomeassistantNumber::step_retrieved_(const std::string &step) {
 }
 
 void HomeassistantNumber::setup() {
-  api::global_api_server->subscribe_home_assistant_state(
-      this->entity_id_, nullopt, std::bind(&HomeassistantNumber::state_changed_, this, std::placeholders::_1));
+  api::global_api_server->subscribe_home_assistant_number(
+      this->entity_id_, nullopt,
+      std::bind(&HomeassistantNumber::state_changed_, this, std::placeholders::_1, std::placeholders::_2));
 
   api::global_api_server->get_home_assistant_state(
       this->entity_id_, optional<std::string>("min"),
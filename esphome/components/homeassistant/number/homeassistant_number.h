@@ -18,7 +18,7 @@ class HomeassistantNumber : public number::Number, public Component {
   float get_setup_priority() const override;
 
  protected:
-  void state_changed_(const std::string &state);
+  void state_changed_(const std::string &state, optional<float> number_value);
   void min_retrieved_(const std::string &min);
   void max_retrieved_(const std::string &max);
   void step_retrieved_(const std::string &step);
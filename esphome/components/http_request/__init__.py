@@ -52,6 +52,8 @@ CONF_REDIRECT_LIMIT = "redirect_limit"
 CONF_BUFFER_SIZE_RX = "buffer_size_rx"
 CONF_BUFFER_SIZE_TX = "buffer_size_tx"
 CONF_CA_CERTIFICATE_PATH = "ca_certificate_path"
+CONF_MAX_IDLE_CONNECTIONS = "max_idle_connections"
+CONF_IDLE_TIMEOUT = "idle_timeout"
 
 CONF_MAX_RESPONSE_BUFFER_SIZE = "max_response_buffer_size"
 CONF_HEADERS = "headers"
@@ -128,6 +130,12 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_BUFFER_SIZE_TX, esp32_idf=512): cv.All(
                 cv.uint16_t, cv.only_with_esp_idf
             ),
+            cv.SplitDefault(CONF_MAX_IDLE_CONNECTIONS, esp32_idf=0): cv.All(
+                cv.int_range(min=0, max=4), cv.only_with_esp_idf
+            ),
+            cv.SplitDefault(CONF_IDLE_TIMEOUT, esp32_idf="30s"): cv.All(
+                cv.positive_time_period_milliseconds, cv.only_with_esp_idf
+            ),
             cv.Optional(CONF_CA_CERTIFICATE_PATH): cv.All(
                 cv.file_,
                 cv.only_on(PLATFORM_HOST),
@@ -162,6 +170,13 @@ async def to_code(config):
         if CORE.using_esp_idf:
             cg.add(var.set_buffer_size_rx(config[CONF_BUFFER_SIZE_RX]))
             cg.add(var.set_buffer_size_tx(config[CONF_BUFFER_SIZE_TX]))
+            cg.add(var.set_max_idle_connections(config[CONF_MAX_IDLE_CONNECTIONS]))
+            cg.add(var.set_idle_timeout(config[CONF_IDLE_TIMEOUT]))
+            if config[CONF_MAX_IDLE_CONNECTIONS] > 0:
+                # Reconnects of pooled clients resume the TLS session
+                esp32.add_idf_sdkconfig_option(
+                    "CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS", True
+                )
 
             esp32.add_idf_sdkconfig_option(
                 "CONFIG_MBEDTLS_CERTIFICATE_BUNDLE",
@@ -20,6 +20,29 @@ void HttpRequestComponent::dump_config() {
   if (this->watchdog_timeout_ > 0) {
     ESP_LOGCONFIG(TAG, "  Watchdog Timeout: %" PRIu32 "ms", this->watchdog_timeout_);
   }
+  if (this->max_idle_connections_ > 0) {
+    ESP_LOGCONFIG(TAG,
+                  "  Max idle connections: %u\n"
+                  "  Idle timeout: %" PRIu32 "ms",
+                  this->max_idle_connections_, this->idle_timeout_);
+  }
+}
+
+std::string HttpRequestComponent::url_origin(const std::string &url) {
+  size_t scheme_end = url.find("://");
+  size_t host_start = scheme_end == std::string::npos ? 0 : scheme_end + 3;
+  size_t host_end = url.find_first_of("/?#", host_start);
+  return str_lower_case(url.substr(0, host_end));
+}
+
+void HttpRequestComponent::record_connection_(bool reused) {
+  if (reused) {
+    this->connections_reused_++;
+  } else {
+    this->connections_opened_++;
+  }
+  ESP_LOGV(TAG, "%s connection, %" PRIu32 " of %" PRIu32 " requests reused a connection", reused ? "Reused" : "New",
+           this->connections_reused_, this->connections_reused_ + this->connections_opened_);
 }
 
 std::string HttpContainer::get_response_header(const std::string &header_name) {
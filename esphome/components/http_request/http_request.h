@@ -129,6 +129,13 @@ class HttpRequestComponent : public Component {
   uint32_t get_watchdog_timeout() const { return this->watchdog_timeout_; }
   void set_follow_redirects(bool follow_redirects) { this->follow_redirects_ = follow_redirects; }
   void set_redirect_limit(uint16_t limit) { this->redirect_limit_ = limit; }
+  void set_max_idle_connections(uint8_t max_idle_connections) { this->max_idle_connections_ = max_idle_connections; }
+  void set_idle_timeout(uint32_t idle_timeout) { this->idle_timeout_ = idle_timeout; }
+
+  /// Requests sent on a kept-alive connection, out of all requests that got a response since boot.
+  uint32_t get_connections_reused() const { return this->connections_reused_; }
+  /// Requests that had to open a new connection.
+  uint32_t get_connections_opened() const { return this->connections_opened_; }
 
   std::shared_ptr<HttpContainer> get(const std::string &url) { return this->start(url, "GET", "", {}); }
   std::shared_ptr<HttpContainer> get(const std::string &url, const std::list<Header> &request_headers) {
@@ -170,11 +177,20 @@ class HttpRequestComponent : public Component {
   virtual std::shared_ptr<HttpContainer> perform(const std::string &url, const std::string &method,
                                                  const std::string &body, const std::list<Header> &request_headers,
                                                  std::set<std::string> collect_headers) = 0;
+  /// Scheme, host and port of the url, an idle connection is only reused for the same origin.
+  static std::string url_origin(const std::string &url);
+  void record_connection_(bool reused);
+
   const char *useragent_{nullptr};
   bool follow_redirects_{};
   uint16_t redirect_limit_{};
   uint16_t timeout_{4500};
   uint32_t watchdog_timeout_{0};
+  // Idle connections kept open for reuse, 0 closes every connection after its request
+  uint8_t max_idle_connections_{0};
+  uint32_t idle_timeout_{30000};
+  uint32_t connections_reused_{0};
+  uint32_t connections_opened_{0};
 };
 
 template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
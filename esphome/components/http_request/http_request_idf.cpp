@@ -22,8 +22,19 @@ static const char *const TAG = "http_request.idf";
 struct UserData {
   const std::set<std::string> &collect_headers;
   std::map<std::string, std::list<std::string>> response_headers;
+  // A response that can leave its connection open carries Content-Length or Transfer-Encoding, so any reply on a
+  // kept-alive connection sets this
+  bool header_received{false};
 };
 
+void HttpRequestIDF::setup() {
+  if (this->max_idle_connections_ > 0) {
+    this->set_interval("close_idle", this->idle_timeout_, [this]() { this->close_idle_clients_(false); });
+  }
+}
+
+void HttpRequestIDF::on_shutdown() { this->close_idle_clients_(true); }
+
 void HttpRequestIDF::dump_config() {
   HttpRequestComponent::dump_config();
   ESP_LOGCONFIG(TAG,
@@ -37,6 +48,7 @@ esp_err_t HttpRequestIDF::http_event_handler(esp_http_client_event_t *evt) {
 
   switch (evt->event_id) {
     case HTTP_EVENT_ON_HEADER: {
+      user_data->header_received = true;
       const std::string header_name = str_lower_case(evt->header_key);
       if (user_data->collect_headers.count(header_name)) {
         const std::string header_value = evt->header_value;
@@ -106,42 +118,62 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(const std::string &url, c
   watchdog::WatchdogManager wdm(this->get_watchdog_timeout());
 
   config.event_handler = http_event_handler;
-  auto user_data = UserData{collect_headers, {}};
+  auto user_data = UserData{collect_headers, {}, false};
   config.user_data = static_cast<void *>(&user_data);
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+  // Lets a pooled client that has to reconnect resume its TLS session instead of doing a full handshake
+  config.save_client_session = this->max_idle_connections_ > 0;
+#endif
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+  std::string origin = url_origin(url);
+  std::vector<std::string> header_names;
+  esp_http_client_handle_t client = nullptr;
+  if (this->max_idle_connections_ > 0)
+    client = this->take_idle_client_(origin, header_names);
+  bool reused = client != nullptr;
+  if (reused) {
+    // Reset what the previous request left on the client, the connection survives a URL on the same host
+    for (const auto &name : header_names)
+      esp_http_client_delete_header(client, name.c_str());
+    esp_http_client_set_url(client, url.c_str());
+    esp_http_client_set_method(client, method_idf);
+    esp_http_client_set_timeout_ms(client, this->timeout_);
+    esp_http_client_set_user_data(client, config.user_data);
+  } else {
+    client = esp_http_client_init(&config);
+  }
 
   std::shared_ptr<HttpContainerIDF> container = std::make_shared<HttpContainerIDF>(client);
   container->set_parent(this);
 
   container->set_secure(secure);
 
+  header_names.clear();
   for (const auto &header : request_headers) {
     esp_http_client_set_header(client, header.name.c_str(), header.value.c_str());
+    header_names.push_back(header.name);
   }
 
-  const int body_len = body.length();
-
-  esp_err_t err = esp_http_client_open(client, body_len);
-  if (err != ESP_OK) {
-    this->status_momentary_error("failed", 1000);
-    ESP_LOGE(TAG, "HTTP Request failed: %s", esp_err_to_name(err));
-    esp_http_client_cleanup(client);
-    return nullptr;
-  }
-
-  if (body_len > 0) {
-    int write_left = body_len;
-    int write_index = 0;
-    const char *buf = body.c_str();
-    while (write_left > 0) {
-      int written = esp_http_client_write(client, buf + write_index, write_left);
-      if (written < 0) {
-        err = ESP_FAIL;
-        break;
-      }
-      write_left -= written;
-      write_index += written;
+  esp_err_t err = this->send_request_(client, body);
+  container->feed_wdt();
+  // -1 is also the length of a chunked response, only the missing headers tell that no reply came
+  int64_t content_length = err == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+  container->feed_wdt();
+  if (reused && (err != ESP_OK || !user_data.header_received)) {
+    // The server closed the idle connection. A request that was not fully sent is safe to repeat, one that was sent
+    // may have been processed, so only idempotent methods go out again.
+    const bool idempotent = method_idf != HTTP_METHOD_POST && method_idf != HTTP_METHOD_PATCH;
+    esp_http_client_close(client);
+    reused = false;
+    if (err != ESP_OK || idempotent) {
+      ESP_LOGV(TAG, "Kept-alive connection lost, reconnecting");
+      err = this->send_request_(client, body);
+      container->feed_wdt();
+      content_length = err == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+      container->feed_wdt();
+    } else {
+      ESP_LOGW(TAG, "Kept-alive connection lost after sending the %s request, not sending it again", method.c_str());
+      err = ESP_FAIL;
     }
   }
 
@@ -151,10 +183,15 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(const std::string &url, c
     esp_http_client_cleanup(client);
     return nullptr;
   }
+  this->record_connection_(reused);
+  if (this->max_idle_connections_ > 0) {
+    container->pool_ = this;
+    container->origin_ = std::move(origin);
+    container->header_names_ = std::move(header_names);
+    container->reusable_ = true;
+  }
 
-  container->feed_wdt();
-  container->content_length = esp_http_client_fetch_headers(client);
-  container->feed_wdt();
+  container->content_length = content_length;
   container->status_code = esp_http_client_get_status_code(client);
   container->feed_wdt();
   container->set_response_headers(user_data.response_headers);
@@ -166,6 +203,8 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(const std::string &url, c
   if (this->follow_redirects_) {
     auto num_redirects = this->redirect_limit_;
     while (is_redirect(container->status_code) && num_redirects > 0) {
+      // The redirect may lead to another host, the connection no longer matches the origin
+      container->reusable_ = false;
       err = esp_http_client_set_redirection(client);
       if (err != ESP_OK) {
         ESP_LOGE(TAG, "esp_http_client_set_redirection failed: %s", esp_err_to_name(err));
@@ -234,10 +273,72 @@ int HttpContainerIDF::read(uint8_t *buf, size_t max_len) {
 void HttpContainerIDF::end() {
   watchdog::WatchdogManager wdm(this->parent_->get_watchdog_timeout());
 
+  // The connection can only carry the next request once this response has been read to the end
+  if (this->reusable_ && esp_http_client_flush_response(this->client_, nullptr) == ESP_OK &&
+      esp_http_client_is_complete_data_received(this->client_)) {
+    this->pool_->release_client_(this);
+    return;
+  }
   esp_http_client_close(this->client_);
   esp_http_client_cleanup(this->client_);
 }
 
+esp_err_t HttpRequestIDF::send_request_(esp_http_client_handle_t client, const std::string &body) {
+  const int body_len = body.length();
+  esp_err_t err = esp_http_client_open(client, body_len);
+  if (err != ESP_OK)
+    return err;
+
+  int write_left = body_len;
+  int write_index = 0;
+  const char *buf = body.c_str();
+  while (write_left > 0) {
+    int written = esp_http_client_write(client, buf + write_index, write_left);
+    if (written < 0)
+      return ESP_FAIL;
+    write_left -= written;
+    write_index += written;
+  }
+  return ESP_OK;
+}
+
+esp_http_client_handle_t HttpRequestIDF::take_idle_client_(const std::string &origin,
+                                                           std::vector<std::string> &header_names) {
+  LockGuard guard(this->pool_lock_);
+  for (auto it = this->idle_clients_.begin(); it != this->idle_clients_.end(); ++it) {
+    if (it->origin == origin && millis() - it->idle_since <= this->idle_timeout_) {
+      esp_http_client_handle_t client = it->client;
+      header_names = std::move(it->header_names);
+      this->idle_clients_.erase(it);
+      return client;
+    }
+  }
+  return nullptr;
+}
+
+void HttpRequestIDF::release_client_(HttpContainerIDF *container) {
+  LockGuard guard(this->pool_lock_);
+  if (this->idle_clients_.size() >= this->max_idle_connections_) {
+    esp_http_client_cleanup(this->idle_clients_.front().client);
+    this->idle_clients_.erase(this->idle_clients_.begin());
+  }
+  this->idle_clients_.push_back(
+      {std::move(container->origin_), container->client_, std::move(container->header_names_), millis()});
+}
+
+void HttpRequestIDF::close_idle_clients_(bool all) {
+  LockGuard guard(this->pool_lock_);
+  const uint32_t now = millis();
+  for (auto it = this->idle_clients_.begin(); it != this->idle_clients_.end();) {
+    if (all || now - it->idle_since > this->idle_timeout_) {
+      esp_http_client_cleanup(it->client);
+      it = this->idle_clients_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void HttpContainerIDF::feed_wdt() {
   // Tests to see if the executing task has a watchdog timer attached
   if (esp_task_wdt_status(nullptr) == ESP_OK) {
@@ -12,6 +12,7 @@
 namespace esphome {
 namespace http_request {
 
+class HttpRequestIDF;
 class HttpContainerIDF : public HttpContainer {
  public:
   HttpContainerIDF(esp_http_client_handle_t client) : client_(client) {}
@@ -26,11 +27,19 @@ class HttpContainerIDF : public HttpContainer {
   }
 
  protected:
+  friend class HttpRequestIDF;
   esp_http_client_handle_t client_;
+  HttpRequestIDF *pool_{nullptr};
+  // Where the client is connected and the request headers set on it, kept with it when it goes back to the pool
+  std::string origin_;
+  std::vector<std::string> header_names_;
+  bool reusable_{false};
 };
 
 class HttpRequestIDF : public HttpRequestComponent {
  public:
+  void setup() override;
+  void on_shutdown() override;
   void dump_config() override;
 
   void set_buffer_size_rx(uint16_t buffer_size_rx) { this->buffer_size_rx_ = buffer_size_rx; }
@@ -46,6 +55,24 @@ class HttpRequestIDF : public HttpRequestComponent {
 
   /// @brief Monitors the http client events to gather response headers
   static esp_err_t http_event_handler(esp_http_client_event_t *evt);
+
+  friend class HttpContainerIDF;
+  struct IdleClient {
+    std::string origin;
+    esp_http_client_handle_t client;
+    std::vector<std::string> header_names;
+    uint32_t idle_since;
+  };
+  /// Take a connected client for the origin out of the pool, nullptr if there is none.
+  esp_http_client_handle_t take_idle_client_(const std::string &origin, std::vector<std::string> &header_names);
+  /// Keep the client of a finished request connected, closing the longest idle one if the pool is full.
+  void release_client_(HttpContainerIDF *container);
+  void close_idle_clients_(bool all);
+  esp_err_t send_request_(esp_http_client_handle_t client, const std::string &body);
+
+  // Guards idle_clients_, requests may also come from the update task
+  Mutex pool_lock_;
+  std::vector<IdleClient> idle_clients_;
 };
 
 }  // namespace http_request
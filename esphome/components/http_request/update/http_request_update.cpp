@@ -20,6 +20,11 @@ static const char *const TAG = "http_request.update";
 
 static const size_t MAX_READ_SIZE = 256;
 
+static const char *const ETAG_HEADER_NAME = "etag";
+static const char *const IF_NONE_MATCH_HEADER_NAME = "if-none-match";
+static const char *const LAST_MODIFIED_HEADER_NAME = "last-modified";
+static const char *const IF_MODIFIED_SINCE_HEADER_NAME = "if-modified-since";
+
 void HttpRequestUpdate::setup() {
   this->ota_parent_->add_on_state_callback([this](ota::OTAState state, float progress, uint8_t err) {
     if (state == ota::OTAState::OTA_IN_PROGRESS) {
@@ -46,7 +51,22 @@ void HttpRequestUpdate::update() {
 void HttpRequestUpdate::update_task(void *params) {
   HttpRequestUpdate *this_update = (HttpRequestUpdate *) params;
 
-  auto container = this_update->request_parent_->get(this_update->source_url_);
+  std::list<Header> headers;
+  if (!this_update->etag_.empty())
+    headers.push_back(Header{IF_NONE_MATCH_HEADER_NAME, this_update->etag_});
+  if (!this_update->last_modified_.empty())
+    headers.push_back(Header{IF_MODIFIED_SINCE_HEADER_NAME, this_update->last_modified_});
+  auto container = this_update->request_parent_->get(this_update->source_url_, headers,
+                                                     {ETAG_HEADER_NAME, LAST_MODIFIED_HEADER_NAME});
+
+  if (container != nullptr && container->status_code == HTTP_STATUS_NOT_MODIFIED) {
+    // Same manifest as the last check, the published state is still right
+    ESP_LOGD(TAG, "Manifest not modified");
+    container->end();
+    container.reset();
+    this_update->defer([this_update]() { this_update->status_clear_error(); });
+    UPDATE_RETURN;
+  }
 
   if (container == nullptr || container->status_code != HTTP_STATUS_OK) {
     std::string msg = str_sprintf("Failed to fetch manifest from %s", this_update->source_url_.c_str());
@@ -75,6 +95,8 @@ void HttpRequestUpdate::update_task(void *params) {
   }
 
   bool valid = false;
+  std::string etag = container->get_response_header(ETAG_HEADER_NAME);
+  std::string last_modified = container->get_response_header(LAST_MODIFIED_HEADER_NAME);
   {  // Ensures the response string falls out of scope and deallocates before the task ends
     std::string response((char *) data, read_index);
     allocator.deallocate(data, container->content_length);
@@ -121,12 +143,18 @@ void HttpRequestUpdate::update_task(void *params) {
   }
 
   if (!valid) {
+    // Fetch it in full again next time
+    this_update->etag_.clear();
+    this_update->last_modified_.clear();
     std::string msg = str_sprintf("Failed to parse JSON from %s", this_update->source_url_.c_str());
     // Defer to main loop to avoid race condition on component_state_ read-modify-write
     this_update->defer([this_update, msg]() { this_update->status_set_error(msg.c_str()); });
     UPDATE_RETURN;
   }
 
+  this_update->etag_ = std::move(etag);
+  this_update->last_modified_ = std::move(last_modified);
+
   // Merge source_url_ and this_update->update_info_.firmware_url
   if (this_update->update_info_.firmware_url.find("http") == std::string::npos) {
     std::string path = this_update->update_info_.firmware_url;
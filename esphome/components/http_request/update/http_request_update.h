@@ -33,6 +33,9 @@ class HttpRequestUpdate : public update::UpdateEntity, public PollingComponent {
   HttpRequestComponent *request_parent_;
   OtaHttpRequestComponent *ota_parent_;
   std::string source_url_;
+  // Validators of the last manifest that parsed, so an unchanged one is answered with 304 Not Modified
+  std::string etag_;
+  std::string last_modified_;
 
   static void update_task(void *params);
 #ifdef USE_ESP32
@@ -7,6 +7,9 @@ namespace hx711 {
 
 static const char *const TAG = "hx711";
 
+// Longest time to wait for a conversion: the 400 ms settling time at the slowest rate of 10 SPS, with some margin
+static const uint32_t DATA_READY_TIMEOUT_MS = 500;
+
 void HX711Sensor::setup() {
   this->sck_pin_->setup();
   this->dout_pin_->setup();
@@ -24,6 +27,27 @@ void HX711Sensor::dump_config() {
 }
 float HX711Sensor::get_setup_priority() const { return setup_priority::DATA; }
 void HX711Sensor::update() {
+  // The conversion is read once it is ready instead of failing when update() runs in the middle of one
+  this->read_pending_ = true;
+  this->read_requested_at_ = millis();
+  this->enable_loop();
+}
+void HX711Sensor::loop() {
+  if (!this->read_pending_) {
+    this->disable_loop();
+    return;
+  }
+  // DOUT goes low when a conversion is ready
+  if (this->dout_pin_->digital_read()) {
+    if (millis() - this->read_requested_at_ < DATA_READY_TIMEOUT_MS)
+      return;
+    ESP_LOGW(TAG, "HX711 is not ready for new measurements yet!");
+    this->status_set_warning();
+    this->read_pending_ = false;
+    return;
+  }
+  this->read_pending_ = false;
+
   uint32_t result;
   if (this->read_sensor_(&result)) {
     int32_t value = static_cast<int32_t>(result);
@@ -31,6 +55,16 @@ void HX711Sensor::update() {
     this->publish_state(value);
   }
 }
+bool HX711Sensor::clock_pulse_() {
+  // Only the high phase is timed: SCK high for more than 60 us powers the HX711 down. The low phase can be stretched
+  // freely, so interrupts are held off for a single pulse instead of the whole read.
+  InterruptLock lock;
+  this->sck_pin_->digital_write(true);
+  delayMicroseconds(1);
+  bool dout = this->dout_pin_->digital_read();
+  this->sck_pin_->digital_write(false);
+  return dout;
+}
 bool HX711Sensor::read_sensor_(uint32_t *result) {
   if (this->dout_pin_->digital_read()) {
     ESP_LOGW(TAG, "HX711 is not ready for new measurements yet!");
@@ -39,27 +73,17 @@ bool HX711Sensor::read_sensor_(uint32_t *result) {
   }
 
   uint32_t data = 0;
-  bool final_dout;
-
-  {
-    InterruptLock lock;
-    for (uint8_t i = 0; i < 24; i++) {
-      this->sck_pin_->digital_write(true);
-      delayMicroseconds(1);
-      data |= uint32_t(this->dout_pin_->digital_read()) << (23 - i);
-      this->sck_pin_->digital_write(false);
-      delayMicroseconds(1);
-    }
+  for (uint8_t i = 0; i < 24; i++) {
+    data = (data << 1) | uint32_t(this->clock_pulse_());
+    delayMicroseconds(1);
+  }
 
-    // Cycle clock pin for gain setting
-    for (uint8_t i = 0; i < static_cast<uint8_t>(this->gain_); i++) {
-      this->sck_pin_->digital_write(true);
-      delayMicroseconds(1);
-      this->sck_pin_->digital_write(false);
-      delayMicroseconds(1);
-    }
-    final_dout = this->dout_pin_->digital_read();
+  // Cycle clock pin for gain setting
+  for (uint8_t i = 0; i < static_cast<uint8_t>(this->gain_); i++) {
+    this->clock_pulse_();
+    delayMicroseconds(1);
   }
+  bool final_dout = this->dout_pin_->digital_read();
 
   if (!final_dout) {
     ESP_LOGW(TAG, "HX711 DOUT pin not high after reading (data 0x%" PRIx32 ")!", data);
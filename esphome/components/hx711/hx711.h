@@ -25,13 +25,19 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
+  void loop() override;
 
  protected:
   bool read_sensor_(uint32_t *result);
+  /// Sends one clock pulse and returns the DOUT level sampled while SCK is high.
+  bool clock_pulse_();
 
   GPIOPin *dout_pin_;
   GPIOPin *sck_pin_;
   HX711Gain gain_{HX711_GAIN_128};
+  // Set by update(), loop() reads the conversion once DOUT signals it is ready
+  bool read_pending_{false};
+  uint32_t read_requested_at_{0};
 };
 
 }  // namespace hx711
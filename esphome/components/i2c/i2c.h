@@ -195,6 +195,26 @@ class I2CDevice {
     return bus_->write_readv(this->address_, write_data, write_len, read_data, read_len);
   }
 
+  /// @brief reads an array of bytes from a specific register in the I²C device without blocking the main loop
+  /// @param a_register an 8 bits internal address of the I²C register to read from
+  /// @param data pointer to an array to store the bytes, it must stay valid until the callback ran
+  /// @param len length of the buffer = number of bytes to read
+  /// @param callback called from the main loop with the i2c::ErrorCode, see I2CBus::write_readv_async()
+  void read_register_async(uint8_t a_register, uint8_t *data, size_t len, I2CTransactionCallback &&callback) {
+    bus_->write_readv_async(this->address_, &a_register, 1, data, len, std::move(callback));
+  }
+
+  /// @brief writes an array of bytes to a device, then reads an array, without blocking the main loop
+  /// @param write_data pointer to an array that contains the bytes to send, at most I2C_ASYNC_MAX_WRITE bytes
+  /// @param write_len length of the buffer = number of bytes to write
+  /// @param read_data pointer to an array to store the bytes read, it must stay valid until the callback ran
+  /// @param read_len length of the buffer = number of bytes to read
+  /// @param callback called from the main loop with the i2c::ErrorCode, see I2CBus::write_readv_async()
+  void write_read_async(const uint8_t *write_data, size_t write_len, uint8_t *read_data, size_t read_len,
+                        I2CTransactionCallback &&callback) {
+    bus_->write_readv_async(this->address_, write_data, write_len, read_data, read_len, std::move(callback));
+  }
+
   /// @brief writes an array of bytes to a specific register in the I²C device
   /// @param a_register the internal address of the register to read from
   /// @param data pointer to an array to store the bytes
@@ -2,6 +2,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -40,6 +41,12 @@ enum ErrorCode {
   ERROR_CRC = 7,               ///< bytes received with a CRC error
 };
 
+/// @brief Called on the main loop with the result of a transaction queued with I2CBus::write_readv_async()
+using I2CTransactionCallback = std::function<void(ErrorCode)>;
+
+/// Write data of queued transactions is copied up to this size, so callers may pass temporaries
+static constexpr size_t I2C_ASYNC_MAX_WRITE = 16;
+
 /// @brief the ReadBuffer structure stores a pointer to a read buffer and its length
 struct ReadBuffer {
   uint8_t *data;  ///< pointer to the read buffer
@@ -74,6 +81,23 @@ class I2CBus {
   virtual ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
                                 size_t read_count) = 0;
 
+  /// @brief Queues a write_readv() transaction and reports its result to a callback.
+  /// @param address address of the I²C device on the i2c bus
+  /// @param write_buffer data to write, copied, at most I2C_ASYNC_MAX_WRITE bytes
+  /// @param write_count number of bytes to write
+  /// @param read_buffer pointer to an array to receive data, it must stay valid until the callback ran
+  /// @param read_count number of bytes to read
+  /// @param callback called with the i2c::ErrorCode of the transaction
+  /// @details Buses that can transfer in the background return right away and call the callback from the main loop
+  /// once the transfer is done, so the loop keeps running while the bus is busy. This default implementation
+  /// transfers synchronously before calling it.
+  virtual void write_readv_async(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                                 size_t read_count, I2CTransactionCallback &&callback) {
+    callback(write_count > I2C_ASYNC_MAX_WRITE
+                 ? ERROR_TOO_LARGE
+                 : this->write_readv(address, write_buffer, write_count, read_buffer, read_count));
+  }
+
   // Legacy functions for compatibility
 
   ErrorCode read(uint8_t address, uint8_t *buffer, size_t len) {
@@ -3,6 +3,7 @@
 #include "i2c_bus_esp_idf.h"
 
 #include <driver/gpio.h>
+#include <freertos/task.h>
 #include <cinttypes>
 #include <cstring>
 #include "esphome/core/application.h"
@@ -75,6 +76,22 @@ void IDFI2CBus::setup() {
     ESP_LOGV(TAG, "Scanning for devices");
     this->i2c_scan_();
   }
+  // Only needed while queued transactions are in flight
+  this->disable_loop();
+}
+
+void IDFI2CBus::loop() {
+  uint8_t index;
+  while (xQueueReceive(this->done_queue_, &index, 0) == pdTRUE) {
+    auto &transaction = this->transactions_[index];
+    // Release the slot before the callback runs, it may queue the next transaction
+    I2CTransactionCallback callback = std::move(transaction.callback);
+    const ErrorCode result = transaction.result;
+    this->free_transactions_ |= 1 << index;
+    callback(result);
+  }
+  if (this->free_transactions_ == 0xFF)
+    this->disable_loop();
 }
 
 void IDFI2CBus::dump_config() {
@@ -184,6 +201,63 @@ ErrorCode IDFI2CBus::write_readv(uint8_t address, const uint8_t *write_buffer, s
   return ERROR_OK;
 }
 
+void IDFI2CBus::write_readv_async(uint8_t address, const uint8_t *write_buffer, size_t write_count,
+                                  uint8_t *read_buffer, size_t read_count, I2CTransactionCallback &&callback) {
+  if (write_count > I2C_ASYNC_MAX_WRITE) {
+    callback(ERROR_TOO_LARGE);
+    return;
+  }
+  if (this->free_transactions_ == 0 || !this->start_transaction_task_()) {
+    // Every slot is in flight, transfer right away rather than dropping the transaction
+    callback(this->write_readv(address, write_buffer, write_count, read_buffer, read_count));
+    return;
+  }
+
+  const uint8_t index = __builtin_ctz(this->free_transactions_);
+  this->free_transactions_ &= ~(1 << index);
+  auto &transaction = this->transactions_[index];
+  transaction.callback = std::move(callback);
+  transaction.read_buffer = read_buffer;
+  transaction.read_count = read_count;
+  if (write_count > 0)
+    memcpy(transaction.write_data, write_buffer, write_count);
+  transaction.write_count = write_count;
+  transaction.address = address;
+  // Never blocks, the queue holds as many indexes as there are slots
+  xQueueSend(this->transaction_queue_, &index, portMAX_DELAY);
+  this->enable_loop();
+}
+
+bool IDFI2CBus::start_transaction_task_() {
+  if (this->transaction_queue_ != nullptr)
+    return true;
+  this->transaction_queue_ = xQueueCreate(this->transactions_.size(), sizeof(uint8_t));
+  this->done_queue_ = xQueueCreate(this->transactions_.size(), sizeof(uint8_t));
+  if (this->transaction_queue_ == nullptr || this->done_queue_ == nullptr ||
+      xTaskCreate(&IDFI2CBus::transaction_task, "i2c_transactions", 3072, this, 2, nullptr) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to start the transaction task, transferring synchronously");
+    // Keeps every later call on the synchronous path
+    this->free_transactions_ = 0;
+    return false;
+  }
+  return true;
+}
+
+void IDFI2CBus::transaction_task(void *arg) {
+  auto *that = static_cast<IDFI2CBus *>(arg);
+  uint8_t index;
+  while (true) {
+    if (xQueueReceive(that->transaction_queue_, &index, portMAX_DELAY) != pdTRUE)
+      continue;
+    // The driver waits for the transfer on a semaphore, the main loop keeps running meanwhile
+    auto &transaction = that->transactions_[index];
+    transaction.result = that->write_readv(transaction.address, transaction.write_data, transaction.write_count,
+                                           transaction.read_buffer, transaction.read_count);
+    xQueueSend(that->done_queue_, &index, portMAX_DELAY);
+    that->enable_loop_soon_any_context();
+  }
+}
+
 /// Perform I2C bus recovery, see:
 /// https://www.nxp.com/docs/en/user-guide/UM10204.pdf
 /// https://www.analog.com/media/en/technical-documentation/application-notes/54305147357414AN686_0.pdf
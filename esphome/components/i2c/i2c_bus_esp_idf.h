@@ -4,7 +4,10 @@
 
 #include "esphome/core/component.h"
 #include "i2c_bus.h"
+#include <array>
 #include <driver/i2c_master.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 
 namespace esphome {
 namespace i2c {
@@ -15,12 +18,26 @@ enum RecoveryCode {
   RECOVERY_COMPLETED,
 };
 
+/// A transaction queued with write_readv_async(), owned by the main loop while idle or done
+struct IDFI2CTransaction {
+  I2CTransactionCallback callback;
+  uint8_t *read_buffer;
+  size_t read_count;
+  uint8_t write_data[I2C_ASYNC_MAX_WRITE];
+  uint8_t write_count;
+  uint8_t address;
+  ErrorCode result;
+};
+
 class IDFI2CBus : public InternalI2CBus, public Component {
  public:
   void setup() override;
+  void loop() override;
   void dump_config() override;
   ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
                         size_t read_count) override;
+  void write_readv_async(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                         size_t read_count, I2CTransactionCallback &&callback) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void set_scan(bool scan) { this->scan_ = scan; }
@@ -48,6 +65,16 @@ class IDFI2CBus : public InternalI2CBus, public Component {
   uint32_t frequency_{};
   uint32_t timeout_ = 0;
   bool initialized_ = false;
+
+  /// Starts the task running queued transactions, returns false if it could not be created.
+  bool start_transaction_task_();
+  static void transaction_task(void *arg);
+
+  // Slots are taken and released on the main loop only, the task just runs the transfers of the queued indexes
+  std::array<IDFI2CTransaction, 8> transactions_{};
+  uint8_t free_transactions_{0xFF};  // Bit per free slot
+  QueueHandle_t transaction_queue_{nullptr};
+  QueueHandle_t done_queue_{nullptr};
 };
 
 }  // namespace i2c
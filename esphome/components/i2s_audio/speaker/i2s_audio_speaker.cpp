@@ -264,9 +264,9 @@ void I2SAudioSpeaker::speaker_task(void *params) {
       audio::AudioSourceTransferBuffer::create(bytes_to_fill_single_dma_buffer);
 
   if (transfer_buffer != nullptr) {
-    std::shared_ptr<RingBuffer> temp_ring_buffer = RingBuffer::create(ring_buffer_size);
+    std::shared_ptr<RingBuffer> temp_ring_buffer = RingBuffer::create(ring_buffer_size, RAMSubsystem::AUDIO);
     if (temp_ring_buffer.use_count() == 1) {
-      transfer_buffer->set_source(temp_ring_buffer);
+      transfer_buffer->set_source(temp_ring_buffer, true);
       this_speaker->audio_ring_buffer_ = temp_ring_buffer;
       successful_setup = true;
     }
@@ -207,6 +207,63 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
   }
 }
 
+void HOT ILI9XXXDisplay::fill_absolute_span_internal(int x, int y, int width, Color color) {
+  if (y >= this->get_height_internal() || y < 0 || x < 0 || x + width > this->get_width_internal()) {
+    return;
+  }
+  if (!this->check_buffer_())
+    return;
+  uint16_t new_color;
+  int bytes_per_pixel = 1;
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      break;
+    case BITS_16:
+      new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+      bytes_per_pixel = 2;
+      break;
+    default:
+      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      break;
+  }
+  const uint8_t high = new_color >> 8;
+  const uint8_t low = new_color & 0xFF;
+
+  // Only the changed part of the row moves the watermarks, as with single pixels
+  uint8_t *row = this->buffer_ + ((y * this->width_) + x) * bytes_per_pixel;
+  int first_changed = width;
+  int last_changed = -1;
+  for (int i = 0; i < width; i++) {
+    if (bytes_per_pixel == 2) {
+      if (row[0] != high || row[1] != low) {
+        row[0] = high;
+        row[1] = low;
+        first_changed = std::min(first_changed, i);
+        last_changed = i;
+      }
+      row += 2;
+    } else {
+      if (*row != low) {
+        *row = low;
+        first_changed = std::min(first_changed, i);
+        last_changed = i;
+      }
+      row++;
+    }
+  }
+  if (last_changed < 0)
+    return;
+  if (x + first_changed < this->x_low_)
+    this->x_low_ = x + first_changed;
+  if (x + last_changed > this->x_high_)
+    this->x_high_ = x + last_changed;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
 void ILI9XXXDisplay::update() {
   if (this->prossing_update_) {
     this->need_update_ = true;
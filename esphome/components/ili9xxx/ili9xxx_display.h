@@ -106,6 +106,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int width, Color color) override;
   void setup_pins_();
 
   virtual void set_madctl();
@@ -20,8 +20,36 @@ void IntegrationSensor::setup() {
 
   this->publish_and_save_(this->result_);
   this->sensor_->add_on_state_callback([this](float state) { this->process_sensor_value_(state); });
+  if (this->publish_interval_ > 0) {
+    this->set_interval(this->publish_interval_, [this]() {
+      if (this->publish_pending_)
+        this->publish_();
+    });
+  }
+}
+void IntegrationSensor::dump_config() {
+  LOG_SENSOR("", "Integration Sensor", this);
+  if (this->publish_interval_ > 0)
+    ESP_LOGCONFIG(TAG, "  Publish Interval: %" PRIu32 " ms", this->publish_interval_);
+  if (this->restore_ && this->save_interval_ > 0)
+    ESP_LOGCONFIG(TAG, "  Save Interval: %" PRIu32 " ms", this->save_interval_);
+}
+void IntegrationSensor::on_safe_shutdown() {
+  // The last areas are not lost with a save interval
+  if (this->restore_)
+    this->save_();
+}
+void IntegrationSensor::publish_() {
+  this->publish_state(this->result_);
+  this->publish_pending_ = false;
+  if (this->restore_ && millis() - this->last_save_ >= this->save_interval_)
+    this->save_();
+}
+void IntegrationSensor::save_() {
+  float result_f = this->result_;
+  this->pref_.save(&result_f);
+  this->last_save_ = millis();
 }
-void IntegrationSensor::dump_config() { LOG_SENSOR("", "Integration Sensor", this); }
 void IntegrationSensor::process_sensor_value_(float value) {
   if (std::isnan(value))
     return;
@@ -30,7 +58,7 @@ void IntegrationSensor::process_sensor_value_(float value) {
   const double new_value = value;
   const uint32_t dt_ms = now - this->last_update_;
   const double dt = dt_ms * this->get_time_factor_();
-  double area = 0.0f;
+  double area = 0.0;
   switch (this->method_) {
     case INTEGRATION_METHOD_TRAPEZOID:
       area = dt * (old_value + new_value) / 2.0;
@@ -44,7 +72,12 @@ void IntegrationSensor::process_sensor_value_(float value) {
   }
   this->last_value_ = new_value;
   this->last_update_ = now;
-  this->publish_and_save_(this->result_ + area);
+  this->result_ += area;
+  if (this->publish_interval_ > 0) {
+    this->publish_pending_ = true;
+  } else {
+    this->publish_();
+  }
 }
 
 }  // namespace integration
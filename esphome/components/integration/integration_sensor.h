@@ -31,43 +31,55 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void set_time(IntegrationSensorTime time) { time_ = time; }
   void set_method(IntegrationMethod method) { method_ = method; }
   void set_restore(bool restore) { restore_ = restore; }
-  void reset() { this->publish_and_save_(0.0f); }
+  /// Publishes the integral at most every interval ms instead of on every value of the sensor, 0 for every value.
+  void set_publish_interval(uint32_t interval) { publish_interval_ = interval; }
+  /// Saves the integral at most every interval ms, 0 saves it on every publish.
+  void set_save_interval(uint32_t interval) { save_interval_ = interval; }
+  void reset() { this->publish_and_save_(0.0); }
+  void on_safe_shutdown() override;
 
  protected:
   void process_sensor_value_(float value);
-  float get_time_factor_() {
+  double get_time_factor_() {
     switch (this->time_) {
       case INTEGRATION_SENSOR_TIME_MILLISECOND:
-        return 1.0f;
+        return 1.0;
       case INTEGRATION_SENSOR_TIME_SECOND:
-        return 1.0f / 1000.0f;
+        return 1.0 / 1000.0;
       case INTEGRATION_SENSOR_TIME_MINUTE:
-        return 1.0f / 60000.0f;
+        return 1.0 / 60000.0;
       case INTEGRATION_SENSOR_TIME_HOUR:
-        return 1.0f / 3600000.0f;
+        return 1.0 / 3600000.0;
       case INTEGRATION_SENSOR_TIME_DAY:
-        return 1.0f / 86400000.0f;
+        return 1.0 / 86400000.0;
       default:
-        return 0.0f;
+        return 0.0;
     }
   }
   void publish_and_save_(double result) {
     this->result_ = result;
     this->publish_state(result);
-    if (this->restore_) {
-      float result_f = result;
-      this->pref_.save(&result_f);
-    }
+    this->publish_pending_ = false;
+    if (this->restore_)
+      this->save_();
   }
+  /// Publishes the integral and saves it when the save interval has passed.
+  void publish_();
+  void save_();
 
   sensor::Sensor *sensor_;
   IntegrationSensorTime time_;
   IntegrationMethod method_;
   bool restore_;
+  bool publish_pending_{false};
   ESPPreferenceObject pref_;
 
+  uint32_t publish_interval_{0};
+  uint32_t save_interval_{0};
+  uint32_t last_save_{0};
   uint32_t last_update_;
-  double result_{0.0f};
+  // Accumulated in double, a float stops adding small areas to a large integral
+  double result_{0.0};
   float last_value_{0.0f};
 };
 
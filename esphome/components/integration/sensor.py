@@ -35,6 +35,8 @@ INTEGRATION_METHODS = {
 
 CONF_TIME_UNIT = "time_unit"
 CONF_INTEGRATION_METHOD = "integration_method"
+CONF_PUBLISH_INTERVAL = "publish_interval"
+CONF_SAVE_INTERVAL = "save_interval"
 
 
 def inherit_unit_of_measurement(uom, config):
@@ -58,6 +60,12 @@ CONFIG_SCHEMA = (
                 INTEGRATION_METHODS, lower=True
             ),
             cv.Optional(CONF_RESTORE, default=False): cv.boolean,
+            cv.Optional(
+                CONF_PUBLISH_INTERVAL, default="0s"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_SAVE_INTERVAL, default="0s"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional("min_save_interval"): cv.invalid(
                 "min_save_interval was removed in 2022.8.0. Please use the `preferences` -> `flash_write_interval` to adjust."
             ),
@@ -99,6 +107,8 @@ async def to_code(config):
     cg.add(var.set_time(config[CONF_TIME_UNIT]))
     cg.add(var.set_method(config[CONF_INTEGRATION_METHOD]))
     cg.add(var.set_restore(config[CONF_RESTORE]))
+    cg.add(var.set_publish_interval(config[CONF_PUBLISH_INTERVAL]))
+    cg.add(var.set_save_interval(config[CONF_SAVE_INTERVAL]))
 
 
 @automation.register_action(
@@ -15,45 +15,36 @@ void Jsnsr04tComponent::update() {
 }
 
 void Jsnsr04tComponent::loop() {
-  while (this->available() > 0) {
-    uint8_t data;
-    this->read_byte(&data);
-
-    ESP_LOGV(TAG, "Read byte from sensor: %x", data);
-
-    if (this->buffer_.empty() && data != 0xFF)
-      continue;
-
-    this->buffer_.push_back(data);
-    if (this->buffer_.size() == 4)
-      this->check_buffer_();
+  for (auto frame = this->frame_reader_.read_frame(this->parent_); !frame.empty();
+       frame = this->frame_reader_.read_frame(this->parent_)) {
+    this->check_frame_(frame);
   }
 }
 
-void Jsnsr04tComponent::check_buffer_() {
+void Jsnsr04tComponent::check_frame_(std::span<const uint8_t> frame) {
+  ESP_LOGV(TAG, "Read frame from sensor: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
   uint8_t checksum = 0;
   switch (this->model_) {
     case JSN_SR04T:
-      checksum = this->buffer_[0] + this->buffer_[1] + this->buffer_[2];
+      checksum = frame[0] + frame[1] + frame[2];
       break;
     case AJ_SR04M:
-      checksum = this->buffer_[1] + this->buffer_[2];
+      checksum = frame[1] + frame[2];
       break;
   }
 
-  if (this->buffer_[3] == checksum) {
-    uint16_t distance = encode_uint16(this->buffer_[1], this->buffer_[2]);
+  if (frame[3] == checksum) {
+    uint16_t distance = encode_uint16(frame[1], frame[2]);
     if (distance > 250) {
       float meters = distance / 1000.0f;
       ESP_LOGV(TAG, "Distance from sensor: %umm, %.3fm", distance, meters);
       this->publish_state(meters);
     } else {
-      ESP_LOGW(TAG, "Invalid data read from sensor: %s", format_hex_pretty(this->buffer_).c_str());
+      ESP_LOGW(TAG, "Invalid data read from sensor: %s", format_hex_pretty(frame.data(), frame.size()).c_str());
     }
   } else {
-    ESP_LOGW(TAG, "checksum failed: %02x != %02x", checksum, this->buffer_[3]);
+    ESP_LOGW(TAG, "checksum failed: %02x != %02x", checksum, frame[3]);
   }
-  this->buffer_.clear();
 }
 
 void Jsnsr04tComponent::dump_config() {
@@ -1,10 +1,9 @@
 #pragma once
 
-#include <vector>
-
 #include "esphome/core/component.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/uart_frame_reader.h"
 
 namespace esphome {
 namespace jsn_sr04t {
@@ -16,6 +15,10 @@ enum Model {
 
 class Jsnsr04tComponent : public sensor::Sensor, public PollingComponent, public uart::UARTDevice {
  public:
+  Jsnsr04tComponent() {
+    this->frame_reader_.set_header({0xFF});
+    this->frame_reader_.set_frame_size(4);
+  }
   void set_model(Model model) { this->model_ = model; }
 
   // ========== INTERNAL METHODS ==========
@@ -24,10 +27,10 @@ class Jsnsr04tComponent : public sensor::Sensor, public PollingComponent, public
   void dump_config() override;
 
  protected:
-  void check_buffer_();
+  void check_frame_(std::span<const uint8_t> frame);
   Model model_;
 
-  std::vector<uint8_t> buffer_;
+  uart::UARTFrameReader frame_reader_{4};
 };
 
 }  // namespace jsn_sr04t
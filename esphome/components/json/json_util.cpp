@@ -61,15 +61,28 @@ JsonDocument parse_json(const uint8_t *data, size_t len) {
   // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
+bool JsonBuilder::check_overflow_() {
+  if (!this->doc_.overflowed())
+    return false;
+  ESP_LOGE(TAG, "JSON document overflow");
+  return true;
+}
+
 std::string JsonBuilder::serialize() {
-  if (doc_.overflowed()) {
-    ESP_LOGE(TAG, "JSON document overflow");
+  if (this->check_overflow_())
     return "{}";
-  }
+  // Measuring first is a cheap pass over the document and saves growing the string while it is written
   std::string output;
-  serializeJson(doc_, output);
+  output.reserve(this->measure());
+  serializeJson(this->doc_, output);
   return output;
 }
 
+size_t JsonBuilder::serialize_to(char *buffer, size_t size) {
+  if (this->check_overflow_() || this->measure() >= size)
+    return 0;
+  return serializeJson(this->doc_, buffer, size);
+}
+
 }  // namespace json
 }  // namespace esphome
@@ -69,9 +69,24 @@ class JsonBuilder {
     return root_;
   }
 
+  /// Serialize into a string allocated once with the measured size.
   std::string serialize();
+  /// Number of bytes serialize() produces, without a null terminator.
+  size_t measure() { return measureJson(this->doc_); }
+  /// Serialize into buffer, returns the number of bytes written or 0 if it does not fit.
+  size_t serialize_to(char *buffer, size_t size);
+  /// Serialize straight into a sink without an intermediate string. The writer is a Print or any class with
+  /// size_t write(uint8_t) and size_t write(const uint8_t *, size_t).
+  template<typename W> size_t serialize_to(W &writer) {
+    if (this->check_overflow_())
+      return writer.write(reinterpret_cast<const uint8_t *>("{}"), 2);
+    return serializeJson(this->doc_, writer);
+  }
 
  private:
+  /// Logs and returns true if the document ran out of memory while it was built.
+  bool check_overflow_();
+
 #ifdef USE_PSRAM
   SpiRamAllocator allocator_;
   JsonDocument doc_{&allocator_};
@@ -82,5 +97,14 @@ class JsonBuilder {
   bool root_created_{false};
 };
 
+/// Build JSON with the provided json build function and serialize it straight into writer.
+template<typename W> size_t build_json(W &writer, const json_build_t &f) {
+  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+  JsonBuilder builder;
+  f(builder.root());
+  return builder.serialize_to(writer);
+  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
+}
+
 }  // namespace json
 }  // namespace esphome
@@ -1,5 +1,5 @@
 import esphome.codegen as cg
-from esphome.components import sensor
+from esphome.components import ld24xx, sensor
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_LIGHT,
@@ -34,35 +34,35 @@ CONFIG_SCHEMA = cv.Schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_STILL_DISTANCE): sensor.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_MOVING_ENERGY): sensor.sensor_schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_MOTION_SENSOR,
             unit_of_measurement=UNIT_PERCENT,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_STILL_ENERGY): sensor.sensor_schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_FLASH,
             unit_of_measurement=UNIT_PERCENT,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_LIGHT): sensor.sensor_schema(
             device_class=DEVICE_CLASS_ILLUMINANCE,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_LIGHTBULB,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_DETECTION_DISTANCE): sensor.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
     }
 )
 
@@ -97,22 +97,46 @@ async def to_code(config):
     ld2410_component = await cg.get_variable(config[CONF_LD2410_ID])
     if moving_distance_config := config.get(CONF_MOVING_DISTANCE):
         sens = await sensor.new_sensor(moving_distance_config)
-        cg.add(ld2410_component.set_moving_target_distance_sensor(sens))
+        cg.add(
+            ld2410_component.set_moving_target_distance_sensor(
+                sens, *ld24xx.publish_limits(moving_distance_config)
+            )
+        )
     if still_distance_config := config.get(CONF_STILL_DISTANCE):
         sens = await sensor.new_sensor(still_distance_config)
-        cg.add(ld2410_component.set_still_target_distance_sensor(sens))
+        cg.add(
+            ld2410_component.set_still_target_distance_sensor(
+                sens, *ld24xx.publish_limits(still_distance_config)
+            )
+        )
     if moving_energy_config := config.get(CONF_MOVING_ENERGY):
         sens = await sensor.new_sensor(moving_energy_config)
-        cg.add(ld2410_component.set_moving_target_energy_sensor(sens))
+        cg.add(
+            ld2410_component.set_moving_target_energy_sensor(
+                sens, *ld24xx.publish_limits(moving_energy_config)
+            )
+        )
     if still_energy_config := config.get(CONF_STILL_ENERGY):
         sens = await sensor.new_sensor(still_energy_config)
-        cg.add(ld2410_component.set_still_target_energy_sensor(sens))
+        cg.add(
+            ld2410_component.set_still_target_energy_sensor(
+                sens, *ld24xx.publish_limits(still_energy_config)
+            )
+        )
     if light_config := config.get(CONF_LIGHT):
         sens = await sensor.new_sensor(light_config)
-        cg.add(ld2410_component.set_light_sensor(sens))
+        cg.add(
+            ld2410_component.set_light_sensor(
+                sens, *ld24xx.publish_limits(light_config)
+            )
+        )
     if detection_distance_config := config.get(CONF_DETECTION_DISTANCE):
         sens = await sensor.new_sensor(detection_distance_config)
-        cg.add(ld2410_component.set_detection_distance_sensor(sens))
+        cg.add(
+            ld2410_component.set_detection_distance_sensor(
+                sens, *ld24xx.publish_limits(detection_distance_config)
+            )
+        )
     for x in range(9):
         if gate_conf := config.get(f"g{x}"):
             if move_config := gate_conf.get(CONF_MOVE_ENERGY):
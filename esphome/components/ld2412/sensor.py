@@ -1,5 +1,5 @@
 import esphome.codegen as cg
-from esphome.components import sensor
+from esphome.components import ld24xx, sensor
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_LIGHT,
@@ -34,36 +34,36 @@ CONFIG_SCHEMA = cv.Schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_LIGHT): sensor.sensor_schema(
             device_class=DEVICE_CLASS_ILLUMINANCE,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_LIGHTBULB,
             unit_of_measurement=UNIT_EMPTY,  # No standard unit for this light sensor
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_MOVING_DISTANCE): sensor.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_MOVING_ENERGY): sensor.sensor_schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_MOTION_SENSOR,
             unit_of_measurement=UNIT_PERCENT,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_STILL_DISTANCE): sensor.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_SIGNAL,
             unit_of_measurement=UNIT_CENTIMETER,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
         cv.Optional(CONF_STILL_ENERGY): sensor.sensor_schema(
             filters=[{"throttle_with_priority": cv.TimePeriod(milliseconds=1000)}],
             icon=ICON_FLASH,
             unit_of_measurement=UNIT_PERCENT,
-        ),
+        ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
     }
 )
 
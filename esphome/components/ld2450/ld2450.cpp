@@ -188,6 +188,7 @@ void LD2450Component::setup() {
     this->set_presence_timeout();
   }
 #endif
+  this->rx_listener_ = this->add_rx_listener(this);
   this->restart_and_read_all_info();
 }
 
@@ -279,6 +280,8 @@ void LD2450Component::loop() {
   while (this->available()) {
     this->readline_(this->read());
   }
+  if (this->rx_listener_)
+    this->disable_loop();
 }
 
 // Count targets in zone
@@ -455,19 +458,25 @@ void LD2450Component::handle_periodic_data_() {
   Direction direction{DIRECTION_UNDEFINED};
   bool is_moving = false;
 
+#ifdef USE_TEXT_SENSOR
+  // "x,y,speed" of every target, 21 characters at most each
+  char targets[MAX_TARGETS * 22];
+  size_t targets_length = 0;
+#endif
+
 #if defined(USE_BINARY_SENSOR) || defined(USE_SENSOR) || defined(USE_TEXT_SENSOR)
   // Loop thru targets
   for (index = 0; index < MAX_TARGETS; index++) {
-#ifdef USE_SENSOR
     // X
     start = TARGET_X + index * 8;
     is_moving = false;
-    // tx is used for further calculations, so always needs to be populated
+    // tx and ty are used for further calculations, so always need to be populated
     tx = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
-    SAFE_PUBLISH_SENSOR(this->move_x_sensors_[index], tx);
     // Y
     start = TARGET_Y + index * 8;
     ty = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
+#ifdef USE_SENSOR
+    SAFE_PUBLISH_SENSOR(this->move_x_sensors_[index], tx);
     SAFE_PUBLISH_SENSOR(this->move_y_sensors_[index], ty);
     // RESOLUTION
     start = TARGET_RESOLUTION + index * 8;
@@ -517,6 +526,8 @@ void LD2450Component::handle_periodic_data_() {
     if (tsd != nullptr && (!tsd->has_state() || tsd->get_state() != dir_str)) {
       tsd->publish_state(dir_str);
     }
+    targets_length += snprintf(targets + targets_length, sizeof(targets) - targets_length, "%s%d,%d,%d",
+                               index == 0 ? "" : ";", tx, ty, ts);
 #endif
 
     // Store target info for zone target count
@@ -529,6 +540,14 @@ void LD2450Component::handle_periodic_data_() {
   still_target_count = target_count - moving_target_count;
 #endif
 
+#ifdef USE_TEXT_SENSOR
+  // One message for all targets instead of one per coordinate, only when a target changed
+  if (this->targets_text_sensor_ != nullptr &&
+      (!this->targets_text_sensor_->has_state() || this->targets_text_sensor_->get_state() != targets)) {
+    this->targets_text_sensor_->publish_state(targets);
+  }
+#endif
+
 #ifdef USE_SENSOR
   // Loop thru zones
   uint8_t zone_still_targets = 0;
@@ -850,23 +869,27 @@ void LD2450Component::query_zone_() { this->send_command_(CMD_QUERY_ZONE, nullpt
 
 #ifdef USE_SENSOR
 // These could leak memory, but they are only set once prior to 'setup()' and should never be used again.
-void LD2450Component::set_move_x_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_x_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_x_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband, uint16_t min_interval) {
+  this->move_x_sensors_[target] = new SensorWithDedup<int16_t>(s, deadband, min_interval);
 }
-void LD2450Component::set_move_y_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_y_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_y_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband, uint16_t min_interval) {
+  this->move_y_sensors_[target] = new SensorWithDedup<int16_t>(s, deadband, min_interval);
 }
-void LD2450Component::set_move_speed_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_speed_sensors_[target] = new SensorWithDedup<int16_t>(s);
+void LD2450Component::set_move_speed_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband,
+                                            uint16_t min_interval) {
+  this->move_speed_sensors_[target] = new SensorWithDedup<int16_t>(s, deadband, min_interval);
 }
-void LD2450Component::set_move_angle_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_angle_sensors_[target] = new SensorWithDedup<float>(s);
+void LD2450Component::set_move_angle_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband,
+                                            uint16_t min_interval) {
+  this->move_angle_sensors_[target] = new SensorWithDedup<float>(s, deadband, min_interval);
 }
-void LD2450Component::set_move_distance_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_distance_sensors_[target] = new SensorWithDedup<uint16_t>(s);
+void LD2450Component::set_move_distance_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband,
+                                               uint16_t min_interval) {
+  this->move_distance_sensors_[target] = new SensorWithDedup<uint16_t>(s, deadband, min_interval);
 }
-void LD2450Component::set_move_resolution_sensor(uint8_t target, sensor::Sensor *s) {
-  this->move_resolution_sensors_[target] = new SensorWithDedup<uint16_t>(s);
+void LD2450Component::set_move_resolution_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband,
+                                                 uint16_t min_interval) {
+  this->move_resolution_sensors_[target] = new SensorWithDedup<uint16_t>(s, deadband, min_interval);
 }
 void LD2450Component::set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s) {
   this->zone_target_count_sensors_[zone] = new SensorWithDedup<uint8_t>(s);
@@ -121,18 +121,20 @@ class LD2450Component : public Component, public uart::UARTDevice {
   void factory_reset();
 #ifdef USE_TEXT_SENSOR
   void set_direction_text_sensor(uint8_t target, text_sensor::TextSensor *s);
+  /// All target coordinates and speeds packed into one value, "x,y,speed" per target separated by ";"
+  void set_targets_text_sensor(text_sensor::TextSensor *s) { this->targets_text_sensor_ = s; }
 #endif
 #ifdef USE_NUMBER
   void set_zone_coordinate(uint8_t zone);
   void set_zone_numbers(uint8_t zone, number::Number *x1, number::Number *y1, number::Number *x2, number::Number *y2);
 #endif
 #ifdef USE_SENSOR
-  void set_move_x_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_y_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_speed_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_angle_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_distance_sensor(uint8_t target, sensor::Sensor *s);
-  void set_move_resolution_sensor(uint8_t target, sensor::Sensor *s);
+  void set_move_x_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
+  void set_move_y_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
+  void set_move_speed_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
+  void set_move_angle_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
+  void set_move_distance_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
+  void set_move_resolution_sensor(uint8_t target, sensor::Sensor *s, uint16_t deadband = 0, uint16_t min_interval = 0);
   void set_zone_target_count_sensor(uint8_t zone, sensor::Sensor *s);
   void set_zone_still_target_count_sensor(uint8_t zone, sensor::Sensor *s);
   void set_zone_moving_target_count_sensor(uint8_t zone, sensor::Sensor *s);
@@ -170,6 +172,7 @@ class LD2450Component : public Component, public uart::UARTDevice {
   uint8_t buffer_pos_ = 0;  // where to resume processing/populating buffer
   uint8_t zone_type_ = 0;
   bool bluetooth_on_{false};
+  bool rx_listener_{false};  // The bus wakes the loop when data arrives, no need to poll
   Target target_info_[MAX_TARGETS];
   Zone zone_config_[MAX_ZONES];
 
@@ -190,6 +193,7 @@ class LD2450Component : public Component, public uart::UARTDevice {
 #endif
 #ifdef USE_TEXT_SENSOR
   std::array<text_sensor::TextSensor *, 3> direction_text_sensors_{};
+  text_sensor::TextSensor *targets_text_sensor_{nullptr};
 #endif
 };
 
@@ -1,5 +1,5 @@
 import esphome.codegen as cg
-from esphome.components import sensor
+from esphome.components import ld24xx, sensor
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ANGLE,
@@ -100,7 +100,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_ALPHA_X_BOX_OUTLINE,
                     unit_of_measurement=UNIT_MILLIMETER,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
                 cv.Optional(CONF_Y): sensor.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
@@ -114,7 +114,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_ALPHA_Y_BOX_OUTLINE,
                     unit_of_measurement=UNIT_MILLIMETER,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
                 cv.Optional(CONF_SPEED): sensor.sensor_schema(
                     device_class=DEVICE_CLASS_SPEED,
                     filters=[
@@ -128,7 +128,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_SPEEDOMETER_SLOW,
                     unit_of_measurement=UNIT_MILLIMETER_PER_SECOND,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
                 cv.Optional(CONF_ANGLE): sensor.sensor_schema(
                     filters=[
                         {
@@ -141,7 +141,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_FORMAT_TEXT_ROTATION_ANGLE_UP,
                     unit_of_measurement=UNIT_DEGREES,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
                 cv.Optional(CONF_DISTANCE): sensor.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
@@ -155,7 +155,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_MAP_MARKER_DISTANCE,
                     unit_of_measurement=UNIT_MILLIMETER,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
                 cv.Optional(CONF_RESOLUTION): sensor.sensor_schema(
                     device_class=DEVICE_CLASS_DISTANCE,
                     filters=[
@@ -169,7 +169,7 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
                     ],
                     icon=ICON_RELATION_ZERO_OR_ONE_TO_ZERO_OR_ONE,
                     unit_of_measurement=UNIT_MILLIMETER,
-                ),
+                ).extend(ld24xx.PUBLISH_LIMITS_SCHEMA),
             }
         )
         for n in range(MAX_TARGETS)
@@ -241,22 +241,46 @@ async def to_code(config):
         if target_conf := config.get(f"target_{n + 1}"):
             if x_config := target_conf.get(CONF_X):
                 sens = await sensor.new_sensor(x_config)
-                cg.add(ld2450_component.set_move_x_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_x_sensor(
+                        n, sens, *ld24xx.publish_limits(x_config)
+                    )
+                )
             if y_config := target_conf.get(CONF_Y):
                 sens = await sensor.new_sensor(y_config)
-                cg.add(ld2450_component.set_move_y_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_y_sensor(
+                        n, sens, *ld24xx.publish_limits(y_config)
+                    )
+                )
             if speed_config := target_conf.get(CONF_SPEED):
                 sens = await sensor.new_sensor(speed_config)
-                cg.add(ld2450_component.set_move_speed_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_speed_sensor(
+                        n, sens, *ld24xx.publish_limits(speed_config)
+                    )
+                )
             if angle_config := target_conf.get(CONF_ANGLE):
                 sens = await sensor.new_sensor(angle_config)
-                cg.add(ld2450_component.set_move_angle_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_angle_sensor(
+                        n, sens, *ld24xx.publish_limits(angle_config)
+                    )
+                )
             if distance_config := target_conf.get(CONF_DISTANCE):
                 sens = await sensor.new_sensor(distance_config)
-                cg.add(ld2450_component.set_move_distance_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_distance_sensor(
+                        n, sens, *ld24xx.publish_limits(distance_config)
+                    )
+                )
             if resolution_config := target_conf.get(CONF_RESOLUTION):
                 sens = await sensor.new_sensor(resolution_config)
-                cg.add(ld2450_component.set_move_resolution_sensor(n, sens))
+                cg.add(
+                    ld2450_component.set_move_resolution_sensor(
+                        n, sens, *ld24xx.publish_limits(resolution_config)
+                    )
+                )
     for n in range(MAX_ZONES):
         if zone_config := config.get(f"zone_{n + 1}"):
             if target_count_config := zone_config.get(CONF_TARGET_COUNT):
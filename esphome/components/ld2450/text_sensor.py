@@ -16,6 +16,10 @@ from . import CONF_LD2450_ID, LD2450Component
 
 DEPENDENCIES = ["ld2450"]
 
+CONF_TARGETS = "targets"
+
+ICON_MAP_MARKER_MULTIPLE = "mdi:map-marker-multiple"
+
 MAX_TARGETS = 3
 
 CONFIG_SCHEMA = cv.Schema(
@@ -29,6 +33,9 @@ CONFIG_SCHEMA = cv.Schema(
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
             icon=ICON_BLUETOOTH,
         ),
+        cv.Optional(CONF_TARGETS): text_sensor.text_sensor_schema(
+            icon=ICON_MAP_MARKER_MULTIPLE,
+        ),
     }
 )
 
@@ -55,6 +62,9 @@ async def to_code(config):
     if mac_address_config := config.get(CONF_MAC_ADDRESS):
         sens = await text_sensor.new_text_sensor(mac_address_config)
         cg.add(ld2450_component.set_mac_text_sensor(sens))
+    if targets_config := config.get(CONF_TARGETS):
+        sens = await text_sensor.new_text_sensor(targets_config)
+        cg.add(ld2450_component.set_targets_text_sensor(sens))
     for n in range(MAX_TARGETS):
         if (direction_conf := config.get(f"target_{n + 1}")) and (
             direction_config := direction_conf.get(CONF_DIRECTION)
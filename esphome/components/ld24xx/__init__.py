@@ -1 +1,29 @@
+import esphome.config_validation as cv
+from esphome.core import TimePeriod
+
 CODEOWNERS = ["@kbx81"]
+
+CONF_DEADBAND = "deadband"
+CONF_MIN_PUBLISH_INTERVAL = "min_publish_interval"
+
+# Options limiting how often a sensor fed by every radar frame publishes
+PUBLISH_LIMITS_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_DEADBAND): cv.uint16_t,
+        cv.Optional(CONF_MIN_PUBLISH_INTERVAL): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(max=TimePeriod(milliseconds=65535)),
+        ),
+    }
+)
+
+
+def publish_limits(config):
+    """Return the extra sensor setter arguments for the publish limits of config."""
+    if CONF_DEADBAND not in config and CONF_MIN_PUBLISH_INTERVAL not in config:
+        return ()
+    min_interval = config.get(CONF_MIN_PUBLISH_INTERVAL)
+    return (
+        config.get(CONF_DEADBAND, 0),
+        min_interval.total_milliseconds if min_interval is not None else 0,
+    )
@@ -5,16 +5,19 @@
 #include <memory>
 
 #ifdef USE_SENSOR
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/components/sensor/sensor.h"
 
+#include <cmath>
+
 #define SUB_SENSOR_WITH_DEDUP(name, dedup_type) \
  protected: \
   ld24xx::SensorWithDedup<dedup_type> *name##_sensor_{nullptr}; \
 \
  public: \
-  void set_##name##_sensor(sensor::Sensor *sensor) { \
-    this->name##_sensor_ = new ld24xx::SensorWithDedup<dedup_type>(sensor); \
+  void set_##name##_sensor(sensor::Sensor *sensor, uint16_t deadband = 0, uint16_t min_interval = 0) { \
+    this->name##_sensor_ = new ld24xx::SensorWithDedup<dedup_type>(sensor, deadband, min_interval); \
   }
 #endif
 
@@ -40,25 +43,52 @@ namespace esphome {
 namespace ld24xx {
 
 #ifdef USE_SENSOR
-// Helper class to store a sensor with a deduplicator & publish state only when the value changes
+// Helper class to store a sensor with a deduplicator & publish state only when the value changes.
+// Optionally, changes smaller than the deadband from the last published value are ignored and a new value is
+// published at most every min_interval ms. The deduplicator only sees published values, so the latest value is
+// still published once the interval has passed.
 template<typename T> class SensorWithDedup {
  public:
-  SensorWithDedup(sensor::Sensor *sens) : sens(sens) {}
+  SensorWithDedup(sensor::Sensor *sens, uint16_t deadband = 0, uint16_t min_interval = 0)
+      : sens(sens), deadband_(deadband), min_interval_(min_interval) {}
 
   void publish_state_if_not_dup(T state) {
+    if (this->published_ && this->is_limited_(state)) {
+      return;
+    }
     if (this->publish_dedup.next(state)) {
       this->sens->publish_state(static_cast<float>(state));
+      this->last_state_ = state;
+      this->last_publish_ = millis();
+      this->published_ = true;
     }
   }
 
   void publish_state_unknown() {
     if (this->publish_dedup.next_unknown()) {
       this->sens->publish_state(NAN);
+      // A target showing up again is published right away
+      this->published_ = false;
     }
   }
 
   sensor::Sensor *sens;
   Deduplicator<T> publish_dedup;
+
+ protected:
+  bool is_limited_(T state) const {
+    if (this->min_interval_ != 0 && millis() - this->last_publish_ < this->min_interval_) {
+      return true;
+    }
+    return this->deadband_ != 0 &&
+           std::fabs(static_cast<float>(state) - static_cast<float>(this->last_state_)) < this->deadband_;
+  }
+
+  uint32_t last_publish_{0};
+  T last_state_{};
+  uint16_t deadband_;
+  uint16_t min_interval_;
+  bool published_{false};
 };
 #endif
 }  // namespace ld24xx
@@ -0,0 +1,113 @@
+#include "addressable_composite_effect.h"
+
+#include <algorithm>
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace light {
+
+Color CompositeLayer::blend_(const Color &below, const Color &color) const {
+  Color blended;
+  switch (this->blend_mode_) {
+    case COMPOSITE_BLEND_ADD:
+      blended = below + color;
+      break;
+    case COMPOSITE_BLEND_MULTIPLY:
+      blended = below * color;
+      break;
+    case COMPOSITE_BLEND_SCREEN:
+      blended = ~(~below * ~color);
+      break;
+    case COMPOSITE_BLEND_LIGHTEN:
+      blended = Color(std::max(below.r, color.r), std::max(below.g, color.g), std::max(below.b, color.b),
+                      std::max(below.w, color.w));
+      break;
+    case COMPOSITE_BLEND_NORMAL:
+    default:
+      blended = color;
+      break;
+  }
+  if (this->opacity_ == 255)
+    return blended;
+  return blended * this->opacity_ + below * uint8_t(255 - this->opacity_);
+}
+
+void CompositeScanLayer::update(uint32_t now, int32_t length, const Color &current_color) {
+  this->color_ = current_color;
+  if (now - this->last_move_ < this->move_interval_)
+    return;
+  this->last_move_ = now;
+
+  // Bounce between both ends of the range, which can change with the strip size
+  const int32_t last = length - static_cast<int32_t>(this->scan_width_);
+  if (last <= 0) {
+    this->at_led_ = 0;
+  } else if (this->direction_) {
+    if (++this->at_led_ >= last) {
+      this->at_led_ = last;
+      this->direction_ = false;
+    }
+  } else {
+    if (this->at_led_ > last)
+      this->at_led_ = last;
+    if (--this->at_led_ <= 0) {
+      this->at_led_ = 0;
+      this->direction_ = true;
+    }
+  }
+}
+
+void CompositeColorWipeLayer::update(uint32_t now, int32_t length, const Color &current_color) {
+  if (static_cast<int32_t>(this->leds_.size()) != length) {
+    this->leds_.assign(length, Color::BLACK);
+    this->head_ = 0;
+    this->filled_ = 0;
+  }
+  if (length == 0 || now - this->last_add_ < this->add_led_interval_)
+    return;
+  this->last_add_ = now;
+
+  const Color color = this->sequence_.next();
+  if (this->reverse_) {
+    // The oldest LED at index 0 drops out and its slot becomes the new last one
+    this->leds_[this->head_] = color;
+    this->head_ = this->head_ + 1 == length ? 0 : this->head_ + 1;
+  } else {
+    this->head_ = this->head_ == 0 ? length - 1 : this->head_ - 1;
+    this->leds_[this->head_] = color;
+  }
+  this->filled_ = std::min(this->filled_ + 1, length);
+}
+
+void HOT AddressableCompositeEffect::apply(AddressableLight &it, const Color &current_color) {
+  const uint32_t now = millis();
+  const int32_t size = it.size();
+  for (auto *layer : this->layers_) {
+    layer->begin_ = clamp(layer->from_ < 0 ? size + layer->from_ : layer->from_, int32_t(0), size);
+    layer->end_ = clamp(layer->to_ < 0 ? size + layer->to_ : layer->to_, layer->begin_, size);
+    layer->update(now, layer->end_ - layer->begin_, current_color);
+  }
+
+  PixelBuffer buffer;
+  const bool direct = it.get_pixel_buffer(&buffer);
+  const ESPColorCorrection &correction = it.get_correction();
+  for (int32_t i = 0; i < size; i++) {
+    Color color = Color::BLACK;
+    for (auto *layer : this->layers_) {
+      Color layer_color;
+      if (i >= layer->begin_ && i < layer->end_ && layer->pixel(i - layer->begin_, &layer_color))
+        color = layer->blend_(color, layer_color);
+    }
+    if (direct) {
+      buffer.set(i, correction.color_correct(color));
+    } else {
+      it[i] = color;
+    }
+  }
+  it.schedule_show();
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "esphome/core/color.h"
+#include "addressable_light_effect.h"
+#include "esp_hsv_color.h"
+
+namespace esphome {
+namespace light {
+
+enum CompositeBlendMode : uint8_t {
+  /// The layer replaces what is below it.
+  COMPOSITE_BLEND_NORMAL = 0,
+  COMPOSITE_BLEND_ADD,
+  COMPOSITE_BLEND_MULTIPLY,
+  COMPOSITE_BLEND_SCREEN,
+  /// Per channel maximum of the layer and what is below it.
+  COMPOSITE_BLEND_LIGHTEN,
+};
+
+/** One effect of an AddressableCompositeEffect, drawn on a range of the strip.
+ *
+ * Layers don't write the light themselves. Each frame the compositor advances every layer once with update(), then
+ * asks all of them for the color of each LED with pixel() while it walks the strip a single time.
+ */
+class CompositeLayer {
+ public:
+  virtual ~CompositeLayer() = default;
+
+  /// First LED of the range, negative indices count from the end of the strip like AddressableLight::range().
+  void set_from(int32_t from) { this->from_ = from; }
+  /// End of the range, exclusive. Without it the layer reaches the end of the strip.
+  void set_to(int32_t to) { this->to_ = to; }
+  void set_blend_mode(CompositeBlendMode blend_mode) { this->blend_mode_ = blend_mode; }
+  void set_opacity(float opacity) { this->opacity_ = to_uint8_scale(opacity); }
+
+  /// Called when the composite effect starts.
+  virtual void reset() {}
+  /// Advance the layer to now, once per frame. length is the number of LEDs in its range.
+  virtual void update(uint32_t now, int32_t length, const Color &current_color) = 0;
+  /// Color of the LED at index of the range, false where the layer leaves what is below it visible.
+  virtual bool pixel(int32_t index, Color *color) const = 0;
+
+ protected:
+  friend class AddressableCompositeEffect;
+
+  Color blend_(const Color &below, const Color &color) const;
+
+  int32_t from_{0};
+  int32_t to_{std::numeric_limits<int32_t>::max()};
+  // Resolved against the strip size every frame
+  int32_t begin_{0};
+  int32_t end_{0};
+  CompositeBlendMode blend_mode_{COMPOSITE_BLEND_NORMAL};
+  uint8_t opacity_{255};
+};
+
+/// Same colors as AddressableRainbowLightEffect.
+class CompositeRainbowLayer : public CompositeLayer {
+ public:
+  void set_speed(uint32_t speed) { this->speed_ = speed; }
+  void set_width(uint16_t width) { this->width_ = width; }
+  void update(uint32_t now, int32_t length, const Color &current_color) override {
+    this->hue_ = (now * this->speed_) % 0xFFFF;
+    this->add_ = 0xFFFF / this->width_;
+  }
+  bool pixel(int32_t index, Color *color) const override {
+    const uint16_t hue = this->hue_ + index * this->add_;
+    *color = ESPHSVColor(hue >> 8, 240, 255).to_rgb();
+    return true;
+  }
+
+ protected:
+  uint32_t speed_{10};
+  uint16_t width_{50};
+  uint16_t hue_{0};
+  uint16_t add_{0};
+};
+
+/// Same movement as AddressableScanEffect, in the current color of the light. The rest of the range is transparent.
+class CompositeScanLayer : public CompositeLayer {
+ public:
+  void set_move_interval(uint32_t move_interval) { this->move_interval_ = move_interval; }
+  void set_scan_width(uint32_t scan_width) { this->scan_width_ = scan_width; }
+  void reset() override {
+    this->at_led_ = 0;
+    this->direction_ = true;
+  }
+  void update(uint32_t now, int32_t length, const Color &current_color) override;
+  bool pixel(int32_t index, Color *color) const override {
+    if (index < this->at_led_ || index >= this->at_led_ + static_cast<int32_t>(this->scan_width_))
+      return false;
+    *color = this->color_;
+    return true;
+  }
+
+ protected:
+  uint32_t move_interval_{};
+  uint32_t scan_width_{1};
+  uint32_t last_move_{0};
+  int32_t at_led_{0};
+  Color color_{};
+  bool direction_{true};
+};
+
+/// Same colors as AddressableColorWipeEffect, LEDs the wipe hasn't reached yet are transparent.
+class CompositeColorWipeLayer : public CompositeLayer {
+ public:
+  void set_colors(const std::vector<AddressableColorWipeEffectColor> &colors) { this->sequence_.set_colors(colors); }
+  void set_add_led_interval(uint32_t add_led_interval) { this->add_led_interval_ = add_led_interval; }
+  void set_reverse(bool reverse) { this->reverse_ = reverse; }
+  void reset() override { this->filled_ = 0; }
+  void update(uint32_t now, int32_t length, const Color &current_color) override;
+  bool pixel(int32_t index, Color *color) const override {
+    const int32_t size = this->leds_.size();
+    if (this->reverse_ ? index < size - this->filled_ : index >= this->filled_)
+      return false;
+    int32_t slot = this->head_ + index;
+    if (slot >= size)
+      slot -= size;
+    *color = this->leds_[slot];
+    return true;
+  }
+
+ protected:
+  ColorWipeSequence sequence_;
+  // Ring buffer, the LED at index of the range is leds_[(head_ + index) % size] so adding one doesn't move the others
+  std::vector<Color> leds_;
+  int32_t head_{0};
+  int32_t filled_{0};
+  uint32_t last_add_{0};
+  uint32_t add_led_interval_{};
+  bool reverse_{};
+};
+
+/// Runs several layers on one strip and blends them in a single pass over its LEDs, bottom layer first.
+class AddressableCompositeEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableCompositeEffect(const std::string &name) : AddressableLightEffect(name) {}
+  void add_layer(CompositeLayer *layer) { this->layers_.push_back(layer); }
+  void start() override {
+    for (auto *layer : this->layers_)
+      layer->reset();
+  }
+  void apply(AddressableLight &it, const Color &current_color) override;
+
+ protected:
+  std::vector<CompositeLayer *> layers_;
+};
+
+}  // namespace light
+}  // namespace esphome
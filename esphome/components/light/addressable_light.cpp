@@ -99,8 +99,7 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
     uint8_t inv_alpha8 = 255 - alpha8;
     Color add = this->target_color_ * alpha8;
 
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+    this->light_.transform(0, this->light_.size(), [add, inv_alpha8](Color color) { return add + color * inv_alpha8; });
   }
 
   this->last_transition_progress_ = smoothed_progress;
@@ -5,6 +5,7 @@
 #include "esphome/core/color.h"
 #include "esp_color_correction.h"
 #include "esp_color_view.h"
+#include "esp_pixel_buffer.h"
 #include "esp_range_view.h"
 #include "light_output.h"
 #include "light_state.h"
@@ -60,6 +61,23 @@ class AddressableLight : public LightOutput, public Component {
       amnt = this->size();
     this->range(amnt, this->size()) = this->range(0, -amnt);
   }
+  /// Describe the raw output buffer for drivers keeping all LEDs interleaved in one array. Block operations like
+  /// range fills, shifts and the built-in effects then write it directly instead of creating a view per LED.
+  virtual bool get_pixel_buffer(PixelBuffer *buffer) { return false; }
+  const ESPColorCorrection &get_correction() const { return this->correction_; }
+  /// Replace the color of every LED in [from, to) by f(color), on uncorrected colors like ESPColorView::get().
+  template<typename F> void transform(int32_t from, int32_t to, F &&f) {
+    PixelBuffer buffer;
+    if (this->get_pixel_buffer(&buffer)) {
+      for (int32_t i = from; i < to; i++)
+        buffer.set(i, this->correction_.color_correct(f(this->correction_.color_uncorrect(buffer.get(i)))));
+      return;
+    }
+    for (int32_t i = from; i < to; i++) {
+      ESPColorView view = this->get_view_internal(i);
+      view.set(f(view.get()));
+    }
+  }
   // Indicates whether an effect that directly updates the output buffer is active to prevent overwriting
   bool is_effect_active() const { return this->effect_active_; }
   void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
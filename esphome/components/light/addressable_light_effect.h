@@ -88,6 +88,17 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
     hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
+    PixelBuffer buffer;
+    if (it.get_pixel_buffer(&buffer)) {
+      const ESPColorCorrection &correction = it.get_correction();
+      for (int32_t i = 0; i < it.size(); i++) {
+        hsv.hue = hue >> 8;
+        buffer.set_rgb(i, correction.color_correct(hsv.to_rgb()));
+        hue += add;
+      }
+      it.schedule_show();
+      return;
+    }
     for (auto var : it) {
       hsv.hue = hue >> 8;
       var = hsv;
@@ -110,22 +121,16 @@ struct AddressableColorWipeEffectColor {
   bool gradient;
 };
 
-class AddressableColorWipeEffect : public AddressableLightEffect {
+/// The colors a color wipe adds one LED at a time, shared by the effect and the compositor layer.
+class ColorWipeSequence {
  public:
-  explicit AddressableColorWipeEffect(const std::string &name) : AddressableLightEffect(name) {}
   void set_colors(const std::vector<AddressableColorWipeEffectColor> &colors) { this->colors_ = colors; }
-  void set_add_led_interval(uint32_t add_led_interval) { this->add_led_interval_ = add_led_interval; }
-  void set_reverse(bool reverse) { this->reverse_ = reverse; }
-  void apply(AddressableLight &it, const Color &current_color) override {
-    const uint32_t now = millis();
-    if (now - this->last_add_ < this->add_led_interval_)
-      return;
-    this->last_add_ = now;
-    if (this->reverse_) {
-      it.shift_left(1);
-    } else {
-      it.shift_right(1);
-    }
+  void reset() {
+    this->at_color_ = 0;
+    this->leds_added_ = 0;
+  }
+  /// Color of the next LED added.
+  Color next() {
     const AddressableColorWipeEffectColor &color = this->colors_[this->at_color_];
     Color esp_color = Color(color.r, color.g, color.b, color.w);
     if (color.gradient) {
@@ -135,11 +140,6 @@ class AddressableColorWipeEffect : public AddressableLightEffect {
       uint8_t gradient = 255 * ((float) this->leds_added_ / color.num_leds);
       esp_color = esp_color.gradient(next_esp_color, gradient);
     }
-    if (this->reverse_) {
-      it[-1] = esp_color;
-    } else {
-      it[0] = esp_color;
-    }
     if (++this->leds_added_ >= color.num_leds) {
       this->leds_added_ = 0;
       this->at_color_ = (this->at_color_ + 1) % this->colors_.size();
@@ -151,15 +151,44 @@ class AddressableColorWipeEffect : public AddressableLightEffect {
         new_color.b = c.b;
       }
     }
-    it.schedule_show();
+    return esp_color;
   }
 
  protected:
   std::vector<AddressableColorWipeEffectColor> colors_;
   size_t at_color_{0};
+  size_t leds_added_{0};
+};
+
+class AddressableColorWipeEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableColorWipeEffect(const std::string &name) : AddressableLightEffect(name) {}
+  void set_colors(const std::vector<AddressableColorWipeEffectColor> &colors) { this->sequence_.set_colors(colors); }
+  void set_add_led_interval(uint32_t add_led_interval) { this->add_led_interval_ = add_led_interval; }
+  void set_reverse(bool reverse) { this->reverse_ = reverse; }
+  void apply(AddressableLight &it, const Color &current_color) override {
+    const uint32_t now = millis();
+    if (now - this->last_add_ < this->add_led_interval_)
+      return;
+    this->last_add_ = now;
+    if (this->reverse_) {
+      it.shift_left(1);
+    } else {
+      it.shift_right(1);
+    }
+    const Color esp_color = this->sequence_.next();
+    if (this->reverse_) {
+      it[-1] = esp_color;
+    } else {
+      it[0] = esp_color;
+    }
+    it.schedule_show();
+  }
+
+ protected:
+  ColorWipeSequence sequence_;
   uint32_t last_add_{0};
   uint32_t add_led_interval_{};
-  size_t leds_added_{0};
   bool reverse_{};
 };
 
@@ -211,6 +240,40 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
       pos_add = pos_add32;
       this->last_progress_ += pos_add32 * this->progress_interval_;
     }
+    PixelBuffer buffer;
+    if (addressable.get_pixel_buffer(&buffer) && buffer.effect_data != nullptr) {
+      this->apply_buffer_(buffer, addressable.get_correction(), addressable.size(), current_color, pos_add);
+    } else {
+      this->apply_views_(addressable, current_color, pos_add);
+    }
+    while (random_float() < this->twinkle_probability_) {
+      const size_t pos = random_uint32() % addressable.size();
+      if (addressable[pos].get_effect_data() != 0)
+        continue;
+      addressable[pos].set_effect_data(1);
+    }
+    addressable.schedule_show();
+  }
+  void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
+  void set_progress_interval(uint32_t progress_interval) { this->progress_interval_ = progress_interval; }
+
+ protected:
+  void apply_buffer_(const PixelBuffer &buffer, const ESPColorCorrection &correction, int32_t size,
+                     const Color &current_color, uint8_t pos_add) {
+    const Color black = correction.color_correct(Color::BLACK);
+    for (int32_t i = 0; i < size; i++) {
+      uint8_t &effect_data = buffer.effect_data[i];
+      if (effect_data != 0) {
+        const uint8_t sine = half_sin8(effect_data);
+        buffer.set(i, correction.color_correct(current_color * sine));
+        const uint8_t new_pos = effect_data + pos_add;
+        effect_data = new_pos < effect_data ? 0 : new_pos;
+      } else {
+        buffer.set(i, black);
+      }
+    }
+  }
+  void apply_views_(AddressableLight &addressable, const Color &current_color, uint8_t pos_add) {
     for (auto view : addressable) {
       if (view.get_effect_data() != 0) {
         const uint8_t sine = half_sin8(view.get_effect_data());
@@ -225,18 +288,8 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
         view = Color::BLACK;
       }
     }
-    while (random_float() < this->twinkle_probability_) {
-      const size_t pos = random_uint32() % addressable.size();
-      if (addressable[pos].get_effect_data() != 0)
-        continue;
-      addressable[pos].set_effect_data(1);
-    }
-    addressable.schedule_show();
   }
-  void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
-  void set_progress_interval(uint32_t progress_interval) { this->progress_interval_ = progress_interval; }
 
- protected:
   float twinkle_probability_{0.05f};
   uint32_t progress_interval_{4};
   uint32_t last_progress_{0};
@@ -11,7 +11,9 @@ from esphome.const import (
     CONF_COLOR_TEMPERATURE,
     CONF_COLORS,
     CONF_DURATION,
+    CONF_FROM,
     CONF_GREEN,
+    CONF_ID,
     CONF_INTENSITY,
     CONF_LAMBDA,
     CONF_MAX_BRIGHTNESS,
@@ -23,7 +25,9 @@ from esphome.const import (
     CONF_SEQUENCE,
     CONF_SPEED,
     CONF_STATE,
+    CONF_TO,
     CONF_TRANSITION_LENGTH,
+    CONF_TYPE,
     CONF_UPDATE_INTERVAL,
     CONF_WARM_WHITE,
     CONF_WHITE,
@@ -37,6 +41,7 @@ from .types import (
     COLOR_MODES,
     AddressableColorWipeEffect,
     AddressableColorWipeEffectColor,
+    AddressableCompositeEffect,
     AddressableFireworksEffect,
     AddressableFlickerEffect,
     AddressableLambdaLightEffect,
@@ -48,6 +53,10 @@ from .types import (
     AutomationLightEffect,
     Color,
     ColorMode,
+    CompositeBlendMode,
+    CompositeColorWipeLayer,
+    CompositeRainbowLayer,
+    CompositeScanLayer,
     FlickerLightEffect,
     LambdaLightEffect,
     LightColorValues,
@@ -77,6 +86,10 @@ CONF_ADDRESSABLE_TWINKLE = "addressable_twinkle"
 CONF_ADDRESSABLE_RANDOM_TWINKLE = "addressable_random_twinkle"
 CONF_ADDRESSABLE_FIREWORKS = "addressable_fireworks"
 CONF_ADDRESSABLE_FLICKER = "addressable_flicker"
+CONF_ADDRESSABLE_COMPOSITE = "addressable_composite"
+CONF_BLEND_MODE = "blend_mode"
+CONF_LAYERS = "layers"
+CONF_OPACITY = "opacity"
 CONF_AUTOMATION = "automation"
 CONF_ON_LENGTH = "on_length"
 CONF_OFF_LENGTH = "off_length"
@@ -386,14 +399,42 @@ async def addressable_lambda_effect_to_code(config, effect_id):
     )
 
 
+ADDRESSABLE_RAINBOW_SCHEMA = {
+    cv.Optional(CONF_SPEED, default=10): cv.uint32_t,
+    cv.Optional(CONF_WIDTH, default=50): cv.uint32_t,
+}
+ADDRESSABLE_COLOR_WIPE_SCHEMA = {
+    cv.Optional(
+        CONF_COLORS, default=[{CONF_NUM_LEDS: 1, CONF_RANDOM: True}]
+    ): cv.ensure_list(
+        {
+            cv.Optional(CONF_RED, default=1.0): cv.percentage,
+            cv.Optional(CONF_GREEN, default=1.0): cv.percentage,
+            cv.Optional(CONF_BLUE, default=1.0): cv.percentage,
+            cv.Optional(CONF_WHITE, default=1.0): cv.percentage,
+            cv.Optional(CONF_RANDOM, default=False): cv.boolean,
+            cv.Required(CONF_NUM_LEDS): cv.All(cv.uint32_t, cv.Range(min=1)),
+            cv.Optional(CONF_GRADIENT, default=False): cv.boolean,
+        }
+    ),
+    cv.Optional(
+        CONF_ADD_LED_INTERVAL, default="0.1s"
+    ): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_REVERSE, default=False): cv.boolean,
+}
+ADDRESSABLE_SCAN_SCHEMA = {
+    cv.Optional(
+        CONF_MOVE_INTERVAL, default="0.1s"
+    ): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_SCAN_WIDTH, default=1): cv.int_range(min=1),
+}
+
+
 @register_addressable_effect(
     "addressable_rainbow",
     AddressableRainbowLightEffect,
     "Rainbow",
-    {
-        cv.Optional(CONF_SPEED, default=10): cv.uint32_t,
-        cv.Optional(CONF_WIDTH, default=50): cv.uint32_t,
-    },
+    ADDRESSABLE_RAINBOW_SCHEMA,
 )
 async def addressable_rainbow_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
@@ -402,32 +443,7 @@ async def addressable_rainbow_effect_to_code(config, effect_id):
     return var
 
 
-@register_addressable_effect(
-    "addressable_color_wipe",
-    AddressableColorWipeEffect,
-    "Color Wipe",
-    {
-        cv.Optional(
-            CONF_COLORS, default=[{CONF_NUM_LEDS: 1, CONF_RANDOM: True}]
-        ): cv.ensure_list(
-            {
-                cv.Optional(CONF_RED, default=1.0): cv.percentage,
-                cv.Optional(CONF_GREEN, default=1.0): cv.percentage,
-                cv.Optional(CONF_BLUE, default=1.0): cv.percentage,
-                cv.Optional(CONF_WHITE, default=1.0): cv.percentage,
-                cv.Optional(CONF_RANDOM, default=False): cv.boolean,
-                cv.Required(CONF_NUM_LEDS): cv.All(cv.uint32_t, cv.Range(min=1)),
-                cv.Optional(CONF_GRADIENT, default=False): cv.boolean,
-            }
-        ),
-        cv.Optional(
-            CONF_ADD_LED_INTERVAL, default="0.1s"
-        ): cv.positive_time_period_milliseconds,
-        cv.Optional(CONF_REVERSE, default=False): cv.boolean,
-    },
-)
-async def addressable_color_wipe_effect_to_code(config, effect_id):
-    var = cg.new_Pvariable(effect_id, config[CONF_NAME])
+def color_wipe_to_code(var, config):
     cg.add(var.set_add_led_interval(config[CONF_ADD_LED_INTERVAL]))
     cg.add(var.set_reverse(config[CONF_REVERSE]))
     colors = [
@@ -444,6 +460,17 @@ async def addressable_color_wipe_effect_to_code(config, effect_id):
         for color in config.get(CONF_COLORS, [])
     ]
     cg.add(var.set_colors(colors))
+
+
+@register_addressable_effect(
+    "addressable_color_wipe",
+    AddressableColorWipeEffect,
+    "Color Wipe",
+    ADDRESSABLE_COLOR_WIPE_SCHEMA,
+)
+async def addressable_color_wipe_effect_to_code(config, effect_id):
+    var = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    color_wipe_to_code(var, config)
     return var
 
 
@@ -451,12 +478,7 @@ async def addressable_color_wipe_effect_to_code(config, effect_id):
     "addressable_scan",
     AddressableScanEffect,
     "Scan",
-    {
-        cv.Optional(
-            CONF_MOVE_INTERVAL, default="0.1s"
-        ): cv.positive_time_period_milliseconds,
-        cv.Optional(CONF_SCAN_WIDTH, default=1): cv.int_range(min=1),
-    },
+    ADDRESSABLE_SCAN_SCHEMA,
 )
 async def addressable_scan_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
@@ -541,6 +563,72 @@ async def addressable_flicker_effect_to_code(config, effect_id):
     return var
 
 
+BLEND_MODES = {
+    "normal": CompositeBlendMode.COMPOSITE_BLEND_NORMAL,
+    "add": CompositeBlendMode.COMPOSITE_BLEND_ADD,
+    "multiply": CompositeBlendMode.COMPOSITE_BLEND_MULTIPLY,
+    "screen": CompositeBlendMode.COMPOSITE_BLEND_SCREEN,
+    "lighten": CompositeBlendMode.COMPOSITE_BLEND_LIGHTEN,
+}
+
+
+def _layer_schema(layer_type, schema):
+    return cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(layer_type),
+            cv.Optional(CONF_FROM, default=0): cv.int_,
+            cv.Optional(CONF_TO): cv.int_,
+            cv.Optional(CONF_BLEND_MODE, default="normal"): cv.enum(
+                BLEND_MODES, lower=True
+            ),
+            cv.Optional(CONF_OPACITY, default=1.0): cv.percentage,
+        }
+    ).extend(schema)
+
+
+LAYER_SCHEMA = cv.typed_schema(
+    {
+        "rainbow": _layer_schema(CompositeRainbowLayer, ADDRESSABLE_RAINBOW_SCHEMA),
+        "scan": _layer_schema(CompositeScanLayer, ADDRESSABLE_SCAN_SCHEMA),
+        "color_wipe": _layer_schema(
+            CompositeColorWipeLayer, ADDRESSABLE_COLOR_WIPE_SCHEMA
+        ),
+    },
+    lower=True,
+)
+
+
+@register_addressable_effect(
+    "addressable_composite",
+    AddressableCompositeEffect,
+    "Composite",
+    {
+        cv.Required(CONF_LAYERS): cv.All(
+            cv.ensure_list(LAYER_SCHEMA), cv.Length(min=1)
+        ),
+    },
+)
+async def addressable_composite_effect_to_code(config, effect_id):
+    var = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    for conf in config[CONF_LAYERS]:
+        layer = cg.new_Pvariable(conf[CONF_ID])
+        cg.add(layer.set_from(conf[CONF_FROM]))
+        if CONF_TO in conf:
+            cg.add(layer.set_to(conf[CONF_TO]))
+        cg.add(layer.set_blend_mode(conf[CONF_BLEND_MODE]))
+        cg.add(layer.set_opacity(conf[CONF_OPACITY]))
+        if conf[CONF_TYPE] == "rainbow":
+            cg.add(layer.set_speed(conf[CONF_SPEED]))
+            cg.add(layer.set_width(conf[CONF_WIDTH]))
+        elif conf[CONF_TYPE] == "scan":
+            cg.add(layer.set_move_interval(conf[CONF_MOVE_INTERVAL]))
+            cg.add(layer.set_scan_width(conf[CONF_SCAN_WIDTH]))
+        else:
+            color_wipe_to_code(layer, conf)
+        cg.add(var.add_layer(layer))
+    return var
+
+
 def validate_effects(allowed_effects):
     @schema_extractor("effects")
     def validator(value):
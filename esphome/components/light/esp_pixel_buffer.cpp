@@ -0,0 +1,32 @@
+#include "esp_pixel_buffer.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace light {
+
+void HOT PixelBuffer::fill(int32_t from, int32_t to, const Color &corrected) const {
+  if (to <= from)
+    return;
+  // Write one pixel, then keep doubling the filled part so the copies run at memcpy speed whatever the stride
+  this->set(from, corrected);
+  uint8_t *start = this->data + from * this->stride;
+  const size_t total = static_cast<size_t>(to - from) * this->stride;
+  size_t filled = this->stride;
+  while (filled < total) {
+    const size_t chunk = std::min(filled, total - filled);
+    memcpy(start + filled, start, chunk);
+    filled += chunk;
+  }
+}
+
+void HOT PixelBuffer::move(int32_t to, int32_t from, int32_t count) const {
+  if (count <= 0 || to == from)
+    return;
+  memmove(this->data + to * this->stride, this->data + from * this->stride, static_cast<size_t>(count) * this->stride);
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include "esphome/core/color.h"
+
+namespace esphome {
+namespace light {
+
+/** Layout of the output buffer of an addressable light driver keeping its LEDs interleaved in one array.
+ *
+ * Every pixel takes stride bytes and holds the color corrected channels at fixed offsets. Bytes outside the channels
+ * (like the brightness header of APA102 frames) must be the same for every pixel, block fills copy them along.
+ */
+struct PixelBuffer {
+  uint8_t *data{nullptr};
+  /// One byte per pixel, nullptr when the driver keeps no effect data
+  uint8_t *effect_data{nullptr};
+  uint8_t stride{3};
+  uint8_t red{0};
+  uint8_t green{1};
+  uint8_t blue{2};
+  /// Offset of the white channel, -1 without one
+  int8_t white{-1};
+
+  /// Write an already color corrected color to the pixel at index, white included.
+  inline void set(int32_t index, const Color &corrected) const ESPHOME_ALWAYS_INLINE {
+    uint8_t *pixel = this->data + index * this->stride;
+    pixel[this->red] = corrected.red;
+    pixel[this->green] = corrected.green;
+    pixel[this->blue] = corrected.blue;
+    if (this->white >= 0)
+      pixel[this->white] = corrected.white;
+  }
+  /// Write the red, green and blue channels of an already color corrected color, leaving white alone.
+  inline void set_rgb(int32_t index, const Color &corrected) const ESPHOME_ALWAYS_INLINE {
+    uint8_t *pixel = this->data + index * this->stride;
+    pixel[this->red] = corrected.red;
+    pixel[this->green] = corrected.green;
+    pixel[this->blue] = corrected.blue;
+  }
+  /// The color corrected color of the pixel at index, white is 0 without a white channel.
+  inline Color get(int32_t index) const ESPHOME_ALWAYS_INLINE {
+    const uint8_t *pixel = this->data + index * this->stride;
+    return Color(pixel[this->red], pixel[this->green], pixel[this->blue], this->white >= 0 ? pixel[this->white] : 0);
+  }
+
+  /// Set the pixels [from, to) to an already color corrected color.
+  void fill(int32_t from, int32_t to, const Color &corrected) const;
+  /// Copy count pixels starting at from to the pixels starting at to, the ranges may overlap.
+  void move(int32_t to, int32_t from, int32_t count) const;
+};
+
+}  // namespace light
+}  // namespace esphome
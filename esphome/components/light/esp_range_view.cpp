@@ -18,6 +18,11 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
+  PixelBuffer buffer;
+  if (this->parent_->get_pixel_buffer(&buffer)) {
+    buffer.fill(this->begin_, this->end_, this->parent_->get_correction().color_correct(color));
+    return;
+  }
   for (int32_t i = this->begin_; i < this->end_; i++) {
     (*this->parent_)[i] = color;
   }
@@ -45,20 +50,16 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  this->parent_->transform(this->begin_, this->end_, [amnt](Color color) { return color.fade_to_white(amnt); });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  this->parent_->transform(this->begin_, this->end_, [amnt](Color color) { return color.fade_to_black(amnt); });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->parent_->transform(this->begin_, this->end_, [delta](Color color) { return color.lighten(delta); });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->parent_->transform(this->begin_, this->end_, [delta](Color color) { return color.darken(delta); });
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
@@ -75,6 +76,13 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  // Both ranges hold corrected bytes of the same buffer, so they can be moved as they are
+  PixelBuffer buffer;
+  if (this->parent_->get_pixel_buffer(&buffer)) {
+    buffer.move(this->begin_, rhs.begin_, this->size());
+    return *this;
+  }
+
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
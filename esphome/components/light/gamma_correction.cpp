@@ -0,0 +1,39 @@
+#include "gamma_correction.h"
+#include "esphome/core/helpers.h"
+
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace light {
+
+namespace {
+struct GammaTable {
+  float gamma;
+  std::unique_ptr<float[]> values;
+};
+}  // namespace
+
+// Lights are configured with few distinct gammas, tables live for the whole runtime
+static std::vector<GammaTable> gamma_tables;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+GammaCorrection::GammaCorrection(float gamma) : gamma_(gamma) {
+  if (gamma < 2.0f)
+    return;
+  for (auto &table : gamma_tables) {
+    if (table.gamma == gamma) {
+      this->table_ = table.values.get();
+      return;
+    }
+  }
+  std::unique_ptr<float[]> values(new float[GAMMA_TABLE_SIZE + 1]);
+  for (uint16_t i = 0; i <= GAMMA_TABLE_SIZE; i++)
+    values[i] = gamma_correct(static_cast<float>(i) / GAMMA_TABLE_SIZE, gamma);
+  this->table_ = values.get();
+  gamma_tables.push_back({gamma, std::move(values)});
+}
+
+float GammaCorrection::correct_slow_(float value) const { return gamma_correct(value, this->gamma_); }
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace light {
+
+/// Intervals of the gamma lookup table, values in between are interpolated linearly.
+static const uint16_t GAMMA_TABLE_SIZE = 256;
+
+/** Applies the gamma correction of one gamma value through a lookup table instead of powf().
+ *
+ * The table is computed once per distinct gamma and shared by all lights using it. Linear interpolation keeps the
+ * error around 1e-5 for gammas from 2 to 3, below one step of a 16-bit PWM output, where an 8-bit table like the one
+ * of ESPColorCorrection would lose the low end of high resolution outputs. Gammas below 2 are too steep near zero to
+ * interpolate and keep using powf().
+ */
+class GammaCorrection {
+ public:
+  GammaCorrection(float gamma = 0.0f);  // NOLINT(google-explicit-constructor)
+
+  /// Gamma correct value, same as gamma_correct(value, gamma).
+  float correct(float value) const {
+    if (value <= 0.0f)
+      return 0.0f;
+    if (this->table_ == nullptr)
+      return this->correct_slow_(value);
+    if (value >= 1.0f)
+      return value == 1.0f ? 1.0f : this->correct_slow_(value);
+    const float position = value * GAMMA_TABLE_SIZE;
+    const uint16_t index = static_cast<uint16_t>(position);
+    const float fraction = position - index;
+    return this->table_[index] + (this->table_[index + 1] - this->table_[index]) * fraction;
+  }
+  float get_gamma() const { return this->gamma_; }
+
+ protected:
+  float correct_slow_(float value) const;
+
+  float gamma_;
+  /// GAMMA_TABLE_SIZE + 1 entries, nullptr when not interpolated
+  const float *table_{nullptr};
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -2,6 +2,7 @@
 
 #include "esphome/core/helpers.h"
 #include "color_mode.h"
+#include "gamma_correction.h"
 #include <cmath>
 
 namespace esphome {
@@ -135,53 +136,55 @@ class LightColorValues {
   void as_binary(bool *binary) const { *binary = this->state_ == 1.0f; }
 
   /// Convert these light color values to a brightness-only representation and write them to brightness.
-  void as_brightness(float *brightness, float gamma = 0) const {
-    *brightness = gamma_correct(this->state_ * this->brightness_, gamma);
+  void as_brightness(float *brightness, const GammaCorrection &gamma = {}) const {
+    *brightness = gamma.correct(this->state_ * this->brightness_);
   }
 
   /// Convert these light color values to an RGB representation and write them to red, green, blue.
-  void as_rgb(float *red, float *green, float *blue, float gamma = 0, bool color_interlock = false) const {
+  void as_rgb(float *red, float *green, float *blue, const GammaCorrection &gamma = {},
+              bool color_interlock = false) const {
     if (this->color_mode_ & ColorCapability::RGB) {
       float brightness = this->state_ * this->brightness_ * this->color_brightness_;
-      *red = gamma_correct(brightness * this->red_, gamma);
-      *green = gamma_correct(brightness * this->green_, gamma);
-      *blue = gamma_correct(brightness * this->blue_, gamma);
+      *red = gamma.correct(brightness * this->red_);
+      *green = gamma.correct(brightness * this->green_);
+      *blue = gamma.correct(brightness * this->blue_);
     } else {
       *red = *green = *blue = 0;
     }
   }
 
   /// Convert these light color values to an RGBW representation and write them to red, green, blue, white.
-  void as_rgbw(float *red, float *green, float *blue, float *white, float gamma = 0,
+  void as_rgbw(float *red, float *green, float *blue, float *white, const GammaCorrection &gamma = {},
                bool color_interlock = false) const {
     this->as_rgb(red, green, blue, gamma);
     if (this->color_mode_ & ColorCapability::WHITE) {
-      *white = gamma_correct(this->state_ * this->brightness_ * this->white_, gamma);
+      *white = gamma.correct(this->state_ * this->brightness_ * this->white_);
     } else {
       *white = 0;
     }
   }
 
   /// Convert these light color values to an RGBWW representation with the given parameters.
-  void as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white, float gamma = 0,
-                bool constant_brightness = false) const {
+  void as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white,
+                const GammaCorrection &gamma = {}, bool constant_brightness = false) const {
     this->as_rgb(red, green, blue, gamma);
     this->as_cwww(cold_white, warm_white, gamma, constant_brightness);
   }
 
   /// Convert these light color values to an RGB+CT+BR representation with the given parameters.
   void as_rgbct(float color_temperature_cw, float color_temperature_ww, float *red, float *green, float *blue,
-                float *color_temperature, float *white_brightness, float gamma = 0) const {
+                float *color_temperature, float *white_brightness, const GammaCorrection &gamma = {}) const {
     this->as_rgb(red, green, blue, gamma);
     this->as_ct(color_temperature_cw, color_temperature_ww, color_temperature, white_brightness, gamma);
   }
 
   /// Convert these light color values to an CWWW representation with the given parameters.
-  void as_cwww(float *cold_white, float *warm_white, float gamma = 0, bool constant_brightness = false) const {
+  void as_cwww(float *cold_white, float *warm_white, const GammaCorrection &gamma = {},
+               bool constant_brightness = false) const {
     if (this->color_mode_ & ColorCapability::COLD_WARM_WHITE) {
-      const float cw_level = gamma_correct(this->cold_white_, gamma);
-      const float ww_level = gamma_correct(this->warm_white_, gamma);
-      const float white_level = gamma_correct(this->state_ * this->brightness_, gamma);
+      const float cw_level = gamma.correct(this->cold_white_);
+      const float ww_level = gamma.correct(this->warm_white_);
+      const float white_level = gamma.correct(this->state_ * this->brightness_);
       if (!constant_brightness) {
         *cold_white = white_level * cw_level;
         *warm_white = white_level * ww_level;
@@ -202,12 +205,12 @@ class LightColorValues {
 
   /// Convert these light color values to a CT+BR representation with the given parameters.
   void as_ct(float color_temperature_cw, float color_temperature_ww, float *color_temperature, float *white_brightness,
-             float gamma = 0) const {
+             const GammaCorrection &gamma = {}) const {
     const float white_level = this->color_mode_ & ColorCapability::RGB ? this->white_ : 1;
     if (this->color_mode_ & ColorCapability::COLOR_TEMPERATURE) {
       *color_temperature =
           (this->color_temperature_ - color_temperature_cw) / (color_temperature_ww - color_temperature_cw);
-      *white_brightness = gamma_correct(this->state_ * this->brightness_ * white_level, gamma);
+      *white_brightness = gamma.correct(this->state_ * this->brightness_ * white_level);
     } else {  // Probably won't get here but put this here anyway.
       *white_brightness = 0;
     }
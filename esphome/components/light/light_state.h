@@ -272,6 +272,8 @@ class LightState : public EntityBase, public Component {
   uint32_t flash_transition_length_{};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
+  /// Cached curve of gamma_correct_, used by the current_values_as_* methods
+  GammaCorrection gamma_correction_{};
   /// Whether the light value should be written in the next cycle.
   bool next_write_{true};
   // for effects, true if a transformer (transition) is active.
@@ -85,3 +85,11 @@ AddressableFireworksEffect = light_ns.class_(
 AddressableFlickerEffect = light_ns.class_(
     "AddressableFlickerEffect", AddressableLightEffect
 )
+AddressableCompositeEffect = light_ns.class_(
+    "AddressableCompositeEffect", AddressableLightEffect
+)
+CompositeLayer = light_ns.class_("CompositeLayer")
+CompositeRainbowLayer = light_ns.class_("CompositeRainbowLayer", CompositeLayer)
+CompositeScanLayer = light_ns.class_("CompositeScanLayer", CompositeLayer)
+CompositeColorWipeLayer = light_ns.class_("CompositeColorWipeLayer", CompositeLayer)
+CompositeBlendMode = light_ns.enum("CompositeBlendMode")
@@ -1,3 +1,4 @@
+import logging
 import re
 
 from esphome import automation
@@ -39,6 +40,7 @@ from esphome.const import (
     CONF_LOGGER,
     CONF_LOGS,
     CONF_ON_MESSAGE,
+    CONF_RATE,
     CONF_TAG,
     CONF_TRIGGER_ID,
     CONF_TX_BUFFER_SIZE,
@@ -53,6 +55,8 @@ from esphome.const import (
 )
 from esphome.core import CORE, CoroPriority, Lambda, coroutine_with_priority
 
+_LOGGER = logging.getLogger(__name__)
+
 CODEOWNERS = ["@esphome/core"]
 logger_ns = cg.esphome_ns.namespace("logger")
 LOG_LEVELS = {
@@ -96,6 +100,10 @@ DEFAULT = "DEFAULT"
 CONF_INITIAL_LEVEL = "initial_level"
 CONF_LOGGER_ID = "logger_id"
 CONF_RUNTIME_TAG_LEVELS = "runtime_tag_levels"
+CONF_RATE_LIMITS = "rate_limits"
+CONF_COMPONENT_MAX_LEVELS = "component_max_levels"
+CONF_BURST = "burst"
+CONF_SAMPLE = "sample"
 CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
 
 UART_SELECTION_ESP32 = {
@@ -173,6 +181,37 @@ def uart_selection(value):
     raise NotImplementedError
 
 
+def validate_component_max_levels(value):
+    global_level = LOG_LEVEL_SEVERITY.index(value[CONF_LEVEL])
+    for component, level in value.get(CONF_COMPONENT_MAX_LEVELS, {}).items():
+        if LOG_LEVEL_SEVERITY.index(level) >= global_level:
+            raise cv.Invalid(
+                f"The maximum log level for {component} ({level}) must be less verbose "
+                f"than the global log level {value[CONF_LEVEL]}."
+            )
+    return value
+
+
+def validate_rate_limit(value):
+    if CONF_BURST in value and CONF_RATE not in value:
+        raise cv.Invalid(f"'{CONF_BURST}' requires '{CONF_RATE}'")
+    return value
+
+
+# Messages per second in bursts of up to burst messages, one in sample of them kept
+RATE_LIMIT_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_RATE): cv.int_range(min=1, max=1000),
+            cv.Optional(CONF_BURST): cv.int_range(min=1, max=1000),
+            cv.Optional(CONF_SAMPLE): cv.int_range(min=1, max=65535),
+        }
+    ),
+    cv.has_at_least_one_key(CONF_RATE, CONF_SAMPLE),
+    validate_rate_limit,
+)
+
+
 def validate_local_no_higher_than_global(value):
     global_level = LOG_LEVEL_SEVERITY.index(value[CONF_LEVEL])
     for tag, level in value.get(CONF_LOGS, {}).items():
@@ -251,6 +290,16 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_INITIAL_LEVEL): is_log_level,
             cv.Optional(CONF_RUNTIME_TAG_LEVELS, default=False): cv.boolean,
+            cv.Optional(CONF_COMPONENT_MAX_LEVELS, default={}): cv.Schema(
+                {
+                    cv.string_strict: is_log_level,
+                }
+            ),
+            cv.Optional(CONF_RATE_LIMITS, default={}): cv.Schema(
+                {
+                    cv.string: RATE_LIMIT_SCHEMA,
+                }
+            ),
             cv.Optional(CONF_ON_MESSAGE): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(LoggerMessageTrigger),
@@ -263,6 +312,7 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
+    validate_component_max_levels,
 )
 
 
@@ -300,6 +350,31 @@ async def to_code(config):
         for tag, log_level in logs_config.items():
             cg.add(log.set_log_level(tag, LOG_LEVELS[log_level]))
 
+    # Log calls above these levels are compiled out of the sources of the component
+    if component_max_levels := config[CONF_COMPONENT_MAX_LEVELS]:
+        for component in component_max_levels:
+            if component not in CORE.loaded_integrations:
+                _LOGGER.warning(
+                    "%s: component '%s' is not used",
+                    CONF_COMPONENT_MAX_LEVELS,
+                    component,
+                )
+        entries = ", ".join(
+            f'{{"{component}", {LOG_LEVEL_SEVERITY.index(component_level)}}}'
+            for component, component_level in component_max_levels.items()
+        )
+        cg.add_define("ESPHOME_LOG_COMPONENT_LEVELS", cg.RawExpression(entries))
+
+    if rate_limits := config[CONF_RATE_LIMITS]:
+        cg.add_define("USE_LOGGER_TAG_RATE_LIMITS")
+        for tag, limit in rate_limits.items():
+            rate = limit.get(CONF_RATE, 0)
+            cg.add(
+                log.set_tag_rate_limit(
+                    tag, rate, limit.get(CONF_BURST, rate), limit.get(CONF_SAMPLE, 1)
+                )
+            )
+
     cg.add_define("USE_LOGGER")
     this_severity = LOG_LEVEL_SEVERITY.index(level)
     cg.add_build_flag(f"-DESPHOME_LOG_LEVEL={LOG_LEVELS[level]}")
@@ -422,7 +497,9 @@ LOGGER_LOG_ACTION_SCHEMA = cv.All(
 )
 
 
-@automation.register_action(CONF_LOGGER_LOG, LambdaAction, LOGGER_LOG_ACTION_SCHEMA)
+@automation.register_action(
+    CONF_LOGGER_LOG, LambdaAction, LOGGER_LOG_ACTION_SCHEMA, synchronous=True
+)
 async def logger_log_action_to_code(config, action_id, template_arg, args):
     esp_log = LOG_LEVEL_TO_ESP_LOG[config[CONF_LEVEL]]
     args_ = [cg.RawExpression(str(x)) for x in config[CONF_ARGS]]
@@ -1,4 +1,5 @@
 #include "logger.h"
+#include <algorithm>
 #include <cinttypes>
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
 #include <memory>  // For unique_ptr
@@ -24,8 +25,12 @@ static const char *const TAG = "logger";
 //    - Fallback to emergency console logging only if ring buffer is full
 //  - WITHOUT task log buffer: Only emergency console output, no callbacks
 void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag))
+  if (level > this->sink_level_ || level > this->level_for(tag))
     return;
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  if (this->is_rate_limited_(tag))
+    return;
+#endif
 
   TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
   bool is_main_task = (current_task == main_task_);
@@ -74,8 +79,12 @@ void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const ch
 #else
 // Implementation for all other platforms
 void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || global_recursion_guard_)
+  if (level > this->sink_level_ || level > this->level_for(tag) || global_recursion_guard_)
+    return;
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  if (this->is_rate_limited_(tag))
     return;
+#endif
 
   global_recursion_guard_ = true;
 
@@ -110,8 +119,12 @@ void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const ch
 //
 void Logger::log_vprintf_(uint8_t level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || global_recursion_guard_)
+  if (level > this->sink_level_ || level > this->level_for(tag) || global_recursion_guard_)
+    return;
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  if (this->is_rate_limited_(tag))
     return;
+#endif
 
   global_recursion_guard_ = true;
   this->tx_buffer_at_ = 0;
@@ -156,7 +169,39 @@ inline uint8_t Logger::level_for(const char *tag) {
   return this->current_level_;
 }
 
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+// Other tasks may race on the bucket of a tag they share with the main loop, the worst case is a message
+// more or less getting through, which is not worth a lock on every log call.
+inline bool Logger::is_rate_limited_(const char *tag) {
+  auto it = this->rate_limits_.find(tag);
+  if (it == this->rate_limits_.end())
+    return false;
+  TagRateLimit &limit = it->second;
+  if (limit.rate != 0) {
+    const uint32_t now = millis();
+    const uint32_t max_tokens = limit.burst * 1000u;
+    // Cap the elapsed time at what fills the bucket so the multiplication can't overflow after a long silence
+    const uint32_t elapsed = std::min<uint32_t>(now - limit.last_refill_ms, max_tokens / limit.rate + 1);
+    limit.last_refill_ms = now;
+    limit.tokens = std::min(limit.tokens + elapsed * limit.rate, max_tokens);
+    if (limit.tokens < 1000) {
+      return true;
+    }
+    limit.tokens -= 1000;
+  }
+  if (limit.sample > 1) {
+    if (limit.sample_counter != 0) {
+      limit.sample_counter = (limit.sample_counter + 1) % limit.sample;
+      return true;
+    }
+    limit.sample_counter = 1;
+  }
+  return false;
+}
+#endif
+
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size) {
+  this->update_sink_level_();
   // add 1 to buffer size for null terminator
   this->tx_buffer_ = new char[this->tx_buffer_size_ + 1];  // NOLINT
 #if defined(USE_ESP32) || defined(USE_LIBRETINY)
@@ -221,17 +266,53 @@ void Logger::process_messages_() {
 #endif
 }
 
-void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
+void Logger::set_baud_rate(uint32_t baud_rate) {
+  this->baud_rate_ = baud_rate;
+  this->update_sink_level_();
+}
 #ifdef USE_LOGGER_RUNTIME_TAG_LEVELS
 void Logger::set_log_level(const char *tag, uint8_t log_level) { this->log_levels_[tag] = log_level; }
 #endif
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+void Logger::set_tag_rate_limit(const char *tag, uint16_t rate, uint16_t burst, uint16_t sample) {
+  if (burst == 0)
+    burst = 1;
+  this->rate_limits_[tag] = TagRateLimit{
+      .tokens = burst * 1000u,
+      .last_refill_ms = millis(),
+      .rate = rate,
+      .burst = burst,
+      .sample = sample == 0 ? uint16_t(1) : sample,
+      .sample_counter = 0,
+  };
+}
+#endif
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY) || defined(USE_ZEPHYR)
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
-void Logger::add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback) {
+size_t Logger::add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback,
+                                   uint8_t level) {
   this->log_callback_.add(std::move(callback));
+  this->callback_levels_.push_back(level);
+  this->update_sink_level_();
+  return this->callback_levels_.size() - 1;
+}
+
+void Logger::set_log_callback_level(size_t handle, uint8_t level) {
+  if (handle >= this->callback_levels_.size() || this->callback_levels_[handle] == level)
+    return;
+  this->callback_levels_[handle] = level;
+  this->update_sink_level_();
+}
+
+void Logger::update_sink_level_() {
+  // The console takes everything the tag levels let through
+  uint8_t level = this->baud_rate_ > 0 ? ESPHOME_LOG_LEVEL_VERY_VERBOSE : ESPHOME_LOG_LEVEL_NONE;
+  for (uint8_t callback_level : this->callback_levels_)
+    level = std::max(level, callback_level);
+  this->sink_level_ = level;
 }
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 
@@ -271,7 +352,10 @@ void Logger::dump_config() {
 #endif
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   if (this->log_buffer_) {
-    ESP_LOGCONFIG(TAG, "  Task Log Buffer Size: %u", this->log_buffer_->size());
+    ESP_LOGCONFIG(TAG,
+                  "  Task Log Buffer Size: %u\n"
+                  "  Task Log Rings: %u",
+                  this->log_buffer_->size(), (unsigned) logger::TASK_LOG_RING_COUNT);
   }
 #endif
 
@@ -280,6 +364,12 @@ void Logger::dump_config() {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.first, LOG_STR_ARG(LOG_LEVELS[it.second]));
   }
 #endif
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  for (auto &it : this->rate_limits_) {
+    ESP_LOGCONFIG(TAG, "  Rate limit for '%s': %u/s, burst %u, sample 1 in %u", it.first, it.second.rate,
+                  it.second.burst, it.second.sample);
+  }
+#endif
 }
 
 void Logger::set_log_level(uint8_t level) {
@@ -2,6 +2,7 @@
 
 #include <cstdarg>
 #include <map>
+#include <vector>
 #ifdef USE_ESP32
 #include <pthread.h>
 #endif
@@ -36,13 +37,26 @@ struct device;
 
 namespace esphome::logger {
 
-#ifdef USE_LOGGER_RUNTIME_TAG_LEVELS
-// Comparison function for const char* keys in log_levels_ map
+#if defined(USE_LOGGER_RUNTIME_TAG_LEVELS) || defined(USE_LOGGER_TAG_RATE_LIMITS)
+// Comparison function for const char* keys in log_levels_ and rate_limits_ maps
 struct CStrCompare {
   bool operator()(const char *a, const char *b) const { return strcmp(a, b) < 0; }
 };
 #endif
 
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+// Token bucket and sampling state of one tag. Tokens are kept in thousandths of a message so a refill of
+// rate messages per second is exact per millisecond.
+struct TagRateLimit {
+  uint32_t tokens;          // Available messages * 1000
+  uint32_t last_refill_ms;  // When tokens were last topped up
+  uint16_t rate;            // Messages per second refilled into the bucket, 0 for no rate limit
+  uint16_t burst;           // Bucket size in messages
+  uint16_t sample;          // Keep one in sample messages, 1 keeps all
+  uint16_t sample_counter;  // Messages seen since the last one kept
+};
+#endif
+
 // ANSI color code last digit (30-38 range, store only last digit to save RAM)
 static constexpr char LOG_LEVEL_COLOR_DIGIT[] = {
     '\0',  // NONE
@@ -118,6 +132,8 @@ class Logger : public Component {
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   void init_log_buffer(size_t total_buffer_size);
+  /// Messages from other tasks lost because their task log ring was full.
+  uint32_t get_dropped_messages() const { return this->log_buffer_ ? this->log_buffer_->get_dropped_count() : 0; }
 #endif
 #if defined(USE_ESPHOME_TASK_LOG_BUFFER) || (defined(USE_ZEPHYR) && defined(USE_LOGGER_USB_CDC))
   void loop() override;
@@ -143,6 +159,11 @@ class Logger : public Component {
 #ifdef USE_LOGGER_RUNTIME_TAG_LEVELS
   /// Set the log level of the specified tag.
   void set_log_level(const char *tag, uint8_t log_level);
+#endif
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  /// Limit the specified tag to rate messages per second with bursts of up to burst messages (rate 0 disables the
+  /// limit), and only keep one in sample of the messages passing it.
+  void set_tag_rate_limit(const char *tag, uint16_t rate, uint16_t burst, uint16_t sample);
 #endif
   uint8_t get_log_level() { return this->current_level_; }
 
@@ -154,8 +175,13 @@ class Logger : public Component {
 
   inline uint8_t level_for(const char *tag);
 
-  /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback);
+  /// Register a callback that will be called for every log message sent up to level.
+  /// Messages above the level of every callback and the console are dropped before they are formatted, so sinks
+  /// should pass the level they actually use. Returns a handle for set_log_callback_level().
+  size_t add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback,
+                             uint8_t level = ESPHOME_LOG_LEVEL_VERY_VERBOSE);
+  /// Change the level a callback consumes, e.g. as its subscribers come and go.
+  void set_log_callback_level(size_t handle, uint8_t level);
 
   // add a listener for log level changes
   void add_listener(std::function<void(uint8_t)> &&callback) { this->level_callback_.add(std::move(callback)); }
@@ -169,8 +195,14 @@ class Logger : public Component {
 #endif
 
  protected:
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  /// Whether a message of tag is suppressed by its rate limit or sampling; consumes a token when it is not.
+  inline bool is_rate_limited_(const char *tag);
+#endif
   void process_messages_();
   void write_msg_(const char *msg);
+  // Recompute sink_level_ from the console and the callback levels
+  void update_sink_level_();
 
   // Format a log message with printf-style arguments and write it to a buffer with header, footer, and null terminator
   // It's the caller's responsibility to initialize buffer_at (typically to 0)
@@ -253,8 +285,13 @@ class Logger : public Component {
   // Large objects (internally aligned)
 #ifdef USE_LOGGER_RUNTIME_TAG_LEVELS
   std::map<const char *, uint8_t, CStrCompare> log_levels_{};
+#endif
+#ifdef USE_LOGGER_TAG_RATE_LIMITS
+  std::map<const char *, TagRateLimit, CStrCompare> rate_limits_{};
 #endif
   CallbackManager<void(uint8_t, const char *, const char *, size_t)> log_callback_{};
+  // Highest level each log callback consumes, indexed by the handle add_on_log_callback() returned
+  std::vector<uint8_t> callback_levels_{};
   CallbackManager<void(uint8_t)> level_callback_{};
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   std::unique_ptr<logger::TaskLogBuffer> log_buffer_;  // Will be initialized with init_log_buffer
@@ -264,6 +301,8 @@ class Logger : public Component {
   uint16_t tx_buffer_at_{0};
   uint16_t tx_buffer_size_{0};
   uint8_t current_level_{ESPHOME_LOG_LEVEL_VERY_VERBOSE};
+  // Highest level any sink consumes, messages above it are never formatted
+  uint8_t sink_level_{ESPHOME_LOG_LEVEL_NONE};
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_ZEPHYR)
   UARTSelection uart_{UART_SELECTION_UART0};
 #endif
@@ -441,11 +480,13 @@ class LoggerMessageTrigger : public Trigger<uint8_t, const char *, const char *>
  public:
   explicit LoggerMessageTrigger(Logger *parent, uint8_t level) {
     this->level_ = level;
-    parent->add_on_log_callback([this](uint8_t level, const char *tag, const char *message, size_t message_len) {
-      if (level <= this->level_) {
-        this->trigger(level, tag, message);
-      }
-    });
+    parent->add_on_log_callback(
+        [this](uint8_t level, const char *tag, const char *message, size_t message_len) {
+          if (level <= this->level_) {
+            this->trigger(level, tag, message);
+          }
+        },
+        level);
   }
 
  protected:
@@ -0,0 +1,52 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_LOGGER,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+import esphome.final_validate as fv
+
+from .. import CONF_LOGGER_ID, CONF_TASK_LOG_BUFFER_SIZE, Logger, logger_ns
+
+LoggerDroppedSensor = logger_ns.class_(
+    "LoggerDroppedSensor", sensor.Sensor, cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.All(
+    sensor.sensor_schema(
+        LoggerDroppedSensor,
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+    .extend(
+        {
+            cv.GenerateID(CONF_LOGGER_ID): cv.use_id(Logger),
+        }
+    )
+    .extend(cv.polling_component_schema("60s")),
+    cv.only_on_esp32,
+)
+
+
+def _final_validate(config):
+    logger_conf = fv.full_config.get().get(CONF_LOGGER, {})
+    if logger_conf.get(CONF_TASK_LOG_BUFFER_SIZE, 0) == 0:
+        raise cv.Invalid(
+            f"The logger sensor counts messages dropped by the task log buffer, "
+            f"'{CONF_TASK_LOG_BUFFER_SIZE}' must not be 0"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = await sensor.new_sensor(config)
+    await cg.register_component(var, config)
+    await cg.register_parented(var, config[CONF_LOGGER_ID])
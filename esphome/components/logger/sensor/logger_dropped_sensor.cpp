@@ -0,0 +1,11 @@
+#include "logger_dropped_sensor.h"
+
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+namespace esphome::logger {
+
+static const char *const TAG = "logger.sensor";
+
+void LoggerDroppedSensor::dump_config() { LOG_SENSOR("", "Logger Dropped Messages", this); }
+
+}  // namespace esphome::logger
+#endif
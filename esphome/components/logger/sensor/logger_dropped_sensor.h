@@ -0,0 +1,16 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+#include "esphome/components/logger/logger.h"
+
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+namespace esphome::logger {
+/// Reports how many messages from other tasks the task log buffer had to drop.
+class LoggerDroppedSensor : public PollingComponent, public sensor::Sensor, public Parented<Logger> {
+ public:
+  void update() override { this->publish_state(this->parent_->get_dropped_messages()); }
+  void dump_config() override;
+};
+}  // namespace esphome::logger
+#endif
@@ -1,5 +1,6 @@
 
 #include "task_log_buffer.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
@@ -10,19 +11,28 @@ namespace esphome::logger {
 TaskLogBuffer::TaskLogBuffer(size_t total_buffer_size) {
   // Store the buffer size
   this->size_ = total_buffer_size;
-  // Allocate memory for the ring buffer using ESPHome's RAM allocator
+  // Allocate memory for all rings at once using ESPHome's RAM allocator
   RAMAllocator<uint8_t> allocator;
   this->storage_ = allocator.allocate(this->size_);
-  // Create a static ring buffer with RINGBUF_TYPE_NOSPLIT for message integrity
-  this->ring_buffer_ = xRingbufferCreateStatic(this->size_, RINGBUF_TYPE_NOSPLIT, this->storage_, &this->structure_);
+  // Each core gets its own ring so concurrent producers on different cores never contend,
+  // the ring storage has to stay 32-bit aligned
+  const size_t ring_size = (this->size_ / TASK_LOG_RING_COUNT) & ~size_t(3);
+  for (size_t i = 0; i < TASK_LOG_RING_COUNT; i++) {
+    // Create a static ring buffer with RINGBUF_TYPE_NOSPLIT for message integrity
+    this->rings_[i].handle = xRingbufferCreateStatic(ring_size, RINGBUF_TYPE_NOSPLIT, this->storage_ + i * ring_size,
+                                                     &this->rings_[i].structure);
+  }
 }
 
 TaskLogBuffer::~TaskLogBuffer() {
-  if (this->ring_buffer_ != nullptr) {
-    // Delete the ring buffer
-    vRingbufferDelete(this->ring_buffer_);
-    this->ring_buffer_ = nullptr;
-
+  for (auto &ring : this->rings_) {
+    if (ring.handle != nullptr) {
+      // Delete the ring buffer
+      vRingbufferDelete(ring.handle);
+      ring.handle = nullptr;
+    }
+  }
+  if (this->storage_ != nullptr) {
     // Free the allocated memory
     RAMAllocator<uint8_t> allocator;
     allocator.deallocate(this->storage_, this->size_);
@@ -35,16 +45,27 @@ bool TaskLogBuffer::borrow_message_main_loop(LogMessage **message, const char **
     return false;
   }
 
-  size_t item_size = 0;
-  void *received_item = xRingbufferReceive(ring_buffer_, &item_size, 0);
-  if (received_item == nullptr) {
+  // Keep the head of every ring and hand out the oldest, so messages from different cores come out in
+  // the order they were logged
+  Ring *oldest = nullptr;
+  for (auto &ring : this->rings_) {
+    if (ring.head == nullptr) {
+      size_t item_size = 0;
+      ring.head = static_cast<LogMessage *>(xRingbufferReceive(ring.handle, &item_size, 0));
+      if (ring.head == nullptr)
+        continue;
+    }
+    if (oldest == nullptr || static_cast<int32_t>(ring.head->timestamp - oldest->head->timestamp) < 0)
+      oldest = &ring;
+  }
+  if (oldest == nullptr) {
     return false;
   }
 
-  LogMessage *msg = static_cast<LogMessage *>(received_item);
+  LogMessage *msg = oldest->head;
   *message = msg;
   *text = msg->text_data();
-  *received_token = received_item;
+  *received_token = msg;
 
   return true;
 }
@@ -53,7 +74,13 @@ void TaskLogBuffer::release_message_main_loop(void *token) {
   if (token == nullptr) {
     return;
   }
-  vRingbufferReturnItem(ring_buffer_, token);
+  for (auto &ring : this->rings_) {
+    if (ring.head == token) {
+      vRingbufferReturnItem(ring.handle, token);
+      ring.head = nullptr;
+      break;
+    }
+  }
   // Update counter to mark all messages as processed
   last_processed_counter_ = message_counter_.load(std::memory_order_relaxed);
 }
@@ -77,17 +104,21 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
   // Calculate total size needed (header + text length + null terminator)
   size_t total_size = sizeof(LogMessage) + text_length + 1;
 
-  // Acquire memory directly from the ring buffer
+  // Acquire memory directly from the ring of the current core. The task may migrate before the send
+  // completes, that only costs a little contention as the ring handle is kept.
+  RingbufHandle_t ring_buffer = this->rings_[TASK_LOG_RING_COUNT > 1 ? xPortGetCoreID() : 0].handle;
   void *acquired_memory = nullptr;
-  BaseType_t result = xRingbufferSendAcquire(ring_buffer_, &acquired_memory, total_size, 0);
+  BaseType_t result = xRingbufferSendAcquire(ring_buffer, &acquired_memory, total_size, 0);
 
   if (result != pdTRUE || acquired_memory == nullptr) {
+    this->count_dropped();
     return false;  // Failed to acquire memory
   }
 
   // Set up the message header in the acquired memory
   LogMessage *msg = static_cast<LogMessage *>(acquired_memory);
   msg->level = level;
+  msg->timestamp = micros();
   msg->tag = tag;
   msg->line = line;
 
@@ -109,7 +140,7 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
 
   // Handle unexpected formatting error
   if (ret <= 0) {
-    vRingbufferReturnItem(ring_buffer_, acquired_memory);
+    vRingbufferReturnItem(ring_buffer, acquired_memory);
     return false;
   }
 
@@ -120,7 +151,7 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
 
   msg->text_length = text_length;
   // Complete the send operation with the acquired memory
-  result = xRingbufferSendComplete(ring_buffer_, acquired_memory);
+  result = xRingbufferSendComplete(ring_buffer, acquired_memory);
 
   if (result != pdTRUE) {
     return false;  // Failed to complete the message send
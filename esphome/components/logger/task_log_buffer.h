@@ -13,11 +13,15 @@
 
 namespace esphome::logger {
 
+/// Number of rings, one per core so tasks logging concurrently on different cores never share a ring
+static constexpr size_t TASK_LOG_RING_COUNT = portNUM_PROCESSORS;
+
 class TaskLogBuffer {
  public:
   // Structure for a log message header (text data follows immediately after)
   struct LogMessage {
     const char *tag;       // We store the pointer, assuming tags are static
+    uint32_t timestamp;    // micros() when the message was queued, used to merge the per-core rings
     char thread_name[16];  // Store thread name directly (only used for non-main threads)
     uint16_t text_length;  // Length of the message text (up to ~64KB)
     uint16_t line;         // Source code line number
@@ -29,11 +33,11 @@ class TaskLogBuffer {
     inline const char *text_data() const { return reinterpret_cast<const char *>(this) + sizeof(LogMessage); }
   };
 
-  // Constructor that takes a total buffer size
+  // Constructor that takes a total buffer size, split evenly between the rings
   explicit TaskLogBuffer(size_t total_buffer_size);
   ~TaskLogBuffer();
 
-  // NOT thread-safe - borrow a message from the ring buffer, only call from main loop
+  // NOT thread-safe - borrow the oldest message of all rings, only call from main loop
   bool borrow_message_main_loop(LogMessage **message, const char **text, void **received_token);
 
   // NOT thread-safe - release a message buffer and update the counter, only call from main loop
@@ -51,11 +55,22 @@ class TaskLogBuffer {
   // Get the total buffer size in bytes
   inline size_t size() const { return size_; }
 
+  // Messages lost because the ring of the sending core was full
+  inline uint32_t get_dropped_count() const { return dropped_counter_.load(std::memory_order_relaxed); }
+  // Thread-safe - count a message that could not be queued
+  inline void count_dropped() { dropped_counter_.fetch_add(1, std::memory_order_relaxed); }
+
  private:
-  RingbufHandle_t ring_buffer_{nullptr};  // FreeRTOS ring buffer handle
-  StaticRingbuffer_t structure_;          // Static structure for the ring buffer
-  uint8_t *storage_{nullptr};             // Pointer to allocated memory
-  size_t size_{0};                        // Size of allocated memory
+  struct Ring {
+    RingbufHandle_t handle{nullptr};  // FreeRTOS ring buffer handle
+    StaticRingbuffer_t structure;     // Static structure for the ring buffer
+    LogMessage *head{nullptr};        // Message received by the main loop but not yet processed
+  };
+
+  Ring rings_[TASK_LOG_RING_COUNT];
+  uint8_t *storage_{nullptr};  // Pointer to allocated memory, shared by all rings
+  size_t size_{0};             // Size of allocated memory
+  std::atomic<uint32_t> dropped_counter_{0};
 
   // Atomic counter for message tracking (only differences matter)
   std::atomic<uint16_t> message_counter_{0};    // Incremented when messages are committed
@@ -55,6 +55,7 @@ from .styles import add_top_layer, styles_to_code, theme_to_code
 from .touchscreens import touchscreen_schema, touchscreens_to_code
 from .trigger import add_on_boot_triggers, generate_triggers
 from .types import (
+    BufferMemory,
     FontEngine,
     IdleTrigger,
     ObjUpdateAction,
@@ -105,6 +106,12 @@ AUTO_LOAD = ["key_provider"]
 CODEOWNERS = ["@clydebarrow"]
 LOGGER = logging.getLogger(__name__)
 
+BUFFER_MEMORY = {
+    "auto": BufferMemory.BUFFER_MEMORY_AUTO,
+    "internal": BufferMemory.BUFFER_MEMORY_INTERNAL,
+    "psram": BufferMemory.BUFFER_MEMORY_PSRAM,
+}
+
 for w_type in (
     label_spec,
     obj_spec,
@@ -221,8 +228,12 @@ def final_validation(configs):
                     draw_rounding, config[CONF_DRAW_ROUNDING]
                 )
         buffer_frac = config[CONF_BUFFER_SIZE]
+        if config[df.CONF_DOUBLE_BUFFER]:
+            buffer_frac *= 2
         if CORE.is_esp32 and buffer_frac > 0.5 and PSRAM_DOMAIN not in global_config:
             LOGGER.warning("buffer_size: may need to be reduced without PSRAM")
+        if config[df.CONF_BUFFER_MEMORY] == "psram" and PSRAM_DOMAIN not in global_config:
+            raise cv.Invalid("buffer_memory: psram requires the psram component")
         for image_id in lv_images_used:
             path = global_config.get_path_for_id(image_id)[:-1]
             image_conf = global_config.get_config_for_path(path)
@@ -336,6 +347,11 @@ async def to_code(configs):
             config[df.CONF_RESUME_ON_INPUT],
         )
         await cg.register_component(lv_component, config)
+        if config[df.CONF_DOUBLE_BUFFER]:
+            cg.add(lv_component.set_double_buffer(True))
+        cg.add(
+            lv_component.set_buffer_memory(BUFFER_MEMORY[config[df.CONF_BUFFER_MEMORY]])
+        )
         Widget.create(config[CONF_ID], lv_component, LvScrActType(), config)
 
         lv_scr_act = get_scr_act(lv_component)
@@ -424,6 +440,10 @@ LVGL_SCHEMA = cv.All(
                 cv.Optional(df.CONF_FULL_REFRESH, default=False): cv.boolean,
                 cv.Optional(CONF_DRAW_ROUNDING, default=2): cv.positive_int,
                 cv.Optional(CONF_BUFFER_SIZE, default=0): cv.percentage,
+                cv.Optional(df.CONF_DOUBLE_BUFFER, default=False): cv.boolean,
+                cv.Optional(df.CONF_BUFFER_MEMORY, default="auto"): cv.one_of(
+                    *BUFFER_MEMORY, lower=True
+                ),
                 cv.Optional(CONF_LOG_LEVEL, default="WARN"): cv.one_of(
                     *df.LV_LOG_LEVELS, upper=True
                 ),
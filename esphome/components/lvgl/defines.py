@@ -414,6 +414,7 @@ CONF_DISP_BG_COLOR = "disp_bg_color"
 CONF_DISP_BG_IMAGE = "disp_bg_image"
 CONF_DISP_BG_OPA = "disp_bg_opa"
 CONF_BODY = "body"
+CONF_BUFFER_MEMORY = "buffer_memory"
 CONF_BUTTONS = "buttons"
 CONF_BYTE_ORDER = "byte_order"
 CONF_CHANGE_RATE = "change_rate"
@@ -423,6 +424,7 @@ CONF_DEFAULT_FONT = "default_font"
 CONF_DEFAULT_GROUP = "default_group"
 CONF_DIR = "dir"
 CONF_DISPLAYS = "displays"
+CONF_DOUBLE_BUFFER = "double_buffer"
 CONF_EDITING = "editing"
 CONF_ENCODERS = "encoders"
 CONF_END_ANGLE = "end_angle"
@@ -435,6 +437,8 @@ CONF_FLEX_ALIGN_MAIN = "flex_align_main"
 CONF_FLEX_ALIGN_CROSS = "flex_align_cross"
 CONF_FLEX_ALIGN_TRACK = "flex_align_track"
 CONF_FLEX_GROW = "flex_grow"
+CONF_FPS = "fps"
+CONF_FRAME_TIME = "frame_time"
 CONF_FREEZE = "freeze"
 CONF_FULL_REFRESH = "full_refresh"
 CONF_GRADIENTS = "gradients"
@@ -90,9 +90,11 @@ void LvglComponent::dump_config() {
                 "  Display width/height: %d x %d\n"
                 "  Buffer size: %zu%%\n"
                 "  Rotation: %d\n"
-                "  Draw rounding: %d",
+                "  Draw rounding: %d\n"
+                "  Double buffered: %s\n"
+                "  Async draw: %s",
                 this->disp_drv_.hor_res, this->disp_drv_.ver_res, 100 / this->buffer_frac_, this->rotation,
-                (int) this->draw_rounding);
+                (int) this->draw_rounding, YESNO(this->draw_buf_.buf2 != nullptr), YESNO(this->async_draw_));
 }
 void LvglComponent::set_paused(bool paused, bool show_snow) {
   this->paused_ = paused;
@@ -153,7 +155,15 @@ void LvglComponent::show_prev_page(lv_scr_load_anim_t anim, uint32_t time) {
 }
 size_t LvglComponent::get_current_page() const { return this->current_page_; }
 bool LvPageType::is_showing() const { return this->parent_->get_current_page() == this->index; }
+void LvglComponent::wait_draw_complete_() {
+  if (this->async_draw_) {
+    for (auto *display : this->displays_)
+      display->wait_draw_complete();
+  }
+}
 void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
+  // the rotate buffer, or the LVGL buffer drawn before the last one, may still be in use
+  this->wait_draw_complete_();
   auto width = lv_area_get_width(area);
   auto height = lv_area_get_height(area);
   auto x1 = area->x1;
@@ -205,6 +215,8 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   }
 }
 
+// With async draw the pixels may still be on their way, but LVGL only renders into this buffer again once the
+// other one has been flushed, and that waits for this one.
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
     auto now = millis();
@@ -257,6 +269,7 @@ void LVTouchListener::update(const touchscreen::TouchPoints_t &tpoints) {
   this->touch_pressed_ = !this->parent_->is_paused() && !tpoints.empty();
   if (this->touch_pressed_)
     this->touch_point_ = tpoints[0];
+  this->read_now_();
 }
 #endif  // USE_LVGL_TOUCHSCREEN
 
@@ -389,6 +402,7 @@ void LvglComponent::write_random_() {
       area.y2 = this->disp_drv_.ver_res - 1;
 
     size_t line_len = lv_area_get_width(&area) * lv_area_get_height(&area) / 2;
+    this->wait_draw_complete_();
     for (size_t i = 0; i != line_len; i++) {
       ((uint32_t *) (this->draw_buf_.buf1))[i] = random_uint32();
     }
@@ -429,10 +443,28 @@ LvglComponent::LvglComponent(std::vector<display::Display *> displays, float buf
   this->disp_drv_.user_data = this;
   this->disp_drv_.full_refresh = this->full_refresh_;
   this->disp_drv_.flush_cb = static_flush_cb;
+  this->disp_drv_.monitor_cb = static_monitor_cb;
   this->disp_drv_.rounder_cb = rounder_cb;
   this->disp_ = lv_disp_drv_register(&this->disp_drv_);
 }
 
+void *LvglComponent::alloc_draw_buffer_(size_t size) {
+  switch (this->buffer_memory_) {
+    case BUFFER_MEMORY_INTERNAL:
+      return RAMAllocator<uint8_t>(RAMAllocator<uint8_t>::ALLOC_INTERNAL).allocate(size);
+    case BUFFER_MEMORY_PSRAM:
+      return RAMAllocator<uint8_t>(RAMAllocator<uint8_t>::ALLOC_EXTERNAL).allocate(size);
+    default:
+      break;
+  }
+  void *buffer = nullptr;
+  if (this->buffer_frac_ >= MIN_BUFFER_FRAC / 2)
+    buffer = malloc(size);  // NOLINT
+  if (buffer == nullptr)
+    buffer = lv_custom_mem_alloc(size);  // NOLINT
+  return buffer;
+}
+
 void LvglComponent::setup() {
   auto *display = this->displays_[0];
   auto width = display->get_width();
@@ -442,25 +474,27 @@ void LvglComponent::setup() {
     frac = 1;
   size_t buffer_pixels = width * height / frac;
   auto buf_bytes = buffer_pixels * LV_COLOR_DEPTH / 8;
-  void *buffer = nullptr;
-  if (this->buffer_frac_ >= MIN_BUFFER_FRAC / 2)
-    buffer = malloc(buf_bytes);  // NOLINT
-  if (buffer == nullptr)
-    buffer = lv_custom_mem_alloc(buf_bytes);  // NOLINT
+  void *buffer = this->alloc_draw_buffer_(buf_bytes);
   // if specific buffer size not set and can't get 100%, try for a smaller one
   if (buffer == nullptr && this->buffer_frac_ == 0) {
     frac = MIN_BUFFER_FRAC;
     buffer_pixels /= MIN_BUFFER_FRAC;
     buf_bytes /= MIN_BUFFER_FRAC;
-    buffer = lv_custom_mem_alloc(buf_bytes);  // NOLINT
+    buffer = this->alloc_draw_buffer_(buf_bytes);
   }
   if (buffer == nullptr) {
     this->status_set_error("Memory allocation failure");
     this->mark_failed();
     return;
   }
+  void *buffer2 = nullptr;
+  if (this->double_buffer_) {
+    buffer2 = this->alloc_draw_buffer_(buf_bytes);
+    if (buffer2 == nullptr)
+      ESP_LOGW(TAG, "Second draw buffer allocation failed, drawing single buffered");
+  }
   this->buffer_frac_ = frac;
-  lv_disp_draw_buf_init(&this->draw_buf_, buffer, nullptr, buffer_pixels);
+  lv_disp_draw_buf_init(&this->draw_buf_, buffer, buffer2, buffer_pixels);
   this->disp_drv_.hor_res = width;
   this->disp_drv_.ver_res = height;
   // this->setup_driver_(display->get_width(), display->get_height());
@@ -487,11 +521,28 @@ void LvglComponent::setup() {
   // Rotation will be handled by our drawing function, so reset the display rotation.
   for (auto *disp : this->displays_)
     disp->set_rotation(display::DISPLAY_ROTATION_0_DEGREES);
+  // Drawing can run in the background when the data sent is not rendered into straight after the flush
+  if (buffer2 != nullptr || this->rotate_buf_ != nullptr) {
+    for (auto *disp : this->displays_) {
+      if (disp->enable_async_draw())
+        this->async_draw_ = true;
+    }
+  }
+  this->stats_start_ = millis();
   this->show_page(0, LV_SCR_LOAD_ANIM_NONE, 0);
   lv_disp_trig_activity(this->disp_);
 }
 
 void LvglComponent::update() {
+  auto now = millis();
+  if (this->frame_count_ != 0)
+    this->frame_time_ = (float) this->frame_time_total_ / (float) this->frame_count_;
+  if (now != this->stats_start_) {
+    this->frame_stats_callbacks_.call(this->frame_time_, this->frame_count_ * 1000.0f / (now - this->stats_start_));
+  }
+  this->frame_count_ = 0;
+  this->frame_time_total_ = 0;
+  this->stats_start_ = now;
   // update indicators
   if (this->paused_) {
     return;
@@ -518,6 +569,12 @@ void lv_animimg_stop(lv_obj_t *obj) {
 void LvglComponent::static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_cb_(disp_drv, area, color_p);
 }
+// called by LVGL after each refresh with the time taken to render and flush it
+void LvglComponent::static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+  auto *comp = reinterpret_cast<LvglComponent *>(disp_drv->user_data);
+  comp->frame_count_++;
+  comp->frame_time_total_ += time;
+}
 }  // namespace lvgl
 }  // namespace esphome
 
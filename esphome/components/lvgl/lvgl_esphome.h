@@ -50,6 +50,13 @@ static const display::ColorBitness LV_BITNESS = display::ColorBitness::COLOR_BIT
 static const display::ColorBitness LV_BITNESS = display::ColorBitness::COLOR_BITNESS_332;
 #endif  // LV_COLOR_DEPTH
 
+// Where the draw buffers are allocated
+enum BufferMemory : uint8_t {
+  BUFFER_MEMORY_AUTO,
+  BUFFER_MEMORY_INTERNAL,
+  BUFFER_MEMORY_PSRAM,
+};
+
 #ifdef USE_LVGL_IMAGE
 // Shortcut / overload, so that the source of an image can easily be updated
 // from within a lambda.
@@ -163,6 +170,7 @@ class LvglComponent : public PollingComponent {
   LvglComponent(std::vector<display::Display *> displays, float buffer_frac, bool full_refresh, int draw_rounding,
                 bool resume_on_input);
   static void static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  static void static_monitor_cb(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
 
   float get_setup_priority() const override { return setup_priority::PROCESSOR; }
   void setup() override;
@@ -172,6 +180,13 @@ class LvglComponent : public PollingComponent {
     this->idle_callbacks_.add(std::move(callback));
   }
   void add_on_pause_callback(std::function<void(bool)> &&callback) { this->pause_callbacks_.add(std::move(callback)); }
+  // Called on every update with the average frame time in ms and the frames per second since the last update
+  void add_on_frame_stats_callback(std::function<void(float, float)> &&callback) {
+    this->frame_stats_callbacks_.add(std::move(callback));
+  }
+  // Render into one buffer while the other one is sent to the displays
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+  void set_buffer_memory(BufferMemory buffer_memory) { this->buffer_memory_ = buffer_memory; }
   void dump_config() override;
   bool is_idle(uint32_t idle_ms) { return lv_disp_get_inactive_time(this->disp_) > idle_ms; }
   lv_disp_t *get_disp() { return this->disp_; }
@@ -216,6 +231,8 @@ class LvglComponent : public PollingComponent {
 
  protected:
   void write_random_();
+  void *alloc_draw_buffer_(size_t size);
+  void wait_draw_complete_();
   void draw_buffer_(const lv_area_t *area, lv_color_t *ptr);
   void flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
 
@@ -237,6 +254,16 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   CallbackManager<void(bool)> pause_callbacks_{};
   lv_color_t *rotate_buf_{};
+  bool double_buffer_{};
+  BufferMemory buffer_memory_{BUFFER_MEMORY_AUTO};
+  // at least one display returns from drawing before it has sent the pixels
+  bool async_draw_{};
+
+  CallbackManager<void(float, float)> frame_stats_callbacks_{};
+  uint32_t frame_count_{};
+  uint32_t frame_time_total_{};
+  uint32_t stats_start_{};
+  float frame_time_{};
 };
 
 class IdleTrigger : public Trigger<> {
@@ -282,10 +309,17 @@ class LVTouchListener : public touchscreen::TouchListener, public Parented<LvglC
   void release() override {
     touch_pressed_ = false;
     this->parent_->maybe_wakeup();
+    this->read_now_();
   }
   lv_indev_drv_t *get_drv() { return &this->drv_; }
 
  protected:
+  // Lets LVGL read the new state on its next timer run instead of at the end of its read period
+  void read_now_() {
+    if (this->drv_.read_timer != nullptr)
+      lv_timer_ready(this->drv_.read_timer);
+  }
+
   lv_indev_drv_t drv_{};
   touchscreen::TouchPoint touch_point_{};
   bool touch_pressed_{};
@@ -1,7 +1,15 @@
+import esphome.codegen as cg
 from esphome.components.sensor import Sensor, new_sensor, sensor_schema
 import esphome.config_validation as cv
+from esphome.const import (
+    CONF_TYPE,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
+)
+from esphome.cpp_generator import MockObj
 
-from ..defines import CONF_WIDGET
+from ..defines import CONF_FPS, CONF_FRAME_TIME, CONF_LVGL_ID, CONF_WIDGET
 from ..lvcode import (
     API_EVENT,
     EVENT_ARG,
@@ -9,21 +17,55 @@ from ..lvcode import (
     UPDATE_EVENT,
     LambdaContext,
     LvContext,
+    LvglComponent,
     lv_add,
     lvgl_static,
 )
 from ..types import LV_EVENT, LvNumber
 from ..widgets import Widget, get_widgets, wait_for_widgets
 
-CONFIG_SCHEMA = sensor_schema(Sensor).extend(
+FRAME_STATS_ARGS = [(cg.float_, CONF_FRAME_TIME), (cg.float_, CONF_FPS)]
+
+
+def frame_stats_schema(**kwargs):
+    return sensor_schema(
+        Sensor,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        **kwargs,
+    ).extend(
+        {
+            cv.GenerateID(CONF_LVGL_ID): cv.use_id(LvglComponent),
+        }
+    )
+
+
+CONFIG_SCHEMA = cv.typed_schema(
     {
-        cv.Required(CONF_WIDGET): cv.use_id(LvNumber),
-    }
+        CONF_WIDGET: sensor_schema(Sensor).extend(
+            {
+                cv.Required(CONF_WIDGET): cv.use_id(LvNumber),
+            }
+        ),
+        # Average time LVGL took to render and flush a frame since the last update
+        CONF_FRAME_TIME: frame_stats_schema(
+            unit_of_measurement=UNIT_MILLISECOND, accuracy_decimals=1
+        ),
+        CONF_FPS: frame_stats_schema(unit_of_measurement="fps", accuracy_decimals=1),
+    },
+    default_type=CONF_WIDGET,
+    lower=True,
 )
 
 
 async def to_code(config):
     sensor = await new_sensor(config)
+    if config[CONF_TYPE] != CONF_WIDGET:
+        lv_comp = await cg.get_variable(config[CONF_LVGL_ID])
+        async with LambdaContext(FRAME_STATS_ARGS) as lamb:
+            lv_add(sensor.publish_state(MockObj(config[CONF_TYPE])))
+        cg.add(lv_comp.add_on_frame_stats_callback(await lamb.get_lambda()))
+        return
     widget = await get_widgets(config, CONF_WIDGET)
     widget = widget[0]
     assert isinstance(widget, Widget)
@@ -19,6 +19,16 @@ void MCP23X08Base::digital_write_hw(uint8_t pin, bool value) {
   this->update_reg(pin, value, reg_addr);
 }
 
+void MCP23X08Base::digital_write_cache(uint8_t pin, bool value) {
+  if (value) {
+    this->olat_ |= 1 << pin;
+  } else {
+    this->olat_ &= ~(1 << pin);
+  }
+}
+
+void MCP23X08Base::write_bank_hw(uint8_t bank) { this->write_reg(mcp23x08_base::MCP23X08_OLAT, this->olat_); }
+
 bool MCP23X08Base::digital_read_cache(uint8_t pin) { return this->input_mask_ & (1 << pin); }
 
 void MCP23X08Base::pin_mode(uint8_t pin, gpio::Flags flags) {
@@ -30,6 +30,23 @@ void MCP23X17Base::digital_write_hw(uint8_t pin, bool value) {
   this->update_reg(pin, value, reg_addr);
 }
 
+void MCP23X17Base::digital_write_cache(uint8_t pin, bool value) {
+  uint8_t &olat = pin < 8 ? this->olat_a_ : this->olat_b_;
+  if (value) {
+    olat |= 1 << (pin % 8);
+  } else {
+    olat &= ~(1 << (pin % 8));
+  }
+}
+
+void MCP23X17Base::write_bank_hw(uint8_t bank) {
+  if (bank == 0) {
+    this->write_reg(mcp23x17_base::MCP23X17_OLATA, this->olat_a_);
+  } else {
+    this->write_reg(mcp23x17_base::MCP23X17_OLATB, this->olat_b_);
+  }
+}
+
 bool MCP23X17Base::digital_read_cache(uint8_t pin) { return this->input_mask_ & (1 << pin); }
 
 void MCP23X17Base::pin_mode(uint8_t pin, gpio::Flags flags) {
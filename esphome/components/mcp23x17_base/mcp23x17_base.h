@@ -38,6 +38,8 @@ class MCP23X17Base : public mcp23xxx_base::MCP23XXXBase<16> {
  public:
   bool digital_read_hw(uint8_t pin) override;
   void digital_write_hw(uint8_t pin, bool value) override;
+  void digital_write_cache(uint8_t pin, bool value) override;
+  void write_bank_hw(uint8_t bank) override;
   bool digital_read_cache(uint8_t pin) override;
 
   void pin_mode(uint8_t pin, gpio::Flags flags) override;
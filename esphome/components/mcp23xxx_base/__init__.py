@@ -1,5 +1,6 @@
 from esphome import pins
 import esphome.codegen as cg
+from esphome.components.gpio_expander import CONF_WRITE_COMBINING
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ID,
@@ -32,6 +33,7 @@ MCP23XXX_INTERRUPT_MODES = {
 MCP23XXX_CONFIG_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_OPEN_DRAIN_INTERRUPT, default=False): cv.boolean,
+        cv.Optional(CONF_WRITE_COMBINING, default=False): cv.boolean,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -43,6 +45,7 @@ async def register_mcp23xxx(config, num_pins):
     await cg.register_component(var, config)
     CORE.data.setdefault(CONF_MCP23XXX, {})[id.id] = num_pins
     cg.add(var.set_open_drain_ints(config[CONF_OPEN_DRAIN_INTERRUPT]))
+    cg.add(var.set_write_combining(config[CONF_WRITE_COMBINING]))
     return var
 
 
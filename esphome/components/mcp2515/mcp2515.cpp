@@ -1,6 +1,9 @@
 #include "mcp2515.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace esphome {
 namespace mcp2515 {
 
@@ -21,29 +24,122 @@ bool MCP2515::setup_internal() {
   if (this->set_bitrate_(this->bit_rate_, this->mcp_clock_) != canbus::ERROR_OK)
     return false;
 
-  // setup hardware filter RXF0 accepting all standard CAN IDs
-  if (this->set_filter_(RXF::RXF0, false, 0) != canbus::ERROR_OK) {
+  if (!this->setup_filters_())
     return false;
-  }
-  if (this->set_filter_mask_(MASK::MASK0, false, 0) != canbus::ERROR_OK) {
+
+  if (this->set_mode_(this->mcp_mode_) != canbus::ERROR_OK)
     return false;
+  uint8_t err_flags = this->get_error_flags_();
+  ESP_LOGD(TAG, "mcp2515 setup done, error_flags = %02X", err_flags);
+
+  if (this->interrupt_pin_ != nullptr) {
+    this->interrupt_pin_->setup();
+    this->interrupt_pin_->attach_interrupt(&MCP2515::gpio_intr, this, gpio::INTERRUPT_FALLING_EDGE);
   }
+  return true;
+}
 
-  // setup hardware filter RXF1 accepting all extended CAN IDs
-  if (this->set_filter_(RXF::RXF1, true, 0) != canbus::ERROR_OK) {
-    return false;
+bool MCP2515::setup_filters_() {
+  if (this->hardware_filters_.empty()) {
+    // setup hardware filter RXF0 accepting all standard CAN IDs
+    if (this->set_filter_(RXF::RXF0, false, 0) != canbus::ERROR_OK) {
+      return false;
+    }
+    if (this->set_filter_mask_(MASK::MASK0, false, 0) != canbus::ERROR_OK) {
+      return false;
+    }
+
+    // setup hardware filter RXF1 accepting all extended CAN IDs
+    if (this->set_filter_(RXF::RXF1, true, 0) != canbus::ERROR_OK) {
+      return false;
+    }
+    if (this->set_filter_mask_(MASK::MASK1, true, 0) != canbus::ERROR_OK) {
+      return false;
+    }
+    return true;
   }
-  if (this->set_filter_mask_(MASK::MASK1, true, 0) != canbus::ERROR_OK) {
-    return false;
+
+  // RXB0 has MASK0 with RXF0-1, RXB1 has MASK1 with RXF2-5. A mask is shared by the filters of its buffer and used
+  // for the data bytes of standard frames when it has extended bits, so every buffer only gets one id type.
+  std::vector<canbus::CanFilter> standard, extended;
+  for (auto &filter : this->hardware_filters_)
+    (filter.use_extended_id ? extended : standard).push_back(filter);
+  std::vector<canbus::CanFilter> *groups[N_RXBUFFERS];
+  if (standard.empty() || extended.empty()) {
+    groups[RXB0] = groups[RXB1] = standard.empty() ? &extended : &standard;
+  } else {
+    groups[RXB0] = standard.size() <= extended.size() ? &standard : &extended;
+    groups[RXB1] = groups[RXB0] == &standard ? &extended : &standard;
   }
 
-  if (this->set_mode_(this->mcp_mode_) != canbus::ERROR_OK)
-    return false;
-  uint8_t err_flags = this->get_error_flags_();
-  ESP_LOGD(TAG, "mcp2515 setup done, error_flags = %02X", err_flags);
+  static const MASK MASKS[N_RXBUFFERS] = {MASK0, MASK1};
+  static const RXF FILTERS[N_RXBUFFERS][4] = {{RXF0, RXF1}, {RXF2, RXF3, RXF4, RXF5}};
+  static const size_t FILTER_COUNTS[N_RXBUFFERS] = {2, 4};
+  for (uint8_t buffer = 0; buffer < N_RXBUFFERS; buffer++) {
+    const std::vector<canbus::CanFilter> &group = *groups[buffer];
+    const size_t slots = FILTER_COUNTS[buffer];
+    // With a single id type RXB0 only takes the first filters of RXB1, frames it rejects still get to RXB1
+    const bool shared_group = groups[RXB0] == groups[RXB1];
+    canbus::CanFilter filters[4];
+    size_t count;
+    if (group.size() <= (shared_group ? FILTER_COUNTS[RXB1] : slots)) {
+      // Every filter keeps its id, the mask checks the bits all of them check
+      uint32_t mask = group[0].can_id_mask;
+      for (const auto &filter : group)
+        mask &= filter.can_id_mask;
+      count = std::min(group.size(), slots);
+      for (size_t i = 0; i < count; i++)
+        filters[i] = {group[i].can_id & mask, mask, group[i].use_extended_id};
+    } else {
+      // More filters than the buffer has, a single one lets all of them pass
+      filters[0] = canbus::CanFilter::merge(group.data(), group.size());
+      count = 1;
+    }
+
+    if (this->set_filter_mask_(MASKS[buffer], filters[0].use_extended_id, filters[0].can_id_mask) != canbus::ERROR_OK)
+      return false;
+    for (size_t i = 0; i < slots; i++) {
+      // Unused filters repeat the last one
+      const canbus::CanFilter &filter = filters[std::min(i, count - 1)];
+      if (this->set_filter_(FILTERS[buffer][i], filter.use_extended_id, filter.can_id) != canbus::ERROR_OK)
+        return false;
+    }
+  }
   return true;
 }
 
+void MCP2515::dump_config() {
+  canbus::Canbus::dump_config();
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
+  ESP_LOGCONFIG(TAG, "  Hardware filters: %zu", this->hardware_filters_.size());
+}
+
+void IRAM_ATTR MCP2515::gpio_intr(MCP2515 *arg) {
+  // Frames are read over SPI in the main loop
+  arg->enable_loop_soon_any_context();
+}
+
+void MCP2515::loop() {
+  canbus::Canbus::loop();
+  if (this->interrupt_pin_ == nullptr)
+    return;
+
+  // INT is active low and stays low while any enabled flag is set
+  if (this->interrupt_pin_->digital_read()) {
+    this->disable_loop();
+    // A frame received while disabling would not raise another edge
+    if (!this->interrupt_pin_->digital_read())
+      this->enable_loop();
+    return;
+  }
+  if ((this->get_status_() & STAT_RXIF_MASK) == 0) {
+    // Only error flags are left, clear them so INT is released
+    this->clear_rx_n_ovr_flags_();
+    this->clear_errif_();
+    this->clear_merr_();
+  }
+}
+
 canbus::Error MCP2515::reset_() {
   this->enable();
   this->transfer_byte(INSTRUCTION_RESET);
@@ -279,15 +375,17 @@ canbus::Error MCP2515::send_message(struct canbus::CanFrame *frame) {
 }
 
 canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame) {
-  const struct RxBnRegs *rxb = &RXB[rxbn];
-
   uint8_t tbufdata[5];
 
-  read_registers_(rxb->SIDH, tbufdata, 5);
+  // READ RX BUFFER starts at RXBnSIDH and clears RXnIF when CS is released, so the whole frame is a single transfer
+  this->enable();
+  this->transfer_byte(rxbn == RXB0 ? INSTRUCTION_READ_RX0 : INSTRUCTION_READ_RX1);
+  for (uint8_t &value : tbufdata)
+    value = this->transfer_byte(0x00);
 
   uint32_t id = (tbufdata[MCP_SIDH] << 3) + (tbufdata[MCP_SIDL] >> 5);
   bool use_extended_id = false;
-  bool remote_transmission_request = false;
+  bool remote_transmission_request;
 
   if ((tbufdata[MCP_SIDL] & SIDL_EXIDE_MASK) == SIDL_EXIDE_MASK) {
     id = (id << 2) + (tbufdata[MCP_SIDL] & 0x03);
@@ -295,28 +393,26 @@ canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame)
     id = (id << 8) + tbufdata[MCP_EID0];
     // id |= canbus::CAN_EFF_FLAG;
     use_extended_id = true;
+    remote_transmission_request = tbufdata[MCP_DLC] & RTR_MASK;
+  } else {
+    // SRR is the RTR bit of standard frames
+    remote_transmission_request = tbufdata[MCP_SIDL] & SIDL_SRR_MASK;
   }
 
   uint8_t dlc = (tbufdata[MCP_DLC] & DLC_MASK);
   if (dlc > canbus::CAN_MAX_DATA_LENGTH) {
+    this->disable();
     return canbus::ERROR_FAIL;
   }
-
-  uint8_t ctrl = read_register_(rxb->CTRL);
-  if (ctrl & RXB_CTRL_RTR) {
-    // id |= canbus::CAN_RTR_FLAG;
-    remote_transmission_request = true;
-  }
+  for (uint8_t i = 0; i < dlc; i++)
+    frame->data[i] = this->transfer_byte(0x00);
+  this->disable();
 
   frame->can_id = id;
   frame->can_data_length_code = dlc;
   frame->use_extended_id = use_extended_id;
   frame->remote_transmission_request = remote_transmission_request;
 
-  read_registers_(rxb->DATA, frame->data, dlc);
-
-  modify_register_(MCP_CANINTF, rxb->CANINTF_RXnIF, 0);
-
   return canbus::ERROR_OK;
 }
 
@@ -59,6 +59,10 @@ class MCP2515 : public canbus::Canbus,
   MCP2515(){};
   void set_mcp_clock(CanClock clock) { this->mcp_clock_ = clock; };
   void set_mcp_mode(const CanctrlReqopMode mode) { this->mcp_mode_ = mode; }
+  /// Read frames when the INT pin signals them instead of polling the controller in every loop.
+  void set_interrupt_pin(InternalGPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
+  void dump_config() override;
+  void loop() override;
   static const struct TxBnRegs {
     REGISTER CTRL;
     REGISTER SIDH;
@@ -75,7 +79,10 @@ class MCP2515 : public canbus::Canbus,
  protected:
   CanClock mcp_clock_{MCP_8MHZ};
   CanctrlReqopMode mcp_mode_ = CANCTRL_REQOP_NORMAL;
+  InternalGPIOPin *interrupt_pin_{nullptr};
   bool setup_internal() override;
+  bool setup_filters_();
+  static void gpio_intr(MCP2515 *arg);
   canbus::Error set_mode_(CanctrlReqopMode mode);
 
   uint8_t read_register_(REGISTER reg);
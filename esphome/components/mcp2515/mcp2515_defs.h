@@ -132,6 +132,8 @@ static const uint8_t CNF3_SOF = 0x80;
 
 // applies to RXBn_SIDL, TXBn_SIDL and RXFn_SIDL
 static const uint8_t SIDL_EXIDE_MASK = 0x08;
+// applies to RXBn_SIDL
+static const uint8_t SIDL_SRR_MASK = 0x10;
 
 static const uint8_t DLC_MASK = 0x0F;
 static const uint8_t RTR_MASK = 0x40;
@@ -36,6 +36,7 @@ def _remove_id_if_disabled(value):
 
 
 CONF_TXT = "txt"
+CONF_ANNOUNCE_JITTER = "announce_jitter"
 
 SERVICE_SCHEMA = cv.Schema(
     {
@@ -52,6 +53,9 @@ CONFIG_SCHEMA = cv.All(
             cv.GenerateID(): cv.declare_id(MDNSComponent),
             cv.Optional(CONF_DISABLED, default=False): cv.boolean,
             cv.Optional(CONF_SERVICES, default=[]): cv.ensure_list(SERVICE_SCHEMA),
+            cv.Optional(
+                CONF_ANNOUNCE_JITTER, default="0s"
+            ): cv.positive_time_period_milliseconds,
         }
     ),
     _remove_id_if_disabled,
@@ -190,6 +194,8 @@ async def to_code(config):
 
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    if config[CONF_ANNOUNCE_JITTER].total_milliseconds > 0:
+        cg.add(var.set_announce_jitter(config[CONF_ANNOUNCE_JITTER]))
 
     for service in config[CONF_SERVICES]:
         txt_records = [
@@ -36,9 +36,18 @@ MDNS_STATIC_CONST_CHAR(SERVICE_TCP, "_tcp");
 // Wrap build-time defines into flash storage
 MDNS_STATIC_CONST_CHAR(VALUE_VERSION, ESPHOME_VERSION);
 
-void MDNSComponent::compile_records_(StaticVector<MDNSService, MDNS_SERVICE_COUNT> &services) {
+void MDNSComponent::setup() {
   this->hostname_ = App.get_name();
+  if (this->announce_jitter_ == 0) {
+    this->start_responder_();
+    return;
+  }
+  const uint32_t delay_ms = random_uint32() % (this->announce_jitter_ + 1);
+  ESP_LOGD(TAG, "Announcing in %" PRIu32 " ms", delay_ms);
+  this->set_timeout(delay_ms, [this]() { this->start_responder_(); });
+}
 
+void MDNSComponent::compile_records_(StaticVector<MDNSService, MDNS_SERVICE_COUNT> &services) {
   // IMPORTANT: The #ifdef blocks below must match COMPONENTS_WITH_MDNS_SERVICES
   // in mdns/__init__.py. If you add a new service here, update both locations.
 
@@ -180,6 +189,9 @@ void MDNSComponent::dump_config() {
                 "mDNS:\n"
                 "  Hostname: %s",
                 this->hostname_.c_str());
+  if (this->announce_jitter_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Announce Jitter: %" PRIu32 " ms", this->announce_jitter_);
+  }
 #ifdef USE_MDNS_STORE_SERVICES
   ESP_LOGV(TAG, "  Services:");
   for (const auto &service : this->services_) {
@@ -51,6 +51,9 @@ class MDNSComponent : public Component {
 #endif
   float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
 
+  /// Start the responder after a random delay of up to jitter_ms, so devices powered up together announce spread out.
+  void set_announce_jitter(uint32_t jitter_ms) { this->announce_jitter_ = jitter_ms; }
+
 #ifdef USE_MDNS_EXTRA_SERVICES
   void add_extra_service(MDNSService service) { this->services_.emplace_next() = std::move(service); }
 #endif
@@ -77,7 +80,10 @@ class MDNSComponent : public Component {
   StaticVector<MDNSService, MDNS_SERVICE_COUNT> services_{};
 #endif
   std::string hostname_;
+  uint32_t announce_jitter_{0};
   void compile_records_(StaticVector<MDNSService, MDNS_SERVICE_COUNT> &services);
+  /// Register the hostname and services with the platform responder, which announces them.
+  void start_responder_();
 };
 
 }  // namespace mdns
@@ -11,7 +11,7 @@ namespace mdns {
 
 static const char *const TAG = "mdns";
 
-void MDNSComponent::setup() {
+void MDNSComponent::start_responder_() {
 #ifdef USE_MDNS_STORE_SERVICES
   this->compile_records_(this->services_);
   const auto &services = this->services_;
@@ -32,6 +32,7 @@ void MDNSComponent::setup() {
 
   for (const auto &service : services) {
     std::vector<mdns_txt_item_t> txt_records;
+    txt_records.reserve(service.txt_records.size());
     for (const auto &record : service.txt_records) {
       mdns_txt_item_t it{};
       // key and value are either compile-time string literals in flash or pointers to dynamic_txt_values_
@@ -11,7 +11,7 @@
 namespace esphome {
 namespace mdns {
 
-void MDNSComponent::setup() {
+void MDNSComponent::start_responder_() {
 #ifdef USE_MDNS_STORE_SERVICES
   this->compile_records_(this->services_);
   const auto &services = this->services_;
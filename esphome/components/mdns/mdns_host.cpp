@@ -9,7 +9,7 @@
 namespace esphome {
 namespace mdns {
 
-void MDNSComponent::setup() {
+void MDNSComponent::start_responder_() {
   // Host platform doesn't have actual mDNS implementation
 }
 
@@ -65,9 +65,11 @@ void MicroWakeWord::dump_config() {
   ESP_LOGCONFIG(TAG, "  models:");
   for (auto &model : this->wake_word_models_) {
     model->log_model_config();
+    model->log_inference_stats();
   }
 #ifdef USE_MICRO_WAKE_WORD_VAD
   this->vad_model_->log_model_config();
+  this->vad_model_->log_inference_stats();
 #endif
 }
 
@@ -88,6 +90,16 @@ void MicroWakeWord::setup() {
   this->frontend_config_.log_scale.enable_log = LOG_SCALE_ENABLE_LOG;
   this->frontend_config_.log_scale.scale_shift = LOG_SCALE_SCALE_SHIFT;
 
+  // The features of every slice go to all models, but each invokes only once its stride is complete. Offsetting
+  // the models' strides spreads the invocations over the slices instead of running them all on the same one.
+  uint8_t stride_offset = 0;
+  for (auto *model : this->wake_word_models_) {
+    model->set_stride_offset(stride_offset++);
+  }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  this->vad_model_->set_stride_offset(stride_offset);
+#endif
+
   this->event_group_ = xEventGroupCreate();
   if (this->event_group_ == nullptr) {
     ESP_LOGE(TAG, "Failed to create event group");
@@ -154,7 +166,8 @@ void MicroWakeWord::inference_task(void *params) {
     if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
       // Allocate ring buffer
       std::shared_ptr<RingBuffer> temp_ring_buffer = RingBuffer::create(
-          this_mww->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
+          this_mww->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS),
+          RAMSubsystem::AUDIO);
       if (temp_ring_buffer.use_count() == 0) {
         xEventGroupSetBits(this_mww->event_group_, EventGroupBits::ERROR_MEMORY);
       }
@@ -2,9 +2,12 @@
 
 #ifdef USE_ESP_IDF
 
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 static const char *const TAG = "micro_wake_word";
 
 namespace esphome {
@@ -26,6 +29,16 @@ void VADModel::log_model_config() {
                 this->probability_cutoff_ / 255.0f, this->sliding_window_size_);
 }
 
+void StreamingModel::log_inference_stats() {
+  if (this->inference_count_ == 0) {
+    return;
+  }
+  ESP_LOGCONFIG(TAG,
+                "      Inferences: %" PRIu32 "\n"
+                "      Inference time: %" PRIu32 " us average, %" PRIu32 " us max",
+                this->inference_count_, this->average_inference_us_, this->max_inference_us_);
+}
+
 bool StreamingModel::load_model_() {
   RAMAllocator<uint8_t> arena_allocator;
 
@@ -76,6 +89,9 @@ bool StreamingModel::load_model_() {
       return false;
     }
 
+    // Start partway into the stride, so this model's invocations fall on different feature slices than the others'
+    this->current_stride_step_ = this->stride_offset_ % input->dims->data[1];
+
     // Verify output tensor matches expected values
     TfLiteTensor *output = this->interpreter_->output(0);
     if ((output->dims->size != 2) || (output->dims->data[0] != 1) || (output->dims->data[1] != 1)) {
@@ -137,11 +153,23 @@ bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCES
     ++this->current_stride_step_;
 
     if (this->current_stride_step_ >= stride) {
+      const uint32_t invoke_start = micros();
       TfLiteStatus invoke_status = this->interpreter_->Invoke();
       if (invoke_status != kTfLiteOk) {
         ESP_LOGW(TAG, "Streaming interpreter invoke failed");
         return false;
       }
+      const uint32_t inference_us = micros() - invoke_start;
+
+      if (this->inference_count_ == 0) {
+        this->average_inference_us_ = inference_us;
+      } else {
+        this->average_inference_us_ =
+            static_cast<int32_t>(this->average_inference_us_) +
+            (static_cast<int32_t>(inference_us) - static_cast<int32_t>(this->average_inference_us_)) / 16;
+      }
+      this->max_inference_us_ = std::max(this->max_inference_us_, inference_us);
+      ++this->inference_count_;
 
       TfLiteTensor *output = this->interpreter_->output(0);
 
@@ -59,6 +59,18 @@ class StreamingModel {
   uint8_t get_probability_cutoff() const { return this->probability_cutoff_; }
   void set_probability_cutoff(uint8_t probability_cutoff) { this->probability_cutoff_ = probability_cutoff; }
 
+  /// @brief Sets how many feature slices the model's input is ahead when it loads. Models with the same stride
+  /// but different offsets invoke on different slices, which spreads their inference time out.
+  void set_stride_offset(uint8_t stride_offset) { this->stride_offset_ = stride_offset; }
+
+  /// @brief Logs the number of inferences and their average and maximum durations
+  void log_inference_stats();
+
+  uint32_t get_inference_count() const { return this->inference_count_; }
+  // Exponential moving average over roughly the last 16 inferences
+  uint32_t get_average_inference_us() const { return this->average_inference_us_; }
+  uint32_t get_max_inference_us() const { return this->max_inference_us_; }
+
  protected:
   /// @brief Allocates tensor and variable arenas and sets up the model interpreter
   /// @return True if successful, false otherwise
@@ -72,8 +84,13 @@ class StreamingModel {
   bool enabled_{true};
   bool unprocessed_probability_status_{false};
   uint8_t current_stride_step_{0};
+  uint8_t stride_offset_{0};
   int16_t ignore_windows_{-MIN_SLICES_BEFORE_DETECTION};
 
+  uint32_t inference_count_{0};
+  uint32_t average_inference_us_{0};
+  uint32_t max_inference_us_{0};
+
   uint8_t default_probability_cutoff_;
   uint8_t probability_cutoff_;
   size_t sliding_window_size_;
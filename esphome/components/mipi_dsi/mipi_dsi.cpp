@@ -161,6 +161,7 @@ void MIPI_DSI::update() {
   int h = this->y_high_ - this->y_low_ + 1;
   this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_, this->y_low_,
                           this->width_ - w - this->x_low_);
+  this->wait_draw_complete();
   // invalidate watermarks
   this->x_low_ = this->width_;
   this->y_low_ = this->height_;
@@ -177,21 +178,40 @@ void MIPI_DSI::draw_pixels_at(int x_start, int y_start, int w, int h, const uint
   if (bitness != this->color_depth_) {
     display::Display::draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, x_offset, y_offset,
                                      x_pad);
+    if (this->buffer_ != nullptr) {
+      this->write_to_display_(x_start, y_start, w, h, this->buffer_, x_start, y_start, this->width_ - w - x_start);
+      // the buffer may be drawn into again as soon as we return
+      this->wait_draw_complete();
+    }
+    return;
   }
   this->write_to_display_(x_start, y_start, w, h, ptr, x_offset, y_offset, x_pad);
 }
 
+void MIPI_DSI::wait_draw_complete() {
+  if (this->draw_pending_) {
+    xSemaphoreTake(this->io_lock_, portMAX_DELAY);
+    this->draw_pending_ = false;
+  }
+}
+
 void MIPI_DSI::write_to_display_(int x_start, int y_start, int w, int h, const uint8_t *ptr, int x_offset, int y_offset,
                                  int x_pad) {
   esp_err_t err = ESP_OK;
+  this->wait_draw_complete();
   auto bytes_per_pixel = 3 - this->color_depth_;
   auto stride = (x_offset + w + x_pad) * bytes_per_pixel;
   ptr += y_offset * stride + x_offset * bytes_per_pixel;  // skip to the first pixel
   // x_ and y_offset are offsets into the source buffer, unrelated to our own offsets into the display.
   if (x_offset == 0 && x_pad == 0) {
     err = esp_lcd_panel_draw_bitmap(this->handle_, x_start, y_start, x_start + w, y_start + h, ptr);
-    xSemaphoreTake(this->io_lock_, portMAX_DELAY);
-
+    if (err == ESP_OK) {
+      if (this->async_draw_) {
+        this->draw_pending_ = true;
+      } else {
+        xSemaphoreTake(this->io_lock_, portMAX_DELAY);
+      }
+    }
   } else {
     // draw line by line
     for (int y = 0; y != h; y++) {
@@ -213,7 +233,7 @@ bool MIPI_DSI::check_buffer_() {
     return true;
   // this is dependent on the enum values.
   auto bytes_per_pixel = 3 - this->color_depth_;
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(RAMSubsystem::DISPLAY);
   this->buffer_ = allocator.allocate(this->height_ * this->width_ * bytes_per_pixel);
   if (this->buffer_ == nullptr) {
     this->mark_failed("Could not allocate buffer for display!");
@@ -73,6 +73,11 @@ class MIPI_DSI : public display::Display {
 
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
+  bool enable_async_draw() override {
+    this->async_draw_ = true;
+    return true;
+  }
+  void wait_draw_complete() override;
 
   void draw_pixel_at(int x, int y, Color color) override;
   void fill(Color color) override;
@@ -111,6 +116,9 @@ class MIPI_DSI : public display::Display {
   esp_lcd_dsi_bus_handle_t bus_handle_{};
   esp_lcd_panel_io_handle_t io_handle_{};
   SemaphoreHandle_t io_lock_{};
+  // draw_bitmap() returns before the frame buffer copy is done, wait_draw_complete() waits for it
+  bool async_draw_{};
+  bool draw_pending_{};
   uint8_t *buffer_{nullptr};
   uint16_t x_low_{1};
   uint16_t y_low_{1};
@@ -246,7 +246,7 @@ bool MipiRgb::check_buffer_() {
   if (this->buffer_ != nullptr)
     return true;
   // this is dependent on the enum values.
-  RAMAllocator<uint16_t> allocator;
+  RAMAllocator<uint16_t> allocator(RAMSubsystem::DISPLAY);
   this->buffer_ = allocator.allocate(this->height_ * this->width_);
   if (this->buffer_ == nullptr) {
     this->mark_failed("Could not allocate buffer for display!");
@@ -4,3 +4,4 @@ DOMAIN = "mipi_spi"
 
 CONF_SPI_16 = "spi_16"
 CONF_BUS_MODE = "bus_mode"
+CONF_DOUBLE_BUFFER = "double_buffer"
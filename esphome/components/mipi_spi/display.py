@@ -56,7 +56,7 @@ from esphome.core import CORE
 from esphome.cpp_generator import TemplateArguments
 from esphome.final_validate import full_config
 
-from . import CONF_BUS_MODE, CONF_SPI_16, DOMAIN, models
+from . import CONF_BUS_MODE, CONF_DOUBLE_BUFFER, CONF_SPI_16, DOMAIN, models
 
 DEPENDENCIES = ["spi"]
 
@@ -182,6 +182,7 @@ def model_schema(config):
     ]
     if bus_mode == TYPE_SINGLE:
         other_options.append(CONF_SPI_16)
+        other_options.append(CONF_DOUBLE_BUFFER)
     schema = (
         display.FULL_DISPLAY_SCHEMA.extend(
             spi.spi_device_schema(
@@ -282,6 +283,13 @@ def customise_schema(config):
         raise cv.Invalid("DC pin is not supported in quad mode")
     if bus_mode != TYPE_QUAD and CONF_DC_PIN not in config:
         raise cv.Invalid(f"DC pin is required in {bus_mode} mode")
+    if config.get(CONF_DOUBLE_BUFFER):
+        color_depth = int(config[CONF_COLOR_DEPTH].removesuffix("bit"))
+        pixel_mode = DISPLAY_PIXEL_MODES[config[CONF_PIXEL_MODE]][1]
+        if pixel_mode != COLOR_DEPTHS[color_depth]:
+            raise cv.Invalid(
+                f"{CONF_DOUBLE_BUFFER} requires the {CONF_COLOR_DEPTH} to match the {CONF_PIXEL_MODE}"
+            )
     denominator(config)
     return config
 
@@ -455,6 +463,8 @@ async def to_code(config):
             lamb, [(display.DisplayRef, "it")], return_type=cg.void
         )
         cg.add(var.set_writer(lambda_))
+    if config.get(CONF_DOUBLE_BUFFER) and requires_buffer(config):
+        cg.add(var.set_double_buffer(True))
     await display.register_display(var, config)
     await spi.register_spi_device(var, config)
     # Displays are write-only, set the SPI device to write-only as well
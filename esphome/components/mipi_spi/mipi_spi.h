@@ -196,6 +196,17 @@ class MipiSpi : public display::Display,
                             x_pad);
   }
 
+  // Pixels are only sent from the caller's buffer without conversion on a single bus.
+  bool enable_async_draw() override {
+    if constexpr (BUFFERPIXEL == DISPLAYPIXEL && (BUS_TYPE == BUS_TYPE_SINGLE || BUS_TYPE == BUS_TYPE_SINGLE_16)) {
+      this->async_writes_ = true;
+      return true;
+    }
+    return false;
+  }
+
+  void wait_draw_complete() override { this->wait_writes(); }
+
   void dump_config() override {
     esph_log_config(TAG,
                     "MIPI_SPI Display\n"
@@ -242,6 +253,9 @@ class MipiSpi : public display::Display,
   // Writes a command to the display, with the given bytes.
   void write_command_(uint8_t cmd, const uint8_t *bytes, size_t len) {
     esph_log_v(TAG, "Command %02X, length %d, bytes %s", cmd, len, format_hex_pretty(bytes, len).c_str());
+    // the DC pin must not change while pixel data is still being sent
+    if (this->async_writes_)
+      this->wait_writes();
     if constexpr (BUS_TYPE == BUS_TYPE_QUAD) {
       this->enable();
       this->write_cmd_addr_data(8, 0x02, 24, cmd << 8, bytes, len);
@@ -333,7 +347,11 @@ class MipiSpi : public display::Display,
   void write_display_data_(const uint8_t *ptr, size_t w, size_t h, size_t pad) {
     if (pad == 0) {
       if constexpr (BUS_TYPE == BUS_TYPE_SINGLE || BUS_TYPE == BUS_TYPE_SINGLE_16) {
-        this->write_array(ptr, w * h);
+        if (this->async_writes_) {
+          this->write_array_async(ptr, w * h);
+        } else {
+          this->write_array(ptr, w * h);
+        }
       } else if constexpr (BUS_TYPE == BUS_TYPE_QUAD) {
         this->write_cmd_addr_data(8, 0x32, 24, WDATA << 8, ptr, w * h, 4);
       } else if constexpr (BUS_TYPE == BUS_TYPE_OCTAL) {
@@ -342,7 +360,11 @@ class MipiSpi : public display::Display,
     } else {
       for (size_t y = 0; y != static_cast<size_t>(h); y++) {
         if constexpr (BUS_TYPE == BUS_TYPE_SINGLE || BUS_TYPE == BUS_TYPE_SINGLE_16) {
-          this->write_array(ptr, w);
+          if (this->async_writes_) {
+            this->write_array_async(ptr, w);
+          } else {
+            this->write_array(ptr, w);
+          }
         } else if constexpr (BUS_TYPE == BUS_TYPE_QUAD) {
           this->write_cmd_addr_data(8, 0x32, 24, WDATA << 8, ptr, w, 4);
         } else if constexpr (BUS_TYPE == BUS_TYPE_OCTAL) {
@@ -428,6 +450,8 @@ class MipiSpi : public display::Display,
   const char *model_{"Unknown"};
   std::vector<uint8_t> init_sequence_{};
   uint8_t madctl_{};
+  // pixel data is written with write_array_async(), and must be kept until wait_writes()
+  bool async_writes_{false};
 };
 
 /**
@@ -459,6 +483,12 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
 
   MipiSpiBuffer() { this->rotation_ = ROTATION; }
 
+  /// Render the next part of the display while the previous one is still being sent, with a second buffer.
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+
+  // async writes here are tied to the double buffer, which is only switched on in setup()
+  bool enable_async_draw() override { return false; }
+
   void dump_config() override {
     MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DISPLAYPIXEL, BUS_TYPE, WIDTH, HEIGHT, OFFSET_WIDTH,
             OFFSET_HEIGHT>::dump_config();
@@ -467,18 +497,33 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
                     "  Buffer pixels: %d bits\n"
                     "  Buffer fraction: 1/%d\n"
                     "  Buffer bytes: %zu\n"
+                    "  Double buffered: %s\n"
                     "  Draw rounding: %u",
                     this->rotation_, BUFFERPIXEL * 8, FRACTION,
-                    sizeof(BUFFERTYPE) * BUFFER_WIDTH * BUFFER_HEIGHT / FRACTION, ROUNDING);
+                    sizeof(BUFFERTYPE) * BUFFER_WIDTH * BUFFER_HEIGHT / FRACTION, YESNO(this->async_writes_),
+                    ROUNDING);
   }
 
   void setup() override {
     MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DISPLAYPIXEL, BUS_TYPE, WIDTH, HEIGHT, OFFSET_WIDTH,
             OFFSET_HEIGHT>::setup();
-    RAMAllocator<BUFFERTYPE> allocator{};
+    RAMAllocator<BUFFERTYPE> allocator(RAMSubsystem::DISPLAY);
     this->buffer_ = allocator.allocate(BUFFER_WIDTH * BUFFER_HEIGHT / FRACTION);
     if (this->buffer_ == nullptr) {
       this->mark_failed("Buffer allocation failed");
+      return;
+    }
+    // Only worth it when there is more than one part to draw, and the buffer itself is sent without conversion
+    if constexpr (FRACTION > 1 && BUFFERPIXEL == DISPLAYPIXEL &&
+                  (BUS_TYPE == BUS_TYPE_SINGLE || BUS_TYPE == BUS_TYPE_SINGLE_16)) {
+      if (this->double_buffer_) {
+        this->back_buffer_ = allocator.allocate(BUFFER_WIDTH * BUFFER_HEIGHT / FRACTION);
+        if (this->back_buffer_ == nullptr) {
+          esph_log_w(TAG, "Second buffer allocation failed, drawing single buffered");
+        } else {
+          this->async_writes_ = true;
+        }
+      }
     }
   }
 
@@ -511,7 +556,7 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       lap = millis();
 #endif
       if (this->x_low_ > this->x_high_ || this->y_low_ > this->y_high_)
-        return;
+        break;
       esph_log_v(TAG, "x_low %d, y_low %d, x_high %d, y_high %d", this->x_low_, this->y_low_, this->x_high_,
                  this->y_high_);
       // Some chips require that the drawing window be aligned on certain boundaries
@@ -521,8 +566,12 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       this->y_high_ = (this->y_high_ + ROUNDING) / ROUNDING * ROUNDING - 1;
       int w = this->x_high_ - this->x_low_ + 1;
       int h = this->y_high_ - this->y_low_ + 1;
+      // the previous part must be out before the DC pin is switched for the address window
+      this->wait_writes();
       this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_,
                               this->y_low_ - this->start_line_, BUFFER_WIDTH - w);
+      if (this->async_writes_)
+        std::swap(this->buffer_, this->back_buffer_);
       // invalidate watermarks
       this->x_low_ = WIDTH;
       this->y_low_ = HEIGHT;
@@ -533,6 +582,7 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       lap = millis();
 #endif
     }
+    this->wait_writes();
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
     esph_log_v(TAG, "Total update took %dms", millis() - now);
 #endif
@@ -560,6 +610,51 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     }
   }
 
+  // Fill a run of pixels on one row, written straight into the buffer when the row is not rotated to a column.
+  void fill_span(int x, int y, int width, Color color) override {
+    if constexpr (ROTATION == display::DISPLAY_ROTATION_90_DEGREES ||
+                  ROTATION == display::DISPLAY_ROTATION_270_DEGREES) {
+      display::Display::fill_span(x, y, width, color);
+    } else {
+      int min_x = std::max(x, 0);
+      int max_x = std::min(x + width, (int) WIDTH);
+      const auto clipping = this->get_clipping();
+      if (clipping.is_set()) {
+        if (y < clipping.y || y >= clipping.y2())
+          return;
+        min_x = std::max(min_x, (int) clipping.x);
+        max_x = std::min(max_x, (int) clipping.x2());
+      }
+      if (min_x >= max_x)
+        return;
+      if (y < 0 || y >= HEIGHT)
+        return;
+      // Native coordinates of the first and last pixel of the run
+      int x1 = min_x;
+      int x2 = max_x - 1;
+      if constexpr (ROTATION == display::DISPLAY_ROTATION_180_DEGREES) {
+        x1 = WIDTH - max_x;
+        x2 = WIDTH - min_x - 1;
+        y = HEIGHT - y - 1;
+      }
+      if (y < this->start_line_ || y >= this->end_line_)
+        return;
+      std::fill_n(this->buffer_ + (y - this->start_line_) * BUFFER_WIDTH + x1, x2 - x1 + 1, convert_color(color));
+      if (x1 < this->x_low_) {
+        this->x_low_ = x1;
+      }
+      if (x2 > this->x_high_) {
+        this->x_high_ = x2;
+      }
+      if (y < this->y_low_) {
+        this->y_low_ = y;
+      }
+      if (y > this->y_high_) {
+        this->y_high_ = y;
+      }
+    }
+  }
+
   // Fills the display with a color.
   void fill(Color color) override {
     this->x_low_ = 0;
@@ -613,6 +708,9 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
   }
 
   BUFFERTYPE *buffer_{};
+  // part still being sent while the next one is drawn into buffer_
+  BUFFERTYPE *back_buffer_{};
+  bool double_buffer_{false};
   uint16_t x_low_{WIDTH};
   uint16_t y_low_{HEIGHT};
   uint16_t x_high_{0};
@@ -37,6 +37,8 @@ const uint8_t MITSUBISHI_NIGHTMODE = 0xC1;
 const uint16_t MITSUBISHI_BIT_MARK = 430;
 const uint16_t MITSUBISHI_ONE_SPACE = 1250;
 const uint16_t MITSUBISHI_ZERO_SPACE = 390;
+constexpr remote_base::PulseDistanceTimings MITSUBISHI_BIT_TIMINGS{MITSUBISHI_BIT_MARK, MITSUBISHI_ONE_SPACE,
+                                                                   MITSUBISHI_ZERO_SPACE};
 const uint16_t MITSUBISHI_HEADER_MARK = 3500;
 const uint16_t MITSUBISHI_HEADER_SPACE = 1700;
 const uint16_t MITSUBISHI_MIN_GAP = 17500;
@@ -255,19 +257,14 @@ void MitsubishiClimate::transmit_state() {
   auto *data = transmit.get_data();
 
   data->set_carrier_frequency(38000);
+  data->reserve(2 * (sizeof(remote_state) * 16 + 4));
   // repeat twice
   for (uint8_t r = 0; r < 2; r++) {
     // Header
     data->mark(MITSUBISHI_HEADER_MARK);
     data->space(MITSUBISHI_HEADER_SPACE);
     // Data
-    for (uint8_t i : remote_state) {
-      for (uint8_t j = 0; j < 8; j++) {
-        data->mark(MITSUBISHI_BIT_MARK);
-        bool bit = i & (1 << j);
-        data->space(bit ? MITSUBISHI_ONE_SPACE : MITSUBISHI_ZERO_SPACE);
-      }
-    }
+    data->encode_bytes(remote_state, sizeof(remote_state), MITSUBISHI_BIT_TIMINGS);
     // Footer
     if (r == 0) {
       data->mark(MITSUBISHI_BIT_MARK);
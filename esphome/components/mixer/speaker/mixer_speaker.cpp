@@ -145,14 +145,14 @@ esp_err_t SourceSpeaker::start_() {
     std::shared_ptr<RingBuffer> temp_ring_buffer;
 
     if (!this->ring_buffer_.use_count()) {
-      temp_ring_buffer = RingBuffer::create(ring_buffer_size);
+      temp_ring_buffer = RingBuffer::create(ring_buffer_size, RAMSubsystem::AUDIO);
       this->ring_buffer_ = temp_ring_buffer;
     }
 
     if (!this->ring_buffer_.use_count()) {
       return ESP_ERR_NO_MEM;
     } else {
-      this->transfer_buffer_->set_source(temp_ring_buffer);
+      this->transfer_buffer_->set_source(temp_ring_buffer, true);
     }
   }
 
@@ -450,6 +450,12 @@ void MixerSpeaker::mix_audio_samples(const int16_t *primary_buffer, audio::Audio
   const uint8_t secondary_channels = secondary_stream_info.get_channels();
   const uint8_t output_channels = output_stream_info.get_channels();
 
+  if ((primary_channels == output_channels) && (secondary_channels == output_channels)) {
+    // Samples line up one to one, mix the buffers as flat sample arrays
+    audio::add_audio_samples(primary_buffer, secondary_buffer, output_buffer, frames_to_mix * output_channels);
+    return;
+  }
+
   const uint8_t max_primary_channel_index = primary_channels - 1;
   const uint8_t max_secondary_channel_index = secondary_channels - 1;
 
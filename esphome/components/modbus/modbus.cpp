@@ -143,6 +143,10 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
         ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
       } else {
         ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
+        for (auto *device : this->devices_) {
+          if (device->address_ == address)
+            device->on_modbus_crc_error();
+        }
         return false;
       }
     }
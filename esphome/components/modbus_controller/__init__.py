@@ -23,6 +23,8 @@ from .const import (
     CONF_ENABLED,
     CONF_FORCE_NEW_RANGE,
     CONF_MAX_CMD_RETRIES,
+    CONF_MAX_OFFLINE_SKIP_UPDATES,
+    CONF_MAX_REGISTER_GAP,
     CONF_MODBUS_CONTROLLER_ID,
     CONF_OFFLINE_SKIP_UPDATES,
     CONF_ON_COMMAND_SENT,
@@ -178,6 +180,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_SERVER_COURTESY_RESPONSE): SERVER_COURTESY_RESPONSE_SCHEMA,
             cv.Optional(CONF_MAX_CMD_RETRIES, default=4): cv.positive_int,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            cv.Optional(CONF_MAX_OFFLINE_SKIP_UPDATES, default=0): cv.int_range(
+                min=0, max=65535
+            ),
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.int_range(min=0, max=64),
             cv.Optional(
                 CONF_SERVER_REGISTERS,
             ): cv.ensure_list(ModbusServerRegisterSchema),
@@ -329,6 +335,10 @@ async def to_code(config):
         )
     cg.add(var.set_max_cmd_retries(config[CONF_MAX_CMD_RETRIES]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    cg.add(
+        var.set_max_offline_skip_updates(config[CONF_MAX_OFFLINE_SKIP_UPDATES])
+    )
+    cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
     if CONF_SERVER_REGISTERS in config:
         for server_register in config[CONF_SERVER_REGISTERS]:
             server_register_var = cg.new_Pvariable(
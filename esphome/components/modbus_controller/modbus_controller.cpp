@@ -20,21 +20,31 @@ bool ModbusController::send_next_command_() {
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
     auto &command = this->command_queue_.front();
+    // a command still in the queue after being sent got no response in time
+    if (command->get_send_count() > 0)
+      this->timeout_count_++;
 
     // remove from queue if command was sent too often
     if (!command->should_retry(this->max_cmd_retries_)) {
       if (!this->module_offline_) {
         ESP_LOGW(TAG, "Modbus device=%d set offline", this->address_);
 
-        if (this->offline_skip_updates_ > 0) {
+        this->offline_backoff_ = this->offline_skip_updates_;
+        this->offline_backoff_raised_ = true;
+        if (this->offline_backoff_ > 0) {
           // Update skip_updates_counter to stop flooding channel with timeouts
-          for (auto &r : this->register_ranges_) {
-            r.skip_updates_counter = this->offline_skip_updates_;
-          }
+          this->apply_offline_skip_updates_(this->offline_backoff_);
         }
 
         this->module_offline_ = true;
         this->offline_callback_.call((int) command->function_code, command->register_address);
+      } else if (this->max_offline_skip_updates_ > this->offline_backoff_ && !this->offline_backoff_raised_) {
+        // Still offline after the skipped updates, back off further so it uses less bus time
+        this->offline_backoff_ = std::min<uint32_t>(std::max<uint32_t>(this->offline_backoff_ * 2, 1),
+                                                    this->max_offline_skip_updates_);
+        this->offline_backoff_raised_ = true;
+        ESP_LOGD(TAG, "Modbus device=%d still offline, skipping %u updates", this->address_, this->offline_backoff_);
+        this->apply_offline_skip_updates_(this->offline_backoff_);
       }
       ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
                this->address_, command->register_address);
@@ -64,17 +74,17 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
     if (this->module_offline_) {
       ESP_LOGW(TAG, "Modbus device=%d back online", this->address_);
 
-      if (this->offline_skip_updates_ > 0) {
+      if (this->offline_backoff_ > 0) {
         // Restore skip_updates_counter to restore commands updates
-        for (auto &r : this->register_ranges_) {
-          r.skip_updates_counter = 0;
-        }
+        this->apply_offline_skip_updates_(0);
       }
+      this->offline_backoff_ = 0;
       // Restore module online state
       this->module_offline_ = false;
       this->online_callback_.call((int) current_command->function_code, current_command->register_address);
     }
 
+    this->record_response_();
     // Move the commandItem to the response queue
     current_command->payload = data;
     this->incoming_queue_.push(std::move(current_command));
@@ -101,6 +111,7 @@ void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_
              "payload size=%zu",
              function_code, current_command->register_address, current_command->register_count,
              current_command->payload.size());
+    this->record_response_();
     this->command_queue_.pop_front();
   }
 }
@@ -297,24 +308,8 @@ void ModbusController::update_range_(RegisterRange &r) {
   ESP_LOGV(TAG, "Range : %X Size: %x (%d) skip: %d", r.start_address, r.register_count, (int) r.register_type,
            r.skip_updates_counter);
   if (r.skip_updates_counter == 0) {
-    // if a custom command is used the user supplied custom_data is only available in the SensorItem.
-    if (r.register_type == ModbusRegisterType::CUSTOM) {
-      auto sensors = this->find_sensors_(r.register_type, r.start_address);
-      if (!sensors.empty()) {
-        auto sensor = sensors.cbegin();
-        auto command_item = ModbusCommandItem::create_custom_command(
-            this, (*sensor)->custom_data,
-            [this](ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data) {
-              this->on_register_data(ModbusRegisterType::CUSTOM, start_address, data);
-            });
-        command_item.register_address = (*sensor)->start_address;
-        command_item.register_count = (*sensor)->register_count;
-        command_item.function_code = ModbusFunctionCode::CUSTOM;
-        queue_command(command_item);
-      }
-    } else {
-      queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
-    }
+    if (r.read_command != nullptr)
+      queue_command(*r.read_command);
     r.skip_updates_counter = r.skip_updates;  // reset counter to config value
   } else {
     r.skip_updates_counter--;
@@ -331,12 +326,31 @@ void ModbusController::update() {
     ESP_LOGV(TAG, "Updating modbus component");
   }
 
+  this->offline_backoff_raised_ = false;
   for (auto &r : this->register_ranges_) {
     ESP_LOGVV(TAG, "Updating range 0x%X", r.start_address);
     update_range_(r);
   }
 }
 
+void ModbusController::record_response_() {
+  const uint32_t response_time = millis() - this->last_command_timestamp_;
+  // exponential moving average over about 8 responses, the first one seeds it
+  if (this->response_count_ == 0) {
+    this->average_response_time_ = response_time;
+  } else {
+    this->average_response_time_ = (this->average_response_time_ * 7 + response_time) / 8;
+  }
+  this->max_response_time_ = std::max(this->max_response_time_, response_time);
+  this->response_count_++;
+}
+
+void ModbusController::apply_offline_skip_updates_(uint16_t skip_updates) {
+  for (auto &r : this->register_ranges_) {
+    r.skip_updates_counter = skip_updates;
+  }
+}
+
 // walk through the sensors and determine the register ranges to read
 size_t ModbusController::create_register_ranges_() {
   this->register_ranges_.clear();
@@ -388,6 +402,25 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (this->can_bridge_gap_(r, prev, curr)) {
+          // this register is close enough to read the unused registers in between as part of the range
+
+          // remove this sensore because start_address is changed (sort-order)
+          ix = this->sensorset_.erase(ix);
+
+          const uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+          buffer_offset += gap * 2;
+          curr->start_address = r.start_address;
+          curr->offset += buffer_offset;
+          buffer_offset += curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+
+          this->sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Bridge gap of %u - change to register: 0x%X %d offset=%u", gap, curr->start_address,
+                   curr->register_count, curr->offset);
         } else if (curr->start_address == (r.start_address + r.register_count)) {
           // this register can extend the current range
 
@@ -441,20 +474,58 @@ size_t ModbusController::create_register_ranges_() {
     this->register_ranges_.push_back(r);
   }
 
+  for (auto &range : this->register_ranges_)
+    range.read_command = this->create_range_command_(range);
+
   return this->register_ranges_.size();
 }
 
+bool ModbusController::can_bridge_gap_(const RegisterRange &r, const SensorItem *prev, const SensorItem *curr) const {
+  if (this->max_register_gap_ == 0 ||
+      (curr->register_type != ModbusRegisterType::HOLDING && curr->register_type != ModbusRegisterType::READ))
+    return false;
+  // Sensors overriding the response size break the two bytes per register layout the offsets rely on
+  if (curr->response_bytes != 0 || prev->response_bytes != 0)
+    return false;
+  const uint32_t end = r.start_address + r.register_count;
+  if (curr->start_address <= end || curr->start_address - end > this->max_register_gap_)
+    return false;
+  return curr->start_address + curr->register_count - r.start_address <= modbus::MAX_NUM_OF_REGISTERS_TO_READ;
+}
+
+std::shared_ptr<ModbusCommandItem> ModbusController::create_range_command_(const RegisterRange &r) {
+  if (r.register_type != ModbusRegisterType::CUSTOM) {
+    return std::make_shared<ModbusCommandItem>(
+        ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
+  }
+  // if a custom command is used the user supplied custom_data is only available in the SensorItem.
+  auto sensors = this->find_sensors_(r.register_type, r.start_address);
+  if (sensors.empty())
+    return nullptr;
+  auto sensor = sensors.cbegin();
+  auto command_item = ModbusCommandItem::create_custom_command(
+      this, (*sensor)->custom_data,
+      [this](ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data) {
+        this->on_register_data(ModbusRegisterType::CUSTOM, start_address, data);
+      });
+  command_item.register_address = (*sensor)->start_address;
+  command_item.register_count = (*sensor)->register_count;
+  command_item.function_code = ModbusFunctionCode::CUSTOM;
+  return std::make_shared<ModbusCommandItem>(std::move(command_item));
+}
+
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "ModbusController:\n"
                 "  Address: 0x%02X\n"
                 "  Max Command Retries: %d\n"
                 "  Offline Skip Updates: %d\n"
+                "  Max Offline Skip Updates: %d\n"
                 "  Server Courtesy Response:\n"
                 "    Enabled: %s\n"
                 "    Register Last Address: 0x%02X\n"
                 "    Register Value: %d",
-                this->address_, this->max_cmd_retries_, this->offline_skip_updates_,
+                this->address_, this->max_cmd_retries_, this->offline_skip_updates_, this->max_offline_skip_updates_,
                 this->server_courtesy_response_.enabled ? "true" : "false",
                 this->server_courtesy_response_.register_last_address, this->server_courtesy_response_.register_value);
 
@@ -485,11 +556,11 @@ void ModbusController::loop() {
     if (message != nullptr)
       this->process_modbus_data_(message.get());
     this->incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    this->send_next_command_();
   }
+  // Send the next command right away, the bus would otherwise idle for a loop iteration after every response.
+  // Controllers of other devices on the bus take turns as soon as it is free.
+  if (this->incoming_queue_.empty())
+    this->send_next_command_();
 }
 
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
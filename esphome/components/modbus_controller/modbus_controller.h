@@ -6,6 +6,7 @@
 #include "esphome/core/automation.h"
 
 #include <list>
+#include <memory>
 #include <queue>
 #include <set>
 #include <utility>
@@ -332,6 +333,8 @@ class SensorItemsComparator {
 
 using SensorSet = std::set<SensorItem *, SensorItemsComparator>;
 
+class ModbusCommandItem;
+
 struct RegisterRange {
   uint16_t start_address;
   ModbusRegisterType register_type;
@@ -339,6 +342,8 @@ struct RegisterRange {
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  // Built once by create_register_ranges_, every update queues a copy
+  std::shared_ptr<ModbusCommandItem> read_command;
 };
 
 class ModbusCommandItem {
@@ -355,6 +360,8 @@ class ModbusCommandItem {
   bool send();
   /// Check if the command should be retried based on the max_retries parameter
   bool should_retry(uint8_t max_retries) { return this->send_count_ <= max_retries; };
+  /// How many times the command has been sent so far
+  uint8_t get_send_count() const { return this->send_count_; }
 
   /// factory methods
   /** Create modbus read command
@@ -476,6 +483,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_data(const std::vector<uint8_t> &data) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
+  /// called when a frame from this device failed the CRC check
+  void on_modbus_crc_error() override { this->crc_error_count_++; }
   /// called when a modbus request (function code 0x03 or 0x04) was parsed without errors
   void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers) final;
   /// called when a modbus request (function code 0x06 or 0x10) was parsed without errors
@@ -494,8 +503,24 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool get_allow_duplicate_commands() { return this->allow_duplicate_commands_; }
   /// called by esphome generated code to set the command_throttle period
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
+  /// called by esphome generated code to set how many unused registers may be read to merge two ranges
+  void set_max_register_gap(uint8_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// called by esphome generated code to set the upper limit the offline skip updates double up to
+  void set_max_offline_skip_updates(uint16_t max_offline_skip_updates) {
+    this->max_offline_skip_updates_ = max_offline_skip_updates;
+  }
+  /// number of responses received
+  uint32_t get_response_count() const { return this->response_count_; }
+  /// number of commands sent without receiving a response in time
+  uint32_t get_timeout_count() const { return this->timeout_count_; }
+  /// number of frames of this device that failed the CRC check
+  uint32_t get_crc_error_count() const { return this->crc_error_count_; }
+  /// moving average of the time between sending a command and receiving its response in ms
+  uint32_t get_average_response_time() const { return this->average_response_time_; }
+  /// longest time between sending a command and receiving its response in ms
+  uint32_t get_max_response_time() const { return this->max_response_time_; }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -520,6 +545,14 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// update the response metrics with the response to the last command sent
+  void record_response_();
+  /// skip the updates of all ranges while the module is offline
+  void apply_offline_skip_updates_(uint16_t skip_updates);
+  /// whether curr is close enough to the end of the range r to read the registers in between
+  bool can_bridge_gap_(const RegisterRange &r, const SensorItem *prev, const SensorItem *curr) const;
+  /// build the command reading the range, reused for every update
+  std::shared_ptr<ModbusCommandItem> create_range_command_(const RegisterRange &r);
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
@@ -550,6 +583,20 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool module_offline_{false};
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_{0};
+  /// how many unused registers may be read to merge two ranges into one command
+  uint8_t max_register_gap_{0};
+  /// upper limit of the skip updates doubling while the module stays offline, 0 keeps offline_skip_updates
+  uint16_t max_offline_skip_updates_{0};
+  /// skip updates applied the next time the module is found offline
+  uint16_t offline_backoff_{0};
+  /// if the offline backoff was already raised since the last update
+  bool offline_backoff_raised_{false};
+  /// response metrics
+  uint32_t response_count_{0};
+  uint32_t timeout_count_{0};
+  uint32_t crc_error_count_{0};
+  uint32_t average_response_time_{0};
+  uint32_t max_response_time_{0};
   /// How many times we will retry a command if we get no response
   uint8_t max_cmd_retries_{4};
   /// Command sent callback
@@ -71,6 +71,7 @@ def AUTO_LOAD():
 CONF_DISCOVER_IP = "discover_ip"
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_WAIT_FOR_CONNECTION = "wait_for_connection"
+CONF_PUBLISH_COALESCE_INTERVAL = "publish_coalesce_interval"
 
 
 def validate_message_just_topic(value):
@@ -302,6 +303,9 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_PUBLISH_NAN_AS_NONE, default=False): cv.boolean,
             cv.Optional(CONF_WAIT_FOR_CONNECTION, default=False): cv.boolean,
+            cv.Optional(
+                CONF_PUBLISH_COALESCE_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
         }
     ),
     validate_config,
@@ -458,6 +462,11 @@ async def to_code(config):
 
     cg.add(var.set_wait_for_connection(config[CONF_WAIT_FOR_CONNECTION]))
 
+    if config[CONF_PUBLISH_COALESCE_INTERVAL].total_milliseconds > 0:
+        cg.add(
+            var.set_publish_coalesce_interval(config[CONF_PUBLISH_COALESCE_INTERVAL])
+        )
+
 
 MQTT_PUBLISH_ACTION_SCHEMA = cv.Schema(
     {
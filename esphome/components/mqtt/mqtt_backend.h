@@ -58,6 +58,9 @@ class MQTTBackend {
   virtual bool unsubscribe(const char *topic) = 0;
   virtual bool publish(const char *topic, const char *payload, size_t length, uint8_t qos, bool retain) = 0;
 
+  /// Whether earlier messages are still waiting to go out, bulk senders back off while it is true.
+  virtual bool is_outbound_busy() const { return false; }
+
   virtual bool publish(const MQTTMessage &message) {
     return publish(message.topic.c_str(), message.payload.c_str(), message.payload.length(), message.qos,
                    message.retain);
@@ -120,6 +120,8 @@ class MQTTBackendESP32 final : public MQTTBackend {
   static const size_t TASK_STACK_SIZE_TLS = 4096;  // Larger stack for TLS operations
   static const ssize_t TASK_PRIORITY = 5;
   static const uint8_t MQTT_QUEUE_LENGTH = 30;  // 30*12 bytes = 360
+  // Unacknowledged bytes in the esp-mqtt outbox above which the backend reports itself busy
+  static const int MQTT_OUTBOX_BUSY_SIZE = MQTT_BUFFER_SIZE;
 
   void set_keep_alive(uint16_t keep_alive) final { this->keep_alive_ = keep_alive; }
   void set_client_id(const char *client_id) final { this->client_id_ = client_id; }
@@ -205,6 +207,14 @@ class MQTTBackendESP32 final : public MQTTBackend {
   }
   using MQTTBackend::publish;
 
+  bool is_outbound_busy() const final {
+#if defined(USE_MQTT_IDF_ENQUEUE)
+    return this->mqtt_queue_.size() >= MQTT_QUEUE_LENGTH / 2;
+#else
+    return this->is_initalized_ && esp_mqtt_client_get_outbox_size(this->handler_.get()) > MQTT_OUTBOX_BUSY_SIZE;
+#endif
+  }
+
   void loop() final;
 
   void set_ca_certificate(const std::string &cert) { ca_certificate_ = cert; }
@@ -27,6 +27,11 @@ namespace mqtt {
 
 static const char *const TAG = "mqtt";
 
+// Components whose discovery and state are sent per loop after a connect
+static const uint8_t MQTT_RESEND_PER_LOOP = 2;
+// How long retained discovery payloads are collected before the resend starts
+static const uint32_t MQTT_RETAINED_DISCOVERY_WAIT_MS = 1000;
+
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
   const std::string mac_addr = get_mac_address();
@@ -65,7 +70,8 @@ void MQTTClientComponent::setup() {
                            .qos = this->log_message_.qos,
                            .retain = this->log_message_.retain});
           }
-        });
+        },
+        this->log_level_);
   }
 #endif
 
@@ -177,6 +183,9 @@ void MQTTClientComponent::dump_config() {
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+  if (this->publish_coalesce_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Coalesce Interval: %" PRIu32 " ms", this->publish_coalesce_interval_);
+  }
 }
 bool MQTTClientComponent::can_proceed() {
   return network::is_disabled() || this->state_ == MQTT_CLIENT_DISABLED || this->is_connected() ||
@@ -313,9 +322,57 @@ void MQTTClientComponent::check_connected() {
 
   this->resubscribe_subscriptions_();
   this->send_device_info_();
+  this->start_resend_();
+}
+
+std::string MQTTClientComponent::get_retained_discovery_topic_() const {
+  return this->discovery_info_.prefix + "/+/" + str_sanitize(App.get_name()) + "/+/config";
+}
 
+void MQTTClientComponent::start_resend_() {
+  this->resend_index_ = 0;
+  this->resend_start_ = millis();
+  if (!this->is_discovery_enabled() || !this->discovery_info_.retain || this->discovery_info_.clean)
+    return;
+
+  // What the broker still retains from the last connection decides which discovery payloads are resent
   for (MQTTComponent *component : this->children_)
-    component->schedule_resend_state();
+    component->clear_retained_discovery();
+  if (this->retained_discovery_subscribed_)
+    return;
+  this->subscribe(this->get_retained_discovery_topic_(), [this](const std::string &topic, const std::string &payload) {
+    const uint32_t topic_hash = fnv1_hash(topic);
+    const uint32_t payload_hash = fnv1_hash(payload);
+    for (MQTTComponent *component : this->children_) {
+      if (component->set_retained_discovery(topic_hash, payload_hash))
+        break;
+    }
+  });
+  this->retained_discovery_subscribed_ = true;
+}
+
+void MQTTClientComponent::process_resend_() {
+  if (this->resend_index_ >= this->children_.size()) {
+    if (this->retained_discovery_subscribed_) {
+      this->unsubscribe(this->get_retained_discovery_topic_());
+      this->retained_discovery_subscribed_ = false;
+    }
+    return;
+  }
+  // Give the broker time to deliver the retained discovery payloads
+  if (this->retained_discovery_subscribed_ && millis() - this->resend_start_ < MQTT_RETAINED_DISCOVERY_WAIT_MS)
+    return;
+
+  for (uint8_t sent = 0; sent < MQTT_RESEND_PER_LOOP && this->resend_index_ < this->children_.size(); sent++) {
+    if (this->mqtt_backend_.is_outbound_busy())
+      return;
+    MQTTComponent *component = this->children_[this->resend_index_++];
+    if (!component->send_discovery_and_state()) {
+      // The component retries on its own, the others wait for the next loop
+      component->schedule_resend_state();
+      return;
+    }
+  }
 }
 
 void MQTTClientComponent::loop() {
@@ -388,10 +445,16 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->process_resend_();
       }
       break;
   }
 
+  if (!this->publish_queue_.empty() && now - this->last_publish_flush_ >= this->publish_coalesce_interval_) {
+    this->flush_publish_queue_();
+    this->last_publish_flush_ = now;
+  }
+
   if (millis() - this->last_connected_ > this->reboot_timeout_ && this->reboot_timeout_ != 0) {
     ESP_LOGE(TAG, "Can't connect; restarting");
     App.reboot();
@@ -500,6 +563,38 @@ bool MQTTClientComponent::publish(const MQTTMessage &message) {
     // critical components will re-transmit their messages
     return false;
   }
+  if (this->publish_coalesce_interval_ == 0 || this->log_message_.topic == message.topic)
+    return this->publish_now_(message);
+
+  for (auto it = this->publish_queue_.begin(); it != this->publish_queue_.end(); ++it) {
+    if (it->topic != message.topic)
+      continue;
+    if (message.qos != 0) {
+      // A queued older value must not overwrite this one later
+      this->publish_queue_.erase(it);
+      break;
+    }
+    it->payload = message.payload;
+    it->retain = message.retain;
+    return true;
+  }
+  if (message.qos != 0)
+    return this->publish_now_(message);
+  this->publish_queue_.push_back(message);
+  return true;
+}
+
+void MQTTClientComponent::flush_publish_queue_() {
+  if (!this->is_connected()) {
+    this->publish_queue_.clear();
+    return;
+  }
+  for (const auto &message : this->publish_queue_)
+    this->publish_now_(message);
+  this->publish_queue_.clear();
+}
+
+bool MQTTClientComponent::publish_now_(const MQTTMessage &message) {
   bool logging_topic = this->log_message_.topic == message.topic;
   bool ret = this->mqtt_backend_.publish(message);
   delay(0);
@@ -523,8 +618,8 @@ bool MQTTClientComponent::publish(const MQTTMessage &message) {
 }
 bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
                                        bool retain) {
-  std::string message = json::build_json(f);
-  return this->publish(topic, message, qos, retain);
+  // The payload is moved into the message instead of being copied once more
+  return this->publish({.topic = topic, .payload = json::build_json(f), .qos = qos, .retain = retain});
 }
 
 void MQTTClientComponent::enable() {
@@ -206,6 +206,9 @@ class MQTTClientComponent : public Component {
   void unsubscribe(const std::string &topic);
 
   /** Publish a MQTTMessage
+   *
+   * With a coalesce interval set, QoS 0 messages are queued and only the latest payload of each topic is sent on the
+   * next flush.
    *
    * @param message The message.
    */
@@ -270,6 +273,11 @@ class MQTTClientComponent : public Component {
 
   void set_wait_for_connection(bool wait_for_connection) { this->wait_for_connection_ = wait_for_connection; }
 
+  /// Hold QoS 0 messages for this long and send only the latest payload per topic. 0 publishes right away.
+  void set_publish_coalesce_interval(uint32_t publish_coalesce_interval) {
+    this->publish_coalesce_interval_ = publish_coalesce_interval;
+  }
+
  protected:
   void send_device_info_();
 
@@ -286,6 +294,16 @@ class MQTTClientComponent : public Component {
   /// Re-calculate the availability property.
   void recalculate_availability_();
 
+  /// Hand the message to the backend, retrying once.
+  bool publish_now_(const MQTTMessage &message);
+  /// Send the coalesced messages, dropped while disconnected since components resend their state on reconnect.
+  void flush_publish_queue_();
+
+  /// Start sending discovery and state of all components again, a few per loop.
+  void start_resend_();
+  void process_resend_();
+  std::string get_retained_discovery_topic_() const;
+
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
@@ -331,6 +349,10 @@ class MQTTClientComponent : public Component {
   bool dns_resolve_error_{false};
   bool enable_on_boot_{true};
   std::vector<MQTTComponent *> children_;
+  // Next child to resend after a connect, past the end when there is nothing to do
+  size_t resend_index_{SIZE_MAX};
+  uint32_t resend_start_{0};
+  bool retained_discovery_subscribed_{false};
   uint32_t reboot_timeout_{300000};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
@@ -339,6 +361,11 @@ class MQTTClientComponent : public Component {
 
   bool publish_nan_as_none_{false};
   bool wait_for_connection_{false};
+
+  uint32_t publish_coalesce_interval_{0};
+  uint32_t last_publish_flush_{0};
+  // Pending QoS 0 messages, at most one per topic
+  std::vector<MQTTMessage> publish_queue_;
 };
 
 extern MQTTClientComponent *global_mqtt_client;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
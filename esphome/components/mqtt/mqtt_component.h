@@ -115,6 +115,14 @@ class MQTTComponent : public Component {
   /// Internal method for the MQTT client base to schedule a resend of the state on reconnect.
   void schedule_resend_state();
 
+  /// Send the discovery info (if enabled) and the current state, false if any of them has to be resent.
+  bool send_discovery_and_state();
+
+  /// Internal method for the MQTT client base: remember the payload retained on the broker for a discovery topic,
+  /// an unchanged discovery payload is then not published again. Returns whether the topic is this component's.
+  bool set_retained_discovery(uint32_t topic_hash, uint32_t payload_hash);
+  void clear_retained_discovery() { this->retained_discovery_hash_ = 0; }
+
   /** Send a MQTT message.
    *
    * @param topic The topic.
@@ -174,10 +182,13 @@ class MQTTComponent : public Component {
   virtual bool is_disabled_by_default() const;
 
   /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  const std::string &get_state_topic_() const { return this->state_topic_; }
 
   /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  const std::string &get_command_topic_() const { return this->command_topic_; }
+
+  /// Build the state and command topics once, before setup(), instead of on every publish.
+  void intern_topics_();
 
   bool is_connected_() const;
 
@@ -194,6 +205,13 @@ class MQTTComponent : public Component {
 
   std::unique_ptr<Availability> availability_;
 
+  // Set up by intern_topics_()
+  std::string state_topic_;
+  std::string command_topic_;
+  uint32_t discovery_topic_hash_{0};
+  // Hash of the discovery payload known to be retained on the broker, 0 if unknown
+  uint32_t retained_discovery_hash_{0};
+
   bool has_custom_state_topic_{false};
   bool has_custom_command_topic_{false};
 
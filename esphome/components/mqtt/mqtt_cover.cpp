@@ -68,8 +68,8 @@ void MQTTCoverComponent::dump_config() {
 }
 void MQTTCoverComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (!this->cover_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->cover_->get_device_class();
+  if (!this->cover_->get_device_class_ref().empty())
+    root[MQTT_DEVICE_CLASS] = this->cover_->get_device_class_ref();
 
   auto traits = this->cover_->get_traits();
   if (traits.get_is_assumed_state()) {
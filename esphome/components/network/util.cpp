@@ -63,6 +63,13 @@ bool is_disabled() {
   return false;
 }
 
+void request_fast_poll() {
+#ifdef USE_OPENTHREAD
+  if (openthread::global_openthread_component != nullptr)
+    openthread::global_openthread_component->request_fast_poll();
+#endif
+}
+
 network::IPAddresses get_ip_addresses() {
 #ifdef USE_ETHERNET
   if (ethernet::global_eth_component != nullptr)
@@ -14,6 +14,9 @@ bool is_disabled();
 /// Get the active network hostname
 const std::string &get_use_address();
 IPAddresses get_ip_addresses();
+/// Tell the network that a reply is expected soon, so a sleepy interface (Thread SED) wakes up more often for a while.
+/// Must be called from the main loop.
+void request_fast_poll();
 
 }  // namespace network
 }  // namespace esphome
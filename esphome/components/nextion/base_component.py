@@ -9,6 +9,7 @@ from . import CONF_NEXTION_ID, Nextion
 
 CONF_AUTO_WAKE_ON_TOUCH = "auto_wake_on_touch"
 CONF_BACKGROUND_PRESSED_COLOR = "background_pressed_color"
+CONF_COMMAND_BATCH_SIZE = "command_batch_size"
 CONF_COMMAND_SPACING = "command_spacing"
 CONF_COMPONENT_NAME = "component_name"
 CONF_DUMP_DEVICE_INFO = "dump_device_info"
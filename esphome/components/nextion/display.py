@@ -14,6 +14,7 @@ from esphome.core import CORE, TimePeriod
 from . import Nextion, nextion_ns, nextion_ref
 from .base_component import (
     CONF_AUTO_WAKE_ON_TOUCH,
+    CONF_COMMAND_BATCH_SIZE,
     CONF_COMMAND_SPACING,
     CONF_DUMP_DEVICE_INFO,
     CONF_EXIT_REPARSE_ON_START,
@@ -48,12 +49,22 @@ BufferOverflowTrigger = nextion_ns.class_(
     "BufferOverflowTrigger", automation.Trigger.template()
 )
 
-CONFIG_SCHEMA = (
+
+def _validate_command_batch_size(config):
+    if CONF_COMMAND_BATCH_SIZE in config and CONF_COMMAND_SPACING not in config:
+        raise cv.Invalid(
+            f"'{CONF_COMMAND_BATCH_SIZE}' requires '{CONF_COMMAND_SPACING}' to be set"
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
     display.BASIC_DISPLAY_SCHEMA.extend(
         {
             cv.GenerateID(): cv.declare_id(Nextion),
             cv.Optional(CONF_AUTO_WAKE_ON_TOUCH, default=True): cv.boolean,
             cv.Optional(CONF_BRIGHTNESS): cv.percentage,
+            cv.Optional(CONF_COMMAND_BATCH_SIZE): cv.int_range(min=1, max=32),
             cv.Optional(CONF_COMMAND_SPACING): cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(max=TimePeriod(milliseconds=255)),
@@ -104,7 +115,8 @@ CONFIG_SCHEMA = (
         }
     )
     .extend(cv.polling_component_schema("5s"))
-    .extend(uart.UART_DEVICE_SCHEMA)
+    .extend(uart.UART_DEVICE_SCHEMA),
+    _validate_command_batch_size,
 )
 
 
@@ -140,6 +152,8 @@ async def to_code(config):
     if command_spacing := config.get(CONF_COMMAND_SPACING):
         cg.add_define("USE_NEXTION_COMMAND_SPACING")
         cg.add(var.set_command_spacing(command_spacing.total_milliseconds))
+        if batch_size := config.get(CONF_COMMAND_BATCH_SIZE):
+            cg.add(var.set_command_batch_size(batch_size))
 
     if CONF_BRIGHTNESS in config:
         cg.add(var.set_brightness(config[CONF_BRIGHTNESS]))
@@ -8,9 +8,12 @@ namespace esphome {
 namespace nextion {
 
 static const char *const TAG = "nextion";
+// Released queue entries kept for reuse, enough for the updates of a busy page
+static const size_t QUEUE_POOL_SIZE = 16;
 
 void Nextion::setup() {
   this->is_setup_ = false;
+  this->queue_pool_.reserve(QUEUE_POOL_SIZE);
   this->connection_state_.ignore_is_setup_ = true;
 
   // Wake up the nextion and ensure clean communication state
@@ -139,7 +142,11 @@ void Nextion::reset_(bool reset_nextion) {
   while (this->available()) {  // Clear receive buffer
     this->read_byte(&d);
   };
+  for (auto *entry : this->nextion_queue_)
+    this->release_queue_entry_(entry);
   this->nextion_queue_.clear();
+  for (auto *entry : this->waveform_queue_)
+    this->release_queue_entry_(entry);
   this->waveform_queue_.clear();
 }
 
@@ -183,7 +190,10 @@ void Nextion::dump_config() {
 #endif  // USE_NEXTION_CONF_START_UP_PAGE
 
 #ifdef USE_NEXTION_COMMAND_SPACING
-  ESP_LOGCONFIG(TAG, "  Cmd spacing:      %u ms", this->command_pacer_.get_spacing());
+  ESP_LOGCONFIG(TAG,
+                "  Cmd spacing:      %u ms\n"
+                "  Cmd batch size:   %u",
+                this->command_pacer_.get_spacing(), this->command_batch_size_);
 #endif  // USE_NEXTION_COMMAND_SPACING
 
 #ifdef USE_NEXTION_MAX_QUEUE_SIZE
@@ -353,16 +363,98 @@ void Nextion::process_pending_in_queue_() {
 
   // Check if first item in queue has a pending command
   auto *front_item = this->nextion_queue_.front();
-  if (front_item && !front_item->pending_command.empty()) {
-    if (this->send_command_(front_item->pending_command)) {
-      // Command sent successfully, clear the pending command
-      front_item->pending_command.clear();
-      ESP_LOGVV(TAG, "Pending command sent: %s", front_item->component->get_variable_name().c_str());
+  if (!front_item || front_item->pending_command.empty() ||
+      (!this->connection_state_.ignore_is_setup_ && !this->is_setup())) {
+    return;
+  }
+
+  // Send the pending commands at the front of the queue in a single write
+  std::string batch;
+  size_t count = 0;
+  for (auto *item : this->nextion_queue_) {
+    if (count == this->command_batch_size_ || item->pending_command.empty())
+      break;
+    batch += item->pending_command;
+    batch += COMMAND_DELIMITER;
+    count++;
+  }
+  ESP_LOGN(TAG, "cmd batch (%zu): %s", count, batch.c_str());
+  this->write_array(reinterpret_cast<const uint8_t *>(batch.data()), batch.size());
+
+  for (size_t i = 0; i < count; i++) {
+    // Command sent successfully, clear the pending command
+    this->nextion_queue_[i]->pending_command.clear();
+    ESP_LOGVV(TAG, "Pending command sent: %s", this->nextion_queue_[i]->component->get_variable_name().c_str());
+  }
+}
+
+bool Nextion::coalesce_pending_command_(const std::string &variable_name, const std::string &command) {
+  const size_t assignment = command.find('=');
+  if (assignment == std::string::npos || command.find(' ') < assignment)
+    return false;
+
+  for (auto it = this->nextion_queue_.rbegin(); it != this->nextion_queue_.rend(); ++it) {
+    NextionQueue *item = *it;
+    if (item->pending_command.empty())
+      continue;  // Already sent, waiting for its result
+
+    const size_t item_assignment = item->pending_command.find('=');
+    if (item_assignment == std::string::npos || item->pending_command.find(' ') < item_assignment)
+      return false;  // Not an assignment, don't move the new value in front of it
+
+    if (item_assignment == assignment && item->pending_command.compare(0, assignment, command, 0, assignment) == 0) {
+      item->pending_command = command;
+      item->component->set_variable_name(variable_name);
+      this->coalesced_commands_++;
+      ESP_LOGVV(TAG, "Pending command replaced: %s", command.c_str());
+      return true;
     }
   }
+  return false;
 }
 #endif  // USE_NEXTION_COMMAND_SPACING
 
+NextionQueue *Nextion::acquire_queue_entry_() {
+  if (!this->queue_pool_.empty()) {
+    NextionQueue *entry = this->queue_pool_.back();
+    this->queue_pool_.pop_back();
+    return entry;
+  }
+
+  RAMAllocator<nextion::NextionQueue> allocator;
+  nextion::NextionQueue *entry = allocator.allocate(1);
+  if (entry == nullptr) {
+    ESP_LOGW(TAG, "Queue alloc failed");
+    return nullptr;
+  }
+  new (entry) nextion::NextionQueue();
+  return entry;
+}
+
+void Nextion::release_queue_entry_(NextionQueue *entry) {
+  if (entry == nullptr)
+    return;
+  if (this->queue_pool_.size() >= QUEUE_POOL_SIZE) {
+    delete entry;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
+  }
+  entry->component = nullptr;
+  entry->queue_time = 0;
+  entry->pending_command.clear();  // Keeps the capacity for the next command
+  this->queue_pool_.push_back(entry);
+}
+
+void Nextion::record_queue_latency_(const NextionQueue *entry) {
+  const uint32_t latency = millis() - entry->queue_time;
+  // Moving average over about 8 answers, the first answer seeds it
+  if (this->max_queue_latency_ms_ == 0) {
+    this->queue_latency_ms_ = latency;
+  } else {
+    this->queue_latency_ms_ = (this->queue_latency_ms_ * 7 + latency) / 8;
+  }
+  this->max_queue_latency_ms_ = std::max(this->max_queue_latency_ms_, latency);
+}
+
 bool Nextion::remove_from_q_(bool report_empty) {
   if (this->nextion_queue_.empty()) {
     if (report_empty) {
@@ -374,6 +466,7 @@ bool Nextion::remove_from_q_(bool report_empty) {
   NextionQueue *nb = this->nextion_queue_.front();
   if (!nb || !nb->component) {
     ESP_LOGE(TAG, "Invalid queue");
+    this->release_queue_entry_(nb);
     this->nextion_queue_.pop_front();
     return false;
   }
@@ -387,7 +480,8 @@ bool Nextion::remove_from_q_(bool report_empty) {
     }
     delete component;  // NOLINT(cppcoreguidelines-owning-memory)
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+  this->record_queue_latency_(nb);
+  this->release_queue_entry_(nb);
   this->nextion_queue_.pop_front();
   return true;
 }
@@ -496,7 +590,7 @@ void Nextion::process_nextion_commands_() {
 
           ESP_LOGN(TAG, "Remove waveform ID %d/ch %d", component->get_component_id(), component->get_wave_channel_id());
 
-          delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+          this->release_queue_entry_(nb);
           this->waveform_queue_.pop_front();
         }
         break;
@@ -595,6 +689,7 @@ void Nextion::process_nextion_commands_() {
         NextionQueue *nb = this->nextion_queue_.front();
         if (!nb || !nb->component) {
           ESP_LOGE(TAG, "Invalid queue entry");
+          this->release_queue_entry_(nb);
           this->nextion_queue_.pop_front();
           return;
         }
@@ -607,7 +702,8 @@ void Nextion::process_nextion_commands_() {
                    component->get_queue_type_string().c_str());
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->record_queue_latency_(nb);
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -638,6 +734,7 @@ void Nextion::process_nextion_commands_() {
         NextionQueue *nb = this->nextion_queue_.front();
         if (!nb || !nb->component) {
           ESP_LOGE(TAG, "Invalid queue");
+          this->release_queue_entry_(nb);
           this->nextion_queue_.pop_front();
           return;
         }
@@ -654,7 +751,8 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->record_queue_latency_(nb);
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -828,7 +926,7 @@ void Nextion::process_nextion_commands_() {
                  component->get_wave_channel_id(), buffer_to_send);
 
         component->clear_wave_buffer(buffer_to_send);
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->waveform_queue_.pop_front();
         break;
       }
@@ -865,7 +963,7 @@ void Nextion::process_nextion_commands_() {
           delete component;  // NOLINT(cppcoreguidelines-owning-memory)
         }
 
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(this->nextion_queue_[i]);
 
         this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
         i--;
@@ -1035,13 +1133,9 @@ void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
-  if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_();
+  if (nextion_queue == nullptr)
     return;
-  }
-  new (nextion_queue) nextion::NextionQueue();
 
   // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
   nextion_queue->component = new nextion::NextionComponentBase;
@@ -1077,6 +1171,9 @@ void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_n
 #ifdef USE_NEXTION_COMMAND_SPACING
 void Nextion::add_no_result_to_queue_with_pending_command_(const std::string &variable_name,
                                                            const std::string &command) {
+  if (this->coalesce_pending_command_(variable_name, command))
+    return;
+
 #ifdef USE_NEXTION_MAX_QUEUE_SIZE
   if (this->max_queue_size_ > 0 && this->nextion_queue_.size() >= this->max_queue_size_) {
     ESP_LOGW(TAG, "Queue full (%zu), drop: %s", this->nextion_queue_.size(), variable_name.c_str());
@@ -1084,13 +1181,9 @@ void Nextion::add_no_result_to_queue_with_pending_command_(const std::string &va
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
-  if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_();
+  if (nextion_queue == nullptr)
     return;
-  }
-  new (nextion_queue) nextion::NextionQueue();
 
   nextion_queue->component = new nextion::NextionComponentBase;
   nextion_queue->component->set_variable_name(variable_name);
@@ -1224,13 +1317,9 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
-  if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_();
+  if (nextion_queue == nullptr)
     return;
-  }
-  new (nextion_queue) nextion::NextionQueue();
 
   nextion_queue->component = component;
   nextion_queue->queue_time = App.get_loop_component_start_time();
@@ -1241,6 +1330,8 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
 
   if (this->send_command_(command)) {
     this->nextion_queue_.push_back(nextion_queue);
+  } else {
+    this->release_queue_entry_(nextion_queue);
   }
 }
 
@@ -1256,13 +1347,9 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || this->is_sleeping())
     return;
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
-  if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_();
+  if (nextion_queue == nullptr)
     return;
-  }
-  new (nextion_queue) nextion::NextionQueue();
 
   nextion_queue->component = component;
   nextion_queue->queue_time = App.get_loop_component_start_time();
@@ -1284,7 +1371,7 @@ void Nextion::check_pending_waveform_() {
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
   if (!this->send_command_(command)) {
-    delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->release_queue_entry_(nb);
     this->waveform_queue_.pop_front();
   }
 }
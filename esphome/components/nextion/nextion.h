@@ -111,6 +111,18 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    * @param spacing_ms Time in milliseconds between commands
    */
   void set_command_spacing(uint32_t spacing_ms) { this->command_pacer_.set_spacing(spacing_ms); }
+
+  /**
+   * @brief Set how many commands delayed by command spacing are sent together in one UART write
+   * @param batch_size Maximum number of commands per write (default: 1)
+   */
+  void set_command_batch_size(uint8_t batch_size) { this->command_batch_size_ = batch_size; }
+
+  /**
+   * @brief Get the number of delayed commands replaced by a newer value before they were sent
+   * @return Count of coalesced commands since boot
+   */
+  uint32_t get_coalesced_commands() const { return this->coalesced_commands_; }
 #endif  // USE_NEXTION_COMMAND_SPACING
 
   /**
@@ -1257,6 +1269,23 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    */
   size_t queue_size() { return this->nextion_queue_.size(); }
 
+  /**
+   * @brief Get the time the Nextion takes to answer queued commands.
+   *
+   * The latency is measured from queueing a command to receiving its result and averaged over the last
+   * few answers. A rising latency shows the display falls behind the commands sent to it.
+   *
+   * @return uint32_t The moving average latency in milliseconds.
+   */
+  uint32_t get_queue_latency() const { return this->queue_latency_ms_; }
+
+  /**
+   * @brief Get the longest time the Nextion took to answer a queued command since boot.
+   *
+   * @return uint32_t The maximum latency in milliseconds.
+   */
+  uint32_t get_max_queue_latency() const { return this->max_queue_latency_ms_; }
+
   /**
    * @brief Check if the TFT update process is currently running.
    *
@@ -1306,6 +1335,8 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
 #ifdef USE_NEXTION_COMMAND_SPACING
   NextionCommandPacer command_pacer_{0};
+  uint8_t command_batch_size_{1};
+  uint32_t coalesced_commands_{0};
 
   /**
    * @brief Process any commands in the queue that are pending due to command spacing
@@ -1322,6 +1353,25 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
   std::deque<NextionQueue *> nextion_queue_;
   std::deque<NextionQueue *> waveform_queue_;
+  /// Released queue entries kept for reuse, so steady updates don't allocate
+  std::vector<NextionQueue *> queue_pool_;
+  uint32_t queue_latency_ms_{0};
+  uint32_t max_queue_latency_ms_{0};
+  /**
+   * @brief Get a cleared queue entry, from the pool if one is available
+   * @return The entry, nullptr if the allocation failed
+   */
+  NextionQueue *acquire_queue_entry_();
+  /**
+   * @brief Return a queue entry to the pool, it is freed when the pool is full
+   * @param entry The entry, no longer referenced by any queue
+   */
+  void release_queue_entry_(NextionQueue *entry);
+  /**
+   * @brief Update the queue latency with an entry the Nextion has answered
+   * @param entry The answered entry
+   */
+  void record_queue_latency_(const NextionQueue *entry);
   uint16_t recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag);
   void all_components_send_state_(bool force_update = false);
   uint32_t comok_sent_ = 0;
@@ -1377,6 +1427,19 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    * @param command The actual command string to be sent when spacing allows
    */
   void add_no_result_to_queue_with_pending_command_(const std::string &variable_name, const std::string &command);
+
+  /**
+   * @brief Replace a delayed assignment to the same attribute with a newer command
+   *
+   * Only the latest value of an attribute matters, so an assignment like `t0.txt="a"` still waiting for command
+   * spacing is overwritten by `t0.txt="b"` instead of queueing both. The search stops at a delayed command which is
+   * not an assignment, so the order relative to commands like `page` is kept.
+   *
+   * @param variable_name Name of the variable or component associated with the command
+   * @param command The new command
+   * @return true if a delayed command was replaced
+   */
+  bool coalesce_pending_command_(const std::string &variable_name, const std::string &command);
 #endif  // USE_NEXTION_COMMAND_SPACING
 
   bool add_no_result_to_queue_with_printf_(const std::string &variable_name, const char *format, ...)
@@ -23,7 +23,7 @@ class NextionComponentBase;
 class NextionQueue {
  public:
   virtual ~NextionQueue() = default;
-  NextionComponentBase *component;
+  NextionComponentBase *component{nullptr};
   uint32_t queue_time = 0;
 
   // Store command for retry if spacing blocked it
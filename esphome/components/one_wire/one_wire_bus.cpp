@@ -60,6 +60,14 @@ void OneWireBus::skip() {
   this->write8(0xCC);  // skip ROM
 }
 
+bool OneWireBus::broadcast(uint8_t cmd) {
+  if (!this->reset_())
+    return false;
+  this->skip();
+  this->write8(cmd);
+  return true;
+}
+
 const LogString *OneWireBus::get_model_str(uint8_t model) {
   switch (model) {
     case DALLAS_MODEL_DS18S20:
@@ -18,6 +18,13 @@ class OneWireBus {
   /// Write a command to the bus that addresses all devices by skipping the ROM.
   void skip();
 
+  /** Send a command to all devices on the bus at once.
+   *
+   * @param cmd Command to send after the bus reset and Skip ROM.
+   * @return Whether the bus reset was successful.
+   */
+  bool broadcast(uint8_t cmd);
+
   /// Read an 8 bit word from the bus.
   virtual uint8_t read8() = 0;
 
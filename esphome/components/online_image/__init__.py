@@ -33,6 +33,7 @@ DEPENDENCIES = ["display", "http_request"]
 CODEOWNERS = ["@guillempages", "@clydebarrow"]
 MULTI_CONF = True
 
+CONF_DECODE_TIME_SLICE = "decode_time_slice"
 CONF_ON_DOWNLOAD_FINISHED = "on_download_finished"
 CONF_PLACEHOLDER = "placeholder"
 CONF_UPDATE = "update"
@@ -134,6 +135,7 @@ ONLINE_IMAGE_SCHEMA = (
             cv.Required(CONF_FORMAT): cv.one_of(*IMAGE_FORMATS, upper=True),
             cv.Optional(CONF_PLACEHOLDER): cv.use_id(Image_),
             cv.Optional(CONF_BUFFER_SIZE, default=65536): cv.int_range(256, 65536),
+            cv.Optional(CONF_DECODE_TIME_SLICE): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_ON_DOWNLOAD_FINISHED): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -227,6 +229,9 @@ async def to_code(config):
         else:
             cg.add(var.add_request_header(key, value))
 
+    if CONF_DECODE_TIME_SLICE in config:
+        cg.add(var.set_decode_time_slice(config[CONF_DECODE_TIME_SLICE]))
+
     if placeholder_id := config.get(CONF_PLACEHOLDER):
         placeholder = await cg.get_variable(placeholder_id)
         cg.add(var.set_placeholder(placeholder))
@@ -25,6 +25,22 @@ void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   }
 }
 
+bool ImageDecoder::can_copy_rgb565() const {
+  return this->image_->get_type() == image::IMAGE_TYPE_RGB565 && !this->image_->has_transparency() &&
+         this->x_scale_ == 1.0 && this->y_scale_ == 1.0;
+}
+
+void ImageDecoder::copy_rgb565(int x, int y, int w, int h, const uint16_t *pixels, int stride) {
+  if (this->image_->buffer_ == nullptr || x < 0 || y < 0)
+    return;
+  w = std::min(w, this->image_->buffer_width_ - x);
+  h = std::min(h, this->image_->buffer_height_ - y);
+  for (int row = 0; row < h; row++) {
+    memcpy(this->image_->buffer_ + this->image_->get_position_(x, y + row), pixels + row * stride,
+           w * sizeof(uint16_t));
+  }
+}
+
 DownloadBuffer::DownloadBuffer(size_t size) : size_(size) {
   this->buffer_ = this->allocator_.allocate(size);
   this->reset();
@@ -49,6 +49,11 @@ class ImageDecoder {
    */
   virtual int decode(uint8_t *buffer, size_t size) = 0;
 
+  /**
+   * @brief Whether decode() needs the whole image in the buffer at once, so it can not be fed in slices.
+   */
+  virtual bool needs_full_download() const { return false; }
+
   /**
    * @brief Request the image to be resized once the actual dimensions are known.
    * Called by the callback functions, to be able to access the parent Image class.
@@ -73,6 +78,25 @@ class ImageDecoder {
    */
   void draw(int x, int y, int w, int h, const Color &color);
 
+  /**
+   * @brief Whether decoded pixels can be copied with copy_rgb565(): the image is an opaque RGB565 image, and
+   * is not scaled.
+   */
+  bool can_copy_rgb565() const;
+
+  /**
+   * @brief Copy a block of pixels that are already in the RGB565 format and byte order of the image.
+   * The block is clipped to the image.
+   *
+   * @param x The left-most coordinate of the block.
+   * @param y The top-most coordinate of the block.
+   * @param w The width of the block.
+   * @param h The height of the block.
+   * @param pixels The pixels of the block, row by row.
+   * @param stride The number of pixels from the start of one row to the next.
+   */
+  void copy_rgb565(int x, int y, int w, int h, const uint16_t *pixels, int stride);
+
   bool is_finished() const { return this->decoded_bytes_ == this->download_size_; }
 
  protected:
@@ -110,7 +134,7 @@ class DownloadBuffer {
   size_t resize(size_t size);
 
  protected:
-  RAMAllocator<uint8_t> allocator_{};
+  RAMAllocator<uint8_t> allocator_{RAMSubsystem::IMAGE};
   uint8_t *buffer_;
   size_t size_;
   /** Total number of downloaded bytes not yet read. */
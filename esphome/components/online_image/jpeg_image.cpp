@@ -24,6 +24,11 @@ static int draw_callback(JPEGDRAW *jpeg) {
   // Some very big images take too long to decode, so feed the watchdog on each callback
   // to avoid crashing.
   App.feed_wdt();
+  if (decoder != nullptr && decoder->can_copy_rgb565()) {
+    // The pixel type was set to the RGB565 format of the image
+    decoder->copy_rgb565(jpeg->x, jpeg->y, jpeg->iWidth, jpeg->iHeight, jpeg->pPixels, jpeg->iWidth);
+    return 1;
+  }
   size_t position = 0;
   size_t height = static_cast<size_t>(jpeg->iHeight);
   size_t width = static_cast<size_t>(jpeg->iWidth);
@@ -78,6 +83,10 @@ int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
   if (!this->set_size(this->jpeg_.getWidth(), this->jpeg_.getHeight())) {
     return DECODE_ERROR_OUT_OF_MEMORY;
   }
+  if (this->can_copy_rgb565()) {
+    // The decoder writes the pixels in the format of the buffer, no conversion per pixel
+    this->jpeg_.setPixelType(this->image_->is_big_endian() ? RGB565_BIG_ENDIAN : RGB565_LITTLE_ENDIAN);
+  }
   if (!this->jpeg_.decode(0, 0, 0)) {
     ESP_LOGE(TAG, "Error while decoding.");
     this->jpeg_.close();
@@ -23,6 +23,7 @@ class JpegDecoder : public ImageDecoder {
 
   int prepare(size_t download_size) override;
   int HOT decode(uint8_t *buffer, size_t size) override;
+  bool needs_full_download() const override { return true; }
 
  protected:
   JPEGDEC jpeg_{};
@@ -7,6 +7,8 @@ static const char *const ETAG_HEADER_NAME = "etag";
 static const char *const IF_NONE_MATCH_HEADER_NAME = "if-none-match";
 static const char *const LAST_MODIFIED_HEADER_NAME = "last-modified";
 static const char *const IF_MODIFIED_SINCE_HEADER_NAME = "if-modified-since";
+// Bytes read and fed to a streaming decoder at once when decoding in time slices
+static const size_t DECODE_SLICE_SIZE = 1024;
 
 #include "image_decoder.h"
 
@@ -211,6 +213,7 @@ void OnlineImage::update() {
   }
   ESP_LOGI(TAG, "Downloading image (Size: %zu)", total_size);
   this->start_time_ = ::time(nullptr);
+  this->decode_time_us_ = 0;
 }
 
 void OnlineImage::loop() {
@@ -225,7 +228,8 @@ void OnlineImage::loop() {
     this->height_ = buffer_height_;
     ESP_LOGD(TAG, "Image fully downloaded, read %zu bytes, width/height = %d/%d", this->downloader_->get_bytes_read(),
              this->width_, this->height_);
-    ESP_LOGD(TAG, "Total time: %" PRIu32 "s", (uint32_t) (::time(nullptr) - this->start_time_));
+    ESP_LOGD(TAG, "Total time: %" PRIu32 "s, decoding took %" PRIu32 "ms",
+             (uint32_t) (::time(nullptr) - this->start_time_), this->get_last_decode_time());
     this->etag_ = this->downloader_->get_response_header(ETAG_HEADER_NAME);
     this->last_modified_ = this->downloader_->get_response_header(LAST_MODIFIED_HEADER_NAME);
     this->download_finished_callback_.call(false);
@@ -236,25 +240,56 @@ void OnlineImage::loop() {
     ESP_LOGE(TAG, "Downloader not instantiated; cannot download");
     return;
   }
-  size_t available = this->download_buffer_.free_capacity();
-  if (available) {
-    // Some decoders need to fully download the image before downloading.
-    // In case of huge images, don't wait blocking until the whole image has been downloaded,
-    // use smaller chunks
-    available = std::min(available, this->download_buffer_initial_size_);
-    auto len = this->downloader_->read(this->download_buffer_.append(), available);
-    if (len > 0) {
-      this->download_buffer_.write(len);
-      auto fed = this->decoder_->decode(this->download_buffer_.data(), this->download_buffer_.unread());
-      if (fed < 0) {
-        ESP_LOGE(TAG, "Error when decoding image.");
-        this->end_connection_();
-        this->download_error_callback_.call();
-        return;
+  if (this->decode_time_slice_ == 0 || this->decoder_->needs_full_download()) {
+    size_t available = this->download_buffer_.free_capacity();
+    if (available) {
+      // Some decoders need to fully download the image before downloading.
+      // In case of huge images, don't wait blocking until the whole image has been downloaded,
+      // use smaller chunks
+      available = std::min(available, this->download_buffer_initial_size_);
+      auto len = this->downloader_->read(this->download_buffer_.append(), available);
+      if (len > 0) {
+        this->download_buffer_.write(len);
+        this->decode_(this->download_buffer_.unread());
       }
-      this->download_buffer_.read(fed);
     }
+    return;
+  }
+
+  // Streaming decoders get the body in slices, until the time for this loop is up
+  const uint32_t start = millis();
+  do {
+    int len = 0;
+    size_t available = std::min(this->download_buffer_.free_capacity(), DECODE_SLICE_SIZE);
+    if (available != 0) {
+      len = this->downloader_->read(this->download_buffer_.append(), available);
+      if (len > 0)
+        this->download_buffer_.write(len);
+    }
+    size_t unread = this->download_buffer_.unread();
+    if (unread == 0)
+      return;
+    size_t before = unread;
+    if (!this->decode_(std::min(unread, DECODE_SLICE_SIZE)))
+      return;
+    // nothing new to read and the decoder waits for more
+    if (len <= 0 && this->download_buffer_.unread() == before)
+      return;
+  } while (!this->decoder_->is_finished() && millis() - start < this->decode_time_slice_);
+}
+
+bool OnlineImage::decode_(size_t size) {
+  const uint32_t start = micros();
+  auto fed = this->decoder_->decode(this->download_buffer_.data(), size);
+  this->decode_time_us_ += micros() - start;
+  if (fed < 0) {
+    ESP_LOGE(TAG, "Error when decoding image.");
+    this->end_connection_();
+    this->download_error_callback_.call();
+    return false;
   }
+  this->download_buffer_.read(fed);
+  return true;
 }
 
 void OnlineImage::map_chroma_key(Color &color) {
@@ -93,13 +93,26 @@ class OnlineImage : public PollingComponent,
    */
   size_t resize_download_buffer(size_t size) { return this->download_buffer_.resize(size); }
 
+  /**
+   * Limit the time spent decoding per loop() call. The body is then fed to streaming decoders (PNG, BMP) in
+   * slices, that are decoded as long as the time allows, instead of one download buffer per loop() call.
+   * 0 keeps decoding one download buffer per loop() call.
+   */
+  void set_decode_time_slice(uint32_t decode_time_slice) { this->decode_time_slice_ = decode_time_slice; }
+
+  /** Time in milliseconds spent in the decoder for the last downloaded image. */
+  uint32_t get_last_decode_time() const { return this->decode_time_us_ / 1000; }
+
+  /** Whether 16 bit colors are stored with the high byte first. */
+  bool is_big_endian() const { return this->is_big_endian_; }
+
   void add_on_finished_callback(std::function<void(bool)> &&callback);
   void add_on_error_callback(std::function<void()> &&callback);
 
  protected:
   bool validate_url_(const std::string &url);
 
-  RAMAllocator<uint8_t> allocator_{};
+  RAMAllocator<uint8_t> allocator_{RAMSubsystem::IMAGE};
 
   uint32_t get_buffer_size_() const { return get_buffer_size_(this->buffer_width_, this->buffer_height_); }
   int get_buffer_size_(int width, int height) const { return (this->get_bpp() * width + 7u) / 8u * height; }
@@ -138,6 +151,9 @@ class OnlineImage : public PollingComponent,
 
   void end_connection_();
 
+  /// Feed the unread downloaded data to the decoder, false when decoding failed.
+  bool decode_(size_t size);
+
   CallbackManager<void(bool)> download_finished_callback_{};
   CallbackManager<void()> download_error_callback_{};
 
@@ -198,8 +214,12 @@ class OnlineImage : public PollingComponent,
 
   time_t start_time_;
 
+  uint32_t decode_time_slice_{0};
+  uint32_t decode_time_us_{0};
+
   friend bool ImageDecoder::set_size(int width, int height);
   friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
+  friend void ImageDecoder::copy_rgb565(int x, int y, int w, int h, const uint16_t *pixels, int stride);
 };
 
 template<typename... Ts> class OnlineImageSetUrlAction : public Action<Ts...> {
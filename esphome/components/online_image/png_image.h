@@ -26,7 +26,7 @@ class PngDecoder : public ImageDecoder {
   int HOT decode(uint8_t *buffer, size_t size) override;
 
  protected:
-  RAMAllocator<pngle_t> allocator_;
+  RAMAllocator<pngle_t> allocator_{RAMSubsystem::IMAGE};
   pngle_t *pngle_;
 };
 
@@ -13,12 +13,14 @@ import esphome.final_validate as fv
 from .const import (
     CONF_DEVICE_TYPE,
     CONF_EXT_PAN_ID,
+    CONF_FAST_POLL_PERIOD,
     CONF_FORCE_DATASET,
     CONF_MDNS_ID,
     CONF_MESH_LOCAL_PREFIX,
     CONF_NETWORK_KEY,
     CONF_NETWORK_NAME,
     CONF_PAN_ID,
+    CONF_POLL_PERIOD,
     CONF_PSKC,
     CONF_SRP_ID,
     CONF_TLV,
@@ -86,7 +88,6 @@ def set_sdkconfig_options(config):
     add_idf_sdkconfig_option("CONFIG_OPENTHREAD_SRP_CLIENT", True)
     add_idf_sdkconfig_option("CONFIG_OPENTHREAD_SRP_CLIENT_MAX_SERVICES", 5)
 
-    # TODO: Add suport for sleepy end devices
     add_idf_sdkconfig_option(f"CONFIG_OPENTHREAD_{config.get(CONF_DEVICE_TYPE)}", True)
 
 
@@ -106,6 +107,18 @@ _CONNECTION_SCHEMA = cv.Schema(
     }
 )
 
+def _validate_sleepy(config):
+    if CONF_POLL_PERIOD in config:
+        if config[CONF_DEVICE_TYPE] != "MTD":
+            raise cv.Invalid(
+                f"{CONF_POLL_PERIOD} makes a sleepy end device, which requires "
+                f"{CONF_DEVICE_TYPE}: MTD"
+            )
+    elif CONF_FAST_POLL_PERIOD in config:
+        raise cv.Invalid(f"{CONF_FAST_POLL_PERIOD} requires {CONF_POLL_PERIOD}")
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -117,9 +130,24 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_FORCE_DATASET): cv.boolean,
             cv.Optional(CONF_TLV): cv.string_strict,
+            # The parent holds replies until the next poll. Polling at least once per API
+            # keepalive interval keeps API clients from timing out on a sleepy end device.
+            cv.Optional(CONF_POLL_PERIOD): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(
+                    min=cv.TimePeriod(milliseconds=10), max=cv.TimePeriod(seconds=60)
+                ),
+            ),
+            cv.Optional(CONF_FAST_POLL_PERIOD): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(
+                    min=cv.TimePeriod(milliseconds=10), max=cv.TimePeriod(seconds=5)
+                ),
+            ),
         }
     ).extend(_CONNECTION_SCHEMA),
     cv.has_exactly_one_key(CONF_NETWORK_KEY, CONF_TLV),
+    _validate_sleepy,
     cv.only_with_esp_idf,
     only_on_variant(supported=[VARIANT_ESP32C6, VARIANT_ESP32H2]),
 )
@@ -146,6 +174,14 @@ async def to_code(config):
 
     ot = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(ot, config)
+    if CONF_POLL_PERIOD in config:
+        cg.add_define("USE_OPENTHREAD_SED")
+        poll_period = config[CONF_POLL_PERIOD].total_milliseconds
+        cg.add(ot.set_poll_period(poll_period))
+        fast_poll_period = 100
+        if CONF_FAST_POLL_PERIOD in config:
+            fast_poll_period = config[CONF_FAST_POLL_PERIOD].total_milliseconds
+        cg.add(ot.set_fast_poll_period(min(fast_poll_period, poll_period)))
 
     srp = cg.new_Pvariable(config[CONF_SRP_ID])
     mdns_component = await cg.get_variable(config[CONF_MDNS_ID])
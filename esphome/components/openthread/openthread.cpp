@@ -9,6 +9,7 @@
 
 #include <openthread/cli.h>
 #include <openthread/instance.h>
+#include <openthread/link.h>
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
 #include <openthread/tasklet.h>
@@ -75,6 +76,41 @@ std::optional<otIp6Address> OpenThreadComponent::get_omr_address_(InstanceLock &
   return {};
 }
 
+#ifdef USE_OPENTHREAD_SED
+// How long a request_fast_poll() keeps the fast poll period, long enough for a request and its reply
+static const uint32_t FAST_POLL_WINDOW_MS = 2000;
+#endif
+
+void OpenThreadComponent::request_fast_poll() {
+#ifdef USE_OPENTHREAD_SED
+  this->fast_poll_until_ = millis() + FAST_POLL_WINDOW_MS;
+  if (!this->fast_polling_)
+    this->enable_loop();
+#endif
+}
+
+#ifdef USE_OPENTHREAD_SED
+void OpenThreadComponent::loop() {
+  bool fast = static_cast<int32_t>(this->fast_poll_until_ - millis()) > 0;
+  if (fast == this->fast_polling_) {
+    if (!fast)
+      this->disable_loop();
+    return;
+  }
+  // Don't hold up the main loop, retry on the next one when the stack is busy
+  auto lock = InstanceLock::try_acquire(0);
+  if (!lock)
+    return;
+  otInstance *instance = lock->get_instance();
+  if (instance == nullptr)
+    return;
+  if (otLinkSetPollPeriod(instance, fast ? this->fast_poll_period_ : this->poll_period_) != OT_ERROR_NONE) {
+    ESP_LOGW(TAG, "Failed to set poll period");
+  }
+  this->fast_polling_ = fast;
+}
+#endif
+
 void OpenThreadComponent::defer_factory_reset_external_callback() {
   ESP_LOGD(TAG, "Defer factory_reset_external_callback_");
   this->defer([this]() { this->factory_reset_external_callback_(); });
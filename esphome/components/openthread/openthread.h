@@ -23,6 +23,9 @@ class OpenThreadComponent : public Component {
   OpenThreadComponent();
   ~OpenThreadComponent();
   void setup() override;
+#ifdef USE_OPENTHREAD_SED
+  void loop() override;
+#endif
   bool teardown() override;
   float get_setup_priority() const override { return setup_priority::WIFI; }
 
@@ -32,12 +35,25 @@ class OpenThreadComponent : public Component {
   void ot_main();
   void on_factory_reset(std::function<void()> callback);
   void defer_factory_reset_external_callback();
+  /// Polls the parent at the fast poll period for a while, a sleepy end device won't see a reply before its next
+  /// poll otherwise. Must be called from the main loop, does nothing unless the node is a sleepy end device.
+  void request_fast_poll();
+#ifdef USE_OPENTHREAD_SED
+  void set_poll_period(uint32_t poll_period) { this->poll_period_ = poll_period; }
+  void set_fast_poll_period(uint32_t fast_poll_period) { this->fast_poll_period_ = fast_poll_period; }
+#endif
 
  protected:
   std::optional<otIp6Address> get_omr_address_(InstanceLock &lock);
   bool teardown_started_{false};
   bool teardown_complete_{false};
   std::function<void()> factory_reset_external_callback_;
+#ifdef USE_OPENTHREAD_SED
+  uint32_t poll_period_{0};
+  uint32_t fast_poll_period_{0};
+  uint32_t fast_poll_until_{0};
+  bool fast_polling_{false};
+#endif
 };
 
 extern OpenThreadComponent *global_openthread_component;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -1,6 +1,8 @@
 #include "esphome/core/defines.h"
 #if defined(USE_OPENTHREAD) && defined(USE_ESP_IDF)
+#include <openthread/link.h>
 #include <openthread/logging.h>
+#include <openthread/thread.h>
 #include "openthread.h"
 
 #include "esp_log.h"
@@ -137,6 +139,19 @@ void OpenThreadComponent::ot_main() {
   }
 #endif
 
+#ifdef USE_OPENTHREAD_SED
+  // Sleepy end device, the radio is off between polls and the parent buffers frames addressed to it
+  otLinkModeConfig link_mode = {};
+  link_mode.mRxOnWhenIdle = false;
+  link_mode.mDeviceType = false;
+  link_mode.mNetworkData = false;
+  otInstance *instance = esp_openthread_get_instance();
+  if (otThreadSetLinkMode(instance, link_mode) != OT_ERROR_NONE ||
+      otLinkSetPollPeriod(instance, this->poll_period_) != OT_ERROR_NONE) {
+    ESP_LOGW(TAG, "Failed to configure sleepy end device");
+  }
+#endif
+
   // Pass the existing dataset, or NULL which will use the preprocessor definitions
   ESP_ERROR_CHECK(esp_openthread_auto_start(dataset.mLength > 0 ? &dataset : nullptr));
 
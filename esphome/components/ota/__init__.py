@@ -129,6 +129,7 @@ FILTER_SOURCE_FILES = filter_source_files_from_platform(
     {
         "ota_backend_arduino_esp32.cpp": {PlatformFramework.ESP32_ARDUINO},
         "ota_backend_esp_idf.cpp": {PlatformFramework.ESP32_IDF},
+        "ota_delta.cpp": {PlatformFramework.ESP32_IDF, PlatformFramework.ESP32_ARDUINO},
         "ota_backend_arduino_esp8266.cpp": {PlatformFramework.ESP8266_ARDUINO},
         "ota_backend_arduino_rp2040.cpp": {PlatformFramework.RP2040_ARDUINO},
         "ota_backend_arduino_libretiny.cpp": {
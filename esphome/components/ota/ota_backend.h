@@ -24,6 +24,7 @@ enum OTAResponseTypes {
   OTA_RESPONSE_UPDATE_END_OK = 0x45,
   OTA_RESPONSE_SUPPORTS_COMPRESSION = 0x46,
   OTA_RESPONSE_CHUNK_OK = 0x47,
+  OTA_RESPONSE_SUPPORTS_DELTA = 0x48,
 
   OTA_RESPONSE_ERROR_MAGIC = 0x80,
   OTA_RESPONSE_ERROR_UPDATE_PREPARE = 0x81,
@@ -38,6 +39,7 @@ enum OTAResponseTypes {
   OTA_RESPONSE_ERROR_NO_UPDATE_PARTITION = 0x8A,
   OTA_RESPONSE_ERROR_MD5_MISMATCH = 0x8B,
   OTA_RESPONSE_ERROR_RP2040_NOT_ENOUGH_SPACE = 0x8C,
+  OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH = 0x8D,
   OTA_RESPONSE_ERROR_UNKNOWN = 0xFF,
 };
 
@@ -2,15 +2,28 @@
 #include "ota_backend_esp_idf.h"
 
 #include "esphome/components/md5/md5.h"
+#include "esphome/core/application.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/log.h"
 
 #include <esp_ota_ops.h>
 #include <esp_task_wdt.h>
 #include <spi_flash_mmap.h>
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
 namespace esphome {
 namespace ota {
 
+static const char *const TAG = "ota.idf";
+
+static const uint32_t WRITER_TASK_STACK_SIZE = 4096;
+// Above the main loop so a filled buffer goes to flash as soon as it is handed over
+static const UBaseType_t WRITER_TASK_PRIORITY = 5;
+static const uint32_t WRITER_WAIT_MS = 1000;
+
 std::unique_ptr<ota::OTABackend> make_ota_backend() { return make_unique<ota::IDFOTABackend>(); }
 
 OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
@@ -34,6 +47,12 @@ OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
   esp_task_wdt_reconfigure(&wdtc);
 #endif
 
+#ifdef OTA_WITH_SEQUENTIAL_WRITES
+  // Uploads of unknown size would erase the whole partition before the first byte is accepted. Erase each sector
+  // when the writer task reaches it instead, overlapped with receiving the rest of the image.
+  if (image_size == 0)
+    image_size = OTA_WITH_SEQUENTIAL_WRITES;
+#endif
   esp_err_t err = esp_ota_begin(this->partition_, image_size, &this->update_handle_);
 
 #if CONFIG_ESP_TASK_WDT_TIMEOUT_S < 15
@@ -53,6 +72,8 @@ OTAResponseTypes IDFOTABackend::begin(size_t image_size) {
     return OTA_RESPONSE_ERROR_UNKNOWN;
   }
   this->md5_.init();
+  if (!this->start_writer_())
+    ESP_LOGW(TAG, "Background writer unavailable, writing synchronously");
   return OTA_RESPONSE_OK;
 }
 
@@ -62,6 +83,22 @@ void IDFOTABackend::set_update_md5(const char *expected_md5) {
 }
 
 OTAResponseTypes IDFOTABackend::write(uint8_t *data, size_t len) {
+  if (this->writer_task_ == nullptr)
+    return this->write_flash_(data, len);
+
+  while (len > 0) {
+    size_t chunk = std::min(len, OTA_WRITER_BUFFER_SIZE - this->fill_len_);
+    memcpy(this->buffer_.get() + this->fill_index_ * OTA_WRITER_BUFFER_SIZE + this->fill_len_, data, chunk);
+    this->fill_len_ += chunk;
+    data += chunk;
+    len -= chunk;
+    if (this->fill_len_ == OTA_WRITER_BUFFER_SIZE)
+      this->submit_buffer_();
+  }
+  return this->writer_error_;
+}
+
+OTAResponseTypes IDFOTABackend::write_flash_(uint8_t *data, size_t len) {
   esp_err_t err = esp_ota_write(this->update_handle_, data, len);
   this->md5_.add(data, len);
   if (err != ESP_OK) {
@@ -76,6 +113,14 @@ OTAResponseTypes IDFOTABackend::write(uint8_t *data, size_t len) {
 }
 
 OTAResponseTypes IDFOTABackend::end() {
+  if (this->writer_task_ != nullptr) {
+    this->stop_writer_(true);
+    OTAResponseTypes error = this->writer_error_;
+    if (error != OTA_RESPONSE_OK) {
+      this->abort();
+      return error;
+    }
+  }
   if (this->md5_set_) {
     this->md5_.calculate();
     if (!this->md5_.equals_hex(this->expected_bin_md5_)) {
@@ -101,10 +146,90 @@ OTAResponseTypes IDFOTABackend::end() {
 }
 
 void IDFOTABackend::abort() {
+  this->stop_writer_(false);
   esp_ota_abort(this->update_handle_);
   this->update_handle_ = 0;
 }
 
+void IDFOTABackend::writer_task(void *params) {
+  auto *backend = static_cast<IDFOTABackend *>(params);
+  WriterChunk chunk;
+  while (xQueueReceive(backend->filled_queue_, &chunk, portMAX_DELAY) == pdTRUE && chunk.len != 0) {
+    // After an error the remaining buffers are only handed back, the receiver sees the error on its next write()
+    if (backend->writer_error_ == OTA_RESPONSE_OK) {
+      backend->writer_error_ =
+          backend->write_flash_(backend->buffer_.get() + chunk.index * OTA_WRITER_BUFFER_SIZE, chunk.len);
+    }
+    xQueueSend(backend->free_queue_, &chunk.index, portMAX_DELAY);
+  }
+  xSemaphoreGive(backend->writer_done_);
+  vTaskDelete(nullptr);
+}
+
+bool IDFOTABackend::start_writer_() {
+  this->buffer_.reset(new (std::nothrow) uint8_t[2 * OTA_WRITER_BUFFER_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->filled_queue_ = xQueueCreate(2, sizeof(WriterChunk));
+  this->free_queue_ = xQueueCreate(2, sizeof(uint8_t));
+  this->writer_done_ = xSemaphoreCreateBinary();
+  if (!this->buffer_ || this->filled_queue_ == nullptr || this->free_queue_ == nullptr ||
+      this->writer_done_ == nullptr) {
+    this->release_writer_();
+    return false;
+  }
+  // The receiver fills buffer 0 first, buffer 1 is free
+  uint8_t free_index = 1;
+  xQueueSend(this->free_queue_, &free_index, 0);
+  this->fill_index_ = 0;
+  this->fill_len_ = 0;
+  this->writer_error_ = OTA_RESPONSE_OK;
+  if (xTaskCreate(writer_task, "ota_writer", WRITER_TASK_STACK_SIZE, (void *) this, WRITER_TASK_PRIORITY,
+                  &this->writer_task_) != pdPASS) {
+    this->writer_task_ = nullptr;
+    this->release_writer_();
+    return false;
+  }
+  return true;
+}
+
+void IDFOTABackend::submit_buffer_() {
+  WriterChunk chunk{this->fill_index_, this->fill_len_};
+  // Never blocks, with two buffers at most one other chunk is queued
+  xQueueSend(this->filled_queue_, &chunk, portMAX_DELAY);
+  this->fill_len_ = 0;
+  // Only waits while the task is still writing the other buffer
+  while (xQueueReceive(this->free_queue_, &this->fill_index_, pdMS_TO_TICKS(WRITER_WAIT_MS)) != pdTRUE)
+    App.feed_wdt();
+}
+
+void IDFOTABackend::stop_writer_(bool flush) {
+  if (this->writer_task_ == nullptr)
+    return;
+  if (flush && this->fill_len_ > 0) {
+    WriterChunk chunk{this->fill_index_, this->fill_len_};
+    xQueueSend(this->filled_queue_, &chunk, portMAX_DELAY);
+  }
+  this->fill_len_ = 0;
+  WriterChunk stop{0, 0};
+  xQueueSend(this->filled_queue_, &stop, portMAX_DELAY);
+  while (xSemaphoreTake(this->writer_done_, pdMS_TO_TICKS(WRITER_WAIT_MS)) != pdTRUE)
+    App.feed_wdt();
+  this->writer_task_ = nullptr;
+  this->release_writer_();
+}
+
+void IDFOTABackend::release_writer_() {
+  if (this->filled_queue_ != nullptr)
+    vQueueDelete(this->filled_queue_);
+  if (this->free_queue_ != nullptr)
+    vQueueDelete(this->free_queue_);
+  if (this->writer_done_ != nullptr)
+    vSemaphoreDelete(this->writer_done_);
+  this->filled_queue_ = nullptr;
+  this->free_queue_ = nullptr;
+  this->writer_done_ = nullptr;
+  this->buffer_.reset();
+}
+
 }  // namespace ota
 }  // namespace esphome
 #endif
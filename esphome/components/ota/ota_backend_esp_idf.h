@@ -6,12 +6,27 @@
 #include "esphome/core/defines.h"
 
 #include <esp_ota_ops.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
 
 namespace esphome {
 namespace ota {
 
+/// Size of each of the two buffers between the receiver and the flash writer task, one flash sector
+static const size_t OTA_WRITER_BUFFER_SIZE = 4096;
+
+/// Writes the image from a separate task: write() copies the data into one buffer while the task writes the other
+/// to flash and feeds the MD5, so receiving only waits for flash once both buffers are full. Errors from the task are
+/// returned by the next write() or end(). Falls back to writing synchronously if the buffers or the task cannot be
+/// created.
 class IDFOTABackend : public OTABackend {
  public:
+  ~IDFOTABackend() override { this->stop_writer_(false); }
   OTAResponseTypes begin(size_t image_size) override;
   void set_update_md5(const char *md5) override;
   OTAResponseTypes write(uint8_t *data, size_t len) override;
@@ -20,11 +35,33 @@ class IDFOTABackend : public OTABackend {
   bool supports_compression() override { return false; }
 
  private:
+  struct WriterChunk {
+    uint8_t index;
+    // 0 stops the task
+    size_t len;
+  };
+
+  static void writer_task(void *params);
+  OTAResponseTypes write_flash_(uint8_t *data, size_t len);
+  bool start_writer_();
+  void submit_buffer_();
+  void stop_writer_(bool flush);
+  void release_writer_();
+
   esp_ota_handle_t update_handle_{0};
   const esp_partition_t *partition_;
   md5::MD5Digest md5_{};
   char expected_bin_md5_[32];
   bool md5_set_{false};
+
+  std::unique_ptr<uint8_t[]> buffer_;
+  QueueHandle_t filled_queue_{nullptr};
+  QueueHandle_t free_queue_{nullptr};
+  SemaphoreHandle_t writer_done_{nullptr};
+  TaskHandle_t writer_task_{nullptr};
+  uint8_t fill_index_{0};
+  size_t fill_len_{0};
+  std::atomic<OTAResponseTypes> writer_error_{OTA_RESPONSE_OK};
 };
 
 }  // namespace ota
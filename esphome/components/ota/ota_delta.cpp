@@ -0,0 +1,152 @@
+#include "ota_delta.h"
+#ifdef USE_OTA_DELTA
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+
+#include <esp_ota_ops.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.delta";
+
+static const uint8_t DELTA_MAGIC[4] = {'E', 'D', 'L', 'T'};
+static const uint8_t COMMAND_COPY = 'C';
+static const uint8_t COMMAND_DATA = 'D';
+static const size_t COPY_CHUNK_SIZE = 256;
+
+static uint32_t read_u32(const uint8_t *buf) {
+  return uint32_t(buf[0]) | (uint32_t(buf[1]) << 8) | (uint32_t(buf[2]) << 16) | (uint32_t(buf[3]) << 24);
+}
+
+bool get_running_image_digest(uint8_t *digest) {
+  static uint8_t cached[OTA_DELTA_DIGEST_SIZE];
+  static bool known = false;
+  if (!known) {
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running == nullptr || esp_partition_get_sha256(running, cached) != ESP_OK)
+      return false;
+    known = true;
+  }
+  memcpy(digest, cached, OTA_DELTA_DIGEST_SIZE);
+  return true;
+}
+
+size_t OTADeltaDecoder::command_size_() const {
+  switch (this->buf_[0]) {
+    case COMMAND_COPY:
+      return 9;
+    case COMMAND_DATA:
+      return 5;
+    default:
+      return 1;
+  }
+}
+
+OTAResponseTypes OTADeltaDecoder::write(uint8_t *data, size_t len) {
+  while (len > 0) {
+    if (this->state_ == State::DATA) {
+      size_t chunk = std::min<size_t>(len, this->data_remaining_);
+      OTAResponseTypes error = this->backend_->write(data, chunk);
+      if (error != OTA_RESPONSE_OK)
+        return error;
+      this->written_ += chunk;
+      this->data_remaining_ -= chunk;
+      data += chunk;
+      len -= chunk;
+      if (this->data_remaining_ == 0)
+        this->state_ = State::COMMAND;
+      continue;
+    }
+
+    // The command byte alone tells how many argument bytes follow
+    size_t needed = this->state_ == State::HEADER ? sizeof(this->buf_) : 1;
+    if (this->state_ == State::COMMAND && this->buf_pos_ > 0)
+      needed = this->command_size_();
+    size_t chunk = std::min(len, needed - this->buf_pos_);
+    memcpy(this->buf_ + this->buf_pos_, data, chunk);
+    this->buf_pos_ += chunk;
+    data += chunk;
+    len -= chunk;
+    if (this->state_ == State::COMMAND)
+      needed = this->command_size_();
+    if (this->buf_pos_ < needed)
+      continue;
+
+    OTAResponseTypes error = this->state_ == State::HEADER ? this->check_header_() : this->run_command_();
+    this->buf_pos_ = 0;
+    if (error != OTA_RESPONSE_OK)
+      return error;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes OTADeltaDecoder::check_header_() {
+  if (memcmp(this->buf_, DELTA_MAGIC, sizeof(DELTA_MAGIC)) != 0) {
+    ESP_LOGW(TAG, "Invalid delta magic");
+    return OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH;
+  }
+  uint8_t running[OTA_DELTA_DIGEST_SIZE];
+  if (!get_running_image_digest(running) || memcmp(this->buf_ + 4, running, OTA_DELTA_DIGEST_SIZE) != 0) {
+    ESP_LOGW(TAG, "Delta was not made against the running firmware");
+    return OTA_RESPONSE_ERROR_DELTA_BASE_MISMATCH;
+  }
+  this->source_ = esp_ota_get_running_partition();
+  this->state_ = State::COMMAND;
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes OTADeltaDecoder::run_command_() {
+  switch (this->buf_[0]) {
+    case COMMAND_COPY:
+      return this->copy_(read_u32(this->buf_ + 1), read_u32(this->buf_ + 5));
+    case COMMAND_DATA:
+      this->data_remaining_ = read_u32(this->buf_ + 1);
+      if (this->data_remaining_ != 0)
+        this->state_ = State::DATA;
+      return OTA_RESPONSE_OK;
+    default:
+      ESP_LOGW(TAG, "Unknown delta command 0x%02X", this->buf_[0]);
+      return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+}
+
+OTAResponseTypes OTADeltaDecoder::copy_(uint32_t offset, uint32_t len) {
+  if (offset > this->source_->size || len > this->source_->size - offset) {
+    ESP_LOGW(TAG, "Delta copy outside the running partition");
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  uint8_t chunk[COPY_CHUNK_SIZE];
+  while (len > 0) {
+    size_t size = std::min<size_t>(len, sizeof(chunk));
+    if (esp_partition_read(this->source_, offset, chunk, size) != ESP_OK)
+      return OTA_RESPONSE_ERROR_WRITING_FLASH;
+    OTAResponseTypes error = this->backend_->write(chunk, size);
+    if (error != OTA_RESPONSE_OK)
+      return error;
+    this->written_ += size;
+    offset += size;
+    len -= size;
+    App.feed_wdt();
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes OTADeltaDecoder::finish(size_t image_size) {
+  if (this->state_ != State::COMMAND || this->buf_pos_ != 0) {
+    ESP_LOGW(TAG, "Delta ended in the middle of a command");
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  if (this->written_ != image_size) {
+    ESP_LOGW(TAG, "Delta built %zu bytes, expected %zu", this->written_, image_size);
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+}  // namespace ota
+}  // namespace esphome
+#endif
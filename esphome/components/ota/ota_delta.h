@@ -0,0 +1,55 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_OTA_DELTA
+#include "ota_backend.h"
+
+#include <esp_partition.h>
+
+namespace esphome {
+namespace ota {
+
+/// Size of the SHA256 digest that identifies the image a delta was made against
+static const size_t OTA_DELTA_DIGEST_SIZE = 32;
+
+/// SHA256 digest of the running app image, as appended to the image by the build. Reads the whole image once and
+/// caches the result.
+bool get_running_image_digest(uint8_t *digest);
+
+/// Rebuilds an image from a delta against the running app partition and passes it to the backend.
+///
+/// The delta starts with the magic "EDLT" and the digest of the image it was made against, followed by commands:
+/// 'C', u32 offset, u32 length copies bytes from the running partition, 'D', u32 length and the bytes themselves
+/// inserts new data. Integers are little endian. The only state kept besides a small copy buffer is the command
+/// being decoded, so data can be fed in chunks of any size.
+class OTADeltaDecoder {
+ public:
+  explicit OTADeltaDecoder(OTABackend *backend) : backend_(backend) {}
+
+  OTAResponseTypes write(uint8_t *data, size_t len);
+  /// Check that the delta ended after a complete command and built an image of image_size bytes.
+  OTAResponseTypes finish(size_t image_size);
+
+ protected:
+  enum class State : uint8_t {
+    HEADER,
+    COMMAND,
+    DATA,
+  };
+
+  OTAResponseTypes check_header_();
+  OTAResponseTypes run_command_();
+  OTAResponseTypes copy_(uint32_t offset, uint32_t len);
+  size_t command_size_() const;
+
+  OTABackend *backend_;
+  const esp_partition_t *source_{nullptr};
+  size_t written_{0};
+  uint32_t data_remaining_{0};
+  uint8_t buf_[4 + OTA_DELTA_DIGEST_SIZE];
+  uint8_t buf_pos_{0};
+  State state_{State::HEADER};
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
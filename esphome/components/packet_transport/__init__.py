@@ -31,6 +31,8 @@ IS_PLATFORM_COMPONENT = True
 DOMAIN = "packet_transport"
 CONF_BROADCAST = "broadcast"
 CONF_BROADCAST_ID = "broadcast_id"
+CONF_CIPHER = "cipher"
+CONF_FULL_REFRESH_INTERVAL = "full_refresh_interval"
 CONF_PROVIDER = "provider"
 CONF_PROVIDERS = "providers"
 CONF_REMOTE_ID = "remote_id"
@@ -65,12 +67,28 @@ def provider_name_validate(value):
     return value
 
 
+CIPHER_XXTEA = "xxtea"
+CIPHER_AES_GCM = "aes_gcm"
+
+
+def validate_cipher(config):
+    if config[CONF_CIPHER] == CIPHER_AES_GCM and not CORE.is_esp32:
+        raise cv.Invalid("AES-GCM encryption is only supported on ESP32")
+    return config
+
+
 ENCRYPTION_SCHEMA = {
     cv.Optional(CONF_ENCRYPTION): cv.maybe_simple_value(
-        cv.Schema(
-            {
-                cv.Required(CONF_KEY): cv.string,
-            }
+        cv.All(
+            cv.Schema(
+                {
+                    cv.Required(CONF_KEY): cv.string,
+                    cv.Optional(CONF_CIPHER, default=CIPHER_XXTEA): cv.one_of(
+                        CIPHER_XXTEA, CIPHER_AES_GCM, lower=True
+                    ),
+                }
+            ),
+            validate_cipher,
         ),
         key=CONF_KEY,
     )
@@ -100,6 +118,9 @@ TRANSPORT_SCHEMA = (
     cv.polling_component_schema("15s")
     .extend(
         {
+            cv.Optional(
+                CONF_FULL_REFRESH_INTERVAL, default="0s"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_ROLLING_CODE_ENABLE, default=False): cv.boolean,
             cv.Optional(CONF_PING_PONG_ENABLE, default=False): cv.boolean,
             cv.Optional(
@@ -156,10 +177,22 @@ def hash_encryption_key(config: dict):
     return list(hashlib.sha256(config[CONF_KEY].encode()).digest())
 
 
+def use_aes_gcm(config: dict):
+    if config[CONF_CIPHER] != CIPHER_AES_GCM:
+        return False
+    cg.add_define("USE_PACKET_TRANSPORT_AES_GCM")
+    return True
+
+
 async def register_packet_transport(var, config):
     var = await cg.register_component(var, config)
     cg.add(var.set_rolling_code_enable(config[CONF_ROLLING_CODE_ENABLE]))
     cg.add(var.set_ping_pong_enable(config[CONF_PING_PONG_ENABLE]))
+    cg.add(
+        var.set_full_refresh_interval(
+            config[CONF_FULL_REFRESH_INTERVAL].total_milliseconds
+        )
+    )
     cg.add(
         var.set_ping_pong_recycle_time(
             config[CONF_PING_PONG_RECYCLE_TIME].total_seconds
@@ -175,6 +208,8 @@ async def register_packet_transport(var, config):
         name = provider[CONF_NAME]
         if encryption := provider.get(CONF_ENCRYPTION):
             cg.add(var.set_provider_encryption(name, hash_encryption_key(encryption)))
+            if use_aes_gcm(encryption):
+                cg.add(var.set_provider_aes_gcm_enable(name, True))
 
     for sens_conf in config.get(CONF_SENSORS, ()):
         sens_id = sens_conf[CONF_ID]
@@ -189,6 +224,8 @@ async def register_packet_transport(var, config):
 
     if encryption := config.get(CONF_ENCRYPTION):
         cg.add(var.set_encryption_key(hash_encryption_key(encryption)))
+        if use_aes_gcm(encryption):
+            cg.add(var.set_aes_gcm_enable(True))
     return providers
 
 
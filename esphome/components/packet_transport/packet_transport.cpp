@@ -4,6 +4,8 @@
 
 #include "esphome/components/xxtea/xxtea.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace packet_transport {
 /**
@@ -37,6 +39,11 @@ namespace packet_transport {
  *
  * Padded to a 4 byte boundary with nulls
  *
+ * With AES-GCM the clear text starts with MAGIC_AES_GCM instead, followed by
+ * nonce: 12 random bytes
+ * the data as above, encrypted and not padded
+ * tag: 16 bytes, authenticating the clear text header and the data
+ *
  * Structure of a ping request packet:
  * --- In clear text ---
  * MAGIC_PING: 16 bits
@@ -56,6 +63,7 @@ union FuData {
 
 static const uint16_t MAGIC_NUMBER = 0x4553;
 static const uint16_t MAGIC_PING = 0x5048;
+static const uint16_t MAGIC_AES_GCM = 0x4741;
 static const uint32_t PREF_HASH = 0x45535043;
 enum DataKey {
   ZERO_FILL_KEY,
@@ -172,12 +180,47 @@ class PacketDecoder {
     return true;
   }
 
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  // Authenticates and decrypts the rest of the buffer, leaving the decoder on the data.
+  bool decrypt(AesGcmCipher &cipher) {
+    if (this->get_remaining_size() <= AesGcmCipher::NONCE_SIZE + AesGcmCipher::TAG_SIZE)
+      return false;
+    auto *nonce = this->buffer_ + this->position_;
+    auto *data = (uint8_t *) nonce + AesGcmCipher::NONCE_SIZE;
+    auto len = this->get_remaining_size() - AesGcmCipher::NONCE_SIZE - AesGcmCipher::TAG_SIZE;
+    if (!cipher.decrypt(this->buffer_, this->position_, nonce, data, len, data + len))
+      return false;
+    this->position_ += AesGcmCipher::NONCE_SIZE;
+    this->len_ = this->position_ + len;
+    return true;
+  }
+#endif
+
  protected:
   const uint8_t *buffer_;
   size_t len_;
   size_t position_{};
 };
 
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+AesGcmCipher::AesGcmCipher(const std::vector<uint8_t> &key) {
+  mbedtls_gcm_init(&this->context_);
+  mbedtls_gcm_setkey(&this->context_, MBEDTLS_CIPHER_ID_AES, key.data(), key.size() * 8);
+}
+
+bool AesGcmCipher::encrypt(const uint8_t *aad, size_t aad_len, const uint8_t *nonce, uint8_t *data, size_t len,
+                           uint8_t *tag) {
+  return mbedtls_gcm_crypt_and_tag(&this->context_, MBEDTLS_GCM_ENCRYPT, len, nonce, NONCE_SIZE, aad, aad_len, data,
+                                   data, TAG_SIZE, tag) == 0;
+}
+
+bool AesGcmCipher::decrypt(const uint8_t *aad, size_t aad_len, const uint8_t *nonce, uint8_t *data, size_t len,
+                           const uint8_t *tag) {
+  return mbedtls_gcm_auth_decrypt(&this->context_, len, nonce, NONCE_SIZE, aad, aad_len, tag, TAG_SIZE, data, data) ==
+         0;
+}
+#endif
+
 static inline void add(std::vector<uint8_t> &vec, uint8_t data) { vec.push_back(data); }
 static inline void add(std::vector<uint8_t> &vec, uint16_t data) {
   vec.push_back((uint8_t) data);
@@ -192,6 +235,45 @@ static void add(std::vector<uint8_t> &vec, const char *str) {
   }
 }
 
+// Remote sensors are sorted by the hash of their id, so a received value is found with a binary search instead of
+// string compares. The id is still compared, in case two ids have the same hash.
+template<typename T> static void add_remote(std::vector<T> &remotes, T remote) {
+  auto it = std::lower_bound(remotes.begin(), remotes.end(), remote.hash,
+                             [](const T &item, uint32_t hash) { return item.hash < hash; });
+  for (auto same = it; same != remotes.end() && same->hash == remote.hash; ++same) {
+    if (strcmp(same->id, remote.id) == 0) {
+      same->sensor = remote.sensor;
+      return;
+    }
+  }
+  remotes.insert(it, remote);
+}
+
+template<typename T> static T *find_remote(std::vector<T> &remotes, const char *id) {
+  const uint32_t hash = fnv1_hash(id);
+  auto it = std::lower_bound(remotes.begin(), remotes.end(), hash,
+                             [](const T &item, uint32_t hash) { return item.hash < hash; });
+  for (; it != remotes.end() && it->hash == hash; ++it) {
+    if (strcmp(it->id, id) == 0)
+      return &*it;
+  }
+  return nullptr;
+}
+
+#ifdef USE_SENSOR
+void PacketTransport::add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor) {
+  this->add_provider(hostname);
+  add_remote(this->providers_[hostname].sensors, RemoteSensor{fnv1_hash(remote_id), remote_id, sensor});
+}
+#endif
+#ifdef USE_BINARY_SENSOR
+void PacketTransport::add_remote_binary_sensor(const char *hostname, const char *remote_id,
+                                               binary_sensor::BinarySensor *sensor) {
+  this->add_provider(hostname);
+  add_remote(this->providers_[hostname].binary_sensors, RemoteBinarySensor{fnv1_hash(remote_id), remote_id, sensor});
+}
+#endif
+
 void PacketTransport::setup() {
   this->name_ = App.get_name().c_str();
   if (strlen(this->name_) > 255) {
@@ -226,9 +308,20 @@ void PacketTransport::setup() {
       sensor.updated = true;
     });
   }
+#endif
+  uint16_t magic = MAGIC_NUMBER;
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  if (this->aes_gcm_enable_ && this->is_encrypted_()) {
+    this->aes_gcm_ = make_unique<AesGcmCipher>(this->encryption_key_);
+    magic = MAGIC_AES_GCM;
+  }
+  for (auto &provider : this->providers_) {
+    if (provider.second.aes_gcm_enable && !provider.second.encryption_key.empty())
+      provider.second.aes_gcm = std::make_shared<AesGcmCipher>(provider.second.encryption_key);
+  }
 #endif
   // initialise the header. This is invariant.
-  add(this->header_, MAGIC_NUMBER);
+  add(this->header_, magic);
   add(this->header_, this->name_);
   // pad to a multiple of 4 bytes
   while (this->header_.size() & 0x3)
@@ -255,6 +348,24 @@ void PacketTransport::flush_() {
   if (!this->should_send() || this->data_.empty())
     return;
   auto header_len = round4(this->header_.size());
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  if (this->aes_gcm_ != nullptr) {
+    // No padding needed, the tag covers the header as well
+    auto encode_buffer = std::vector<uint8_t>(header_len + this->data_.size() + this->cipher_overhead_());
+    memcpy(encode_buffer.data(), this->header_.data(), this->header_.size());
+    auto *nonce = encode_buffer.data() + header_len;
+    auto *data = nonce + AesGcmCipher::NONCE_SIZE;
+    memcpy(data, this->data_.data(), this->data_.size());
+    if (!random_bytes(nonce, AesGcmCipher::NONCE_SIZE) ||
+        !this->aes_gcm_->encrypt(encode_buffer.data(), header_len, nonce, data, this->data_.size(),
+                                 data + this->data_.size())) {
+      ESP_LOGW(TAG, "Packet encryption failed");
+      return;
+    }
+    this->send_packet(encode_buffer);
+    return;
+  }
+#endif
   auto len = round4(data_.size());
   auto encode_buffer = std::vector<uint8_t>(round4(header_len + len));
   memcpy(encode_buffer.data(), this->header_.data(), this->header_.size());
@@ -268,7 +379,7 @@ void PacketTransport::flush_() {
 
 void PacketTransport::add_binary_data_(uint8_t key, const char *id, bool data) {
   auto len = 1 + 1 + 1 + strlen(id);
-  if (len + this->header_.size() + this->data_.size() > this->get_max_packet_size()) {
+  if (len + this->header_.size() + this->data_.size() + this->cipher_overhead_() > this->get_max_packet_size()) {
     this->flush_();
     this->init_data_();
   }
@@ -283,7 +394,7 @@ void PacketTransport::add_data_(uint8_t key, const char *id, float data) {
 
 void PacketTransport::add_data_(uint8_t key, const char *id, uint32_t data) {
   auto len = 4 + 1 + 1 + strlen(id);
-  if (len + this->header_.size() + this->data_.size() > this->get_max_packet_size()) {
+  if (len + this->header_.size() + this->data_.size() + this->cipher_overhead_() > this->get_max_packet_size()) {
     this->flush_();
     this->init_data_();
   }
@@ -335,13 +446,13 @@ void PacketTransport::update() {
       }
 #endif
 #ifdef USE_SENSOR
-      for (auto &sensor : this->remote_sensors_[provider.first]) {
-        sensor.second->publish_state(NAN);
+      for (auto &sensor : provider.second.sensors) {
+        sensor.sensor->publish_state(NAN);
       }
 #endif
 #ifdef USE_BINARY_SENSOR
-      for (auto &sensor : this->remote_binary_sensors_[provider.first]) {
-        sensor.second->invalidate_state();
+      for (auto &sensor : provider.second.binary_sensors) {
+        sensor.sensor->invalidate_state();
       }
 #endif
     } else {
@@ -398,7 +509,7 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     ESP_LOGD(TAG, "Short buffer");
     return;
   }
-  if (magic != MAGIC_NUMBER && magic != MAGIC_PING) {
+  if (magic != MAGIC_NUMBER && magic != MAGIC_PING && magic != MAGIC_AES_GCM) {
     ESP_LOGV(TAG, "Bad magic %X", magic);
     return;
   }
@@ -422,35 +533,47 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     return;
   }
 
-  if (this->providers_.count(namebuf) == 0) {
+  auto provider_it = this->providers_.find(namebuf);
+  if (provider_it == this->providers_.end()) {
     ESP_LOGVV(TAG, "Unknown hostname %s", namebuf);
     return;
   }
   ESP_LOGV(TAG, "Found hostname %s", namebuf);
 
-#ifdef USE_SENSOR
-  auto &sensors = this->remote_sensors_[namebuf];
-#endif
-#ifdef USE_BINARY_SENSOR
-  auto &binary_sensors = this->remote_binary_sensors_[namebuf];
-#endif
-
   if (!decoder.bump_to(4)) {
     ESP_LOGW(TAG, "Bad packet length %zu", data.size());
   }
-  auto len = decoder.get_remaining_size();
-  if (round4(len) != len) {
-    ESP_LOGW(TAG, "Bad payload length %zu", len);
-    return;
-  }
-
-  auto &provider = this->providers_[namebuf];
+  auto &provider = provider_it->second;
   // if encryption not used with this host, ping check is pointless since it would be easily spoofed.
   if (provider.encryption_key.empty())
     ping_key_seen = true;
 
-  if (!provider.encryption_key.empty()) {
-    decoder.decrypt((const uint32_t *) provider.encryption_key.data());
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  const bool aes_gcm = provider.aes_gcm != nullptr;
+#else
+  const bool aes_gcm = false;
+#endif
+  if ((magic == MAGIC_AES_GCM) != aes_gcm) {
+    ESP_LOGW(TAG, "Cipher of %s does not match the configuration", namebuf);
+    return;
+  }
+  if (aes_gcm) {
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+    // Forged or corrupted packets are dropped here, before anything else is decoded
+    if (!decoder.decrypt(*provider.aes_gcm)) {
+      ESP_LOGW(TAG, "Authentication of packet from %s failed", namebuf);
+      return;
+    }
+#endif
+  } else {
+    auto len = decoder.get_remaining_size();
+    if (round4(len) != len) {
+      ESP_LOGW(TAG, "Bad payload length %zu", len);
+      return;
+    }
+    if (!provider.encryption_key.empty()) {
+      decoder.decrypt((const uint32_t *) provider.encryption_key.data());
+    }
   }
   if (decoder.get(byte) != DECODE_OK) {
     ESP_LOGV(TAG, "No key byte");
@@ -486,16 +609,16 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     if (decoder.decode(BINARY_SENSOR_KEY, namebuf, sizeof(namebuf), byte) == DECODE_OK) {
       ESP_LOGV(TAG, "Got binary sensor %s %d", namebuf, byte);
 #ifdef USE_BINARY_SENSOR
-      if (binary_sensors.count(namebuf) != 0)
-        binary_sensors[namebuf]->publish_state(byte != 0);
+      if (auto *remote = find_remote(provider.binary_sensors, namebuf))
+        remote->sensor->publish_state(byte != 0);
 #endif
       continue;
     }
     if (decoder.decode(SENSOR_KEY, namebuf, sizeof(namebuf), rdata.u32) == DECODE_OK) {
       ESP_LOGV(TAG, "Got sensor %s %f", namebuf, rdata.f32);
 #ifdef USE_SENSOR
-      if (sensors.count(namebuf) != 0)
-        sensors[namebuf]->publish_state(rdata.f32);
+      if (auto *remote = find_remote(provider.sensors, namebuf))
+        remote->sensor->publish_state(rdata.f32);
 #endif
       continue;
     }
@@ -513,8 +636,13 @@ void PacketTransport::dump_config() {
                 "Packet Transport:\n"
                 "  Platform: %s\n"
                 "  Encrypted: %s\n"
-                "  Ping-pong: %s",
-                this->platform_name_, YESNO(this->is_encrypted_()), YESNO(this->ping_pong_enable_));
+                "  Ping-pong: %s\n"
+                "  Full refresh interval: %" PRIu32 " ms",
+                this->platform_name_, YESNO(this->is_encrypted_()), YESNO(this->ping_pong_enable_),
+                this->full_refresh_interval_);
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  ESP_LOGCONFIG(TAG, "  AES-GCM: %s", YESNO(this->aes_gcm_ != nullptr));
+#endif
 #ifdef USE_SENSOR
   for (auto sensor : this->sensors_)
     ESP_LOGCONFIG(TAG, "  Sensor: %s", sensor.id);
@@ -526,13 +654,16 @@ void PacketTransport::dump_config() {
   for (const auto &host : this->providers_) {
     ESP_LOGCONFIG(TAG, "  Remote host: %s", host.first.c_str());
     ESP_LOGCONFIG(TAG, "    Encrypted: %s", YESNO(!host.second.encryption_key.empty()));
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+    ESP_LOGCONFIG(TAG, "    AES-GCM: %s", YESNO(host.second.aes_gcm != nullptr));
+#endif
 #ifdef USE_SENSOR
-    for (const auto &sensor : this->remote_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.sensors)
+      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.id);
 #endif
 #ifdef USE_BINARY_SENSOR
-    for (const auto &sensor : this->remote_binary_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.binary_sensors)
+      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.id);
 #endif
   }
 }
@@ -551,7 +682,16 @@ void PacketTransport::loop() {
   if (this->resend_ping_key_)
     this->send_ping_pong_request_();
   if (this->updated_) {
-    this->send_data_(this->resend_data_);
+    // resend_data_ asks for all values on a periodic update, within the refresh interval only changes are sent
+    bool all = this->resend_data_;
+    if (all && this->full_refresh_interval_ != 0) {
+      const uint32_t now = App.get_loop_component_start_time();
+      all = this->last_full_refresh_ == 0 || now - this->last_full_refresh_ >= this->full_refresh_interval_;
+      if (all)
+        this->last_full_refresh_ = now;
+    }
+    this->send_data_(all);
+    this->resend_data_ = false;
   }
 }
 
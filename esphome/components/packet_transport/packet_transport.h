@@ -9,8 +9,13 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 
-#include <vector>
 #include <map>
+#include <memory>
+#include <vector>
+
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+#include "mbedtls/gcm.h"
+#endif
 
 /**
  * Providing packet encoding functions for exchanging data with a remote host.
@@ -23,14 +28,62 @@
 namespace esphome {
 namespace packet_transport {
 
+#ifdef USE_SENSOR
+struct RemoteSensor {
+  uint32_t hash;  // fnv1_hash of the id, remote sensors are kept sorted by it
+  const char *id;
+  sensor::Sensor *sensor;
+};
+#endif
+#ifdef USE_BINARY_SENSOR
+struct RemoteBinarySensor {
+  uint32_t hash;
+  const char *id;
+  binary_sensor::BinarySensor *sensor;
+};
+#endif
+
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+/// AES-256-GCM context set up once per key, the ESP32 runs the block cipher in hardware.
+class AesGcmCipher {
+ public:
+  static constexpr size_t NONCE_SIZE = 12;
+  static constexpr size_t TAG_SIZE = 16;
+
+  explicit AesGcmCipher(const std::vector<uint8_t> &key);
+  AesGcmCipher(const AesGcmCipher &) = delete;
+  AesGcmCipher &operator=(const AesGcmCipher &) = delete;
+  ~AesGcmCipher() { mbedtls_gcm_free(&this->context_); }
+
+  /// Encrypts data in place and writes the tag authenticating it together with the clear text aad.
+  bool encrypt(const uint8_t *aad, size_t aad_len, const uint8_t *nonce, uint8_t *data, size_t len, uint8_t *tag);
+  /// Decrypts data in place, returns false when the tag does not match.
+  bool decrypt(const uint8_t *aad, size_t aad_len, const uint8_t *nonce, uint8_t *data, size_t len,
+               const uint8_t *tag);
+
+ protected:
+  mbedtls_gcm_context context_;
+};
+#endif
+
 struct Provider {
   std::vector<uint8_t> encryption_key;
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  bool aes_gcm_enable;
+  std::shared_ptr<AesGcmCipher> aes_gcm;
+#endif
   const char *name;
   uint32_t last_code[2];
   uint32_t last_key_response_time;
 #ifdef USE_STATUS_SENSOR
   binary_sensor::BinarySensor *status_sensor{nullptr};
 #endif
+#ifdef USE_SENSOR
+  std::vector<RemoteSensor> sensors;
+#endif
+#ifdef USE_BINARY_SENSOR
+  std::vector<RemoteBinarySensor> binary_sensors;
+#endif
 };
 
 #ifdef USE_SENSOR
@@ -60,10 +113,7 @@ class PacketTransport : public PollingComponent {
     Sensor st{sensor, id, true};
     this->sensors_.push_back(st);
   }
-  void add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor) {
-    this->add_provider(hostname);
-    this->remote_sensors_[hostname][remote_id] = sensor;
-  }
+  void add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor);
 #endif
 #ifdef USE_BINARY_SENSOR
   void add_binary_sensor(const char *id, binary_sensor::BinarySensor *sensor) {
@@ -71,10 +121,7 @@ class PacketTransport : public PollingComponent {
     this->binary_sensors_.push_back(st);
   }
 
-  void add_remote_binary_sensor(const char *hostname, const char *remote_id, binary_sensor::BinarySensor *sensor) {
-    this->add_provider(hostname);
-    this->remote_binary_sensors_[hostname][remote_id] = sensor;
-  }
+  void add_remote_binary_sensor(const char *hostname, const char *remote_id, binary_sensor::BinarySensor *sensor);
 #endif
 
   void add_provider(const char *hostname) {
@@ -82,12 +129,6 @@ class PacketTransport : public PollingComponent {
       Provider provider{};
       provider.name = hostname;
       this->providers_[hostname] = provider;
-#ifdef USE_SENSOR
-      this->remote_sensors_[hostname] = std::map<std::string, sensor::Sensor *>();
-#endif
-#ifdef USE_BINARY_SENSOR
-      this->remote_binary_sensors_[hostname] = std::map<std::string, binary_sensor::BinarySensor *>();
-#endif
     }
   }
 
@@ -95,9 +136,17 @@ class PacketTransport : public PollingComponent {
   void set_rolling_code_enable(bool enable) { this->rolling_code_enable_ = enable; }
   void set_ping_pong_enable(bool enable) { this->ping_pong_enable_ = enable; }
   void set_ping_pong_recycle_time(uint32_t recycle_time) { this->ping_pong_recyle_time_ = recycle_time; }
+  /// Send all values at most this often (ms), the updates in between carry only the changed ones. 0 sends all on
+  /// every update.
+  void set_full_refresh_interval(uint32_t interval) { this->full_refresh_interval_ = interval; }
   void set_provider_encryption(const char *name, std::vector<uint8_t> key) {
     this->providers_[name].encryption_key = std::move(key);
   }
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  /// Use AES-GCM instead of XXTEA with the encryption key, the packets are then also authenticated.
+  void set_aes_gcm_enable(bool enable) { this->aes_gcm_enable_ = enable; }
+  void set_provider_aes_gcm_enable(const char *name, bool enable) { this->providers_[name].aes_gcm_enable = enable; }
+#endif
 #ifdef USE_STATUS_SENSOR
   void set_provider_status_sensor(const char *name, binary_sensor::BinarySensor *sensor) {
     this->providers_[name].status_sensor = sensor;
@@ -130,18 +179,22 @@ class PacketTransport : public PollingComponent {
   uint32_t last_key_time_{};
   bool resend_ping_key_{};
   bool resend_data_{};
+  uint32_t full_refresh_interval_{};
+  uint32_t last_full_refresh_{};
   const char *name_{};
   ESPPreferenceObject pref_{};
 
   std::vector<uint8_t> encryption_key_{};
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+  bool aes_gcm_enable_{};
+  std::unique_ptr<AesGcmCipher> aes_gcm_{};
+#endif
 
 #ifdef USE_SENSOR
   std::vector<Sensor> sensors_{};
-  std::map<std::string, std::map<std::string, sensor::Sensor *>> remote_sensors_{};
 #endif
 #ifdef USE_BINARY_SENSOR
   std::vector<BinarySensor> binary_sensors_{};
-  std::map<std::string, std::map<std::string, binary_sensor::BinarySensor *>> remote_binary_sensors_{};
 #endif
 
   std::map<std::string, Provider> providers_{};
@@ -154,6 +207,14 @@ class PacketTransport : public PollingComponent {
   void send_ping_pong_request_();
 
   inline bool is_encrypted_() { return !this->encryption_key_.empty(); }
+  // Bytes the encryption adds to a packet besides the padding
+  inline size_t cipher_overhead_() const {
+#ifdef USE_PACKET_TRANSPORT_AES_GCM
+    if (this->aes_gcm_ != nullptr)
+      return AesGcmCipher::NONCE_SIZE + AesGcmCipher::TAG_SIZE;
+#endif
+    return 0;
+  }
 };
 
 }  // namespace packet_transport
@@ -6,5 +6,50 @@ namespace partition {
 
 static const char *const TAG = "partition.light";
 
+void PartitionLightOutput::update_state(light::LightState *state) {
+  auto val = state->current_values;
+  this->correction_.set_local_brightness(light::to_uint8_scale(val.get_brightness() * val.get_state()));
+  if (this->is_effect_active())
+    return;
+
+  // Same as AddressableLight::update_state(), but fills each segment in the buffer of its strip instead of setting
+  // every LED through a view. The colors are corrected for this partition, not for the strip.
+  const Color color = light::color_from_light_color_values(val);
+  const Color corrected = this->correction_.color_correct(color);
+  for (auto &seg : this->segments_) {
+    light::PixelBuffer buffer;
+    if (seg.get_src()->get_pixel_buffer(&buffer)) {
+      buffer.fill(seg.get_src_offset(), seg.get_src_offset() + seg.get_size(), corrected);
+      continue;
+    }
+    for (int32_t i = 0; i < seg.get_size(); i++)
+      this->get_view_internal(seg.get_dst_offset() + i) = color;
+  }
+  this->schedule_show();
+}
+
+uint32_t PartitionLightOutput::find_segment_(int32_t index) const {
+  const auto &last = this->segments_[this->last_segment_];
+  if (index >= last.get_dst_offset() && index < last.get_dst_offset() + last.get_size())
+    return this->last_segment_;
+
+  uint32_t lo = 0;
+  uint32_t hi = this->segments_.size() - 1;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    int32_t begin = this->segments_[mid].get_dst_offset();
+    int32_t end = begin + this->segments_[mid].get_size();
+    if (index < begin) {
+      hi = mid - 1;
+    } else if (index >= end) {
+      lo = mid + 1;
+    } else {
+      lo = hi = mid;
+    }
+  }
+  this->last_segment_ = lo;
+  return lo;
+}
+
 }  // namespace partition
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,8 @@ class PartitionLightOutput : public light::AddressableLight {
     for (auto &seg : this->segments_) {
       seg.set_dst_offset(off);
       off += seg.get_size();
+      if (std::find(this->sources_.begin(), this->sources_.end(), seg.get_src()) == this->sources_.end())
+        this->sources_.push_back(seg.get_src());
     }
   }
   int32_t size() const override {
@@ -51,30 +54,18 @@ class PartitionLightOutput : public light::AddressableLight {
     }
   }
   light::LightTraits get_traits() override { return this->segments_[0].get_src()->get_traits(); }
+  void update_state(light::LightState *state) override;
   void write_state(light::LightState *state) override {
-    for (auto seg : this->segments_) {
-      seg.get_src()->schedule_show();
+    // Only marks the strips as changed, each of them is written once in its own loop however many partitions it has
+    for (auto *src : this->sources_) {
+      src->schedule_show();
     }
     this->mark_shown_();
   }
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {
-    uint32_t lo = 0;
-    uint32_t hi = this->segments_.size() - 1;
-    while (lo < hi) {
-      uint32_t mid = (lo + hi) / 2;
-      int32_t begin = this->segments_[mid].get_dst_offset();
-      int32_t end = begin + this->segments_[mid].get_size();
-      if (index < begin) {
-        hi = mid - 1;
-      } else if (index >= end) {
-        lo = mid + 1;
-      } else {
-        lo = hi = mid;
-      }
-    }
-    auto &seg = this->segments_[lo];
+    auto &seg = this->segments_[this->find_segment_(index)];
     // offset within the segment
     int32_t seg_off = index - seg.get_dst_offset();
     // offset within the src
@@ -90,7 +81,13 @@ class PartitionLightOutput : public light::AddressableLight {
     return view;
   }
 
+  /// Index of the segment holding index. Effects mostly walk the LEDs in order, so the last segment is tried first.
+  uint32_t find_segment_(int32_t index) const;
+
   std::vector<AddressableSegment> segments_;
+  /// Distinct strips of the segments
+  std::vector<light::AddressableLight *> sources_;
+  mutable uint32_t last_segment_{0};
 };
 
 }  // namespace partition
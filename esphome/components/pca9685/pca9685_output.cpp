@@ -99,12 +99,26 @@ void PCA9685Output::dump_config() {
 }
 
 void PCA9685Output::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  // Writes are collected into dirty_channels_, so the loop only needs to run after a channel changed
+  if (this->min_channel_ == 0xFF || this->dirty_channels_ == 0) {
+    this->disable_loop();
     return;
+  }
+
+  // Write the range from the first to the last changed channel in a single transaction, a light with several
+  // channels on this chip then updates all of them at once instead of with one transaction per channel
+  uint8_t first = this->min_channel_;
+  while (first < this->max_channel_ && (this->dirty_channels_ & (1 << first)) == 0)
+    first++;
+  uint8_t last = this->max_channel_;
+  while (last > first && (this->dirty_channels_ & (1 << last)) == 0)
+    last--;
 
   const uint16_t num_channels = this->max_channel_ - this->min_channel_ + 1;
   const uint16_t phase_delta_begin = 4096 / num_channels;
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
+  uint8_t data[16 * 4];
+  uint8_t *pos = data;
+  for (uint8_t channel = first; channel <= last; channel++) {
     uint16_t phase_begin = (channel - this->min_channel_) * phase_delta_begin;
     uint16_t phase_end;
     uint16_t amount = this->pwm_amounts_[channel];
@@ -122,21 +136,21 @@ void PCA9685Output::loop() {
     ESP_LOGVV(TAG, "Channel %02u: amount=%04u phase_begin=%04u phase_end=%04u", channel, amount, phase_begin,
               phase_end);
 
-    uint8_t data[4];
-    data[0] = phase_begin & 0xFF;
-    data[1] = (phase_begin >> 8) & 0xFF;
-    data[2] = phase_end & 0xFF;
-    data[3] = (phase_end >> 8) & 0xFF;
+    *pos++ = phase_begin & 0xFF;
+    *pos++ = (phase_begin >> 8) & 0xFF;
+    *pos++ = phase_end & 0xFF;
+    *pos++ = (phase_end >> 8) & 0xFF;
+  }
 
-    uint8_t reg = PCA9685_REGISTER_LED0 + 4 * channel;
-    if (!this->write_bytes(reg, data, 4)) {
-      this->status_set_warning();
-      return;
-    }
+  // MODE1 has auto-increment enabled, so the LEDn registers of consecutive channels follow each other
+  uint8_t reg = PCA9685_REGISTER_LED0 + 4 * first;
+  if (!this->write_bytes(reg, data, pos - data)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->dirty_channels_ = 0;
 }
 
 void PCA9685Output::register_channel(PCA9685Channel *channel) {
@@ -52,9 +52,11 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
   friend PCA9685Channel;
 
   void set_channel_value_(uint8_t channel, uint16_t value) {
-    if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
+    if (this->pwm_amounts_[channel] == value)
+      return;
     this->pwm_amounts_[channel] = value;
+    this->dirty_channels_ |= 1 << channel;
+    this->enable_loop();
   }
 
   float frequency_;
@@ -66,7 +68,8 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
   uint16_t pwm_amounts_[16] = {
       0,
   };
-  bool update_{true};
+  /// Channels changed since the last write, all of them are written in one auto-increment burst by loop()
+  uint16_t dirty_channels_{0xFFFF};
 };
 
 }  // namespace pca9685
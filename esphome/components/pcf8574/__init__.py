@@ -1,6 +1,7 @@
 from esphome import pins
 import esphome.codegen as cg
 from esphome.components import i2c
+from esphome.components.gpio_expander import CONF_WRITE_COMBINING
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ID,
@@ -27,6 +28,7 @@ CONFIG_SCHEMA = (
         {
             cv.Required(CONF_ID): cv.declare_id(PCF8574Component),
             cv.Optional(CONF_PCF8575, default=False): cv.boolean,
+            cv.Optional(CONF_WRITE_COMBINING, default=False): cv.boolean,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -39,6 +41,7 @@ async def to_code(config):
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
     cg.add(var.set_pcf8575(config[CONF_PCF8575]))
+    cg.add(var.set_write_combining(config[CONF_WRITE_COMBINING]))
 
 
 def validate_mode(value):
@@ -17,6 +17,7 @@ void PCF8574Component::setup() {
   this->read_gpio_();
 }
 void PCF8574Component::loop() {
+  this->flush_writes();
   // Invalidate the cache at the start of each loop
   this->reset_pin_cache_();
 }
@@ -24,6 +25,7 @@ void PCF8574Component::dump_config() {
   ESP_LOGCONFIG(TAG, "PCF8574:");
   LOG_I2C_DEVICE(this)
   ESP_LOGCONFIG(TAG, "  Is PCF8575: %s", YESNO(this->pcf8575_));
+  ESP_LOGCONFIG(TAG, "  Write combining: %s", YESNO(this->write_combining_));
   if (this->is_failed()) {
     ESP_LOGE(TAG, ESP_LOG_MSG_COMM_FAIL);
   }
@@ -36,12 +38,15 @@ bool PCF8574Component::digital_read_hw(uint8_t pin) {
 bool PCF8574Component::digital_read_cache(uint8_t pin) { return this->input_mask_ & (1 << pin); }
 
 void PCF8574Component::digital_write_hw(uint8_t pin, bool value) {
+  this->digital_write_cache(pin, value);
+  this->write_gpio_();
+}
+void PCF8574Component::digital_write_cache(uint8_t pin, bool value) {
   if (value) {
     this->output_mask_ |= (1 << pin);
   } else {
     this->output_mask_ &= ~(1 << pin);
   }
-  this->write_gpio_();
 }
 void PCF8574Component::pin_mode(uint8_t pin, gpio::Flags flags) {
   if (flags == gpio::FLAG_INPUT) {
@@ -20,7 +20,7 @@ class PCF8574Component : public Component,
 
   /// Check i2c availability and setup masks
   void setup() override;
-  /// Invalidate cache at start of each loop
+  /// Write the combined pin writes and invalidate cache at start of each loop
   void loop() override;
   /// Helper function to set the pin mode of a pin.
   void pin_mode(uint8_t pin, gpio::Flags flags);
@@ -34,6 +34,8 @@ class PCF8574Component : public Component,
   bool digital_read_hw(uint8_t pin) override;
   bool digital_read_cache(uint8_t pin) override;
   void digital_write_hw(uint8_t pin, bool value) override;
+  void digital_write_cache(uint8_t pin, bool value) override;
+  void write_bank_hw(uint8_t bank) override { this->write_gpio_(); }
 
   bool read_gpio_();
   bool write_gpio_();
@@ -14,7 +14,17 @@ namespace pn532 {
 
 static const char *const TAG = "pn532";
 
+// Time the PN532 gets to answer before a wait is given up
+static const uint32_t READ_READY_TIMEOUT_MS = 100;
+// Time the PN532 needs after an abort before it takes the next command
+static const uint32_t ABORT_DELAY_MS = 10;
+
 void PN532::setup() {
+  if (this->irq_pin_ != nullptr) {
+    this->irq_pin_->setup();
+    this->irq_pin_->attach_interrupt(&PN532::gpio_intr, this, gpio::INTERRUPT_FALLING_EDGE);
+  }
+
   // Get version data
   if (!this->write_command_({PN532_COMMAND_VERSION_DATA})) {
     ESP_LOGW(TAG, "Error sending version command, trying again");
@@ -81,7 +91,7 @@ void PN532::setup() {
 
 bool PN532::powerdown() {
   updates_enabled_ = false;
-  requested_read_ = false;
+  this->poll_state_ = POLL_IDLE;
   ESP_LOGI(TAG, "Powering down PN532");
   if (!this->write_command_({PN532_COMMAND_POWERDOWN, 0b10100000})) {  // enable i2c,spi wakeup
     ESP_LOGE(TAG, "Error writing powerdown command to PN532");
@@ -102,44 +112,71 @@ bool PN532::powerdown() {
 }
 
 void PN532::update() {
-  if (!updates_enabled_)
+  if (!updates_enabled_ || this->poll_state_ != POLL_IDLE)
     return;
 
   for (auto *obj : this->binary_sensors_)
     obj->on_scan_end();
 
-  if (!this->write_command_({
-          PN532_COMMAND_INLISTPASSIVETARGET,
-          0x01,  // max 1 card
-          0x00,  // baud rate ISO14443A (106 kbit/s)
-      })) {
-    ESP_LOGW(TAG, "Requesting tag read failed!");
-    this->status_set_warning();
+  // The ACK and the response are collected by loop(), so waiting for a tag doesn't stall the main loop
+  this->write_frame_({
+      PN532_COMMAND_INLISTPASSIVETARGET,
+      0x01,  // max 1 card
+      0x00,  // baud rate ISO14443A (106 kbit/s)
+  });
+  this->poll_state_ = POLL_WAIT_ACK;
+  this->enable_loop();
+}
+
+void IRAM_ATTR PN532::gpio_intr(PN532 *arg) {
+  // The PN532 pulls its IRQ line low when the ACK or the response is ready
+  arg->enable_loop_soon_any_context();
+}
+
+void PN532::wait_for_irq_() {
+  // Without the IRQ line the loop keeps checking the bus
+  if (this->irq_pin_ == nullptr)
     return;
-  }
-  this->status_clear_warning();
-  this->requested_read_ = true;
+  // Wakes the loop once the wait times out, in case the IRQ never comes
+  this->set_timeout("irq_wait", READ_READY_TIMEOUT_MS + 1, [this]() { this->enable_loop(); });
+  this->disable_loop();
 }
 
 void PN532::loop() {
-  if (!this->requested_read_)
+  if (this->poll_state_ == POLL_IDLE || this->poll_state_ == POLL_ABORTING) {
+    this->disable_loop();
     return;
+  }
 
   auto ready = this->read_ready_(false);
-  if (ready == WOULDBLOCK)
+  if (ready == WOULDBLOCK) {
+    this->wait_for_irq_();
     return;
+  }
+
+  if (this->poll_state_ == POLL_WAIT_ACK) {
+    if (ready != READY || !this->read_ack_()) {
+      ESP_LOGW(TAG, "Requesting tag read failed!");
+      this->status_set_warning();
+      this->poll_state_ = POLL_IDLE;
+      return;
+    }
+    this->status_clear_warning();
+    this->poll_state_ = POLL_WAIT_RESPONSE;
+    return;
+  }
 
   bool success = false;
   std::vector<uint8_t> read;
 
+  this->poll_state_ = POLL_IDLE;
   if (ready == READY) {
     success = this->read_response(PN532_COMMAND_INLISTPASSIVETARGET, read);
   } else {
     this->send_ack_();  // abort still running InListPassiveTarget
+    this->poll_state_ = POLL_ABORTING;
   }
 
-  this->requested_read_ = false;
-
   if (!success) {
     // Something failed
     if (!this->current_uid_.empty()) {
@@ -148,7 +185,15 @@ void PN532::loop() {
         trigger->process(tag);
     }
     this->current_uid_ = {};
-    this->turn_off_rf_();
+    if (this->poll_state_ == POLL_ABORTING) {
+      // The PN532 takes a moment to process the abort before it accepts the next command
+      this->set_timeout("abort", ABORT_DELAY_MS, [this]() {
+        this->turn_off_rf_();
+        this->poll_state_ = POLL_IDLE;
+      });
+    } else {
+      this->turn_off_rf_();
+    }
     return;
   }
 
@@ -241,7 +286,7 @@ void PN532::loop() {
   this->turn_off_rf_();
 }
 
-bool PN532::write_command_(const std::vector<uint8_t> &data) {
+void PN532::write_frame_(const std::vector<uint8_t> &data) {
   std::vector<uint8_t> write_data;
   // Preamble
   write_data.push_back(0x00);
@@ -274,7 +319,10 @@ bool PN532::write_command_(const std::vector<uint8_t> &data) {
   write_data.push_back(0x00);
 
   this->write_data(write_data);
+}
 
+bool PN532::write_command_(const std::vector<uint8_t> &data) {
+  this->write_frame_(data);
   return this->read_ack_();
 }
 
@@ -297,7 +345,6 @@ bool PN532::read_ack_() {
 void PN532::send_ack_() {
   ESP_LOGV(TAG, "Sending ACK for abort");
   this->write_data({0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00});
-  delay(10);
 }
 void PN532::send_nack_() {
   ESP_LOGV(TAG, "Sending NACK for retransmit");
@@ -319,12 +366,12 @@ enum PN532ReadReady PN532::read_ready_(bool block) {
   }
 
   while (true) {
-    if (this->is_read_ready()) {
+    if (this->is_ready_()) {
       this->rd_ready_ = READY;
       break;
     }
 
-    if (millis() - this->rd_start_time_ > 100) {
+    if (millis() - this->rd_start_time_ > READ_READY_TIMEOUT_MS) {
       ESP_LOGV(TAG, "Timed out waiting for readiness from PN532!");
       this->rd_ready_ = TIMEOUT;
       break;
@@ -346,6 +393,12 @@ enum PN532ReadReady PN532::read_ready_(bool block) {
   return rdy;
 }
 
+bool PN532::is_ready_() {
+  if (this->irq_pin_ != nullptr)
+    return !this->irq_pin_->digital_read();
+  return this->is_read_ready();
+}
+
 void PN532::turn_off_rf_() {
   ESP_LOGV(TAG, "Turning RF field OFF");
   this->write_command_({
@@ -438,6 +491,7 @@ void PN532::dump_config() {
       break;
   }
 
+  LOG_PIN("  IRQ Pin: ", this->irq_pin_);
   LOG_UPDATE_INTERVAL(this);
 
   for (auto *child : this->binary_sensors_) {
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/nfc/nfc_tag.h"
 #include "esphome/components/nfc/nfc.h"
@@ -40,6 +41,8 @@ class PN532 : public PollingComponent {
   void loop() override;
   void on_powerdown() override { powerdown(); }
 
+  void set_irq_pin(InternalGPIOPin *irq_pin) { this->irq_pin_ = irq_pin; }
+
   void register_tag(PN532BinarySensor *tag) { this->binary_sensors_.push_back(tag); }
   void register_ontag_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontag_.push_back(trig); }
   void register_ontagremoved_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontagremoved_.push_back(trig); }
@@ -59,11 +62,18 @@ class PN532 : public PollingComponent {
  protected:
   void turn_off_rf_();
   bool write_command_(const std::vector<uint8_t> &data);
+  /// Sends a command frame without waiting for the ACK
+  void write_frame_(const std::vector<uint8_t> &data);
   bool read_ack_();
   void send_ack_();
   void send_nack_();
 
   enum PN532ReadReady read_ready_(bool block);
+  /// Checks the IRQ pin if one is set, the bus otherwise
+  bool is_ready_();
+  /// Puts the loop to sleep until the PN532 raises its IRQ or the wait times out
+  void wait_for_irq_();
+  static void gpio_intr(PN532 *arg);
   virtual bool is_read_ready() = 0;
   virtual bool write_data(const std::vector<uint8_t> &data) = 0;
   virtual bool read_data(std::vector<uint8_t> &data, uint8_t len) = 0;
@@ -94,7 +104,15 @@ class PN532 : public PollingComponent {
   bool clean_mifare_ultralight_();
 
   bool updates_enabled_{true};
-  bool requested_read_{false};
+  // IRQ line of the PN532, low while a frame is ready to be read
+  InternalGPIOPin *irq_pin_{nullptr};
+  // A poll sends InListPassiveTarget from update(), loop() collects the ACK and then the response
+  enum PollState : uint8_t {
+    POLL_IDLE = 0,
+    POLL_WAIT_ACK,
+    POLL_WAIT_RESPONSE,
+    POLL_ABORTING,
+  } poll_state_{POLL_IDLE};
   std::vector<PN532BinarySensor *> binary_sensors_;
   std::vector<nfc::NfcOnTagTrigger *> triggers_ontag_;
   std::vector<nfc::NfcOnTagTrigger *> triggers_ontagremoved_;
@@ -0,0 +1,91 @@
+import esphome.codegen as cg
+from esphome.components.esp32 import (
+    CONF_CPU_FREQUENCY,
+    CPU_FREQUENCIES,
+    FULL_CPU_FREQUENCIES,
+    add_idf_sdkconfig_option,
+    get_esp32_variant,
+)
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+from esphome.core import CORE
+from esphome.final_validate import full_config
+
+CODEOWNERS = ["@esphome/core"]
+
+power_management_ns = cg.esphome_ns.namespace("power_management")
+PowerManagement = power_management_ns.class_(
+    "PowerManagement", cg.PollingComponent
+)
+
+CONF_LIGHT_SLEEP = "light_sleep"
+CONF_MAX_FREQUENCY = "max_frequency"
+CONF_MIN_FREQUENCY = "min_frequency"
+CONF_POWER_MANAGEMENT_ID = "power_management_id"
+
+validate_frequency = cv.one_of(*FULL_CPU_FREQUENCIES, upper=True)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(PowerManagement),
+            # Defaults to the cpu_frequency of the esp32 component
+            cv.Optional(CONF_MAX_FREQUENCY): validate_frequency,
+            # Defaults to the lowest frequency of the variant
+            cv.Optional(CONF_MIN_FREQUENCY): validate_frequency,
+            cv.Optional(CONF_LIGHT_SLEEP, default=False): cv.boolean,
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.only_with_esp_idf,
+)
+
+
+def _frequency_mhz(frequency):
+    return int(frequency[: -len("MHZ")])
+
+
+def _frequencies(config, esp32_config):
+    max_frequency = config.get(CONF_MAX_FREQUENCY, esp32_config[CONF_CPU_FREQUENCY])
+    min_frequency = config.get(
+        CONF_MIN_FREQUENCY, CPU_FREQUENCIES[get_esp32_variant()][0]
+    )
+    return max_frequency, min_frequency
+
+
+def _final_validate(config):
+    choices = CPU_FREQUENCIES[get_esp32_variant()]
+    max_frequency, min_frequency = _frequencies(config, full_config.get()["esp32"])
+    for key, frequency in (
+        (CONF_MAX_FREQUENCY, max_frequency),
+        (CONF_MIN_FREQUENCY, min_frequency),
+    ):
+        if frequency not in choices:
+            raise cv.Invalid(
+                f"{frequency} is not supported by {get_esp32_variant()}", path=[key]
+            )
+    if _frequency_mhz(min_frequency) > _frequency_mhz(max_frequency):
+        raise cv.Invalid(
+            f"{CONF_MIN_FREQUENCY} must not be above {CONF_MAX_FREQUENCY}",
+            path=[CONF_MIN_FREQUENCY],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    max_frequency, min_frequency = _frequencies(config, CORE.config["esp32"])
+    cg.add(var.set_max_frequency_mhz(_frequency_mhz(max_frequency)))
+    cg.add(var.set_min_frequency_mhz(_frequency_mhz(min_frequency)))
+    cg.add(var.set_light_sleep(config[CONF_LIGHT_SLEEP]))
+    cg.add_define("USE_POWER_MANAGEMENT")
+    cg.add_define("USE_OTA_STATE_CALLBACK")  # To hold full speed while an OTA update runs
+
+    add_idf_sdkconfig_option("CONFIG_PM_ENABLE", True)
+    if config[CONF_LIGHT_SLEEP]:
+        # Light sleep is entered from the idle task once no lock is held
+        add_idf_sdkconfig_option("CONFIG_FREERTOS_USE_TICKLESS_IDLE", True)
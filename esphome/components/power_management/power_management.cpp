@@ -0,0 +1,119 @@
+#include "power_management.h"
+
+#ifdef USE_POWER_MANAGEMENT
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#ifdef USE_OTA
+#include "esphome/components/ota/ota_backend.h"
+#endif
+
+namespace esphome {
+namespace power_management {
+
+static const char *const TAG = "power_management";
+
+PowerManagement *global_power_management = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void PerformanceLock::acquire() {
+  if (this->held_)
+    return;
+  if (this->handle_ == nullptr && esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, this->name_, &this->handle_) != ESP_OK) {
+    ESP_LOGW(TAG, "Creating the lock %s failed", this->name_);
+    this->handle_ = nullptr;
+    return;
+  }
+  esp_pm_lock_acquire(this->handle_);
+  this->held_ = true;
+  if (global_power_management != nullptr)
+    global_power_management->on_lock_acquired();
+}
+
+void PerformanceLock::release() {
+  if (!this->held_)
+    return;
+  esp_pm_lock_release(this->handle_);
+  this->held_ = false;
+  if (global_power_management != nullptr)
+    global_power_management->on_lock_released();
+}
+
+PowerManagement::PowerManagement() { global_power_management = this; }
+
+void PowerManagement::setup() {
+  esp_pm_config_t config = {
+      .max_freq_mhz = this->max_frequency_mhz_,
+      .min_freq_mhz = this->min_frequency_mhz_,
+      .light_sleep_enable = this->light_sleep_,
+  };
+  esp_err_t err = esp_pm_configure(&config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "esp_pm_configure failed: %s", esp_err_to_name(err));
+    this->mark_failed();
+    return;
+  }
+  this->last_update_ = millis();
+
+#ifdef USE_OTA
+  // Writing the image is bound by the CPU, keep it at full speed from the first block to the reboot
+  ota::get_global_ota_callback()->add_on_state_callback(
+      [this](ota::OTAState state, float progress, uint8_t error, ota::OTAComponent *comp) {
+        this->ota_lock_.set(state == ota::OTA_STARTED || state == ota::OTA_IN_PROGRESS);
+      });
+#endif
+}
+
+void PowerManagement::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Power Management:\n"
+                "  Max Frequency: %d MHz\n"
+                "  Min Frequency: %d MHz\n"
+                "  Light Sleep: %s",
+                this->max_frequency_mhz_, this->min_frequency_mhz_, YESNO(this->light_sleep_));
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Max Frequency Residency", this->max_frequency_residency_sensor_);
+#endif
+}
+
+void PowerManagement::update() {
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->last_update_;
+  const uint32_t max_frequency_ms = this->take_max_frequency_time_(now);
+  this->last_update_ = now;
+  if (elapsed == 0)
+    return;
+  const float residency = 100.0f * max_frequency_ms / elapsed;
+  ESP_LOGV(TAG, "%.1f%% of the last %" PRIu32 " ms at %d MHz", residency, elapsed, this->max_frequency_mhz_);
+#ifdef USE_SENSOR
+  if (this->max_frequency_residency_sensor_ != nullptr)
+    this->max_frequency_residency_sensor_->publish_state(residency);
+#endif
+}
+
+void PowerManagement::on_lock_acquired() {
+  if (this->held_locks_++ == 0)
+    this->held_since_ = millis();
+}
+
+void PowerManagement::on_lock_released() {
+  if (this->held_locks_ == 0)
+    return;
+  if (--this->held_locks_ == 0)
+    this->max_frequency_ms_ += millis() - this->held_since_;
+}
+
+uint32_t PowerManagement::take_max_frequency_time_(uint32_t now) {
+  uint32_t max_frequency_ms = this->max_frequency_ms_;
+  this->max_frequency_ms_ = 0;
+  if (this->held_locks_ != 0) {
+    // Split the running burst at the update
+    max_frequency_ms += now - this->held_since_;
+    this->held_since_ = now;
+  }
+  return max_frequency_ms;
+}
+
+}  // namespace power_management
+}  // namespace esphome
+
+#endif  // USE_POWER_MANAGEMENT
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_POWER_MANAGEMENT
+
+#include <esp_pm.h>
+
+#include "esphome/core/component.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome {
+namespace power_management {
+
+/** Keeps the CPU at the maximum frequency while held.
+ *
+ * Components that work in bursts, like a fingerprint match, an OTA or a display refresh, hold one while busy so the
+ * CPU can slow down or light sleep the rest of the time. Locks are not counted: acquiring a held lock does nothing.
+ * Only use them from the main loop.
+ */
+class PerformanceLock {
+ public:
+  /// name shows up in the lock dump of ESP-IDF, it must outlive the lock.
+  explicit PerformanceLock(const char *name) : name_(name) {}
+
+  void acquire();
+  void release();
+  /// Acquire or release so the lock ends up held as given, for components that check their state every loop.
+  void set(bool held) {
+    if (held) {
+      this->acquire();
+    } else {
+      this->release();
+    }
+  }
+  bool is_held() const { return this->held_; }
+
+ protected:
+  const char *name_;
+  // Created on the first acquire, so locks declared by idle components cost nothing
+  esp_pm_lock_handle_t handle_{nullptr};
+  bool held_{false};
+};
+
+/// Runs the CPU between two frequencies with esp_pm, the maximum one while any PerformanceLock is held.
+class PowerManagement : public PollingComponent {
+ public:
+  PowerManagement();
+
+  void setup() override;
+  void dump_config() override;
+  void update() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  void set_max_frequency_mhz(int max_frequency_mhz) { this->max_frequency_mhz_ = max_frequency_mhz; }
+  void set_min_frequency_mhz(int min_frequency_mhz) { this->min_frequency_mhz_ = min_frequency_mhz; }
+  /// Let ESP-IDF light sleep while the CPU sits idle at the minimum frequency.
+  void set_light_sleep(bool light_sleep) { this->light_sleep_ = light_sleep; }
+#ifdef USE_SENSOR
+  /// Share of the time since the last update spent at the maximum frequency, in percent.
+  void set_max_frequency_residency_sensor(sensor::Sensor *sensor) { this->max_frequency_residency_sensor_ = sensor; }
+#endif
+
+  /// Bookkeeping of the residency, called by PerformanceLock.
+  void on_lock_acquired();
+  void on_lock_released();
+
+ protected:
+  /// Time spent at the maximum frequency since the last update, in ms.
+  uint32_t take_max_frequency_time_(uint32_t now);
+
+  int max_frequency_mhz_;
+  int min_frequency_mhz_;
+  bool light_sleep_{false};
+  uint16_t held_locks_{0};
+  uint32_t held_since_{0};
+  uint32_t max_frequency_ms_{0};
+  uint32_t last_update_{0};
+#ifdef USE_OTA
+  PerformanceLock ota_lock_{"ota"};
+#endif
+#ifdef USE_SENSOR
+  sensor::Sensor *max_frequency_residency_sensor_{nullptr};
+#endif
+};
+
+extern PowerManagement *global_power_management;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace power_management
+}  // namespace esphome
+
+#endif  // USE_POWER_MANAGEMENT
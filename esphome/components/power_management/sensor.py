@@ -0,0 +1,33 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_PERCENT,
+)
+
+from . import CONF_POWER_MANAGEMENT_ID, PowerManagement
+
+DEPENDENCIES = ["power_management"]
+
+CONF_MAX_FREQUENCY_RESIDENCY = "max_frequency_residency"
+
+CONFIG_SCHEMA = {
+    cv.GenerateID(CONF_POWER_MANAGEMENT_ID): cv.use_id(PowerManagement),
+    cv.Optional(CONF_MAX_FREQUENCY_RESIDENCY): sensor.sensor_schema(
+        unit_of_measurement=UNIT_PERCENT,
+        icon="mdi:speedometer",
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+}
+
+
+async def to_code(config):
+    power_management = await cg.get_variable(config[CONF_POWER_MANAGEMENT_ID])
+
+    if residency_conf := config.get(CONF_MAX_FREQUENCY_RESIDENCY):
+        sens = await sensor.new_sensor(residency_conf)
+        cg.add(power_management.set_max_frequency_residency_sensor(sens))
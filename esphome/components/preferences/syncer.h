@@ -11,14 +11,14 @@ class IntervalSyncer : public Component {
   void set_write_interval(uint32_t write_interval) { this->write_interval_ = write_interval; }
   void setup() override {
     if (this->write_interval_ != 0) {
-      set_interval(this->write_interval_, []() { global_preferences->sync(); });
+      set_interval(this->write_interval_, []() { global_preferences->sync_async(); });
       // When using interval-based syncing, we don't need the loop
       this->disable_loop();
     }
   }
   void loop() override {
     if (this->write_interval_ == 0) {
-      global_preferences->sync();
+      global_preferences->sync_async();
     }
   }
   void on_shutdown() override { global_preferences->sync(); }
@@ -7,6 +7,8 @@ from esphome.cpp_types import EntityBase
 
 AUTO_LOAD = ["web_server_base"]
 
+CONF_PROTOBUF = "protobuf"
+
 prometheus_ns = cg.esphome_ns.namespace("prometheus")
 PrometheusHandler = prometheus_ns.class_("PrometheusHandler", cg.Component)
 
@@ -25,6 +27,10 @@ CONFIG_SCHEMA = cv.Schema(
             web_server_base.WebServerBase
         ),
         cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+        # Needs the request headers of the ESP-IDF web server to negotiate the format
+        cv.SplitDefault(CONF_PROTOBUF, esp32=False): cv.All(
+            cv.boolean, cv.only_on_esp32
+        ),
         cv.Optional(CONF_RELABEL, default={}): cv.Schema(
             {
                 cv.use_id(EntityBase): CUSTOMIZED_ENTITY,
@@ -43,6 +49,8 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if config.get(CONF_PROTOBUF):
+        cg.add_define("USE_PROMETHEUS_PROTOBUF")
 
     for key, value in config[CONF_RELABEL].items():
         entity = await cg.get_variable(key)
@@ -0,0 +1,231 @@
+#include "metric_writer.h"
+#ifdef USE_NETWORK
+#include <cinttypes>
+#include <cstdio>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace prometheus {
+
+#ifdef USE_PROMETHEUS_PROTOBUF
+// Protobuf wire types
+static const uint8_t WIRE_VARINT = 0;
+static const uint8_t WIRE_FIXED64 = 1;
+static const uint8_t WIRE_LENGTH_DELIMITED = 2;
+
+static void encode_varint(std::string &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+static void encode_tag(std::string &out, uint32_t field, uint8_t wire_type) {
+  encode_varint(out, (field << 3) | wire_type);
+}
+
+static void encode_bytes(std::string &out, uint32_t field, const char *data, size_t len) {
+  encode_tag(out, field, WIRE_LENGTH_DELIMITED);
+  encode_varint(out, len);
+  out.append(data, len);
+}
+
+static void encode_double(std::string &out, uint32_t field, double value) {
+  encode_tag(out, field, WIRE_FIXED64);
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; i++) {
+    out.push_back(static_cast<char>(bits & 0xFF));
+    bits >>= 8;
+  }
+}
+
+static size_t varint_size(uint64_t value) {
+  size_t size = 1;
+  for (; value >= 0x80; value >>= 7)
+    size++;
+  return size;
+}
+
+/// Append a Metric.label field.
+static void encode_label(std::string &out, const char *name, size_t name_len, const char *value, size_t value_len) {
+  // LabelPair.name and LabelPair.value, each with a one byte tag
+  encode_tag(out, 1, WIRE_LENGTH_DELIMITED);
+  encode_varint(out, 2 + varint_size(name_len) + name_len + varint_size(value_len) + value_len);
+  encode_bytes(out, 1, name, name_len);
+  encode_bytes(out, 2, value, value_len);
+}
+#endif
+
+void MetricLabels::add(const char *name, const char *value, size_t len) {
+  if (!this->text_.empty())
+    this->text_ += ',';
+  this->text_ += name;
+  this->text_ += "=\"";
+  this->text_.append(value, len);
+  this->text_ += '"';
+#ifdef USE_PROMETHEUS_PROTOBUF
+  encode_label(this->encoded_, name, strlen(name), value, len);
+#endif
+}
+
+void MetricLabels::append(const MetricLabels &other) {
+  if (!this->text_.empty() && !other.text_.empty())
+    this->text_ += ',';
+  this->text_ += other.text_;
+#ifdef USE_PROMETHEUS_PROTOBUF
+  this->encoded_ += other.encoded_;
+#endif
+}
+
+void MetricWriter::family(const char *name, MetricType type) {
+#ifdef USE_PROMETHEUS_PROTOBUF
+  if (this->protobuf_) {
+    this->families_.push_back({name, type});
+    return;
+  }
+#endif
+  this->stream_->print(ESPHOME_F("#TYPE "));
+  this->stream_->print(name);
+  if (type == METRIC_TYPE_HISTOGRAM) {
+    this->stream_->print(ESPHOME_F(" histogram\n"));
+  } else {
+    this->stream_->print(ESPHOME_F(" gauge\n"));
+  }
+}
+
+void MetricWriter::sample(const char *name, const MetricLabels &labels, std::initializer_list<MetricLabel> extra,
+                          float value, int8_t accuracy_decimals) {
+#ifdef USE_PROMETHEUS_PROTOBUF
+  if (this->protobuf_) {
+    if (!this->is_current_(name))
+      return;
+    this->scratch_.clear();
+    encode_double(this->scratch_, 1, value);
+    // Metric.gauge
+    this->add_metric_(labels, extra, 2, this->scratch_);
+    return;
+  }
+#endif
+  this->stream_->print(name);
+  this->stream_->print(ESPHOME_F("{"));
+  this->stream_->print(labels.text().c_str());
+  bool first = labels.text().empty();
+  for (const MetricLabel &label : extra) {
+    if (!first)
+      this->stream_->print(ESPHOME_F(","));
+    first = false;
+    this->stream_->print(label.name);
+    this->stream_->print(ESPHOME_F("=\""));
+    this->stream_->print(label.value);
+    this->stream_->print(ESPHOME_F("\""));
+  }
+  this->stream_->print(ESPHOME_F("} "));
+  if (accuracy_decimals >= 0) {
+    this->stream_->print(value_accuracy_to_string(value, accuracy_decimals).c_str());
+  } else {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%.7g", value);
+    this->stream_->print(buf);
+  }
+  this->stream_->print(ESPHOME_F("\n"));
+}
+
+void MetricWriter::histogram(const char *name, const MetricLabels &labels, const uint32_t *bounds,
+                             const uint32_t *counts, size_t bucket_count, uint64_t count, double sum) {
+#ifdef USE_PROMETHEUS_PROTOBUF
+  if (this->protobuf_) {
+    if (!this->is_current_(name))
+      return;
+    this->scratch_.clear();
+    encode_tag(this->scratch_, 1, WIRE_VARINT);
+    encode_varint(this->scratch_, count);
+    encode_double(this->scratch_, 2, sum);
+    std::string bucket;
+    for (size_t i = 0; i < bucket_count; i++) {
+      bucket.clear();
+      encode_tag(bucket, 1, WIRE_VARINT);
+      encode_varint(bucket, counts[i]);
+      encode_double(bucket, 2, bounds[i]);
+      encode_bytes(this->scratch_, 3, bucket.data(), bucket.size());
+    }
+    // Metric.histogram
+    this->add_metric_(labels, {}, 7, this->scratch_);
+    return;
+  }
+#endif
+  const char *separator = labels.text().empty() ? "" : ",";
+  char buf[32];
+  for (size_t i = 0; i <= bucket_count; i++) {
+    this->stream_->print(name);
+    this->stream_->print(ESPHOME_F("_bucket{"));
+    this->stream_->print(labels.text().c_str());
+    this->stream_->print(separator);
+    if (i < bucket_count) {
+      snprintf(buf, sizeof(buf), "le=\"%" PRIu32 "\"} %" PRIu32 "\n", bounds[i], counts[i]);
+    } else {
+      snprintf(buf, sizeof(buf), "le=\"+Inf\"} %" PRIu64 "\n", count);
+    }
+    this->stream_->print(buf);
+  }
+  this->stream_->print(name);
+  this->stream_->print(ESPHOME_F("_sum{"));
+  this->stream_->print(labels.text().c_str());
+  snprintf(buf, sizeof(buf), "} %.3f\n", sum);
+  this->stream_->print(buf);
+  this->stream_->print(name);
+  this->stream_->print(ESPHOME_F("_count{"));
+  this->stream_->print(labels.text().c_str());
+  snprintf(buf, sizeof(buf), "} %" PRIu64 "\n", count);
+  this->stream_->print(buf);
+}
+
+bool MetricWriter::next_family() {
+#ifdef USE_PROMETHEUS_PROTOBUF
+  if (!this->protobuf_ || this->families_.empty())
+    return false;
+  const Family &family = this->families_.front();
+  if (!this->metrics_.empty()) {
+    this->scratch_.clear();
+    encode_bytes(this->scratch_, 1, family.name, strlen(family.name));
+    encode_tag(this->scratch_, 3, WIRE_VARINT);
+    encode_varint(this->scratch_, family.type);
+    std::string length;
+    encode_varint(length, this->scratch_.size() + this->metrics_.size());
+    this->write_(length);
+    this->write_(this->scratch_);
+    this->write_(this->metrics_);
+    this->metrics_.clear();
+  }
+  this->families_.erase(this->families_.begin());
+  return !this->families_.empty();
+#else
+  return false;
+#endif
+}
+
+#ifdef USE_PROMETHEUS_PROTOBUF
+void MetricWriter::write_(const std::string &data) {
+  this->stream_->write(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+}
+
+bool MetricWriter::is_current_(const char *name) const {
+  return !this->families_.empty() && strcmp(this->families_.front().name, name) == 0;
+}
+
+void MetricWriter::add_metric_(const MetricLabels &labels, std::initializer_list<MetricLabel> extra, uint32_t field,
+                               const std::string &value) {
+  this->metric_ = labels.encoded();
+  for (const MetricLabel &label : extra)
+    encode_label(this->metric_, label.name, strlen(label.name), label.value, strlen(label.value));
+  encode_bytes(this->metric_, field, value.data(), value.size());
+  // MetricFamily.metric
+  encode_bytes(this->metrics_, 4, this->metric_.data(), this->metric_.size());
+}
+#endif
+
+}  // namespace prometheus
+}  // namespace esphome
+#endif
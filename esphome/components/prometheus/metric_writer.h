@@ -0,0 +1,122 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "esphome/components/web_server_base/web_server_base.h"
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace prometheus {
+
+#ifdef USE_PROMETHEUS_PROTOBUF
+/// Content type of the delimited protobuf exposition, as sent by Prometheus in the Accept header when it prefers it.
+static const char *const PROTOBUF_CONTENT_TYPE =
+    "application/vnd.google.protobuf; proto=io.prometheus.client.MetricFamily; encoding=delimited";
+#endif
+
+/// io.prometheus.client.MetricType of a family.
+enum MetricType : uint8_t {
+  METRIC_TYPE_GAUGE = 1,
+  METRIC_TYPE_HISTOGRAM = 4,
+};
+
+/// A label written next to a label block, the value is written as is.
+struct MetricLabel {
+  const char *name;
+  const char *value;
+};
+
+/// Label pairs shared by several samples, kept ready to write in both formats.
+class MetricLabels {
+ public:
+  void add(const char *name, const char *value, size_t len);
+  void add(const char *name, const char *value) { this->add(name, value, strlen(value)); }
+  void add(const char *name, const std::string &value) { this->add(name, value.data(), value.size()); }
+  void add(const char *name, StringRef value) { this->add(name, value.c_str(), value.size()); }
+  /// Add all pairs of other after the ones already here.
+  void append(const MetricLabels &other);
+
+  /// name="value" pairs separated by commas, as written between the braces of the text format.
+  const std::string &text() const { return this->text_; }
+#ifdef USE_PROMETHEUS_PROTOBUF
+  /// The same pairs as Metric.label fields.
+  const std::string &encoded() const { return this->encoded_; }
+#endif
+
+ protected:
+  std::string text_;
+#ifdef USE_PROMETHEUS_PROTOBUF
+  std::string encoded_;
+#endif
+};
+
+/** Writes the exposition to the response, as text or as delimited io.prometheus.client.MetricFamily messages.
+ *
+ * Families are declared with family() before their samples. The text format writes every sample right away. A
+ * protobuf message holds all samples of one family, while the rows of an entity type interleave the samples of
+ * several families; so the protobuf format keeps the samples of the first declared family only and the rows are
+ * written again for every further family, as long as next_family() returns true:
+ *
+ *   do {
+ *     ...rows...
+ *   } while (writer->next_family());
+ *
+ * Only the samples of one family are held in RAM at a time, the response is streamed like the text format.
+ */
+class MetricWriter {
+ public:
+  explicit MetricWriter(AsyncResponseStream *stream) : stream_(stream) {}
+#ifdef USE_PROMETHEUS_PROTOBUF
+  MetricWriter(AsyncResponseStream *stream, bool protobuf) : stream_(stream), protobuf_(protobuf) {}
+#endif
+
+  void family(const char *name, MetricType type);
+
+  /// Write a gauge sample, the text format rounds the value to accuracy_decimals when not negative.
+  void sample(const char *name, const MetricLabels &labels, std::initializer_list<MetricLabel> extra, float value,
+              int8_t accuracy_decimals = -1);
+  void sample(const char *name, const MetricLabels &labels, float value, int8_t accuracy_decimals = -1) {
+    this->sample(name, labels, {}, value, accuracy_decimals);
+  }
+
+  /// Write the buckets, sum and count of a histogram, counts are cumulative per bucket and count is the +Inf bucket.
+  void histogram(const char *name, const MetricLabels &labels, const uint32_t *bounds, const uint32_t *counts,
+                 size_t bucket_count, uint64_t count, double sum);
+
+  /// Finish the family written by the last pass over the rows.
+  /// @return true if another declared family needs a pass over the same rows.
+  bool next_family();
+
+ protected:
+  AsyncResponseStream *stream_;
+#ifdef USE_PROMETHEUS_PROTOBUF
+  struct Family {
+    const char *name;
+    MetricType type;
+  };
+
+  void write_(const std::string &data);
+  /// Whether the sample belongs to the family of the current pass.
+  bool is_current_(const char *name) const;
+  /// Add a Metric message to the current family.
+  void add_metric_(const MetricLabels &labels, std::initializer_list<MetricLabel> extra, uint32_t field,
+                   const std::string &value);
+
+  bool protobuf_{false};
+  // Declared families not written yet, the front one is filled by the current pass
+  std::vector<Family> families_;
+  // Encoded MetricFamily.metric fields of the current family
+  std::string metrics_;
+  std::string metric_;
+  std::string scratch_;
+#endif
+};
+
+}  // namespace prometheus
+}  // namespace esphome
+#endif
@@ -1,1000 +1,715 @@
 #include "prometheus_handler.h"
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
+#ifdef USE_RUNTIME_STATS
+#include "esphome/components/runtime_stats/runtime_stats.h"
+#endif
 
 namespace esphome {
 namespace prometheus {
 
+#ifdef USE_ESP32
+// Send the body in pieces of about one TCP segment instead of holding the whole exposition in RAM
+static const size_t PROMETHEUS_CHUNK_SIZE = 1460;
+#endif
+
 void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+#ifdef USE_PROMETHEUS_PROTOBUF
+  const bool protobuf = this->protobuf_requested_(req);
+  AsyncResponseStream *stream =
+      req->beginResponseStream(protobuf ? PROTOBUF_CONTENT_TYPE : "text/plain; version=0.0.4; charset=utf-8");
+  MetricWriter writer(stream, protobuf);
+#else
   AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
-  std::string area = App.get_area();
-  std::string node = App.get_name();
-  std::string friendly_name = App.get_friendly_name();
+  MetricWriter writer(stream);
+#endif
+#ifdef USE_ESP32
+  stream->set_chunk_size(PROMETHEUS_CHUNK_SIZE);
+#endif
+  this->write_metrics_(&writer);
+  req->send(stream);
+  this->clear_relabel_maps_();
+}
+
+#ifdef USE_PROMETHEUS_PROTOBUF
+bool PrometheusHandler::protobuf_requested_(AsyncWebServerRequest *req) {
+  auto accept = req->get_header("Accept");
+  return accept.has_value() && accept->find("application/vnd.google.protobuf") != std::string::npos;
+}
+#endif
+
+void PrometheusHandler::clear_relabel_maps_() {
+  // Only needed to build the label blocks, which are all cached after the first scrape
+  this->relabel_map_id_.clear();
+  this->relabel_map_name_.clear();
+}
+
+void PrometheusHandler::write_metrics_(MetricWriter *stream) {
+  // Entities are fixed once set up, so the running index names the same entity on every scrape
+  size_t index = 0;
+  // Writes the rows of one entity type once per family the protobuf format still waits for, see MetricWriter
+  auto rows = [this, stream, &index](const auto &objs, auto row) {
+    do {
+      size_t i = index;
+      for (auto *obj : objs)
+        (this->*row)(stream, obj, this->labels_for_(obj, i++));
+    } while (stream->next_family());
+    index += objs.size();
+  };
 
 #ifdef USE_SENSOR
   this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_sensors(), &PrometheusHandler::sensor_row_);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   this->binary_sensor_type_(stream);
-  for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_binary_sensors(), &PrometheusHandler::binary_sensor_row_);
 #endif
 
 #ifdef USE_FAN
   this->fan_type_(stream);
-  for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_fans(), &PrometheusHandler::fan_row_);
 #endif
 
 #ifdef USE_LIGHT
   this->light_type_(stream);
-  for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_lights(), &PrometheusHandler::light_row_);
 #endif
 
 #ifdef USE_COVER
   this->cover_type_(stream);
-  for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_covers(), &PrometheusHandler::cover_row_);
 #endif
 
 #ifdef USE_SWITCH
   this->switch_type_(stream);
-  for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_switches(), &PrometheusHandler::switch_row_);
 #endif
 
 #ifdef USE_LOCK
   this->lock_type_(stream);
-  for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_locks(), &PrometheusHandler::lock_row_);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   this->text_sensor_type_(stream);
-  for (auto *obj : App.get_text_sensors())
-    this->text_sensor_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_text_sensors(), &PrometheusHandler::text_sensor_row_);
 #endif
 
 #ifdef USE_NUMBER
   this->number_type_(stream);
-  for (auto *obj : App.get_numbers())
-    this->number_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_numbers(), &PrometheusHandler::number_row_);
 #endif
 
 #ifdef USE_SELECT
   this->select_type_(stream);
-  for (auto *obj : App.get_selects())
-    this->select_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_selects(), &PrometheusHandler::select_row_);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   this->media_player_type_(stream);
-  for (auto *obj : App.get_media_players())
-    this->media_player_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_media_players(), &PrometheusHandler::media_player_row_);
 #endif
 
 #ifdef USE_UPDATE
   this->update_entity_type_(stream);
-  for (auto *obj : App.get_updates())
-    this->update_entity_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_updates(), &PrometheusHandler::update_entity_row_);
 #endif
 
 #ifdef USE_VALVE
   this->valve_type_(stream);
-  for (auto *obj : App.get_valves())
-    this->valve_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_valves(), &PrometheusHandler::valve_row_);
 #endif
 
 #ifdef USE_CLIMATE
   this->climate_type_(stream);
-  for (auto *obj : App.get_climates())
-    this->climate_row_(stream, obj, area, node, friendly_name);
+  rows(App.get_climates(), &PrometheusHandler::climate_row_);
 #endif
 
-  req->send(stream);
+#ifdef USE_RUNTIME_STATS
+  this->component_loop_time_rows_(stream);
+#endif
+#ifdef USE_RUNTIME_STATS_PROFILER
+  this->component_profile_rows_(stream);
+#endif
+  this->scheduler_queue_depth_rows_(stream);
 }
 
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
+StringRef PrometheusHandler::relabel_id_(EntityBase *obj) {
   auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+  return item == relabel_map_id_.end() ? obj->get_object_id_ref() : StringRef(item->second);
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
+StringRef PrometheusHandler::relabel_name_(EntityBase *obj) {
   auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+  return item == relabel_map_name_.end() ? obj->get_name() : StringRef(item->second);
+}
+
+const MetricLabels &PrometheusHandler::labels_for_(EntityBase *obj, size_t index) {
+  if (index < this->labels_.size())
+    return this->labels_[index];
+
+  // Skipped rows keep an empty slot so the indices of later entities stay the same
+  MetricLabels labels;
+  if (!obj->is_internal() || this->include_internal_) {
+    labels.add("id", relabel_id_(obj));
+    const char *area = App.get_area();
+    if (*area != '\0')
+      labels.add("area", area);
+    const std::string &node = App.get_name();
+    if (!node.empty())
+      labels.add("node", node);
+    const std::string &friendly_name = App.get_friendly_name();
+    if (!friendly_name.empty())
+      labels.add("friendly_name", friendly_name);
+    labels.add("name", relabel_name_(obj));
+  }
+  this->labels_.push_back(std::move(labels));
+  return this->labels_.back();
 }
 
-void PrometheusHandler::add_area_label_(AsyncResponseStream *stream, std::string &area) {
-  if (!area.empty()) {
-    stream->print(ESPHOME_F("\",area=\""));
-    stream->print(area.c_str());
+// Type-specific implementation
+MetricLabels PrometheusHandler::device_labels_() {
+  MetricLabels labels;
+  const char *area = App.get_area();
+  if (*area != '\0')
+    labels.add("area", area);
+  const std::string &node = App.get_name();
+  if (!node.empty())
+    labels.add("node", node);
+  const std::string &friendly_name = App.get_friendly_name();
+  if (!friendly_name.empty())
+    labels.add("friendly_name", friendly_name);
+  return labels;
+}
+
+#ifdef USE_RUNTIME_STATS
+void PrometheusHandler::component_loop_time_rows_(MetricWriter *stream) {
+  if (global_runtime_stats == nullptr)
+    return;
+  // Instances of the same component share their source name, their loop calls are summed into one series
+  struct LoopTimeSeries {
+    std::string source;
+    uint32_t buckets[runtime_stats::LOOP_TIME_BUCKET_COUNT];
+    uint64_t count;
+    double sum_ms;
+  };
+  std::vector<LoopTimeSeries> series;
+  char source[48];
+  for (const auto &it : global_runtime_stats->get_component_stats()) {
+    const runtime_stats::ComponentRuntimeStats &stats = it.second;
+    // On ESP8266 the source name lives in flash
+    ESPHOME_strncpy_P(source, LOG_STR_ARG(it.first->get_component_log_str()), sizeof(source) - 1);
+    source[sizeof(source) - 1] = '\0';
+    LoopTimeSeries *entry = nullptr;
+    for (auto &s : series) {
+      if (s.source == source) {
+        entry = &s;
+        break;
+      }
+    }
+    if (entry == nullptr) {
+      series.push_back({source, {}, 0, 0.0});
+      entry = &series.back();
+    }
+    for (size_t i = 0; i < runtime_stats::LOOP_TIME_BUCKET_COUNT; i++)
+      entry->buckets[i] += stats.get_total_bucket_count(i);
+    entry->count += stats.get_total_count();
+    entry->sum_ms += stats.get_total_time_ms();
   }
+  if (series.empty())
+    return;
+
+  static const char *const NAME = "esphome_component_loop_time_ms";
+  stream->family(NAME, METRIC_TYPE_HISTOGRAM);
+  const MetricLabels device_labels = this->device_labels_();
+  do {
+    for (const auto &s : series) {
+      MetricLabels labels;
+      labels.add("component", s.source);
+      labels.append(device_labels);
+      stream->histogram(NAME, labels, runtime_stats::LOOP_TIME_BUCKET_BOUNDS_MS, s.buckets,
+                        runtime_stats::LOOP_TIME_BUCKET_COUNT, s.count, s.sum_ms);
+    }
+  } while (stream->next_family());
 }
+#endif
 
-void PrometheusHandler::add_node_label_(AsyncResponseStream *stream, std::string &node) {
-  if (!node.empty()) {
-    stream->print(ESPHOME_F("\",node=\""));
-    stream->print(node.c_str());
+#ifdef USE_RUNTIME_STATS_PROFILER
+namespace {
+// Like the loop time series, profiles of instances with the same labels are summed into one series
+struct ProfileSeries {
+  std::string component;
+  const char *callback;
+  uint32_t buckets[runtime_stats::PROFILE_BUCKET_COUNT];
+  uint64_t count;
+  uint64_t sum_us;
+};
+
+void add_profile(std::vector<ProfileSeries> &series, const char *component, const char *callback,
+                 const runtime_stats::RuntimeProfile &profile) {
+  ProfileSeries *entry = nullptr;
+  for (auto &s : series) {
+    // Loop profiles have no callback
+    const bool same_callback =
+        s.callback == nullptr || callback == nullptr ? s.callback == callback : strcmp(s.callback, callback) == 0;
+    if (same_callback && s.component == component) {
+      entry = &s;
+      break;
+    }
+  }
+  if (entry == nullptr) {
+    series.push_back({component, callback, {}, 0, 0});
+    entry = &series.back();
   }
+  for (size_t i = 0; i < runtime_stats::PROFILE_BUCKET_COUNT; i++)
+    entry->buckets[i] += profile.get_bucket_count(i);
+  entry->count += profile.get_count();
+  entry->sum_us += profile.get_sum_us();
 }
+}  // namespace
 
-void PrometheusHandler::add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name) {
-  if (!friendly_name.empty()) {
-    stream->print(ESPHOME_F("\",friendly_name=\""));
-    stream->print(friendly_name.c_str());
+void PrometheusHandler::component_profile_rows_(MetricWriter *stream) {
+  if (global_runtime_stats == nullptr)
+    return;
+  char source[48];
+  auto source_name = [&source](Component *component) {
+    // On ESP8266 the source name lives in flash
+    ESPHOME_strncpy_P(source, LOG_STR_ARG(component->get_component_log_str()), sizeof(source) - 1);
+    source[sizeof(source) - 1] = '\0';
+    return source;
+  };
+
+  std::vector<ProfileSeries> loops;
+  for (const auto &it : global_runtime_stats->get_loop_profiles())
+    add_profile(loops, source_name(it.first), nullptr, it.second);
+  std::vector<ProfileSeries> callbacks;
+  for (const auto &it : global_runtime_stats->get_callback_profiles())
+    add_profile(callbacks, source_name(it.component), it.name.c_str(), it.profile);
+
+  const MetricLabels device_labels = this->device_labels_();
+  const std::pair<const char *, const std::vector<ProfileSeries> *> families[] = {
+      {"esphome_component_loop_time_us", &loops}, {"esphome_scheduler_callback_time_us", &callbacks}};
+  for (const auto &family : families) {
+    if (family.second->empty())
+      continue;
+    stream->family(family.first, METRIC_TYPE_HISTOGRAM);
+    do {
+      for (const auto &s : *family.second) {
+        MetricLabels labels;
+        labels.add("component", s.component);
+        if (s.callback != nullptr)
+          labels.add("callback", s.callback);
+        labels.append(device_labels);
+        stream->histogram(family.first, labels, runtime_stats::PROFILE_BUCKET_BOUNDS_US, s.buckets,
+                          runtime_stats::PROFILE_BUCKET_COUNT, s.count, static_cast<double>(s.sum_us));
+      }
+    } while (stream->next_family());
   }
 }
+#endif
+
+void PrometheusHandler::scheduler_queue_depth_rows_(MetricWriter *stream) {
+  const Scheduler::QueueDepths depths = App.scheduler.get_queue_depths();
+  const MetricLabels device_labels = this->device_labels_();
+  const std::pair<const char *, size_t> queues[] = {
+      {"timers", depths.timers}, {"to_add", depths.to_add}, {"pooled", depths.pooled}};
+  stream->family("esphome_scheduler_queue_depth", METRIC_TYPE_GAUGE);
+  do {
+    for (const auto &queue : queues)
+      stream->sample("esphome_scheduler_queue_depth", device_labels, {{"queue", queue.first}}, queue.second);
+  } while (stream->next_family());
+}
 
-// Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_sensor_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_sensor_failed gauge\n"));
+void PrometheusHandler::sensor_type_(MetricWriter *stream) {
+  stream->family("esphome_sensor_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_sensor_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::sensor_row_(MetricWriter *stream, sensor::Sensor *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_sensor_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_sensor_value", labels, {{"unit", obj->get_unit_of_measurement_ref().c_str()}}, obj->state,
+                   obj->get_accuracy_decimals());
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_sensor_failed", labels, 1);
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_binary_sensor_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_binary_sensor_failed gauge\n"));
+void PrometheusHandler::binary_sensor_type_(MetricWriter *stream) {
+  stream->family("esphome_binary_sensor_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_binary_sensor_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj,
-                                           std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::binary_sensor_row_(MetricWriter *stream, binary_sensor::BinarySensor *obj,
+                                           const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_binary_sensor_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->state);
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_binary_sensor_value", labels, obj->state);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_binary_sensor_failed", labels, 1);
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_fan_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_fan_failed gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_fan_speed gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_fan_oscillation gauge\n"));
-}
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                                 std::string &friendly_name) {
+void PrometheusHandler::fan_type_(MetricWriter *stream) {
+  stream->family("esphome_fan_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_fan_failed", METRIC_TYPE_GAUGE);
+  stream->family("esphome_fan_speed", METRIC_TYPE_GAUGE);
+  stream->family("esphome_fan_oscillation", METRIC_TYPE_GAUGE);
+}
+void PrometheusHandler::fan_row_(MetricWriter *stream, fan::Fan *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(ESPHOME_F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} 0\n"));
+  stream->sample("esphome_fan_failed", labels, 0);
   // Data itself
-  stream->print(ESPHOME_F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(obj->state);
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_fan_value", labels, obj->state);
   // Speed if available
-  if (obj->get_traits().supports_speed()) {
-    stream->print(ESPHOME_F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->speed);
-    stream->print(ESPHOME_F("\n"));
-  }
+  if (obj->get_traits().supports_speed())
+    stream->sample("esphome_fan_speed", labels, obj->speed);
   // Oscillation if available
-  if (obj->get_traits().supports_oscillation()) {
-    stream->print(ESPHOME_F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print(ESPHOME_F("\n"));
-  }
+  if (obj->get_traits().supports_oscillation())
+    stream->sample("esphome_fan_oscillation", labels, obj->oscillating);
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_light_state gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_light_color gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_light_effect_active gauge\n"));
+void PrometheusHandler::light_type_(MetricWriter *stream) {
+  stream->family("esphome_light_state", METRIC_TYPE_GAUGE);
+  stream->family("esphome_light_color", METRIC_TYPE_GAUGE);
+  stream->family("esphome_light_effect_active", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area,
-                                   std::string &node, std::string &friendly_name) {
+void PrometheusHandler::light_row_(MetricWriter *stream, light::LightState *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // State
-  stream->print(ESPHOME_F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_light_state", labels, obj->remote_values.is_on());
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(ESPHOME_F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_light_color", labels, {{"channel", "brightness"}}, brightness);
+  stream->sample("esphome_light_color", labels, {{"channel", "r"}}, r);
+  stream->sample("esphome_light_color", labels, {{"channel", "g"}}, g);
+  stream->sample("esphome_light_color", labels, {{"channel", "b"}}, b);
+  stream->sample("esphome_light_color", labels, {{"channel", "w"}}, w);
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(ESPHOME_F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",effect=\"None\"} 0\n"));
+    stream->sample("esphome_light_effect_active", labels, {{"effect", "None"}}, 0);
   } else {
-    stream->print(ESPHOME_F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_light_effect_active", labels, {{"effect", effect.c_str()}}, 1);
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_cover_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_cover_failed gauge\n"));
+void PrometheusHandler::cover_type_(MetricWriter *stream) {
+  stream->family("esphome_cover_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_cover_failed", METRIC_TYPE_GAUGE);
+  stream->family("esphome_cover_tilt", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::cover_row_(MetricWriter *stream, cover::Cover *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_cover_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->position);
-    stream->print(ESPHOME_F("\n"));
-    if (obj->get_traits().get_supports_tilt()) {
-      stream->print(ESPHOME_F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      add_area_label_(stream, area);
-      add_node_label_(stream, node);
-      add_friendly_name_label_(stream, friendly_name);
-      stream->print(ESPHOME_F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(ESPHOME_F("\"} "));
-      stream->print(obj->tilt);
-      stream->print(ESPHOME_F("\n"));
-    }
+    stream->sample("esphome_cover_value", labels, obj->position);
+    if (obj->get_traits().get_supports_tilt())
+      stream->sample("esphome_cover_tilt", labels, obj->tilt);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_cover_failed", labels, 1);
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_switch_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_switch_failed gauge\n"));
+void PrometheusHandler::switch_type_(MetricWriter *stream) {
+  stream->family("esphome_switch_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_switch_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::switch_row_(MetricWriter *stream, switch_::Switch *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(ESPHOME_F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} 0\n"));
+  stream->sample("esphome_switch_failed", labels, 0);
   // Data itself
-  stream->print(ESPHOME_F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(obj->state);
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_switch_value", labels, obj->state);
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_lock_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_lock_failed gauge\n"));
+void PrometheusHandler::lock_type_(MetricWriter *stream) {
+  stream->family("esphome_lock_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_lock_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                                  std::string &friendly_name) {
+void PrometheusHandler::lock_row_(MetricWriter *stream, lock::Lock *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(ESPHOME_F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} 0\n"));
+  stream->sample("esphome_lock_failed", labels, 0);
   // Data itself
-  stream->print(ESPHOME_F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(obj->state);
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_lock_value", labels, obj->state);
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_TEXT_SENSOR
-void PrometheusHandler::text_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_text_sensor_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_text_sensor_failed gauge\n"));
+void PrometheusHandler::text_sensor_type_(MetricWriter *stream) {
+  stream->family("esphome_text_sensor_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_text_sensor_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area,
-                                         std::string &node, std::string &friendly_name) {
+void PrometheusHandler::text_sensor_row_(MetricWriter *stream, text_sensor::TextSensor *obj,
+                                         const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_text_sensor_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_text_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",value=\""));
-    stream->print(obj->state.c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(ESPHOME_F("1.0"));
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_text_sensor_value", labels, {{"value", obj->state.c_str()}}, 1);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_text_sensor_failed", labels, 1);
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_NUMBER
-void PrometheusHandler::number_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_number_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_number_failed gauge\n"));
+void PrometheusHandler::number_type_(MetricWriter *stream) {
+  stream->family("esphome_number_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_number_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::number_row_(MetricWriter *stream, number::Number *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_number_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_number_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->state);
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_number_value", labels, obj->state);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_number_failed", labels, 1);
   }
 }
 #endif
 
 #ifdef USE_SELECT
-void PrometheusHandler::select_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_select_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_select_failed gauge\n"));
+void PrometheusHandler::select_type_(MetricWriter *stream) {
+  stream->family("esphome_select_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_select_failed", METRIC_TYPE_GAUGE);
 }
-void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::select_row_(MetricWriter *stream, select::Select *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_select_failed", labels, 0);
     // Data itself
-    stream->print(ESPHOME_F("esphome_select_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",value=\""));
-    stream->print(obj->state.c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(ESPHOME_F("1.0"));
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_select_value", labels, {{"value", obj->state.c_str()}}, 1);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_select_failed", labels, 1);
   }
 }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-void PrometheusHandler::media_player_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_media_player_state_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_media_player_volume gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_media_player_is_muted gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_media_player_failed gauge\n"));
-}
-void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj,
-                                          std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::media_player_type_(MetricWriter *stream) {
+  stream->family("esphome_media_player_state_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_media_player_volume", METRIC_TYPE_GAUGE);
+  stream->family("esphome_media_player_is_muted", METRIC_TYPE_GAUGE);
+  stream->family("esphome_media_player_failed", METRIC_TYPE_GAUGE);
+}
+void PrometheusHandler::media_player_row_(MetricWriter *stream, media_player::MediaPlayer *obj,
+                                          const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(ESPHOME_F("esphome_media_player_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} 0\n"));
+  stream->sample("esphome_media_player_failed", labels, 0);
   // Data itself
-  stream->print(ESPHOME_F("esphome_media_player_state_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",value=\""));
-  stream->print(media_player::media_player_state_to_string(obj->state));
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(ESPHOME_F("1.0"));
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_media_player_volume{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(obj->volume);
-  stream->print(ESPHOME_F("\n"));
-  stream->print(ESPHOME_F("esphome_media_player_is_muted{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} "));
-  if (obj->is_muted()) {
-    stream->print(ESPHOME_F("1.0"));
-  } else {
-    stream->print(ESPHOME_F("0.0"));
-  }
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_media_player_state_value", labels,
+                 {{"value", media_player::media_player_state_to_string(obj->state)}}, 1);
+  stream->sample("esphome_media_player_volume", labels, obj->volume);
+  stream->sample("esphome_media_player_is_muted", labels, obj->is_muted());
 }
 #endif
 
 #ifdef USE_UPDATE
-void PrometheusHandler::update_entity_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_update_entity_state gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_update_entity_info gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_update_entity_failed gauge\n"));
+void PrometheusHandler::update_entity_type_(MetricWriter *stream) {
+  stream->family("esphome_update_entity_state", METRIC_TYPE_GAUGE);
+  stream->family("esphome_update_entity_info", METRIC_TYPE_GAUGE);
+  stream->family("esphome_update_entity_failed", METRIC_TYPE_GAUGE);
 }
 
-void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update::UpdateState state) {
+const char *PrometheusHandler::update_state_to_string_(update::UpdateState state) {
   switch (state) {
     case update::UpdateState::UPDATE_STATE_UNKNOWN:
-      stream->print("unknown");
-      break;
+      return "unknown";
     case update::UpdateState::UPDATE_STATE_NO_UPDATE:
-      stream->print("none");
-      break;
+      return "none";
     case update::UpdateState::UPDATE_STATE_AVAILABLE:
-      stream->print("available");
-      break;
+      return "available";
     case update::UpdateState::UPDATE_STATE_INSTALLING:
-      stream->print("installing");
-      break;
+      return "installing";
     default:
-      stream->print("invalid");
-      break;
+      return "invalid";
   }
 }
 
-void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name) {
+void PrometheusHandler::update_entity_row_(MetricWriter *stream, update::UpdateEntity *obj,
+                                           const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(ESPHOME_F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 0\n"));
+    stream->sample("esphome_update_entity_failed", labels, 0);
     // First update state
-    stream->print(ESPHOME_F("esphome_update_entity_state{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",value=\""));
-    handle_update_state_(stream, obj->state);
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(ESPHOME_F("1.0"));
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_update_entity_state", labels, {{"value", update_state_to_string_(obj->state)}}, 1);
     // Next update info
-    stream->print(ESPHOME_F("esphome_update_entity_info{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\",current_version=\""));
-    stream->print(obj->update_info.current_version.c_str());
-    stream->print(ESPHOME_F("\",latest_version=\""));
-    stream->print(obj->update_info.latest_version.c_str());
-    stream->print(ESPHOME_F("\",title=\""));
-    stream->print(obj->update_info.title.c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(ESPHOME_F("1.0"));
-    stream->print(ESPHOME_F("\n"));
+    stream->sample("esphome_update_entity_info", labels,
+                   {{"current_version", obj->update_info.current_version.c_str()},
+                    {"latest_version", obj->update_info.latest_version.c_str()},
+                    {"title", obj->update_info.title.c_str()}},
+                   1);
   } else {
     // Invalid state
-    stream->print(ESPHOME_F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} 1\n"));
+    stream->sample("esphome_update_entity_failed", labels, 1);
   }
 }
 #endif
 
 #ifdef USE_VALVE
-void PrometheusHandler::valve_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_valve_operation gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_valve_failed gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_valve_position gauge\n"));
+void PrometheusHandler::valve_type_(MetricWriter *stream) {
+  stream->family("esphome_valve_operation", METRIC_TYPE_GAUGE);
+  stream->family("esphome_valve_failed", METRIC_TYPE_GAUGE);
+  stream->family("esphome_valve_position", METRIC_TYPE_GAUGE);
 }
 
-void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::valve_row_(MetricWriter *stream, valve::Valve *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(ESPHOME_F("esphome_valve_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\"} 0\n"));
+  stream->sample("esphome_valve_failed", labels, 0);
   // Data itself
-  stream->print(ESPHOME_F("esphome_valve_operation{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",operation=\""));
-  stream->print(valve::valve_operation_to_str(obj->current_operation));
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(ESPHOME_F("1.0"));
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_valve_operation", labels,
+                 {{"operation", valve::valve_operation_to_str(obj->current_operation)}}, 1);
   // Now see if position is supported
-  if (obj->get_traits().get_supports_position()) {
-    stream->print(ESPHOME_F("esphome_valve_position{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(ESPHOME_F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(ESPHOME_F("\"} "));
-    stream->print(obj->position);
-    stream->print(ESPHOME_F("\n"));
-  }
+  if (obj->get_traits().get_supports_position())
+    stream->sample("esphome_valve_position", labels, obj->position);
 }
 #endif
 
 #ifdef USE_CLIMATE
-void PrometheusHandler::climate_type_(AsyncResponseStream *stream) {
-  stream->print(ESPHOME_F("#TYPE esphome_climate_setting gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_climate_value gauge\n"));
-  stream->print(ESPHOME_F("#TYPE esphome_climate_failed gauge\n"));
+void PrometheusHandler::climate_type_(MetricWriter *stream) {
+  stream->family("esphome_climate_setting", METRIC_TYPE_GAUGE);
+  stream->family("esphome_climate_value", METRIC_TYPE_GAUGE);
+  stream->family("esphome_climate_failed", METRIC_TYPE_GAUGE);
 }
 
-void PrometheusHandler::climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                             std::string &node, std::string &friendly_name, std::string &setting,
+void PrometheusHandler::climate_setting_row_(MetricWriter *stream, const MetricLabels &labels, const char *category,
                                              const LogString *setting_value) {
-  stream->print(ESPHOME_F("esphome_climate_setting{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",category=\""));
-  stream->print(setting.c_str());
-  stream->print(ESPHOME_F("\",setting_value=\""));
-  stream->print(LOG_STR_ARG(setting_value));
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(ESPHOME_F("1.0"));
-  stream->print(ESPHOME_F("\n"));
-}
-
-void PrometheusHandler::climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name, std::string &category,
-                                           std::string &climate_value) {
-  stream->print(ESPHOME_F("esphome_climate_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",category=\""));
-  stream->print(category.c_str());
-  stream->print(ESPHOME_F("\"} "));
-  stream->print(climate_value.c_str());
-  stream->print(ESPHOME_F("\n"));
-}
-
-void PrometheusHandler::climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                            std::string &node, std::string &friendly_name, std::string &category,
+  stream->sample("esphome_climate_setting", labels,
+                 {{"category", category}, {"setting_value", LOG_STR_ARG(setting_value)}}, 1);
+}
+
+void PrometheusHandler::climate_value_row_(MetricWriter *stream, const MetricLabels &labels, const char *category,
+                                           float value, int8_t accuracy_decimals) {
+  stream->sample("esphome_climate_value", labels, {{"category", category}}, value, accuracy_decimals);
+}
+
+void PrometheusHandler::climate_failed_row_(MetricWriter *stream, const MetricLabels &labels, const char *category,
                                             bool is_failed_value) {
-  stream->print(ESPHOME_F("esphome_climate_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(ESPHOME_F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(ESPHOME_F("\",category=\""));
-  stream->print(category.c_str());
-  stream->print(ESPHOME_F("\"} "));
-  if (is_failed_value) {
-    stream->print(ESPHOME_F("1.0"));
-  } else {
-    stream->print(ESPHOME_F("0.0"));
-  }
-  stream->print(ESPHOME_F("\n"));
+  stream->sample("esphome_climate_failed", labels, {{"category", category}}, is_failed_value);
 }
 
-void PrometheusHandler::climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area,
-                                     std::string &node, std::string &friendly_name) {
+void PrometheusHandler::climate_row_(MetricWriter *stream, climate::Climate *obj, const MetricLabels &labels) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // Data itself
   bool any_failures = false;
-  std::string climate_mode_category = "mode";
-  const auto *climate_mode_value = climate::climate_mode_to_string(obj->mode);
-  climate_setting_row_(stream, obj, area, node, friendly_name, climate_mode_category, climate_mode_value);
+  climate_setting_row_(stream, labels, "mode", climate::climate_mode_to_string(obj->mode));
   const auto traits = obj->get_traits();
   // Now see if traits is supported
   int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
   int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
   // max temp
-  std::string max_temp = "maximum_temperature";
-  auto max_temp_value = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, max_temp, max_temp_value);
+  climate_value_row_(stream, labels, "maximum_temperature", traits.get_visual_max_temperature(), target_accuracy);
   // max temp
-  std::string min_temp = "mininum_temperature";
-  auto min_temp_value = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-  climate_value_row_(stream, obj, area, node, friendly_name, min_temp, min_temp_value);
+  climate_value_row_(stream, labels, "mininum_temperature", traits.get_visual_min_temperature(), target_accuracy);
   // now check optional traits
   if (traits.get_supports_current_temperature()) {
-    std::string current_temp = "current_temperature";
     if (std::isnan(obj->current_temperature)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, true);
+      climate_failed_row_(stream, labels, "current_temperature", true);
       any_failures = true;
     } else {
-      auto current_temp_value = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_temp, current_temp_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_temp, false);
+      climate_value_row_(stream, labels, "current_temperature", obj->current_temperature, current_accuracy);
+      climate_failed_row_(stream, labels, "current_temperature", false);
     }
   }
   if (traits.get_supports_current_humidity()) {
-    std::string current_humidity = "current_humidity";
     if (std::isnan(obj->current_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, true);
+      climate_failed_row_(stream, labels, "current_humidity", true);
       any_failures = true;
     } else {
-      auto current_humidity_value = value_accuracy_to_string(obj->current_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, current_humidity, current_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, current_humidity, false);
+      climate_value_row_(stream, labels, "current_humidity", obj->current_humidity, 0);
+      climate_failed_row_(stream, labels, "current_humidity", false);
     }
   }
   if (traits.get_supports_target_humidity()) {
-    std::string target_humidity = "target_humidity";
     if (std::isnan(obj->target_humidity)) {
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, true);
+      climate_failed_row_(stream, labels, "target_humidity", true);
       any_failures = true;
     } else {
-      auto target_humidity_value = value_accuracy_to_string(obj->target_humidity, 0);
-      climate_value_row_(stream, obj, area, node, friendly_name, target_humidity, target_humidity_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, target_humidity, false);
+      climate_value_row_(stream, labels, "target_humidity", obj->target_humidity, 0);
+      climate_failed_row_(stream, labels, "target_humidity", false);
     }
   }
   if (traits.get_supports_two_point_target_temperature()) {
-    std::string target_temp_low = "target_temperature_low";
-    auto target_temp_low_value = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_low, target_temp_low_value);
-    std::string target_temp_high = "target_temperature_high";
-    auto target_temp_high_value = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp_high, target_temp_high_value);
+    climate_value_row_(stream, labels, "target_temperature_low", obj->target_temperature_low, target_accuracy);
+    climate_value_row_(stream, labels, "target_temperature_high", obj->target_temperature_high, target_accuracy);
   } else {
-    std::string target_temp = "target_temperature";
-    auto target_temp_value = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-    climate_value_row_(stream, obj, area, node, friendly_name, target_temp, target_temp_value);
-  }
-  if (traits.get_supports_action()) {
-    std::string climate_trait_category = "action";
-    const auto *climate_trait_value = climate::climate_action_to_string(obj->action);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
+    climate_value_row_(stream, labels, "target_temperature", obj->target_temperature, target_accuracy);
   }
+  if (traits.get_supports_action())
+    climate_setting_row_(stream, labels, "action", climate::climate_action_to_string(obj->action));
   if (traits.get_supports_fan_modes()) {
-    std::string climate_trait_category = "fan_mode";
     if (obj->fan_mode.has_value()) {
-      const auto *climate_trait_value = climate::climate_fan_mode_to_string(obj->fan_mode.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, labels, "fan_mode", climate::climate_fan_mode_to_string(obj->fan_mode.value()));
+      climate_failed_row_(stream, labels, "fan_mode", false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, labels, "fan_mode", true);
       any_failures = true;
     }
   }
   if (traits.get_supports_presets()) {
-    std::string climate_trait_category = "preset";
     if (obj->preset.has_value()) {
-      const auto *climate_trait_value = climate::climate_preset_to_string(obj->preset.value());
-      climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, false);
+      climate_setting_row_(stream, labels, "preset", climate::climate_preset_to_string(obj->preset.value()));
+      climate_failed_row_(stream, labels, "preset", false);
     } else {
-      climate_failed_row_(stream, obj, area, node, friendly_name, climate_trait_category, true);
+      climate_failed_row_(stream, labels, "preset", true);
       any_failures = true;
     }
   }
-  if (traits.get_supports_swing_modes()) {
-    std::string climate_trait_category = "swing_mode";
-    const auto *climate_trait_value = climate::climate_swing_mode_to_string(obj->swing_mode);
-    climate_setting_row_(stream, obj, area, node, friendly_name, climate_trait_category, climate_trait_value);
-  }
-  std::string all_climate_category = "all";
-  climate_failed_row_(stream, obj, area, node, friendly_name, all_climate_category, any_failures);
+  if (traits.get_supports_swing_modes())
+    climate_setting_row_(stream, labels, "swing_mode", climate::climate_swing_mode_to_string(obj->swing_mode));
+  climate_failed_row_(stream, labels, "all", any_failures);
 }
 #endif
 
@@ -3,11 +3,13 @@
 #ifdef USE_NETWORK
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
+#include "metric_writer.h"
 #ifdef USE_CLIMATE
 #include "esphome/core/log.h"
 #endif
@@ -61,135 +63,142 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
-  void add_area_label_(AsyncResponseStream *stream, std::string &area);
-  void add_node_label_(AsyncResponseStream *stream, std::string &node);
-  void add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name);
+  StringRef relabel_id_(EntityBase *obj);
+  StringRef relabel_name_(EntityBase *obj);
+  /// The id, area, node, friendly_name and name labels of the index-th entity of a scrape, built on first use.
+  const MetricLabels &labels_for_(EntityBase *obj, size_t index);
+  /// The area, node and friendly_name labels of metrics about the device itself.
+  MetricLabels device_labels_();
+  void clear_relabel_maps_();
+  /// Write every family of the exposition, in the same order for both formats.
+  void write_metrics_(MetricWriter *stream);
+#ifdef USE_PROMETHEUS_PROTOBUF
+  /// Whether the scraper accepts the delimited protobuf format.
+  bool protobuf_requested_(AsyncWebServerRequest *req);
+#endif
+
+#ifdef USE_RUNTIME_STATS
+  /// Loop time histogram of every component source, from the runtime_stats collector
+  void component_loop_time_rows_(MetricWriter *stream);
+#endif
+#ifdef USE_RUNTIME_STATS_PROFILER
+  /// Microsecond histograms of the loop() calls and scheduler callbacks of every component source
+  void component_profile_rows_(MetricWriter *stream);
+#endif
+  /// Pending item counts of the scheduler queues
+  void scheduler_queue_depth_rows_(MetricWriter *stream);
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(MetricWriter *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void sensor_row_(MetricWriter *stream, sensor::Sensor *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(MetricWriter *stream);
   /// Return the binary sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj, std::string &area,
-                          std::string &node, std::string &friendly_name);
+  void binary_sensor_row_(MetricWriter *stream, binary_sensor::BinarySensor *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(MetricWriter *stream);
   /// Return the fan state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                std::string &friendly_name);
+  void fan_row_(MetricWriter *stream, fan::Fan *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(MetricWriter *stream);
   /// Return the light values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void light_row_(MetricWriter *stream, light::LightState *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(MetricWriter *stream);
   /// Return the cover values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void cover_row_(MetricWriter *stream, cover::Cover *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(MetricWriter *stream);
   /// Return the switch values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void switch_row_(MetricWriter *stream, switch_::Switch *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(MetricWriter *stream);
   /// Return the lock values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                 std::string &friendly_name);
+  void lock_row_(MetricWriter *stream, lock::Lock *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   /// Return the type for prometheus
-  void text_sensor_type_(AsyncResponseStream *stream);
+  void text_sensor_type_(MetricWriter *stream);
   /// Return the text sensor values state as prometheus data point
-  void text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area, std::string &node,
-                        std::string &friendly_name);
+  void text_sensor_row_(MetricWriter *stream, text_sensor::TextSensor *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_NUMBER
   /// Return the type for prometheus
-  void number_type_(AsyncResponseStream *stream);
+  void number_type_(MetricWriter *stream);
   /// Return the number state as prometheus data point
-  void number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void number_row_(MetricWriter *stream, number::Number *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_SELECT
   /// Return the type for prometheus
-  void select_type_(AsyncResponseStream *stream);
+  void select_type_(MetricWriter *stream);
   /// Return the select state as prometheus data point
-  void select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void select_row_(MetricWriter *stream, select::Select *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   /// Return the type for prometheus
-  void media_player_type_(AsyncResponseStream *stream);
+  void media_player_type_(MetricWriter *stream);
   /// Return the media player state as prometheus data point
-  void media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj, std::string &area,
-                         std::string &node, std::string &friendly_name);
+  void media_player_row_(MetricWriter *stream, media_player::MediaPlayer *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_UPDATE
   /// Return the type for prometheus
-  void update_entity_type_(AsyncResponseStream *stream);
+  void update_entity_type_(MetricWriter *stream);
   /// Return the update state and info as prometheus data point
-  void update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area, std::string &node,
-                          std::string &friendly_name);
-  void handle_update_state_(AsyncResponseStream *stream, update::UpdateState state);
+  void update_entity_row_(MetricWriter *stream, update::UpdateEntity *obj, const MetricLabels &labels);
+  static const char *update_state_to_string_(update::UpdateState state);
 #endif
 
 #ifdef USE_VALVE
   /// Return the type for prometheus
-  void valve_type_(AsyncResponseStream *stream);
+  void valve_type_(MetricWriter *stream);
   /// Return the valve state as prometheus data point
-  void valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void valve_row_(MetricWriter *stream, valve::Valve *obj, const MetricLabels &labels);
 #endif
 
 #ifdef USE_CLIMATE
   /// Return the type for prometheus
-  void climate_type_(AsyncResponseStream *stream);
+  void climate_type_(MetricWriter *stream);
   /// Return the climate state as prometheus data point
-  void climate_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                    std::string &friendly_name);
-  void climate_failed_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                           std::string &friendly_name, std::string &category, bool is_failed_value);
-  void climate_setting_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                            std::string &friendly_name, std::string &setting, const LogString *setting_value);
-  void climate_value_row_(AsyncResponseStream *stream, climate::Climate *obj, std::string &area, std::string &node,
-                          std::string &friendly_name, std::string &category, std::string &climate_value);
+  void climate_row_(MetricWriter *stream, climate::Climate *obj, const MetricLabels &labels);
+  void climate_failed_row_(MetricWriter *stream, const MetricLabels &labels, const char *category,
+                           bool is_failed_value);
+  void climate_setting_row_(MetricWriter *stream, const MetricLabels &labels, const char *category,
+                            const LogString *setting_value);
+  void climate_value_row_(MetricWriter *stream, const MetricLabels &labels, const char *category, float value,
+                          int8_t accuracy_decimals);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  // Labels of every entity in scrape order, see labels_for_()
+  std::vector<MetricLabels> labels_;
 };
 
 }  // namespace prometheus
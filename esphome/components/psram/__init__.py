@@ -25,7 +25,7 @@ from esphome.const import (
     KEY_FRAMEWORK_VERSION,
     PLATFORM_ESP32,
 )
-from esphome.core import CORE
+from esphome.core import CORE, CoroPriority, coroutine_with_priority
 import esphome.final_validate as fv
 
 CODEOWNERS = ["@esphome/core"]
@@ -45,6 +45,31 @@ TYPE_HEX = "hex"
 SDK_MODES = {TYPE_QUAD: "QUAD", TYPE_OCTAL: "OCT", TYPE_HEX: "HEX"}
 
 CONF_ENABLE_ECC = "enable_ecc"
+CONF_ALLOCATION_POLICY = "allocation_policy"
+CONF_MEMORY = "memory"
+CONF_MIN_EXTERNAL_SIZE = "min_external_size"
+
+RAMSubsystem = cg.esphome_ns.enum("RAMSubsystem", is_class=True)
+RAM_SUBSYSTEMS = {
+    "display": RAMSubsystem.DISPLAY,
+    "audio": RAMSubsystem.AUDIO,
+    "image": RAMSubsystem.IMAGE,
+}
+
+# RAMAllocator flags, "any" prefers external RAM and falls back to internal RAM
+MEMORY_TYPES = {
+    "any": 0b11,
+    "external": 0b01,
+    "internal": 0b10,
+}
+
+ALLOCATION_POLICY_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_MEMORY, default="any"): cv.enum(MEMORY_TYPES, lower=True),
+        # Smaller allocations try the faster internal RAM first
+        cv.Optional(CONF_MIN_EXTERNAL_SIZE, default=0): cv.validate_bytes,
+    }
+)
 
 SPIRAM_MODES = {
     VARIANT_ESP32: (TYPE_QUAD,),
@@ -111,6 +136,12 @@ def get_config_schema(config):
             cv.Optional(CONF_ENABLE_ECC, default=False): cv.boolean,
             cv.Optional(CONF_SPEED, default=speeds[0]): cv.one_of(*speeds, upper=True),
             cv.Optional(CONF_DISABLED, default=False): cv.boolean,
+            cv.Optional(CONF_ALLOCATION_POLICY): cv.Schema(
+                {
+                    cv.Optional(subsystem): ALLOCATION_POLICY_SCHEMA
+                    for subsystem in RAM_SUBSYSTEMS
+                }
+            ),
         }
     )(config)
 
@@ -120,6 +151,8 @@ CONFIG_SCHEMA = get_config_schema
 FINAL_VALIDATE_SCHEMA = validate_psram_mode
 
 
+# Before the components allocate their buffers
+@coroutine_with_priority(CoroPriority.CORE)
 async def to_code(config):
     if config[CONF_DISABLED]:
         return
@@ -155,5 +188,14 @@ async def to_code(config):
 
     cg.add_define("USE_PSRAM")
 
+    for subsystem, policy in config.get(CONF_ALLOCATION_POLICY, {}).items():
+        cg.add(
+            cg.esphome_ns.set_ram_policy(
+                RAM_SUBSYSTEMS[subsystem],
+                policy[CONF_MEMORY],
+                policy[CONF_MIN_EXTERNAL_SIZE],
+            )
+        )
+
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
@@ -0,0 +1,24 @@
+from esphome.components.sensor import (
+    PUBLISH_POLICY_SCHEMA,
+    validate_device_class,
+    validate_publish_policy_intervals,
+    validate_unit_of_measurement,
+)
+import esphome.config_validation as cv
+from esphome.const import CONF_DEVICE_CLASS, CONF_UNIT_OF_MEASUREMENT
+
+CODEOWNERS = ["@esphome/core"]
+
+# Only configuration, each sensor looks up the first rule matching it while its
+# code is generated, see sensor.setup_sensor_core_(). A rule without
+# unit_of_measurement and device_class matches every sensor.
+MULTI_CONF = True
+CONFIG_SCHEMA = cv.All(
+    PUBLISH_POLICY_SCHEMA.extend(
+        {
+            cv.Optional(CONF_UNIT_OF_MEASUREMENT): validate_unit_of_measurement,
+            cv.Optional(CONF_DEVICE_CLASS): validate_device_class,
+        }
+    ),
+    validate_publish_policy_intervals,
+)
@@ -24,7 +24,14 @@ void PulseMeterSensor::setup() {
   // Set the last processed edge to now for the first timeout
   this->last_processed_edge_us_ = micros();
 
-  if (this->filter_mode_ == FILTER_EDGE) {
+  if (this->uses_pcnt_()) {
+#ifdef HAS_PCNT
+    if (!this->pcnt_setup_()) {
+      this->mark_failed();
+      return;
+    }
+#endif
+  } else if (this->filter_mode_ == FILTER_EDGE) {
     this->pin_->attach_interrupt(PulseMeterSensor::edge_intr, this, gpio::INTERRUPT_RISING_EDGE);
   } else if (this->filter_mode_ == FILTER_PULSE) {
     // Set the pin value to the current value to avoid a false edge
@@ -50,13 +57,16 @@ void PulseMeterSensor::loop() {
     // If the edges are rising too slowly it also implies that the pulse rate is slow.
     // Therefore the update rate of the loop is likely fast enough to detect the edges.
     // When the main loop detects an edge that the ISR didn't it will run the ISR functions directly.
-    bool current = this->pin_->digital_read();
-    if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
-      PulseMeterSensor::edge_intr(this);
-    } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
-      PulseMeterSensor::pulse_intr(this);
+    // The PCNT peripheral counts the edges itself, so it needs no help.
+    if (!this->uses_pcnt_()) {
+      bool current = this->pin_->digital_read();
+      if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
+        PulseMeterSensor::edge_intr(this);
+      } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
+        PulseMeterSensor::pulse_intr(this);
+      }
+      this->last_pin_val_ = current;
     }
-    this->last_pin_val_ = current;
 
     // Swap out set and get to get the latest state from the ISR
     std::swap(this->set_, this->get_);
@@ -79,12 +89,15 @@ void PulseMeterSensor::loop() {
   }
 
   // Check if we detected a pulse this loop
-  if (this->get_->count_ > 0) {
+  const bool detected = this->get_->count_ > 0;
+  if (detected) {
     // Keep a running total of pulses if a total sensor is configured
     if (this->total_sensor_ != nullptr) {
       this->total_pulses_ += this->get_->count_;
-      const uint32_t total = this->total_pulses_;
-      this->total_sensor_->publish_state(total);
+      if (!this->uses_pcnt_()) {
+        const uint32_t total = this->total_pulses_;
+        this->total_sensor_->publish_state(total);
+      }
     }
 
     // We need to detect at least two edges to have a valid pulse width
@@ -123,6 +136,11 @@ void PulseMeterSensor::loop() {
         break;
     }
   }
+
+#ifdef HAS_PCNT
+  if (this->uses_pcnt_())
+    this->publish_pcnt_total_(detected);
+#endif
 }
 
 float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA; }
@@ -130,6 +148,11 @@ float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA
 void PulseMeterSensor::dump_config() {
   LOG_SENSOR("", "Pulse Meter", this);
   LOG_PIN("  Pin: ", this->pin_);
+#ifdef HAS_PCNT
+  if (this->uses_pcnt_()) {
+    ESP_LOGCONFIG(TAG, "  PCNT Unit: %u, timing every %u edges", this->pcnt_unit_, this->pcnt_batch_size_);
+  }
+#endif
   if (this->filter_mode_ == FILTER_EDGE) {
     ESP_LOGCONFIG(TAG, "  Filtering rising edges less than %" PRIu32 " µs apart", this->filter_us_);
   } else {
@@ -185,5 +208,85 @@ void IRAM_ATTR PulseMeterSensor::pulse_intr(PulseMeterSensor *sensor) {
   sensor->last_pin_val_ = pin_val;
 }
 
+#ifdef HAS_PCNT
+bool PulseMeterSensor::pcnt_setup_() {
+  // Units are taken from the top, the pulse_counter component allocates them from the bottom
+  static int next_pcnt_unit = PCNT_UNIT_MAX - 1;
+  static bool isr_service_installed = false;
+  if (next_pcnt_unit < PCNT_UNIT_0) {
+    ESP_LOGE(TAG, "No PCNT unit left");
+    return false;
+  }
+  this->pcnt_unit_ = static_cast<pcnt_unit_t>(next_pcnt_unit--);
+
+  pcnt_config_t pcnt_config = {
+      .pulse_gpio_num = this->pin_->get_pin(),
+      .ctrl_gpio_num = PCNT_PIN_NOT_USED,
+      .lctrl_mode = PCNT_MODE_KEEP,
+      .hctrl_mode = PCNT_MODE_KEEP,
+      .pos_mode = PCNT_COUNT_INC,
+      .neg_mode = PCNT_COUNT_DIS,
+      // The counter wraps to zero at the high limit and raises the interrupt that timestamps the batch
+      .counter_h_lim = static_cast<int16_t>(this->pcnt_batch_size_),
+      .counter_l_lim = 0,
+      .unit = this->pcnt_unit_,
+      .channel = PCNT_CHANNEL_0,
+  };
+  esp_err_t error = pcnt_unit_config(&pcnt_config);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  if (this->filter_us_ != 0) {
+    // The glitch filter counts APB clock cycles at 80 MHz
+    uint16_t filter_val = std::min(static_cast<unsigned int>(this->filter_us_ * 80u), 1023u);
+    pcnt_set_filter_value(this->pcnt_unit_, filter_val);
+    pcnt_filter_enable(this->pcnt_unit_);
+  }
+  if (!isr_service_installed) {
+    error = pcnt_isr_service_install(0);
+    if (error != ESP_OK) {
+      ESP_LOGE(TAG, "Installing the PCNT interrupt service failed: %s", esp_err_to_name(error));
+      return false;
+    }
+    isr_service_installed = true;
+  }
+  pcnt_isr_handler_add(this->pcnt_unit_, &PulseMeterSensor::pcnt_intr, this);
+  pcnt_event_enable(this->pcnt_unit_, PCNT_EVT_H_LIM);
+  pcnt_counter_pause(this->pcnt_unit_);
+  pcnt_counter_clear(this->pcnt_unit_);
+  pcnt_counter_resume(this->pcnt_unit_);
+  return true;
+}
+
+void PulseMeterSensor::publish_pcnt_total_(bool batch_done) {
+  if (this->total_sensor_ == nullptr)
+    return;
+  int16_t partial;
+  pcnt_get_counter_value(this->pcnt_unit_, &partial);
+  if (batch_done) {
+    // The batch total replaces the edges counted ahead
+    this->pcnt_partial_ = 0;
+  } else if (partial <= this->pcnt_partial_) {
+    // Nothing new, or the batch just wrapped and its interrupt is only seen next loop
+    return;
+  }
+  this->pcnt_partial_ = partial;
+  const uint32_t total = this->total_pulses_ + partial;
+  this->total_sensor_->publish_state(total);
+}
+
+void IRAM_ATTR PulseMeterSensor::pcnt_intr(void *arg) {
+  // This is an interrupt handler - we can't call any virtual method from this method
+  // The hardware counted a whole batch, the last edge happened just now
+  const uint32_t now = micros();
+  auto *sensor = static_cast<PulseMeterSensor *>(arg);
+  auto &set = *sensor->set_;
+  set.last_detected_edge_us_ = now;
+  set.last_rising_edge_us_ = now;
+  set.count_ += sensor->pcnt_batch_size_;  // NOLINT(clang-diagnostic-deprecated-volatile)
+}
+#endif  // HAS_PCNT
+
 }  // namespace pulse_meter
 }  // namespace esphome
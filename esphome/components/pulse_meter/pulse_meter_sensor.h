@@ -7,6 +7,11 @@
 
 #include <cinttypes>
 
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include <driver/pcnt.h>
+#define HAS_PCNT
+#endif  // defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+
 namespace esphome {
 namespace pulse_meter {
 
@@ -22,6 +27,10 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
   void set_filter_mode(InternalFilterMode mode) { this->filter_mode_ = mode; }
+#ifdef HAS_PCNT
+  /// Counts rising edges with the PCNT peripheral and only interrupts once per batch_size edges.
+  void set_pcnt_batch_size(uint16_t batch_size) { this->pcnt_batch_size_ = batch_size; }
+#endif
 
   void set_total_pulses(uint32_t pulses);
 
@@ -33,6 +42,19 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
  protected:
   static void edge_intr(PulseMeterSensor *sensor);
   static void pulse_intr(PulseMeterSensor *sensor);
+  bool uses_pcnt_() const {
+#ifdef HAS_PCNT
+    return this->pcnt_batch_size_ > 0;
+#else
+    return false;
+#endif
+  }
+#ifdef HAS_PCNT
+  static void pcnt_intr(void *arg);
+  bool pcnt_setup_();
+  /// Adds the edges of the unfinished batch to the total.
+  void publish_pcnt_total_(bool batch_done);
+#endif
 
   InternalGPIOPin *pin_{nullptr};
   uint32_t filter_us_ = 0;
@@ -77,6 +99,14 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
     bool latched_ = false;
   };
   PulseState pulse_state_{};
+
+#ifdef HAS_PCNT
+  // Zero uses the GPIO interrupt for every edge
+  uint16_t pcnt_batch_size_{0};
+  pcnt_unit_t pcnt_unit_{PCNT_UNIT_0};
+  /// Edges of the unfinished batch already added to the published total
+  int16_t pcnt_partial_{0};
+#endif
 };
 
 }  // namespace pulse_meter
@@ -17,6 +17,8 @@ from esphome.const import (
     UNIT_PULSES,
     UNIT_PULSES_PER_MINUTE,
 )
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32C3
 from esphome.core import CORE
 
 CODEOWNERS = ["@stevebaxter", "@cstaahl", "@TrentHouliston"]
@@ -36,6 +38,8 @@ FILTER_MODES = {
 
 SetTotalPulsesAction = pulse_meter_ns.class_("SetTotalPulsesAction", automation.Action)
 
+CONF_PCNT_BATCH_SIZE = "pcnt_batch_size"
+
 
 def validate_internal_filter(value):
     return cv.positive_time_period_microseconds(value)
@@ -57,27 +61,52 @@ def validate_pulse_meter_pin(value):
     return value
 
 
-CONFIG_SCHEMA = sensor.sensor_schema(
-    PulseMeterSensor,
-    unit_of_measurement=UNIT_PULSES_PER_MINUTE,
-    icon=ICON_PULSE,
-    accuracy_decimals=2,
-    state_class=STATE_CLASS_MEASUREMENT,
-).extend(
-    {
-        cv.Required(CONF_PIN): validate_pulse_meter_pin,
-        cv.Optional(CONF_INTERNAL_FILTER, default="13us"): validate_internal_filter,
-        cv.Optional(CONF_TIMEOUT, default="5min"): validate_timeout,
-        cv.Optional(CONF_TOTAL): sensor.sensor_schema(
-            unit_of_measurement=UNIT_PULSES,
-            icon=ICON_PULSE,
-            accuracy_decimals=0,
-            state_class=STATE_CLASS_TOTAL_INCREASING,
-        ),
-        cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
-            FILTER_MODES, upper=True
-        ),
-    }
+def validate_pcnt(config):
+    if CONF_PCNT_BATCH_SIZE not in config:
+        return config
+    if not CORE.is_esp32 or get_esp32_variant() == VARIANT_ESP32C3:
+        raise cv.Invalid(
+            "The PCNT peripheral is only available on ESP32 variants that have one",
+            [CONF_PCNT_BATCH_SIZE],
+        )
+    if config[CONF_INTERNAL_FILTER_MODE] != "EDGE":
+        raise cv.Invalid(
+            "Counting with the PCNT peripheral requires the EDGE filter mode",
+            [CONF_INTERNAL_FILTER_MODE],
+        )
+    if config[CONF_INTERNAL_FILTER].total_microseconds > 13:
+        raise cv.Invalid(
+            "Maximum internal filter value when using the PCNT peripheral is 13us",
+            [CONF_INTERNAL_FILTER],
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    sensor.sensor_schema(
+        PulseMeterSensor,
+        unit_of_measurement=UNIT_PULSES_PER_MINUTE,
+        icon=ICON_PULSE,
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ).extend(
+        {
+            cv.Required(CONF_PIN): validate_pulse_meter_pin,
+            cv.Optional(CONF_INTERNAL_FILTER, default="13us"): validate_internal_filter,
+            cv.Optional(CONF_TIMEOUT, default="5min"): validate_timeout,
+            cv.Optional(CONF_TOTAL): sensor.sensor_schema(
+                unit_of_measurement=UNIT_PULSES,
+                icon=ICON_PULSE,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+            ),
+            cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
+                FILTER_MODES, upper=True
+            ),
+            cv.Optional(CONF_PCNT_BATCH_SIZE): cv.int_range(min=1, max=32767),
+        }
+    ),
+    validate_pcnt,
 )
 
 
@@ -90,6 +119,8 @@ async def to_code(config):
     cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT]))
     cg.add(var.set_filter_mode(config[CONF_INTERNAL_FILTER_MODE]))
+    if CONF_PCNT_BATCH_SIZE in config:
+        cg.add(var.set_pcnt_batch_size(config[CONF_PCNT_BATCH_SIZE]))
 
     if CONF_TOTAL in config:
         sens = await sensor.new_sensor(config[CONF_TOTAL])
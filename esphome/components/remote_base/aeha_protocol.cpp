@@ -8,7 +8,7 @@ namespace remote_base {
 static const char *const TAG = "remote.aeha";
 
 static const uint16_t BITWISE = 425;
-static const uint16_t HEADER_HIGH_US = BITWISE * 8;
+static const uint16_t HEADER_HIGH_US = AEHAProtocol::HEADER_MARK_US;
 static const uint16_t HEADER_LOW_US = BITWISE * 4;
 static const uint16_t BIT_HIGH_US = BITWISE;
 static const uint16_t BIT_ONE_LOW_US = BITWISE * 3;
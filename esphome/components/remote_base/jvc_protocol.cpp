@@ -7,7 +7,7 @@ namespace remote_base {
 static const char *const TAG = "remote.jvc";
 
 static const uint8_t NBITS = 16;
-static const uint32_t HEADER_HIGH_US = 8400;
+static const uint32_t HEADER_HIGH_US = JVCProtocol::HEADER_MARK_US;
 static const uint32_t HEADER_LOW_US = 4200;
 static const uint32_t BIT_ONE_LOW_US = 1725;
 static const uint32_t BIT_ZERO_LOW_US = 525;
@@ -15,6 +15,8 @@ struct JVCData {
 
 class JVCProtocol : public RemoteProtocol<JVCData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 8400;
+
   void encode(RemoteTransmitData *dst, const JVCData &data) override;
   optional<JVCData> decode(RemoteReceiveData src) override;
   void dump(const JVCData &data) override;
@@ -6,7 +6,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.lg";
 
-static const uint32_t HEADER_HIGH_US = 8000;
+static const uint32_t HEADER_HIGH_US = LGProtocol::HEADER_MARK_US;
 static const uint32_t HEADER_LOW_US = 4000;
 static const uint32_t BIT_HIGH_US = 600;
 static const uint32_t BIT_ONE_LOW_US = 1600;
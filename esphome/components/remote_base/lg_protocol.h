@@ -17,6 +17,8 @@ struct LGData {
 
 class LGProtocol : public RemoteProtocol<LGData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 8000;
+
   void encode(RemoteTransmitData *dst, const LGData &data) override;
   optional<LGData> decode(RemoteReceiveData src) override;
   void dump(const LGData &data) override;
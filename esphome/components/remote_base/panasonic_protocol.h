@@ -17,6 +17,8 @@ struct PanasonicData {
 
 class PanasonicProtocol : public RemoteProtocol<PanasonicData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 3502;
+
   void encode(RemoteTransmitData *dst, const PanasonicData &data) override;
   optional<PanasonicData> decode(RemoteReceiveData src) override;
   void dump(const PanasonicData &data) override;
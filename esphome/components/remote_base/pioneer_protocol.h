@@ -14,6 +14,8 @@ struct PioneerData {
 
 class PioneerProtocol : public RemoteProtocol<PioneerData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 9000;
+
   void encode(RemoteTransmitData *dst, const PioneerData &data) override;
   optional<PioneerData> decode(RemoteReceiveData src) override;
   void dump(const PioneerData &data) override;
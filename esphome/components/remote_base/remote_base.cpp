@@ -1,4 +1,5 @@
 #include "remote_base.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 #include <cinttypes>
@@ -6,6 +7,24 @@
 namespace esphome {
 namespace remote_base {
 
+/* RemoteTransmitData */
+
+void RemoteTransmitData::encode_bytes(const uint8_t *data, size_t len, const PulseDistanceTimings &timings) {
+  const int32_t mark = timings.bit_mark;
+  // Indexed by the bit value, spaces are stored negative
+  const int32_t spaces[2] = {-static_cast<int32_t>(timings.zero_space), -static_cast<int32_t>(timings.one_space)};
+  const size_t start = this->data_.size();
+  this->data_.resize(start + len * 16);
+  int32_t *out = this->data_.data() + start;
+  for (size_t i = 0; i < len; i++) {
+    const uint8_t byte = timings.msb_first ? reverse_bits(data[i]) : data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      *out++ = mark;
+      *out++ = spaces[(byte >> bit) & 1];
+    }
+  }
+}
+
 static const char *const TAG = "remote_base";
 
 /* RemoteReceiveData */
@@ -105,24 +124,39 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   if (dumper->is_secondary()) {
     this->secondary_dumpers_.push_back(dumper);
   } else {
-    this->dumpers_.push_back(dumper);
+    this->dumpers_.push_back({dumper, dumper->header_mark()});
   }
 }
 
+// Shared by all receivers, so a frame id never matches a decode result kept from another receiver
+static uint32_t last_frame_id = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void RemoteReceiverBase::call_listeners_dumpers_() {
+  if (++last_frame_id == 0)
+    ++last_frame_id;
+  this->frame_id_ = last_frame_id;
+  this->call_listeners_();
+  this->call_dumpers_();
+}
+
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    listener->on_receive(this->frame_data_());
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
-  for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+  const RemoteReceiveData src = this->frame_data_();
+  for (const auto &entry : this->dumpers_) {
+    // Noise and other protocols rarely start with the header mark, most frames are sorted out without a decode
+    if (entry.header_mark != 0 && !src.peek_mark(entry.header_mark))
+      continue;
+    if (entry.dumper->dump(src))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+      dumper->dump(this->frame_data_());
   }
 }
 
@@ -18,6 +18,15 @@ enum ToleranceMode : uint8_t {
 
 using RawTimings = std::vector<int32_t>;
 
+/// Bit timings of a pulse distance protocol: every bit is a mark of the same length, followed by a space whose
+/// length gives the bit value. Protocols declare theirs constexpr and pass it to RemoteTransmitData::encode_bytes().
+struct PulseDistanceTimings {
+  uint32_t bit_mark;
+  uint32_t one_space;
+  uint32_t zero_space;
+  bool msb_first{false};
+};
+
 class RemoteTransmitData {
  public:
   void mark(uint32_t length) { this->data_.push_back(length); }
@@ -27,6 +36,9 @@ class RemoteTransmitData {
     this->space(space);
   }
   void reserve(uint32_t len) { this->data_.reserve(len); }
+  /// Append the bits of len bytes as one mark/space pair each. The buffer grows once for all of them and the pairs
+  /// are written in place, instead of being pushed one timing at a time.
+  void encode_bytes(const uint8_t *data, size_t len, const PulseDistanceTimings &timings);
   void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
   uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
   const RawTimings &get_data() const { return this->data_; }
@@ -43,8 +55,9 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame_id = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_id_(frame_id) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
@@ -75,6 +88,8 @@ class RemoteReceiveData {
   }
   uint32_t get_tolerance() { return tolerance_; }
   ToleranceMode get_tolerance_mode() { return this->tolerance_mode_; }
+  /// Identifies the received frame across all receivers, 0 if the data did not come from a receiver.
+  uint32_t get_frame_id() const { return this->frame_id_; }
 
  protected:
   int32_t lower_bound_(uint32_t length) const {
@@ -98,6 +113,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_id_;
 };
 
 class RemoteComponentBase {
@@ -177,6 +193,9 @@ class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
+  /// Mark every frame of the protocol starts with, 0 if it is not known. Frames starting with another mark are not
+  /// passed to the dumper.
+  virtual uint32_t header_mark() const { return 0; }
 };
 
 class RemoteReceiverBase : public RemoteComponentBase {
@@ -192,17 +211,22 @@ class RemoteReceiverBase : public RemoteComponentBase {
  protected:
   void call_listeners_();
   void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
+  void call_listeners_dumpers_();
+  RemoteReceiveData frame_data_() const {
+    return RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_id_);
   }
 
   std::vector<RemoteReceiverListener *> listeners_;
-  std::vector<RemoteReceiverDumperBase *> dumpers_;
+  struct Dumper {
+    RemoteReceiverDumperBase *dumper;
+    uint32_t header_mark;
+  };
+  std::vector<Dumper> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t frame_id_{0};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -225,14 +249,25 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/// Decode the frame with protocol T. A frame passed to many listeners and dumpers of the same protocol is only
+/// decoded by the first of them, the others get the kept result.
+template<typename T> const optional<typename T::ProtocolData> &decode_frame(RemoteReceiveData src) {
+  static uint32_t frame_id = 0;
+  static optional<typename T::ProtocolData> result;
+  if (src.get_frame_id() == 0 || src.get_frame_id() != frame_id) {
+    result = T().decode(src);
+    frame_id = src.get_frame_id();
+  }
+  return result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_frame<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -247,8 +282,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_frame<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -289,13 +323,19 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    const auto &decoded = decode_frame<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
+  uint32_t header_mark() const override {
+    if constexpr (requires { T::HEADER_MARK_US; }) {
+      return T::HEADER_MARK_US;
+    } else {
+      return 0;
+    }
+  }
 };
 
 #define DECLARE_REMOTE_PROTOCOL_(prefix) \
@@ -15,6 +15,8 @@ struct SamsungData {
 
 class SamsungProtocol : public RemoteProtocol<SamsungData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 4500;
+
   void encode(RemoteTransmitData *dst, const SamsungData &data) override;
   optional<SamsungData> decode(RemoteReceiveData src) override;
   void dump(const SamsungData &data) override;
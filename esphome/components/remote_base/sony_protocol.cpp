@@ -6,7 +6,7 @@ namespace remote_base {
 
 static const char *const TAG = "remote.sony";
 
-static const uint32_t HEADER_HIGH_US = 2400;
+static const uint32_t HEADER_HIGH_US = SonyProtocol::HEADER_MARK_US;
 static const uint32_t HEADER_LOW_US = 600;
 static const uint32_t BIT_ONE_HIGH_US = 1200;
 static const uint32_t BIT_ZERO_HIGH_US = 600;
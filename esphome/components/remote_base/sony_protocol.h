@@ -17,6 +17,8 @@ struct SonyData {
 
 class SonyProtocol : public RemoteProtocol<SonyData> {
  public:
+  static constexpr uint32_t HEADER_MARK_US = 2400;
+
   void encode(RemoteTransmitData *dst, const SonyData &data) override;
   optional<SonyData> decode(RemoteReceiveData src) override;
   void dump(const SonyData &data) override;
@@ -7,6 +7,7 @@
 
 #if defined(USE_ESP32)
 #include <driver/rmt_tx.h>
+#include <esp_idf_version.h>
 #endif
 
 namespace esphome {
@@ -58,7 +59,19 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
   uint32_t current_carrier_frequency_{38000};
   bool initialized_{false};
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  static size_t encode_timings_(const void *data, size_t size, size_t symbols_written, size_t symbols_free,
+                                rmt_symbol_word_t *symbols, bool *done, void *arg);
+  bool next_duration_(const int32_t *timings, size_t count, uint32_t *duration, bool *level);
+
+  // Turns the timings into RMT symbols while they are sent, no symbol copy of the timings is kept
+  rmt_encoder_handle_t timings_encoder_{NULL};
+  size_t encode_index_{0};
+  uint32_t encode_remaining_{0};
+  bool encode_level_{false};
+#else
   std::vector<rmt_symbol_word_t> rmt_temp_;
+#endif
   bool with_dma_{false};
   bool eot_level_{false};
   rmt_channel_handle_t channel_{NULL};
@@ -4,12 +4,16 @@
 
 #ifdef USE_ESP32
 #include <driver/gpio.h>
+#include <esp_attr.h>
 
 namespace esphome {
 namespace remote_transmitter {
 
 static const char *const TAG = "remote_transmitter";
 
+// Longest duration of a single RMT symbol half, longer timings are split
+static const uint32_t RMT_MAX_DURATION = 32767;
+
 void RemoteTransmitterComponent::setup() {
   this->inverted_ = this->pin_->is_inverted();
   this->configure_rmt_();
@@ -99,6 +103,20 @@ void RemoteTransmitterComponent::configure_rmt_() {
       this->mark_failed();
       return;
     }
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+    rmt_simple_encoder_config_t timings_encoder;
+    memset(&timings_encoder, 0, sizeof(timings_encoder));
+    timings_encoder.callback = encode_timings_;
+    timings_encoder.arg = this;
+    timings_encoder.min_chunk_size = 1;
+    error = rmt_new_simple_encoder(&timings_encoder, &this->timings_encoder_);
+    if (error != ESP_OK) {
+      this->error_code_ = error;
+      this->error_string_ = "in rmt_new_simple_encoder";
+      this->mark_failed();
+      return;
+    }
+#endif
 
     error = rmt_enable(this->channel_);
     if (error != ESP_OK) {
@@ -139,6 +157,13 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     this->configure_rmt_();
   }
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  const remote_base::RawTimings &timings = this->temp_.get_data();
+  if (timings.empty()) {
+    ESP_LOGE(TAG, "Empty data");
+    return;
+  }
+#else
   this->rmt_temp_.clear();
   this->rmt_temp_.reserve((this->temp_.get_data().size() + 1) / 2);
   uint32_t rmt_i = 0;
@@ -151,7 +176,7 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     val = this->from_microseconds_(static_cast<uint32_t>(val));
 
     do {
-      int32_t item = std::min(val, int32_t(32767));
+      int32_t item = std::min(val, int32_t(RMT_MAX_DURATION));
       val -= item;
 
       if (rmt_i % 2 == 0) {
@@ -176,14 +201,20 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     ESP_LOGE(TAG, "Empty data");
     return;
   }
+#endif
   this->transmit_trigger_->trigger();
   for (uint32_t i = 0; i < send_times; i++) {
     rmt_transmit_config_t config;
     memset(&config, 0, sizeof(config));
     config.loop_count = 0;
     config.flags.eot_level = this->eot_level_;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+    esp_err_t error = rmt_transmit(this->channel_, this->timings_encoder_, timings.data(),
+                                   timings.size() * sizeof(int32_t), &config);
+#else
     esp_err_t error = rmt_transmit(this->channel_, this->encoder_, this->rmt_temp_.data(),
                                    this->rmt_temp_.size() * sizeof(rmt_symbol_word_t), &config);
+#endif
     if (error != ESP_OK) {
       ESP_LOGW(TAG, "rmt_transmit failed: %s", esp_err_to_name(error));
       this->status_set_warning();
@@ -201,6 +232,60 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
   this->complete_trigger_->trigger();
 }
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+bool IRAM_ATTR RemoteTransmitterComponent::next_duration_(const int32_t *timings, size_t count, uint32_t *duration,
+                                                          bool *level) {
+  if (this->encode_remaining_ == 0) {
+    if (this->encode_index_ >= count)
+      return false;
+    int32_t val = timings[this->encode_index_++];
+    this->encode_level_ = val >= 0;
+    this->encode_remaining_ = this->from_microseconds_(static_cast<uint32_t>(val >= 0 ? val : -val));
+  }
+  *duration = std::min(this->encode_remaining_, RMT_MAX_DURATION);
+  *level = this->encode_level_ ^ this->inverted_;
+  this->encode_remaining_ -= *duration;
+  return true;
+}
+
+size_t IRAM_ATTR HOT RemoteTransmitterComponent::encode_timings_(const void *data, size_t size, size_t symbols_written,
+                                                                 size_t symbols_free, rmt_symbol_word_t *symbols,
+                                                                 bool *done, void *arg) {
+  auto *self = static_cast<RemoteTransmitterComponent *>(arg);
+  const auto *timings = static_cast<const int32_t *>(data);
+  const size_t count = size / sizeof(int32_t);
+  if (symbols_written == 0) {
+    // Start of a transmission, each repeat encodes the timings again
+    self->encode_index_ = 0;
+    self->encode_remaining_ = 0;
+  }
+
+  size_t written = 0;
+  while (written < symbols_free) {
+    uint32_t duration0, duration1;
+    bool level0, level1;
+    if (!self->next_duration_(timings, count, &duration0, &level0)) {
+      *done = true;
+      break;
+    }
+    if (!self->next_duration_(timings, count, &duration1, &level1)) {
+      duration1 = 0;
+      level1 = false;
+    }
+    symbols[written].duration0 = duration0;
+    symbols[written].level0 = level0;
+    symbols[written].duration1 = duration1;
+    symbols[written].level1 = level1;
+    written++;
+    if (self->encode_remaining_ == 0 && self->encode_index_ >= count) {
+      *done = true;
+      break;
+    }
+  }
+  return written;
+}
+#endif
+
 }  // namespace remote_transmitter
 }  // namespace esphome
 
@@ -1,3 +1,6 @@
+from fractions import Fraction
+import math
+
 import esphome.codegen as cg
 from esphome.components import audio, esp32, speaker
 import esphome.config_validation as cv
@@ -12,6 +15,7 @@ from esphome.const import (
     CONF_TASK_STACK_IN_PSRAM,
     PLATFORM_ESP32,
 )
+from esphome.core import ID
 from esphome.core.entity_helpers import inherit_property_from
 
 AUTO_LOAD = ["audio"]
@@ -22,8 +26,20 @@ ResamplerSpeaker = resampler_ns.class_(
     "ResamplerSpeaker", cg.Component, speaker.Speaker
 )
 
+CONF_FIXED_POINT_SAMPLE_RATES = "fixed_point_sample_rates"
 CONF_TAPS = "taps"
 
+# Coefficients of the largest polyphase table (16 KB), 22.05 kHz to 48 kHz with 16 taps
+# needs 5120
+MAX_POLYPHASE_COEFFICIENTS = 8192
+# Kaiser window shape of the polyphase prototype filters, about 50 dB of attenuation
+POLYPHASE_KAISER_BETA = 5.0
+# Passband edge of the polyphase prototype filters, as a fraction of the lower Nyquist
+# frequency
+POLYPHASE_PASSBAND = 0.9
+# Matches the -3 dB applied by the floating point resampler to avoid clipping
+POLYPHASE_GAIN = 10 ** (-3 / 20)
+
 
 def _set_stream_limits(config):
     audio.set_stream_limits(
@@ -47,6 +63,89 @@ def _validate_audio_compatability(config):
         sample_rate=config.get(CONF_SAMPLE_RATE),
     )(config)
 
+    _validate_fixed_point_sample_rates(config)
+
+
+def _polyphase_ratio(source_sample_rate, target_sample_rate):
+    """Returns the interpolation and decimation factors between the sample rates."""
+    ratio = Fraction(target_sample_rate, source_sample_rate)
+    return ratio.numerator, ratio.denominator
+
+
+def _validate_fixed_point_sample_rates(config):
+    if not (sample_rates := config.get(CONF_FIXED_POINT_SAMPLE_RATES)):
+        return
+    if config.get(CONF_BITS_PER_SAMPLE) != 16:
+        raise cv.Invalid(
+            "Fixed point resampling only supports 16 bits per sample",
+            path=[CONF_FIXED_POINT_SAMPLE_RATES],
+        )
+    for index, sample_rate in enumerate(sample_rates):
+        if sample_rate == config[CONF_SAMPLE_RATE]:
+            raise cv.Invalid(
+                f"{sample_rate} Hz is already the output sample rate",
+                path=[CONF_FIXED_POINT_SAMPLE_RATES, index],
+            )
+        interpolation, _ = _polyphase_ratio(sample_rate, config[CONF_SAMPLE_RATE])
+        coefficients = interpolation * config[CONF_TAPS]
+        if coefficients > MAX_POLYPHASE_COEFFICIENTS:
+            raise cv.Invalid(
+                f"Converting {sample_rate} Hz to {config[CONF_SAMPLE_RATE]} Hz needs "
+                f"{coefficients} filter coefficients, at most "
+                f"{MAX_POLYPHASE_COEFFICIENTS} are supported",
+                path=[CONF_FIXED_POINT_SAMPLE_RATES, index],
+            )
+
+
+def _bessel_i0(x):
+    """Zeroth order modified Bessel function of the first kind."""
+    result = term = 1.0
+    k = 1
+    while term > 1e-12 * result:
+        term *= (x / (2 * k)) ** 2
+        result += term
+        k += 1
+    return result
+
+
+def polyphase_coefficients(interpolation, decimation, taps):
+    """Designs a Kaiser windowed sinc prototype filter for resampling by
+    interpolation / decimation and splits it into Q15 polyphase coefficients.
+
+    Phase k holds the prototype taps k, k + interpolation, ..., ordered from the
+    oldest to the newest input sample they apply to. Each phase is scaled to
+    POLYPHASE_GAIN at DC, and its absolute coefficients sum to less than 2 in Q15
+    so the C++ accumulator can't overflow with full scale input.
+    """
+    length = interpolation * taps
+    cutoff = POLYPHASE_PASSBAND * 0.5 / max(interpolation, decimation)
+    center = (length - 1) / 2
+    beta_i0 = _bessel_i0(POLYPHASE_KAISER_BETA)
+
+    prototype = []
+    for n in range(length):
+        t = n - center
+        if t == 0:
+            sinc = 2 * cutoff
+        else:
+            sinc = math.sin(2 * math.pi * cutoff * t) / (math.pi * t)
+        window = _bessel_i0(
+            POLYPHASE_KAISER_BETA * math.sqrt(max(0.0, 1 - (t / (center + 0.5)) ** 2))
+        )
+        prototype.append(sinc * window / beta_i0)
+
+    coefficients = []
+    for phase in range(interpolation):
+        values = [prototype[phase + tap * interpolation] for tap in range(taps)]
+        scale = POLYPHASE_GAIN / sum(values)
+        quantized = [round(value * scale * 32768) for value in values]
+        if (absolute_sum := sum(abs(value) for value in quantized)) >= 65536:
+            quantized = [value * 65535 // absolute_sum for value in quantized]
+        coefficients.extend(
+            max(-32768, min(32767, value)) for value in reversed(quantized)
+        )
+    return coefficients
+
 
 def _validate_taps(taps):
     value = cv.int_range(min=16, max=128)(taps)
@@ -68,6 +167,9 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_FILTERS, default=16): cv.int_range(min=2, max=1024),
             cv.Optional(CONF_TAPS, default=16): _validate_taps,
+            cv.Optional(CONF_FIXED_POINT_SAMPLE_RATES): cv.ensure_list(
+                cv.int_range(min=8000, max=48000)
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on([PLATFORM_ESP32]),
@@ -100,3 +202,35 @@ async def to_code(config):
 
     cg.add(var.set_filters(config[CONF_FILTERS]))
     cg.add(var.set_taps(config[CONF_TAPS]))
+
+    for sample_rate in config.get(CONF_FIXED_POINT_SAMPLE_RATES, []):
+        interpolation, decimation = _polyphase_ratio(
+            sample_rate, config[CONF_SAMPLE_RATE]
+        )
+        coefficients_id = ID(
+            f"{config[CONF_ID].id}_polyphase_{sample_rate}",
+            is_declaration=True,
+            type=cg.int16,
+        )
+        coefficients = cg.progmem_array(
+            coefficients_id,
+            polyphase_coefficients(interpolation, decimation, config[CONF_TAPS]),
+        )
+        polyphase_filter = cg.StructInitializer(
+            audio.PolyphaseFilter,
+            ("source_sample_rate", sample_rate),
+            ("target_sample_rate", config[CONF_SAMPLE_RATE]),
+            ("interpolation", interpolation),
+            ("decimation", decimation),
+            ("taps", config[CONF_TAPS]),
+            ("coefficients", coefficients),
+        )
+        polyphase_filter = cg.new_Pvariable(
+            ID(
+                f"{config[CONF_ID].id}_polyphase_filter_{sample_rate}",
+                is_declaration=True,
+                type=audio.PolyphaseFilter,
+            ),
+            polyphase_filter,
+        )
+        cg.add(var.add_polyphase_filter(polyphase_filter))
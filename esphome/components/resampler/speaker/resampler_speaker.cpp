@@ -262,12 +262,21 @@ void ResamplerSpeaker::resample_task(void *params) {
       make_unique<audio::AudioResampler>(this_resampler->audio_stream_info_.ms_to_bytes(TRANSFER_BUFFER_DURATION_MS),
                                          this_resampler->target_stream_info_.ms_to_bytes(TRANSFER_BUFFER_DURATION_MS));
 
+  const audio::PolyphaseFilter *polyphase_filter = nullptr;
+  for (const auto *filter : this_resampler->polyphase_filters_) {
+    if (filter->source_sample_rate == this_resampler->audio_stream_info_.get_sample_rate()) {
+      polyphase_filter = filter;
+      break;
+    }
+  }
+
   esp_err_t err = resampler->start(this_resampler->audio_stream_info_, this_resampler->target_stream_info_,
-                                   this_resampler->taps_, this_resampler->filters_);
+                                   this_resampler->taps_, this_resampler->filters_, polyphase_filter);
 
   if (err == ESP_OK) {
     std::shared_ptr<RingBuffer> temp_ring_buffer =
-        RingBuffer::create(this_resampler->audio_stream_info_.ms_to_bytes(this_resampler->buffer_duration_ms_));
+        RingBuffer::create(this_resampler->audio_stream_info_.ms_to_bytes(this_resampler->buffer_duration_ms_),
+                           RAMSubsystem::AUDIO);
 
     if (temp_ring_buffer.use_count() == 0) {
       err = ESP_ERR_NO_MEM;
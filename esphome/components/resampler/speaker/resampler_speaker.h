@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/components/audio/audio.h"
+#include "esphome/components/audio/audio_polyphase_resampler.h"
 #include "esphome/components/audio/audio_transfer_buffer.h"
 #include "esphome/components/speaker/speaker.h"
 
@@ -50,6 +51,8 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
 
   void set_filters(uint16_t filters) { this->filters_ = filters; }
   void set_taps(uint16_t taps) { this->taps_ = taps; }
+  /// @brief Adds a fixed-point filter used instead of the floating point resampler for its pair of sample rates
+  void add_polyphase_filter(const audio::PolyphaseFilter *filter) { this->polyphase_filters_.push_back(filter); }
 
   void set_buffer_duration(uint32_t buffer_duration_ms) { this->buffer_duration_ms_ = buffer_duration_ms; }
 
@@ -94,6 +97,7 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
 
   uint16_t taps_;
   uint16_t filters_;
+  std::vector<const audio::PolyphaseFilter *> polyphase_filters_;
 
   uint8_t target_bits_per_sample_;
   uint32_t target_sample_rate_;
@@ -9,6 +9,7 @@ from esphome.const import CONF_ID
 CODEOWNERS = ["@bdraco"]
 
 CONF_LOG_INTERVAL = "log_interval"
+CONF_PROFILER = "profiler"
 
 runtime_stats_ns = cg.esphome_ns.namespace("runtime_stats")
 RuntimeStatsCollector = runtime_stats_ns.class_("RuntimeStatsCollector")
@@ -19,6 +20,8 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(
             CONF_LOG_INTERVAL, default="60s"
         ): cv.positive_time_period_milliseconds,
+        # Microsecond histograms of every loop() call and scheduler callback
+        cv.Optional(CONF_PROFILER, default=True): cv.boolean,
     }
 )
 
@@ -27,6 +30,8 @@ async def to_code(config):
     """Generate code for the runtime statistics component."""
     # Define USE_RUNTIME_STATS when this component is used
     cg.add_define("USE_RUNTIME_STATS")
+    if config[CONF_PROFILER]:
+        cg.add_define("USE_RUNTIME_STATS_PROFILER")
 
     # Create the runtime stats instance (constructor sets global_runtime_stats)
     var = cg.new_Pvariable(config[CONF_ID])
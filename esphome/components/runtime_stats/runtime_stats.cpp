@@ -3,6 +3,10 @@
 #ifdef USE_RUNTIME_STATS
 
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#ifdef USE_LOOP_BUDGET
+#include "esphome/core/application.h"
+#endif
 #include <algorithm>
 
 namespace esphome {
@@ -26,7 +30,151 @@ void RuntimeStatsCollector::record_component_time(Component *component, uint32_t
   }
 }
 
+#ifdef USE_RUNTIME_STATS_PROFILER
+void RuntimeStatsCollector::record_component_us(Component *component, const char *callback_name,
+                                                uint32_t duration_us) {
+  if (component == nullptr)
+    return;
+  if (duration_us > this->slow_call_threshold_us_)
+    this->trace_slow_call_(component, callback_name, duration_us);
+  if (callback_name == nullptr) {
+    this->loop_profiles_[component].record(duration_us);
+    return;
+  }
+
+  const auto key = std::make_pair(component, fnv1_hash(callback_name));
+  auto it = this->callback_index_.find(key);
+  if (it == this->callback_index_.end()) {
+    if (this->callback_profiles_.size() >= MAX_CALLBACK_PROFILES) {
+      this->dropped_callback_calls_++;
+      return;
+    }
+    it = this->callback_index_.emplace(key, this->callback_profiles_.size()).first;
+    this->callback_profiles_.push_back({component, callback_name, {}});
+  }
+  this->callback_profiles_[it->second].profile.record(duration_us);
+}
+
+void RuntimeStatsCollector::trace_slow_call_(Component *component, const char *callback_name, uint32_t duration_us) {
+  if (this->slow_calls_.capacity() == 0)
+    this->slow_calls_.reserve(SLOW_CALL_TRACE_SIZE);
+  SlowCallTrace *slot;
+  if (this->slow_calls_.size() < SLOW_CALL_TRACE_SIZE) {
+    slot = &this->slow_calls_.emplace_back();
+  } else {
+    slot = &*std::min_element(
+        this->slow_calls_.begin(), this->slow_calls_.end(),
+        [](const SlowCallTrace &a, const SlowCallTrace &b) { return a.duration_us < b.duration_us; });
+  }
+  slot->component = component;
+  slot->duration_us = duration_us;
+  slot->at_ms = millis();
+  slot->is_loop = callback_name == nullptr;
+  strncpy(slot->name, slot->is_loop ? "" : callback_name, sizeof(slot->name) - 1);
+  slot->name[sizeof(slot->name) - 1] = '\0';
+
+  if (this->slow_calls_.size() == SLOW_CALL_TRACE_SIZE) {
+    this->slow_call_threshold_us_ = UINT32_MAX;
+    for (const auto &it : this->slow_calls_)
+      this->slow_call_threshold_us_ = std::min(this->slow_call_threshold_us_, it.duration_us);
+  }
+}
+
+void RuntimeStatsCollector::log_profiles_() {
+  ESP_LOGI(TAG, "Loop profile (since boot):");
+  std::vector<std::pair<Component *, const RuntimeProfile *>> loops;
+  loops.reserve(this->loop_profiles_.size());
+  for (const auto &it : this->loop_profiles_)
+    loops.emplace_back(it.first, &it.second);
+  std::sort(loops.begin(), loops.end(),
+            [](const auto &a, const auto &b) { return a.second->get_sum_us() > b.second->get_sum_us(); });
+  for (const auto &it : loops) {
+    const RuntimeProfile &profile = *it.second;
+    ESP_LOGI(TAG, "  %s: count=%" PRIu32 ", avg=%.1fus, p50=%" PRIu32 "us, p99=%" PRIu32 "us, max=%" PRIu32 "us",
+             LOG_STR_ARG(it.first->get_component_log_str()), profile.get_count(), profile.get_avg_us(),
+             profile.get_quantile_us(0.5f), profile.get_quantile_us(0.99f), profile.get_max_us());
+  }
+
+  if (this->callback_profiles_.empty())
+    return;
+  ESP_LOGI(TAG, "Scheduler callback profile (since boot):");
+  std::vector<const CallbackProfile *> callbacks;
+  callbacks.reserve(this->callback_profiles_.size());
+  for (const auto &it : this->callback_profiles_)
+    callbacks.push_back(&it);
+  std::sort(callbacks.begin(), callbacks.end(), [](const CallbackProfile *a, const CallbackProfile *b) {
+    return a->profile.get_sum_us() > b->profile.get_sum_us();
+  });
+  for (const auto *it : callbacks) {
+    ESP_LOGI(TAG, "  %s/%s: count=%" PRIu32 ", avg=%.1fus, p99=%" PRIu32 "us, max=%" PRIu32 "us",
+             LOG_STR_ARG(it->component->get_component_log_str()), it->name.empty() ? "<unnamed>" : it->name.c_str(),
+             it->profile.get_count(), it->profile.get_avg_us(), it->profile.get_quantile_us(0.99f),
+             it->profile.get_max_us());
+  }
+  if (this->dropped_callback_calls_ > 0)
+    ESP_LOGI(TAG, "  %" PRIu32 " calls of further callbacks not profiled", this->dropped_callback_calls_);
+
+  if (this->slow_calls_.empty())
+    return;
+  ESP_LOGI(TAG, "Slowest calls (since boot):");
+  std::vector<const SlowCallTrace *> slow_calls;
+  slow_calls.reserve(this->slow_calls_.size());
+  for (const auto &it : this->slow_calls_)
+    slow_calls.push_back(&it);
+  std::sort(slow_calls.begin(), slow_calls.end(),
+            [](const SlowCallTrace *a, const SlowCallTrace *b) { return a->duration_us > b->duration_us; });
+  for (const auto *it : slow_calls) {
+    ESP_LOGI(TAG, "  %s/%s: %" PRIu32 "us at %" PRIu32 "ms", LOG_STR_ARG(it->component->get_component_log_str()),
+             it->is_loop ? "loop()" : (it->name[0] == '\0' ? "<unnamed>" : it->name), it->duration_us, it->at_ms);
+  }
+}
+#endif
+
+void RuntimeStatsCollector::record_setup_io_time(Component *component, uint32_t io_ms) {
+  // All setup_io() of a setup priority group run before the first setup() of the group
+  for (auto &it : this->boot_stats_) {
+    if (it.component == component) {
+      it.io_ms = io_ms;
+      return;
+    }
+  }
+  this->boot_stats_.push_back({component, io_ms, 0, 0});
+}
+
+void RuntimeStatsCollector::record_setup_time(Component *component, uint32_t setup_ms, uint32_t wait_ms) {
+  for (auto &it : this->boot_stats_) {
+    if (it.component == component) {
+      it.setup_ms = setup_ms;
+      it.wait_ms = wait_ms;
+      return;
+    }
+  }
+  this->boot_stats_.push_back({component, 0, setup_ms, wait_ms});
+}
+
+void RuntimeStatsCollector::log_boot_profile_() {
+  ESP_LOGI(TAG, "Boot profile (setup finished after %" PRIu32 "ms):", this->boot_time_ms_);
+
+  std::sort(this->boot_stats_.begin(), this->boot_stats_.end(),
+            [](const ComponentBootStats &a, const ComponentBootStats &b) {
+              return a.get_total_ms() > b.get_total_ms();
+            });
+  for (const auto &it : this->boot_stats_) {
+    // Components that came up within the millisecond are left out
+    if (it.get_total_ms() == 0)
+      break;
+    ESP_LOGI(TAG, "  %s: io=%" PRIu32 "ms, setup=%" PRIu32 "ms, wait=%" PRIu32 "ms",
+             LOG_STR_ARG(it.component->get_component_log_str()), it.io_ms, it.setup_ms, it.wait_ms);
+  }
+
+  this->boot_stats_.clear();
+  this->boot_stats_.shrink_to_fit();
+}
+
 void RuntimeStatsCollector::log_stats_() {
+  if (!this->boot_stats_.empty())
+    this->log_boot_profile_();
+
   ESP_LOGI(TAG, "Component Runtime Statistics");
   ESP_LOGI(TAG, "Period stats (last %" PRIu32 "ms):", this->log_interval_);
 
@@ -51,6 +199,11 @@ void RuntimeStatsCollector::log_stats_() {
              LOG_STR_ARG(it.component->get_component_log_str()), it.stats->get_period_count(),
              it.stats->get_period_avg_time_ms(), it.stats->get_period_max_time_ms(), it.stats->get_period_time_ms());
   }
+#ifdef USE_LOOP_BUDGET
+  ESP_LOGI(TAG, "  Loop budget %" PRIu32 "ms: overruns=%" PRIu32 ", deferred=%" PRIu32 ", max=%" PRIu32 "ms",
+           App.get_loop_budget(), this->loop_budget_stats_.get_period_overruns(),
+           this->loop_budget_stats_.get_period_deferred(), this->loop_budget_stats_.get_period_max_time_ms());
+#endif
 
   // Log total stats since boot
   ESP_LOGI(TAG, "Total stats (since boot):");
@@ -66,6 +219,14 @@ void RuntimeStatsCollector::log_stats_() {
              LOG_STR_ARG(it.component->get_component_log_str()), it.stats->get_total_count(),
              it.stats->get_total_avg_time_ms(), it.stats->get_total_max_time_ms(), it.stats->get_total_time_ms());
   }
+#ifdef USE_LOOP_BUDGET
+  ESP_LOGI(TAG, "  Loop budget %" PRIu32 "ms: overruns=%" PRIu32 ", deferred=%" PRIu32 ", max=%" PRIu32 "ms",
+           App.get_loop_budget(), this->loop_budget_stats_.get_total_overruns(),
+           this->loop_budget_stats_.get_total_deferred(), this->loop_budget_stats_.get_total_max_time_ms());
+#endif
+#ifdef USE_RUNTIME_STATS_PROFILER
+  this->log_profiles_();
+#endif
 }
 
 void RuntimeStatsCollector::process_pending_stats(uint32_t current_time) {
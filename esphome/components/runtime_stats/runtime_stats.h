@@ -4,7 +4,9 @@
 
 #ifdef USE_RUNTIME_STATS
 
+#include <algorithm>
 #include <map>
+#include <string>
 #include <vector>
 #include <cstdint>
 #include <cstring>
@@ -19,6 +21,10 @@ namespace runtime_stats {
 
 static const char *const TAG = "runtime_stats";
 
+// Upper bounds (inclusive, in ms) of the loop time histogram buckets, the +Inf bucket is the total count
+static constexpr uint32_t LOOP_TIME_BUCKET_BOUNDS_MS[] = {1, 2, 5, 10, 20, 50, 100, 250, 500};
+static constexpr size_t LOOP_TIME_BUCKET_COUNT = sizeof(LOOP_TIME_BUCKET_BOUNDS_MS) / sizeof(uint32_t);
+
 class ComponentRuntimeStats {
  public:
   ComponentRuntimeStats()
@@ -41,6 +47,14 @@ class ComponentRuntimeStats {
     this->total_time_ms_ += duration_ms;
     if (duration_ms > this->total_max_time_ms_)
       this->total_max_time_ms_ = duration_ms;
+
+    // Only the first matching bucket is counted, get_total_bucket_count() accumulates
+    for (size_t i = 0; i < LOOP_TIME_BUCKET_COUNT; i++) {
+      if (duration_ms <= LOOP_TIME_BUCKET_BOUNDS_MS[i]) {
+        this->total_buckets_[i]++;
+        break;
+      }
+    }
   }
 
   void reset_period_stats() {
@@ -64,6 +78,13 @@ class ComponentRuntimeStats {
   float get_total_avg_time_ms() const {
     return this->total_count_ > 0 ? this->total_time_ms_ / static_cast<float>(this->total_count_) : 0.0f;
   }
+  /// Loop calls since boot that took at most LOOP_TIME_BUCKET_BOUNDS_MS[bucket] ms (cumulative, like Prometheus).
+  uint32_t get_total_bucket_count(size_t bucket) const {
+    uint32_t count = 0;
+    for (size_t i = 0; i <= bucket && i < LOOP_TIME_BUCKET_COUNT; i++)
+      count += this->total_buckets_[i];
+    return count;
+  }
 
  protected:
   // Period stats (reset each logging interval)
@@ -75,6 +96,133 @@ class ComponentRuntimeStats {
   uint32_t total_count_;
   uint32_t total_time_ms_;
   uint32_t total_max_time_ms_;
+  uint32_t total_buckets_[LOOP_TIME_BUCKET_COUNT]{};
+};
+
+#ifdef USE_RUNTIME_STATS_PROFILER
+// Upper bounds (inclusive, in us) of the profile histogram buckets, powers of two from 1 us to 32.768 ms
+static constexpr size_t PROFILE_BUCKET_COUNT = 16;
+static constexpr uint32_t PROFILE_BUCKET_BOUNDS_US[PROFILE_BUCKET_COUNT] = {
+    1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768};
+// Distinct scheduler callbacks profiled, calls of later ones are only counted in get_dropped_callback_calls()
+static constexpr size_t MAX_CALLBACK_PROFILES = 64;
+
+// Microsecond run time histogram of one component or scheduler callback since boot
+class RuntimeProfile {
+ public:
+  void record(uint32_t duration_us) {
+    this->count_++;
+    this->sum_us_ += duration_us;
+    if (duration_us > this->max_us_)
+      this->max_us_ = duration_us;
+    // Index of the smallest power of two >= duration_us, longer calls only show up in the +Inf bucket
+    const size_t bucket = duration_us <= 1 ? 0 : 32 - __builtin_clz(duration_us - 1);
+    if (bucket < PROFILE_BUCKET_COUNT)
+      this->buckets_[bucket]++;
+  }
+
+  uint32_t get_count() const { return this->count_; }
+  uint64_t get_sum_us() const { return this->sum_us_; }
+  uint32_t get_max_us() const { return this->max_us_; }
+  float get_avg_us() const { return this->count_ > 0 ? this->sum_us_ / static_cast<float>(this->count_) : 0.0f; }
+  /// Calls that took at most PROFILE_BUCKET_BOUNDS_US[bucket] us (cumulative, like Prometheus).
+  uint32_t get_bucket_count(size_t bucket) const {
+    uint32_t count = 0;
+    for (size_t i = 0; i <= bucket && i < PROFILE_BUCKET_COUNT; i++)
+      count += this->buckets_[i];
+    return count;
+  }
+  /// Upper bound of the bucket holding the given quantile (0..1) of the calls, the maximum above the last bucket.
+  uint32_t get_quantile_us(float quantile) const {
+    const uint32_t rank = static_cast<uint32_t>(quantile * this->count_);
+    uint32_t count = 0;
+    for (size_t i = 0; i < PROFILE_BUCKET_COUNT; i++) {
+      count += this->buckets_[i];
+      if (count > rank)
+        return std::min(PROFILE_BUCKET_BOUNDS_US[i], this->max_us_);
+    }
+    return this->max_us_;
+  }
+
+ protected:
+  uint64_t sum_us_{0};
+  uint32_t count_{0};
+  uint32_t max_us_{0};
+  uint32_t buckets_[PROFILE_BUCKET_COUNT]{};
+};
+
+// Slowest loop() calls and scheduler callbacks kept since boot
+static constexpr size_t SLOW_CALL_TRACE_SIZE = 8;
+
+// One of the slowest calls, the name is copied as dynamic callback names don't outlive their item
+struct SlowCallTrace {
+  Component *component;
+  uint32_t duration_us;
+  uint32_t at_ms;  // millis() when the call finished
+  bool is_loop;
+  char name[23];
+};
+
+// Profile of the scheduler callbacks of one component sharing a name
+struct CallbackProfile {
+  Component *component;
+  std::string name;
+  RuntimeProfile profile;
+};
+#endif  // USE_RUNTIME_STATS_PROFILER
+
+#ifdef USE_LOOP_BUDGET
+class LoopBudgetStats {
+ public:
+  void record_overrun(uint32_t duration_ms, uint16_t deferred) {
+    this->period_overruns_++;
+    this->period_deferred_ += deferred;
+    if (duration_ms > this->period_max_time_ms_)
+      this->period_max_time_ms_ = duration_ms;
+
+    this->total_overruns_++;
+    this->total_deferred_ += deferred;
+    if (duration_ms > this->total_max_time_ms_)
+      this->total_max_time_ms_ = duration_ms;
+  }
+
+  void reset_period_stats() {
+    this->period_overruns_ = 0;
+    this->period_deferred_ = 0;
+    this->period_max_time_ms_ = 0;
+  }
+
+  // Period stats (reset each logging interval)
+  uint32_t get_period_overruns() const { return this->period_overruns_; }
+  uint32_t get_period_deferred() const { return this->period_deferred_; }
+  uint32_t get_period_max_time_ms() const { return this->period_max_time_ms_; }
+
+  // Total stats (persistent until reboot)
+  uint32_t get_total_overruns() const { return this->total_overruns_; }
+  uint32_t get_total_deferred() const { return this->total_deferred_; }
+  uint32_t get_total_max_time_ms() const { return this->total_max_time_ms_; }
+
+ protected:
+  // Iterations that spent the budget, components they left for the next one, and the longest iteration
+  uint32_t period_overruns_{0};
+  uint32_t period_deferred_{0};
+  uint32_t period_max_time_ms_{0};
+
+  uint32_t total_overruns_{0};
+  uint32_t total_deferred_{0};
+  uint32_t total_max_time_ms_{0};
+};
+#endif  // USE_LOOP_BUDGET
+
+// Time a component took to come up during boot
+struct ComponentBootStats {
+  Component *component;
+  // In setup_io(), in setup(), and waiting for can_proceed() after setup()
+  uint32_t io_ms;
+  uint32_t setup_ms;
+  uint32_t wait_ms;
+
+  uint32_t get_total_ms() const { return this->io_ms + this->setup_ms + this->wait_ms; }
 };
 
 // For sorting components by run time
@@ -97,21 +245,68 @@ class RuntimeStatsCollector {
 
   void record_component_time(Component *component, uint32_t duration_ms, uint32_t current_time);
 
+#ifdef USE_LOOP_BUDGET
+  // Record a loop() iteration that took longer than the loop budget or left components for the next one
+  void record_loop_budget_overrun(uint32_t duration_ms, uint16_t deferred) {
+    this->loop_budget_stats_.record_overrun(duration_ms, deferred);
+  }
+#endif
+
+#ifdef USE_RUNTIME_STATS_PROFILER
+  /// Record a loop() call (callback_name nullptr) or a scheduler callback of the component in microseconds.
+  void record_component_us(Component *component, const char *callback_name, uint32_t duration_us);
+  const std::map<Component *, RuntimeProfile> &get_loop_profiles() const { return this->loop_profiles_; }
+  const std::vector<CallbackProfile> &get_callback_profiles() const { return this->callback_profiles_; }
+  uint32_t get_dropped_callback_calls() const { return this->dropped_callback_calls_; }
+  /// The SLOW_CALL_TRACE_SIZE slowest calls since boot, unordered.
+  const std::vector<SlowCallTrace> &get_slow_calls() const { return this->slow_calls_; }
+#endif
+
+  // Boot profile, logged once with the first statistics and released afterwards
+  void record_setup_io_time(Component *component, uint32_t io_ms);
+  void record_setup_time(Component *component, uint32_t setup_ms, uint32_t wait_ms);
+  void record_boot_time(uint32_t boot_time_ms) { this->boot_time_ms_ = boot_time_ms; }
+
   // Process any pending stats printing (should be called after component loop)
   void process_pending_stats(uint32_t current_time);
 
+  const std::map<Component *, ComponentRuntimeStats> &get_component_stats() const { return this->component_stats_; }
+
  protected:
   void log_stats_();
+  void log_boot_profile_();
+#ifdef USE_RUNTIME_STATS_PROFILER
+  void log_profiles_();
+  void trace_slow_call_(Component *component, const char *callback_name, uint32_t duration_us);
+#endif
 
   void reset_stats_() {
     for (auto &it : this->component_stats_) {
       it.second.reset_period_stats();
     }
+#ifdef USE_LOOP_BUDGET
+    this->loop_budget_stats_.reset_period_stats();
+#endif
   }
 
   // Map from component to its stats
   // We use Component* as the key since each component is unique
   std::map<Component *, ComponentRuntimeStats> component_stats_;
+#ifdef USE_LOOP_BUDGET
+  LoopBudgetStats loop_budget_stats_;
+#endif
+#ifdef USE_RUNTIME_STATS_PROFILER
+  std::map<Component *, RuntimeProfile> loop_profiles_;
+  // Keyed by component and the hash of the callback name, indexes into callback_profiles_
+  std::map<std::pair<Component *, uint32_t>, size_t> callback_index_;
+  std::vector<CallbackProfile> callback_profiles_;
+  uint32_t dropped_callback_calls_{0};
+  std::vector<SlowCallTrace> slow_calls_;
+  // Shortest call in a full slow_calls_, only longer ones replace it
+  uint32_t slow_call_threshold_us_{0};
+#endif
+  std::vector<ComponentBootStats> boot_stats_;
+  uint32_t boot_time_ms_{0};
   uint32_t log_interval_;
   uint32_t next_log_time_;
 };
@@ -22,6 +22,7 @@ CONF_SINGLE = "single"
 CONF_QUEUED = "queued"
 CONF_PARALLEL = "parallel"
 CONF_MAX_RUNS = "max_runs"
+CONF_QUEUE_OVERFLOW = "queue_overflow"
 
 SCRIPT_MODES = {
     CONF_SINGLE: SingleScript,
@@ -30,6 +31,12 @@ SCRIPT_MODES = {
     CONF_PARALLEL: ParallelScript,
 }
 
+QueueOverflowPolicy = script_ns.enum("QueueOverflowPolicy")
+QUEUE_OVERFLOW_POLICIES = {
+    "drop_newest": QueueOverflowPolicy.QUEUE_OVERFLOW_DROP_NEWEST,
+    "drop_oldest": QueueOverflowPolicy.QUEUE_OVERFLOW_DROP_OLDEST,
+}
+
 PARAMETER_TYPE_TRANSLATIONS = {
     "string": "std::string",
     "boolean": "bool",
@@ -55,6 +62,15 @@ def check_max_runs(value):
     return value
 
 
+def check_queue_overflow(value):
+    if CONF_QUEUE_OVERFLOW in value and value[CONF_MODE] != CONF_QUEUED:
+        raise cv.Invalid(
+            "The option 'queue_overflow' is only valid in 'queued' mode.",
+            path=[CONF_QUEUE_OVERFLOW],
+        )
+    return value
+
+
 def assign_declare_id(value):
     value = value.copy()
     value[CONF_ID] = cv.declare_id(SCRIPT_MODES[value[CONF_MODE]])(value[CONF_ID])
@@ -107,13 +123,14 @@ CONFIG_SCHEMA = automation.validate_automation(
             *SCRIPT_MODES, lower=True
         ),
         cv.Optional(CONF_MAX_RUNS): cv.positive_int,
+        cv.Optional(CONF_QUEUE_OVERFLOW): cv.enum(QUEUE_OVERFLOW_POLICIES, lower=True),
         cv.Optional(CONF_PARAMETERS, default={}): cv.Schema(
             {
                 validate_parameter_name: validate_parameter_type,
             }
         ),
     },
-    extra_validators=cv.All(check_max_runs, assign_declare_id),
+    extra_validators=cv.All(check_max_runs, check_queue_overflow, assign_declare_id),
 )
 
 
@@ -128,6 +145,8 @@ async def to_code(config):
 
         if CONF_MAX_RUNS in conf:
             cg.add(trigger.set_max_runs(conf[CONF_MAX_RUNS]))
+        if CONF_QUEUE_OVERFLOW in conf:
+            cg.add(trigger.set_overflow_policy(conf[CONF_QUEUE_OVERFLOW]))
 
         if conf[CONF_MODE] == CONF_QUEUED:
             await cg.register_component(trigger, conf)
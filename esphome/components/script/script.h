@@ -4,7 +4,10 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 
-#include <queue>
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 namespace esphome {
 namespace script {
 
@@ -93,6 +96,12 @@ template<typename... Ts> class RestartScript : public Script<Ts...> {
   }
 };
 
+/// What a queued script does with a new run when max_runs are already queued.
+enum QueueOverflowPolicy : uint8_t {
+  QUEUE_OVERFLOW_DROP_NEWEST,
+  QUEUE_OVERFLOW_DROP_OLDEST,
+};
+
 /** A script type that queues new instances that are created.
  *
  * Only one instance of the script can be active at a time.
@@ -104,15 +113,22 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
       // num_runs_ is the number of *queued* instances, so total number of instances is
       // num_runs_ + 1
       if (this->max_runs_ != 0 && this->num_runs_ + 1 >= this->max_runs_) {
-        this->esp_logw_(__LINE__, ESPHOME_LOG_FORMAT("Script '%s' maximum number of queued runs exceeded!"),
+        this->dropped_runs_++;
+        if (this->overflow_policy_ == QUEUE_OVERFLOW_DROP_NEWEST || this->num_runs_ == 0) {
+          this->esp_logw_(__LINE__, ESPHOME_LOG_FORMAT("Script '%s' maximum number of queued runs exceeded!"),
+                          LOG_STR_ARG(this->name_));
+          return;
+        }
+        this->esp_logw_(__LINE__,
+                        ESPHOME_LOG_FORMAT("Script '%s' maximum number of queued runs exceeded, dropping the oldest!"),
                         LOG_STR_ARG(this->name_));
-        return;
+        this->queue_head_ = (this->queue_head_ + 1) % this->var_queue_.size();
+        this->num_runs_--;
       }
 
       this->esp_logd_(__LINE__, ESPHOME_LOG_FORMAT("Script '%s' queueing new instance (mode: queued)"),
                       LOG_STR_ARG(this->name_));
-      this->num_runs_++;
-      this->var_queue_.push(std::make_tuple(x...));
+      this->push_(std::make_tuple(x...));
       return;
     }
 
@@ -123,28 +139,54 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
 
   void stop() override {
     this->num_runs_ = 0;
+    this->queue_head_ = 0;
     Script<Ts...>::stop();
   }
 
   void loop() override {
     if (this->num_runs_ != 0 && !this->is_action_running()) {
+      // Move the arguments out, the slot can be reused by an execute() from within the run
+      std::tuple<Ts...> vars = std::move(this->var_queue_[this->queue_head_]);
+      this->queue_head_ = (this->queue_head_ + 1) % this->var_queue_.size();
       this->num_runs_--;
-      auto &vars = this->var_queue_.front();
-      this->var_queue_.pop();
       this->trigger_tuple_(vars, typename gens<sizeof...(Ts)>::type());
     }
   }
 
-  void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  void set_max_runs(int max_runs) {
+    max_runs_ = max_runs;
+    // At most max_runs - 1 runs wait while one is running, so the ring never has to grow
+    this->var_queue_.resize(max_runs > 1 ? max_runs - 1 : 0);
+  }
+  void set_overflow_policy(QueueOverflowPolicy overflow_policy) { this->overflow_policy_ = overflow_policy; }
+  /// Runs dropped because max_runs were already queued, since boot.
+  uint32_t get_dropped_runs() const { return this->dropped_runs_; }
 
  protected:
   template<int... S> void trigger_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->trigger(std::get<S>(tuple)...);
   }
 
+  void push_(std::tuple<Ts...> &&vars) {
+    if (static_cast<size_t>(this->num_runs_) == this->var_queue_.size()) {
+      // Only without max_runs: grow the ring, keeping the queued runs in order
+      std::vector<std::tuple<Ts...>> grown(std::max<size_t>(4, this->var_queue_.size() * 2));
+      for (int i = 0; i < this->num_runs_; i++)
+        grown[i] = std::move(this->var_queue_[(this->queue_head_ + i) % this->var_queue_.size()]);
+      this->var_queue_ = std::move(grown);
+      this->queue_head_ = 0;
+    }
+    this->var_queue_[(this->queue_head_ + this->num_runs_) % this->var_queue_.size()] = std::move(vars);
+    this->num_runs_++;
+  }
+
   int num_runs_ = 0;
   int max_runs_ = 0;
-  std::queue<std::tuple<Ts...>> var_queue_;
+  uint32_t dropped_runs_{0};
+  // Ring of the queued arguments, num_runs_ slots from queue_head_ are in use
+  std::vector<std::tuple<Ts...>> var_queue_;
+  size_t queue_head_{0};
+  QueueOverflowPolicy overflow_policy_{QUEUE_OVERFLOW_DROP_NEWEST};
 };
 
 /** A script type that executes new instances in parallel.
@@ -133,6 +133,15 @@ class SensirionI2CDevice : public i2c::I2CDevice {
    */
   bool get_register_(uint16_t reg, CommandLen command_len, uint16_t *data, uint8_t len, uint8_t delay);
 
+  /** Check and convert data words already read from the I2C device, e.g. with write_read_async().
+   * handles CRC check used by Sensirion sensors
+   * @param buf raw bytes read, 3 per word
+   * @param data pointer to raw result
+   * @param len number of words
+   * @return true if all CRCs matched
+   */
+  bool decode_data_(const uint8_t *buf, uint16_t *data, uint8_t len);
+
   /** last error code from I2C operation
    */
   i2c::ErrorCode last_error_;
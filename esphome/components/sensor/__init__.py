@@ -11,6 +11,7 @@ from esphome.const import (
     CONF_ALPHA,
     CONF_BELOW,
     CONF_CALIBRATION,
+    CONF_DELTA,
     CONF_DEVICE_CLASS,
     CONF_ENTITY_CATEGORY,
     CONF_EXPIRE_AFTER,
@@ -102,12 +103,17 @@ from esphome.const import (
     DEVICE_CLASS_WIND_SPEED,
     ENTITY_CATEGORY_CONFIG,
 )
-from esphome.core import CORE, CoroPriority, coroutine_with_priority
+from esphome.core import CORE, ID, CoroPriority, coroutine_with_priority
 from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
 from esphome.cpp_generator import MockObjClass
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
+
+CONF_MAX_INTERVAL = "max_interval"
+CONF_MIN_INTERVAL = "min_interval"
+CONF_PUBLISH_POLICY = "publish_policy"
+
 DEVICE_CLASSES = [
     DEVICE_CLASS_ABSOLUTE_HUMIDITY,
     DEVICE_CLASS_APPARENT_POWER,
@@ -272,12 +278,33 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+PublishPolicy = sensor_ns.struct("PublishPolicy")
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
 validate_icon = cv.icon
 validate_device_class = cv.one_of(*DEVICE_CLASSES, lower=True, space="_")
 
+PUBLISH_POLICY_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_DELTA, default=0.0): cv.positive_float,
+        cv.Optional(
+            CONF_MIN_INTERVAL, default="0ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_MAX_INTERVAL, default="0ms"
+        ): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+def validate_publish_policy_intervals(config):
+    max_interval = config[CONF_MAX_INTERVAL].total_milliseconds
+    if 0 < max_interval < config[CONF_MIN_INTERVAL].total_milliseconds:
+        raise cv.Invalid(f"{CONF_MAX_INTERVAL} must not be below {CONF_MIN_INTERVAL}")
+    return config
+
+
 _SENSOR_SCHEMA = (
     cv.ENTITY_BASE_SCHEMA.extend(web_server.WEBSERVER_SORTING_SCHEMA)
     .extend(cv.MQTT_COMPONENT_SCHEMA)
@@ -299,6 +326,10 @@ _SENSOR_SCHEMA = (
                 cv.Any(None, cv.positive_time_period_milliseconds),
             ),
             cv.Optional(CONF_FILTERS): validate_filters,
+            cv.Optional(CONF_PUBLISH_POLICY): cv.Any(
+                cv.none,
+                cv.All(PUBLISH_POLICY_SCHEMA, validate_publish_policy_intervals),
+            ),
             cv.Optional(CONF_ON_VALUE): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(SensorStateTrigger),
@@ -823,6 +854,37 @@ async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+def _find_publish_policy(config):
+    """The override of the sensor, else the first publish_policy: rule matching it."""
+    if (policy := config.get(CONF_PUBLISH_POLICY, cv.UNDEFINED)) is not cv.UNDEFINED:
+        return policy
+    for rule in CORE.config.get(CONF_PUBLISH_POLICY, []):
+        if all(
+            key not in rule or rule[key] == config.get(key)
+            for key in (CONF_UNIT_OF_MEASUREMENT, CONF_DEVICE_CLASS)
+        ):
+            return rule
+    return None
+
+
+def _publish_policy_variable(policy):
+    """One instance for every distinct set of limits, shared by the sensors using it."""
+    key = (
+        policy[CONF_DELTA],
+        policy[CONF_MIN_INTERVAL].total_milliseconds,
+        policy[CONF_MAX_INTERVAL].total_milliseconds,
+    )
+    variables = CORE.data.setdefault(CONF_PUBLISH_POLICY, {})
+    if key not in variables:
+        policy_id = ID(
+            f"sensor_publish_policy_{len(variables)}",
+            is_declaration=True,
+            type=PublishPolicy,
+        )
+        variables[key] = cg.new_Pvariable(policy_id, *key)
+    return variables[key]
+
+
 async def setup_sensor_core_(var, config):
     await setup_entity(var, config, "sensor")
 
@@ -838,6 +900,9 @@ async def setup_sensor_core_(var, config):
     if config.get(CONF_FILTERS):  # must exist and not be empty
         filters = await build_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
+    if (policy := _find_publish_policy(config)) is not None:
+        cg.add_define("USE_SENSOR_PUBLISH_POLICY")
+        cg.add(var.set_publish_policy(_publish_policy_variable(policy)))
 
     for conf in config.get(CONF_ON_VALUE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -1144,6 +1209,16 @@ def _lstsq(a, b):
     return _mat_dot(_mat_dot(x, a_t), b)
 
 
+# Components that subscribe a callback to the state of every sensor that is not
+# internal. The controllers (api, web_server) are told through the sensor's
+# controller index instead and need no slot.
+STATE_SUBSCRIBER_COMPONENTS = ("mqtt",)
+
+
 @coroutine_with_priority(CoroPriority.CORE)
 async def to_code(config):
     cg.add_global(sensor_ns.using)
+    # Room for the subscribers of every sensor inline, triggers and other callbacks
+    # go to the heap, so sensors nobody subscribes to carry no empty slots
+    subscribers = sum(1 for name in STATE_SUBSCRIBER_COMPONENTS if name in CORE.config)
+    cg.add_define("ESPHOME_SENSOR_CALLBACK_CAPACITY", subscribers)
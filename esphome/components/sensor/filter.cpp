@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
@@ -26,47 +27,100 @@ void Filter::output(float value) {
     this->next_->input(value);
   }
 }
+size_t Filter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    optional<float> result = this->new_value(values[i]);
+    if (result.has_value())
+      values[out++] = *result;
+  }
+  return out;
+}
+void Filter::input_batch(float *values, size_t count) {
+  ESP_LOGVV(TAG, "Filter(%p)::input_batch(%zu values)", this, count);
+  count = this->new_values(values, count);
+  if (this->next_ != nullptr) {
+    if (count > 0)
+      this->next_->input_batch(values, count);
+    return;
+  }
+  for (size_t i = 0; i < count; i++)
+    this->parent_->internal_send_state_to_frontend(values[i]);
+}
 void Filter::initialize(Sensor *parent, Filter *next) {
   ESP_LOGVV(TAG, "Filter(%p)::initialize(parent=%p next=%p)", this, parent, next);
   this->parent_ = parent;
   this->next_ = next;
 }
 
+// SortedWindow
+SortedWindow::SortedWindow(size_t window_size) : queue_(window_size) { this->sorted_.reserve(window_size); }
+void SortedWindow::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  // Rebuild from the values that are left
+  this->sorted_.clear();
+  this->sorted_.reserve(window_size);
+  for (size_t i = 0; i < this->queue_.size(); i++) {
+    if (!std::isnan(this->queue_[i]))
+      this->sorted_.push_back(this->queue_[i]);
+  }
+  std::sort(this->sorted_.begin(), this->sorted_.end());
+}
+void SortedWindow::push(float value) {
+  if (this->queue_.full() && !this->queue_.empty()) {
+    float oldest = this->queue_.front();
+    if (!std::isnan(oldest)) {
+      // Equal values are interchangeable, so removing the first one equal to oldest is enough
+      this->sorted_.erase(std::lower_bound(this->sorted_.begin(), this->sorted_.end(), oldest));
+    }
+  }
+  this->queue_.push_back(value);
+  // Nothing is stored when the ring could not be allocated
+  if (!std::isnan(value) && !this->queue_.empty()) {
+    this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+  }
+}
+
+// MonotonicWindow
+MonotonicWindow::MonotonicWindow(size_t window_size, bool maximum)
+    : ring_(window_size), window_size_(window_size), maximum_(maximum) {}
+void MonotonicWindow::set_window_size(size_t window_size) {
+  // Entries dropped from the front are older than the new window anyway
+  this->ring_.set_capacity(window_size);
+  this->window_size_ = window_size;
+}
+void MonotonicWindow::push(float value) {
+  while (!this->ring_.empty() && this->index_ - this->ring_.front().index >= this->window_size_)
+    this->ring_.pop_front();
+  if (!std::isnan(value)) {
+    while (!this->ring_.empty() &&
+           (this->maximum_ ? this->ring_.back().value <= value : this->ring_.back().value >= value))
+      this->ring_.pop_back();
+    this->ring_.push_back(Entry{this->index_, value});
+  }
+  this->index_++;
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      median_queue.reserve(this->queue_.size());
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    const std::vector<float> &sorted = this->window_.sorted();
+    size_t queue_size = sorted.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = sorted[queue_size / 2];
+      } else {
+        median = (sorted[queue_size / 2] + sorted[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -91,38 +145,24 @@ optional<float> SkipInitialFilter::new_value(float value) {
 
 // QuantileFilter
 QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size), quantile_(quantile) {}
+    : window_(window_size), send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {}
 void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    const std::vector<float> &sorted = this->window_.sorted();
+    size_t queue_size = sorted.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
+      result = sorted[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -133,26 +173,17 @@ optional<float> QuantileFilter::new_value(float value) {
 
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size, false), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
-
+    float min = this->window_.get();
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
   }
@@ -161,26 +192,17 @@ optional<float> MinFilter::new_value(float value) {
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : window_(window_size, true), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
-
+    float max = this->window_.get();
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
   }
@@ -190,13 +212,12 @@ optional<float> MaxFilter::new_value(float value) {
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : queue_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
   this->queue_.push_back(value);
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
@@ -205,7 +226,8 @@ optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
 
     float sum = 0;
     size_t valid_count = 0;
-    for (auto v : this->queue_) {
+    for (size_t i = 0; i < this->queue_.size(); i++) {
+      float v = this->queue_[i];
       if (!std::isnan(v)) {
         sum += v;
         valid_count++;
@@ -293,11 +315,25 @@ optional<float> LambdaFilter::new_value(float value) {
 OffsetFilter::OffsetFilter(TemplatableValue<float> offset) : offset_(std::move(offset)) {}
 
 optional<float> OffsetFilter::new_value(float value) { return value + this->offset_.value(); }
+size_t OffsetFilter::new_values(float *values, size_t count) {
+  // The offset is evaluated once per block, the loop is then simple enough to be vectorised
+  const float offset = this->offset_.value();
+  for (size_t i = 0; i < count; i++)
+    values[i] += offset;
+  return count;
+}
 
 // MultiplyFilter
 MultiplyFilter::MultiplyFilter(TemplatableValue<float> multiplier) : multiplier_(std::move(multiplier)) {}
 
 optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_.value(); }
+size_t MultiplyFilter::new_values(float *values, size_t count) {
+  // The multiplier is evaluated once per block, the loop is then simple enough to be vectorised
+  const float multiplier = this->multiplier_.value();
+  for (size_t i = 0; i < count; i++)
+    values[i] *= multiplier;
+  return count;
+}
 
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(std::vector<TemplatableValue<float>> values_to_filter_out)
@@ -469,6 +505,16 @@ optional<float> CalibrateLinearFilter::new_value(float value) {
   }
   return NAN;
 }
+size_t CalibrateLinearFilter::new_values(float *values, size_t count) {
+  // A single segment covering every value is a plain multiply-add over the block
+  if (this->linear_functions_.size() != 1 || std::isfinite(this->linear_functions_[0][2]))
+    return Filter::new_values(values, count);
+  const float slope = this->linear_functions_[0][0];
+  const float bias = this->linear_functions_[0][1];
+  for (size_t i = 0; i < count; i++)
+    values[i] = values[i] * slope + bias;
+  return count;
+}
 
 optional<float> CalibratePolynomialFilter::new_value(float value) {
   float res = 0.0f;
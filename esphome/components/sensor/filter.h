@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <queue>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "esphome/core/automation.h"
@@ -30,11 +33,25 @@ class Filter {
    */
   virtual optional<float> new_value(float value) = 0;
 
+  /** Filter a block of values in place.
+   *
+   * Filters that can process a block faster than value by value override this, the default calls new_value() for
+   * each value.
+   *
+   * @param values The values, the outputs are written to the front of it in order.
+   * @param count The number of values.
+   * @return The number of outputs.
+   */
+  virtual size_t new_values(float *values, size_t count);
+
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(Sensor *parent, Filter *next);
 
   void input(float value);
 
+  /// Pass a block of values through this filter and the rest of the chain, values is used as scratch space.
+  void input_batch(float *values, size_t count);
+
   void output(float value);
 
  protected:
@@ -44,6 +61,132 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/// Windows of at least this many bytes prefer PSRAM, smaller ones stay in the faster internal RAM.
+static const size_t FILTER_RING_PSRAM_THRESHOLD = 1024;
+
+/** Fixed-capacity ring holding the window of a filter.
+ *
+ * The storage is allocated once when the filter is created, so pushing values never allocates and the window stays
+ * contiguous in memory.
+ */
+template<typename T> class FilterRing {
+  static_assert(std::is_trivially_copyable<T>::value, "FilterRing only holds trivially copyable values");
+
+ public:
+  explicit FilterRing(size_t capacity) { this->set_capacity(capacity); }
+  ~FilterRing() { this->release_(); }
+  FilterRing(const FilterRing &) = delete;
+  FilterRing &operator=(const FilterRing &) = delete;
+
+  /// Change the capacity, keeping the newest values that still fit.
+  void set_capacity(size_t capacity) {
+    if (capacity == this->capacity_)
+      return;
+    T *data = nullptr;
+    if (capacity > 0) {
+      RAMAllocator<T> allocator(capacity * sizeof(T) >= FILTER_RING_PSRAM_THRESHOLD ? RAMAllocator<T>::NONE
+                                                                                     : RAMAllocator<T>::ALLOC_INTERNAL);
+      data = allocator.allocate(capacity);
+      if (data == nullptr)
+        capacity = 0;
+    }
+    const size_t keep = std::min(this->size_, capacity);
+    for (size_t i = 0; i < keep; i++)
+      data[i] = (*this)[this->size_ - keep + i];
+    this->release_();
+    this->data_ = data;
+    this->capacity_ = capacity;
+    this->head_ = 0;
+    this->size_ = keep;
+  }
+
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+  /// The i-th oldest value.
+  const T &operator[](size_t i) const { return this->data_[this->wrap_(this->head_ + i)]; }
+  const T &front() const { return this->data_[this->head_]; }
+  const T &back() const { return (*this)[this->size_ - 1]; }
+
+  /// Append value, dropping the oldest one when the ring is full.
+  void push_back(const T &value) {
+    if (this->capacity_ == 0)
+      return;
+    if (this->full())
+      this->pop_front();
+    this->data_[this->wrap_(this->head_ + this->size_)] = value;
+    this->size_++;
+  }
+  void pop_front() {
+    this->head_ = this->wrap_(this->head_ + 1);
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+
+ protected:
+  size_t wrap_(size_t i) const { return i >= this->capacity_ ? i - this->capacity_ : i; }
+  void release_() {
+    if (this->data_ != nullptr) {
+      RAMAllocator<T> allocator;
+      allocator.deallocate(this->data_, this->capacity_);
+      this->data_ = nullptr;
+    }
+  }
+
+  T *data_{nullptr};
+  size_t capacity_{0};
+  size_t head_{0};
+  size_t size_{0};
+};
+
+/** Sliding window that also keeps its values sorted.
+ *
+ * Values are kept in arrival order to know which one leaves the window, and all non-NaN values are kept sorted next
+ * to them. Each push finds the insertion and eviction points with a binary search, so order statistics of the window
+ * never need a copy and sort of the whole window.
+ */
+class SortedWindow {
+ public:
+  explicit SortedWindow(size_t window_size);
+
+  void set_window_size(size_t window_size);
+  /// Add value, dropping the oldest value when the window is full.
+  void push(float value);
+  /// The non-NaN values of the window in ascending order.
+  const std::vector<float> &sorted() const { return this->sorted_; }
+
+ protected:
+  FilterRing<float> queue_;
+  std::vector<float> sorted_;
+};
+
+/** Minimum or maximum of a sliding window in O(1) amortised per value.
+ *
+ * Only values that can still become the extreme are kept: a new value drops every older one it beats, so the ring
+ * stays ordered and its front is the extreme of the window.
+ */
+class MonotonicWindow {
+ public:
+  MonotonicWindow(size_t window_size, bool maximum);
+
+  void set_window_size(size_t window_size);
+  void push(float value);
+  /// Extreme of the window, NaN when the window holds no number.
+  float get() const { return this->ring_.empty() ? NAN : this->ring_.front().value; }
+
+ protected:
+  struct Entry {
+    uint32_t index;
+    float value;
+  };
+
+  FilterRing<Entry> ring_;
+  size_t window_size_;
+  uint32_t index_{0};  // Index of the next value
+  bool maximum_;
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -68,10 +211,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -97,10 +239,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -143,10 +284,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -171,10 +311,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -200,10 +339,9 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FilterRing<float> queue_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -277,6 +415,7 @@ class OffsetFilter : public Filter {
   explicit OffsetFilter(TemplatableValue<float> offset);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   TemplatableValue<float> offset_;
@@ -287,6 +426,7 @@ class MultiplyFilter : public Filter {
  public:
   explicit MultiplyFilter(TemplatableValue<float> multiplier);
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   TemplatableValue<float> multiplier_;
@@ -411,6 +551,7 @@ class CalibrateLinearFilter : public Filter {
   CalibrateLinearFilter(std::vector<std::array<float, 3>> linear_functions)
       : linear_functions_(std::move(linear_functions)) {}
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   std::vector<std::array<float, 3>> linear_functions_;
@@ -1,6 +1,10 @@
 #include "sensor.h"
+#include "esphome/core/controller.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <cmath>
+
 namespace esphome {
 namespace sensor {
 
@@ -85,6 +89,27 @@ void Sensor::publish_state(float state) {
   }
 }
 
+void Sensor::publish_states(float *states, size_t count) {
+  if (count == 0)
+    return;
+  if (this->raw_callback_) {
+    for (size_t i = 0; i < count; i++) {
+      this->raw_state = states[i];
+      this->raw_callback_->call(states[i]);
+    }
+  }
+  this->raw_state = states[count - 1];
+
+  ESP_LOGV(TAG, "'%s': Received %zu new states", this->name_.c_str(), count);
+
+  if (this->filter_list_ == nullptr) {
+    for (size_t i = 0; i < count; i++)
+      this->internal_send_state_to_frontend(states[i]);
+  } else {
+    this->filter_list_->input_batch(states, count);
+  }
+}
+
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   if (!this->raw_callback_) {
@@ -126,12 +151,39 @@ float Sensor::get_state() const { return this->state; }
 float Sensor::get_raw_state() const { return this->raw_state; }
 
 void Sensor::internal_send_state_to_frontend(float state) {
+#ifdef USE_SENSOR_PUBLISH_POLICY
+  if (this->publish_policy_ != nullptr && !this->publish_policy_allows_(state)) {
+    ESP_LOGV(TAG, "'%s': Publish policy dropped state %f", this->name_.c_str(), state);
+    return;
+  }
+#endif
   this->set_has_state(true);
   this->state = state;
   ESP_LOGD(TAG, "'%s': Sending state %.5f %s with %d decimals of accuracy", this->get_name().c_str(), state,
            this->get_unit_of_measurement_ref().c_str(), this->get_accuracy_decimals());
+  if (this->controller_index_ != NO_CONTROLLER_INDEX)
+    Controller::mark_sensor_updated(this->controller_index_);
   this->callback_.call(state);
 }
 
+#ifdef USE_SENSOR_PUBLISH_POLICY
+bool Sensor::publish_policy_allows_(float state) {
+  const uint32_t now = millis();
+  // The first state and changes between a number and NAN always go out
+  if (this->has_state() && std::isnan(state) == std::isnan(this->state)) {
+    const PublishPolicy &policy = *this->publish_policy_;
+    const uint32_t elapsed = now - this->last_publish_;
+    if (elapsed < policy.min_interval)
+      return false;
+    const bool heartbeat = policy.max_interval != 0 && elapsed >= policy.max_interval;
+    // Compared to the last published state, so slow drifts still get through
+    if (!heartbeat && (std::isnan(state) || std::fabs(state - this->state) < policy.delta))
+      return false;
+  }
+  this->last_publish_ = now;
+  return true;
+}
+#endif
+
 }  // namespace sensor
 }  // namespace esphome
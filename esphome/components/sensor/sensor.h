@@ -35,6 +35,25 @@ enum StateClass : uint8_t {
 
 const LogString *state_class_to_string(StateClass state_class);
 
+#ifdef USE_SENSOR_PUBLISH_POLICY
+/** Limits which filtered states a sensor passes on to its subscribers and the controllers.
+ *
+ * Codegen picks the policy of every sensor from the publish_policy: rules or its own override, sensors with the same
+ * limits share one instance.
+ */
+struct PublishPolicy {
+  PublishPolicy(float delta, uint32_t min_interval, uint32_t max_interval)
+      : delta(delta), min_interval(min_interval), max_interval(max_interval) {}
+
+  /// States closer than this to the last published one are dropped.
+  const float delta;
+  /// States arriving sooner than this after the last published one are dropped, in ms.
+  const uint32_t min_interval;
+  /// After this long the next state is published even inside the deadband, in ms. 0 disables it.
+  const uint32_t max_interval;
+};
+#endif
+
 /** Base-class for all sensors.
  *
  * A sensor has unit of measurement and can use publish_state to send out a new value with the specified accuracy.
@@ -99,10 +118,23 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a block of states at once, as if publish_state() was called for each of them in order.
+   *
+   * Meant for sensors sampling at high rates: the block passes through each filter in one call instead of one virtual
+   * call chain per sample, and filters with a block implementation process it in a single loop.
+   *
+   * @param states The states, overwritten with intermediate filter results.
+   * @param count The number of states.
+   */
+  void publish_states(float *states, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
   void add_on_state_callback(std::function<void(float)> &&callback);
+  /// Add a callback that will be called every time a filtered value arrives, small lambdas are stored inline.
+  template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, std::function<void(float)>>>>
+  void add_on_state_callback(F &&callback) { this->callback_.add(std::forward<F>(callback)); }
   /// Add a callback that will be called every time the sensor sends a raw value.
   void add_on_raw_state_callback(std::function<void(float)> &&callback);
 
@@ -123,13 +155,33 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
 
   void internal_send_state_to_frontend(float state);
 
+  /// Let the controllers know about every new state without a callback, set by Controller::setup_controller().
+  void set_controller_index(uint16_t index) { this->controller_index_ = index; }
+
+#ifdef USE_SENSOR_PUBLISH_POLICY
+  /// Drop filtered states the policy considers redundant before they reach anyone, nullptr publishes all of them.
+  void set_publish_policy(const PublishPolicy *publish_policy) { this->publish_policy_ = publish_policy; }
+#endif
+
  protected:
+  static constexpr uint16_t NO_CONTROLLER_INDEX = UINT16_MAX;
+
+#ifdef USE_SENSOR_PUBLISH_POLICY
+  /// Whether state passes the publish policy, records the time of the publish if it does.
+  bool publish_policy_allows_(float state);
+
+  const PublishPolicy *publish_policy_{nullptr};
+  uint32_t last_publish_{0};
+#endif
+
   std::unique_ptr<CallbackManager<void(float)>> raw_callback_;  ///< Storage for raw state callbacks (lazy allocated).
-  CallbackManager<void(float)> callback_;                       ///< Storage for filtered state callbacks.
+  /// Storage for filtered state callbacks, with room inline for the subscribers picked by codegen.
+  StaticCallbackManager<void(float), ESPHOME_SENSOR_CALLBACK_CAPACITY> callback_;
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
   // Group small members together to avoid padding
+  uint16_t controller_index_{NO_CONTROLLER_INDEX};  ///< Position in App.get_sensors() for the controllers
   int8_t accuracy_decimals_{-1};              ///< Accuracy in decimals (-1 = not set)
   StateClass state_class_{STATE_CLASS_NONE};  ///< State class (STATE_CLASS_NONE = not set)
 
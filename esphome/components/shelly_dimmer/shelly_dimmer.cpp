@@ -78,18 +78,9 @@ void ShellyDimmer::handle_firmware() {
 
   if (!is_running_configured_version()) {
 #ifdef USE_SHD_FIRMWARE_DATA
-    if (!this->upgrade_firmware_()) {
+    if (!this->start_firmware_upgrade_()) {
       ESP_LOGW(TAG, "Failed to upgrade firmware");
       this->mark_failed();
-      return;
-    }
-
-    this->reset_normal_boot_();
-    this->send_command_(SHELLY_DIMMER_PROTO_CMD_VERSION, nullptr, 0);
-    if (!is_running_configured_version()) {
-      ESP_LOGE(TAG, "STM32 firmware upgrade already performed, but version is still incorrect");
-      this->mark_failed();
-      return;
     }
 #else
     ESP_LOGW(TAG, "Firmware version mismatch, put 'update: true' in the yaml to flash an update.");
@@ -102,7 +93,29 @@ void ShellyDimmer::setup() {
   this->pin_boot0_->setup();
 
   this->handle_firmware();
+  if (this->is_failed())
+    return;
+#ifdef USE_SHD_FIRMWARE_DATA
+  // The upgrade goes on from loop(), which starts the dimmer once it is done.
+  if (this->stm32_)
+    return;
+#endif
+
+  this->start_dimmer_();
+  this->disable_loop();
+}
+
+void ShellyDimmer::loop() {
+#ifdef USE_SHD_FIRMWARE_DATA
+  if (this->stm32_) {
+    this->continue_firmware_upgrade_();
+    return;
+  }
+#endif
+  this->disable_loop();
+}
 
+void ShellyDimmer::start_dimmer_() {
   this->send_settings_();
   // Do an immediate poll to refresh current state.
   this->send_command_(SHELLY_DIMMER_PROTO_CMD_POLL, nullptr, 0);
@@ -110,7 +123,13 @@ void ShellyDimmer::setup() {
   this->ready_ = true;
 }
 
-void ShellyDimmer::update() { this->send_command_(SHELLY_DIMMER_PROTO_CMD_POLL, nullptr, 0); }
+void ShellyDimmer::update() {
+  // Polls would end up in the bootloader while the firmware is written.
+  if (!this->ready_) {
+    return;
+  }
+  this->send_command_(SHELLY_DIMMER_PROTO_CMD_POLL, nullptr, 0);
+}
 
 void ShellyDimmer::dump_config() {
   ESP_LOGCONFIG(TAG, "ShellyDimmer:");
@@ -158,11 +177,10 @@ void ShellyDimmer::write_state(light::LightState *state) {
   this->send_brightness_(brightness_int);
 }
 #ifdef USE_SHD_FIRMWARE_DATA
-bool ShellyDimmer::upgrade_firmware_() {
+bool ShellyDimmer::start_firmware_upgrade_() {
   ESP_LOGW(TAG, "Starting STM32 firmware upgrade");
   this->reset_dfu_boot_();
 
-  // Cleanup with RAII
   auto stm32 = stm32_init(this, STREAM_SERIAL, 1);
 
   if (!stm32) {
@@ -176,39 +194,45 @@ bool ShellyDimmer::upgrade_firmware_() {
     return false;
   }
 
-  static constexpr uint32_t BUFFER_SIZE = 256;
-
-  // Copy the STM32 firmware over in 256-byte chunks. Note that the firmware is stored
-  // in flash memory so all accesses need to be 4-byte aligned.
-  uint8_t buffer[BUFFER_SIZE];
-  const uint8_t *p = STM_FIRMWARE;
-  uint32_t offset = 0;
-  uint32_t addr = stm32->dev->fl_start;
-  const uint32_t end = addr + STM_FIRMWARE_SIZE_IN_BYTES;
-
-  while (addr < end && offset < STM_FIRMWARE_SIZE_IN_BYTES) {
-    const uint32_t left_of_buffer = std::min(end - addr, BUFFER_SIZE);
-    const uint32_t len = std::min(left_of_buffer, STM_FIRMWARE_SIZE_IN_BYTES - offset);
+  this->stm32_ = std::move(stm32);
+  this->firmware_offset_ = 0;
+  return true;
+}
 
-    if (len == 0) {
-      break;
-    }
+void ShellyDimmer::continue_firmware_upgrade_() {
+  if (this->firmware_offset_ < STM_FIRMWARE_SIZE_IN_BYTES) {
+    // Largest block a single write memory command of the bootloader takes.
+    static constexpr uint32_t BUFFER_SIZE = 256;
 
-    std::memcpy(buffer, p, BUFFER_SIZE);
-    p += BUFFER_SIZE;
+    // Note that the firmware is stored in flash memory so all accesses need to be 4-byte aligned.
+    uint8_t buffer[BUFFER_SIZE];
+    const uint32_t len = std::min(BUFFER_SIZE, STM_FIRMWARE_SIZE_IN_BYTES - this->firmware_offset_);
+    std::memcpy(buffer, STM_FIRMWARE + this->firmware_offset_, BUFFER_SIZE);
 
-    if (stm32_write_memory(stm32, addr, buffer, len) != STM32_ERR_OK) {
+    const uint32_t addr = this->stm32_->dev->fl_start + this->firmware_offset_;
+    if (stm32_write_memory(this->stm32_, addr, buffer, len) != STM32_ERR_OK) {
       ESP_LOGW(TAG, "Failed to write to STM32 flash memory");
-      return false;
+      this->stm32_.reset();
+      this->mark_failed();
+      return;
     }
-
-    addr += len;
-    offset += len;
+    this->firmware_offset_ += len;
+    return;
   }
 
+  this->stm32_.reset();
   ESP_LOGI(TAG, "STM32 firmware upgrade successful");
 
-  return true;
+  this->reset_normal_boot_();
+  this->send_command_(SHELLY_DIMMER_PROTO_CMD_VERSION, nullptr, 0);
+  if (!is_running_configured_version()) {
+    ESP_LOGE(TAG, "STM32 firmware upgrade already performed, but version is still incorrect");
+    this->mark_failed();
+    return;
+  }
+
+  this->start_dimmer_();
+  this->disable_loop();
 }
 #endif
 
@@ -3,10 +3,14 @@
 #ifdef USE_ESP8266
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/log.h"
 #include "esphome/components/light/light_output.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/uart/uart.h"
+#ifdef USE_SHD_FIRMWARE_DATA
+#include "stm32flash.h"
+#endif
 
 #include <array>
 
@@ -23,6 +27,7 @@ class ShellyDimmer : public PollingComponent, public light::LightOutput, public
   bool is_running_configured_version() const;
   void handle_firmware();
   void setup() override;
+  void loop() override;
   void update() override;
   void dump_config() override;
 
@@ -78,6 +83,12 @@ class ShellyDimmer : public PollingComponent, public light::LightOutput, public
   bool ready_{false};
   uint16_t brightness_;
 
+#ifdef USE_SHD_FIRMWARE_DATA
+  // Open bootloader session while an upgrade is in progress, loop() writes one page per call.
+  stm32_unique_ptr stm32_{nullptr, nullptr};
+  uint32_t firmware_offset_{0};
+#endif
+
   /// Convert relative brightness into a dimmer brightness value.
   uint16_t convert_brightness_(float brightness);
 
@@ -87,8 +98,14 @@ class ShellyDimmer : public PollingComponent, public light::LightOutput, public
   /// Sends dimmer configuration.
   void send_settings_();
 
-  /// Performs a firmware upgrade.
-  bool upgrade_firmware_();
+  /// Sends the settings and the first poll once the STM32 runs the configured firmware.
+  void start_dimmer_();
+
+  /// Enters the bootloader and erases the flash, the firmware is then written from loop().
+  bool start_firmware_upgrade_();
+
+  /// Writes the next page of the firmware, or checks the new version once all are written.
+  void continue_firmware_upgrade_();
 
   /// Sends a command and waits for an acknowledgement.
   bool send_command_(uint8_t cmd, const uint8_t *payload, uint8_t len);
@@ -27,6 +27,7 @@
 #include "debug.h"
 
 #include "dev_table.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
 #include <algorithm>
@@ -147,9 +148,11 @@ stm32_err_t stm32_get_ack_timeout(const stm32_unique_ptr &stm, uint32_t timeout)
 
   const uint32_t start_time = millis();
   do {
+    // A mass erase keeps the bootloader busy for seconds.
+    App.feed_wdt();
     yield();
     if (!stream->available()) {
-      if (millis() < start_time + timeout)
+      if (millis() - start_time < timeout)
         continue;
       ESP_LOGD(TAG, "Failed to read ACK timeout=%i", timeout);
       return STM32_ERR_UNKNOWN;
@@ -717,19 +720,7 @@ stm32_err_t stm32_write_memory(const stm32_unique_ptr &stm, uint32_t address, co
     return STM32_ERR_NO_CMD;
   }
 
-  /* send the address and checksum */
-  if (stm32_send_command(stm, stm->cmd->wm) != STM32_ERR_OK)
-    return STM32_ERR_UNKNOWN;
-
-  static constexpr auto BUFFER_SIZE = 5;
-  uint8_t buf1[BUFFER_SIZE];
-  populate_buffer_with_address(buf1, address);
-
-  stream->write_array(buf1, BUFFER_SIZE);
-  stream->flush();
-  if (stm32_get_ack(stm) != STM32_ERR_OK)
-    return STM32_ERR_UNKNOWN;
-
+  /* build the data frame up front so it follows the address ACK without a gap */
   const unsigned int aligned_len = (len + 3) & ~3;
   uint8_t cs = aligned_len - 1;
   uint8_t buf[256 + 2];
@@ -745,6 +736,20 @@ stm32_err_t stm32_write_memory(const stm32_unique_ptr &stm, uint32_t address, co
     buf[i + 1] = 0xFF;
   }
   buf[aligned_len + 1] = cs;
+
+  /* send the address and checksum */
+  if (stm32_send_command(stm, stm->cmd->wm) != STM32_ERR_OK)
+    return STM32_ERR_UNKNOWN;
+
+  static constexpr auto BUFFER_SIZE = 5;
+  uint8_t buf1[BUFFER_SIZE];
+  populate_buffer_with_address(buf1, address);
+
+  stream->write_array(buf1, BUFFER_SIZE);
+  stream->flush();
+  if (stm32_get_ack(stm) != STM32_ERR_OK)
+    return STM32_ERR_UNKNOWN;
+
   stream->write_array(buf, aligned_len + 2);
   stream->flush();
 
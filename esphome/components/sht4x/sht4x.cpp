@@ -62,43 +62,60 @@ void SHT4XComponent::dump_config() {
 }
 
 void SHT4XComponent::update() {
-  // Send command
-  if (!this->write_command(MEASURECOMMANDS[this->precision_])) {
-    // Warning will be printed only if warning status is not set yet
-    this->status_set_warning(LOG_STR("Failed to send measurement command"));
+  // The previous measurement is still on the bus
+  if (this->measuring_)
     return;
-  }
-
-  this->set_timeout(10, [this]() {
-    uint16_t buffer[2];
-
-    // Read measurement
-    if (!this->read_data(buffer, 2)) {
-      // Using ESP_LOGW to force the warning to be printed
-      ESP_LOGW(TAG, "Sensor read failed");
-      this->status_set_warning();
+  this->measuring_ = true;
+
+  // Send command, the bus transfers it without blocking the loop
+  const uint8_t command = MEASURECOMMANDS[this->precision_];
+  this->write_read_async(&command, 1, nullptr, 0, [this](i2c::ErrorCode err) {
+    if (err != i2c::ERROR_OK) {
+      this->measuring_ = false;
+      // Warning will be printed only if warning status is not set yet
+      this->status_set_warning(LOG_STR("Failed to send measurement command"));
       return;
     }
+    this->set_timeout(10, [this]() { this->read_measurement_(); });
+  });
+}
 
-    this->status_clear_warning();
+void SHT4XComponent::read_measurement_() {
+  this->write_read_async(nullptr, 0, this->raw_, sizeof(this->raw_), [this](i2c::ErrorCode err) {
+    this->measuring_ = false;
+    this->publish_measurement_(err);
+  });
+}
 
-    // Evaluate and publish measurements
-    if (this->temp_sensor_ != nullptr) {
-      // Temp is contained in the first result word
-      float sensor_value_temp = buffer[0];
-      float temp = -45 + 175 * sensor_value_temp / 65535;
+void SHT4XComponent::publish_measurement_(i2c::ErrorCode err) {
+  uint16_t buffer[2];
 
-      this->temp_sensor_->publish_state(temp);
-    }
+  this->last_error_ = err;
+  if (err != i2c::ERROR_OK || !this->decode_data_(this->raw_, buffer, 2)) {
+    // Using ESP_LOGW to force the warning to be printed
+    ESP_LOGW(TAG, "Sensor read failed");
+    this->status_set_warning();
+    return;
+  }
 
-    if (this->humidity_sensor_ != nullptr) {
-      // Relative humidity is in the second result word
-      float sensor_value_rh = buffer[1];
-      float rh = -6 + 125 * sensor_value_rh / 65535;
+  this->status_clear_warning();
 
-      this->humidity_sensor_->publish_state(rh);
-    }
-  });
+  // Evaluate and publish measurements
+  if (this->temp_sensor_ != nullptr) {
+    // Temp is contained in the first result word
+    float sensor_value_temp = buffer[0];
+    float temp = -45 + 175 * sensor_value_temp / 65535;
+
+    this->temp_sensor_->publish_state(temp);
+  }
+
+  if (this->humidity_sensor_ != nullptr) {
+    // Relative humidity is in the second result word
+    float sensor_value_rh = buffer[1];
+    float rh = -6 + 125 * sensor_value_rh / 65535;
+
+    this->humidity_sensor_->publish_state(rh);
+  }
 }
 
 }  // namespace sht4x
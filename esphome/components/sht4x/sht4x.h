@@ -36,8 +36,14 @@ class SHT4XComponent : public PollingComponent, public sensirion_common::Sensiri
   float duty_cycle_;
 
   void start_heater_();
+  void read_measurement_();
+  void publish_measurement_(i2c::ErrorCode err);
   uint8_t heater_command_;
 
+  // Measurement read in the background, 2 words with their CRC
+  uint8_t raw_[6];
+  bool measuring_{false};
+
   sensor::Sensor *temp_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
 };
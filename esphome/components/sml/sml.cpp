@@ -3,6 +3,8 @@
 #include "esphome/core/log.h"
 #include "sml_parser.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace sml {
 
@@ -10,6 +12,8 @@ static const char *const TAG = "sml";
 
 const char START_BYTES_DETECTED = 1;
 const char END_BYTES_DETECTED = 2;
+// Largest SML file kept, meters send a few hundred bytes
+static const size_t MAX_SML_FILE_SIZE = 4096;
 
 SmlListener::SmlListener(std::string server_id, std::string obis_code)
     : server_id(std::move(server_id)), obis_code(std::move(obis_code)) {}
@@ -25,80 +29,94 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
+  // Move what the UART has buffered in chunks instead of one virtual read() per byte
+  uint8_t chunk[64];
+  int available;
+  while ((available = this->available()) > 0) {
+    const size_t to_read = std::min(static_cast<size_t>(available), sizeof(chunk));
+    if (!this->read_array(chunk, to_read))
+      return;
+    for (size_t i = 0; i < to_read; i++)
+      this->process_byte_(chunk[i]);
+  }
+}
 
-    if (this->record_)
+void Sml::process_byte_(uint8_t c) {
+  if (this->record_) {
+    if (this->sml_data_.size() >= MAX_SML_FILE_SIZE) {
+      // Noise or a lost end sequence, do not let the buffer grow without bound
+      ESP_LOGW(TAG, "SML file larger than %zu bytes, dropping it", MAX_SML_FILE_SIZE);
+      this->record_ = false;
+      this->sml_data_.clear();
+    } else {
       this->sml_data_.emplace_back(c);
+    }
+  }
 
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
-      };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->process_sml_file_(
-              BytesView(this->sml_data_).subview(START_SEQ.size(), this->sml_data_.size() - START_SEQ.size() - 8));
-        }
-        break;
-      };
+  switch (this->check_start_end_bytes_(c)) {
+    case START_BYTES_DETECTED: {
+      this->record_ = true;
+      this->sml_data_.clear();
+      // add start sequence (for callbacks)
+      this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
+      break;
     };
-  }
+    case END_BYTES_DETECTED: {
+      if (this->record_) {
+        this->record_ = false;
+
+        bool valid = check_sml_data(this->sml_data_);
+
+        // call callbacks
+        this->data_callbacks_.call(this->sml_data_, valid);
+
+        if (!valid)
+          break;
+
+        // remove start/end sequence
+        this->process_sml_file_(
+            BytesView(this->sml_data_).subview(START_SEQ.size(), this->sml_data_.size() - START_SEQ.size() - 8));
+      }
+      break;
+    };
+  };
 }
 
-void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
+void Sml::add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback) {
   this->data_callbacks_.add(std::move(callback));
 }
 
 void Sml::process_sml_file_(const BytesView &sml_data) {
-  SmlFile sml_file(sml_data);
-  std::vector<ObisInfo> obis_info = sml_file.get_obis_info();
-  this->publish_obis_info_(obis_info);
-
-  this->log_obis_info_(obis_info);
+  ESP_LOGD(TAG, "OBIS info:");
+  // Every record is published as soon as it is read, no list of them is built
+  SmlFile(sml_data).for_each_obis_info([this](const ObisInfo &obis_info) {
+    this->publish_value_(obis_info);
+    this->log_obis_info_(obis_info);
+  });
 }
 
-void Sml::log_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
+void Sml::log_obis_info_(const ObisInfo &obis_info) {
 #ifdef ESPHOME_LOG_HAS_DEBUG
-  ESP_LOGD(TAG, "OBIS info:");
-  for (auto const &obis_info : obis_info_vec) {
-    std::string info;
-    info += "  (" + bytes_repr(obis_info.server_id) + ") ";
-    info += obis_info.code_repr();
-    info += " [0x" + bytes_repr(obis_info.value) + "]";
-    ESP_LOGD(TAG, "%s", info.c_str());
-  }
+  std::string info;
+  info += "  (" + bytes_repr(obis_info.server_id) + ") ";
+  info += obis_info.code_repr();
+  info += " [0x" + bytes_repr(obis_info.value) + "]";
+  ESP_LOGD(TAG, "%s", info.c_str());
 #endif
 }
 
-void Sml::publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  for (auto const &obis_info : obis_info_vec) {
-    this->publish_value_(obis_info);
-  }
-}
-
 void Sml::publish_value_(const ObisInfo &obis_info) {
   const auto obis_code = obis_info.code_repr();
+  std::string server_id;
   for (auto const &sml_listener : sml_listeners_) {
-    if ((!sml_listener->server_id.empty()) && (bytes_repr(obis_info.server_id) != sml_listener->server_id))
-      continue;
     if (obis_code != sml_listener->obis_code)
       continue;
+    if (!sml_listener->server_id.empty()) {
+      if (server_id.empty())
+        server_id = bytes_repr(obis_info.server_id);
+      if (server_id != sml_listener->server_id)
+        continue;
+    }
     sml_listener->publish_val(obis_info);
   }
 }
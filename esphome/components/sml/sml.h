@@ -24,18 +24,20 @@ class Sml : public Component, public uart::UARTDevice {
   void loop() override;
   void dump_config() override;
   std::vector<SmlListener *> sml_listeners_{};
-  void add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback);
+  /// The callback gets every received file with its start and end sequence, it must not keep a reference to it.
+  void add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback);
 
  protected:
+  void process_byte_(uint8_t byte);
   void process_sml_file_(const BytesView &sml_data);
-  void log_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
-  void publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
+  void log_obis_info_(const ObisInfo &obis_info);
   char check_start_end_bytes_(uint8_t byte);
   void publish_value_(const ObisInfo &obis_info);
 
   // Serial parser
   bool record_ = false;
   uint16_t incoming_mask_ = 0;
+  // Received file, its capacity is kept for the next one
   bytes sml_data_;
 
   CallbackManager<void(const std::vector<uint8_t> &, bool)> data_callbacks_{};
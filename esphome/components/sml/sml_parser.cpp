@@ -5,26 +5,20 @@
 namespace esphome {
 namespace sml {
 
-SmlFile::SmlFile(const BytesView &buffer) : buffer_(buffer) {
-  // extract messages
-  this->pos_ = 0;
-  while (this->pos_ < this->buffer_.size()) {
-    if (this->buffer_[this->pos_] == 0x00)
-      break;  // EndOfSmlMsg
+SmlFile::SmlFile(const BytesView &buffer) : buffer_(buffer) {}
 
-    SmlNode message;
-    if (!this->setup_node(&message))
-      break;
-    this->messages.emplace_back(std::move(message));
-  }
-}
+bool SmlFile::read_node_(SmlNode *node) {
+  if (this->pos_ >= this->buffer_.size())
+    return false;
 
-bool SmlFile::setup_node(SmlNode *node) {
   // If the TL field is 0x00, this is the end of the message
   // (see 6.3.1 of SML protocol definition)
   if (this->buffer_[this->pos_] == 0x00) {
     // Increment past this byte and signal that the message is done
     this->pos_ += 1;
+    node->type = SML_UNDEFINED;
+    node->list_length = 0;
+    node->value_bytes = BytesView();
     return true;
   }
 
@@ -35,6 +29,8 @@ bool SmlFile::setup_node(SmlNode *node) {
 
   // Check if we need additional length bytes
   if (overlength) {
+    if (this->pos_ + 1 >= this->buffer_.size())
+      return false;
     // Shift the current length to the higher nibble
     // and add the lower nibble of the next byte to the length
     length = (length << 4) + (this->buffer_[this->pos_ + 1] & 0x0f);
@@ -53,52 +49,108 @@ bool SmlFile::setup_node(SmlNode *node) {
 
   // We are done with the last TL field(s), so advance the position
   this->pos_ += 1;
-  // and decrement the length for non-list fields
-  if (type != SML_LIST)
-    length -= 1;
+  node->type = type;
 
+  if (type == SML_LIST) {
+    node->list_length = length;
+    node->value_bytes = BytesView();
+    return true;
+  }
+
+  // Decrement the length for non-list fields
+  length -= 1;
   // Check if the buffer length is long enough
   if (this->pos_ + length > this->buffer_.size())
     return false;
+  // Value starts at the current position
+  // Value ends "length" bytes later,
+  // (since the TL field is counted but already subtracted from length)
+  node->list_length = 0;
+  node->value_bytes = this->buffer_.subview(this->pos_, length);
+  // Increment the pointer past all consumed bytes
+  this->pos_ += length;
+  return true;
+}
 
-  node->type = type;
+bool SmlFile::read_value_(SmlNode *node) {
+  if (!this->read_node_(node))
+    return false;
+  return node->type != SML_LIST || this->skip_nodes_(node->list_length);
+}
 
-  if (type == SML_LIST) {
-    node->nodes.reserve(length);
-    for (size_t i = 0; i != length; i++) {
-      SmlNode child_node;
-      if (!this->setup_node(&child_node))
-        return false;
-      node->nodes.emplace_back(std::move(child_node));
-    }
-  } else {
-    // Value starts at the current position
-    // Value ends "length" bytes later,
-    // (since the TL field is counted but already subtracted from length)
-    node->value_bytes = buffer_.subview(this->pos_, length);
-    // Increment the pointer past all consumed bytes
-    this->pos_ += length;
+bool SmlFile::skip_nodes_(size_t count) {
+  // Children are counted instead of recursing, so deeply nested input cannot exhaust the stack
+  while (count > 0) {
+    SmlNode node;
+    if (!this->read_node_(&node))
+      return false;
+    count = count - 1 + node.list_length;
   }
   return true;
 }
 
-std::vector<ObisInfo> SmlFile::get_obis_info() {
-  std::vector<ObisInfo> obis_info;
-  for (auto const &message : messages) {
-    const auto &message_body = message.nodes[3];
-    uint16_t message_type = bytes_to_uint(message_body.nodes[0].value_bytes);
-    if (message_type != SML_GET_LIST_RES)
-      continue;
-
-    const auto &get_list_response = message_body.nodes[1];
-    const auto &server_id = get_list_response.nodes[1].value_bytes;
-    const auto &val_list = get_list_response.nodes[4];
+void SmlFile::for_each_obis_info(const std::function<void(const ObisInfo &)> &callback) {
+  this->pos_ = 0;
+  while (this->pos_ < this->buffer_.size()) {
+    if (this->buffer_[this->pos_] == 0x00)
+      break;  // EndOfSmlMsg
 
-    for (auto const &val_list_entry : val_list.nodes) {
-      obis_info.emplace_back(server_id, val_list_entry);
+    // Message: transactionId, groupNo, abortOnError, messageBody, crc16, endOfSmlMsg
+    SmlNode message;
+    if (!this->read_node_(&message) || message.type != SML_LIST || message.list_length < 4 || !this->skip_nodes_(3))
+      return;
+    // Message body: the message type followed by the message itself
+    SmlNode message_body;
+    SmlNode message_type;
+    if (!this->read_node_(&message_body) || message_body.type != SML_LIST || message_body.list_length < 2 ||
+        !this->read_value_(&message_type))
+      return;
+    if (bytes_to_uint(message_type.value_bytes) == SML_GET_LIST_RES) {
+      if (!this->read_get_list_response_(callback))
+        return;
+    } else if (!this->skip_nodes_(1)) {
+      return;
     }
+    if (!this->skip_nodes_(message_body.list_length - 2) || !this->skip_nodes_(message.list_length - 4))
+      return;
   }
-  return obis_info;
+}
+
+bool SmlFile::read_get_list_response_(const std::function<void(const ObisInfo &)> &callback) {
+  // GetListResponse: clientId, serverId, listName, actSensorTime, valList, listSignature, actGatewayTime
+  SmlNode response;
+  SmlNode server_id;
+  SmlNode val_list;
+  if (!this->read_node_(&response) || response.type != SML_LIST || response.list_length < 5 ||
+      !this->skip_nodes_(1) || !this->read_value_(&server_id) || !this->skip_nodes_(2) ||
+      !this->read_node_(&val_list) || val_list.type != SML_LIST)
+    return false;
+
+  for (size_t i = 0; i < val_list.list_length; i++) {
+    // ListEntry: objName, status, valTime, unit, scaler, value, valueSignature
+    SmlNode entry;
+    if (!this->read_node_(&entry) || entry.type != SML_LIST || entry.list_length < 6)
+      return false;
+    SmlNode code, status, unit, scaler, value;
+    if (!this->read_value_(&code) || !this->read_value_(&status) || !this->skip_nodes_(1) ||
+        !this->read_value_(&unit) || !this->read_value_(&scaler) || !this->read_value_(&value) ||
+        !this->skip_nodes_(entry.list_length - 6))
+      return false;
+    // code_repr() needs the five groups of the OBIS code
+    if (code.value_bytes.size() < 5)
+      continue;
+
+    ObisInfo obis_info;
+    obis_info.server_id = server_id.value_bytes;
+    obis_info.code = code.value_bytes;
+    obis_info.status = status.value_bytes;
+    obis_info.unit = bytes_to_uint(unit.value_bytes);
+    obis_info.scaler = bytes_to_int(scaler.value_bytes);
+    obis_info.value = value.value_bytes;
+    obis_info.value_type = value.type;
+    callback(obis_info);
+  }
+  return this->skip_nodes_(response.list_length - 5);
 }
 
 std::string bytes_repr(const BytesView &buffer) {
@@ -123,7 +175,7 @@ int64_t bytes_to_int(const BytesView &buffer) {
 
   // sign extension for abbreviations of leading ones (e.g. 3 byte transmissions, see 6.2.2 of SML protocol definition)
   // see https://stackoverflow.com/questions/42534749/signed-extension-from-24-bit-to-32-bit-in-c
-  if (buffer.size() < 8) {
+  if (buffer.size() > 0 && buffer.size() < 8) {
     const int bits = buffer.size() * 8;
     const uint64_t m = 1ull << (bits - 1);
     tmp = (tmp ^ m) - m;
@@ -135,16 +187,6 @@ int64_t bytes_to_int(const BytesView &buffer) {
 
 std::string bytes_to_string(const BytesView &buffer) { return std::string(buffer.begin(), buffer.end()); }
 
-ObisInfo::ObisInfo(const BytesView &server_id, const SmlNode &val_list_entry) : server_id(server_id) {
-  this->code = val_list_entry.nodes[0].value_bytes;
-  this->status = val_list_entry.nodes[1].value_bytes;
-  this->unit = bytes_to_uint(val_list_entry.nodes[3].value_bytes);
-  this->scaler = bytes_to_int(val_list_entry.nodes[4].value_bytes);
-  const auto &value_node = val_list_entry.nodes[5];
-  this->value = value_node.value_bytes;
-  this->value_type = value_node.type;
-}
-
 std::string ObisInfo::code_repr() const {
   return str_sprintf("%d-%d:%d.%d.%d", this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
 }
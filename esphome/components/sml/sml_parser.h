@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdio>
+#include <functional>
 #include <string>
 #include <vector>
 #include "constants.h"
@@ -41,36 +42,49 @@ class BytesView {
   size_t count_ = 0;
 };
 
-class SmlNode {
- public:
-  uint8_t type;
+/// Header of one node of an SML file, values are referenced in place.
+struct SmlNode {
+  uint8_t type{SML_UNDEFINED};
+  /// Number of child nodes of a list, they follow the header.
+  size_t list_length{0};
+  /// Bytes of a value, empty for lists and the end of a message.
   BytesView value_bytes;
-  std::vector<SmlNode> nodes;
 };
 
 class ObisInfo {
  public:
-  ObisInfo(const BytesView &server_id, const SmlNode &val_list_entry);
   BytesView server_id;
   BytesView code;
   BytesView status;
-  char unit;
-  char scaler;
+  char unit{0};
+  char scaler{0};
   BytesView value;
-  uint16_t value_type;
+  uint16_t value_type{SML_UNDEFINED};
   std::string code_repr() const;
 };
 
+/** Walks the messages of an SML file in place.
+ *
+ * No node tree is built: nodes are read one after the other and everything outside of the value lists of the
+ * GetListResponse messages is skipped, so parsing needs no memory beyond the received file.
+ */
 class SmlFile {
  public:
   SmlFile(const BytesView &buffer);
-  bool setup_node(SmlNode *node);
-  std::vector<SmlNode> messages;
-  std::vector<ObisInfo> get_obis_info();
+  /// Call callback for every entry of the value lists, in the order they appear in the file.
+  void for_each_obis_info(const std::function<void(const ObisInfo &)> &callback);
 
  protected:
+  /// Read the node header at pos_, the children of a list follow it.
+  bool read_node_(SmlNode *node);
+  /// Read a node whose value is needed, a list in its place is skipped and leaves the value empty.
+  bool read_value_(SmlNode *node);
+  /// Skip count nodes including all their children.
+  bool skip_nodes_(size_t count);
+  bool read_get_list_response_(const std::function<void(const ObisInfo &)> &callback);
+
   const BytesView buffer_;
-  size_t pos_;
+  size_t pos_{0};
 };
 
 std::string bytes_repr(const BytesView &buffer);
@@ -1,6 +1,7 @@
 from esphome import pins
 import esphome.codegen as cg
 from esphome.components import spi
+from esphome.components.gpio_expander import CONF_WRITE_COMBINING
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_CLOCK_PIN,
@@ -41,6 +42,7 @@ _COMMON_SCHEMA = cv.Schema(
         cv.Required(CONF_LATCH_PIN): pins.gpio_output_pin_schema,
         cv.Optional(CONF_OE_PIN): pins.gpio_output_pin_schema,
         cv.Optional(CONF_SR_COUNT, default=1): cv.int_range(min=1, max=256),
+        cv.Optional(CONF_WRITE_COMBINING, default=False): cv.boolean,
     }
 )
 
@@ -82,6 +84,7 @@ async def to_code(config):
         oe_pin = await cg.gpio_pin_expression(oe_pin)
         cg.add(var.set_oe_pin(oe_pin))
     cg.add(var.set_sr_count(config[CONF_SR_COUNT]))
+    cg.add(var.set_write_combining(config[CONF_WRITE_COMBINING]))
 
 
 def _validate_output_mode(value):
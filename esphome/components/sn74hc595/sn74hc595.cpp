@@ -38,7 +38,25 @@ void SN74HC595SPIComponent::setup() {
 }
 #endif
 
-void SN74HC595Component::dump_config() { ESP_LOGCONFIG(TAG, "SN74HC595:"); }
+void SN74HC595Component::loop() {
+  // Only runs while combined writes are pending
+  this->flush_writes();
+  this->disable_loop();
+}
+
+void SN74HC595Component::flush_writes() {
+  if (this->write_pending_) {
+    this->write_pending_ = false;
+    this->write_gpio();
+  }
+}
+
+void SN74HC595Component::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "SN74HC595:\n"
+                "  Write combining: %s",
+                YESNO(this->write_combining_));
+}
 
 void SN74HC595Component::digital_write_(uint16_t pin, bool value) {
   if (pin >= this->sr_count_ * 8) {
@@ -51,6 +69,11 @@ void SN74HC595Component::digital_write_(uint16_t pin, bool value) {
   } else {
     this->output_bytes_[pin / 8] &= ~(1 << (pin % 8));
   }
+  if (this->write_combining_) {
+    this->write_pending_ = true;
+    this->enable_loop();
+    return;
+  }
   this->write_gpio();
 }
 
@@ -19,6 +19,7 @@ class SN74HC595Component : public Component {
   SN74HC595Component() = default;
 
   void setup() override = 0;
+  void loop() override;
   float get_setup_priority() const override;
   void dump_config() override;
 
@@ -31,6 +32,10 @@ class SN74HC595Component : public Component {
     this->sr_count_ = count;
     this->output_bytes_.resize(count);
   }
+  /// Shift the chain out once per loop instead of on every pin write.
+  void set_write_combining(bool write_combining) { this->write_combining_ = write_combining; }
+  /// Shift out the pin writes collected since the last loop, for outputs that must change right away.
+  void flush_writes();
 
  protected:
   friend class SN74HC595GPIOPin;
@@ -44,6 +49,8 @@ class SN74HC595Component : public Component {
   GPIOPin *oe_pin_;
   uint8_t sr_count_;
   bool have_oe_pin_{false};
+  bool write_combining_{false};
+  bool write_pending_{false};
   std::vector<uint8_t> output_bytes_;
 };
 
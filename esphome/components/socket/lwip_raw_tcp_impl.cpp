@@ -303,26 +303,7 @@ class LWIPRawImpl : public Socket {
         break;
       size_t copysize = std::min(len, pb_left);
       memcpy(buf8, reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_, copysize);
-
-      if (pb_left == copysize) {
-        // full pb copied, free it
-        if (rx_buf_->next == nullptr) {
-          // last buffer in chain
-          pbuf_free(rx_buf_);
-          rx_buf_ = nullptr;
-          rx_buf_offset_ = 0;
-        } else {
-          auto *old_buf = rx_buf_;
-          rx_buf_ = rx_buf_->next;
-          pbuf_ref(rx_buf_);
-          pbuf_free(old_buf);
-          rx_buf_offset_ = 0;
-        }
-      } else {
-        rx_buf_offset_ += copysize;
-      }
-      LWIP_LOG("tcp_recved(%p %u)", pcb_, copysize);
-      tcp_recved(pcb_, copysize);
+      this->release_rx_(copysize);
 
       buf8 += copysize;
       len -= copysize;
@@ -336,6 +317,30 @@ class LWIPRawImpl : public Socket {
 
     return read;
   }
+  ssize_t peek_segment(uint8_t **data) override {
+    if (pcb_ == nullptr) {
+      errno = ECONNRESET;
+      return -1;
+    }
+    if (rx_buf_ == nullptr) {
+      if (rx_closed_)
+        return 0;
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    size_t pb_left = rx_buf_->len - rx_buf_offset_;
+    if (pb_left == 0) {
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    *data = reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_;
+    return pb_left;
+  }
+  void consume(size_t len) override {
+    if (pcb_ == nullptr || rx_buf_ == nullptr || len == 0)
+      return;
+    this->release_rx_(std::min(len, static_cast<size_t>(rx_buf_->len - rx_buf_offset_)));
+  }
   ssize_t readv(const struct iovec *iov, int iovcnt) override {
     ssize_t ret = 0;
     for (int i = 0; i < iovcnt; i++) {
@@ -499,6 +504,29 @@ class LWIPRawImpl : public Socket {
   }
 
  protected:
+  // Drop len bytes (at most the rest of the current pbuf) from the receive chain and open the window for them
+  void release_rx_(size_t len) {
+    if (rx_buf_->len - rx_buf_offset_ == len) {
+      // full pb consumed, free it
+      if (rx_buf_->next == nullptr) {
+        // last buffer in chain
+        pbuf_free(rx_buf_);
+        rx_buf_ = nullptr;
+        rx_buf_offset_ = 0;
+      } else {
+        auto *old_buf = rx_buf_;
+        rx_buf_ = rx_buf_->next;
+        pbuf_ref(rx_buf_);
+        pbuf_free(old_buf);
+        rx_buf_offset_ = 0;
+      }
+    } else {
+      rx_buf_offset_ += len;
+    }
+    LWIP_LOG("tcp_recved(%p %u)", pcb_, len);
+    tcp_recved(pcb_, len);
+  }
+
   int ip2sockaddr_(ip_addr_t *ip, uint16_t port, struct sockaddr *name, socklen_t *addrlen) {
     if (family_ == AF_INET) {
       if (*addrlen < sizeof(struct sockaddr_in)) {
@@ -33,6 +33,16 @@ bool Socket::ready() const {
 #endif
 }
 
+bool Socket::set_ready_listener(Component *component) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (!loop_monitored_)
+    return false;
+  return App.set_socket_listener(this->get_fd(), component);
+#else
+  return false;
+#endif
+}
+
 std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #if USE_NETWORK_IPV6
   return socket(AF_INET6, type, protocol);
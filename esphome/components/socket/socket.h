@@ -7,6 +7,9 @@
 
 #if defined(USE_SOCKET_IMPL_LWIP_TCP) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS) || defined(USE_SOCKET_IMPL_BSD_SOCKETS)
 namespace esphome {
+
+class Component;
+
 namespace socket {
 
 class Socket {
@@ -43,6 +46,14 @@ class Socket {
   virtual ssize_t recvfrom(void *buf, size_t len, sockaddr *addr, socklen_t *addr_len) = 0;
 #endif
   virtual ssize_t readv(const struct iovec *iov, int iovcnt) = 0;
+#ifdef USE_SOCKET_IMPL_LWIP_TCP
+  /// Lend the received bytes at the head of the stream without copying them, as one contiguous receive segment.
+  /// They stay valid and unread until released with consume(). Returns their count, 0 once the peer closed the
+  /// connection, or -1 with errno set (EWOULDBLOCK when nothing has been received).
+  virtual ssize_t peek_segment(uint8_t **data) = 0;
+  /// Release the first len bytes of the segment returned by peek_segment().
+  virtual void consume(size_t len) = 0;
+#endif
   virtual ssize_t write(const void *buf, size_t len) = 0;
   virtual ssize_t writev(const struct iovec *iov, int iovcnt) = 0;
   virtual ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) = 0;
@@ -58,6 +69,10 @@ class Socket {
   /// For non-monitored sockets, always returns true (assumes data may be available)
   bool ready() const;
 
+  /// Enable the loop of component whenever the main loop's select() finds this socket readable.
+  /// Returns false if the socket is not loop monitored, the component has to keep polling ready() then.
+  bool set_ready_listener(Component *component);
+
  protected:
 #ifdef USE_SOCKET_SELECT_SUPPORT
   bool loop_monitored_{false};  ///< Whether this socket is monitored by the event loop
@@ -174,7 +174,8 @@ bool SoundLevelComponent::start_() {
   // Allocates a new ring buffer, adds it as a source for the transfer buffer, and points ring_buffer_ to it
   this->ring_buffer_.reset();  // Reset pointer to any previous ring buffer allocation
   std::shared_ptr<RingBuffer> temp_ring_buffer =
-      RingBuffer::create(this->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
+      RingBuffer::create(this->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS),
+                         RAMSubsystem::AUDIO);
   if (temp_ring_buffer.use_count() == 0) {
     this->status_momentary_error("Failed to allocate ring buffer", 15000);
     this->stop_();
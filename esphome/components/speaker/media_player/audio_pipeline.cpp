@@ -382,7 +382,7 @@ void AudioPipeline::read_task(void *params) {
         std::shared_ptr<RingBuffer> temp_ring_buffer;
 
         if (!this_pipeline->raw_file_ring_buffer_.use_count()) {
-          temp_ring_buffer = RingBuffer::create(file_ring_buffer_size);
+          temp_ring_buffer = RingBuffer::create(file_ring_buffer_size, RAMSubsystem::AUDIO);
           this_pipeline->raw_file_ring_buffer_ = temp_ring_buffer;
         }
 
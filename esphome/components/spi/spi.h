@@ -242,6 +242,16 @@ class SPIDelegate {
       this->transfer(ptr[i]);
   }
 
+  /**
+   * Start writing the buffer and return while it is still being sent, when the delegate supports it (ESP-IDF
+   * hardware SPI.) The data must not change until wait_writes() returns. A transaction ended while writes are
+   * still running keeps the bus and CS until then.
+   */
+  virtual void write_array_async(const uint8_t *ptr, size_t length) { this->write_array(ptr, length); }
+
+  // wait until all writes started by write_array_async() have been sent, and end a transaction left open by them
+  virtual void wait_writes() {}
+
   // read into a buffer, write nulls
   virtual void read_array(uint8_t *ptr, size_t length) {
     for (size_t i = 0; i != length; i++)
@@ -502,6 +512,11 @@ class SPIDevice : public SPIClient {
 
   void write_array(const uint8_t *data, size_t length) { this->delegate_->write_array(data, length); }
 
+  /// Write the data in the background, see SPIDelegate::write_array_async().
+  void write_array_async(const uint8_t *data, size_t length) { this->delegate_->write_array_async(data, length); }
+
+  void wait_writes() { this->delegate_->wait_writes(); }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
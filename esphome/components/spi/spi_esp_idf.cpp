@@ -7,6 +7,8 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+// Transactions write_array_async() can have queued, the data of all but the last is sent while the caller continues
+static const size_t ASYNC_QUEUE_SIZE = 8;
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -23,6 +25,7 @@ class SPIDelegateHw : public SPIDelegate {
   bool is_ready() override { return this->handle_ != nullptr; }
 
   void begin_transaction() override {
+    this->wait_writes();
     if (this->release_device_)
       this->add_device_();
     if (this->is_ready()) {
@@ -35,6 +38,11 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   void end_transaction() override {
+    if (this->async_pending_ != 0) {
+      // CS and the bus stay with this device until the queued data is out
+      this->end_pending_ = true;
+      return;
+    }
     if (this->is_ready()) {
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
@@ -46,6 +54,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   ~SPIDelegateHw() override {
+    this->wait_writes();
     esp_err_t const err = spi_bus_remove_device(this->handle_);
     if (err != ESP_OK)
       ESP_LOGE(TAG, "Remove device failed - err %X", err);
@@ -60,6 +69,7 @@ class SPIDelegateHw : public SPIDelegate {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    this->drain_();
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -86,6 +96,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   void write(uint16_t data, size_t num_bits) override {
+    this->drain_();
     spi_transaction_ext_t desc = {};
     desc.command_bits = num_bits;
     desc.base.flags = SPI_TRANS_VARIABLE_CMD;
@@ -117,6 +128,7 @@ class SPIDelegateHw : public SPIDelegate {
       esph_log_w(TAG, "Nothing to transfer");
       return;
     }
+    this->drain_();
     desc.base.flags = SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_DUMMY;
     if (bus_width == 4) {
       desc.base.flags |= SPI_TRANS_MODE_QIO;
@@ -166,6 +178,35 @@ class SPIDelegateHw : public SPIDelegate {
 
   void write_array(const uint8_t *ptr, size_t length) override { this->transfer(ptr, nullptr, length); }
 
+  void write_array_async(const uint8_t *ptr, size_t length) override {
+    while (length != 0) {
+      if (this->async_pending_ == ASYNC_QUEUE_SIZE)
+        this->wait_one_();
+      spi_transaction_t &desc = this->async_desc_[this->async_next_];
+      desc = {};
+      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+      desc.length = partial * 8;
+      desc.tx_buffer = ptr;
+      esp_err_t err = spi_device_queue_trans(this->handle_, &desc, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Queue transmit failed - err %X", err);
+        return;
+      }
+      this->async_pending_++;
+      this->async_next_ = (this->async_next_ + 1) % ASYNC_QUEUE_SIZE;
+      length -= partial;
+      ptr += partial;
+    }
+  }
+
+  void wait_writes() override {
+    this->drain_();
+    if (this->end_pending_) {
+      this->end_pending_ = false;
+      this->end_transaction();
+    }
+  }
+
   void write_array16(const uint16_t *data, size_t length) override {
     if (this->bit_order_ == BIT_ORDER_LSB_FIRST) {
       this->write_array((uint8_t *) data, length * 2);
@@ -191,7 +232,7 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(this->data_rate_);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = ASYNC_QUEUE_SIZE;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (this->bit_order_ == BIT_ORDER_LSB_FIRST)
@@ -206,10 +247,28 @@ class SPIDelegateHw : public SPIDelegate {
     return true;
   }
 
+  void wait_one_() {
+    spi_transaction_t *done;
+    esp_err_t err = spi_device_get_trans_result(this->handle_, &done, portMAX_DELAY);
+    if (err != ESP_OK)
+      ESP_LOGE(TAG, "Transmit failed - err %X", err);
+    this->async_pending_--;
+  }
+
+  // polling transfers may only start once the queue is empty
+  void drain_() {
+    while (this->async_pending_ != 0)
+      this->wait_one_();
+  }
+
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool release_device_{false};
   bool write_only_{false};
+  bool end_pending_{false};
+  spi_transaction_t async_desc_[ASYNC_QUEUE_SIZE]{};
+  size_t async_next_{0};
+  size_t async_pending_{0};
 };
 
 class SPIBusHw : public SPIBus {
@@ -58,6 +58,19 @@ void SpiLedStrip::write_state(light::LightState *state) {
   this->write_array(this->buf_, this->buffer_size_);
   this->disable();
 }
+bool SpiLedStrip::get_pixel_buffer(light::PixelBuffer *buffer) {
+  if (this->buf_ == nullptr || this->effect_data_ == nullptr)
+    return false;
+  // After the 4 byte start frame, each LED frame is the 0xFF brightness header followed by blue, green and red
+  buffer->data = this->buf_ + 4;
+  buffer->effect_data = this->effect_data_;
+  buffer->stride = 4;
+  buffer->red = 3;
+  buffer->green = 2;
+  buffer->blue = 1;
+  buffer->white = -1;
+  return true;
+}
 light::ESPColorView SpiLedStrip::get_view_internal(int32_t index) const {
   size_t pos = index * 4 + 5;
   return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
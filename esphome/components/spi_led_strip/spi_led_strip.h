@@ -27,6 +27,8 @@ class SpiLedStrip : public light::AddressableLight,
 
   void clear_effect_data() override { memset(this->effect_data_, 0, this->num_leds_ * sizeof(this->effect_data_[0])); }
 
+  bool get_pixel_buffer(light::PixelBuffer *buffer) override;
+
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
 
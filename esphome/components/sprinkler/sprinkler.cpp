@@ -108,8 +108,10 @@ SprinklerControllerSwitch::SprinklerControllerSwitch()
     : turn_on_trigger_(new Trigger<>()), turn_off_trigger_(new Trigger<>()) {}
 
 void SprinklerControllerSwitch::loop() {
-  if (!this->f_.has_value())
+  if (!this->f_.has_value()) {
+    this->disable_loop();  // nothing to poll without a state lambda
     return;
+  }
   auto s = (*this->f_)();
   if (!s.has_value())
     return;
@@ -216,6 +218,7 @@ void SprinklerValveOperator::start() {
   if (!this->run_duration_) {  // can't start if zero run duration
     return;
   }
+  this->wake_controller_();
   if (this->start_delay_ && (this->pump_switch() != nullptr)) {
     this->state_ = STARTING;  // STARTING state requires both a pump and a start_delay_
     if (this->start_delay_is_valve_delay_) {
@@ -234,6 +237,7 @@ void SprinklerValveOperator::stop() {
   if ((this->state_ == IDLE) || (this->state_ == STOPPING)) {  // can't stop if already stopped or stopping
     return;
   }
+  this->wake_controller_();
   if (this->stop_delay_ && (this->pump_switch() != nullptr)) {
     this->state_ = STOPPING;  // STOPPING state requires both a pump and a stop_delay_
     if (this->stop_delay_is_valve_delay_) {
@@ -331,7 +335,14 @@ void SprinklerValveOperator::valve_on_() {
   }
 }
 
+void SprinklerValveOperator::wake_controller_() {
+  if (this->controller_ != nullptr) {
+    this->controller_->enable_loop();
+  }
+}
+
 void SprinklerValveOperator::kill_() {
+  this->wake_controller_();  // latching valves are switched off with a pulse
   this->state_ = IDLE;
   this->valve_off_();
   this->pump_off_();
@@ -414,6 +425,28 @@ void Sprinkler::loop() {
   if (this->prev_req_.has_request() && this->prev_req_.valve_operator()->state() == IDLE) {
     this->prev_req_.reset();
   }
+
+  // Everything above only has work while a valve operator runs or a latching valve pulse is in progress. Checked
+  //  after the loops above, as stopping a valve may have started a pulse. Starting either enables the loop again.
+  if (this->prev_req_.has_request()) {
+    return;
+  }
+  for (auto &vo : this->valve_op_) {
+    if (vo.state() != IDLE) {
+      return;
+    }
+  }
+  for (auto &p : this->pump_) {
+    if (p.pulse_active()) {
+      return;
+    }
+  }
+  for (auto &v : this->valve_) {
+    if (v.valve_switch.pulse_active()) {
+      return;
+    }
+  }
+  this->disable_loop();
 }
 
 void Sprinkler::add_valve(SprinklerControllerSwitch *valve_sw, SprinklerControllerSwitch *enable_sw) {
@@ -1072,6 +1105,7 @@ void Sprinkler::set_pump_state(SprinklerSwitch *pump_switch, bool state) {
   if (pump_switch == nullptr) {
     return;  // we can't do anything if there's nothing to check
   }
+  this->enable_loop();  // latching pumps are switched with a pulse
 
   bool hold_pump_on = false;
 
@@ -1214,16 +1248,17 @@ optional<uint32_t> Sprinkler::time_remaining_active_valve() {
 }
 
 optional<uint32_t> Sprinkler::time_remaining_current_operation() {
-  if (!this->time_remaining_active_valve().has_value() && this->state_ == IDLE) {
+  auto active_valve_time_remaining = this->time_remaining_active_valve();
+  if (!active_valve_time_remaining.has_value() && this->state_ == IDLE) {
     return nullopt;
   }
 
-  auto total_time_remaining = this->time_remaining_active_valve().value_or(0);
+  auto total_time_remaining = active_valve_time_remaining.value_or(0);
   if (this->auto_advance()) {
     total_time_remaining += this->total_cycle_time_enabled_incomplete_valves();
-    if (this->repeat().value_or(0) > 0) {
-      total_time_remaining +=
-          (this->total_cycle_time_enabled_valves() * (this->repeat().value_or(0) - this->repeat_count().value_or(0)));
+    auto repeat = this->repeat().value_or(0);
+    if (repeat > 0) {
+      total_time_remaining += (this->total_cycle_time_enabled_valves() * (repeat - this->repeat_count().value_or(0)));
     }
   }
 
@@ -1441,6 +1476,7 @@ void Sprinkler::start_valve_(SprinklerValveRunRequest *req) {
 }
 
 void Sprinkler::all_valves_off_(const bool include_pump) {
+  this->enable_loop();  // latching valves are switched off with a pulse
   for (size_t valve_index = 0; valve_index < this->number_of_valves(); valve_index++) {
     if (this->valve_[valve_index].valve_switch.state()) {
       this->valve_[valve_index].valve_switch.turn_off();
@@ -54,6 +54,7 @@ class SprinklerSwitch {
   void loop();               // called as a part of loop(), used for latching valve pulses
   uint32_t pulse_duration() { return this->pulse_duration_; }
   bool state();  // returns the switch's current state
+  bool pulse_active() const { return this->pinned_millis_ != 0; }  // a latching valve pulse is in progress
   void set_off_switch(switch_::Switch *off_switch) { this->off_switch_ = off_switch; }
   void set_on_switch(switch_::Switch *on_switch) { this->on_switch_ = on_switch; }
   void set_pulse_duration(uint32_t pulse_duration) { this->pulse_duration_ = pulse_duration; }
@@ -164,6 +165,7 @@ class SprinklerValveOperator {
   void valve_off_();
   void valve_on_();
   void kill_();
+  void wake_controller_();
   void run_();
   bool start_delay_is_valve_delay_{false};
   bool stop_delay_is_valve_delay_{false};
@@ -117,6 +117,8 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // The first update sends the whole buffer
+  this->mark_dirty_(0, 0, this->get_width_internal(), this->get_height_internal());
 }
 
 void ST7789V::dump_config() {
@@ -151,10 +153,14 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  // Only the window around the pixels changed since the last write is sent
+  const display::Rect dirty = this->take_dirty_region_();
+  if (!dirty.is_set())
+    return;
+  uint16_t x1 = this->offset_height_ + dirty.x;
+  uint16_t x2 = x1 + dirty.w - 1;
+  uint16_t y1 = this->offset_width_ + dirty.y;
+  uint16_t y2 = y1 + dirty.h - 1;
 
   this->enable();
 
@@ -177,8 +183,8 @@ void ST7789V::write_display_data() {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
     size_t width = static_cast<size_t>(this->get_width_internal());
-    for (size_t line = 0; line < this->get_buffer_length_(); line += width) {
-      for (size_t index = 0; index < width; ++index) {
+    for (size_t line = dirty.y * width + dirty.x; line < size_t(dirty.y2()) * width; line += width) {
+      for (size_t index = 0; index < size_t(dirty.w); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -192,8 +198,13 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (dirty.w == this->get_width_internal()) {
+    // Full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + dirty.y * dirty.w * 2, size_t(dirty.w) * dirty.h * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    const size_t stride = size_t(this->get_width_internal()) * 2;
+    for (int y = dirty.y; y < dirty.y2(); y++)
+      this->write_array(this->buffer_ + y * stride + dirty.x * 2, size_t(dirty.w) * 2);
   }
 
   this->disable();
@@ -299,13 +310,20 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = (color565 >> 8) & 0xff;
+    const uint8_t low = color565 & 0xff;
+    if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
   }
+  this->mark_dirty_(x, y);
 }
 
 }  // namespace st7789v
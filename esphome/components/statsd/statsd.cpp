@@ -9,6 +9,8 @@ namespace statsd {
 // send UDP packet if we reach 1Kb packed size
 // this is needed since statsD does not support fragmented UDP packets
 static const uint16_t SEND_THRESHOLD = 1024;
+// longest line of a single metric, including the reset to 0 of negative gauges
+static const size_t METRIC_MAX_LEN = 256;
 
 static const char *const TAG = "statsD";
 
@@ -79,8 +81,10 @@ void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_s
 #endif
 
 void StatsdComponent::update() {
-  std::string out;
-  out.reserve(SEND_THRESHOLD);
+  std::string &out = this->out_;
+  out.clear();
+  // only allocates on the first update, clear() keeps the capacity
+  out.reserve(SEND_THRESHOLD + METRIC_MAX_LEN);
 
   for (sensors_t s : this->sensors_) {
     double val = 0;
@@ -112,21 +116,25 @@ void StatsdComponent::update() {
     // statsD gauge:
     // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
     // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
+    char metric[METRIC_MAX_LEN];
+    const char *prefix = this->prefix_ != nullptr ? this->prefix_ : "";
+    const char *separator = this->prefix_ != nullptr ? "." : "";
+    int len = 0;
     if (val < 0) {
-      if (this->prefix_) {
-        out.append(str_sprintf("%s.", this->prefix_));
-      }
-      out.append(str_sprintf("%s:0|g\n", s.name));
+      len = snprintf(metric, sizeof(metric), "%s%s%s:0|g\n", prefix, separator, s.name);
     }
-    if (this->prefix_) {
-      out.append(str_sprintf("%s.", this->prefix_));
+    len += snprintf(metric + len, sizeof(metric) - len, "%s%s%s:%f|g\n", prefix, separator, s.name, val);
+    if (len >= static_cast<int>(sizeof(metric))) {
+      ESP_LOGW(TAG, "Metric too long, name: %s", s.name);
+      continue;
     }
-    out.append(str_sprintf("%s:%f|g\n", s.name, val));
 
-    if (out.length() > SEND_THRESHOLD) {
+    // send before the packet grows past the threshold, whole lines only
+    if (out.length() + len > SEND_THRESHOLD) {
       this->send_(&out);
       out.clear();
     }
+    out.append(metric, len);
   }
 
   this->send_(&out);
@@ -72,6 +72,8 @@ class StatsdComponent : public PollingComponent {
   uint16_t port_;
 
   std::vector<sensors_t> sensors_;
+  /// Packet built by update(), kept to reuse its buffer
+  std::string out_;
 
 #ifdef USE_ESP8266
   WiFiUDP sock_;
@@ -20,6 +20,7 @@ CONF_CRC_SIZE = "crc_size"
 CONF_CRC_POLYNOMIAL = "crc_polynomial"
 CONF_CRC_INITIAL = "crc_initial"
 CONF_DEVIATION = "deviation"
+CONF_DUTY_CYCLE = "duty_cycle"
 CONF_DIO1_PIN = "dio1_pin"
 CONF_HW_VERSION = "hw_version"
 CONF_MODULATION = "modulation"
@@ -201,6 +202,9 @@ CONFIG_SCHEMA = (
                 cv.hex_int, cv.Range(min=0, max=0xFFFF)
             ),
             cv.Optional(CONF_DEVIATION, default=5000): cv.int_range(min=0, max=100000),
+            cv.Optional(CONF_DUTY_CYCLE, default="100%"): cv.All(
+                cv.percentage, cv.Range(min=0.001)
+            ),
             cv.Required(CONF_DIO1_PIN): pins.internal_gpio_input_pin_schema,
             cv.Required(CONF_FREQUENCY): cv.int_range(min=137000000, max=1020000000),
             cv.Required(CONF_HW_VERSION): cv.one_of(
@@ -257,6 +261,7 @@ async def to_code(config):
     cg.add(var.set_frequency(config[CONF_FREQUENCY]))
     cg.add(var.set_hw_version(config[CONF_HW_VERSION]))
     cg.add(var.set_deviation(config[CONF_DEVIATION]))
+    cg.add(var.set_duty_cycle(config[CONF_DUTY_CYCLE]))
     cg.add(var.set_modulation(config[CONF_MODULATION]))
     cg.add(var.set_pa_ramp(config[CONF_PA_RAMP]))
     cg.add(var.set_pa_power(config[CONF_PA_POWER]))
@@ -18,7 +18,10 @@ void SX126xTransport::update() {
   this->resend_data_ = true;
 }
 
-void SX126xTransport::send_packet(const std::vector<uint8_t> &buf) const { this->parent_->transmit_packet(buf); }
+void SX126xTransport::send_packet(const std::vector<uint8_t> &buf) const {
+  // Queued so the loop isn't blocked for the time on air, the radio sends it when the duty cycle allows
+  this->parent_->queue_packet(buf);
+}
 
 void SX126xTransport::on_packet(const std::vector<uint8_t> &packet, float rssi, float snr) { this->process_(packet); }
 
@@ -22,6 +22,7 @@ static constexpr uint32_t RESET_DELAY_LOW_US = 2000;
 static constexpr uint32_t SWITCHING_DELAY_US = 1;
 static constexpr uint32_t TRANSMIT_TIMEOUT_MS = 4000;
 static constexpr uint32_t BUSY_TIMEOUT_MS = 20;
+static constexpr size_t MAX_TX_QUEUE_SIZE = 8;
 
 // OCP (Over Current Protection) values
 static constexpr uint8_t OCP_80MA = 0x18;   // 80 mA max current
@@ -109,6 +110,8 @@ void SX126x::setup() {
   this->busy_pin_->setup();
   this->rst_pin_->setup();
   this->dio1_pin_->setup();
+  // dio1 signals received and transmitted packets
+  this->dio1_pin_->attach_interrupt(&SX126x::gpio_intr, this, gpio::INTERRUPT_RISING_EDGE);
 
   // start spi
   this->spi_setup();
@@ -296,7 +299,7 @@ void SX126x::set_packet_params_(uint8_t payload_length) {
   }
 }
 
-SX126xError SX126x::transmit_packet(const std::vector<uint8_t> &packet) {
+SX126xError SX126x::check_packet_(const std::vector<uint8_t> &packet) {
   if (this->payload_length_ > 0 && this->payload_length_ != packet.size()) {
     ESP_LOGE(TAG, "Packet size does not match config");
     return SX126xError::INVALID_PARAMS;
@@ -305,29 +308,73 @@ SX126xError SX126x::transmit_packet(const std::vector<uint8_t> &packet) {
     ESP_LOGE(TAG, "Packet size out of range");
     return SX126xError::INVALID_PARAMS;
   }
+  return SX126xError::NONE;
+}
 
-  SX126xError ret = SX126xError::NONE;
+SX126xError SX126x::transmit_packet(const std::vector<uint8_t> &packet) {
+  SX126xError ret = this->check_packet_(packet);
+  if (ret != SX126xError::NONE) {
+    return ret;
+  }
+  if (this->transmitting_) {
+    // let a queued packet finish first
+    this->wait_transmit_();
+  }
+  this->start_transmit_(packet);
+  return this->wait_transmit_();
+}
+
+SX126xError SX126x::queue_packet(const std::vector<uint8_t> &packet) {
+  SX126xError ret = this->check_packet_(packet);
+  if (ret != SX126xError::NONE) {
+    return ret;
+  }
+  if (this->tx_queue_.size() >= MAX_TX_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Transmit queue full, packet dropped");
+    return SX126xError::TIMEOUT;
+  }
+  this->tx_queue_.push_back(packet);
+  this->enable_loop();
+  return SX126xError::NONE;
+}
+
+void SX126x::start_transmit_(const std::vector<uint8_t> &packet) {
   this->set_mode_standby(STDBY_XOSC);
   if (this->payload_length_ == 0) {
     this->set_packet_params_(packet.size());
   }
   this->write_fifo_(0x00, packet);
   this->set_mode_tx();
+  this->tx_start_ = millis();
+  this->transmitting_ = true;
+}
 
+SX126xError SX126x::wait_transmit_() {
   // wait until transmit completes, typically the delay will be less than 100 ms
-  uint32_t start = millis();
+  SX126xError ret = SX126xError::NONE;
   while (!this->dio1_pin_->digital_read()) {
-    if (millis() - start > TRANSMIT_TIMEOUT_MS) {
+    if (millis() - this->tx_start_ > TRANSMIT_TIMEOUT_MS) {
       ESP_LOGE(TAG, "Transmit packet failure");
       ret = SX126xError::TIMEOUT;
       break;
     }
   }
+  this->finish_transmit_();
+  return ret;
+}
 
+void SX126x::finish_transmit_() {
   uint8_t buf[2];
   buf[0] = 0xFF;
   buf[1] = 0xFF;
   this->write_opcode_(RADIO_CLR_IRQSTATUS, buf, 2);
+  this->transmitting_ = false;
+  this->tx_end_ = millis();
+  if (this->duty_cycle_ < 1.0f) {
+    // time on air times the share of time the radio has to stay silent per share of time it may transmit
+    uint32_t airtime = this->tx_end_ - this->tx_start_;
+    this->tx_off_time_ = static_cast<uint32_t>(airtime * (1.0f - this->duty_cycle_) / this->duty_cycle_);
+  }
   if (this->payload_length_ == 0) {
     this->set_packet_params_(this->get_max_packet_size());
   }
@@ -336,9 +383,10 @@ SX126xError SX126x::transmit_packet(const std::vector<uint8_t> &packet) {
   } else {
     this->set_mode_sleep();
   }
-  return ret;
 }
 
+bool SX126x::tx_allowed_() const { return millis() - this->tx_end_ >= this->tx_off_time_; }
+
 void SX126x::call_listeners_(const std::vector<uint8_t> &packet, float rssi, float snr) {
   for (auto &listener : this->listeners_) {
     listener->on_packet(packet, rssi, snr);
@@ -346,11 +394,38 @@ void SX126x::call_listeners_(const std::vector<uint8_t> &packet, float rssi, flo
   this->packet_trigger_->trigger(packet, rssi, snr);
 }
 
+void IRAM_ATTR SX126x::gpio_intr(SX126x *arg) {
+  // dio1 rises when a packet was received or transmitted, the loop reads the radio
+  arg->enable_loop_soon_any_context();
+}
+
 void SX126x::loop() {
-  if (!this->dio1_pin_->digital_read()) {
+  if (this->dio1_pin_->digital_read()) {
+    if (this->transmitting_) {
+      this->finish_transmit_();
+    } else {
+      this->read_packet_();
+    }
+  } else if (this->transmitting_) {
+    if (millis() - this->tx_start_ > TRANSMIT_TIMEOUT_MS) {
+      ESP_LOGE(TAG, "Transmit packet failure");
+      this->finish_transmit_();
+    }
     return;
   }
 
+  if (!this->transmitting_ && !this->tx_queue_.empty() && this->tx_allowed_()) {
+    this->start_transmit_(this->tx_queue_.front());
+    this->tx_queue_.pop_front();
+    return;
+  }
+  // Stay idle until dio1 rises again, unless a queued packet waits for the duty cycle or the pin still is high
+  if (this->tx_queue_.empty() && !this->dio1_pin_->digital_read()) {
+    this->disable_loop();
+  }
+}
+
+void SX126x::read_packet_() {
   uint16_t status;
   uint8_t buf[3];
   uint8_t rssi;
@@ -488,9 +563,11 @@ void SX126x::dump_config() {
                 "  PA Ramp: %" PRIu16 " us\n"
                 "  Payload Length: %" PRIu32 "\n"
                 "  CRC Enable: %s\n"
-                "  Rx Start: %s",
+                "  Rx Start: %s\n"
+                "  Duty Cycle: %.1f%%",
                 this->version_, this->frequency_, BW_HZ[this->bandwidth_], this->pa_power_, RAMP[this->pa_ramp_],
-                this->payload_length_, TRUEFALSE(this->crc_enable_), TRUEFALSE(this->rx_start_));
+                this->payload_length_, TRUEFALSE(this->crc_enable_), TRUEFALSE(this->rx_start_),
+                this->duty_cycle_ * 100.0f);
   if (this->modulation_ == PACKET_TYPE_GFSK) {
     const char *shaping = "NONE";
     if (this->shaping_ == GAUSSIAN_BT_0_3) {
@@ -73,6 +73,8 @@ class SX126x : public Component,
   void set_crc_initial(uint16_t crc_initial) { this->crc_initial_ = crc_initial; }
   void set_deviation(uint32_t deviation) { this->deviation_ = deviation; }
   void set_dio1_pin(InternalGPIOPin *dio1_pin) { this->dio1_pin_ = dio1_pin; }
+  /// Largest share of time spent transmitting queued packets, 1.0 for no limit.
+  void set_duty_cycle(float duty_cycle) { this->duty_cycle_ = duty_cycle; }
   void set_frequency(uint32_t frequency) { this->frequency_ = frequency; }
   void set_hw_version(const std::string &hw_version) { this->hw_version_ = hw_version; }
   void set_mode_rx();
@@ -95,7 +97,10 @@ class SX126x : public Component,
   void set_tcxo_delay(uint32_t tcxo_delay) { this->tcxo_delay_ = tcxo_delay; }
   void run_image_cal();
   void configure();
+  /// Sends the packet and blocks until it is transmitted.
   SX126xError transmit_packet(const std::vector<uint8_t> &packet);
+  /// Queues the packet, loop() sends it once the radio is free and the duty cycle allows it.
+  SX126xError queue_packet(const std::vector<uint8_t> &packet);
   void register_listener(SX126xListener *listener) { this->listeners_.push_back(listener); }
   Trigger<std::vector<uint8_t>, float, float> *get_packet_trigger() const { return this->packet_trigger_; };
 
@@ -111,10 +116,19 @@ class SX126x : public Component,
   void read_register_(uint16_t reg, uint8_t *data, uint8_t size);
   void call_listeners_(const std::vector<uint8_t> &packet, float rssi, float snr);
   void wait_busy_();
+  SX126xError check_packet_(const std::vector<uint8_t> &packet);
+  void start_transmit_(const std::vector<uint8_t> &packet);
+  /// Waits for the transmission started last, blocking.
+  SX126xError wait_transmit_();
+  void finish_transmit_();
+  bool tx_allowed_() const;
+  void read_packet_();
+  static void gpio_intr(SX126x *arg);
   Trigger<std::vector<uint8_t>, float, float> *packet_trigger_{new Trigger<std::vector<uint8_t>, float, float>()};
   std::vector<SX126xListener *> listeners_;
   std::vector<uint8_t> packet_;
   std::vector<uint8_t> sync_value_;
+  std::deque<std::vector<uint8_t>> tx_queue_;
   InternalGPIOPin *busy_pin_{nullptr};
   InternalGPIOPin *dio1_pin_{nullptr};
   InternalGPIOPin *rst_pin_{nullptr};
@@ -131,6 +145,11 @@ class SX126x : public Component,
   uint32_t frequency_{0};
   uint32_t payload_length_{0};
   uint32_t tcxo_delay_{0};
+  uint32_t tx_start_{0};
+  uint32_t tx_end_{0};
+  // Time to stay silent after tx_end_ to respect the duty cycle
+  uint32_t tx_off_time_{0};
+  float duty_cycle_{1.0f};
   uint16_t preamble_detect_{0};
   uint16_t preamble_size_{0};
   uint8_t tcxo_voltage_{0};
@@ -142,6 +161,7 @@ class SX126x : public Component,
   int8_t pa_power_{0};
   bool rx_start_{false};
   bool rf_switch_{false};
+  bool transmitting_{false};
 };
 
 }  // namespace sx126x
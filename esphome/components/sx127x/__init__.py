@@ -17,6 +17,7 @@ CONF_BITSYNC = "bitsync"
 CONF_CODING_RATE = "coding_rate"
 CONF_CRC_ENABLE = "crc_enable"
 CONF_DEVIATION = "deviation"
+CONF_DUTY_CYCLE = "duty_cycle"
 CONF_DIO0_PIN = "dio0_pin"
 CONF_MODULATION = "modulation"
 CONF_ON_PACKET = "on_packet"
@@ -197,6 +198,9 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_CODING_RATE, default="CR_4_5"): cv.enum(CODING_RATE),
             cv.Optional(CONF_CRC_ENABLE, default=False): cv.boolean,
             cv.Optional(CONF_DEVIATION, default=5000): cv.int_range(min=0, max=100000),
+            cv.Optional(CONF_DUTY_CYCLE, default="100%"): cv.All(
+                cv.percentage, cv.Range(min=0.001)
+            ),
             cv.Optional(CONF_DIO0_PIN): pins.internal_gpio_input_pin_schema,
             cv.Required(CONF_FREQUENCY): cv.int_range(min=137000000, max=1020000000),
             cv.Required(CONF_MODULATION): cv.enum(MOD),
@@ -249,6 +253,7 @@ async def to_code(config):
     cg.add(var.set_bandwidth(config[CONF_BANDWIDTH]))
     cg.add(var.set_frequency(config[CONF_FREQUENCY]))
     cg.add(var.set_deviation(config[CONF_DEVIATION]))
+    cg.add(var.set_duty_cycle(config[CONF_DUTY_CYCLE]))
     cg.add(var.set_modulation(config[CONF_MODULATION]))
     if config[CONF_MODULATION] != "LORA":
         cg.add(var.set_bitrate(config[CONF_BITRATE]))
@@ -19,6 +19,8 @@ static const uint8_t BW_FSK_OOK[22] = {RX_BW_2_6,   RX_BW_3_1,   RX_BW_3_9,   RX
                                        RX_BW_166_7, RX_BW_200_0, RX_BW_250_0, RX_BW_250_0};
 static const int32_t RSSI_OFFSET_HF = 157;
 static const int32_t RSSI_OFFSET_LF = 164;
+static const uint32_t TRANSMIT_TIMEOUT_MS = 4000;
+static const size_t MAX_TX_QUEUE_SIZE = 8;
 
 uint8_t SX127x::read_register_(uint8_t reg) {
   this->enable();
@@ -53,9 +55,10 @@ void SX127x::setup() {
   // setup reset
   this->rst_pin_->setup();
 
-  // setup dio0
+  // setup dio0, it signals received and transmitted packets
   if (this->dio0_pin_) {
     this->dio0_pin_->setup();
+    this->dio0_pin_->attach_interrupt(&SX127x::gpio_intr, this, gpio::INTERRUPT_RISING_EDGE);
   }
 
   // start spi
@@ -250,7 +253,7 @@ size_t SX127x::get_max_packet_size() {
   }
 }
 
-SX127xError SX127x::transmit_packet(const std::vector<uint8_t> &packet) {
+SX127xError SX127x::check_packet_(const std::vector<uint8_t> &packet) {
   if (this->payload_length_ > 0 && this->payload_length_ != packet.size()) {
     ESP_LOGE(TAG, "Packet size does not match config");
     return SX127xError::INVALID_PARAMS;
@@ -259,8 +262,37 @@ SX127xError SX127x::transmit_packet(const std::vector<uint8_t> &packet) {
     ESP_LOGE(TAG, "Packet size out of range");
     return SX127xError::INVALID_PARAMS;
   }
+  return SX127xError::NONE;
+}
 
-  SX127xError ret = SX127xError::NONE;
+SX127xError SX127x::transmit_packet(const std::vector<uint8_t> &packet) {
+  SX127xError ret = this->check_packet_(packet);
+  if (ret != SX127xError::NONE) {
+    return ret;
+  }
+  if (this->transmitting_) {
+    // let a queued packet finish first
+    this->wait_transmit_();
+  }
+  this->start_transmit_(packet);
+  return this->wait_transmit_();
+}
+
+SX127xError SX127x::queue_packet(const std::vector<uint8_t> &packet) {
+  SX127xError ret = this->check_packet_(packet);
+  if (ret != SX127xError::NONE) {
+    return ret;
+  }
+  if (this->tx_queue_.size() >= MAX_TX_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Transmit queue full, packet dropped");
+    return SX127xError::TIMEOUT;
+  }
+  this->tx_queue_.push_back(packet);
+  this->enable_loop();
+  return SX127xError::NONE;
+}
+
+void SX127x::start_transmit_(const std::vector<uint8_t> &packet) {
   if (this->modulation_ == MOD_LORA) {
     this->set_mode_standby();
     if (this->payload_length_ == 0) {
@@ -278,24 +310,41 @@ SX127xError SX127x::transmit_packet(const std::vector<uint8_t> &packet) {
     this->write_fifo_(packet);
     this->set_mode_tx();
   }
+  this->tx_start_ = millis();
+  this->transmitting_ = true;
+}
 
+SX127xError SX127x::wait_transmit_() {
   // wait until transmit completes, typically the delay will be less than 100 ms
-  uint32_t start = millis();
+  SX127xError ret = SX127xError::NONE;
   while (!this->dio0_pin_->digital_read()) {
-    if (millis() - start > 4000) {
+    if (millis() - this->tx_start_ > TRANSMIT_TIMEOUT_MS) {
       ESP_LOGE(TAG, "Transmit packet failure");
       ret = SX127xError::TIMEOUT;
       break;
     }
   }
+  this->finish_transmit_();
+  return ret;
+}
+
+void SX127x::finish_transmit_() {
+  this->transmitting_ = false;
+  this->tx_end_ = millis();
+  if (this->duty_cycle_ < 1.0f) {
+    // time on air times the share of time the radio has to stay silent per share of time it may transmit
+    uint32_t airtime = this->tx_end_ - this->tx_start_;
+    this->tx_off_time_ = static_cast<uint32_t>(airtime * (1.0f - this->duty_cycle_) / this->duty_cycle_);
+  }
   if (this->rx_start_) {
     this->set_mode_rx();
   } else {
     this->set_mode_sleep();
   }
-  return ret;
 }
 
+bool SX127x::tx_allowed_() const { return millis() - this->tx_end_ >= this->tx_off_time_; }
+
 void SX127x::call_listeners_(const std::vector<uint8_t> &packet, float rssi, float snr) {
   for (auto &listener : this->listeners_) {
     listener->on_packet(packet, rssi, snr);
@@ -303,11 +352,41 @@ void SX127x::call_listeners_(const std::vector<uint8_t> &packet, float rssi, flo
   this->packet_trigger_->trigger(packet, rssi, snr);
 }
 
+void IRAM_ATTR SX127x::gpio_intr(SX127x *arg) {
+  // dio0 rises when a packet was received or transmitted, the loop reads the radio
+  arg->enable_loop_soon_any_context();
+}
+
 void SX127x::loop() {
-  if (this->dio0_pin_ == nullptr || !this->dio0_pin_->digital_read()) {
+  if (this->dio0_pin_ == nullptr) {
     return;
   }
+  if (this->dio0_pin_->digital_read()) {
+    if (this->transmitting_) {
+      this->finish_transmit_();
+    } else {
+      this->read_packet_();
+    }
+  } else if (this->transmitting_) {
+    if (millis() - this->tx_start_ > TRANSMIT_TIMEOUT_MS) {
+      ESP_LOGE(TAG, "Transmit packet failure");
+      this->finish_transmit_();
+    }
+    return;
+  }
+
+  if (!this->transmitting_ && !this->tx_queue_.empty() && this->tx_allowed_()) {
+    this->start_transmit_(this->tx_queue_.front());
+    this->tx_queue_.pop_front();
+    return;
+  }
+  // Stay idle until dio0 rises again, unless a queued packet waits for the duty cycle or the pin still is high
+  if (this->tx_queue_.empty() && !this->transmitting_ && !this->dio0_pin_->digital_read()) {
+    this->disable_loop();
+  }
+}
 
+void SX127x::read_packet_() {
   if (this->modulation_ == MOD_LORA) {
     uint8_t status = this->read_register_(REG_IRQ_FLAGS);
     this->write_register_(REG_IRQ_FLAGS, 0xFF);
@@ -414,9 +493,10 @@ void SX127x::dump_config() {
                 "  Bandwidth: %" PRIu32 " Hz\n"
                 "  PA Pin: %s\n"
                 "  PA Power: %" PRIu8 " dBm\n"
-                "  PA Ramp: %" PRIu16 " us",
+                "  PA Ramp: %" PRIu16 " us\n"
+                "  Duty Cycle: %.1f%%",
                 TRUEFALSE(this->auto_cal_), this->frequency_, BW_HZ[this->bandwidth_], pa_pin, this->pa_power_,
-                RAMP[this->pa_ramp_]);
+                RAMP[this->pa_ramp_], this->duty_cycle_ * 100.0f);
   if (this->modulation_ == MOD_FSK) {
     ESP_LOGCONFIG(TAG, "  Deviation: %" PRIu32 " Hz", this->deviation_);
   }
@@ -4,6 +4,7 @@
 #include "esphome/components/spi/spi.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
+#include <deque>
 #include <vector>
 
 namespace esphome {
@@ -58,6 +59,8 @@ class SX127x : public Component,
   void set_crc_enable(bool crc_enable) { this->crc_enable_ = crc_enable; }
   void set_deviation(uint32_t deviation) { this->deviation_ = deviation; }
   void set_dio0_pin(InternalGPIOPin *dio0_pin) { this->dio0_pin_ = dio0_pin; }
+  /// Largest share of time spent transmitting queued packets, 1.0 for no limit.
+  void set_duty_cycle(float duty_cycle) { this->duty_cycle_ = duty_cycle; }
   void set_frequency(uint32_t frequency) { this->frequency_ = frequency; }
   void set_mode_rx();
   void set_mode_tx();
@@ -81,7 +84,10 @@ class SX127x : public Component,
   void set_sync_value(const std::vector<uint8_t> &sync_value) { this->sync_value_ = sync_value; }
   void run_image_cal();
   void configure();
+  /// Sends the packet and blocks until it is transmitted.
   SX127xError transmit_packet(const std::vector<uint8_t> &packet);
+  /// Queues the packet, loop() sends it once the radio is free and the duty cycle allows it.
+  SX127xError queue_packet(const std::vector<uint8_t> &packet);
   void register_listener(SX127xListener *listener) { this->listeners_.push_back(listener); }
   Trigger<std::vector<uint8_t>, float, float> *get_packet_trigger() const { return this->packet_trigger_; };
 
@@ -94,10 +100,19 @@ class SX127x : public Component,
   void write_register_(uint8_t reg, uint8_t value);
   void call_listeners_(const std::vector<uint8_t> &packet, float rssi, float snr);
   uint8_t read_register_(uint8_t reg);
+  SX127xError check_packet_(const std::vector<uint8_t> &packet);
+  void start_transmit_(const std::vector<uint8_t> &packet);
+  /// Waits for the transmission started last, blocking.
+  SX127xError wait_transmit_();
+  void finish_transmit_();
+  bool tx_allowed_() const;
+  void read_packet_();
+  static void gpio_intr(SX127x *arg);
   Trigger<std::vector<uint8_t>, float, float> *packet_trigger_{new Trigger<std::vector<uint8_t>, float, float>()};
   std::vector<SX127xListener *> listeners_;
   std::vector<uint8_t> packet_;
   std::vector<uint8_t> sync_value_;
+  std::deque<std::vector<uint8_t>> tx_queue_;
   InternalGPIOPin *dio0_pin_{nullptr};
   InternalGPIOPin *rst_pin_{nullptr};
   SX127xBw bandwidth_;
@@ -117,6 +132,12 @@ class SX127x : public Component,
   uint8_t shaping_;
   uint8_t spreading_factor_;
   float rx_floor_;
+  float duty_cycle_{1.0f};
+  uint32_t tx_start_{0};
+  uint32_t tx_end_{0};
+  // Time to stay silent after tx_end_ to respect the duty cycle
+  uint32_t tx_off_time_{0};
+  bool transmitting_{false};
   bool auto_cal_{false};
   bool bitsync_{false};
   bool crc_enable_{false};
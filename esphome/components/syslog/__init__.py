@@ -16,6 +16,7 @@ Syslog = syslog_ns.class_("Syslog", Component, Parented.template(udp.UDPComponen
 
 CONF_STRIP = "strip"
 CONF_FACILITY = "facility"
+CONF_BATCH_DELAY = "batch_delay"
 CONFIG_SCHEMA = udp.UDP_SCHEMA.extend(
     {
         cv.GenerateID(): cv.declare_id(Syslog),
@@ -24,6 +25,8 @@ CONFIG_SCHEMA = udp.UDP_SCHEMA.extend(
         cv.Optional(CONF_LEVEL, default="DEBUG"): is_log_level,
         cv.Optional(CONF_STRIP, default=True): cv.boolean,
         cv.Optional(CONF_FACILITY, default=16): cv.int_range(0, 23),
+        # Receivers must split datagrams on newlines when batching is enabled
+        cv.Optional(CONF_BATCH_DELAY): cv.positive_time_period_milliseconds,
     }
 )
 
@@ -39,3 +42,6 @@ async def to_code(config):
     await cg.register_parented(var, parent)
     cg.add(var.set_strip(config[CONF_STRIP]))
     cg.add(var.set_facility(config[CONF_FACILITY]))
+    if (batch_delay := config.get(CONF_BATCH_DELAY)) is not None:
+        cg.add(parent.set_batch_delay(batch_delay))
+        cg.add(var.set_batch(True))
@@ -4,6 +4,8 @@
 #include "esphome/core/application.h"
 #include "esphome/core/time.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace syslog {
 
@@ -19,14 +21,19 @@ constexpr int LOG_LEVEL_TO_SYSLOG_SEVERITY[] = {
     7   // VERY_VERBOSE
 };
 
+// Longest message sent, the limit of RFC 3164
+static const size_t MAX_MESSAGE_SIZE = 1024;
+
 void Syslog::setup() {
+  this->buffer_ = std::make_unique<char[]>(MAX_MESSAGE_SIZE);
   logger::global_logger->add_on_log_callback(
       [this](int level, const char *tag, const char *message, size_t message_len) {
         this->log_(level, tag, message, message_len);
-      });
+      },
+      this->log_level_);
 }
 
-void Syslog::log_(const int level, const char *tag, const char *message, size_t message_len) const {
+void Syslog::log_(const int level, const char *tag, const char *message, size_t message_len) {
   if (level > this->log_level_)
     return;
   // Syslog PRI calculation: facility * 8 + severity
@@ -43,8 +50,18 @@ void Syslog::log_(const int level, const char *tag, const char *message, size_t
     len -= 11;
   }
 
-  auto data = str_sprintf("<%d>%s %s %s: %.*s", pri, timestamp.c_str(), App.get_name().c_str(), tag, len, message);
-  this->parent_->send_packet((const uint8_t *) data.data(), data.size());
+  int data_len = snprintf(this->buffer_.get(), MAX_MESSAGE_SIZE, "<%d>%s %s %s: %.*s", pri, timestamp.c_str(),
+                          App.get_name().c_str(), tag, (int) len, message);
+  if (data_len <= 0)
+    return;
+  // snprintf() returns the untruncated length
+  size_t size = std::min<size_t>(data_len, MAX_MESSAGE_SIZE - 1);
+  auto *data = reinterpret_cast<const uint8_t *>(this->buffer_.get());
+  if (this->batch_) {
+    this->parent_->queue_packet(data, size);
+  } else {
+    this->parent_->send_packet(data, size);
+  }
 }
 
 }  // namespace syslog
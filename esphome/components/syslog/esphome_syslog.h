@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -14,13 +15,18 @@ class Syslog : public Component, public Parented<udp::UDPComponent> {
   void setup() override;
   void set_strip(bool strip) { this->strip_ = strip; }
   void set_facility(int facility) { this->facility_ = facility; }
+  /// Pack several messages into each datagram, see UDPComponent::queue_packet().
+  void set_batch(bool batch) { this->batch_ = batch; }
 
  protected:
   int log_level_;
-  void log_(int level, const char *tag, const char *message, size_t message_len) const;
+  void log_(int level, const char *tag, const char *message, size_t message_len);
   time::RealTimeClock *time_;
   bool strip_{true};
+  bool batch_{false};
   int facility_{16};
+  /// Formatted message, allocated once in setup()
+  std::unique_ptr<char[]> buffer_;
 };
 }  // namespace syslog
 }  // namespace esphome
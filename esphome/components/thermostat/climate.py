@@ -74,6 +74,8 @@ from esphome.const import (
 CONF_PRESET_CHANGE = "preset_change"
 CONF_DEFAULT_PRESET = "default_preset"
 CONF_ON_BOOT_RESTORE_FROM = "on_boot_restore_from"
+CONF_CURRENT_TEMPERATURE_PUBLISH_DELTA = "current_temperature_publish_delta"
+CONF_MIN_PUBLISH_INTERVAL = "min_publish_interval"
 
 CODEOWNERS = ["@kbx81"]
 
@@ -602,6 +604,12 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_COOL_OVERRUN, default=0.5): cv.temperature_delta,
             cv.Optional(CONF_HEAT_DEADBAND, default=0.5): cv.temperature_delta,
             cv.Optional(CONF_HEAT_OVERRUN, default=0.5): cv.temperature_delta,
+            cv.Optional(
+                CONF_CURRENT_TEMPERATURE_PUBLISH_DELTA, default=0.0
+            ): cv.temperature_delta,
+            cv.Optional(
+                CONF_MIN_PUBLISH_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_MAX_COOLING_RUN_TIME): cv.positive_time_period_seconds,
             cv.Optional(CONF_MAX_HEATING_RUN_TIME): cv.positive_time_period_seconds,
             cv.Optional(CONF_MIN_COOLING_OFF_TIME): cv.positive_time_period_seconds,
@@ -737,6 +745,12 @@ async def to_code(config):
     cg.add(var.set_supports_fan_with_heating(config[CONF_FAN_WITH_HEATING]))
 
     cg.add(var.set_use_startup_delay(config[CONF_STARTUP_DELAY]))
+    cg.add(
+        var.set_current_temperature_publish_delta(
+            config[CONF_CURRENT_TEMPERATURE_PUBLISH_DELTA]
+        )
+    )
+    cg.add(var.set_min_publish_interval(config[CONF_MIN_PUBLISH_INTERVAL]))
 
     await automation.build_automation(
         var.get_idle_action_trigger(), [], config[CONF_IDLE_ACTION]
@@ -24,7 +24,7 @@ void ThermostatClimate::setup() {
     this->switch_to_action_(this->compute_action_(), false);
     this->switch_to_supplemental_action_(this->compute_supplemental_action_());
     // current temperature and possibly action changed, so publish the new state
-    this->publish_state();
+    this->publish_measurement_();
   });
   this->current_temperature = this->sensor_->state;
 
@@ -32,11 +32,23 @@ void ThermostatClimate::setup() {
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
       this->current_humidity = state;
-      this->publish_state();
+      this->publish_measurement_();
     });
     this->current_humidity = this->humidity_sensor_->state;
   }
 
+  // remember what was last published, whatever published it
+  this->add_on_state_callback([this](climate::Climate & /*unused*/) {
+    this->published_action_ = this->action;
+    this->published_current_temperature_ = this->current_temperature;
+    this->published_current_humidity_ = this->current_humidity;
+    this->last_publish_ = millis();
+    if (this->publish_pending_) {
+      this->publish_pending_ = false;
+      this->cancel_timeout("publish");
+    }
+  });
+
   auto use_default_preset = true;
 
   if (this->on_boot_restore_from_ == thermostat::OnBootRestoreFrom::MEMORY) {
@@ -88,6 +100,33 @@ void ThermostatClimate::refresh() {
   this->publish_state();
 }
 
+static bool measurement_changed(float value, float published, float delta) {
+  if (std::isnan(value) || std::isnan(published))
+    return std::isnan(value) != std::isnan(published);
+  return value != published && std::fabs(value - published) >= delta;
+}
+
+void ThermostatClimate::publish_measurement_() {
+  // A changed action always goes out right away
+  if (this->action != this->published_action_) {
+    this->publish_state();
+    return;
+  }
+  if (!measurement_changed(this->current_temperature, this->published_current_temperature_,
+                           this->current_temperature_publish_delta_) &&
+      !measurement_changed(this->current_humidity, this->published_current_humidity_, 0)) {
+    return;
+  }
+  const uint32_t elapsed = millis() - this->last_publish_;
+  if (elapsed >= this->min_publish_interval_) {
+    this->publish_state();
+  } else if (!this->publish_pending_) {
+    // publishes the latest values once the interval has passed
+    this->publish_pending_ = true;
+    this->set_timeout("publish", this->min_publish_interval_ - elapsed, [this]() { this->publish_state(); });
+  }
+}
+
 bool ThermostatClimate::climate_action_change_delayed() {
   bool state_mismatch = this->action != this->compute_action_(true);
 
@@ -1218,6 +1257,10 @@ void ThermostatClimate::set_humidity_sensor(sensor::Sensor *humidity_sensor) {
   this->humidity_sensor_ = humidity_sensor;
 }
 void ThermostatClimate::set_use_startup_delay(bool use_startup_delay) { this->use_startup_delay_ = use_startup_delay; }
+void ThermostatClimate::set_current_temperature_publish_delta(float delta) {
+  this->current_temperature_publish_delta_ = delta;
+}
+void ThermostatClimate::set_min_publish_interval(uint32_t interval) { this->min_publish_interval_ = interval; }
 void ThermostatClimate::set_supports_heat_cool(bool supports_heat_cool) {
   this->supports_heat_cool_ = supports_heat_cool;
 }
@@ -1325,9 +1368,11 @@ void ThermostatClimate::dump_config() {
 
   ESP_LOGCONFIG(TAG,
                 "  On boot, restore from: %s\n"
-                "  Use Start-up Delay: %s",
+                "  Use Start-up Delay: %s\n"
+                "  Current Temperature Publish Delta: %.1f°C\n"
+                "  Minimum Publish Interval: %" PRIu32 "ms",
                 this->on_boot_restore_from_ == thermostat::DEFAULT_PRESET ? "DEFAULT_PRESET" : "MEMORY",
-                YESNO(this->use_startup_delay_));
+                YESNO(this->use_startup_delay_), this->current_temperature_publish_delta_, this->min_publish_interval_);
   if (this->supports_two_points_) {
     ESP_LOGCONFIG(TAG, "  Minimum Set Point Differential: %.1f°C", this->set_point_minimum_differential_);
   }
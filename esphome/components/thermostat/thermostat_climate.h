@@ -91,6 +91,8 @@ class ThermostatClimate : public climate::Climate, public Component {
   void set_sensor(sensor::Sensor *sensor);
   void set_humidity_sensor(sensor::Sensor *humidity_sensor);
   void set_use_startup_delay(bool use_startup_delay);
+  void set_current_temperature_publish_delta(float delta);
+  void set_min_publish_interval(uint32_t interval);
   void set_supports_auto(bool supports_auto);
   void set_supports_heat_cool(bool supports_heat_cool);
   void set_supports_cool(bool supports_cool);
@@ -210,6 +212,9 @@ class ThermostatClimate : public climate::Climate, public Component {
   /// Check if the temperature change trigger should be called.
   void check_temperature_change_trigger_();
 
+  /// Publish after a sensor update, unless neither the action nor a measured value visibly changed.
+  void publish_measurement_();
+
   /// Is the action ready to be called? Returns true if so
   bool idle_action_ready_();
   bool cooling_action_ready_();
@@ -331,6 +336,17 @@ class ThermostatClimate : public climate::Climate, public Component {
   /// setup_complete_ blocks modifying/resetting the temps immediately after boot
   bool setup_complete_{false};
 
+  /// A sensor update publishes once it changes the current temperature by at least this much
+  float current_temperature_publish_delta_{0};
+  /// Shortest time between publishes of a sensor update, later updates are published once it has passed
+  uint32_t min_publish_interval_{0};
+  /// Last published state, compared against by publish_measurement_()
+  climate::ClimateAction published_action_{climate::CLIMATE_ACTION_OFF};
+  float published_current_temperature_{NAN};
+  float published_current_humidity_{NAN};
+  uint32_t last_publish_{0};
+  bool publish_pending_{false};
+
   /// Store previously-known temperatures
   ///
   /// These are used to determine when the temperature change trigger/action needs to be called
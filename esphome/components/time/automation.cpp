@@ -2,14 +2,14 @@
 
 #include "esphome/core/log.h"
 
-#include <cinttypes>
+#include <algorithm>
 
 namespace esphome {
 namespace time {
 
 static const char *const TAG = "automation";
-static const int MAX_TIMESTAMP_DRIFT = 900;  // how far can the clock drift before we consider
-                                             // there has been a drastic time synchronization
+// Days, hours or minutes skipped before next_fire_after() gives up, covers schedules matching once in four years
+static const uint16_t MAX_CRON_SEARCH_STEPS = 2000;
 
 void CronTrigger::add_second(uint8_t second) { this->seconds_[second] = true; }
 void CronTrigger::add_minute(uint8_t minute) { this->minutes_[minute] = true; }
@@ -21,46 +21,53 @@ bool CronTrigger::matches(const ESPTime &time) {
   return time.is_valid() && this->seconds_[time.second] && this->minutes_[time.minute] && this->hours_[time.hour] &&
          this->days_of_month_[time.day_of_month] && this->months_[time.month] && this->days_of_week_[time.day_of_week];
 }
-void CronTrigger::loop() {
-  ESPTime time = this->rtc_->now();
-  if (!time.is_valid())
-    return;
 
-  if (this->last_check_.has_value()) {
-    if (*this->last_check_ > time && this->last_check_->timestamp - time.timestamp > MAX_TIMESTAMP_DRIFT) {
-      // We went back in time (a lot), probably caused by time synchronization
-      ESP_LOGW(TAG, "Time has jumped back!");
-    } else if (*this->last_check_ >= time) {
-      // already handled this one
-      return;
-    } else if (time > *this->last_check_ && time.timestamp - this->last_check_->timestamp > MAX_TIMESTAMP_DRIFT) {
-      // We went ahead in time (a lot), probably caused by time synchronization
-      ESP_LOGW(TAG, "Time has jumped ahead!");
-      this->last_check_ = time;
-      return;
-    }
-
-    while (true) {
-      this->last_check_->increment_second();
-      if (*this->last_check_ >= time)
-        break;
+/// Index of the first set bit in [from, end), or end if there is none.
+template<size_t N> static uint8_t next_set_bit(const std::bitset<N> &bits, uint8_t from, uint8_t end) {
+  while (from < end && !bits[from])
+    from++;
+  return from;
+}
 
-      if (this->matches(*this->last_check_))
-        this->trigger();
-    }
+/// Local midnight of the next day or the start of the next hour, mktime() places them correctly around DST changes.
+static time_t next_local_boundary(ESPTime time, bool next_day) {
+  if (next_day) {
+    time.day_of_month++;
+    time.hour = 0;
+  } else {
+    time.hour++;
   }
+  time.minute = 0;
+  time.second = 0;
+  time.recalc_timestamp_local();
+  return time.timestamp;
+}
 
-  this->last_check_ = time;
-  if (!time.fields_in_range()) {
-    ESP_LOGW(TAG, "Time is out of range!");
-    ESP_LOGD(TAG, "Second=%02u Minute=%02u Hour=%02u DayOfWeek=%u DayOfMonth=%u DayOfYear=%u Month=%u time=%" PRId64,
-             time.second, time.minute, time.hour, time.day_of_week, time.day_of_month, time.day_of_year, time.month,
-             (int64_t) time.timestamp);
+time_t CronTrigger::next_fire_after(time_t after) const {
+  time_t at = after + 1;
+  for (uint16_t step = 0; step < MAX_CRON_SEARCH_STEPS; step++) {
+    const ESPTime time = ESPTime::from_epoch_local(at);
+    time_t next;
+    if (!this->months_[time.month] || !this->days_of_month_[time.day_of_month] ||
+        !this->days_of_week_[time.day_of_week]) {
+      next = next_local_boundary(time, true);
+    } else if (!this->hours_[time.hour]) {
+      next = next_local_boundary(time, false);
+    } else if (!this->minutes_[time.minute]) {
+      const uint8_t minute = next_set_bit(this->minutes_, time.minute, 60);
+      next = minute < 60 ? at + (minute - time.minute) * 60 - time.second : next_local_boundary(time, false);
+    } else if (!this->seconds_[time.second]) {
+      next = at + next_set_bit(this->seconds_, time.second, 60) - time.second;
+    } else {
+      return at;
+    }
+    // An ambiguous local time around a DST change may map back, always move forward
+    at = std::max<time_t>(next, at + 1);
   }
-
-  if (this->matches(time))
-    this->trigger();
+  return at;
 }
+
+void CronTrigger::setup() { this->rtc_->register_cron_trigger(this); }
 CronTrigger::CronTrigger(RealTimeClock *rtc) : rtc_(rtc) {}
 void CronTrigger::add_seconds(const std::vector<uint8_t> &seconds) {
   for (uint8_t it : seconds)
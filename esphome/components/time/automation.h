@@ -27,7 +27,11 @@ class CronTrigger : public Trigger<>, public Component {
   void add_day_of_week(uint8_t day_of_week);
   void add_days_of_week(const std::vector<uint8_t> &days_of_week);
   bool matches(const ESPTime &time);
-  void loop() override;
+  /** The first time after the epoch after at which matches() holds, found by skipping whole days, hours and minutes
+   * that cannot match. Gives up after a bounded search and returns where it stopped, check it with matches().
+   */
+  time_t next_fire_after(time_t after) const;
+  void setup() override;
   float get_setup_priority() const override;
 
  protected:
@@ -38,7 +42,6 @@ class CronTrigger : public Trigger<>, public Component {
   std::bitset<13> months_;
   std::bitset<8> days_of_week_;
   RealTimeClock *rtc_;
-  optional<ESPTime> last_check_;
 };
 
 class SyncTrigger : public Trigger<>, public Component {
@@ -1,4 +1,5 @@
 #include "real_time_clock.h"
+#include "automation.h"
 #include "esphome/core/log.h"
 #ifdef USE_HOST
 #include <sys/time.h>
@@ -13,7 +14,9 @@
 #if defined(USE_RP2040) || defined(USE_ZEPHYR)
 #include <sys/time.h>
 #endif
+#include <algorithm>
 #include <cerrno>
+#include <functional>
 
 #include <cinttypes>
 
@@ -21,6 +24,13 @@ namespace esphome {
 namespace time {
 
 static const char *const TAG = "time";
+static const char *const CRON_TIMEOUT = "cron";
+static const int MAX_TIMESTAMP_DRIFT = 900;  // how far can the clock drift before we consider
+                                             // there has been a drastic time synchronization
+// Longest sleep between two checks, so a time change that was not synchronized through this clock is noticed
+static const uint32_t MAX_CRON_SLEEP_S = 60;
+// Interval of the checks within the second before a trigger is due, the sleep itself is only second accurate
+static const uint32_t CRON_POLL_MS = 50;
 
 RealTimeClock::RealTimeClock() = default;
 void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
@@ -64,6 +74,83 @@ void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
   this->time_sync_callback_.call();
 }
 
+void RealTimeClock::register_cron_trigger(CronTrigger *trigger) {
+  if (this->cron_triggers_.empty())
+    this->add_on_time_sync_callback([this]() { this->schedule_cron_triggers_(); });
+  this->cron_triggers_.push_back(trigger);
+  if (this->cron_last_check_ == 0) {
+    this->schedule_cron_triggers_();
+    return;
+  }
+  this->push_cron_event_(this->cron_last_check_, trigger);
+  this->arm_cron_timeout_(this->timestamp_now());
+}
+
+void RealTimeClock::push_cron_event_(time_t after, CronTrigger *trigger) {
+  this->cron_events_.push_back({trigger->next_fire_after(after), trigger});
+  std::push_heap(this->cron_events_.begin(), this->cron_events_.end(), std::greater<>());
+}
+
+void RealTimeClock::schedule_cron_triggers_() {
+  if (this->cron_triggers_.empty())
+    return;
+  this->cron_events_.clear();
+  const time_t now = this->timestamp_now();
+  if (!ESPTime::from_epoch_local(now).is_valid()) {
+    // Nothing can match before the time is known, look again shortly
+    this->set_timeout(CRON_TIMEOUT, 1000, [this]() { this->schedule_cron_triggers_(); });
+    return;
+  }
+
+  // Continue after the last second handled, so a small correction neither repeats nor skips a trigger. Otherwise
+  // start one second back, which lets a trigger matching the current second fire right away.
+  time_t after = now - 1;
+  if (this->cron_last_check_ != 0) {
+    if (this->cron_last_check_ > now + MAX_TIMESTAMP_DRIFT) {
+      // We went back in time (a lot), probably caused by time synchronization
+      ESP_LOGW(TAG, "Time has jumped back!");
+    } else if (now - this->cron_last_check_ > MAX_TIMESTAMP_DRIFT) {
+      // We went ahead in time (a lot), probably caused by time synchronization
+      ESP_LOGW(TAG, "Time has jumped ahead!");
+    } else {
+      after = this->cron_last_check_;
+    }
+  }
+  this->cron_last_check_ = after;
+  for (auto *trigger : this->cron_triggers_)
+    this->push_cron_event_(after, trigger);
+  this->arm_cron_timeout_(now);
+}
+
+void RealTimeClock::process_cron_triggers_() {
+  const time_t now = this->timestamp_now();
+  if (this->cron_last_check_ > now + MAX_TIMESTAMP_DRIFT || now - this->cron_last_check_ > MAX_TIMESTAMP_DRIFT) {
+    this->schedule_cron_triggers_();
+    return;
+  }
+
+  // Triggers missed by a late wake or a small jump ahead fire now, in order
+  while (!this->cron_events_.empty() && this->cron_events_.front().at <= now) {
+    std::pop_heap(this->cron_events_.begin(), this->cron_events_.end(), std::greater<>());
+    const CronEvent event = this->cron_events_.back();
+    this->cron_events_.pop_back();
+    // A search that gave up is only a point to continue from
+    if (event.trigger->matches(ESPTime::from_epoch_local(event.at)))
+      event.trigger->trigger();
+    this->push_cron_event_(event.at, event.trigger);
+  }
+  this->cron_last_check_ = now;
+  this->arm_cron_timeout_(now);
+}
+
+void RealTimeClock::arm_cron_timeout_(time_t now) {
+  if (this->cron_events_.empty())
+    return;
+  const time_t wait_s = this->cron_events_.front().at - now;
+  const uint32_t timeout = wait_s <= 1 ? CRON_POLL_MS : std::min<time_t>(wait_s - 1, MAX_CRON_SLEEP_S) * 1000;
+  this->set_timeout(CRON_TIMEOUT, timeout, [this]() { this->process_cron_triggers_(); });
+}
+
 #ifdef USE_TIME_TIMEZONE
 void RealTimeClock::apply_timezone_() {
   setenv("TZ", this->timezone_.c_str(), 1);
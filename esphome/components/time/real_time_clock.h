@@ -2,6 +2,7 @@
 
 #include <bitset>
 #include <cstdlib>
+#include <vector>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
@@ -10,6 +11,8 @@
 namespace esphome {
 namespace time {
 
+class CronTrigger;
+
 /// The RealTimeClock class exposes common timekeeping functions via the device's local real-time clock.
 ///
 /// \note
@@ -25,6 +28,7 @@ class RealTimeClock : public PollingComponent {
   void set_timezone(const std::string &tz) {
     this->timezone_ = tz;
     this->apply_timezone_();
+    this->schedule_cron_triggers_();
   }
 
   /// Get the time zone currently in use.
@@ -44,7 +48,24 @@ class RealTimeClock : public PollingComponent {
     this->time_sync_callback_.add(std::move(callback));
   };
 
+  /// Fire the trigger whenever its schedule matches. The clock sleeps until the next trigger of all is due, and
+  /// computes every schedule again when the time is synchronized.
+  void register_cron_trigger(CronTrigger *trigger);
+
  protected:
+  struct CronEvent {
+    time_t at;
+    CronTrigger *trigger;
+    bool operator>(const CronEvent &other) const { return this->at > other.at; }
+  };
+
+  /// Compute the next fire time of every trigger as seen from the current time.
+  void schedule_cron_triggers_();
+  /// Fire the triggers that are due and sleep until the next one.
+  void process_cron_triggers_();
+  void push_cron_event_(time_t after, CronTrigger *trigger);
+  void arm_cron_timeout_(time_t now);
+
   /// Report a unix epoch as current time.
   void synchronize_epoch_(uint32_t epoch);
 
@@ -54,6 +75,9 @@ class RealTimeClock : public PollingComponent {
 #endif
 
   CallbackManager<void()> time_sync_callback_;
+  std::vector<CronTrigger *> cron_triggers_;
+  std::vector<CronEvent> cron_events_;  // Min-heap on at
+  time_t cron_last_check_{0};
 };
 
 template<typename... Ts> class TimeHasTimeCondition : public Condition<Ts...> {
@@ -19,6 +19,8 @@ const uint16_t TOSHIBA_PACKET_SPACE = 10500;
 const uint16_t TOSHIBA_BIT_MARK = 540;
 const uint16_t TOSHIBA_ZERO_SPACE = 540;
 const uint16_t TOSHIBA_ONE_SPACE = 1620;
+constexpr remote_base::PulseDistanceTimings TOSHIBA_BIT_TIMINGS{TOSHIBA_BIT_MARK, TOSHIBA_ONE_SPACE,
+                                                                TOSHIBA_ZERO_SPACE, true};
 const uint16_t TOSHIBA_CARRIER_FREQUENCY = 38000;
 const uint8_t TOSHIBA_HEADER_LENGTH = 4;
 // Generic Toshiba commands/flags
@@ -732,20 +734,11 @@ bool ToshibaClimate::on_receive(remote_base::RemoteReceiveData data) {
 void ToshibaClimate::encode_(remote_base::RemoteTransmitData *data, const uint8_t *message, const uint8_t nbytes,
                              const uint8_t repeat) {
   data->set_carrier_frequency(TOSHIBA_CARRIER_FREQUENCY);
+  data->reserve(data->get_data().size() + (repeat + 1) * (nbytes * 16 + 4));
 
   for (uint8_t copy = 0; copy <= repeat; copy++) {
     data->item(TOSHIBA_HEADER_MARK, TOSHIBA_HEADER_SPACE);
-
-    for (uint8_t byte = 0; byte < nbytes; byte++) {
-      for (uint8_t bit = 0; bit < 8; bit++) {
-        data->mark(TOSHIBA_BIT_MARK);
-        if (message[byte] & (1 << (7 - bit))) {
-          data->space(TOSHIBA_ONE_SPACE);
-        } else {
-          data->space(TOSHIBA_ZERO_SPACE);
-        }
-      }
-    }
+    data->encode_bytes(message, nbytes, TOSHIBA_BIT_TIMINGS);
     data->item(TOSHIBA_BIT_MARK, TOSHIBA_GAP_SPACE);
   }
 }
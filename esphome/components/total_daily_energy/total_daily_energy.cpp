@@ -18,9 +18,27 @@ void TotalDailyEnergy::setup() {
   this->last_update_ = millis();
 
   this->parent_->add_on_state_callback([this](float state) { this->process_new_state_(state); });
+  if (this->publish_interval_ > 0) {
+    this->set_interval(this->publish_interval_, [this]() {
+      if (this->publish_pending_)
+        this->publish_();
+    });
+  }
+}
+
+void TotalDailyEnergy::dump_config() {
+  LOG_SENSOR("", "Total Daily Energy", this);
+  if (this->publish_interval_ > 0)
+    ESP_LOGCONFIG(TAG, "  Publish Interval: %" PRIu32 " ms", this->publish_interval_);
+  if (this->restore_ && this->save_interval_ > 0)
+    ESP_LOGCONFIG(TAG, "  Save Interval: %" PRIu32 " ms", this->save_interval_);
 }
 
-void TotalDailyEnergy::dump_config() { LOG_SENSOR("", "Total Daily Energy", this); }
+void TotalDailyEnergy::on_safe_shutdown() {
+  // The last deltas are not lost with a save interval
+  if (this->restore_)
+    this->save_();
+}
 
 void TotalDailyEnergy::loop() {
   auto t = this->time_->now();
@@ -42,19 +60,32 @@ void TotalDailyEnergy::loop() {
 void TotalDailyEnergy::publish_state_and_save(float state) {
   this->total_energy_ = state;
   this->publish_state(state);
-  if (this->restore_) {
-    this->pref_.save(&state);
-  }
+  this->publish_pending_ = false;
+  if (this->restore_)
+    this->save_();
+}
+
+void TotalDailyEnergy::publish_() {
+  this->publish_state(this->total_energy_);
+  this->publish_pending_ = false;
+  if (this->restore_ && millis() - this->last_save_ >= this->save_interval_)
+    this->save_();
+}
+
+void TotalDailyEnergy::save_() {
+  float state = this->total_energy_;
+  this->pref_.save(&state);
+  this->last_save_ = millis();
 }
 
 void TotalDailyEnergy::process_new_state_(float state) {
   if (std::isnan(state))
     return;
   const uint32_t now = millis();
-  const float old_state = this->last_power_state_;
-  const float new_state = state;
-  float delta_hours = (now - this->last_update_) / 1000.0f / 60.0f / 60.0f;
-  float delta_energy = 0.0f;
+  const double old_state = this->last_power_state_;
+  const double new_state = state;
+  const double delta_hours = (now - this->last_update_) / 3600000.0;
+  double delta_energy = 0.0;
   switch (this->method_) {
     case TOTAL_DAILY_ENERGY_METHOD_TRAPEZOID:
       delta_energy = delta_hours * (old_state + new_state) / 2.0;
@@ -68,7 +99,12 @@ void TotalDailyEnergy::process_new_state_(float state) {
   }
   this->last_power_state_ = new_state;
   this->last_update_ = now;
-  this->publish_state_and_save(this->total_energy_ + delta_energy);
+  this->total_energy_ += delta_energy;
+  if (this->publish_interval_ > 0) {
+    this->publish_pending_ = true;
+  } else {
+    this->publish_();
+  }
 }
 
 }  // namespace total_daily_energy
@@ -21,14 +21,22 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
   void set_time(time::RealTimeClock *time) { time_ = time; }
   void set_parent(Sensor *parent) { parent_ = parent; }
   void set_method(TotalDailyEnergyMethod method) { method_ = method; }
+  /// Publishes the energy at most every interval ms instead of on every power value, 0 for every value.
+  void set_publish_interval(uint32_t interval) { publish_interval_ = interval; }
+  /// Saves the energy at most every interval ms, 0 saves it on every publish.
+  void set_save_interval(uint32_t interval) { save_interval_ = interval; }
   void setup() override;
   void dump_config() override;
   void loop() override;
+  void on_safe_shutdown() override;
 
   void publish_state_and_save(float state);
 
  protected:
   void process_new_state_(float state);
+  /// Publishes the energy and saves it when the save interval has passed.
+  void publish_();
+  void save_();
 
   ESPPreferenceObject pref_;
   time::RealTimeClock *time_;
@@ -36,8 +44,13 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
   TotalDailyEnergyMethod method_;
   uint16_t last_day_of_year_{};
   uint32_t last_update_{0};
+  uint32_t publish_interval_{0};
+  uint32_t save_interval_{0};
+  uint32_t last_save_{0};
   bool restore_;
-  float total_energy_{0.0f};
+  bool publish_pending_{false};
+  // Accumulated in double, a float stops adding small deltas to a large total
+  double total_energy_{0.0};
   float last_power_state_{0.0f};
 };
 
@@ -7,9 +7,14 @@ namespace touchscreen {
 
 static const char *const TAG = "touchscreen";
 
-void TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) { store->touched = true; }
+void IRAM_ATTR TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) {
+  store->touched = true;
+  if (store->component != nullptr)
+    store->component->enable_loop_soon_any_context();
+}
 
 void Touchscreen::attach_interrupt_(InternalGPIOPin *irq_pin, esphome::gpio::InterruptType type) {
+  this->store_.component = this;
   irq_pin->attach_interrupt(TouchscreenInterrupt::gpio_intr, &this->store_, type);
   this->store_.init = true;
   this->store_.touched = false;
@@ -26,7 +31,7 @@ void Touchscreen::call_setup() {
 
 void Touchscreen::update() {
   if (!this->store_.init) {
-    this->store_.touched = true;
+    this->request_read();
   } else {
     // no need to poll if we have interrupts.
     ESP_LOGW(TAG, "Touch Polling Stopped. You can safely remove the 'update_interval:' variable from the YAML file.");
@@ -35,39 +40,43 @@ void Touchscreen::update() {
 }
 
 void Touchscreen::loop() {
-  if (this->store_.touched) {
-    ESP_LOGVV(TAG, "<< Do Touch loop >>");
-    this->first_touch_ = this->touches_.empty();
-    this->need_update_ = false;
-    this->is_touched_ = false;
-    this->skip_update_ = false;
+  if (!this->store_.touched) {
+    // Nothing to read until the interrupt, the poller or the touch timeout requests it
+    this->disable_loop();
+    return;
+  }
+  ESP_LOGVV(TAG, "<< Do Touch loop >>");
+  this->first_touch_ = this->touches_.empty();
+  this->need_update_ = false;
+  this->is_touched_ = false;
+  this->skip_update_ = false;
+  for (auto &tp : this->touches_) {
+    if (tp.second.state == STATE_PRESSED || tp.second.state == STATE_UPDATED) {
+      tp.second.state |= STATE_RELEASING;
+    } else {
+      tp.second.state = STATE_RELEASED;
+    }
+    tp.second.x_prev = tp.second.x;
+    tp.second.y_prev = tp.second.y;
+  }
+  // The interrupt flag must be reset BEFORE calling update_touches, otherwise we might miss an interrupt that was
+  // triggered while we were reading touch data.
+  this->store_.touched = false;
+  this->update_touches();
+  if (this->skip_update_) {
     for (auto &tp : this->touches_) {
-      if (tp.second.state == STATE_PRESSED || tp.second.state == STATE_UPDATED) {
-        tp.second.state |= STATE_RELEASING;
-      } else {
-        tp.second.state = STATE_RELEASED;
-      }
-      tp.second.x_prev = tp.second.x;
-      tp.second.y_prev = tp.second.y;
+      tp.second.state &= ~STATE_RELEASING;
     }
-    // The interrupt flag must be reset BEFORE calling update_touches, otherwise we might miss an interrupt that was
-    // triggered while we were reading touch data.
-    this->store_.touched = false;
-    this->update_touches();
-    if (this->skip_update_) {
-      for (auto &tp : this->touches_) {
-        tp.second.state &= ~STATE_RELEASING;
-      }
-    } else {
-      this->defer([this]() { this->send_touches_(); });
-      if (this->touch_timeout_ > 0) {
-        // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
-        // This is to detect touch release.
-        if (this->is_touched_) {
-          this->set_timeout(TAG, this->touch_timeout_, [this]() { this->store_.touched = true; });
-        } else {
-          this->cancel_timeout(TAG);
-        }
+  } else {
+    // All points of this read go to the listeners at once, without waiting for another loop
+    this->send_touches_();
+    if (this->touch_timeout_ > 0) {
+      // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
+      // This is to detect touch release.
+      if (this->is_touched_) {
+        this->set_timeout(TAG, this->touch_timeout_, [this]() { this->request_read(); });
+      } else {
+        this->cancel_timeout(TAG);
       }
     }
   }
@@ -114,7 +123,8 @@ void Touchscreen::add_raw_touch_position_(uint8_t id, int16_t x_raw, int16_t y_r
 }
 
 void Touchscreen::send_touches_() {
-  TouchPoints_t touches;
+  TouchPoints_t &touches = this->touch_points_;
+  touches.clear();
   ESP_LOGV(TAG, "Touch status: is_touched=%d, was_touched=%d", this->is_touched_, this->was_touched_);
   for (auto tp : this->touches_) {
     ESP_LOGV(TAG, "Touch status: %d/%d: raw:(%4d,%4d,%4d) calc:(%3d,%4d)", tp.second.id, tp.second.state,
@@ -32,6 +32,8 @@ using TouchPoints_t = std::vector<TouchPoint>;
 struct TouchscreenInterrupt {
   volatile bool touched{true};
   bool init{false};
+  // Woken from the interrupt, its loop is disabled while nothing is touched
+  Component *component{nullptr};
   static void gpio_intr(TouchscreenInterrupt *store);
 };
 
@@ -64,6 +66,11 @@ class Touchscreen : public PollingComponent {
   Trigger<> *get_release_trigger() { return &this->release_trigger_; }
 
   void register_listener(TouchListener *listener) { this->touch_listeners_.push_back(listener); }
+  /// Reads the touch controller on the next loop, as if it had signalled a touch.
+  void request_read() {
+    this->store_.touched = true;
+    this->enable_loop();
+  }
 
   optional<TouchPoint> get_touch() { return this->touches_.begin()->second; }
 
@@ -104,6 +111,8 @@ class Touchscreen : public PollingComponent {
   Trigger<const TouchPoints_t &> update_trigger_;
   Trigger<> release_trigger_;
   std::vector<TouchListener *> touch_listeners_;
+  // Reused for every update, so sending the touches of a read does not allocate
+  TouchPoints_t touch_points_;
 
   std::map<uint8_t, TouchPoint> touches_;
   TouchscreenInterrupt store_;
@@ -71,7 +71,7 @@ void TT21100Touchscreen::setup() {
   }
 
   // Trigger initial read to activate the interrupt
-  this->store_.touched = true;
+  this->request_read();
 }
 
 void TT21100Touchscreen::update_touches() {
@@ -20,6 +20,8 @@ static const char *const TAG = "tuya";
 static const int COMMAND_DELAY = 10;
 static const int RECEIVE_TIMEOUT = 300;
 static const int MAX_RETRIES = 5;
+// Largest DATAPOINT_DELIVER payload built from combined datapoint updates
+static const size_t MAX_COMBINED_PAYLOAD = 256;
 
 void Tuya::setup() {
   this->set_interval("heartbeat", 15000, [this] { this->send_empty_command_(TuyaCommandType::HEARTBEAT); });
@@ -38,7 +40,10 @@ void Tuya::loop() {
 }
 
 void Tuya::dump_config() {
-  ESP_LOGCONFIG(TAG, "Tuya:");
+  ESP_LOGCONFIG(TAG,
+                "Tuya:\n"
+                "  Combine datapoints: %s",
+                YESNO(this->combine_datapoints_));
   if (this->init_state_ != TuyaInitState::INIT_DONE) {
     if (this->init_failed_) {
       ESP_LOGCONFIG(TAG, "  Initialization failed. Current init_state: %u", static_cast<uint8_t>(this->init_state_));
@@ -144,6 +149,7 @@ void Tuya::handle_command_(uint8_t command, uint8_t version, const uint8_t *buff
 
   if (this->expected_response_.has_value() && this->expected_response_ == command_type) {
     this->expected_response_.reset();
+    this->last_round_trip_ = millis() - this->last_command_timestamp_;
     this->command_queue_.erase(command_queue_.begin());
     this->init_retries_ = 0;
   }
@@ -498,7 +504,17 @@ void Tuya::process_command_queue_() {
   // Left check of delay since last command in case there's ever a command sent by calling send_raw_command_ directly
   if (delay > COMMAND_DELAY && !this->command_queue_.empty() && this->rx_message_.empty() &&
       !this->expected_response_.has_value()) {
-    this->send_raw_command_(command_queue_.front());
+    TuyaCommand &front = this->command_queue_.front();
+    if (this->combine_datapoints_ && front.cmd == TuyaCommandType::DATAPOINT_DELIVER) {
+      // A delivery may hold several datapoints, the MCU reports each of them back
+      auto next = this->command_queue_.begin() + 1;
+      while (next != this->command_queue_.end() && next->cmd == TuyaCommandType::DATAPOINT_DELIVER &&
+             front.payload.size() + next->payload.size() <= MAX_COMBINED_PAYLOAD) {
+        front.payload.insert(front.payload.end(), next->payload.begin(), next->payload.end());
+        next = this->command_queue_.erase(next);
+      }
+    }
+    this->send_raw_command_(front);
     if (!this->expected_response_.has_value())
       this->command_queue_.erase(command_queue_.begin());
   }
@@ -716,6 +732,20 @@ void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datap
   buffer.push_back(data.size() >> 0);
   buffer.insert(buffer.end(), data.begin(), data.end());
 
+  // Latest value wins: an update of this datapoint still waiting in the queue is replaced, so a slider does not
+  // leave a backlog of stale values. The front command may already be waiting for its response, leave it alone.
+  auto it = this->command_queue_.begin();
+  if (this->expected_response_.has_value() && it != this->command_queue_.end())
+    it++;
+  for (; it != this->command_queue_.end(); it++) {
+    if (it->cmd == TuyaCommandType::DATAPOINT_DELIVER && !it->payload.empty() && it->payload[0] == datapoint_id) {
+      ESP_LOGV(TAG, "Replacing queued value of datapoint %u", datapoint_id);
+      it->payload = std::move(buffer);
+      this->coalesced_count_++;
+      return;
+    }
+  }
+
   this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = buffer});
 }
 
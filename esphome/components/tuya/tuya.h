@@ -106,6 +106,14 @@ class Tuya : public Component, public uart::UARTDevice {
   void force_set_enum_datapoint_value(uint8_t datapoint_id, uint8_t value);
   void force_set_bitmask_datapoint_value(uint8_t datapoint_id, uint32_t value, uint8_t length);
   TuyaInitState get_init_state();
+  /// Send the datapoint updates waiting in the queue together in one DATAPOINT_DELIVER frame.
+  void set_combine_datapoints(bool combine_datapoints) { this->combine_datapoints_ = combine_datapoints; }
+  /// Commands waiting to be sent, including the one waiting for its response.
+  size_t get_queue_depth() const { return this->command_queue_.size(); }
+  /// Time between sending the last acknowledged command and receiving its response, in ms.
+  uint32_t get_last_round_trip() const { return this->last_round_trip_; }
+  /// Datapoint updates replaced by a newer value for the same datapoint before they were sent.
+  uint32_t get_coalesced_count() const { return this->coalesced_count_; }
 #ifdef USE_TIME
   void set_time_id(time::RealTimeClock *time_id) { this->time_id_ = time_id; }
 #endif
@@ -158,6 +166,9 @@ class Tuya : public Component, public uart::UARTDevice {
   std::vector<uint8_t> ignore_mcu_update_on_datapoints_{};
   std::vector<TuyaCommand> command_queue_;
   optional<TuyaCommandType> expected_response_{};
+  bool combine_datapoints_{false};
+  uint32_t last_round_trip_{0};
+  uint32_t coalesced_count_{0};
   uint8_t wifi_status_ = -1;
   CallbackManager<void()> initialized_callback_{};
 };
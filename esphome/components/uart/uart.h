@@ -48,6 +48,10 @@ class UARTDevice {
 
   void flush() { this->parent_->flush(); }
 
+  bool add_rx_listener(Component *listener) { return this->parent_->add_rx_listener(listener); }
+  uint8_t take_rx_events() { return this->parent_->take_rx_events(); }
+  bool set_rx_pattern(char pattern, uint8_t count) { return this->parent_->set_rx_pattern(pattern, count); }
+
   // Compat APIs
   int read() {
     uint8_t data;
@@ -28,6 +28,15 @@ enum UARTDirection {
 };
 #endif
 
+/// Receive events reported to RX listeners, see UARTComponent::add_rx_listener().
+enum UARTRxEvent : uint8_t {
+  UART_RX_EVENT_DATA = 1 << 0,      ///< Bytes were added to the RX buffer.
+  UART_RX_EVENT_IDLE = 1 << 1,      ///< The line went idle after receiving, a frame is likely complete.
+  UART_RX_EVENT_PATTERN = 1 << 2,   ///< The pattern set with set_rx_pattern() was received.
+  UART_RX_EVENT_OVERFLOW = 1 << 3,  ///< Received bytes were dropped because the FIFO or the RX buffer was full.
+  UART_RX_EVENT_ERROR = 1 << 4,     ///< A break, parity or framing error was detected.
+};
+
 const LogString *parity_to_str(UARTParityOptions parity);
 
 class UARTComponent {
@@ -75,6 +84,23 @@ class UARTComponent {
   // Pure virtual method to block until all bytes have been written to the UART bus.
   virtual void flush() = 0;
 
+  // Wakes the loop of a component whenever a receive event happens, so it can disable its loop while the line is
+  // quiet instead of polling available(). The wakeup goes through Component::enable_loop_soon_any_context().
+  // Call it from the setup() of the listener, at most 4 listeners are supported per bus.
+  // @param listener The component to wake up.
+  // @return True if the platform reports receive events, false if the listener has to keep polling.
+  virtual bool add_rx_listener(Component *listener) { return false; }
+
+  // Returns the receive events that happened since the last call and clears them.
+  // @return Bitmask of UARTRxEvent values.
+  virtual uint8_t take_rx_events() { return 0; }
+
+  // Reports UART_RX_EVENT_PATTERN once count consecutive pattern characters were received.
+  // @param pattern The character to detect.
+  // @param count Number of consecutive characters forming the pattern, 0 disables the detection.
+  // @return True if the platform supports pattern detection.
+  virtual bool set_rx_pattern(char pattern, uint8_t count) { return false; }
+
   // Sets the TX (transmit) pin for the UART bus.
   // @param tx_pin Pointer to the internal GPIO pin used for transmission.
   void set_tx_pin(InternalGPIOPin *tx_pin) { this->tx_pin_ = tx_pin; }
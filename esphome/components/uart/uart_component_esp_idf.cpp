@@ -93,6 +93,9 @@ void IDFUARTComponent::setup() {
   this->load_settings(false);
 
   xSemaphoreGive(this->lock_);
+
+  if (this->rx_listener_count_ > 0 && !this->is_failed())
+    this->start_rx_event_task_();
 }
 
 void IDFUARTComponent::load_settings(bool dump_config) {
@@ -129,6 +132,7 @@ void IDFUARTComponent::load_settings(bool dump_config) {
   }
 
   if (uart_is_driver_installed(this->uart_num_)) {
+    this->pause_rx_event_task_();
     uart_driver_delete(this->uart_num_);
     if (err != ESP_OK) {
       ESP_LOGW(TAG, "uart_driver_delete failed: %s", esp_err_to_name(err));
@@ -147,6 +151,11 @@ void IDFUARTComponent::load_settings(bool dump_config) {
     this->mark_failed();
     return;
   }
+  if (this->rx_event_task_paused_) {
+    // The event queue was recreated along with the driver, let the task wait on the new one
+    this->rx_event_task_paused_ = false;
+    xTaskNotifyGive(this->rx_event_task_);
+  }
 
   err = uart_set_rx_full_threshold(this->uart_num_, this->rx_full_threshold_);
   if (err != ESP_OK) {
@@ -162,6 +171,9 @@ void IDFUARTComponent::load_settings(bool dump_config) {
     return;
   }
 
+  if (this->rx_pattern_count_ > 0)
+    this->apply_rx_pattern_();
+
   auto mode = this->flow_control_pin_ != nullptr ? UART_MODE_RS485_HALF_DUPLEX : UART_MODE_UART;
   err = uart_set_mode(this->uart_num_, mode);
   if (err != ESP_OK) {
@@ -290,6 +302,102 @@ void IDFUARTComponent::flush() {
   xSemaphoreGive(this->lock_);
 }
 
+bool IDFUARTComponent::add_rx_listener(Component *listener) {
+  const uint8_t count = this->rx_listener_count_;
+  if (count == this->rx_listeners_.size()) {
+    ESP_LOGE(TAG, "Too many RX listeners on UART %u", this->uart_num_);
+    return false;
+  }
+  this->rx_listeners_[count] = listener;
+  this->rx_listener_count_ = count + 1;
+  // Listeners set up before the bus get the task started by setup()
+  if (this->rx_event_task_ == nullptr && uart_is_driver_installed(this->uart_num_))
+    this->start_rx_event_task_();
+  return true;
+}
+
+bool IDFUARTComponent::set_rx_pattern(char pattern, uint8_t count) {
+  this->rx_pattern_ = pattern;
+  this->rx_pattern_count_ = count;
+  if (!this->is_ready())
+    return true;
+  if (count == 0)
+    return uart_disable_pattern_det_intr(this->uart_num_) == ESP_OK;
+  return this->apply_rx_pattern_();
+}
+
+bool IDFUARTComponent::apply_rx_pattern_() {
+  // Pattern characters may be up to 9 bit times apart, no idle time is required around them
+  esp_err_t err = uart_enable_pattern_det_baud_intr(this->uart_num_, this->rx_pattern_, this->rx_pattern_count_, 9, 0, 0);
+  if (err == ESP_OK) {
+    // Positions are not used, but the driver needs a queue to record them in
+    err = uart_pattern_queue_reset(this->uart_num_, 4);
+  }
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "uart_enable_pattern_det_baud_intr failed: %s", esp_err_to_name(err));
+    return false;
+  }
+  return true;
+}
+
+void IDFUARTComponent::start_rx_event_task_() {
+  // Runs above the main loop so listeners are woken as soon as the driver posts an event
+  if (xTaskCreate(&IDFUARTComponent::rx_event_task, "uart_rx_event", 2048, this, 2, &this->rx_event_task_) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to start the RX event task of UART %u", this->uart_num_);
+    this->rx_event_task_ = nullptr;
+  }
+}
+
+void IDFUARTComponent::pause_rx_event_task_() {
+  if (this->rx_event_task_ == nullptr || this->rx_event_task_paused_)
+    return;
+  // The driver never posts UART_EVENT_MAX, the task takes it as the request to stop using the queue
+  uart_event_t pause{};
+  pause.type = UART_EVENT_MAX;
+  xQueueSendToFront(this->uart_event_queue_, &pause, portMAX_DELAY);
+  while (!this->rx_event_task_paused_)
+    vTaskDelay(1);
+}
+
+void IDFUARTComponent::rx_event_task(void *arg) {
+  auto *that = static_cast<IDFUARTComponent *>(arg);
+  uart_event_t event;
+  while (true) {
+    if (xQueueReceive(that->uart_event_queue_, &event, portMAX_DELAY) != pdTRUE)
+      continue;
+    uint8_t events;
+    switch (event.type) {
+      case UART_DATA:
+        // The driver flags data pushed by the RX timeout interrupt, the line has been idle for rx_timeout symbols
+        events = event.timeout_flag ? UART_RX_EVENT_DATA | UART_RX_EVENT_IDLE : UART_RX_EVENT_DATA;
+        break;
+      case UART_PATTERN_DET:
+        events = UART_RX_EVENT_PATTERN;
+        break;
+      case UART_FIFO_OVF:
+      case UART_BUFFER_FULL:
+        events = UART_RX_EVENT_OVERFLOW;
+        break;
+      case UART_BREAK:
+      case UART_PARITY_ERR:
+      case UART_FRAME_ERR:
+        events = UART_RX_EVENT_ERROR;
+        break;
+      case UART_EVENT_MAX:
+        // load_settings() is reinstalling the driver, wait until the new event queue exists
+        that->rx_event_task_paused_ = true;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        continue;
+      default:
+        continue;
+    }
+    that->rx_events_.fetch_or(events);
+    const uint8_t count = that->rx_listener_count_;
+    for (uint8_t i = 0; i < count; i++)
+      that->rx_listeners_[i]->enable_loop_soon_any_context();
+  }
+}
+
 void IDFUARTComponent::check_logger_conflict() {}
 
 }  // namespace uart
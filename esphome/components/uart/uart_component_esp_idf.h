@@ -3,6 +3,8 @@
 #ifdef USE_ESP32
 
 #include <driver/uart.h>
+#include <array>
+#include <atomic>
 #include "esphome/core/component.h"
 #include "uart_component.h"
 
@@ -26,6 +28,10 @@ class IDFUARTComponent : public UARTComponent, public Component {
   int available() override;
   void flush() override;
 
+  bool add_rx_listener(Component *listener) override;
+  uint8_t take_rx_events() override { return this->rx_events_.exchange(0); }
+  bool set_rx_pattern(char pattern, uint8_t count) override;
+
   uint8_t get_hw_serial_number() { return this->uart_num_; }
   QueueHandle_t *get_uart_event_queue() { return &this->uart_event_queue_; }
 
@@ -53,6 +59,22 @@ class IDFUARTComponent : public UARTComponent, public Component {
 
   bool has_peek_{false};
   uint8_t peek_byte_;
+
+  bool apply_rx_pattern_();
+  /// Starts the task forwarding driver events to the RX listeners.
+  void start_rx_event_task_();
+  /// Parks the RX event task before the driver and its event queue are deleted.
+  void pause_rx_event_task_();
+  static void rx_event_task(void *arg);
+
+  // Filled from the main loop and read by the RX event task, a listener is stored before the count is raised
+  std::array<Component *, 4> rx_listeners_{};
+  std::atomic<uint8_t> rx_listener_count_{0};
+  std::atomic<uint8_t> rx_events_{0};
+  TaskHandle_t rx_event_task_{nullptr};
+  volatile bool rx_event_task_paused_{false};
+  char rx_pattern_{0};
+  uint8_t rx_pattern_count_{0};
 };
 
 }  // namespace uart
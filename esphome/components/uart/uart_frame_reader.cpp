@@ -0,0 +1,118 @@
+#include "uart_frame_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace uart {
+
+static constexpr size_t INVALID_FRAME = SIZE_MAX;
+
+std::span<const uint8_t> UARTFrameReader::read_frame(UARTComponent *parent) {
+  // Release the frame handed out by the previous call
+  this->head_ += this->frame_length_;
+  this->frame_length_ = 0;
+  if (this->head_ == this->tail_)
+    this->head_ = this->tail_ = 0;
+
+  size_t available = std::max(parent->available(), 0);
+  if (this->head_ > 0 && available > this->buffer_.size() - this->tail_) {
+    // Move the partial frame to the front, so what the bus holds fits in one read
+    memmove(this->buffer_.data(), this->buffer_.data() + this->head_, this->tail_ - this->head_);
+    this->tail_ -= this->head_;
+    this->head_ = 0;
+  }
+  const size_t to_read = std::min(available, this->buffer_.size() - this->tail_);
+  if (to_read > 0 && parent->read_array(this->buffer_.data() + this->tail_, to_read))
+    this->tail_ += to_read;
+
+  while (this->sync_header_()) {
+    const size_t length = this->complete_frame_length_();
+    if (length == 0)
+      break;
+    if (length == INVALID_FRAME) {
+      if (this->header_size_ == 0 && this->length_size_ == 0 && this->frame_size_ == 0) {
+        // No footer in a full buffer, only its last bytes can still start one
+        const size_t keep = this->footer_size_ > 0 ? this->footer_size_ - 1 : 0;
+        this->drop_(this->tail_ - this->head_ - keep);
+      } else {
+        this->drop_(1);
+      }
+      continue;
+    }
+    this->frame_length_ = length;
+    return {this->buffer_.data() + this->head_, length};
+  }
+  return {};
+}
+
+uint8_t UARTFrameReader::copy_pattern_(std::array<uint8_t, 4> &pattern, std::initializer_list<uint8_t> bytes) {
+  const size_t size = std::min(bytes.size(), pattern.size());
+  std::copy_n(bytes.begin(), size, pattern.begin());
+  return size;
+}
+
+bool UARTFrameReader::sync_header_() {
+  if (this->header_size_ == 0)
+    return this->head_ < this->tail_;
+
+  while (this->tail_ - this->head_ >= this->header_size_) {
+    const uint8_t *start = this->buffer_.data() + this->head_;
+    const auto *found = static_cast<const uint8_t *>(memchr(start, this->header_[0], this->tail_ - this->head_));
+    if (found == nullptr) {
+      this->drop_(this->tail_ - this->head_);
+      return false;
+    }
+    this->drop_(found - start);
+    if (this->tail_ - this->head_ < this->header_size_)
+      return false;
+    if (this->matches_(this->header_, this->header_size_, this->head_))
+      return true;
+    this->drop_(1);
+  }
+  return false;
+}
+
+size_t UARTFrameReader::complete_frame_length_() const {
+  const size_t buffered = this->tail_ - this->head_;
+  size_t length;
+  if (this->length_size_ > 0) {
+    if (buffered < static_cast<size_t>(this->length_offset_) + this->length_size_)
+      return 0;
+    const uint8_t *field = this->buffer_.data() + this->head_ + this->length_offset_;
+    size_t value = 0;
+    for (uint8_t i = 0; i < this->length_size_; i++) {
+      value = this->length_big_endian_ ? (value << 8) | field[i] : value | (static_cast<size_t>(field[i]) << (8 * i));
+    }
+    length = value + this->length_overhead_;
+  } else if (this->frame_size_ > 0) {
+    length = this->frame_size_;
+  } else {
+    for (size_t position = this->head_ + this->header_size_; position + this->footer_size_ <= this->tail_; position++) {
+      if (this->matches_(this->footer_, this->footer_size_, position))
+        return position + this->footer_size_ - this->head_;
+    }
+    return buffered == this->buffer_.size() ? INVALID_FRAME : 0;
+  }
+
+  if (length < static_cast<size_t>(this->header_size_) + this->footer_size_ || length > this->buffer_.size())
+    return INVALID_FRAME;
+  if (buffered < length)
+    return 0;
+  const size_t footer_position = this->head_ + length - this->footer_size_;
+  if (this->footer_size_ > 0 && !this->matches_(this->footer_, this->footer_size_, footer_position))
+    return INVALID_FRAME;
+  return length;
+}
+
+bool UARTFrameReader::matches_(const std::array<uint8_t, 4> &pattern, uint8_t size, size_t position) const {
+  return memcmp(this->buffer_.data() + position, pattern.data(), size) == 0;
+}
+
+void UARTFrameReader::drop_(size_t count) {
+  this->head_ += count;
+  this->dropped_bytes_ += count;
+}
+
+}  // namespace uart
+}  // namespace esphome
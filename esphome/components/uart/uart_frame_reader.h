@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+#include "uart_component.h"
+
+namespace esphome {
+namespace uart {
+
+/** Assembles delimited frames received on a UART bus in a single buffer.
+ *
+ * Drivers describe their framing once instead of keeping an accumulation buffer and parsing byte by byte. Every
+ * read_frame() call moves what the bus has buffered with one bulk read_array() and returns the next complete frame
+ * in place. A frame is found by an optional header, then ends after
+ *  - a fixed number of bytes (set_frame_size()),
+ *  - the length read from a field of the frame plus a fixed overhead (set_length_field()), or
+ *  - the footer (set_footer()).
+ * A footer set together with a size or length field is verified. Bytes that cannot start a frame are dropped.
+ */
+class UARTFrameReader {
+ public:
+  /// @param max_frame_size Largest frame to assemble, the buffer is allocated once with this size.
+  explicit UARTFrameReader(size_t max_frame_size) : buffer_(max_frame_size) {}
+
+  /// Frames start with these bytes, at most 4.
+  void set_header(std::initializer_list<uint8_t> header) { this->header_size_ = copy_pattern_(this->header_, header); }
+  /// Frames end with these bytes, at most 4.
+  void set_footer(std::initializer_list<uint8_t> footer) { this->footer_size_ = copy_pattern_(this->footer_, footer); }
+  /// Every frame is size bytes long, header and footer included.
+  void set_frame_size(size_t size) { this->frame_size_ = size; }
+  /// The frame is the value of the size byte wide field at offset plus overhead bytes long.
+  void set_length_field(uint8_t offset, uint8_t size, bool big_endian, uint16_t overhead) {
+    this->length_offset_ = offset;
+    this->length_size_ = size;
+    this->length_big_endian_ = big_endian;
+    this->length_overhead_ = overhead;
+  }
+
+  /// Reads the bytes the bus has buffered and returns the next complete frame, header and footer included.
+  /// @return The frame, empty if none is complete yet. It stays valid until the next call.
+  std::span<const uint8_t> read_frame(UARTComponent *parent);
+  /// Drops everything received so far, also the frame returned last.
+  void reset() { this->head_ = this->tail_ = this->frame_length_ = 0; }
+  /// Number of bytes dropped while looking for frames.
+  uint32_t get_dropped_bytes() const { return this->dropped_bytes_; }
+
+ protected:
+  static uint8_t copy_pattern_(std::array<uint8_t, 4> &pattern, std::initializer_list<uint8_t> bytes);
+  /// Drops the bytes before the next possible header, returns false when no complete header is buffered.
+  bool sync_header_();
+  /// Length of the frame at head_ if it is complete, 0 if more bytes are needed, SIZE_MAX if it is invalid.
+  size_t complete_frame_length_() const;
+  bool matches_(const std::array<uint8_t, 4> &pattern, uint8_t size, size_t position) const;
+  void drop_(size_t count);
+
+  std::vector<uint8_t> buffer_;
+  size_t head_{0};
+  size_t tail_{0};
+  // Length of the frame returned last, released on the next call
+  size_t frame_length_{0};
+  size_t frame_size_{0};
+  uint32_t dropped_bytes_{0};
+  std::array<uint8_t, 4> header_{};
+  std::array<uint8_t, 4> footer_{};
+  uint8_t header_size_{0};
+  uint8_t footer_size_{0};
+  uint8_t length_offset_{0};
+  uint8_t length_size_{0};
+  bool length_big_endian_{false};
+  uint16_t length_overhead_{0};
+};
+
+}  // namespace uart
+}  // namespace esphome
@@ -101,8 +101,10 @@ void UDPComponent::setup() {
 }
 
 void UDPComponent::loop() {
-  auto buf = std::vector<uint8_t>(MAX_PACKET_SIZE);
+  if (!this->batch_.empty() && App.get_loop_component_start_time() - this->batch_start_ >= this->batch_delay_)
+    this->flush_batch();
   if (this->should_listen_) {
+    auto buf = std::vector<uint8_t>(MAX_PACKET_SIZE);
     for (;;) {
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
       auto len = this->listen_socket_->read(buf.data(), buf.size());
@@ -158,6 +160,31 @@ void UDPComponent::send_packet(const uint8_t *data, size_t size) {
   }
 #endif
 }
+
+void UDPComponent::queue_packet(const uint8_t *data, size_t size) {
+  if (!this->batch_.empty() && this->batch_.size() + 1 + size > MAX_BATCH_SIZE)
+    this->flush_batch();
+  if (size > MAX_BATCH_SIZE) {
+    this->send_packet(data, size);
+    return;
+  }
+  if (this->batch_.capacity() == 0)
+    this->batch_.reserve(MAX_BATCH_SIZE);
+  if (this->batch_.empty()) {
+    this->batch_start_ = millis();
+  } else {
+    this->batch_.push_back('\n');
+  }
+  this->batch_.insert(this->batch_.end(), data, data + size);
+}
+
+void UDPComponent::flush_batch() {
+  if (this->batch_.empty())
+    return;
+  this->send_packet(this->batch_);
+  // clear() keeps the capacity, so the buffer is only allocated once
+  this->batch_.clear();
+}
 }  // namespace udp
 }  // namespace esphome
 
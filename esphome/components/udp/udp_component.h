@@ -15,6 +15,8 @@ namespace esphome {
 namespace udp {
 
 static const size_t MAX_PACKET_SIZE = 508;
+/// Largest datagram built by queue_packet(), the UDP payload that fits an Ethernet MTU without fragmenting.
+static const size_t MAX_BATCH_SIZE = 1472;
 class UDPComponent : public Component {
  public:
   void add_address(const char *addr) { this->addresses_.emplace_back(addr); }
@@ -31,6 +33,14 @@ class UDPComponent : public Component {
   void dump_config() override;
   void send_packet(const uint8_t *data, size_t size);
   void send_packet(const std::vector<uint8_t> &buf) { this->send_packet(buf.data(), buf.size()); }
+  /// Queue a message for a batched send. Queued messages are joined with newlines into datagrams of up to
+  /// MAX_BATCH_SIZE bytes, which are sent when the next message does not fit or once the batch delay has passed.
+  void queue_packet(const uint8_t *data, size_t size);
+  /// Send the queued messages now.
+  void flush_batch();
+  /// Longest time a queued message waits for more messages, 0 sends the batch on the next loop.
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  void on_shutdown() override { this->flush_batch(); }
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; };
 
  protected:
@@ -39,6 +49,9 @@ class UDPComponent : public Component {
   bool should_broadcast_{};
   bool should_listen_{};
   CallbackManager<void(std::vector<uint8_t> &)> packet_listeners_{};
+  std::vector<uint8_t> batch_{};
+  uint32_t batch_start_{};
+  uint32_t batch_delay_{};
 
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
   std::unique_ptr<socket::Socket> broadcast_socket_ = nullptr;
@@ -41,6 +41,18 @@ UART_STOP_BITS_OPTIONS = {
 }
 
 DEFAULT_BAUD_RATE = 9600
+# Largest packet of a full speed bulk endpoint, see fix_mps()
+USB_PACKET_SIZE = 64
+
+CONF_RX_TRANSFER_SIZE = "rx_transfer_size"
+CONF_RX_TRANSFERS = "rx_transfers"
+
+
+def validate_transfer_size(value):
+    value = cv.int_range(min=USB_PACKET_SIZE, max=4096)(value)
+    if value % USB_PACKET_SIZE != 0:
+        raise cv.Invalid(f"Must be a multiple of the packet size ({USB_PACKET_SIZE})")
+    return value
 
 
 class Type:
@@ -93,6 +105,12 @@ def channel_schema(channels, baud_rate_required):
                             ),
                             cv.Optional(CONF_DUMMY_RECEIVER, default=False): cv.boolean,
                             cv.Optional(CONF_DEBUG, default=False): cv.boolean,
+                            cv.Optional(
+                                CONF_RX_TRANSFER_SIZE, default=USB_PACKET_SIZE
+                            ): validate_transfer_size,
+                            cv.Optional(CONF_RX_TRANSFERS, default=1): cv.int_range(
+                                min=1, max=4
+                            ),
                         }
                     )
                 ),
@@ -116,8 +134,15 @@ CONFIG_SCHEMA = cv.ensure_list(
 
 
 async def to_code(config):
+    chunk_size = USB_PACKET_SIZE
     for device in config:
         var = await register_usb_client(device)
+        transfer_size = max(
+            channel[CONF_RX_TRANSFER_SIZE] for channel in device[CONF_CHANNELS]
+        )
+        if transfer_size > USB_PACKET_SIZE:
+            cg.add(var.set_transfer_buffer_size(transfer_size))
+        chunk_size = max(chunk_size, transfer_size)
         for index, channel in enumerate(device[CONF_CHANNELS]):
             chvar = cg.new_Pvariable(channel[CONF_ID], index, channel[CONF_BUFFER_SIZE])
             await cg.register_parented(chvar, var)
@@ -128,6 +153,10 @@ async def to_code(config):
             cg.add(chvar.set_baud_rate(channel[CONF_BAUD_RATE]))
             cg.add(chvar.set_dummy_receiver(channel[CONF_DUMMY_RECEIVER]))
             cg.add(chvar.set_debug(channel[CONF_DEBUG]))
+            cg.add(chvar.set_rx_transfer_size(channel[CONF_RX_TRANSFER_SIZE]))
+            cg.add(chvar.set_rx_transfers(channel[CONF_RX_TRANSFERS]))
             cg.add(var.add_channel(chvar))
             if channel[CONF_DEBUG]:
                 cg.add_define("USE_UART_DEBUGGER")
+    if chunk_size > USB_PACKET_SIZE:
+        cg.add_define("USB_UART_CHUNK_SIZE", chunk_size)
@@ -144,6 +144,21 @@ void USBUartChannel::write_array(const uint8_t *data, size_t len) {
   this->parent_->start_output(this);
 }
 
+bool USBUartChannel::add_rx_listener(Component *listener) {
+  if (this->rx_listener_count_ == this->rx_listeners_.size()) {
+    ESP_LOGE(TAG, "Too many RX listeners on channel %u", this->index_);
+    return false;
+  }
+  this->rx_listeners_[this->rx_listener_count_++] = listener;
+  return true;
+}
+
+void USBUartChannel::notify_rx_(uint8_t events) {
+  this->rx_events_ |= events;
+  for (uint8_t i = 0; i < this->rx_listener_count_; i++)
+    this->rx_listeners_[i]->enable_loop();
+}
+
 bool USBUartChannel::peek_byte(uint8_t *data) {
   if (this->input_buffer_.is_empty()) {
     return false;
@@ -185,8 +200,16 @@ void USBUartComponent::loop() {
     }
 #endif
 
-    // Push data to ring buffer (now safe in main loop)
-    channel->input_buffer_.push(chunk->data, chunk->length);
+    // Push data to ring buffer (now safe in main loop), bytes that don't fit are dropped instead of overwriting it
+    size_t length = std::min<size_t>(chunk->length, channel->input_buffer_.get_free_space());
+    channel->input_buffer_.push(chunk->data, length);
+    uint8_t events = uart::UART_RX_EVENT_DATA;
+    // A short transfer means the device had nothing more to send, the line went idle
+    if (chunk->length < channel->rx_transfer_size_)
+      events |= uart::UART_RX_EVENT_IDLE;
+    if (length < chunk->length)
+      events |= uart::UART_RX_EVENT_OVERFLOW;
+    channel->notify_rx_(events);
 
     // Return chunk to pool for reuse
     this->chunk_pool_.release(chunk);
@@ -196,6 +219,8 @@ void USBUartComponent::loop() {
   uint16_t dropped = this->usb_data_queue_.get_and_reset_dropped_count();
   if (dropped > 0) {
     ESP_LOGW(TAG, "Dropped %u USB data chunks due to buffer overflow", dropped);
+    for (auto *channel : this->channels_)
+      channel->notify_rx_(uart::UART_RX_EVENT_OVERFLOW);
   }
 }
 void USBUartComponent::dump_config() {
@@ -207,14 +232,16 @@ void USBUartComponent::dump_config() {
                   "    Data Bits: %u\n"
                   "    Parity: %s\n"
                   "    Stop bits: %s\n"
+                  "    RX transfers: %u x %u bytes\n"
                   "    Debug: %s\n"
                   "    Dummy receiver: %s",
                   channel->index_, channel->baud_rate_, channel->data_bits_, PARITY_NAMES[channel->parity_],
-                  STOP_BITS_NAMES[channel->stop_bits_], YESNO(channel->debug_), YESNO(channel->dummy_receiver_));
+                  STOP_BITS_NAMES[channel->stop_bits_], channel->rx_transfers_, channel->rx_transfer_size_,
+                  YESNO(channel->debug_), YESNO(channel->dummy_receiver_));
   }
 }
 void USBUartComponent::start_input(USBUartChannel *channel) {
-  if (!channel->initialised_.load() || channel->input_started_.load())
+  if (!channel->initialised_.load())
     return;
   // THREAD CONTEXT: Called from both USB task and main loop threads
   // - USB task: Immediate restart after successful transfer for continuous data flow
@@ -225,7 +252,9 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
   // - Main loop restarts provide flow control when buffers are full
   //
   // The underlying transfer_in() uses lock-free atomic allocation from the
-  // TransferRequest pool, making this multi-threaded access safe
+  // TransferRequest pool, making this multi-threaded access safe. Each submission
+  // first reserves a slot in input_in_flight_, so both threads together never
+  // keep more than rx_transfers_ transfers queued on the endpoint.
   const auto *ep = channel->cdc_dev_.in_ep;
   // CALLBACK CONTEXT: This lambda is executed in USB task via transfer_callback
   auto callback = [this, channel](const usb_host::TransferStatus &status) {
@@ -233,7 +262,7 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
     if (!status.success) {
       ESP_LOGE(TAG, "Control transfer failed, status=%s", esp_err_to_name(status.error_code));
       // On failure, don't restart - let next read_array() trigger it
-      channel->input_started_.store(false);
+      channel->input_in_flight_.fetch_sub(1);
       return;
     }
 
@@ -243,8 +272,8 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
       if (chunk == nullptr) {
         // No chunks available - queue is full or we're out of memory
         this->usb_data_queue_.increment_dropped_count();
-        // Mark input as not started so we can retry
-        channel->input_started_.store(false);
+        // Release the slot so the next read_array() can retry
+        channel->input_in_flight_.fetch_sub(1);
         return;
       }
 
@@ -260,11 +289,19 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
 
     // On success, restart input immediately from USB task for performance
     // The lock-free queue will handle backpressure
-    channel->input_started_.store(false);
+    channel->input_in_flight_.fetch_sub(1);
     this->start_input(channel);
   };
-  channel->input_started_.store(true);
-  this->transfer_in(ep->bEndpointAddress, callback, ep->wMaxPacketSize);
+  uint8_t in_flight = channel->input_in_flight_.load();
+  while (in_flight < channel->rx_transfers_) {
+    if (!channel->input_in_flight_.compare_exchange_weak(in_flight, in_flight + 1))
+      continue;
+    if (!this->transfer_in(ep->bEndpointAddress, callback, channel->rx_transfer_size_)) {
+      channel->input_in_flight_.fetch_sub(1);
+      return;
+    }
+    in_flight = channel->input_in_flight_.load();
+  }
 }
 
 void USBUartComponent::start_output(USBUartChannel *channel) {
@@ -358,7 +395,7 @@ void USBUartTypeCdcAcm::on_disconnected() {
     }
     usb_host_interface_release(this->handle_, this->device_handle_, channel->cdc_dev_.bulk_interface_number);
     channel->initialised_.store(false);
-    channel->input_started_.store(false);
+    channel->input_in_flight_.store(0);
     channel->output_started_.store(false);
     channel->input_buffer_.clear();
     channel->output_buffer_.clear();
@@ -370,7 +407,7 @@ void USBUartTypeCdcAcm::enable_channels() {
   for (auto *channel : this->channels_) {
     if (!channel->initialised_.load())
       continue;
-    channel->input_started_.store(false);
+    channel->input_in_flight_.store(0);
     channel->output_started_.store(false);
     this->start_input(channel);
   }
@@ -7,7 +7,14 @@
 #include "esphome/components/usb_host/usb_host.h"
 #include "esphome/core/lock_free_queue.h"
 #include "esphome/core/event_pool.h"
+#include <array>
 #include <atomic>
+#include <utility>
+
+// Largest bulk IN transfer of all channels, set by codegen
+#ifndef USB_UART_CHUNK_SIZE
+#define USB_UART_CHUNK_SIZE 64
+#endif
 
 namespace esphome {
 namespace usb_uart {
@@ -74,9 +81,9 @@ class RingBuffer {
 
 // Structure for queuing received USB data chunks
 struct UsbDataChunk {
-  static constexpr size_t MAX_CHUNK_SIZE = 64;  // USB packet size
+  static constexpr size_t MAX_CHUNK_SIZE = USB_UART_CHUNK_SIZE;  // One bulk IN transfer
   uint8_t data[MAX_CHUNK_SIZE];
-  uint8_t length;  // Max 64 bytes, so uint8_t is sufficient
+  uint16_t length;
   USBUartChannel *channel;
 
   // Required for EventPool - no cleanup needed for POD types
@@ -103,20 +110,35 @@ class USBUartChannel : public uart::UARTComponent, public Parented<USBUartCompon
   void set_parity(UARTParityOptions parity) { this->parity_ = parity; }
   void set_debug(bool debug) { this->debug_ = debug; }
   void set_dummy_receiver(bool dummy_receiver) { this->dummy_receiver_ = dummy_receiver; }
+  /// Bytes requested by each bulk IN transfer, a multiple of the packet size so a transfer can span several packets.
+  void set_rx_transfer_size(uint16_t rx_transfer_size) { this->rx_transfer_size_ = rx_transfer_size; }
+  /// Number of bulk IN transfers kept submitted, so the device can send while the previous one is processed.
+  void set_rx_transfers(uint8_t rx_transfers) { this->rx_transfers_ = rx_transfers; }
+
+  // Events are raised from the loop of the USB UART component when received data reaches the input buffer
+  bool add_rx_listener(Component *listener) override;
+  uint8_t take_rx_events() override { return std::exchange(this->rx_events_, 0); }
 
  protected:
+  void notify_rx_(uint8_t events);
+
   // Larger structures first for better alignment
   RingBuffer input_buffer_;
   RingBuffer output_buffer_;
   CdcEps cdc_dev_{};
+  std::array<Component *, 4> rx_listeners_{};
   // Enum (likely 4 bytes)
   UARTParityOptions parity_{UART_CONFIG_PARITY_NONE};
+  uint16_t rx_transfer_size_{64};
   // Group atomics together (each 1 byte)
-  std::atomic<bool> input_started_{true};
+  std::atomic<uint8_t> input_in_flight_{0};
   std::atomic<bool> output_started_{true};
   std::atomic<bool> initialised_{false};
   // Group regular bytes together to minimize padding
   const uint8_t index_;
+  uint8_t rx_transfers_{1};
+  uint8_t rx_listener_count_{0};
+  uint8_t rx_events_{0};
   bool debug_{};
   bool dummy_receiver_{};
 };
@@ -38,6 +38,7 @@ CONF_SILENCE_DETECTION = "silence_detection"
 CONF_USE_WAKE_WORD = "use_wake_word"
 CONF_VAD_THRESHOLD = "vad_threshold"
 
+CONF_AUDIO_COMPRESSION = "audio_compression"
 CONF_AUTO_GAIN = "auto_gain"
 CONF_NOISE_SUPPRESSION_LEVEL = "noise_suppression_level"
 CONF_VOLUME_MULTIPLIER = "volume_multiplier"
@@ -118,6 +119,9 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_VOLUME_MULTIPLIER, default=1.0): cv.float_range(
                 min=0.0, min_included=False
             ),
+            cv.Optional(CONF_AUDIO_COMPRESSION, default="none"): cv.one_of(
+                "none", "adpcm", lower=True
+            ),
             cv.Optional(CONF_ON_LISTENING): automation.validate_automation(single=True),
             cv.Optional(CONF_ON_START): automation.validate_automation(single=True),
             cv.Optional(CONF_ON_WAKE_WORD_DETECTED): automation.validate_automation(
@@ -218,6 +222,8 @@ async def to_code(config):
     cg.add(var.set_auto_gain(config[CONF_AUTO_GAIN]))
     cg.add(var.set_volume_multiplier(config[CONF_VOLUME_MULTIPLIER]))
     cg.add(var.set_conversation_timeout(config[CONF_CONVERSATION_TIMEOUT]))
+    if config[CONF_AUDIO_COMPRESSION] == "adpcm":
+        cg.add(var.set_adpcm_audio(True))
 
     if CONF_ON_LISTENING in config:
         await automation.build_automation(
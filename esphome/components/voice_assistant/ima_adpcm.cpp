@@ -0,0 +1,75 @@
+#include "ima_adpcm.h"
+
+namespace esphome {
+namespace voice_assistant {
+
+static const int16_t STEP_TABLE[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+uint8_t ImaAdpcmEncoder::encode_sample_(int16_t sample) {
+  const int32_t step = STEP_TABLE[this->step_index_];
+  int32_t diff = sample - this->predictor_;
+  uint8_t code = 0;
+  if (diff < 0) {
+    code = 8;
+    diff = -diff;
+  }
+
+  // Quantize the difference to three bits of the step size, reconstructing it exactly as the decoder will
+  int32_t delta = step >> 3;
+  if (diff >= step) {
+    code |= 4;
+    diff -= step;
+    delta += step;
+  }
+  if (diff >= (step >> 1)) {
+    code |= 2;
+    diff -= step >> 1;
+    delta += step >> 1;
+  }
+  if (diff >= (step >> 2)) {
+    code |= 1;
+    delta += step >> 2;
+  }
+
+  this->predictor_ += (code & 8) ? -delta : delta;
+  if (this->predictor_ > INT16_MAX) {
+    this->predictor_ = INT16_MAX;
+  } else if (this->predictor_ < INT16_MIN) {
+    this->predictor_ = INT16_MIN;
+  }
+
+  const int32_t step_index = this->step_index_ + INDEX_TABLE[code & 7];
+  this->step_index_ = step_index < 0 ? 0 : (step_index > 88 ? 88 : step_index);
+
+  return code;
+}
+
+size_t ImaAdpcmEncoder::encode(const int16_t *input, size_t samples, uint8_t *output) {
+  output[0] = static_cast<uint8_t>(this->predictor_ & 0xFF);
+  output[1] = static_cast<uint8_t>((this->predictor_ >> 8) & 0xFF);
+  output[2] = this->step_index_;
+  output[3] = 0;
+
+  uint8_t *data = output + HEADER_SIZE;
+  for (size_t i = 0; i + 1 < samples; i += 2) {
+    const uint8_t low = this->encode_sample_(input[i]);
+    *data++ = low | (this->encode_sample_(input[i + 1]) << 4);
+  }
+  if (samples & 1) {
+    *data++ = this->encode_sample_(input[samples - 1]);
+  }
+
+  return data - output;
+}
+
+}  // namespace voice_assistant
+}  // namespace esphome
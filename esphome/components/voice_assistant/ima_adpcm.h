@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace voice_assistant {
+
+/// Encodes 16 bit PCM audio into 4 bit IMA ADPCM packets, a quarter of the PCM size.
+///
+/// Every packet starts with the encoder state it was encoded from: the predictor as a little endian int16, the step
+/// index and a padding byte. Two samples per byte follow, the first one in the low nibble. Since the state carries on
+/// from packet to packet but each packet brings its own, a lost UDP packet doesn't corrupt the ones after it.
+class ImaAdpcmEncoder {
+ public:
+  static constexpr size_t HEADER_SIZE = 4;
+
+  /// Bytes needed to encode a packet of samples samples.
+  static constexpr size_t encoded_size(size_t samples) { return HEADER_SIZE + (samples + 1) / 2; }
+
+  /// Encode a packet into output, which must hold encoded_size(samples) bytes. Returns the bytes written.
+  size_t encode(const int16_t *input, size_t samples, uint8_t *output);
+
+  /// Restart from silence, for a new stream.
+  void reset() {
+    this->predictor_ = 0;
+    this->step_index_ = 0;
+  }
+
+ protected:
+  uint8_t encode_sample_(int16_t sample);
+
+  int32_t predictor_{0};
+  uint8_t step_index_{0};
+};
+
+}  // namespace voice_assistant
+}  // namespace esphome
@@ -23,6 +23,7 @@ static const size_t RING_BUFFER_SAMPLES = 512 * SAMPLE_RATE_HZ / 1000;  // 512 m
 static const size_t RING_BUFFER_SIZE = RING_BUFFER_SAMPLES * sizeof(int16_t);
 static const size_t SEND_BUFFER_SAMPLES = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms * 16kHz / 1000ms
 static const size_t SEND_BUFFER_SIZE = SEND_BUFFER_SAMPLES * sizeof(int16_t);
+static const size_t ADPCM_PACKET_SIZE = ImaAdpcmEncoder::encoded_size(SEND_BUFFER_SAMPLES);
 static const size_t RECEIVE_SIZE = 1024;
 static const size_t SPEAKER_BUFFER_SIZE = 16 * RECEIVE_SIZE;
 
@@ -103,6 +104,10 @@ bool VoiceAssistant::start_udp_socket_() {
   return true;
 }
 
+size_t VoiceAssistant::send_buffer_size_() const {
+  return SEND_BUFFER_SIZE + (this->adpcm_audio_ ? ADPCM_PACKET_SIZE : 0);
+}
+
 bool VoiceAssistant::allocate_buffers_() {
 #ifdef USE_SPEAKER
   if ((this->speaker_ != nullptr) && (this->speaker_buffer_ == nullptr)) {
@@ -116,7 +121,7 @@ bool VoiceAssistant::allocate_buffers_() {
 #endif
 
   if (this->ring_buffer_.use_count() == 0) {
-    this->ring_buffer_ = RingBuffer::create(RING_BUFFER_SIZE);
+    this->ring_buffer_ = RingBuffer::create(RING_BUFFER_SIZE, RAMSubsystem::AUDIO);
     if (this->ring_buffer_.use_count() == 0) {
       ESP_LOGE(TAG, "Could not allocate ring buffer");
       return false;
@@ -125,7 +130,7 @@ bool VoiceAssistant::allocate_buffers_() {
 
   if (this->send_buffer_ == nullptr) {
     RAMAllocator<uint8_t> send_allocator;
-    this->send_buffer_ = send_allocator.allocate(SEND_BUFFER_SIZE);
+    this->send_buffer_ = send_allocator.allocate(this->send_buffer_size_());
     if (send_buffer_ == nullptr) {
       ESP_LOGW(TAG, "Could not allocate send buffer");
       return false;
@@ -137,7 +142,7 @@ bool VoiceAssistant::allocate_buffers_() {
 
 void VoiceAssistant::clear_buffers_() {
   if (this->send_buffer_ != nullptr) {
-    memset(this->send_buffer_, 0, SEND_BUFFER_SIZE);
+    memset(this->send_buffer_, 0, this->send_buffer_size_());
   }
 
   if (this->ring_buffer_ != nullptr) {
@@ -158,7 +163,7 @@ void VoiceAssistant::clear_buffers_() {
 void VoiceAssistant::deallocate_buffers_() {
   if (this->send_buffer_ != nullptr) {
     RAMAllocator<uint8_t> send_deallocator;
-    send_deallocator.deallocate(this->send_buffer_, SEND_BUFFER_SIZE);
+    send_deallocator.deallocate(this->send_buffer_, this->send_buffer_size_());
     this->send_buffer_ = nullptr;
   }
 
@@ -270,9 +275,17 @@ void VoiceAssistant::loop() {
       size_t available = this->ring_buffer_->available();
       while (available >= SEND_BUFFER_SIZE) {
         size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
+        uint8_t *send_data = this->send_buffer_;
+        size_t send_bytes = read_bytes;
+        if (this->audio_format_ == api::enums::VOICE_ASSISTANT_AUDIO_FORMAT_IMA_ADPCM) {
+          send_data = this->send_buffer_ + SEND_BUFFER_SIZE;
+          send_bytes = this->adpcm_encoder_.encode(reinterpret_cast<const int16_t *>(this->send_buffer_),
+                                                   read_bytes / sizeof(int16_t), send_data);
+        }
         if (this->audio_mode_ == AUDIO_MODE_API) {
           api::VoiceAssistantAudio msg;
-          msg.set_data(this->send_buffer_, read_bytes);
+          msg.data = send_data;
+          msg.data_len = send_bytes;
           this->api_client_->send_message(msg, api::VoiceAssistantAudio::MESSAGE_TYPE);
         } else {
           if (!this->udp_socket_running_) {
@@ -281,7 +294,7 @@ void VoiceAssistant::loop() {
               break;
             }
           }
-          this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
+          this->socket_->sendto(send_data, send_bytes, 0, (struct sockaddr *) &this->dest_addr_,
                                 sizeof(this->dest_addr_));
         }
         available = this->ring_buffer_->available();
@@ -491,13 +504,24 @@ void VoiceAssistant::failed_to_start() {
   this->set_state_(State::STOP_MICROPHONE, State::IDLE);
 }
 
-void VoiceAssistant::start_streaming() {
+void VoiceAssistant::set_audio_format_(api::enums::VoiceAssistantAudioFormat audio_format) {
+  if (this->adpcm_audio_ && (audio_format == api::enums::VOICE_ASSISTANT_AUDIO_FORMAT_IMA_ADPCM)) {
+    ESP_LOGD(TAG, "Client started, streaming microphone as IMA ADPCM");
+    this->audio_format_ = api::enums::VOICE_ASSISTANT_AUDIO_FORMAT_IMA_ADPCM;
+    this->adpcm_encoder_.reset();
+  } else {
+    ESP_LOGD(TAG, "Client started, streaming microphone");
+    this->audio_format_ = api::enums::VOICE_ASSISTANT_AUDIO_FORMAT_PCM;
+  }
+}
+
+void VoiceAssistant::start_streaming(api::enums::VoiceAssistantAudioFormat audio_format) {
   if (this->state_ != State::STARTING_PIPELINE) {
     this->signal_stop_();
     return;
   }
 
-  ESP_LOGD(TAG, "Client started, streaming microphone");
+  this->set_audio_format_(audio_format);
   this->audio_mode_ = AUDIO_MODE_API;
 
   if (this->mic_source_->is_running()) {
@@ -507,13 +531,14 @@ void VoiceAssistant::start_streaming() {
   }
 }
 
-void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t port) {
+void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t port,
+                                     api::enums::VoiceAssistantAudioFormat audio_format) {
   if (this->state_ != State::STARTING_PIPELINE) {
     this->signal_stop_();
     return;
   }
 
-  ESP_LOGD(TAG, "Client started, streaming microphone");
+  this->set_audio_format_(audio_format);
   this->audio_mode_ = AUDIO_MODE_UDP;
 
   memcpy(&this->dest_addr_, addr, sizeof(this->dest_addr_));
@@ -839,12 +864,12 @@ void VoiceAssistant::on_event(const api::VoiceAssistantEventResponse &msg) {
 void VoiceAssistant::on_audio(const api::VoiceAssistantAudio &msg) {
 #ifdef USE_SPEAKER  // We should never get to this function if there is no speaker anyway
   if ((this->speaker_ != nullptr) && (this->speaker_buffer_ != nullptr)) {
-    if (this->speaker_buffer_index_ + msg.data.length() < SPEAKER_BUFFER_SIZE) {
-      memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data.data(), msg.data.length());
-      this->speaker_buffer_index_ += msg.data.length();
-      this->speaker_buffer_size_ += msg.data.length();
-      this->speaker_bytes_received_ += msg.data.length();
-      ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data.length());
+    if (this->speaker_buffer_index_ + msg.data_len < SPEAKER_BUFFER_SIZE) {
+      memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data, msg.data_len);
+      this->speaker_buffer_index_ += msg.data_len;
+      this->speaker_buffer_size_ += msg.data_len;
+      this->speaker_bytes_received_ += msg.data_len;
+      ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data_len);
     } else {
       ESP_LOGE(TAG, "Cannot receive audio, buffer is full");
     }
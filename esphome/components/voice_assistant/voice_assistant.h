@@ -23,6 +23,8 @@
 #endif
 #include "esphome/components/socket/socket.h"
 
+#include "ima_adpcm.h"
+
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +43,7 @@ enum VoiceAssistantFeature : uint32_t {
   FEATURE_TIMERS = 1 << 3,
   FEATURE_ANNOUNCE = 1 << 4,
   FEATURE_START_CONVERSATION = 1 << 5,
+  FEATURE_ADPCM_AUDIO = 1 << 6,
 };
 
 enum class State {
@@ -106,8 +109,9 @@ class VoiceAssistant : public Component {
   void loop() override;
   void setup() override;
   float get_setup_priority() const override;
-  void start_streaming();
-  void start_streaming(struct sockaddr_storage *addr, uint16_t port);
+  void start_streaming(api::enums::VoiceAssistantAudioFormat audio_format);
+  void start_streaming(struct sockaddr_storage *addr, uint16_t port,
+                       api::enums::VoiceAssistantAudioFormat audio_format);
   void failed_to_start();
 
   void set_microphone_source(microphone::MicrophoneSource *mic_source) { this->mic_source_ = mic_source; }
@@ -150,6 +154,10 @@ class VoiceAssistant : public Component {
       flags |= VoiceAssistantFeature::FEATURE_TIMERS;
     }
 
+    if (this->adpcm_audio_) {
+      flags |= VoiceAssistantFeature::FEATURE_ADPCM_AUDIO;
+    }
+
 #ifdef USE_MEDIA_PLAYER
     if (this->media_player_ != nullptr) {
       flags |= VoiceAssistantFeature::FEATURE_ANNOUNCE;
@@ -182,6 +190,8 @@ class VoiceAssistant : public Component {
   void set_auto_gain(uint8_t auto_gain) { this->auto_gain_ = auto_gain; }
   void set_volume_multiplier(float volume_multiplier) { this->volume_multiplier_ = volume_multiplier; }
   void set_conversation_timeout(uint32_t conversation_timeout) { this->conversation_timeout_ = conversation_timeout; }
+  /// @brief Offer to send the microphone audio IMA ADPCM encoded, the server picks the format when the pipeline starts
+  void set_adpcm_audio(bool adpcm_audio) { this->adpcm_audio_ = adpcm_audio; }
   void reset_conversation_id();
 
   Trigger<> *get_intent_end_trigger() const { return this->intent_end_trigger_; }
@@ -221,6 +231,8 @@ class VoiceAssistant : public Component {
 
  protected:
   bool allocate_buffers_();
+  size_t send_buffer_size_() const;
+  void set_audio_format_(api::enums::VoiceAssistantAudioFormat audio_format);
   void clear_buffers_();
   void deallocate_buffers_();
 
@@ -299,8 +311,13 @@ class VoiceAssistant : public Component {
   float volume_multiplier_;
   uint32_t conversation_timeout_;
 
+  // PCM read from the ring buffer, followed by room for its ADPCM packet if adpcm_audio_ is set
   uint8_t *send_buffer_{nullptr};
 
+  bool adpcm_audio_{false};
+  api::enums::VoiceAssistantAudioFormat audio_format_{api::enums::VOICE_ASSISTANT_AUDIO_FORMAT_PCM};
+  ImaAdpcmEncoder adpcm_encoder_;
+
   bool continuous_{false};
   bool silence_detection_;
 
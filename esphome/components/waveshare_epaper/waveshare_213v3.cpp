@@ -184,9 +184,5 @@ void WaveshareEPaper2P13InV3::dump_config() {
   LOG_UPDATE_INTERVAL(this);
 }
 
-void WaveshareEPaper2P13InV3::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
-
 }  // namespace waveshare_epaper
 }  // namespace esphome
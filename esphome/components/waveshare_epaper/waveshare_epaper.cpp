@@ -168,8 +168,32 @@ bool WaveshareEPaperBase::wait_until_idle_() {
   return true;
 }
 void WaveshareEPaperBase::update() {
+  if (this->refresh_running_ && this->is_refreshing_()) {
+    // Drawing now would spin on BUSY in display(), run the update from loop() once the refresh is over
+    if (!this->update_pending_) {
+      this->update_pending_ = true;
+      this->update_pending_since_ = millis();
+      this->enable_loop();
+    }
+    return;
+  }
+  this->draw_and_display_();
+}
+void WaveshareEPaperBase::loop() {
+  if (!this->update_pending_) {
+    this->disable_loop();
+    return;
+  }
+  if (this->is_refreshing_() && millis() - this->update_pending_since_ < this->idle_timeout_())
+    return;
+  this->draw_and_display_();
+}
+void WaveshareEPaperBase::draw_and_display_() {
+  this->update_pending_ = false;
   this->do_update_();
   this->display();
+  // Panels woken up by a reset in display() don't need to be waited for
+  this->refresh_running_ = !this->deep_sleep_between_updates_ && this->is_refreshing_();
 }
 void WaveshareEPaper::fill(Color color) {
   // flip logic
@@ -745,10 +769,6 @@ void WaveshareEPaperTypeA::write_lut_(const uint8_t *lut, const uint8_t size) {
     this->data(lut[i]);
 }
 WaveshareEPaperTypeA::WaveshareEPaperTypeA(WaveshareEPaperTypeAModel model) : model_(model) {}
-void WaveshareEPaperTypeA::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
-
 uint32_t WaveshareEPaperTypeA::idle_timeout_() {
   switch (this->model_) {
     case WAVESHARE_EPAPER_1_54_IN:
@@ -1574,10 +1594,6 @@ void WaveshareEPaper2P9InDKE::dump_config() {
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
   LOG_UPDATE_INTERVAL(this);
 }
-void WaveshareEPaper2P9InDKE::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
-
 // ========================================================
 //               2.90in Type B (LUT from OTP)
 // Datasheet:
@@ -1829,9 +1845,6 @@ void WaveshareEPaper2P9InV2R2::deep_sleep() {
 int WaveshareEPaper2P9InV2R2::get_width_internal() { return 128; }
 int WaveshareEPaper2P9InV2R2::get_height_internal() { return 296; }
 int WaveshareEPaper2P9InV2R2::get_width_controller() { return this->get_width_internal(); }
-void WaveshareEPaper2P9InV2R2::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
 // ========================================================
 //     Good Display 2.9in black/white
 // Datasheet:
@@ -2170,8 +2183,6 @@ void GDEW029T5::write_lut_(const uint8_t *lut, const uint8_t size) {
   this->end_data_();
 }
 
-void GDEW029T5::set_full_update_every(uint32_t full_update_every) { this->full_update_every_ = full_update_every; }
-
 int GDEW029T5::get_width_internal() { return 128; }
 int GDEW029T5::get_height_internal() { return 296; }
 void GDEW029T5::dump_config() {
@@ -2510,7 +2521,6 @@ void HOT GDEY042T81::display() {
   ESP_LOGD(TAG, "Set the display back to deep sleep");
   this->deep_sleep();
 }
-void GDEY042T81::set_full_update_every(uint32_t full_update_every) { this->full_update_every_ = full_update_every; }
 int GDEY042T81::get_width_internal() { return 400; }
 int GDEY042T81::get_height_internal() { return 300; }
 uint32_t GDEY042T81::idle_timeout_() { return 5000; }
@@ -3141,7 +3151,6 @@ void HOT GDEY0583T81::display() {
   this->deep_sleep();
 }
 
-void GDEY0583T81::set_full_update_every(uint32_t full_update_every) { this->full_update_every_ = full_update_every; }
 int GDEY0583T81::get_width_internal() { return 648; }
 int GDEY0583T81::get_height_internal() { return 480; }
 uint32_t GDEY0583T81::idle_timeout_() { return 5000; }
@@ -4335,10 +4344,6 @@ void WaveshareEPaper7P5InV2P::dump_config() {
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
   LOG_UPDATE_INTERVAL(this);
 }
-void WaveshareEPaper7P5InV2P::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
-
 /* 7.50in-bc */
 void WaveshareEPaper7P5InBC::initialize() {
   /* The command sequence is similar to the 7P5In display but differs in subtle ways
@@ -4663,10 +4668,6 @@ void WaveshareEPaper2P13InDKE::dump_config() {
   LOG_UPDATE_INTERVAL(this);
 }
 
-void WaveshareEPaper2P13InDKE::set_full_update_every(uint32_t full_update_every) {
-  this->full_update_every_ = full_update_every;
-}
-
 // ========================================================
 //               13.3in (K version)
 // Datasheet/Specification/Reference:
@@ -26,14 +26,24 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   virtual void deep_sleep() = 0;
 
   void update() override;
+  void loop() override;
 
   void setup() override;
 
   void on_safe_shutdown() override;
 
+  /// Updates between two full refreshes, the others use a partial refresh (for the models supporting it).
+  void set_full_update_every(uint32_t full_update_every) { this->full_update_every_ = full_update_every; }
+  /// Make the next update a full refresh, to clear the ghosting left by partial refreshes.
+  void request_full_update() { this->at_update_ = 0; }
+
  protected:
   bool wait_until_idle_();
 
+  // Whether the panel still drives BUSY for the last refresh
+  bool is_refreshing_() { return this->busy_pin_ != nullptr && this->busy_pin_->digital_read(); }
+  void draw_and_display_();
+
   void setup_pins_();
 
   void reset_() {
@@ -59,6 +69,16 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
   virtual uint32_t idle_timeout_() { return 1000u; }  // NOLINT(readability-identifier-naming)
+
+  // Updates since the last full refresh, the next one is full at 0
+  uint32_t full_update_every_{30};
+  uint32_t at_update_{0};
+  bool deep_sleep_between_updates_{false};
+  // display() returned while the panel was still refreshing
+  bool refresh_running_{false};
+  // update() was called during that refresh, loop() runs it once BUSY is released
+  bool update_pending_{false};
+  uint32_t update_pending_since_{0};
 };
 
 class WaveshareEPaper : public WaveshareEPaperBase {
@@ -150,8 +170,6 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
     }
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
   void write_lut_(const uint8_t *lut, uint8_t size);
 
@@ -163,12 +181,8 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
 
   int get_width_controller() override;
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
   WaveshareEPaperTypeAModel model_;
   uint32_t idle_timeout_() override;
-
-  bool deep_sleep_between_updates_{false};
 };
 
 enum WaveshareEPaperTypeBModel {
@@ -273,7 +287,6 @@ class GDEW029T5 : public WaveshareEPaper {
   void dump_config() override;
 
   void deep_sleep() override;
-  void set_full_update_every(uint32_t full_update_every);
 
  protected:
   void init_display_();
@@ -287,9 +300,6 @@ class GDEW029T5 : public WaveshareEPaper {
   int get_height_internal() override;
 
  private:
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
-  bool deep_sleep_between_updates_{false};
   bool power_is_on_{false};
   bool is_deep_sleep_{false};
   uint8_t *old_buffer_{nullptr};
@@ -422,8 +432,6 @@ class WaveshareEPaper2P9InV2R2 : public WaveshareEPaper {
 
   void deep_sleep() override;
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
   void write_lut_(const uint8_t *lut, uint8_t size);
 
@@ -433,9 +441,6 @@ class WaveshareEPaper2P9InV2R2 : public WaveshareEPaper {
 
   int get_width_controller() override;
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
-
  private:
   void reset_();
 };
@@ -454,11 +459,7 @@ class WaveshareEPaper2P9InDKE : public WaveshareEPaper {
     this->data(0x01);
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
   int get_width_internal() override;
 
   int get_height_internal() override;
@@ -504,11 +505,7 @@ class GDEY042T81 : public WaveshareEPaper {
     this->data(0x01);
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
 
   int get_width_internal() override;
   int get_height_internal() override;
@@ -696,8 +693,6 @@ class GDEY0583T81 : public WaveshareEPaper {
 
   void deep_sleep() override;
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
   int get_width_internal() override;
   int get_height_internal() override;
@@ -713,8 +708,6 @@ class GDEY0583T81 : public WaveshareEPaper {
   void init_partial_();
   void init_display_();
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
   bool power_is_on_{false};
   bool is_deep_sleep_{false};
   uint8_t *old_buffer_{nullptr};
@@ -722,6 +715,8 @@ class GDEY0583T81 : public WaveshareEPaper {
 
 class WaveshareEPaper5P65InF : public WaveshareEPaper7C {
  public:
+  WaveshareEPaper5P65InF() { this->deep_sleep_between_updates_ = true; }
+
   void initialize() override;
 
   void display() override;
@@ -740,11 +735,12 @@ class WaveshareEPaper5P65InF : public WaveshareEPaper7C {
   enum WaitForState { BUSY = true, IDLE = false };
   bool wait_until_(WaitForState state);
 
-  bool deep_sleep_between_updates_{true};
 };
 
 class WaveshareEPaper7P3InF : public WaveshareEPaper7C {
  public:
+  WaveshareEPaper7P3InF() { this->deep_sleep_between_updates_ = true; }
+
   void initialize() override;
 
   void display() override;
@@ -762,7 +758,6 @@ class WaveshareEPaper7P3InF : public WaveshareEPaper7C {
 
   bool wait_until_idle_();
 
-  bool deep_sleep_between_updates_{true};
 };
 
 class WaveshareEPaper7P5In : public WaveshareEPaper {
@@ -975,8 +970,6 @@ class WaveshareEPaper7P5InV2P : public WaveshareEPaper {
     this->data(0xA5);  // check byte
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
   int get_width_internal() override;
 
@@ -984,9 +977,6 @@ class WaveshareEPaper7P5InV2P : public WaveshareEPaper {
 
   uint32_t idle_timeout_() override;
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
-
  private:
   void reset_();
 
@@ -1028,8 +1018,6 @@ class WaveshareEPaper2P13InDKE : public WaveshareEPaper {
     // cannot wait until idle here, the device no longer responds
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
  protected:
   int get_width_internal() override;
 
@@ -1037,8 +1025,6 @@ class WaveshareEPaper2P13InDKE : public WaveshareEPaper {
 
   uint32_t idle_timeout_() override;
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
 };
 
 class WaveshareEPaper2P13InV3 : public WaveshareEPaper {
@@ -1054,8 +1040,6 @@ class WaveshareEPaper2P13InV3 : public WaveshareEPaper {
     // cannot wait until idle here, the device no longer responds
   }
 
-  void set_full_update_every(uint32_t full_update_every);
-
   void setup() override;
   void initialize() override;
 
@@ -1071,8 +1055,6 @@ class WaveshareEPaper2P13InV3 : public WaveshareEPaper {
   void partial_update_();
   void full_update_();
 
-  uint32_t full_update_every_{30};
-  uint32_t at_update_{0};
   bool is_busy_{false};
   void write_lut_(const uint8_t *lut);
 };
@@ -1,6 +1,8 @@
 from __future__ import annotations
 
 import gzip
+import hashlib
+from pathlib import Path
 
 import esphome.codegen as cg
 from esphome.components import web_server_base
@@ -267,6 +269,21 @@ def add_resource_as_progmem(
     )
     cg.add_global(cg.RawExpression(uint8_t))
     cg.add_global(cg.RawExpression(size_t))
+    add_resource_etag(resource_name, content.encode("utf-8"))
+
+
+def add_resource_etag(resource_name: str, content: bytes) -> None:
+    """Add a strong ETag for a resource, derived from the uncompressed content.
+
+    gzip output embeds a timestamp, hashing the source keeps the ETag stable across
+    rebuilds as long as the resource does not change.
+    """
+    etag = hashlib.sha256(content).hexdigest()[:16]
+    cg.add_global(
+        cg.RawExpression(
+            f'const char ESPHOME_WEBSERVER_{resource_name}_ETAG[] = "\\"{etag}\\""'
+        )
+    )
 
 
 @coroutine_with_priority(CoroPriority.WEB)
@@ -314,6 +331,8 @@ async def to_code(config):
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
     if CONF_LOCAL in config and config[CONF_LOCAL]:
         cg.add_define("USE_WEBSERVER_LOCAL")
+        server_index = Path(__file__).with_name(f"server_index_v{version}.h")
+        add_resource_etag("INDEX_GZ", server_index.read_bytes())
 
     if (sorting_group_config := config.get(CONF_SORTING_GROUPS)) is not None:
         cg.add_define("USE_WEBSERVER_SORTING")
@@ -104,6 +104,15 @@ static UrlMatch match_url(const char *url_ptr, size_t url_len, bool only_domain)
 }
 
 #if !defined(USE_ESP32) && defined(USE_ARDUINO)
+const char *SharedEventMessage::c_str() {
+  if (!this->generated_) {
+    this->buffer_.clear();
+    this->message_generator_(this->web_server_, this->source_, this->buffer_);
+    this->generated_ = true;
+  }
+  return this->buffer_.c_str();
+}
+
 // helper for allowing only unique entries in the queue
 void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator) {
   DeferredEvent item(source, message_generator);
@@ -121,8 +130,9 @@ void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_
 void DeferredUpdateEventSource::process_deferred_queue_() {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
-    if (this->send(message.c_str(), "state") != DISCARDED) {
+    this->message_buffer_.clear();
+    de.message_generator_(web_server_, de.source_, this->message_buffer_);
+    if (this->send(this->message_buffer_.c_str(), "state") != DISCARDED) {
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
       this->consecutive_send_failures_ = 0;  // Reset failure count on successful send
@@ -152,6 +162,13 @@ void DeferredUpdateEventSource::loop() {
 
 void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
                                                       message_generator_t *message_generator) {
+  if (source == nullptr || message_generator == nullptr)
+    return;
+  SharedEventMessage message(this->web_server_, source, message_generator, this->message_buffer_);
+  this->deferrable_send_state_(event_type, message);
+}
+
+void DeferredUpdateEventSource::deferrable_send_state_(const char *event_type, SharedEventMessage &message) {
   // Skip if no connected clients to avoid unnecessary deferred queue processing
   if (this->count() == 0)
     return;
@@ -161,12 +178,8 @@ void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *
   if (!entities_iterator_.completed() && 0 != strcmp(event_type, "state_detail_all"))
     return;
 
-  if (source == nullptr)
-    return;
   if (event_type == nullptr)
     return;
-  if (message_generator == nullptr)
-    return;
 
   if (0 != strcmp(event_type, "state_detail_all") && 0 != strcmp(event_type, "state")) {
     ESP_LOGE(TAG, "Can't defer non-state event");
@@ -176,11 +189,10 @@ void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *
     process_deferred_queue_();
   if (!deferred_queue_.empty()) {
     // deferred queue still not empty which means downstream event queue full, no point trying to send first
-    deq_push_back_with_dedup_(source, message_generator);
+    deq_push_back_with_dedup_(message.get_source(), message.get_message_generator());
   } else {
-    std::string message = message_generator(web_server_, source);
     if (this->send(message.c_str(), "state") == DISCARDED) {
-      deq_push_back_with_dedup_(source, message_generator);
+      deq_push_back_with_dedup_(message.get_source(), message.get_message_generator());
     } else {
       this->consecutive_send_failures_ = 0;  // Reset failure count on successful send
     }
@@ -204,8 +216,11 @@ void DeferredUpdateEventSourceList::deferrable_send_state(void *source, const ch
   // Skip if no event sources (no connected clients) to avoid unnecessary iteration
   if (this->empty())
     return;
+  if (source == nullptr || message_generator == nullptr)
+    return;
+  SharedEventMessage message(this->front()->web_server_, source, message_generator, this->message_buffer_);
   for (DeferredUpdateEventSource *dues : *this) {
-    dues->deferrable_send_state(source, event_type, message_generator);
+    dues->deferrable_send_state_(event_type, message);
   }
 }
 
@@ -328,27 +343,57 @@ void WebServer::dump_config() {
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
-#ifdef USE_WEBSERVER_LOCAL
-void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+// Static resources only change with the firmware: clients revalidate every time and get a 304 while the ETag matches
+static const char *const STATIC_CACHE_CONTROL = "no-cache";
+
+static bool etag_matches(AsyncWebServerRequest *request, const char *etag) {
+#ifdef USE_ESP32
+  // Room for a few ETags, anything longer is answered with the full resource
+  char buf[128];
+  auto header = request->get_header("If-None-Match", buf, sizeof(buf));
+  if (!header.has_value())
+    return false;
+  const char *if_none_match = header->c_str();
+#else
+  const AsyncWebHeader *header = request->getHeader("If-None-Match");
+  if (header == nullptr)
+    return false;
+  const char *if_none_match = header->value().c_str();
+#endif
+  // Either "*" or a list of (possibly weak) ETags, the quoted tag itself cannot appear as part of another one
+  return strcmp(if_none_match, "*") == 0 || strstr(if_none_match, etag) != nullptr;
+}
+
+void WebServer::send_static_resource_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                                      size_t size, const char *etag, bool gzip) {
+  if (etag_matches(request, etag)) {
+    AsyncWebServerResponse *response = request->beginResponse(304, "");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", STATIC_CACHE_CONTROL);
+    request->send(response);
+    return;
+  }
 #ifndef USE_ESP8266
-  AsyncWebServerResponse *response = request->beginResponse(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
+  AsyncWebServerResponse *response = request->beginResponse(200, content_type, data, size);
 #else
-  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
+  AsyncWebServerResponse *response = request->beginResponse_P(200, content_type, data, size);
 #endif
-  response->addHeader("Content-Encoding", "gzip");
+  if (gzip)
+    response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", STATIC_CACHE_CONTROL);
   request->send(response);
 }
+
+#ifdef USE_WEBSERVER_LOCAL
+void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  this->send_static_resource_(request, "text/html", INDEX_GZ, sizeof(INDEX_GZ), ESPHOME_WEBSERVER_INDEX_GZ_ETAG, true);
+}
 #elif USE_WEBSERVER_VERSION >= 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
-#endif
   // No gzip header here because the HTML file is so small
-  request->send(response);
+  this->send_static_resource_(request, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE,
+                              ESPHOME_WEBSERVER_INDEX_HTML_ETAG, false);
 }
 #endif
 
@@ -365,37 +410,22 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
-#endif
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+  this->send_static_resource_(request, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE,
+                              ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG, true);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
-#endif
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+  this->send_static_resource_(request, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE,
+                              ESPHOME_WEBSERVER_JS_INCLUDE_SIZE, ESPHOME_WEBSERVER_JS_INCLUDE_ETAG, true);
 }
 #endif
 
 // Helper functions to reduce code size by avoiding macro expansion
 static void set_json_id(JsonObject &root, EntityBase *obj, const char *prefix, JsonDetail start_config) {
   char id_buf[160];  // object_id can be up to 128 chars + prefix + dash + null
-  const auto &object_id = obj->get_object_id();
-  snprintf(id_buf, sizeof(id_buf), "%s-%s", prefix, object_id.c_str());
+  snprintf(id_buf, sizeof(id_buf), "%s-%s", prefix, obj->get_object_id_ref().c_str());
   root["id"] = id_buf;
   if (start_config == DETAIL_ALL) {
     root["name"] = obj->get_name();
@@ -423,10 +453,37 @@ static void set_json_icon_state_value(JsonObject &root, EntityBase *obj, const c
   root["state"] = state;
 }
 
+#ifdef USE_SENSOR
+// Append str as the contents of a JSON string: quotes, backslashes and control characters are escaped, UTF-8 passes
+// through unchanged.
+static void append_json_escaped(std::string &out, const char *str, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    const char c = str[i];
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if (static_cast<uint8_t>(c) < 0x20) {
+      char esc[7];
+      snprintf(esc, sizeof(esc), "\\u%04x", static_cast<uint8_t>(c));
+      out.append(esc, 6);
+    } else {
+      out.push_back(c);
+    }
+  }
+}
+#endif
+
 // Helper to get request detail parameter
 static JsonDetail get_request_detail(AsyncWebServerRequest *request) {
+#ifdef USE_ESP32
+  // Asked on every state request, read it without allocating. Longer values don't fit and aren't "all" either.
+  char buf[sizeof("all")];
+  auto param = request->get_param("detail", buf, sizeof(buf));
+  return (param.has_value() && *param == "all") ? DETAIL_ALL : DETAIL_STATE;
+#else
   auto *param = request->getParam("detail");
   return (param && param->value() == "all") ? DETAIL_ALL : DETAIL_STATE;
+#endif
 }
 
 #ifdef USE_SENSOR
@@ -435,7 +492,7 @@ void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (sensor::Sensor *obj : App.get_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -446,13 +503,41 @@ void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_STATE);
-}
-std::string WebServer::sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
+void WebServer::sensor_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  web_server->sensor_state_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, out);
+}
+void WebServer::sensor_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
+}
+void WebServer::sensor_state_json(sensor::Sensor *obj, float value, std::string &out) {
+  // Same document as sensor_json() with DETAIL_STATE: only the value and the state are formatted per event, the rest
+  // is copied from literals and the object_id, which never needs escaping.
+  char buf[64];
+  out.append("{\"id\":\"sensor-", sizeof("{\"id\":\"sensor-") - 1);
+  out += obj->get_object_id_ref();
+  out.append("\",\"value\":", sizeof("\",\"value\":") - 1);
+  if (std::isfinite(value)) {
+    out.append(buf, snprintf(buf, sizeof(buf), "%.7g", value));
+  } else {
+    out.append("null", sizeof("null") - 1);
+  }
+  out.append(",\"state\":\"", sizeof(",\"state\":\"") - 1);
+  if (std::isnan(value)) {
+    out.append("NA", sizeof("NA") - 1);
+  } else {
+    size_t len = value_accuracy_with_uom_to_buf(buf, sizeof(buf), value, obj->get_accuracy_decimals(),
+                                                obj->get_unit_of_measurement_ref());
+    append_json_escaped(out, buf, len);
+  }
+  out.append("\"}", sizeof("\"}") - 1);
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    std::string out;
+    this->sensor_state_json(obj, value, out);
+    return out;
+  }
+
   json::JsonBuilder builder;
   JsonObject root = builder.root();
 
@@ -477,7 +562,7 @@ void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -488,12 +573,12 @@ void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const
   }
   request->send(404);
 }
-std::string WebServer::text_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
+void WebServer::text_sensor_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->text_sensor_json((text_sensor::TextSensor *) (source),
                                       ((text_sensor::TextSensor *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::text_sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_sensor_json((text_sensor::TextSensor *) (source),
+void WebServer::text_sensor_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->text_sensor_json((text_sensor::TextSensor *) (source),
                                       ((text_sensor::TextSensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
@@ -516,7 +601,7 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (switch_::Switch *obj : App.get_switches()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -562,11 +647,11 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::switch_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_STATE);
+void WebServer::switch_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::switch_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
+void WebServer::switch_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -585,7 +670,7 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (button::Button *obj : App.get_buttons()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -602,11 +687,11 @@ void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::button_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->button_json((button::Button *) (source), DETAIL_STATE);
+void WebServer::button_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->button_json((button::Button *) (source), DETAIL_STATE);
 }
-std::string WebServer::button_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->button_json((button::Button *) (source), DETAIL_ALL);
+void WebServer::button_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->button_json((button::Button *) (source), DETAIL_ALL);
 }
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -627,7 +712,7 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj) {
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -638,12 +723,12 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
   }
   request->send(404);
 }
-std::string WebServer::binary_sensor_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
+void WebServer::binary_sensor_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
                                         ((binary_sensor::BinarySensor *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::binary_sensor_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
+void WebServer::binary_sensor_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->binary_sensor_json((binary_sensor::BinarySensor *) (source),
                                         ((binary_sensor::BinarySensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
@@ -665,7 +750,7 @@ void WebServer::on_fan_update(fan::Fan *obj) {
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (fan::Fan *obj : App.get_fans()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -707,11 +792,11 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
   }
   request->send(404);
 }
-std::string WebServer::fan_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->fan_json((fan::Fan *) (source), DETAIL_STATE);
+void WebServer::fan_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->fan_json((fan::Fan *) (source), DETAIL_STATE);
 }
-std::string WebServer::fan_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->fan_json((fan::Fan *) (source), DETAIL_ALL);
+void WebServer::fan_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->fan_json((fan::Fan *) (source), DETAIL_ALL);
 }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -739,7 +824,7 @@ void WebServer::on_light_update(light::LightState *obj) {
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (light::LightState *obj : App.get_lights()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -780,11 +865,11 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::light_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->light_json((light::LightState *) (source), DETAIL_STATE);
+void WebServer::light_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->light_json((light::LightState *) (source), DETAIL_STATE);
 }
-std::string WebServer::light_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->light_json((light::LightState *) (source), DETAIL_ALL);
+void WebServer::light_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->light_json((light::LightState *) (source), DETAIL_ALL);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -812,7 +897,7 @@ void WebServer::on_cover_update(cover::Cover *obj) {
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (cover::Cover *obj : App.get_covers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -865,11 +950,11 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::cover_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->cover_json((cover::Cover *) (source), DETAIL_STATE);
+void WebServer::cover_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->cover_json((cover::Cover *) (source), DETAIL_STATE);
 }
-std::string WebServer::cover_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->cover_json((cover::Cover *) (source), DETAIL_ALL);
+void WebServer::cover_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->cover_json((cover::Cover *) (source), DETAIL_ALL);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -897,7 +982,7 @@ void WebServer::on_number_update(number::Number *obj, float state) {
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_numbers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -921,11 +1006,11 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 
-std::string WebServer::number_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_STATE);
+void WebServer::number_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::number_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_ALL);
+void WebServer::number_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -962,7 +1047,7 @@ void WebServer::on_date_update(datetime::DateEntity *obj) {
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_dates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -991,11 +1076,11 @@ void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::date_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->date_json((datetime::DateEntity *) (source), DETAIL_STATE);
+void WebServer::date_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->date_json((datetime::DateEntity *) (source), DETAIL_STATE);
 }
-std::string WebServer::date_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->date_json((datetime::DateEntity *) (source), DETAIL_ALL);
+void WebServer::date_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->date_json((datetime::DateEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1017,7 +1102,7 @@ void WebServer::on_time_update(datetime::TimeEntity *obj) {
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_times()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1045,11 +1130,11 @@ void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::time_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_STATE);
+void WebServer::time_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->time_json((datetime::TimeEntity *) (source), DETAIL_STATE);
 }
-std::string WebServer::time_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_ALL);
+void WebServer::time_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->time_json((datetime::TimeEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1071,7 +1156,7 @@ void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_datetimes()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1099,11 +1184,11 @@ void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const Ur
   }
   request->send(404);
 }
-std::string WebServer::datetime_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_STATE);
+void WebServer::datetime_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_STATE);
 }
-std::string WebServer::datetime_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_ALL);
+void WebServer::datetime_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1126,7 +1211,7 @@ void WebServer::on_text_update(text::Text *obj, const std::string &state) {
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_texts()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1150,11 +1235,11 @@ void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMat
   request->send(404);
 }
 
-std::string WebServer::text_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_STATE);
+void WebServer::text_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::text_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_ALL);
+void WebServer::text_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1180,7 +1265,7 @@ void WebServer::on_select_update(select::Select *obj, const std::string &state,
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_selects()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1204,11 +1289,11 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::select_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_STATE);
+void WebServer::select_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::select_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_ALL);
+void WebServer::select_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1236,7 +1321,7 @@ void WebServer::on_climate_update(climate::Climate *obj) {
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_climates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1269,13 +1354,13 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
   }
   request->send(404);
 }
-std::string WebServer::climate_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::climate_state_json_generator(WebServer *web_server, void *source, std::string &out) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->climate_json((climate::Climate *) (source), DETAIL_STATE);
+  out += web_server->climate_json((climate::Climate *) (source), DETAIL_STATE);
 }
-std::string WebServer::climate_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::climate_all_json_generator(WebServer *web_server, void *source, std::string &out) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->climate_json((climate::Climate *) (source), DETAIL_ALL);
+  out += web_server->climate_json((climate::Climate *) (source), DETAIL_ALL);
 }
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
@@ -1376,7 +1461,7 @@ void WebServer::on_lock_update(lock::Lock *obj) {
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (lock::Lock *obj : App.get_locks()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1422,11 +1507,11 @@ void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMat
   }
   request->send(404);
 }
-std::string WebServer::lock_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_STATE);
+void WebServer::lock_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_STATE);
 }
-std::string WebServer::lock_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_ALL);
+void WebServer::lock_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1447,7 +1532,7 @@ void WebServer::on_valve_update(valve::Valve *obj) {
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (valve::Valve *obj : App.get_valves()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1498,11 +1583,11 @@ void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMa
   }
   request->send(404);
 }
-std::string WebServer::valve_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->valve_json((valve::Valve *) (source), DETAIL_STATE);
+void WebServer::valve_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->valve_json((valve::Valve *) (source), DETAIL_STATE);
 }
-std::string WebServer::valve_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->valve_json((valve::Valve *) (source), DETAIL_ALL);
+void WebServer::valve_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->valve_json((valve::Valve *) (source), DETAIL_ALL);
 }
 std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1528,7 +1613,7 @@ void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlP
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1573,13 +1658,13 @@ void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *reques
   }
   request->send(404);
 }
-std::string WebServer::alarm_control_panel_state_json_generator(WebServer *web_server, void *source) {
-  return web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
+void WebServer::alarm_control_panel_state_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
                                               ((alarm_control_panel::AlarmControlPanel *) (source))->get_state(),
                                               DETAIL_STATE);
 }
-std::string WebServer::alarm_control_panel_all_json_generator(WebServer *web_server, void *source) {
-  return web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
+void WebServer::alarm_control_panel_all_json_generator(WebServer *web_server, void *source, std::string &out) {
+  out += web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
                                               ((alarm_control_panel::AlarmControlPanel *) (source))->get_state(),
                                               DETAIL_ALL);
 }
@@ -1607,7 +1692,7 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
 
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (event::Event *obj : App.get_events()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1624,13 +1709,13 @@ static std::string get_event_type(event::Event *event) {
   return (event && event->last_event_type) ? *event->last_event_type : "";
 }
 
-std::string WebServer::event_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::event_state_json_generator(WebServer *web_server, void *source, std::string &out) {
   auto *event = static_cast<event::Event *>(source);
-  return web_server->event_json(event, get_event_type(event), DETAIL_STATE);
+  out += web_server->event_json(event, get_event_type(event), DETAIL_STATE);
 }
-std::string WebServer::event_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::event_all_json_generator(WebServer *web_server, void *source, std::string &out) {
   auto *event = static_cast<event::Event *>(source);
-  return web_server->event_json(event, get_event_type(event), DETAIL_ALL);
+  out += web_server->event_json(event, get_event_type(event), DETAIL_ALL);
 }
 std::string WebServer::event_json(event::Event *obj, const std::string &event_type, JsonDetail start_config) {
   json::JsonBuilder builder;
@@ -1672,7 +1757,7 @@ void WebServer::on_update(update::UpdateEntity *obj) {
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (update::UpdateEntity *obj : App.get_updates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1693,13 +1778,13 @@ void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlM
   }
   request->send(404);
 }
-std::string WebServer::update_state_json_generator(WebServer *web_server, void *source) {
+void WebServer::update_state_json_generator(WebServer *web_server, void *source, std::string &out) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
+  out += web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
 }
-std::string WebServer::update_all_json_generator(WebServer *web_server, void *source) {
+void WebServer::update_all_json_generator(WebServer *web_server, void *source, std::string &out) {
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
+  out += web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
 }
 std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_config) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
@@ -1962,7 +2047,7 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 
   // No matching handler found - send 404
-  ESP_LOGV(TAG, "Request for unknown URL: %s", url.c_str());
+  ESP_LOGV(TAG, "Request for unknown URL: %.*s", (int) url.length(), url.c_str());
   request->send(404, "text/plain", "Not Found");
 }
 
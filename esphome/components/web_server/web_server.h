@@ -18,16 +18,23 @@
 #if USE_WEBSERVER_VERSION >= 2
 extern const uint8_t ESPHOME_WEBSERVER_INDEX_HTML[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_INDEX_HTML_SIZE;
+extern const char ESPHOME_WEBSERVER_INDEX_HTML_ETAG[];
+#endif
+
+#ifdef USE_WEBSERVER_LOCAL
+extern const char ESPHOME_WEBSERVER_INDEX_GZ_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_JS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_JS_INCLUDE_ETAG[];
 #endif
 
 namespace esphome {
@@ -48,8 +55,8 @@ struct UrlMatch {
     return domain && domain_len == strlen(str) && memcmp(domain, str, domain_len) == 0;
   }
 
-  bool id_equals(const std::string &str) const {
-    return id && id_len == str.length() && memcmp(id, str.c_str(), id_len) == 0;
+  bool id_equals(const StringRef &str) const {
+    return id && id_len == str.size() && memcmp(id, str.c_str(), id_len) == 0;
   }
 
   bool method_equals(const char *str) const {
@@ -82,7 +89,28 @@ enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
   can be forgotten.
 */
 #if !defined(USE_ESP32) && defined(USE_ARDUINO)
-using message_generator_t = std::string(WebServer *, void *);
+/// Appends the event message for source to out; state generators may stream it in without a temporary document.
+using message_generator_t = void(WebServer *, void *, std::string &);
+
+/// A state event being fanned out to every event source. It is serialized by the first source that can send it right
+/// away and the same buffer is handed to the rest, so N open dashboards cost one serialization instead of N.
+class SharedEventMessage {
+ public:
+  SharedEventMessage(WebServer *web_server, void *source, message_generator_t *message_generator, std::string &buffer)
+      : web_server_(web_server), source_(source), message_generator_(message_generator), buffer_(buffer) {}
+
+  void *get_source() const { return this->source_; }
+  message_generator_t *get_message_generator() const { return this->message_generator_; }
+  /// The serialized message, generated on first use.
+  const char *c_str();
+
+ protected:
+  WebServer *web_server_;
+  void *source_;
+  message_generator_t *message_generator_;
+  std::string &buffer_;
+  bool generated_{false};
+};
 
 class DeferredUpdateEventSourceList;
 class DeferredUpdateEventSource : public AsyncEventSource {
@@ -121,6 +149,8 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   // footprint is more important than speed here)
   std::vector<DeferredEvent> deferred_queue_;
   WebServer *web_server_;
+  // Reused for every generated message so a warm source does not allocate per event
+  std::string message_buffer_;
   uint16_t consecutive_send_failures_{0};
   static constexpr uint16_t MAX_CONSECUTIVE_SEND_FAILURES = 2500;  // ~20 seconds at 125Hz loop rate
 
@@ -128,6 +158,7 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
 
   void process_deferred_queue_();
+  void deferrable_send_state_(const char *event_type, SharedEventMessage &message);
 
  public:
   DeferredUpdateEventSource(WebServer *ws, const String &url)
@@ -144,6 +175,9 @@ class DeferredUpdateEventSourceList : public std::list<DeferredUpdateEventSource
   void on_client_connect_(WebServer *ws, DeferredUpdateEventSource *source);
   void on_client_disconnect_(DeferredUpdateEventSource *source);
 
+  // Holds the state event currently being fanned out, see SharedEventMessage
+  std::string message_buffer_;
+
  public:
   void loop();
 
@@ -252,10 +286,12 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a sensor request under '/sensor/<id>'.
   void handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string sensor_all_json_generator(WebServer *web_server, void *source);
+  static void sensor_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void sensor_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the sensor state with its value as a JSON string.
   std::string sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config);
+  /// Append the DETAIL_STATE document of the sensor to out without building a JSON document first.
+  void sensor_state_json(sensor::Sensor *obj, float value, std::string &out);
 #endif
 
 #ifdef USE_SWITCH
@@ -264,8 +300,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a switch request under '/switch/<id>/</turn_on/turn_off/toggle>'.
   void handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string switch_state_json_generator(WebServer *web_server, void *source);
-  static std::string switch_all_json_generator(WebServer *web_server, void *source);
+  static void switch_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void switch_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the switch state with its value as a JSON string.
   std::string switch_json(switch_::Switch *obj, bool value, JsonDetail start_config);
 #endif
@@ -274,8 +310,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a button request under '/button/<id>/press'.
   void handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string button_state_json_generator(WebServer *web_server, void *source);
-  static std::string button_all_json_generator(WebServer *web_server, void *source);
+  static void button_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void button_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the button details with its value as a JSON string.
   std::string button_json(button::Button *obj, JsonDetail start_config);
 #endif
@@ -286,8 +322,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a binary sensor request under '/binary_sensor/<id>'.
   void handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string binary_sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string binary_sensor_all_json_generator(WebServer *web_server, void *source);
+  static void binary_sensor_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void binary_sensor_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the binary sensor state with its value as a JSON string.
   std::string binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config);
 #endif
@@ -298,8 +334,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a fan request under '/fan/<id>/</turn_on/turn_off/toggle>'.
   void handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string fan_state_json_generator(WebServer *web_server, void *source);
-  static std::string fan_all_json_generator(WebServer *web_server, void *source);
+  static void fan_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void fan_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the fan state as a JSON string.
   std::string fan_json(fan::Fan *obj, JsonDetail start_config);
 #endif
@@ -310,8 +346,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a light request under '/light/<id>/</turn_on/turn_off/toggle>'.
   void handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string light_state_json_generator(WebServer *web_server, void *source);
-  static std::string light_all_json_generator(WebServer *web_server, void *source);
+  static void light_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void light_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the light state as a JSON string.
   std::string light_json(light::LightState *obj, JsonDetail start_config);
 #endif
@@ -322,8 +358,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a text sensor request under '/text_sensor/<id>'.
   void handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string text_sensor_state_json_generator(WebServer *web_server, void *source);
-  static std::string text_sensor_all_json_generator(WebServer *web_server, void *source);
+  static void text_sensor_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void text_sensor_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the text sensor state with its value as a JSON string.
   std::string text_sensor_json(text_sensor::TextSensor *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -334,8 +370,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a cover request under '/cover/<id>/<open/close/stop/set>'.
   void handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string cover_state_json_generator(WebServer *web_server, void *source);
-  static std::string cover_all_json_generator(WebServer *web_server, void *source);
+  static void cover_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void cover_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the cover state as a JSON string.
   std::string cover_json(cover::Cover *obj, JsonDetail start_config);
 #endif
@@ -345,8 +381,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a number request under '/number/<id>'.
   void handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string number_state_json_generator(WebServer *web_server, void *source);
-  static std::string number_all_json_generator(WebServer *web_server, void *source);
+  static void number_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void number_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the number state with its value as a JSON string.
   std::string number_json(number::Number *obj, float value, JsonDetail start_config);
 #endif
@@ -356,8 +392,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a date request under '/date/<id>'.
   void handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string date_state_json_generator(WebServer *web_server, void *source);
-  static std::string date_all_json_generator(WebServer *web_server, void *source);
+  static void date_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void date_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the date state with its value as a JSON string.
   std::string date_json(datetime::DateEntity *obj, JsonDetail start_config);
 #endif
@@ -367,8 +403,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a time request under '/time/<id>'.
   void handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string time_state_json_generator(WebServer *web_server, void *source);
-  static std::string time_all_json_generator(WebServer *web_server, void *source);
+  static void time_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void time_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the time state with its value as a JSON string.
   std::string time_json(datetime::TimeEntity *obj, JsonDetail start_config);
 #endif
@@ -378,8 +414,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a datetime request under '/datetime/<id>'.
   void handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string datetime_state_json_generator(WebServer *web_server, void *source);
-  static std::string datetime_all_json_generator(WebServer *web_server, void *source);
+  static void datetime_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void datetime_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the datetime state with its value as a JSON string.
   std::string datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config);
 #endif
@@ -389,8 +425,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a text input request under '/text/<id>'.
   void handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string text_state_json_generator(WebServer *web_server, void *source);
-  static std::string text_all_json_generator(WebServer *web_server, void *source);
+  static void text_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void text_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the text state with its value as a JSON string.
   std::string text_json(text::Text *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -400,8 +436,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a select request under '/select/<id>'.
   void handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string select_state_json_generator(WebServer *web_server, void *source);
-  static std::string select_all_json_generator(WebServer *web_server, void *source);
+  static void select_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void select_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the select state with its value as a JSON string.
   std::string select_json(select::Select *obj, const std::string &value, JsonDetail start_config);
 #endif
@@ -411,8 +447,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a climate request under '/climate/<id>'.
   void handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string climate_state_json_generator(WebServer *web_server, void *source);
-  static std::string climate_all_json_generator(WebServer *web_server, void *source);
+  static void climate_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void climate_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the climate details
   std::string climate_json(climate::Climate *obj, JsonDetail start_config);
 #endif
@@ -423,8 +459,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a lock request under '/lock/<id>/</lock/unlock/open>'.
   void handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string lock_state_json_generator(WebServer *web_server, void *source);
-  static std::string lock_all_json_generator(WebServer *web_server, void *source);
+  static void lock_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void lock_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the lock state with its value as a JSON string.
   std::string lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config);
 #endif
@@ -435,8 +471,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a valve request under '/valve/<id>/<open/close/stop/set>'.
   void handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string valve_state_json_generator(WebServer *web_server, void *source);
-  static std::string valve_all_json_generator(WebServer *web_server, void *source);
+  static void valve_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void valve_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the valve state as a JSON string.
   std::string valve_json(valve::Valve *obj, JsonDetail start_config);
 #endif
@@ -447,8 +483,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a alarm_control_panel request under '/alarm_control_panel/<id>'.
   void handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string alarm_control_panel_state_json_generator(WebServer *web_server, void *source);
-  static std::string alarm_control_panel_all_json_generator(WebServer *web_server, void *source);
+  static void alarm_control_panel_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void alarm_control_panel_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the alarm_control_panel state with its value as a JSON string.
   std::string alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                        alarm_control_panel::AlarmControlPanelState value, JsonDetail start_config);
@@ -457,8 +493,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 #ifdef USE_EVENT
   void on_event(event::Event *obj, const std::string &event_type) override;
 
-  static std::string event_state_json_generator(WebServer *web_server, void *source);
-  static std::string event_all_json_generator(WebServer *web_server, void *source);
+  static void event_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void event_all_json_generator(WebServer *web_server, void *source, std::string &out);
 
   /// Handle a event request under '/event<id>'.
   void handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match);
@@ -473,8 +509,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a update request under '/update/<id>'.
   void handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  static std::string update_state_json_generator(WebServer *web_server, void *source);
-  static std::string update_all_json_generator(WebServer *web_server, void *source);
+  static void update_state_json_generator(WebServer *web_server, void *source, std::string &out);
+  static void update_all_json_generator(WebServer *web_server, void *source, std::string &out);
   /// Dump the update state with its value as a JSON string.
   std::string update_json(update::UpdateEntity *obj, JsonDetail start_config);
 #endif
@@ -497,6 +533,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool include_internal_{false};
 
  protected:
+  /// Send a resource embedded in flash with its ETag, or an empty 304 when the client already has it.
+  void send_static_resource_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                             size_t size, const char *etag, bool gzip);
   void add_sorting_info_(JsonObject &root, EntityBase *entity);
 
 #ifdef USE_LIGHT
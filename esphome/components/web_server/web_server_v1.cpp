@@ -15,7 +15,7 @@ void write_row(AsyncResponseStream *stream, EntityBase *obj, const std::string &
   stream->print("\" id=\"");
   stream->print(klass.c_str());
   stream->print("-");
-  stream->print(obj->get_object_id().c_str());
+  stream->print(obj->get_object_id_ref().c_str());
   stream->print("\"><td>");
   stream->print(obj->get_name().c_str());
   stream->print("</td><td></td><td>");
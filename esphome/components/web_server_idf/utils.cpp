@@ -53,6 +53,11 @@ optional<std::string> request_get_header(httpd_req_t *req, const char *name) {
   return {str};
 }
 
+bool request_get_header(httpd_req_t *req, const char *name, char *buf, size_t size) {
+  // Truncated values are reported as missing, a cut off header would compare wrong
+  return httpd_req_get_hdr_value_str(req, name, buf, size) == ESP_OK;
+}
+
 optional<std::string> request_get_url_query(httpd_req_t *req) {
   auto len = httpd_req_get_url_query_len(req);
   if (len == 0) {
@@ -72,24 +77,35 @@ optional<std::string> request_get_url_query(httpd_req_t *req) {
 }
 
 optional<std::string> query_key_value(const std::string &query_url, const std::string &key) {
-  if (query_url.empty()) {
+  return query_key_value(query_url.c_str(), query_url.size(), key.c_str());
+}
+
+optional<std::string> query_key_value(const char *query_url, size_t query_len, const char *key) {
+  if (query_len == 0) {
     return {};
   }
 
-  auto val = std::unique_ptr<char[]>(new char[query_url.size()]);
+  // A value is never longer than the query it is part of
+  auto val = std::unique_ptr<char[]>(new char[query_len + 1]);
   if (!val) {
     ESP_LOGE(TAG, "Not enough memory to the query key value");
     return {};
   }
 
-  if (httpd_query_key_value(query_url.c_str(), key.c_str(), val.get(), query_url.size()) != ESP_OK) {
+  if (!query_key_value(query_url, key, val.get(), query_len + 1)) {
     return {};
   }
-
-  url_decode(val.get());
   return {val.get()};
 }
 
+bool query_key_value(const char *query_url, const char *key, char *buf, size_t size) {
+  if (httpd_query_key_value(query_url, key, buf, size) != ESP_OK) {
+    return false;
+  }
+  url_decode(buf);
+  return true;
+}
+
 // Helper function for case-insensitive string region comparison
 bool str_ncmp_ci(const char *s1, const char *s2, size_t n) {
   for (size_t i = 0; i < n; i++) {
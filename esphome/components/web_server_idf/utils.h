@@ -10,8 +10,13 @@ namespace web_server_idf {
 
 bool request_has_header(httpd_req_t *req, const char *name);
 optional<std::string> request_get_header(httpd_req_t *req, const char *name);
+/// Copies the header value into buf without allocating. False if it is missing or does not fit, with its NUL, in size.
+bool request_get_header(httpd_req_t *req, const char *name, char *buf, size_t size);
 optional<std::string> request_get_url_query(httpd_req_t *req);
 optional<std::string> query_key_value(const std::string &query_url, const std::string &key);
+optional<std::string> query_key_value(const char *query_url, size_t query_len, const char *key);
+/// Decodes the value of key in the NUL terminated query into buf, false if it is missing or does not fit.
+bool query_key_value(const char *query_url, const char *key, char *buf, size_t size);
 
 // Helper function for case-insensitive character comparison
 inline bool char_equals_ci(char a, char b) { return ::tolower(a) == ::tolower(b); }
@@ -100,6 +100,9 @@ void AsyncWebServer::begin() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
   config.uri_match_fn = [](const char * /*unused*/, const char * /*unused*/, size_t /*unused*/) { return true; };
+  // Clients polling the REST API keep their connection open between requests. When all sockets are taken, close the
+  // least recently used one instead of refusing the new client.
+  config.lru_purge_enable = true;
   if (httpd_start(&this->server_, &config) == ESP_OK) {
     const httpd_uri_t handler_get = {
         .uri = "",
@@ -215,17 +218,24 @@ optional<std::string> AsyncWebServerRequest::get_header(const char *name) const
   return request_get_header(*this, name);
 }
 
-std::string AsyncWebServerRequest::url() const {
-  auto *str = strchr(this->req_->uri, '?');
-  if (str == nullptr) {
-    return this->req_->uri;
+optional<StringRef> AsyncWebServerRequest::get_header(const char *name, char *buf, size_t size) const {
+  if (!request_get_header(*this, name, buf, size)) {
+    return {};
   }
-  return std::string(this->req_->uri, str - this->req_->uri);
+  return StringRef(buf);
+}
+
+StringRef AsyncWebServerRequest::url() const {
+  const char *uri = this->req_->uri;
+  const char *query = strchr(uri, '?');
+  return StringRef(uri, query == nullptr ? strlen(uri) : query - uri);
 }
 
 std::string AsyncWebServerRequest::host() const { return this->get_header("Host").value(); }
 
 void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
+  if (response->finish_chunked())
+    return;
   httpd_resp_send(*this, response->get_content_data(), response->get_content_size());
 }
 
@@ -251,6 +261,9 @@ void AsyncWebServerRequest::init_response_(AsyncWebServerResponse *rsp, int code
     case 200:
       status = HTTPD_200;
       break;
+    case 304:
+      status = "304 Not Modified";
+      break;
     case 404:
       status = HTTPD_404;
       break;
@@ -324,12 +337,13 @@ AsyncWebParameter *AsyncWebServerRequest::getParam(const std::string &name) {
     }
   }
 
-  // Look up value from query strings
+  // Look up value from query strings, the one of the URL is read in place
   optional<std::string> val = query_key_value(this->post_query_, name);
   if (!val.has_value()) {
-    auto url_query = request_get_url_query(*this);
-    if (url_query.has_value()) {
-      val = query_key_value(url_query.value(), name);
+    const char *url_query = strchr(this->req_->uri, '?');
+    if (url_query != nullptr) {
+      url_query++;
+      val = query_key_value(url_query, strlen(url_query), name.c_str());
     }
   }
 
@@ -344,12 +358,42 @@ AsyncWebParameter *AsyncWebServerRequest::getParam(const std::string &name) {
   return param;
 }
 
+optional<StringRef> AsyncWebServerRequest::get_param(const char *name, char *buf, size_t size) const {
+  bool found = !this->post_query_.empty() && query_key_value(this->post_query_.c_str(), name, buf, size);
+  if (!found) {
+    const char *url_query = strchr(this->req_->uri, '?');
+    found = url_query != nullptr && query_key_value(url_query + 1, name, buf, size);
+  }
+  if (!found) {
+    return {};
+  }
+  return StringRef(buf);
+}
+
 void AsyncWebServerResponse::addHeader(const char *name, const char *value) {
   httpd_resp_set_hdr(*this->req_, name, value);
 }
 
 void AsyncResponseStream::print(float value) { this->print(to_string(value)); }
 
+void AsyncResponseStream::flush_chunk_() {
+  if (this->chunk_size_ == 0 || this->content_.size() < this->chunk_size_)
+    return;
+  httpd_resp_send_chunk(*this->req_, this->content_.data(), this->content_.size());
+  // Keeps its capacity, the next chunk is written into the same buffer
+  this->content_.clear();
+  this->chunked_ = true;
+}
+
+bool AsyncResponseStream::finish_chunked() {
+  if (!this->chunked_)
+    return false;
+  if (!this->content_.empty())
+    httpd_resp_send_chunk(*this->req_, this->content_.data(), this->content_.size());
+  httpd_resp_send_chunk(*this->req_, nullptr, 0);
+  return true;
+}
+
 void AsyncResponseStream::printf(const char *fmt, ...) {
   va_list args;
 
@@ -416,13 +460,30 @@ void AsyncEventSource::deferrable_send_state(void *source, const char *event_typ
   // Skip if no connected clients to avoid unnecessary processing
   if (this->empty())
     return;
+  if (source == nullptr || message_generator == nullptr)
+    return;
+  std::string *buffer = this->sessions_.size() > 1 ? &this->message_buffer_ : nullptr;
+  SharedEventMessage message(this->web_server_, source, message_generator, buffer);
   for (auto *ses : this->sessions_) {
     if (ses->fd_.load() != 0) {  // Skip dead sessions
-      ses->deferrable_send_state(source, event_type, message_generator);
+      ses->deferrable_send_state_(event_type, message);
     }
   }
 }
 
+void SharedEventMessage::append_to(std::string &out) {
+  if (this->buffer_ == nullptr) {
+    this->message_generator_(this->web_server_, this->source_, out);
+    return;
+  }
+  if (!this->generated_) {
+    this->buffer_->clear();
+    this->message_generator_(this->web_server_, this->source_, *this->buffer_);
+    this->generated_ = true;
+  }
+  out.append(*this->buffer_);
+}
+
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request,
                                                    esphome::web_server_idf::AsyncEventSource *server,
                                                    esphome::web_server::WebServer *ws)
@@ -504,8 +565,8 @@ void AsyncEventSourceResponse::deq_push_back_with_dedup_(void *source, message_g
 void AsyncEventSourceResponse::process_deferred_queue_() {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
-    if (this->try_send_nodefer(message.c_str(), "state")) {
+    SharedEventMessage message(web_server_, de.source_, de.message_generator_, nullptr);
+    if (this->try_send_state_nodefer_(message)) {
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
     } else {
@@ -576,23 +637,12 @@ void AsyncEventSourceResponse::loop() {
     this->entities_iterator_->advance();
 }
 
-bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char *event, uint32_t id,
-                                                uint32_t reconnect) {
-  if (this->fd_.load() == 0) {
-    return false;
-  }
-
-  process_buffer_();
-  if (!event_buffer_.empty()) {
-    // there is still pending event data to send first
-    return false;
-  }
-
-  // 8 spaces are standing in for the hexidecimal chunk length to print later
-  const char chunk_len_header[] = "        " CRLF_STR;
-  const int chunk_len_header_len = sizeof(chunk_len_header) - 1;
+// 8 spaces are standing in for the hexidecimal chunk length to print later
+static const char CHUNK_LEN_HEADER[] = "        " CRLF_STR;
+static const int CHUNK_LEN_HEADER_LEN = sizeof(CHUNK_LEN_HEADER) - 1;
 
-  event_buffer_.append(chunk_len_header);
+void AsyncEventSourceResponse::begin_event_(const char *event, uint32_t id, uint32_t reconnect) {
+  event_buffer_.append(CHUNK_LEN_HEADER, CHUNK_LEN_HEADER_LEN);
 
   if (reconnect) {
     event_buffer_.append("retry: ", sizeof("retry: ") - 1);
@@ -611,45 +661,81 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
     event_buffer_.append(event);
     event_buffer_.append(CRLF_STR, CRLF_LEN);
   }
+}
 
-  if (message && *message) {
-    event_buffer_.append("data: ", sizeof("data: ") - 1);
-    event_buffer_.append(message);
-    event_buffer_.append(CRLF_STR, CRLF_LEN);
-  }
-
-  if (event_buffer_.empty()) {
-    return true;
-  }
-
+void AsyncEventSourceResponse::end_event_() {
   event_buffer_.append(CRLF_STR, CRLF_LEN);
   event_buffer_.append(CRLF_STR, CRLF_LEN);
 
   // chunk length header itself and the final chunk terminating CRLF are not counted as part of the chunk
-  int chunk_len = event_buffer_.size() - CRLF_LEN - chunk_len_header_len;
+  int chunk_len = event_buffer_.size() - CRLF_LEN - CHUNK_LEN_HEADER_LEN;
   char chunk_len_str[9];
   snprintf(chunk_len_str, 9, "%08x", chunk_len);
   std::memcpy(&event_buffer_[0], chunk_len_str, 8);
 
   event_bytes_sent_ = 0;
   process_buffer_();
+}
 
+bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char *event, uint32_t id,
+                                                uint32_t reconnect) {
+  if (this->fd_.load() == 0) {
+    return false;
+  }
+
+  process_buffer_();
+  if (!event_buffer_.empty()) {
+    // there is still pending event data to send first
+    return false;
+  }
+
+  this->begin_event_(event, id, reconnect);
+
+  if (message && *message) {
+    event_buffer_.append("data: ", sizeof("data: ") - 1);
+    event_buffer_.append(message);
+    event_buffer_.append(CRLF_STR, CRLF_LEN);
+  }
+
+  this->end_event_();
+  return true;
+}
+
+bool AsyncEventSourceResponse::try_send_state_nodefer_(SharedEventMessage &message) {
+  if (this->fd_.load() == 0) {
+    return false;
+  }
+
+  process_buffer_();
+  if (!event_buffer_.empty()) {
+    return false;
+  }
+
+  // The buffer keeps its capacity between events, so a warm connection formats state events without allocating
+  this->begin_event_("state", 0, 0);
+  event_buffer_.append("data: ", sizeof("data: ") - 1);
+  message.append_to(event_buffer_);
+  event_buffer_.append(CRLF_STR, CRLF_LEN);
+  this->end_event_();
   return true;
 }
 
 void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
                                                      message_generator_t *message_generator) {
+  if (source == nullptr || message_generator == nullptr)
+    return;
+  SharedEventMessage message(web_server_, source, message_generator, nullptr);
+  this->deferrable_send_state_(event_type, message);
+}
+
+void AsyncEventSourceResponse::deferrable_send_state_(const char *event_type, SharedEventMessage &message) {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
   if (!entities_iterator_->completed() && 0 != strcmp(event_type, "state_detail_all"))
     return;
 
-  if (source == nullptr)
-    return;
   if (event_type == nullptr)
     return;
-  if (message_generator == nullptr)
-    return;
 
   if (0 != strcmp(event_type, "state_detail_all") && 0 != strcmp(event_type, "state")) {
     ESP_LOGE(TAG, "Can't defer non-state event");
@@ -661,11 +747,10 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
   if (!event_buffer_.empty() || !deferred_queue_.empty()) {
     // outgoing event buffer or deferred queue still not empty which means downstream tcp send buffer full, no point
     // trying to send first
-    deq_push_back_with_dedup_(source, message_generator);
+    deq_push_back_with_dedup_(message.get_source(), message.get_message_generator());
   } else {
-    std::string message = message_generator(web_server_, source);
-    if (!this->try_send_nodefer(message.c_str(), "state")) {
-      deq_push_back_with_dedup_(source, message_generator);
+    if (!this->try_send_state_nodefer_(message)) {
+      deq_push_back_with_dedup_(message.get_source(), message.get_message_generator());
     }
   }
 }
@@ -673,7 +758,9 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
 
 #ifdef USE_WEBSERVER_OTA
 esp_err_t AsyncWebServer::handle_multipart_upload_(httpd_req_t *r, const char *content_type) {
-  static constexpr size_t MULTIPART_CHUNK_SIZE = 1460;       // Match Arduino AsyncWebServer buffer size
+  // One flash sector, what the OTA backend writes at once. Reads of several TCP segments keep the parser and the
+  // backend from being called for every segment.
+  static constexpr size_t MULTIPART_CHUNK_SIZE = 4096;
   static constexpr size_t YIELD_INTERVAL_BYTES = 16 * 1024;  // Yield every 16KB to prevent watchdog
 
   // Parse boundary and create reader
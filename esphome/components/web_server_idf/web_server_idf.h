@@ -2,6 +2,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/core/defines.h"
+#include "esphome/core/string_ref.h"
 #include <esp_http_server.h>
 
 #include <atomic>
@@ -44,6 +45,8 @@ class AsyncWebServerResponse {
 
   virtual const char *get_content_data() const = 0;
   virtual size_t get_content_size() const = 0;
+  /// Complete a response whose body already went out in part, false if the whole body still has to be sent.
+  virtual bool finish_chunked() { return false; }
 
  protected:
   const AsyncWebServerRequest *req_;
@@ -76,13 +79,43 @@ class AsyncResponseStream : public AsyncWebServerResponse {
   const char *get_content_data() const override { return this->content_.c_str(); };
   size_t get_content_size() const override { return this->content_.size(); };
 
-  void print(const char *str) { this->content_.append(str); }
-  void print(const std::string &str) { this->content_.append(str); }
+  void print(const char *str) {
+    this->content_.append(str);
+    this->flush_chunk_();
+  }
+  void print(const std::string &str) {
+    this->content_.append(str);
+    this->flush_chunk_();
+  }
   void print(float value);
+  /// Writer interface, so JSON can be serialized straight into the response with json::JsonBuilder::serialize_to().
+  size_t write(uint8_t c) {
+    this->content_.push_back(static_cast<char>(c));
+    this->flush_chunk_();
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) {
+    this->content_.append(reinterpret_cast<const char *>(data), len);
+    this->flush_chunk_();
+    return len;
+  }
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 
+  /// One TCP segment, with the default max segment size
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 1460;
+
+  /// Send the body with chunked transfer encoding whenever chunk_size bytes are buffered instead of holding all of it
+  /// until the response is sent. Bodies smaller than one chunk still go out in one piece with a Content-Length.
+  /// 0 buffers the whole body, headers can then still be added after printing.
+  void set_chunk_size(size_t chunk_size) { this->chunk_size_ = chunk_size; }
+  bool finish_chunked() override;
+
  protected:
+  void flush_chunk_();
+
   std::string content_;
+  size_t chunk_size_{DEFAULT_CHUNK_SIZE};
+  bool chunked_{false};
 };
 
 class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
@@ -105,7 +138,8 @@ class AsyncWebServerRequest {
   ~AsyncWebServerRequest();
 
   http_method method() const { return static_cast<http_method>(this->req_->method); }
-  std::string url() const;
+  /// Path without the query. A view into the request, so it is not NUL terminated when there is a query.
+  StringRef url() const;
   std::string host() const;
   // NOLINTNEXTLINE(readability-identifier-naming)
   size_t contentLength() const { return this->req_->content_len; }
@@ -161,8 +195,14 @@ class AsyncWebServerRequest {
     return {};
   }
 
+  /// Look up a query or form parameter without allocating or caching it.
+  /// @return View of the decoded value in buf, empty if it is missing or does not fit in size.
+  optional<StringRef> get_param(const char *name, char *buf, size_t size) const;
+
   operator httpd_req_t *() const { return this->req_; }
   optional<std::string> get_header(const char *name) const;
+  /// Look up a header without allocating. @return View of the value in buf, empty if it is missing or does not fit.
+  optional<StringRef> get_header(const char *name, char *buf, size_t size) const;
   // NOLINTNEXTLINE(readability-identifier-naming)
   bool hasHeader(const char *name) const;
 
@@ -232,7 +272,8 @@ class AsyncWebHandler {
 class AsyncEventSource;
 class AsyncEventSourceResponse;
 
-using message_generator_t = std::string(esphome::web_server::WebServer *, void *);
+/// Appends the event message for source to out, see esphome::web_server::WebServer's *_json_generator functions.
+using message_generator_t = void(esphome::web_server::WebServer *, void *, std::string &);
 
 /*
   This class holds a pointer to the source component that wants to publish a state event, and a pointer to a function
@@ -257,6 +298,28 @@ struct DeferredEvent {
   }
 } __attribute__((packed));
 
+/// A state event being fanned out to every session. With a single session it is generated straight into that
+/// session's send buffer; with more it is serialized once into a buffer shared by all of them.
+class SharedEventMessage {
+ public:
+  SharedEventMessage(esphome::web_server::WebServer *web_server, void *source, message_generator_t *message_generator,
+                     std::string *buffer)
+      : web_server_(web_server), source_(source), message_generator_(message_generator), buffer_(buffer) {}
+
+  void *get_source() const { return this->source_; }
+  message_generator_t *get_message_generator() const { return this->message_generator_; }
+  /// Append the message to out, generating it on first use.
+  void append_to(std::string &out);
+
+ protected:
+  esphome::web_server::WebServer *web_server_;
+  void *source_;
+  message_generator_t *message_generator_;
+  // nullptr when the message is only sent once
+  std::string *buffer_;
+  bool generated_{false};
+};
+
 class AsyncEventSourceResponse {
   friend class AsyncEventSource;
 
@@ -272,6 +335,11 @@ class AsyncEventSourceResponse {
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
   void process_deferred_queue_();
   void process_buffer_();
+  void deferrable_send_state_(const char *event_type, SharedEventMessage &message);
+  /// Append the state event to event_buffer_ and send it, false if the previous event is still pending.
+  bool try_send_state_nodefer_(SharedEventMessage &message);
+  void begin_event_(const char *event, uint32_t id, uint32_t reconnect);
+  void end_event_();
 
   static void destroy(void *p);
   AsyncEventSource *server_;
@@ -318,6 +386,8 @@ class AsyncEventSource : public AsyncWebHandler {
   // Linear search is faster than red-black tree overhead for this small dataset.
   // Only operations needed: add session, remove session, iterate sessions - no need for sorted order.
   std::vector<AsyncEventSourceResponse *> sessions_;
+  // Holds the state event currently being fanned out to several sessions, see SharedEventMessage
+  std::string message_buffer_;
   connect_handler_t on_connect_{};
   esphome::web_server::WebServer *web_server_;
 };
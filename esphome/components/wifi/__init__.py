@@ -23,6 +23,7 @@ from esphome.const import (
     CONF_FAST_CONNECT,
     CONF_GATEWAY,
     CONF_HIDDEN,
+    CONF_HYSTERESIS,
     CONF_ID,
     CONF_IDENTITY,
     CONF_KEY,
@@ -227,6 +228,8 @@ def _validate(config):
         networks = config.get(CONF_NETWORKS, [])
         if not networks:
             raise cv.Invalid("At least one network required for fast_connect!")
+    elif config.get(CONF_REUSE_DHCP_LEASE, False):
+        raise cv.Invalid(f"{CONF_REUSE_DHCP_LEASE} requires {CONF_FAST_CONNECT}")
 
     if CONF_USE_ADDRESS not in config:
         use_address = CORE.name + config[CONF_DOMAIN]
@@ -252,6 +255,20 @@ def _validate(config):
 
 CONF_OUTPUT_POWER = "output_power"
 CONF_PASSIVE_SCAN = "passive_scan"
+CONF_REUSE_DHCP_LEASE = "reuse_dhcp_lease"
+CONF_ROAMING = "roaming"
+CONF_RSSI_THRESHOLD = "rssi_threshold"
+CONF_SCAN_INTERVAL = "scan_interval"
+
+ROAMING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(
+            CONF_SCAN_INTERVAL, default="5min"
+        ): cv.positive_not_null_time_period,
+        cv.Optional(CONF_RSSI_THRESHOLD, default=-70): cv.int_range(min=-100, max=0),
+        cv.Optional(CONF_HYSTERESIS, default=8): cv.int_range(min=1, max=40),
+    }
+)
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -276,6 +293,8 @@ CONFIG_SCHEMA = cv.All(
                 ln882x="light",
             ): cv.enum(WIFI_POWER_SAVE_MODES, upper=True),
             cv.Optional(CONF_FAST_CONNECT, default=False): cv.boolean,
+            cv.Optional(CONF_REUSE_DHCP_LEASE, default=False): cv.boolean,
+            cv.Optional(CONF_ROAMING): ROAMING_SCHEMA,
             cv.Optional(CONF_USE_ADDRESS): cv.string_strict,
             cv.SplitDefault(CONF_OUTPUT_POWER, esp8266=20.0): cv.All(
                 cv.decibel, cv.float_range(min=8.5, max=20.5)
@@ -408,6 +427,15 @@ async def to_code(config):
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_power_save_mode(config[CONF_POWER_SAVE_MODE]))
     cg.add(var.set_fast_connect(config[CONF_FAST_CONNECT]))
+    cg.add(var.set_reuse_dhcp_lease(config[CONF_REUSE_DHCP_LEASE]))
+    if roaming := config.get(CONF_ROAMING):
+        cg.add(
+            var.set_roaming(
+                roaming[CONF_SCAN_INTERVAL].total_milliseconds,
+                roaming[CONF_RSSI_THRESHOLD],
+                roaming[CONF_HYSTERESIS],
+            )
+        )
     cg.add(var.set_passive_scan(config[CONF_PASSIVE_SCAN]))
     if CONF_OUTPUT_POWER in config:
         cg.add(var.set_output_power(config[CONF_OUTPUT_POWER]))
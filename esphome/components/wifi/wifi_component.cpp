@@ -198,6 +198,7 @@ void WiFiComponent::loop() {
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+          this->check_roaming_(now);
         }
         break;
       }
@@ -344,8 +345,29 @@ void WiFiComponent::save_wifi_sta(const std::string &ssid, const std::string &pa
   this->set_sta(sta);
 }
 
+bool WiFiComponent::connect_from_scan_results(const WiFiAP &ap) {
+  if (ap.get_hidden())
+    return false;
+  const WiFiScanResult *best = nullptr;
+  for (const auto &res : this->scan_result_) {
+    if (res.get_is_hidden() || res.get_ssid() != ap.get_ssid())
+      continue;
+    if (best == nullptr || res.get_rssi() > best->get_rssi())
+      best = &res;
+  }
+  if (best == nullptr)
+    return false;
+  WiFiAP connect_params = ap;
+  connect_params.set_bssid(best->get_bssid());
+  connect_params.set_channel(best->get_channel());
+  this->selected_ap_ = connect_params;
+  this->start_connecting(connect_params, false);
+  return true;
+}
+
 void WiFiComponent::start_connecting(const WiFiAP &ap, bool two) {
   ESP_LOGI(TAG, "Connecting to '%s'", ap.get_ssid().c_str());
+  this->connect_started_ = this->associated_at_ = millis();
 #ifdef ESPHOME_LOG_HAS_VERBOSE
   ESP_LOGV(TAG, "Connection Params:");
   ESP_LOGV(TAG, "  SSID: '%s'", ap.get_ssid().c_str());
@@ -687,7 +709,13 @@ void WiFiComponent::check_connecting_finished() {
       return;
     }
 
+    const uint32_t connected_at = millis();
+    this->last_connect_duration_ = connected_at - this->connect_started_;
+    this->last_association_duration_ = this->associated_at_ - this->connect_started_;
+    this->last_dhcp_duration_ = connected_at - this->associated_at_;
     ESP_LOGI(TAG, "Connected");
+    ESP_LOGD(TAG, "Connected in %" PRIu32 " ms (association %" PRIu32 " ms, address %" PRIu32 " ms)",
+             this->last_connect_duration_, this->last_association_duration_, this->last_dhcp_duration_);
     // We won't retry hidden networks unless a reconnect fails more than three times again
     if (this->retry_hidden_ && !this->selected_ap_.get_hidden())
       ESP_LOGW(TAG, "Network '%s' should be marked as hidden", this->selected_ap_.get_ssid().c_str());
@@ -759,7 +787,66 @@ void WiFiComponent::check_connecting_finished() {
   this->retry_connect();
 }
 
+void WiFiComponent::check_roaming_(uint32_t now) {
+  if (this->roam_scan_interval_ == 0)
+    return;
+  if (this->roam_scanning_) {
+    if (this->scan_done_) {
+      this->scan_done_ = false;
+      this->roam_scanning_ = false;
+      this->roam_to_best_ap_();
+    } else if (now - this->last_roam_scan_ > 30000) {
+      ESP_LOGW(TAG, "Roaming scan timeout");
+      this->roam_scanning_ = false;
+    }
+    return;
+  }
+  if (now - this->last_roam_scan_ < this->roam_scan_interval_)
+    return;
+  this->last_roam_scan_ = now;
+  const int8_t rssi = this->wifi_rssi();
+  if (rssi >= this->roam_rssi_threshold_)
+    return;
+  ESP_LOGD(TAG, "Signal weak (%d dB), scanning for a stronger AP", rssi);
+  this->roam_scanning_ = this->wifi_scan_start_(this->passive_scan_);
+}
+
+void WiFiComponent::roam_to_best_ap_() {
+  const int8_t rssi = this->wifi_rssi();
+  const bssid_t current = this->wifi_bssid();
+  const std::string ssid = this->wifi_ssid();
+  const WiFiScanResult *best = nullptr;
+  for (const auto &res : this->scan_result_) {
+    if (res.get_ssid() != ssid || res.get_bssid() == current)
+      continue;
+    if (best == nullptr || res.get_rssi() > best->get_rssi())
+      best = &res;
+  }
+  if (best != nullptr && best->get_rssi() >= rssi + this->roam_hysteresis_) {
+    ESP_LOGI(TAG, "Roaming to " LOG_SECRET("%s") " (%d dB, was %d dB)",
+             format_mac_address_pretty(best->get_bssid().data()).c_str(), best->get_rssi(), rssi);
+    this->roam_count_++;
+    this->selected_ap_.set_bssid(best->get_bssid());
+    this->selected_ap_.set_channel(best->get_channel());
+  } else {
+    best = nullptr;
+  }
+  if (!this->keep_scan_results_) {
+    this->scan_result_.clear();
+    this->scan_result_.shrink_to_fit();
+  }
+  if (best != nullptr)
+    this->start_connecting(this->selected_ap_, false);
+}
+
+void WiFiComponent::on_sta_associated_() { this->associated_at_ = millis(); }
+
 void WiFiComponent::retry_connect() {
+  if (this->using_cached_ip_) {
+    // The cached lease may no longer be valid, use DHCP from now on
+    this->selected_ap_.set_manual_ip({});
+    this->using_cached_ip_ = false;
+  }
   if (this->selected_ap_.get_bssid()) {
     auto bssid = *this->selected_ap_.get_bssid();
     float priority = this->get_sta_priority(bssid);
@@ -839,6 +926,17 @@ bool WiFiComponent::is_esp32_improv_active_() {
 #endif
 }
 
+static uint32_t ip4_to_u32(const network::IPAddress &address) {
+  ip_addr_t addr = address;
+  return IP_IS_V4(&addr) ? ip4_addr_get_u32(ip_2_ip4(&addr)) : 0;
+}
+
+static network::IPAddress ip4_from_u32(uint32_t value) {
+  ip_addr_t addr;
+  ip_addr_set_ip4_u32(&addr, value);
+  return network::IPAddress(&addr);
+}
+
 bool WiFiComponent::load_fast_connect_settings_() {
   SavedWifiFastConnectSettings fast_connect_save{};
 
@@ -849,6 +947,14 @@ bool WiFiComponent::load_fast_connect_settings_() {
     this->selected_ap_ = this->sta_[this->ap_index_];
     this->selected_ap_.set_bssid(bssid);
     this->selected_ap_.set_channel(fast_connect_save.channel);
+    if (this->reuse_dhcp_lease_ && fast_connect_save.ip != 0 && !this->selected_ap_.get_manual_ip().has_value()) {
+      ManualIP lease{ip4_from_u32(fast_connect_save.ip), ip4_from_u32(fast_connect_save.gateway),
+                     ip4_from_u32(fast_connect_save.subnet), ip4_from_u32(fast_connect_save.dns1),
+                     ip4_from_u32(fast_connect_save.dns2)};
+      this->selected_ap_.set_manual_ip(lease);
+      this->using_cached_ip_ = true;
+      ESP_LOGD(TAG, "Reusing DHCP lease %s", lease.static_ip.str().c_str());
+    }
 
     ESP_LOGD(TAG, "Loaded fast_connect settings");
     return true;
@@ -859,19 +965,25 @@ bool WiFiComponent::load_fast_connect_settings_() {
 
 void WiFiComponent::save_fast_connect_settings_() {
   bssid_t bssid = wifi_bssid();
-  uint8_t channel = get_wifi_channel();
-
-  if (bssid != this->selected_ap_.get_bssid() || channel != this->selected_ap_.get_channel()) {
-    SavedWifiFastConnectSettings fast_connect_save{};
-
-    memcpy(fast_connect_save.bssid, bssid.data(), 6);
-    fast_connect_save.channel = channel;
-    fast_connect_save.ap_index = this->ap_index_;
+  SavedWifiFastConnectSettings fast_connect_save{};
+  memcpy(fast_connect_save.bssid, bssid.data(), 6);
+  fast_connect_save.channel = get_wifi_channel();
+  fast_connect_save.ap_index = this->ap_index_;
+  // Only a lease from DHCP is saved, a configured manual IP is used anyway
+  if (this->reuse_dhcp_lease_ && !this->sta_[this->ap_index_].get_manual_ip().has_value()) {
+    fast_connect_save.ip = ip4_to_u32(this->wifi_sta_ip_addresses()[0]);
+    fast_connect_save.gateway = ip4_to_u32(this->wifi_gateway_ip_());
+    fast_connect_save.subnet = ip4_to_u32(this->wifi_subnet_mask_());
+    fast_connect_save.dns1 = ip4_to_u32(this->wifi_dns_ip_(0));
+    fast_connect_save.dns2 = ip4_to_u32(this->wifi_dns_ip_(1));
+  }
 
-    this->fast_connect_pref_.save(&fast_connect_save);
+  SavedWifiFastConnectSettings previous{};
+  if (this->fast_connect_pref_.load(&previous) && memcmp(&previous, &fast_connect_save, sizeof(previous)) == 0)
+    return;
+  this->fast_connect_pref_.save(&fast_connect_save);
 
-    ESP_LOGD(TAG, "Saved fast_connect settings");
-  }
+  ESP_LOGD(TAG, "Saved fast_connect settings");
 }
 
 void WiFiAP::set_ssid(const std::string &ssid) { this->ssid_ = ssid; }
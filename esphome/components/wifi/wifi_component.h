@@ -61,6 +61,12 @@ struct SavedWifiFastConnectSettings {
   uint8_t bssid[6];
   uint8_t channel;
   int8_t ap_index;
+  // Last DHCP lease as IPv4 addresses in network order, ip is 0 if none was saved
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns1;
+  uint32_t dns2;
 } PACKED;  // NOLINT
 
 enum WiFiComponentState : uint8_t {
@@ -241,6 +247,21 @@ class WiFiComponent : public Component {
   void check_scanning_finished();
   void start_connecting(const WiFiAP &ap, bool two);
   void set_fast_connect(bool fast_connect);
+  /// With fast_connect, configure the address of the last DHCP lease statically on the next connect to skip DHCP.
+  void set_reuse_dhcp_lease(bool reuse_dhcp_lease) { this->reuse_dhcp_lease_ = reuse_dhcp_lease; }
+  /** Roam to a stronger AP with the same SSID.
+   *
+   * @param scan_interval Scan at most this often (ms) while connected, 0 disables roaming.
+   * @param rssi_threshold Only scan while the signal is below this (dB), scans take the radio off channel.
+   * @param hysteresis An AP must be this much stronger (dB) than the current one to roam to it.
+   */
+  void set_roaming(uint32_t scan_interval, int8_t rssi_threshold, uint8_t hysteresis) {
+    this->roam_scan_interval_ = scan_interval;
+    this->roam_rssi_threshold_ = rssi_threshold;
+    this->roam_hysteresis_ = hysteresis;
+  }
+  /// Number of times the connection moved to a stronger AP since boot.
+  uint32_t get_roam_count() const { return this->roam_count_; }
   void set_ap_timeout(uint32_t ap_timeout) { ap_timeout_ = ap_timeout; }
 
   void check_connecting_finished();
@@ -253,12 +274,25 @@ class WiFiComponent : public Component {
 
   bool is_connected();
 
+  /// Milliseconds from starting the last successful connection until it had an address.
+  uint32_t get_last_connect_duration() const { return this->last_connect_duration_; }
+  /// Part of the last connection spent on association and authentication, 0 if the platform does not report it.
+  uint32_t get_last_association_duration() const { return this->last_association_duration_; }
+  /// Part of the last connection spent waiting for an address after association.
+  uint32_t get_last_dhcp_duration() const { return this->last_dhcp_duration_; }
+
   void set_power_save_mode(WiFiPowerSaveMode power_save);
   void set_output_power(float output_power) { output_power_ = output_power; }
 
   void set_passive_scan(bool passive);
 
   void save_wifi_sta(const std::string &ssid, const std::string &password);
+  /** Connect to `ap` using the BSSID and channel of the strongest matching AP in the last scan results.
+   *
+   * Lets provisioning skip the new scan (and the driver its own all channel scan) when the network was already seen.
+   * Returns false if the network is hidden or not in the scan results, the caller then has to scan.
+   */
+  bool connect_from_scan_results(const WiFiAP &ap);
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Setup WiFi interface.
@@ -366,6 +400,11 @@ class WiFiComponent : public Component {
 
   bool load_fast_connect_settings_();
   void save_fast_connect_settings_();
+  /// Called by the platforms once the station is associated and authenticated.
+  void on_sta_associated_();
+  /// Starts a background scan when the signal is weak and roams once it is finished.
+  void check_roaming_(uint32_t now);
+  void roam_to_best_ap_();
 
 #ifdef USE_ESP8266
   static void wifi_event_callback(System_Event_t *event);
@@ -419,6 +458,20 @@ class WiFiComponent : public Component {
   // Group all boolean values together
   bool fast_connect_{false};
   bool trying_loaded_ap_{false};
+  bool reuse_dhcp_lease_{false};
+  // The selected AP uses the cached lease as static address
+  bool using_cached_ip_{false};
+  uint32_t connect_started_{0};
+  uint32_t associated_at_{0};
+  uint32_t last_connect_duration_{0};
+  uint32_t last_association_duration_{0};
+  uint32_t last_dhcp_duration_{0};
+  uint32_t roam_scan_interval_{0};
+  uint32_t last_roam_scan_{0};
+  uint32_t roam_count_{0};
+  int8_t roam_rssi_threshold_{-70};
+  uint8_t roam_hysteresis_{8};
+  bool roam_scanning_{false};
   bool retry_hidden_{false};
   bool has_ap_{false};
   bool handled_connected_state_{false};
@@ -499,6 +499,7 @@ void WiFiComponent::wifi_event_callback(System_Event_t *event) {
       ESP_LOGV(TAG, "Connected ssid='%s' bssid=%s channel=%u", buf, format_mac_address_pretty(it.bssid).c_str(),
                it.channel);
       s_sta_connected = true;
+      global_wifi_component->on_sta_associated_();
       break;
     }
     case EVENT_STAMODE_DISCONNECTED: {
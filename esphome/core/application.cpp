@@ -1,4 +1,6 @@
 #include "esphome/core/application.h"
+#include "esphome/core/arena.h"
+#include "esphome/core/controller.h"
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
@@ -12,6 +14,23 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#if (defined(USE_WORKER_LOOP) || defined(USE_PARALLEL_SETUP)) && defined(USE_HOST)
+#include <thread>
+#endif
+
+#if defined(USE_PARALLEL_SETUP) && defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+#if defined(USE_TICKLESS_IDLE) && defined(USE_HOST)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
 #ifdef USE_SOCKET_SELECT_SUPPORT
 #include <cerrno>
 
@@ -34,6 +53,30 @@ namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef USE_TICKLESS_IDLE
+// Longest idle sleep, keeps the watchdog fed even when nothing is scheduled
+static const uint32_t MAX_IDLE_SLEEP_MS = 1000;
+#endif
+
+#if defined(USE_PARALLEL_SETUP) && defined(USE_ESP32)
+static const uint32_t SETUP_IO_STACK_SIZE = 4096;
+#endif
+
+#ifdef USE_WORKER_LOOP
+static const uint32_t WORKER_LOOP_STACK_SIZE = 8192;
+// Set on the worker loop task only
+static thread_local bool in_worker_loop_task = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
+// Whether loop() of the component is called from Application::loop() rather than the worker loop
+static inline bool runs_on_main_loop(Component *component) {
+#ifdef USE_WORKER_LOOP
+  return !component->is_loop_thread_safe();
+#else
+  return true;
+#endif
+}
+
 // Helper function for insertion sort of components by priority
 // Using insertion sort instead of std::stable_sort saves ~1.3KB of flash
 // by avoiding template instantiations (std::rotate, std::stable_sort, lambdas)
@@ -69,6 +112,102 @@ void Application::register_component_(Component *comp) {
   }
   this->components_.push_back(comp);
 }
+// Boot profile of the runtime_stats component: time spent in setup() and waiting for can_proceed() afterwards
+static void record_setup_time(Component *component, uint32_t setup_ms, uint32_t wait_ms) {
+#ifdef USE_RUNTIME_STATS
+  if (global_runtime_stats != nullptr)
+    global_runtime_stats->record_setup_time(component, setup_ms, wait_ms);
+#endif
+}
+
+namespace {
+struct SetupIoRun {
+  Component *component;
+  uint32_t duration_ms;
+
+  void run() {
+    const uint32_t start = millis();
+    this->component->setup_io();
+    this->duration_ms = millis() - start;
+  }
+};
+}  // namespace
+
+uint32_t Application::run_setup_io_(uint32_t start) {
+  // Components of equal setup priority don't depend on each other, see insertion_sort_by_priority in setup()
+  const float priority = this->components_[start]->get_actual_setup_priority();
+  uint32_t end = start + 1;
+  while (end < this->components_.size() && this->components_[end]->get_actual_setup_priority() == priority)
+    end++;
+
+  std::vector<SetupIoRun> runs;
+  for (uint32_t i = start; i < end; i++) {
+    if (this->components_[i]->has_setup_io() && !this->skips_setup_(this->components_[i]))
+      runs.push_back({this->components_[i], 0});
+  }
+  if (runs.empty())
+    return end;
+
+#ifdef USE_PARALLEL_SETUP
+  if (runs.size() > 1) {
+    ESP_LOGV(TAG, "Running setup_io() of %u components in parallel", (unsigned) runs.size());
+#ifdef USE_ESP32
+    SemaphoreHandle_t done = xSemaphoreCreateCounting(runs.size(), 0);
+    struct Task {
+      SetupIoRun *run;
+      SemaphoreHandle_t done;
+    };
+    std::vector<Task> tasks;
+    tasks.reserve(runs.size());
+    auto entry = [](void *arg) {
+      auto *task = static_cast<Task *>(arg);
+      task->run->run();
+      xSemaphoreGive(task->done);
+      vTaskDelete(nullptr);
+    };
+    uint32_t started = 0;
+    for (auto &run : runs) {
+      tasks.push_back({&run, done});
+      if (done != nullptr &&
+          xTaskCreate(entry, "setup_io", SETUP_IO_STACK_SIZE, &tasks.back(), uxTaskPriorityGet(nullptr), nullptr) ==
+              pdPASS) {
+        started++;
+      } else {
+        run.run();
+      }
+    }
+    for (uint32_t i = 0; i < started; i++) {
+      while (xSemaphoreTake(done, pdMS_TO_TICKS(100)) != pdTRUE)
+        this->feed_wdt();
+    }
+    if (done != nullptr)
+      vSemaphoreDelete(done);
+#elif defined(USE_HOST)
+    std::vector<std::thread> threads;
+    threads.reserve(runs.size());
+    for (auto &run : runs)
+      threads.emplace_back([&run]() { run.run(); });
+    for (auto &thread : threads)
+      thread.join();
+#endif
+  } else
+#endif
+  {
+    for (auto &run : runs) {
+      run.run();
+      this->feed_wdt();
+    }
+  }
+
+#ifdef USE_RUNTIME_STATS
+  if (global_runtime_stats != nullptr) {
+    for (const auto &run : runs)
+      global_runtime_stats->record_setup_io_time(run.component, run.duration_ms);
+  }
+#endif
+  return end;
+}
+
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()");
   ESP_LOGV(TAG, "Sorting components by setup priority");
@@ -77,19 +216,42 @@ void Application::setup() {
   insertion_sort_by_priority<decltype(this->components_.begin()), &Component::get_actual_setup_priority>(
       this->components_.begin(), this->components_.end());
 
+#ifdef USE_FAST_WAKE
+  if (this->fast_wake_) {
+    ESP_LOGI(TAG, "Fast wake, setting up %u of %u components", (unsigned) this->wake_essential_.size(),
+             (unsigned) this->components_.size());
+    // Skipped components are left out of looping_components_, nothing can start their loop
+    for (auto *component : this->components_) {
+      if (this->skips_setup_(component))
+        component->set_component_state_(COMPONENT_STATE_NOT_SET_UP);
+    }
+  }
+#endif
   // Initialize looping_components_ early so enable_pending_loops_() works during setup
   this->calculate_looping_components_();
+#ifdef USE_TICKLESS_IDLE
+  this->setup_idle_wake_();
+#endif
 
+  uint32_t io_group_end = 0;
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
+    if (i >= io_group_end)
+      io_group_end = this->run_setup_io_(i);
+    if (this->skips_setup_(component))
+      continue;
 
     // Update loop_component_start_time_ before calling each component during setup
     this->loop_component_start_time_ = millis();
+    const uint32_t setup_start = this->loop_component_start_time_;
     component->call();
+    const uint32_t setup_ms = millis() - setup_start;
     this->scheduler.process_to_add();
     this->feed_wdt();
-    if (component->can_proceed())
+    if (component->can_proceed()) {
+      record_setup_time(component, setup_ms, 0);
       continue;
+    }
 
     // Sort components 0 through i by loop priority
     insertion_sort_by_priority<decltype(this->components_.begin()), &Component::get_loop_priority>(
@@ -115,9 +277,17 @@ void Application::setup() {
       this->app_state_ = new_app_state;
       yield();
     } while (!component->can_proceed());
+    record_setup_time(component, setup_ms, millis() - setup_start - setup_ms);
   }
 
   ESP_LOGI(TAG, "setup() finished successfully!");
+#ifdef USE_RUNTIME_STATS
+  if (global_runtime_stats != nullptr)
+    global_runtime_stats->record_boot_time(millis());
+#endif
+#ifdef USE_WORKER_LOOP
+  this->start_worker_loop_();
+#endif
 
   // Clear setup priority overrides to free memory
   clear_setup_priority_overrides();
@@ -129,6 +299,13 @@ void Application::loop() {
 
   // Get the initial loop time at the start
   uint32_t last_op_end_time = millis();
+#ifdef USE_LOOP_BUDGET
+  const uint32_t loop_start_time = last_op_end_time;
+  // Normal components left for the next iteration, and the position of the first one
+  uint16_t deferred = 0;
+  uint16_t resume_index = 0;
+  bool ran_normal = false;
+#endif
 
   this->before_loop_tasks_(last_op_end_time);
 
@@ -136,6 +313,20 @@ void Application::loop() {
        this->current_loop_index_++) {
     Component *component = this->looping_components_[this->current_loop_index_];
 
+#ifdef USE_LOOP_BUDGET
+    if (component->get_loop_class() == LoopClass::NORMAL) {
+      // Components before the resume point already ran in the previous, cut short, iteration
+      if (this->current_loop_index_ < this->loop_resume_index_)
+        continue;
+      if (ran_normal && last_op_end_time - loop_start_time >= this->loop_budget_) {
+        if (deferred++ == 0)
+          resume_index = this->current_loop_index_;
+        continue;
+      }
+      ran_normal = true;
+    }
+#endif
+
     // Update the cached time before each component runs
     this->loop_component_start_time_ = last_op_end_time;
 
@@ -152,8 +343,21 @@ void Application::loop() {
   }
 
   this->after_loop_tasks_();
+#ifdef USE_WORKER_LOOP
+  new_app_state |= this->worker_app_state_.load(std::memory_order_relaxed);
+#endif
   this->app_state_ = new_app_state;
 
+#ifdef USE_LOOP_BUDGET
+  this->loop_resume_index_ = resume_index;
+#ifdef USE_RUNTIME_STATS
+  const uint32_t loop_time = last_op_end_time - loop_start_time;
+  if (global_runtime_stats != nullptr && (deferred > 0 || loop_time > this->loop_budget_)) {
+    global_runtime_stats->record_loop_budget_overrun(loop_time, deferred);
+  }
+#endif
+#endif
+
 #ifdef USE_RUNTIME_STATS
   // Process any pending runtime stats printing after all components have run
   // This ensures stats printing doesn't affect component timing measurements
@@ -164,10 +368,23 @@ void Application::loop() {
 
   // Use the last component's end time instead of calling millis() again
   auto elapsed = last_op_end_time - this->last_loop_;
-  if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
+  bool run_again = elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency();
+#ifdef USE_LOOP_BUDGET
+  // Components were left out, only give the network stack its turn before resuming
+  run_again |= deferred > 0;
+#endif
+  if (run_again) {
     // Even if we overran the loop interval, we still need to select()
     // to know if any sockets have data ready
     this->yield_with_select_(0);
+#ifdef USE_TICKLESS_IDLE
+  } else if (this->looping_components_active_end_ == 0 && !this->has_pending_enable_loop_requests_ &&
+             this->can_sleep_idle_()) {
+    // No component loops, so nothing needs to run before the next scheduler item is due.
+    // New items and enable_loop_soon_any_context() wake the sleep up early.
+    uint32_t idle_time = this->scheduler.next_schedule_in(last_op_end_time).value_or(MAX_IDLE_SLEEP_MS);
+    this->sleep_idle_(std::min(idle_time, MAX_IDLE_SLEEP_MS));
+#endif
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
     uint32_t next_schedule = this->scheduler.next_schedule_in(last_op_end_time).value_or(delay_time);
@@ -186,9 +403,13 @@ void Application::loop() {
 #ifdef ESPHOME_PROJECT_NAME
       ESP_LOGI(TAG, "Project " ESPHOME_PROJECT_NAME " version " ESPHOME_PROJECT_VERSION);
 #endif
+      ESP_LOGCONFIG(TAG, "Setup arena: %u bytes used of %u in %u blocks", (unsigned) setup_arena.get_used(),
+                    (unsigned) setup_arena.get_reserved(), (unsigned) setup_arena.get_blocks());
     }
 
-    this->components_[this->dump_config_at_]->call_dump_config();
+    Component *component = this->components_[this->dump_config_at_];
+    if (!this->skips_setup_(component))
+      component->call_dump_config();
     this->dump_config_at_++;
   }
 }
@@ -211,7 +432,8 @@ void IRAM_ATTR HOT Application::feed_wdt(uint32_t time) {
 void Application::reboot() {
   ESP_LOGI(TAG, "Forcing a reboot");
   for (auto &component : std::ranges::reverse_view(this->components_)) {
-    component->on_shutdown();
+    if (!this->skips_setup_(component))
+      component->on_shutdown();
   }
   arch_restart();
 }
@@ -225,16 +447,19 @@ void Application::safe_reboot() {
 
 void Application::run_safe_shutdown_hooks() {
   for (auto &component : std::ranges::reverse_view(this->components_)) {
-    component->on_safe_shutdown();
+    if (!this->skips_setup_(component))
+      component->on_safe_shutdown();
   }
   for (auto &component : std::ranges::reverse_view(this->components_)) {
-    component->on_shutdown();
+    if (!this->skips_setup_(component))
+      component->on_shutdown();
   }
 }
 
 void Application::run_powerdown_hooks() {
   for (auto &component : std::ranges::reverse_view(this->components_)) {
-    component->on_powerdown();
+    if (!this->skips_setup_(component))
+      component->on_powerdown();
   }
 }
 
@@ -250,12 +475,14 @@ void Application::teardown_components(uint32_t timeout_ms) {
   // components are torn down in the opposite order of their setup_priority (which is
   // used to sort components during Application::setup())
   size_t num_components = this->components_.size();
+  size_t pending_count = 0;
   for (size_t i = 0; i < num_components; ++i) {
-    pending_components[i] = this->components_[num_components - 1 - i];
+    Component *component = this->components_[num_components - 1 - i];
+    if (!this->skips_setup_(component))
+      pending_components[pending_count++] = component;
   }
 
   uint32_t now = start_time;
-  size_t pending_count = num_components;
 
   // Teardown Algorithm
   // ==================
@@ -335,8 +562,14 @@ void Application::calculate_looping_components_() {
   // Count total components that need looping
   size_t total_looping = 0;
   for (auto *obj : this->components_) {
-    if (obj->has_overridden_loop()) {
+    if (!obj->has_overridden_loop())
+      continue;
+    if (runs_on_main_loop(obj)) {
       total_looping++;
+#ifdef USE_WORKER_LOOP
+    } else {
+      this->worker_components_.push_back(obj);
+#endif
     }
   }
 
@@ -357,8 +590,9 @@ void Application::calculate_looping_components_() {
 
 void Application::add_looping_components_by_state_(bool match_loop_done) {
   for (auto *obj : this->components_) {
-    if (obj->has_overridden_loop() &&
-        ((obj->get_component_state() & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP_DONE) == match_loop_done) {
+    const uint8_t state = obj->get_component_state() & COMPONENT_STATE_MASK;
+    if (obj->has_overridden_loop() && runs_on_main_loop(obj) && state != COMPONENT_STATE_NOT_SET_UP &&
+        (state == COMPONENT_STATE_LOOP_DONE) == match_loop_done) {
       this->looping_components_.push_back(obj);
     }
   }
@@ -366,6 +600,11 @@ void Application::add_looping_components_by_state_(bool match_loop_done) {
 
 void Application::disable_component_loop_(Component *component) {
   // This method must be reentrant - components can disable themselves during their own loop() call
+#ifdef USE_WORKER_LOOP
+  // Worker components are not in looping_components_, which belongs to the main loop
+  if (in_worker_loop_task)
+    return;
+#endif
   // Linear search to find component in active section
   // Most configs have 10-30 looping components (30 is on the high end)
   // O(n) is acceptable here as we optimize for memory, not complexity
@@ -406,6 +645,10 @@ void Application::enable_component_loop_(Component *component) {
   // the component must be in the inactive section (if it exists in looping_components_)
   // Only search the inactive portion for better performance
   // With typical 0-5 inactive components, O(k) is much faster than O(n)
+#ifdef USE_WORKER_LOOP
+  if (in_worker_loop_task)
+    return;
+#endif
   const uint16_t size = this->looping_components_.size();
   for (uint16_t i = this->looping_components_active_end_; i < size; i++) {
     if (this->looping_components_[i] == component) {
@@ -499,6 +742,8 @@ void Application::before_loop_tasks_(uint32_t loop_start_time) {
 void Application::after_loop_tasks_() {
   // Clear the in_loop_ flag to indicate we're done processing components
   this->in_loop_ = false;
+  // State published during this iteration reaches the controllers once per entity
+  Controller::flush_pending_updates();
 }
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
@@ -520,6 +765,7 @@ bool Application::register_socket_fd(int fd) {
 #endif
 
   this->socket_fds_.push_back(fd);
+  this->socket_listeners_.push_back(nullptr);
   this->socket_fds_changed_ = true;
 
   if (fd > this->max_fd_) {
@@ -540,9 +786,12 @@ void Application::unregister_socket_fd(int fd) {
       continue;
 
     // Swap with last element and pop - O(1) removal since order doesn't matter
-    if (i < this->socket_fds_.size() - 1)
+    if (i < this->socket_fds_.size() - 1) {
       this->socket_fds_[i] = this->socket_fds_.back();
+      this->socket_listeners_[i] = this->socket_listeners_.back();
+    }
     this->socket_fds_.pop_back();
+    this->socket_listeners_.pop_back();
     this->socket_fds_changed_ = true;
 
     // Only recalculate max_fd if we removed the current max
@@ -566,6 +815,16 @@ bool Application::is_socket_ready(int fd) const {
 
   return FD_ISSET(fd, &this->read_fds_);
 }
+
+bool Application::set_socket_listener(int fd, Component *component) {
+  for (size_t i = 0; i < this->socket_fds_.size(); i++) {
+    if (this->socket_fds_[i] == fd) {
+      this->socket_listeners_[i] = component;
+      return true;
+    }
+  }
+  return false;
+}
 #endif
 
 void Application::yield_with_select_(uint32_t delay_ms) {
@@ -607,6 +866,13 @@ void Application::yield_with_select_(uint32_t delay_ms) {
       // Actual error - log and fall back to delay
       ESP_LOGW(TAG, "select() failed with errno %d", errno);
       delay(delay_ms);
+    } else if (ret > 0) {
+      // Wake the components that sleep until their socket has data
+      for (size_t i = 0; i < this->socket_fds_.size(); i++) {
+        Component *listener = this->socket_listeners_[i];
+        if (listener != nullptr && FD_ISSET(this->socket_fds_[i], &this->read_fds_))
+          listener->enable_loop_soon_any_context();
+      }
     }
     // When delay_ms is 0, we need to yield since select(0) doesn't yield
     if (delay_ms == 0) {
@@ -622,6 +888,136 @@ void Application::yield_with_select_(uint32_t delay_ms) {
 #endif
 }
 
+#ifdef USE_TICKLESS_IDLE
+void Application::setup_idle_wake_() {
+#ifdef USE_ESP32
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#elif defined(USE_HOST)
+  if (::pipe(this->wake_fds_) != 0) {
+    ESP_LOGW(TAG, "pipe() failed with errno %d, idle sleep disabled", errno);
+    return;
+  }
+  for (int fd : this->wake_fds_)
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // Let the regular select() in yield_with_select_() wake up on it too
+  this->register_socket_fd(this->wake_fds_[0]);
+#endif
+#endif
+}
+
+bool Application::can_sleep_idle_() const {
+#ifdef USE_ESP32
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // lwip_select() cannot be interrupted from an ISR, only sleep when it is not needed
+  return this->loop_task_ != nullptr && this->socket_fds_.empty();
+#else
+  return this->loop_task_ != nullptr;
+#endif
+#elif defined(USE_HOST)
+  return this->wake_fds_[0] >= 0;
+#else
+  return false;
+#endif
+}
+
+void Application::sleep_idle_(uint32_t delay_ms) {
+#ifdef USE_ESP32
+  // Clears the notification, a wakeup from before the sleep makes this return right away
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+#elif defined(USE_HOST)
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  this->yield_with_select_(delay_ms);
+#else
+  fd_set read_fds;
+  FD_ZERO(&read_fds);
+  FD_SET(this->wake_fds_[0], &read_fds);
+  struct timeval tv;
+  tv.tv_sec = delay_ms / 1000;
+  tv.tv_usec = (delay_ms - tv.tv_sec * 1000) * 1000;
+  ::select(this->wake_fds_[0] + 1, &read_fds, nullptr, nullptr, &tv);
+#endif
+  uint8_t buf[16];
+  while (::read(this->wake_fds_[0], buf, sizeof(buf)) > 0) {
+  }
+#endif
+}
+
+void IRAM_ATTR Application::wake_loop_any_context() {
+#ifdef USE_ESP32
+  if (this->loop_task_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+  } else {
+    xTaskNotifyGive(this->loop_task_);
+  }
+#elif defined(USE_HOST)
+  if (this->wake_fds_[1] < 0)
+    return;
+  // A full pipe already holds a wakeup, so a failed write loses nothing
+  const uint8_t wake = 1;
+  (void) ::write(this->wake_fds_[1], &wake, 1);
+#endif
+}
+#endif
+
+#ifdef USE_WORKER_LOOP
+bool Application::in_worker_loop() const { return in_worker_loop_task; }
+
+void Application::start_worker_loop_() {
+  if (this->worker_components_.empty())
+    return;
+#ifdef USE_ESP32
+  auto task = [](void *arg) { static_cast<Application *>(arg)->worker_loop_(); };
+  const UBaseType_t priority = uxTaskPriorityGet(nullptr);
+#if portNUM_PROCESSORS > 1
+  // The core the main loop does not run on
+  const BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+  BaseType_t res = xTaskCreatePinnedToCore(task, "worker_loop", WORKER_LOOP_STACK_SIZE, this, priority, nullptr, core);
+#else
+  const BaseType_t core = 0;
+  BaseType_t res = xTaskCreate(task, "worker_loop", WORKER_LOOP_STACK_SIZE, this, priority, nullptr);
+#endif
+  if (res != pdPASS) {
+    ESP_LOGE(TAG, "Could not start the worker loop");
+    for (Component *component : this->worker_components_)
+      component->mark_failed();
+    return;
+  }
+  ESP_LOGI(TAG, "Worker loop running %u components on core %d", (unsigned) this->worker_components_.size(),
+           (int) core);
+#elif defined(USE_HOST)
+  std::thread([this]() { this->worker_loop_(); }).detach();
+  ESP_LOGI(TAG, "Worker loop running %u components", (unsigned) this->worker_components_.size());
+#endif
+}
+
+void Application::worker_loop_() {
+  in_worker_loop_task = true;
+  while (true) {
+    const uint32_t start = millis();
+    uint8_t app_state = 0;
+    for (Component *component : this->worker_components_) {
+      // enable_loop_soon_any_context() requests are only picked up by the main loop for its own components
+      if (component->pending_enable_loop_) {
+        component->pending_enable_loop_ = false;
+        component->enable_loop();
+      }
+      component->call();
+      app_state |= component->get_component_state();
+    }
+    this->worker_app_state_.store(app_state, std::memory_order_relaxed);
+
+    // Same pacing as the main loop, but always give up the core for a tick so the idle task runs
+    const uint32_t elapsed = millis() - start;
+    delay(elapsed + 1 < this->loop_interval_ ? this->loop_interval_ - elapsed : 1);
+  }
+}
+#endif
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
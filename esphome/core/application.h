@@ -23,6 +23,15 @@
 #include <sys/select.h>
 #endif
 
+#if defined(USE_TICKLESS_IDLE) && defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#ifdef USE_WORKER_LOOP
+#include <atomic>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -111,6 +120,8 @@ class Application {
       if (!friendly_name.empty()) {
         this->friendly_name_ = make_name_with_suffix(friendly_name, ' ', mac_suffix_ptr, mac_address_suffix_len);
       }
+      // Entities without their own name share this object_id, computed here once instead of on every use
+      this->friendly_name_object_id_ = str_sanitize(str_snake_case(this->friendly_name_));
     } else {
       this->name_ = name;
       this->friendly_name_ = friendly_name;
@@ -229,6 +240,19 @@ class Application {
   /// Set up all the registered components. Call this at the end of your setup() function.
   void setup();
 
+#ifdef USE_FAST_WAKE
+  /** Set up only these components, the others are neither set up nor looped, dumped or torn down.
+   *
+   * Used by deep_sleep to publish a few values right after a wake. Must be called before setup().
+   */
+  void set_wake_essential_components(std::vector<Component *> components) {
+    this->wake_essential_ = std::move(components);
+    this->fast_wake_ = true;
+  }
+  /// Whether only the wake essential components were set up.
+  bool is_fast_wake() const { return this->fast_wake_; }
+#endif
+
   /// Make a loop iteration. Call this in your loop() function.
   void loop();
 
@@ -238,6 +262,9 @@ class Application {
   /// Get the friendly name of this Application set by pre_setup().
   const std::string &get_friendly_name() const { return this->friendly_name_; }
 
+  /// Get the sanitized object_id of the friendly name with the MAC suffix, empty when no suffix is added.
+  const std::string &get_friendly_name_object_id() const { return this->friendly_name_object_id_; }
+
   /// Get the area of this Application set by pre_setup().
   const char *get_area() const {
 #ifdef USE_AREAS
@@ -283,6 +310,37 @@ class Application {
 
   uint32_t get_loop_interval() const { return static_cast<uint32_t>(this->loop_interval_); }
 
+#ifdef USE_LOOP_BUDGET
+  /** Set the time budget of one loop() iteration.
+   *
+   * Once the components of an iteration have used up the budget, the remaining LoopClass::NORMAL components are
+   * left for the next iteration, which resumes with the first one that was left out. LoopClass::LATENCY_CRITICAL
+   * components run on every iteration, and at least one normal component runs per iteration so all make progress.
+   *
+   * @param loop_budget The budget in milliseconds, set from `esphome: loop_budget:`.
+   */
+  void set_loop_budget(uint32_t loop_budget) {
+    this->loop_budget_ = std::min(loop_budget, static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()));
+  }
+
+  uint32_t get_loop_budget() const { return static_cast<uint32_t>(this->loop_budget_); }
+#endif
+
+#ifdef USE_TICKLESS_IDLE
+  /** Cut the current idle sleep short so loop() runs again right away.
+   *
+   * With `esphome: tickless_idle:` loop() sleeps until the next scheduler item is due while no component loops.
+   * This is safe to call from any task and, on ESP32, from an ISR. A call made while loop() is still running is not
+   * lost, the next sleep then returns immediately.
+   */
+  void wake_loop_any_context();
+#endif
+
+#ifdef USE_WORKER_LOOP
+  /// Whether the caller runs on the worker loop task, which calls loop() of components with a thread-safe loop().
+  bool in_worker_loop() const;
+#endif
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt(uint32_t time = 0);
@@ -429,6 +487,10 @@ class Application {
   /// Check if there's data available on a socket without blocking
   /// This function is thread-safe for reading, but should be called after select() has run
   bool is_socket_ready(int fd) const;
+  /// Enable the loop of component whenever select() finds the registered fd readable, so that the component can
+  /// disable its loop while it waits for data. nullptr removes the listener.
+  /// @return false if fd is not registered
+  bool set_socket_listener(int fd, Component *component);
 #endif
 
  protected:
@@ -448,18 +510,45 @@ class Application {
   void activate_looping_component_(uint16_t index);
   void before_loop_tasks_(uint32_t loop_start_time);
   void after_loop_tasks_();
+  /// Whether the component is left out of setup(), see set_wake_essential_components()
+  bool skips_setup_(Component *component) const {
+#ifdef USE_FAST_WAKE
+    return this->fast_wake_ && std::find(this->wake_essential_.begin(), this->wake_essential_.end(), component) ==
+                                   this->wake_essential_.end();
+#else
+    return false;
+#endif
+  }
+  /// Run setup_io() of the components sharing the setup priority of components_[start], returns the end of that group
+  uint32_t run_setup_io_(uint32_t start);
 
   void feed_wdt_arch_();
 
   /// Perform a delay while also monitoring socket file descriptors for readiness
   void yield_with_select_(uint32_t delay_ms);
 
+#ifdef USE_WORKER_LOOP
+  void start_worker_loop_();
+  void worker_loop_();
+#endif
+
+#ifdef USE_TICKLESS_IDLE
+  void setup_idle_wake_();
+  /// Whether wake_loop_any_context() can interrupt sleep_idle_() on this platform right now
+  bool can_sleep_idle_() const;
+  /// Sleep up to delay_ms, returning early on socket activity or wake_loop_any_context()
+  void sleep_idle_(uint32_t delay_ms);
+#endif
+
   // === Member variables ordered by size to minimize padding ===
 
   // Pointer-sized members first
   Component *current_component_{nullptr};
   const char *comment_{nullptr};
   const char *compilation_time_{nullptr};
+#if defined(USE_TICKLESS_IDLE) && defined(USE_ESP32)
+  TaskHandle_t loop_task_{nullptr};  // Notified by wake_loop_any_context()
+#endif
 
   // std::vector (3 pointers each: begin, end, capacity)
   // Partitioned vector design for looping components
@@ -479,13 +568,21 @@ class Application {
   //   and active_end_ is incremented
   // - This eliminates branch mispredictions from flag checking in the hot loop
   FixedVector<Component *> looping_components_{};
+#ifdef USE_WORKER_LOOP
+  std::vector<Component *> worker_components_;  // Looping components with a thread-safe loop(), run by the worker
+#endif
 #ifdef USE_SOCKET_SELECT_SUPPORT
-  std::vector<int> socket_fds_;  // Vector of all monitored socket file descriptors
+  std::vector<int> socket_fds_;                // Vector of all monitored socket file descriptors
+  std::vector<Component *> socket_listeners_;  // Component woken per entry of socket_fds_, or nullptr
+#endif
+#ifdef USE_FAST_WAKE
+  std::vector<Component *> wake_essential_;  // The only components set up on a fast wake
 #endif
 
   // std::string members (typically 24-32 bytes each)
   std::string name_;
   std::string friendly_name_;
+  std::string friendly_name_object_id_;
 
   // size_t members
   size_t dump_config_at_{SIZE_MAX};
@@ -497,17 +594,30 @@ class Application {
 #ifdef USE_SOCKET_SELECT_SUPPORT
   int max_fd_{-1};  // Highest file descriptor number for select()
 #endif
+#if defined(USE_TICKLESS_IDLE) && defined(USE_HOST)
+  int wake_fds_[2]{-1, -1};  // Self-pipe, written by wake_loop_any_context() to end the idle select()
+#endif
 
   // 2-byte members (grouped together for alignment)
   uint16_t loop_interval_{16};                 // Loop interval in ms (max 65535ms = 65.5 seconds)
   uint16_t looping_components_active_end_{0};  // Index marking end of active components in looping_components_
   uint16_t current_loop_index_{0};             // For safe reentrant modifications during iteration
+#ifdef USE_LOOP_BUDGET
+  uint16_t loop_budget_{0};        // Time budget of one loop() iteration in ms
+  uint16_t loop_resume_index_{0};  // First normal component left out by the previous iteration
+#endif
 
   // 1-byte members (grouped together to minimize padding)
   uint8_t app_state_{0};
   bool name_add_mac_suffix_;
   bool in_loop_{false};
   volatile bool has_pending_enable_loop_requests_{false};
+#ifdef USE_WORKER_LOOP
+  std::atomic<uint8_t> worker_app_state_{0};  // Combined component state of the last worker loop pass
+#endif
+#ifdef USE_FAST_WAKE
+  bool fast_wake_{false};
+#endif
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
   bool socket_fds_changed_{false};  // Flag to rebuild base_read_fds_ when socket_fds_ changes
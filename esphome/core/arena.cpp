@@ -0,0 +1,35 @@
+#include "arena.h"
+
+namespace esphome {
+
+// Allocations at least this large get a heap block of their own instead of wasting the rest of the current one
+static const size_t ARENA_LARGE_ALLOCATION = Arena::ARENA_BLOCK_SIZE / 4;
+
+void *Arena::allocate(size_t size, size_t alignment) {
+  size_t padding = -reinterpret_cast<uintptr_t>(this->next_) & (alignment - 1);
+  if (this->next_ == nullptr || padding + size > this->remaining_) {
+    if (size >= ARENA_LARGE_ALLOCATION || alignment > alignof(std::max_align_t)) {
+      // Same failure behaviour as the plain new it replaces
+      void *block = alignment > alignof(std::max_align_t) ? ::operator new(size, std::align_val_t(alignment))
+                                                          : ::operator new(size);
+      this->used_ += size;
+      this->reserved_ += size;
+      this->blocks_++;
+      return block;
+    }
+    this->next_ = static_cast<uint8_t *>(::operator new(ARENA_BLOCK_SIZE));
+    this->remaining_ = ARENA_BLOCK_SIZE;
+    this->reserved_ += ARENA_BLOCK_SIZE;
+    this->blocks_++;
+    padding = 0;
+  }
+  void *ptr = this->next_ + padding;
+  this->next_ += padding + size;
+  this->remaining_ -= padding + size;
+  this->used_ += padding + size;
+  return ptr;
+}
+
+Arena setup_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
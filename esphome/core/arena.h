@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace esphome {
+
+/** Bump allocator for objects that live as long as the application.
+ *
+ * The generated setup() code places components, entities, triggers and automations here with
+ * `new (setup_arena) T(...)`. Memory is taken from the heap in blocks of ARENA_BLOCK_SIZE and handed out back to back,
+ * saving the per allocation overhead of the heap and keeping these objects from fragmenting it.
+ * Nothing is ever freed: objects placed in the arena must never be deleted. Not thread-safe, only for use from setup.
+ */
+class Arena {
+ public:
+  /// Size of the heap blocks the arena hands memory out of.
+  static constexpr size_t ARENA_BLOCK_SIZE = 1024;
+
+  constexpr Arena() = default;
+
+  void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /// Bytes handed out, including alignment padding.
+  size_t get_used() const { return this->used_; }
+  /// Bytes taken from the heap.
+  size_t get_reserved() const { return this->reserved_; }
+  /// Number of heap blocks taken.
+  uint16_t get_blocks() const { return this->blocks_; }
+
+ protected:
+  uint8_t *next_{nullptr};
+  size_t remaining_{0};
+  size_t used_{0};
+  size_t reserved_{0};
+  uint16_t blocks_{0};
+};
+
+extern Arena setup_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+inline void *operator new(size_t size, esphome::Arena &arena) { return arena.allocate(size); }
+inline void *operator new(size_t size, std::align_val_t alignment, esphome::Arena &arena) {
+  return arena.allocate(size, static_cast<size_t>(alignment));
+}
+// Only called when a constructor throws, the memory then stays in the arena
+inline void operator delete(void * /*ptr*/, esphome::Arena & /*arena*/) {}
+inline void operator delete(void * /*ptr*/, std::align_val_t /*alignment*/, esphome::Arena & /*arena*/) {}
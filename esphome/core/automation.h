@@ -131,6 +131,12 @@ template<typename... Ts> class Condition {
     return this->check_tuple_(tuple, typename gens<sizeof...(Ts)>::type());
   }
 
+  /** Have callback called whenever the result of check() may have changed.
+   *
+   * @return false if this condition can't tell, check() then has to be polled.
+   */
+  virtual bool add_on_change_callback(std::function<void()> &&callback) { return false; }
+
  protected:
   template<int... S> bool check_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     return this->check(std::get<S>(tuple)...);
@@ -167,6 +173,7 @@ template<typename... Ts> class Trigger {
 };
 
 template<typename... Ts> class ActionList;
+template<typename... Ts> class SequenceAction;
 
 template<typename... Ts> class Action {
  public:
@@ -196,6 +203,7 @@ template<typename... Ts> class Action {
 
  protected:
   friend ActionList<Ts...>;
+  friend SequenceAction<Ts...>;
 
   virtual void play(Ts... x) = 0;
   void play_next_(Ts... x) {
@@ -25,6 +25,14 @@ template<typename... Ts> class AndCondition : public Condition<Ts...> {
     return true;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    for (auto *condition : this->conditions_) {
+      if (!condition->add_on_change_callback(std::function<void()>(callback)))
+        return false;
+    }
+    return true;
+  }
+
  protected:
   FixedVector<Condition<Ts...> *> conditions_;
 };
@@ -41,6 +49,14 @@ template<typename... Ts> class OrCondition : public Condition<Ts...> {
     return false;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    for (auto *condition : this->conditions_) {
+      if (!condition->add_on_change_callback(std::function<void()>(callback)))
+        return false;
+    }
+    return true;
+  }
+
  protected:
   FixedVector<Condition<Ts...> *> conditions_;
 };
@@ -49,6 +65,9 @@ template<typename... Ts> class NotCondition : public Condition<Ts...> {
  public:
   explicit NotCondition(Condition<Ts...> *condition) : condition_(condition) {}
   bool check(Ts... x) override { return !this->condition_->check(x...); }
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    return this->condition_->add_on_change_callback(std::move(callback));
+  }
 
  protected:
   Condition<Ts...> *condition_;
@@ -66,6 +85,14 @@ template<typename... Ts> class XorCondition : public Condition<Ts...> {
     return result == 1;
   }
 
+  bool add_on_change_callback(std::function<void()> &&callback) override {
+    for (auto *condition : this->conditions_) {
+      if (!condition->add_on_change_callback(std::function<void()>(callback)))
+        return false;
+    }
+    return true;
+  }
+
  protected:
   FixedVector<Condition<Ts...> *> conditions_;
 };
@@ -190,6 +217,27 @@ template<typename... Ts> class LambdaAction : public Action<Ts...> {
   std::function<void(Ts...)> f_;
 };
 
+/** Plays actions that finish within play() one after another.
+ *
+ * Generated for straight-line runs of such actions, it saves the chaining through play_complex() and play_next_().
+ */
+template<typename... Ts> class SequenceAction : public Action<Ts...> {
+ public:
+  explicit SequenceAction(std::initializer_list<Action<Ts...> *> actions) : actions_(actions) {}
+
+  void play(Ts... x) override {
+    for (auto *action : this->actions_) {
+      action->play(x...);
+      // An action stopped the automation, like script.stop from a lambda, the chained actions would not run either
+      if (this->num_running_ == 0)
+        return;
+    }
+  }
+
+ protected:
+  FixedVector<Action<Ts...> *> actions_;
+};
+
 template<typename... Ts> class IfAction : public Action<Ts...> {
  public:
   explicit IfAction(Condition<Ts...> *condition) : condition_(condition) {}
@@ -341,14 +389,31 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
       this->set_timeout("timeout", this->timeout_value_.value(x...), f);
     }
 
-    this->loop();
+    // A condition reporting its changes enables the loop through its callback, the others are polled
+    if (!this->notified_)
+      this->enable_loop();
   }
 
-  void loop() override {
+  void setup() override {
+    this->notified_ = this->condition_->add_on_change_callback([this]() {
+      if (this->num_running_ > 0)
+        this->enable_loop();
+    });
+    // Nothing to do while no instance waits, unless one started before setup()
     if (this->num_running_ == 0)
+      this->disable_loop();
+  }
+
+  void loop() override {
+    if (this->num_running_ == 0) {
+      this->disable_loop();
       return;
+    }
 
     if (!this->condition_->check_tuple(this->var_)) {
+      // Checked again on the next change
+      if (this->notified_)
+        this->disable_loop();
       return;
     }
 
@@ -367,6 +432,7 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
  protected:
   Condition<Ts...> *condition_;
   std::tuple<Ts...> var_{};
+  bool notified_{false};
 };
 
 template<typename... Ts> class UpdateComponentAction : public Action<Ts...> {
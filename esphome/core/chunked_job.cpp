@@ -0,0 +1,102 @@
+#include "chunked_job.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace esphome {
+
+static const char *const TAG = "chunked_job";
+
+// The scheduler drops the slices of a failed component, so its jobs are failed from here instead
+static std::vector<ChunkedJob *> running_jobs;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+bool ChunkedJob::start(std::function<ChunkResult()> &&step) {
+  if (this->is_running()) {
+    ESP_LOGW(TAG, "'%s' is already running", this->name_);
+    return false;
+  }
+  if (this->component_->is_failed()) {
+    ESP_LOGW(TAG, "'%s' not started, its component has failed", this->name_);
+    this->state_ = ChunkedJobState::FAILED;
+    this->finish_callback_.call(this->state_);
+    return false;
+  }
+  this->step_ = std::move(step);
+  this->done_ = 0;
+  this->total_ = 0;
+  this->last_progress_ = 0;
+  this->state_ = ChunkedJobState::RUNNING;
+  running_jobs.push_back(this);
+  // An interval of 0 runs once per loop iteration
+  App.scheduler.set_interval(this->component_, this->name_, 0, [this]() { this->run_slice_(); });
+  return true;
+}
+
+void ChunkedJob::cancel() {
+  if (this->is_running())
+    this->finish_(ChunkedJobState::CANCELLED);
+}
+
+void ChunkedJob::fail_jobs_of(Component *component) {
+  // Finish callbacks may start or stop other jobs, so look the list up again after each one
+  while (true) {
+    auto it = std::find_if(running_jobs.begin(), running_jobs.end(),
+                           [component](ChunkedJob *job) { return job->component_ == component; });
+    if (it == running_jobs.end())
+      return;
+    ESP_LOGW(TAG, "'%s' failed with its component", (*it)->name_);
+    (*it)->finish_(ChunkedJobState::FAILED);
+  }
+}
+
+uint8_t ChunkedJob::get_progress() const {
+  if (this->total_ == 0)
+    return 0;
+  if (this->done_ >= this->total_)
+    return 100;
+  return static_cast<uint8_t>(uint64_t(this->done_) * 100 / this->total_);
+}
+
+void ChunkedJob::run_slice_() {
+  const uint32_t start = millis();
+  ChunkResult result;
+  this->in_slice_ = true;
+  do {
+    result = this->step_();
+    App.feed_wdt();
+    // The step may have cancelled the job
+  } while (result == ChunkResult::CONTINUE && this->is_running() && millis() - start < this->slice_time_);
+  this->in_slice_ = false;
+
+  if (!this->is_running()) {
+    this->step_ = nullptr;
+    return;
+  }
+
+  uint8_t progress = result == ChunkResult::DONE ? 100 : this->get_progress();
+  if (progress != this->last_progress_) {
+    this->last_progress_ = progress;
+    this->progress_callback_.call(progress);
+  }
+
+  if (result == ChunkResult::DONE) {
+    this->finish_(ChunkedJobState::DONE);
+  } else if (result == ChunkResult::FAILED) {
+    this->finish_(ChunkedJobState::FAILED);
+  }
+}
+
+void ChunkedJob::finish_(ChunkedJobState state) {
+  App.scheduler.cancel_interval(this->component_, this->name_);
+  running_jobs.erase(std::find(running_jobs.begin(), running_jobs.end(), this));
+  this->state_ = state;
+  // Release whatever the step captured, unless it is still executing and cancelled itself
+  if (!this->in_slice_)
+    this->step_ = nullptr;
+  this->finish_callback_.call(state);
+}
+
+}  // namespace esphome
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+class Component;
+
+/// Returned by the step function of a ChunkedJob.
+enum class ChunkResult : uint8_t {
+  CONTINUE,  ///< More work left, call the step again.
+  DONE,      ///< The job finished successfully.
+  FAILED,    ///< The job failed and must not be resumed.
+};
+
+enum class ChunkedJobState : uint8_t { IDLE, RUNNING, DONE, FAILED, CANCELLED };
+
+/** Runs a long operation, like a flash transfer or a display refresh, in time bounded slices across loop iterations.
+ *
+ * The work is split into steps by the owner: every call of the step function does a short, bounded piece of it (e.g.
+ * writes one block) and reports whether more is left. Once per loop iteration the job calls the step repeatedly until
+ * the slice time is used up, feeding the watchdog in between, then hands control back so the network stack and the
+ * other components keep running. The slices are run by the scheduler of the owning component, so no bespoke state
+ * machine in loop() is needed; when the component is marked failed its running jobs finish as FAILED.
+ *
+ * The step reports progress with set_progress(), on_progress callbacks get the percentage at most once per slice.
+ * Only use from the main loop task.
+ */
+class ChunkedJob {
+ public:
+  /// Default time the job may keep the loop busy per iteration.
+  static constexpr uint32_t DEFAULT_SLICE_MS = 20;
+
+  /// @param name Scheduler name of the slices, must stay valid for the lifetime of the job (e.g. a string literal).
+  ChunkedJob(Component *component, const char *name) : component_(component), name_(name) {}
+
+  /// Time in milliseconds each slice may take. A single step always runs to completion, even when it exceeds it.
+  void set_slice_time(uint32_t slice_time) { this->slice_time_ = slice_time; }
+
+  /** Start the job, the first slice runs in the next loop iteration.
+   *
+   * @return false if the job is already running, or finished right away as FAILED because the component has failed.
+   */
+  bool start(std::function<ChunkResult()> &&step);
+  /// Stop a running job. May be called from the step, no further step runs after it returns.
+  void cancel();
+
+  /// Report progress from the step, `total` of 0 means unknown.
+  void set_progress(uint32_t done, uint32_t total) {
+    this->done_ = done;
+    this->total_ = total;
+  }
+  /// Progress in percent, 0 while the total is unknown.
+  uint8_t get_progress() const;
+
+  ChunkedJobState get_state() const { return this->state_; }
+  bool is_running() const { return this->state_ == ChunkedJobState::RUNNING; }
+
+  void add_on_progress_callback(std::function<void(uint8_t)> &&callback) {
+    this->progress_callback_.add(std::move(callback));
+  }
+  /// Called once the job ends with DONE, FAILED or CANCELLED.
+  void add_on_finish_callback(std::function<void(ChunkedJobState)> &&callback) {
+    this->finish_callback_.add(std::move(callback));
+  }
+
+  /// Finish the running jobs of a component as FAILED, called by Component::mark_failed().
+  static void fail_jobs_of(Component *component);
+
+ protected:
+  void run_slice_();
+  void finish_(ChunkedJobState state);
+
+  Component *component_;
+  const char *name_;
+  std::function<ChunkResult()> step_;
+  CallbackManager<void(uint8_t)> progress_callback_;
+  CallbackManager<void(ChunkedJobState)> finish_callback_;
+  uint32_t slice_time_{DEFAULT_SLICE_MS};
+  uint32_t done_{0};
+  uint32_t total_{0};
+  ChunkedJobState state_{ChunkedJobState::IDLE};
+  uint8_t last_progress_{0};
+  bool in_slice_{false};
+};
+
+}  // namespace esphome
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 #include "esphome/core/application.h"
+#include "esphome/core/chunked_job.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -69,13 +70,14 @@ const float LATE = -100.0f;
 
 }  // namespace setup_priority
 
-// Component state uses bits 0-2 (8 states, 5 used)
+// Component state uses bits 0-2 (8 states, 6 used)
 const uint8_t COMPONENT_STATE_MASK = 0x07;
 const uint8_t COMPONENT_STATE_CONSTRUCTION = 0x00;
 const uint8_t COMPONENT_STATE_SETUP = 0x01;
 const uint8_t COMPONENT_STATE_LOOP = 0x02;
 const uint8_t COMPONENT_STATE_FAILED = 0x03;
 const uint8_t COMPONENT_STATE_LOOP_DONE = 0x04;
+const uint8_t COMPONENT_STATE_NOT_SET_UP = 0x05;
 // Status LED uses bits 3-4
 const uint8_t STATUS_LED_MASK = 0x18;
 const uint8_t STATUS_LED_OK = 0x00;
@@ -89,6 +91,12 @@ uint32_t global_state = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-v
 
 float Component::get_loop_priority() const { return 0.0f; }
 
+LoopClass Component::get_loop_class() const { return LoopClass::NORMAL; }
+
+bool Component::is_loop_thread_safe() const { return false; }
+bool Component::has_setup_io() const { return false; }
+void Component::setup_io() {}
+
 float Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void Component::setup() {}
@@ -187,6 +195,8 @@ void Component::call() {
       // State failed: Do nothing
     case COMPONENT_STATE_LOOP_DONE:
       // State loop done: Do nothing, component has finished its work
+    case COMPONENT_STATE_NOT_SET_UP:
+      // State not set up: Do nothing, setup() was skipped for this boot
     default:
       break;
   }
@@ -213,13 +223,15 @@ void Component::mark_failed() {
   this->status_set_error();
   // Also remove from loop since failed components shouldn't loop
   App.disable_component_loop_(this);
+  ChunkedJob::fail_jobs_of(this);
 }
 void Component::set_component_state_(uint8_t state) {
   this->component_state_ &= ~COMPONENT_STATE_MASK;
   this->component_state_ |= state;
 }
 void Component::disable_loop() {
-  if ((this->component_state_ & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE) {
+  const uint8_t state = this->component_state_ & COMPONENT_STATE_MASK;
+  if (state != COMPONENT_STATE_LOOP_DONE && state != COMPONENT_STATE_NOT_SET_UP) {
     ESP_LOGVV(TAG, "%s loop disabled", LOG_STR_ARG(this->get_component_log_str()));
     this->set_component_state_(COMPONENT_STATE_LOOP_DONE);
     App.disable_component_loop_(this);
@@ -236,7 +248,7 @@ void IRAM_ATTR HOT Component::enable_loop_soon_any_context() {
   // This method is thread and ISR-safe because:
   // 1. Only performs simple assignments to volatile variables (atomic on all platforms)
   // 2. No read-modify-write operations that could be interrupted
-  // 3. No memory allocation, object construction, or function calls
+  // 3. No memory allocation, object construction, or function calls (other than the ISR-safe loop wakeup)
   // 4. IRAM_ATTR ensures code is in IRAM, not flash (required for ISR execution)
   // 5. Components are never destroyed, so no use-after-free concerns
   // 6. App is guaranteed to be initialized before any ISR could fire
@@ -244,6 +256,9 @@ void IRAM_ATTR HOT Component::enable_loop_soon_any_context() {
   // 8. Race condition with main loop is handled by clearing flag before processing
   this->pending_enable_loop_ = true;
   App.has_pending_enable_loop_requests_ = true;
+#ifdef USE_TICKLESS_IDLE
+  App.wake_loop_any_context();
+#endif
 }
 void Component::reset_to_construction_state() {
   if ((this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED) {
@@ -430,9 +445,21 @@ void PollingComponent::stop_poller() {
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
-WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t start_time)
-    : started_(start_time), component_(component) {}
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t start_time,
+                                                           const char *callback_name)
+    : started_(start_time),
+      component_(component),
+      callback_name_(callback_name)
+#ifdef USE_RUNTIME_STATS_PROFILER
+      ,
+      started_us_(micros())
+#endif
+{
+}
 uint32_t WarnIfComponentBlockingGuard::finish() {
+#ifdef USE_RUNTIME_STATS_PROFILER
+  const uint32_t duration_us = micros() - this->started_us_;
+#endif
   uint32_t curr_time = millis();
 
   uint32_t blocking_time = curr_time - this->started_;
@@ -441,6 +468,9 @@ uint32_t WarnIfComponentBlockingGuard::finish() {
   // Record component runtime stats
   if (global_runtime_stats != nullptr) {
     global_runtime_stats->record_component_time(this->component_, blocking_time, curr_time);
+#ifdef USE_RUNTIME_STATS_PROFILER
+    global_runtime_stats->record_component_us(this->component_, this->callback_name_, duration_us);
+#endif
   }
 #endif
   bool should_warn;
@@ -450,9 +480,15 @@ uint32_t WarnIfComponentBlockingGuard::finish() {
     should_warn = blocking_time > WARN_IF_BLOCKING_OVER_MS;
   }
   if (should_warn) {
-    ESP_LOGW(TAG, "%s took a long time for an operation (%" PRIu32 " ms)",
-             component_ == nullptr ? LOG_STR_LITERAL("<null>") : LOG_STR_ARG(component_->get_component_log_str()),
-             blocking_time);
+    const char *source =
+        component_ == nullptr ? LOG_STR_LITERAL("<null>") : LOG_STR_ARG(component_->get_component_log_str());
+    if (this->callback_name_ != nullptr) {
+      // Name the scheduler callback, a component can run many of them
+      ESP_LOGW(TAG, "%s took a long time in callback '%s' (%" PRIu32 " ms)", source, this->callback_name_,
+               blocking_time);
+    } else {
+      ESP_LOGW(TAG, "%s took a long time for an operation (%" PRIu32 " ms)", source, blocking_time);
+    }
     ESP_LOGW(TAG, "Components should block for at most 30 ms");
   }
 
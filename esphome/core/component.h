@@ -62,6 +62,8 @@ extern const uint8_t COMPONENT_STATE_SETUP;
 extern const uint8_t COMPONENT_STATE_LOOP;
 extern const uint8_t COMPONENT_STATE_FAILED;
 extern const uint8_t COMPONENT_STATE_LOOP_DONE;
+/// Left out of setup() for this boot, e.g. on a fast wake. Not ready, and enable_loop() has no effect.
+extern const uint8_t COMPONENT_STATE_NOT_SET_UP;
 extern const uint8_t STATUS_LED_MASK;
 extern const uint8_t STATUS_LED_OK;
 extern const uint8_t STATUS_LED_WARNING;
@@ -69,6 +71,14 @@ extern const uint8_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+/// How loop() is scheduled when the application runs with a loop time budget (`esphome: loop_budget:`).
+enum class LoopClass : uint8_t {
+  /// Once the budget of an iteration is spent, the rest of these components run on the next iteration
+  NORMAL,
+  /// Runs on every iteration regardless of the budget, for components whose buffers or peers can't wait
+  LATENCY_CRITICAL,
+};
+
 extern const uint16_t WARN_IF_BLOCKING_OVER_MS;
 
 class Component {
@@ -109,6 +119,38 @@ class Component {
    */
   virtual float get_loop_priority() const;
 
+  /** Scheduling class of loop() under a loop time budget.
+   *
+   * Defaults to LoopClass::NORMAL.
+   *
+   * @return The loop class of this component
+   */
+  virtual LoopClass get_loop_class() const;
+
+  /** Whether loop() may run on the worker loop task (`esphome: worker_loop:`), on the second core of dual-core ESP32.
+   *
+   * Only return true if loop() is safe to run concurrently with the main loop: anything it shares with scheduler
+   * callbacks, automations or other components must be protected by the component itself. Controller notifications
+   * for entities it publishes are handed to the main loop. Defaults to false.
+   *
+   * @return Whether loop() is thread-safe
+   */
+  virtual bool is_loop_thread_safe() const;
+
+  /** Whether this component implements setup_io(). Defaults to false.
+   *
+   * @return Whether setup_io() has work to do
+   */
+  virtual bool has_setup_io() const;
+
+  /** Blocking hardware bring-up that runs right before setup(), such as waiting for a reader to come out of reset.
+   *
+   * With `esphome: parallel_setup:` the setup_io() of all components sharing a setup priority run at the same time,
+   * each in a task of its own. It may therefore only touch the component's own state and its own device: no
+   * scheduler, no mark_failed(), no publishing. Record the outcome and act on it in setup().
+   */
+  virtual void setup_io();
+
   void call();
 
   virtual void on_shutdown() {}
@@ -467,7 +509,8 @@ class PollingComponent : public Component {
 
 class WarnIfComponentBlockingGuard {
  public:
-  WarnIfComponentBlockingGuard(Component *component, uint32_t start_time);
+  /// @param callback_name Name of the scheduler callback being timed, nullptr for a loop() call.
+  WarnIfComponentBlockingGuard(Component *component, uint32_t start_time, const char *callback_name = nullptr);
 
   // Finish the timing operation and return the current time
   uint32_t finish();
@@ -477,6 +520,10 @@ class WarnIfComponentBlockingGuard {
  protected:
   uint32_t started_;
   Component *component_;
+  const char *callback_name_;
+#ifdef USE_RUNTIME_STATS_PROFILER
+  uint32_t started_us_;
+#endif
 };
 
 // Function to clear setup priority overrides after all components are set up
@@ -23,163 +23,190 @@ void ComponentIterator::advance_platform_() {
 }
 
 void ComponentIterator::advance() {
-  switch (this->state_) {
-    case IteratorState::NONE:
-      // not started
-      return;
-    case IteratorState::BEGIN:
-      if (this->on_begin()) {
-        advance_platform_();
-      }
-      break;
+  // Each call hands at most one entity to its callback; entity types without visible entities are passed in the same
+  // call instead of taking a call each
+  for (;;) {
+    switch (this->state_) {
+      case IteratorState::NONE:
+        // not started
+        return;
+      case IteratorState::BEGIN:
+        if (this->on_begin()) {
+          advance_platform_();
+        }
+        return;
 
 #ifdef USE_BINARY_SENSOR
-    case IteratorState::BINARY_SENSOR:
-      this->process_platform_item_(App.get_binary_sensors(), &ComponentIterator::on_binary_sensor);
-      break;
+      case IteratorState::BINARY_SENSOR:
+        if (this->process_platform_item_(App.get_binary_sensors(), &ComponentIterator::on_binary_sensor))
+          return;
+        break;
 #endif
 
 #ifdef USE_COVER
-    case IteratorState::COVER:
-      this->process_platform_item_(App.get_covers(), &ComponentIterator::on_cover);
-      break;
+      case IteratorState::COVER:
+        if (this->process_platform_item_(App.get_covers(), &ComponentIterator::on_cover))
+          return;
+        break;
 #endif
 
 #ifdef USE_FAN
-    case IteratorState::FAN:
-      this->process_platform_item_(App.get_fans(), &ComponentIterator::on_fan);
-      break;
+      case IteratorState::FAN:
+        if (this->process_platform_item_(App.get_fans(), &ComponentIterator::on_fan))
+          return;
+        break;
 #endif
 
 #ifdef USE_LIGHT
-    case IteratorState::LIGHT:
-      this->process_platform_item_(App.get_lights(), &ComponentIterator::on_light);
-      break;
+      case IteratorState::LIGHT:
+        if (this->process_platform_item_(App.get_lights(), &ComponentIterator::on_light))
+          return;
+        break;
 #endif
 
 #ifdef USE_SENSOR
-    case IteratorState::SENSOR:
-      this->process_platform_item_(App.get_sensors(), &ComponentIterator::on_sensor);
-      break;
+      case IteratorState::SENSOR:
+        if (this->process_platform_item_(App.get_sensors(), &ComponentIterator::on_sensor))
+          return;
+        break;
 #endif
 
 #ifdef USE_SWITCH
-    case IteratorState::SWITCH:
-      this->process_platform_item_(App.get_switches(), &ComponentIterator::on_switch);
-      break;
+      case IteratorState::SWITCH:
+        if (this->process_platform_item_(App.get_switches(), &ComponentIterator::on_switch))
+          return;
+        break;
 #endif
 
 #ifdef USE_BUTTON
-    case IteratorState::BUTTON:
-      this->process_platform_item_(App.get_buttons(), &ComponentIterator::on_button);
-      break;
+      case IteratorState::BUTTON:
+        if (this->process_platform_item_(App.get_buttons(), &ComponentIterator::on_button))
+          return;
+        break;
 #endif
 
 #ifdef USE_TEXT_SENSOR
-    case IteratorState::TEXT_SENSOR:
-      this->process_platform_item_(App.get_text_sensors(), &ComponentIterator::on_text_sensor);
-      break;
+      case IteratorState::TEXT_SENSOR:
+        if (this->process_platform_item_(App.get_text_sensors(), &ComponentIterator::on_text_sensor))
+          return;
+        break;
 #endif
 
 #ifdef USE_API_SERVICES
-    case IteratorState::SERVICE:
-      this->process_platform_item_(api::global_api_server->get_user_services(), &ComponentIterator::on_service);
-      break;
+      case IteratorState::SERVICE:
+        if (this->process_platform_item_(api::global_api_server->get_user_services(), &ComponentIterator::on_service))
+          return;
+        break;
 #endif
 
 #ifdef USE_CAMERA
-    case IteratorState::CAMERA: {
-      camera::Camera *camera_instance = camera::Camera::instance();
-      if (camera_instance != nullptr && (!camera_instance->is_internal() || this->include_internal_)) {
-        this->on_camera(camera_instance);
-      }
-      advance_platform_();
-    } break;
+      case IteratorState::CAMERA: {
+        camera::Camera *camera_instance = camera::Camera::instance();
+        advance_platform_();
+        if (camera_instance != nullptr && (!camera_instance->is_internal() || this->include_internal_)) {
+          this->on_camera(camera_instance);
+          return;
+        }
+      } break;
 #endif
 
 #ifdef USE_CLIMATE
-    case IteratorState::CLIMATE:
-      this->process_platform_item_(App.get_climates(), &ComponentIterator::on_climate);
-      break;
+      case IteratorState::CLIMATE:
+        if (this->process_platform_item_(App.get_climates(), &ComponentIterator::on_climate))
+          return;
+        break;
 #endif
 
 #ifdef USE_NUMBER
-    case IteratorState::NUMBER:
-      this->process_platform_item_(App.get_numbers(), &ComponentIterator::on_number);
-      break;
+      case IteratorState::NUMBER:
+        if (this->process_platform_item_(App.get_numbers(), &ComponentIterator::on_number))
+          return;
+        break;
 #endif
 
 #ifdef USE_DATETIME_DATE
-    case IteratorState::DATETIME_DATE:
-      this->process_platform_item_(App.get_dates(), &ComponentIterator::on_date);
-      break;
+      case IteratorState::DATETIME_DATE:
+        if (this->process_platform_item_(App.get_dates(), &ComponentIterator::on_date))
+          return;
+        break;
 #endif
 
 #ifdef USE_DATETIME_TIME
-    case IteratorState::DATETIME_TIME:
-      this->process_platform_item_(App.get_times(), &ComponentIterator::on_time);
-      break;
+      case IteratorState::DATETIME_TIME:
+        if (this->process_platform_item_(App.get_times(), &ComponentIterator::on_time))
+          return;
+        break;
 #endif
 
 #ifdef USE_DATETIME_DATETIME
-    case IteratorState::DATETIME_DATETIME:
-      this->process_platform_item_(App.get_datetimes(), &ComponentIterator::on_datetime);
-      break;
+      case IteratorState::DATETIME_DATETIME:
+        if (this->process_platform_item_(App.get_datetimes(), &ComponentIterator::on_datetime))
+          return;
+        break;
 #endif
 
 #ifdef USE_TEXT
-    case IteratorState::TEXT:
-      this->process_platform_item_(App.get_texts(), &ComponentIterator::on_text);
-      break;
+      case IteratorState::TEXT:
+        if (this->process_platform_item_(App.get_texts(), &ComponentIterator::on_text))
+          return;
+        break;
 #endif
 
 #ifdef USE_SELECT
-    case IteratorState::SELECT:
-      this->process_platform_item_(App.get_selects(), &ComponentIterator::on_select);
-      break;
+      case IteratorState::SELECT:
+        if (this->process_platform_item_(App.get_selects(), &ComponentIterator::on_select))
+          return;
+        break;
 #endif
 
 #ifdef USE_LOCK
-    case IteratorState::LOCK:
-      this->process_platform_item_(App.get_locks(), &ComponentIterator::on_lock);
-      break;
+      case IteratorState::LOCK:
+        if (this->process_platform_item_(App.get_locks(), &ComponentIterator::on_lock))
+          return;
+        break;
 #endif
 
 #ifdef USE_VALVE
-    case IteratorState::VALVE:
-      this->process_platform_item_(App.get_valves(), &ComponentIterator::on_valve);
-      break;
+      case IteratorState::VALVE:
+        if (this->process_platform_item_(App.get_valves(), &ComponentIterator::on_valve))
+          return;
+        break;
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-    case IteratorState::MEDIA_PLAYER:
-      this->process_platform_item_(App.get_media_players(), &ComponentIterator::on_media_player);
-      break;
+      case IteratorState::MEDIA_PLAYER:
+        if (this->process_platform_item_(App.get_media_players(), &ComponentIterator::on_media_player))
+          return;
+        break;
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
-    case IteratorState::ALARM_CONTROL_PANEL:
-      this->process_platform_item_(App.get_alarm_control_panels(), &ComponentIterator::on_alarm_control_panel);
-      break;
+      case IteratorState::ALARM_CONTROL_PANEL:
+        if (this->process_platform_item_(App.get_alarm_control_panels(), &ComponentIterator::on_alarm_control_panel))
+          return;
+        break;
 #endif
 
 #ifdef USE_EVENT
-    case IteratorState::EVENT:
-      this->process_platform_item_(App.get_events(), &ComponentIterator::on_event);
-      break;
+      case IteratorState::EVENT:
+        if (this->process_platform_item_(App.get_events(), &ComponentIterator::on_event))
+          return;
+        break;
 #endif
 
 #ifdef USE_UPDATE
-    case IteratorState::UPDATE:
-      this->process_platform_item_(App.get_updates(), &ComponentIterator::on_update);
-      break;
-#endif
-
-    case IteratorState::MAX:
-      if (this->on_end()) {
-        this->state_ = IteratorState::NONE;
-      }
-      return;
+      case IteratorState::UPDATE:
+        if (this->process_platform_item_(App.get_updates(), &ComponentIterator::on_update))
+          return;
+        break;
+#endif
+
+      case IteratorState::MAX:
+        if (this->on_end()) {
+          this->state_ = IteratorState::NONE;
+        }
+        return;
+    }
   }
 }
 
@@ -173,17 +173,23 @@ class ComponentIterator {
   IteratorState state_{IteratorState::NONE};
   bool include_internal_{false};
 
+  /// @return true if an entity was handed to its callback, false if all entities of the type are done.
   template<typename Container>
-  void process_platform_item_(const Container &items,
+  bool process_platform_item_(const Container &items,
                               bool (ComponentIterator::*on_item)(typename Container::value_type)) {
-    if (this->at_ >= items.size()) {
-      this->advance_platform_();
-    } else {
+    while (this->at_ < items.size()) {
       typename Container::value_type item = items[this->at_];
-      if ((item->is_internal() && !this->include_internal_) || (this->*on_item)(item)) {
+      if (item->is_internal() && !this->include_internal_) {
+        this->at_++;  // skipped without spending an advance() call on it
+        continue;
+      }
+      if ((this->*on_item)(item)) {
         this->at_++;
       }
+      return true;
     }
+    this->advance_platform_();
+    return false;
   }
 
   void advance_platform_();
@@ -67,6 +67,13 @@ Area = cg.esphome_ns.class_("Area")
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
 
+CONF_SCHEDULER_BACKEND = "scheduler_backend"
+CONF_LOOP_BUDGET = "loop_budget"
+CONF_TICKLESS_IDLE = "tickless_idle"
+CONF_WORKER_LOOP = "worker_loop"
+CONF_PARALLEL_SETUP = "parallel_setup"
+SCHEDULER_BACKENDS = ["heap", "timer_wheel"]
+
 
 def validate_hostname(config):
     max_length = 31
@@ -136,6 +143,18 @@ def validate_ids_and_references(config: ConfigType) -> ConfigType:
     return config
 
 
+def threaded_option(name: str):
+    """Boolean option that needs a second task, only available on ESP32 and host."""
+
+    def validator(value: bool) -> bool:
+        value = cv.boolean(value)
+        if value and not (CORE.is_esp32 or CORE.is_host):
+            raise cv.Invalid(f"{name} is only available on ESP32 and host")
+        return value
+
+    return validator
+
+
 def valid_include(value: str) -> str:
     # Look for "<...>" includes
     if value.startswith("<") and value.endswith(">"):
@@ -230,6 +249,23 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
             cv.Optional(CONF_DEBUG_SCHEDULER, default=False): cv.boolean,
+            cv.Optional(CONF_SCHEDULER_BACKEND, default="heap"): cv.one_of(
+                *SCHEDULER_BACKENDS, lower=True
+            ),
+            cv.Optional(CONF_LOOP_BUDGET): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(
+                    min=cv.TimePeriod(milliseconds=1),
+                    max=cv.TimePeriod(milliseconds=65535),
+                ),
+            ),
+            cv.Optional(CONF_TICKLESS_IDLE, default=False): cv.boolean,
+            cv.Optional(CONF_WORKER_LOOP, default=False): threaded_option(
+                CONF_WORKER_LOOP
+            ),
+            cv.Optional(CONF_PARALLEL_SETUP, default=False): threaded_option(
+                CONF_PARALLEL_SETUP
+            ),
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -489,6 +525,17 @@ async def to_code(config: ConfigType) -> None:
     cg.add_build_flag("-Wno-sign-compare")
     if config[CONF_DEBUG_SCHEDULER]:
         cg.add_define("ESPHOME_DEBUG_SCHEDULER")
+    if config[CONF_SCHEDULER_BACKEND] == "timer_wheel":
+        cg.add_define("USE_SCHEDULER_TIMER_WHEEL")
+    if CONF_LOOP_BUDGET in config:
+        cg.add_define("USE_LOOP_BUDGET")
+        cg.add(cg.App.set_loop_budget(config[CONF_LOOP_BUDGET]))
+    if config[CONF_TICKLESS_IDLE]:
+        cg.add_define("USE_TICKLESS_IDLE")
+    if config[CONF_WORKER_LOOP]:
+        cg.add_define("USE_WORKER_LOOP")
+    if config[CONF_PARALLEL_SETUP]:
+        cg.add_define("USE_PARALLEL_SETUP")
 
     if CORE.using_arduino and not CORE.is_bk72xx:
         CORE.add_job(add_arduino_global_workaround)
@@ -2,132 +2,363 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#include <vector>
+
 namespace esphome {
 
-void Controller::setup_controller(bool include_internal) {
-#ifdef USE_BINARY_SENSOR
-  for (auto *obj : App.get_binary_sensors()) {
-    if (include_internal || !obj->is_internal()) {
-      obj->add_full_state_callback(
-          [this, obj](optional<bool> previous, optional<bool> state) { this->on_binary_sensor_update(obj); });
+namespace {
+
+/// Entities of one type whose state changed since the last flush, one bit per position in the App list of that type.
+class DirtyEntities {
+ public:
+  void init(size_t count) {
+    const size_t words = (count + 31) / 32;
+    this->words_.init(words);
+    for (size_t i = 0; i < words; i++)
+      this->words_.push_back(0);
+  }
+  void mark(size_t index) {
+    this->words_[index / 32] |= 1u << (index % 32);
+    this->pending_ = true;
+  }
+  /// Clears the set before calling fn for each entity, a change published from fn is picked up by the next flush.
+  template<typename F> void drain(F &&fn) {
+    if (!this->pending_)
+      return;
+    this->pending_ = false;
+    for (size_t w = 0; w < this->words_.size(); w++) {
+      uint32_t bits = this->words_[w];
+      this->words_[w] = 0;
+      while (bits != 0) {
+        const uint32_t bit = __builtin_ctz(bits);
+        bits &= bits - 1;
+        fn(w * 32 + bit);
+      }
     }
   }
-#endif
+
+ protected:
+  FixedVector<uint32_t> words_;
+  bool pending_{false};
+};
+
+struct RegisteredController {
+  Controller *controller;
+  bool include_internal;
+};
+
+std::vector<RegisteredController> controllers;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Set by every mark, so the flush of a loop without state changes is a single check
+bool any_pending = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Internal entities are only subscribed once a controller asks for them
+bool internal_subscribed = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 #ifdef USE_FAN
-  for (auto *obj : App.get_fans()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_fan_update(obj); });
-  }
+DirtyEntities fans_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #endif
 #ifdef USE_LIGHT
-  for (auto *obj : App.get_lights()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_new_remote_values_callback([this, obj]() { this->on_light_update(obj); });
-  }
+DirtyEntities lights_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #endif
 #ifdef USE_SENSOR
-  for (auto *obj : App.get_sensors()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](float state) { this->on_sensor_update(obj, state); });
+DirtyEntities sensors_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_COVER
+DirtyEntities covers_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_CLIMATE
+DirtyEntities climates_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_NUMBER
+DirtyEntities numbers_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_DATETIME_DATE
+DirtyEntities dates_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_DATETIME_TIME
+DirtyEntities times_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_DATETIME_DATETIME
+DirtyEntities datetimes_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_TEXT
+DirtyEntities texts_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_SELECT
+DirtyEntities selects_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_VALVE
+DirtyEntities valves_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_MEDIA_PLAYER
+DirtyEntities media_players_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+DirtyEntities alarm_control_panels_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+#ifdef USE_UPDATE
+DirtyEntities updates_dirty;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
+// Entities of worker loop components publish from the worker task, but the dirty sets are only ever touched from the
+// main loop.
+void mark_dirty(DirtyEntities &dirty, size_t index) {
+#ifdef USE_WORKER_LOOP
+  if (App.in_worker_loop()) {
+    App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), 0, [&dirty, index]() {
+      dirty.mark(index);
+      any_pending = true;
+    });
+    return;
   }
 #endif
-#ifdef USE_SWITCH
-  for (auto *obj : App.get_switches()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](bool state) { this->on_switch_update(obj, state); });
+  dirty.mark(index);
+  any_pending = true;
+}
+
+/// One callback per entity whatever the number of controllers, it only records that the entity changed.
+template<typename List, typename Add>
+void subscribe(DirtyEntities &dirty, const List &entities, bool first, bool add_internal, Add &&add) {
+  if (first)
+    dirty.init(entities.size());
+  for (size_t i = 0; i < entities.size(); i++) {
+    auto *obj = entities[i];
+    if (obj->is_internal() ? add_internal : first)
+      add(obj, [&dirty, i](auto &&.../*unused*/) { mark_dirty(dirty, i); });
+  }
+}
+
+/// Same as subscribe() for entities that mark themselves changed, set_index() hands them their position.
+template<typename List, typename SetIndex>
+void subscribe_indexed(DirtyEntities &dirty, const List &entities, bool first, bool add_internal,
+                       SetIndex &&set_index) {
+  if (first)
+    dirty.init(entities.size());
+  for (size_t i = 0; i < entities.size(); i++) {
+    auto *obj = entities[i];
+    if (obj->is_internal() ? add_internal : first)
+      set_index(obj, i);
   }
+}
+
+template<typename T, typename Notify> void notify_controllers(T *obj, const Notify &notify) {
+  for (const auto &entry : controllers) {
+    if (entry.include_internal || !obj->is_internal())
+      notify(entry.controller, obj);
+  }
+}
+
+/// For entities where every transition counts, like a button press or a motion pulse on a binary sensor: the
+/// controllers are notified of each state right away instead of only the latest one at the next flush.
+template<typename List, typename Add, typename Notify>
+void subscribe_direct(const List &entities, bool first, bool add_internal, Add &&add, Notify notify) {
+  for (auto *obj : entities) {
+    if (obj->is_internal() ? !add_internal : !first)
+      continue;
+    add(obj, [obj, notify](auto &&.../*unused*/) {
+#ifdef USE_WORKER_LOOP
+      if (App.in_worker_loop()) {
+        App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), 0,
+                                  [obj, notify]() { notify_controllers(obj, notify); });
+        return;
+      }
 #endif
-#ifdef USE_COVER
-  for (auto *obj : App.get_covers()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_cover_update(obj); });
+      notify_controllers(obj, notify);
+    });
   }
+}
+
+template<typename List, typename Notify> void flush(DirtyEntities &dirty, const List &entities, Notify &&notify) {
+  dirty.drain([&](size_t index) {
+    notify_controllers(entities[index], notify);
+  });
+}
+
+}  // namespace
+
+void Controller::setup_controller(bool include_internal) {
+  const bool first = controllers.empty();
+  const bool add_internal = include_internal && !internal_subscribed;
+  controllers.push_back({this, include_internal});
+  internal_subscribed |= include_internal;
+  if (!first && !add_internal)
+    return;
+
+#ifdef USE_BINARY_SENSOR
+  subscribe_direct(
+      App.get_binary_sensors(), first, add_internal,
+      [](binary_sensor::BinarySensor *obj, auto &&cb) { obj->add_full_state_callback(std::move(cb)); },
+      [](Controller *c, binary_sensor::BinarySensor *obj) { c->on_binary_sensor_update(obj); });
+#endif
+#ifdef USE_FAN
+  subscribe(fans_dirty, App.get_fans(), first, add_internal,
+            [](fan::Fan *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
+#endif
+#ifdef USE_LIGHT
+  subscribe(lights_dirty, App.get_lights(), first, add_internal,
+            [](light::LightState *obj, auto &&cb) { obj->add_new_remote_values_callback(std::move(cb)); });
+#endif
+#ifdef USE_SENSOR
+  // Sensors are the most numerous entities, they call mark_sensor_updated() so the controllers cost them no callback
+  subscribe_indexed(sensors_dirty, App.get_sensors(), first, add_internal,
+                    [](sensor::Sensor *obj, size_t index) { obj->set_controller_index(index); });
+#endif
+#ifdef USE_SWITCH
+  // A short ON/OFF toggle, like a pulsed relay, must not collapse into its final state
+  subscribe_direct(
+      App.get_switches(), first, add_internal,
+      [](switch_::Switch *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); },
+      [](Controller *c, switch_::Switch *obj) { c->on_switch_update(obj, obj->state); });
+#endif
+#ifdef USE_COVER
+  subscribe(covers_dirty, App.get_covers(), first, add_internal,
+            [](cover::Cover *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_TEXT_SENSOR
-  for (auto *obj : App.get_text_sensors()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](const std::string &state) { this->on_text_sensor_update(obj, state); });
-  }
+  // Text sensors often carry messages, like a scanned code or a log line, where each one counts
+  subscribe_direct(
+      App.get_text_sensors(), first, add_internal,
+      [](text_sensor::TextSensor *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); },
+      [](Controller *c, text_sensor::TextSensor *obj) { c->on_text_sensor_update(obj, obj->state); });
 #endif
 #ifdef USE_CLIMATE
-  for (auto *obj : App.get_climates()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](climate::Climate & /*unused*/) { this->on_climate_update(obj); });
-  }
+  subscribe(climates_dirty, App.get_climates(), first, add_internal,
+            [](climate::Climate *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_NUMBER
-  for (auto *obj : App.get_numbers()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](float state) { this->on_number_update(obj, state); });
-  }
+  subscribe(numbers_dirty, App.get_numbers(), first, add_internal,
+            [](number::Number *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_DATETIME_DATE
-  for (auto *obj : App.get_dates()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_date_update(obj); });
-  }
+  subscribe(dates_dirty, App.get_dates(), first, add_internal,
+            [](datetime::DateEntity *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_DATETIME_TIME
-  for (auto *obj : App.get_times()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_time_update(obj); });
-  }
+  subscribe(times_dirty, App.get_times(), first, add_internal,
+            [](datetime::TimeEntity *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_DATETIME_DATETIME
-  for (auto *obj : App.get_datetimes()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_datetime_update(obj); });
-  }
+  subscribe(datetimes_dirty, App.get_datetimes(), first, add_internal,
+            [](datetime::DateTimeEntity *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_TEXT
-  for (auto *obj : App.get_texts()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj](const std::string &state) { this->on_text_update(obj, state); });
-  }
+  subscribe(texts_dirty, App.get_texts(), first, add_internal,
+            [](text::Text *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_SELECT
-  for (auto *obj : App.get_selects()) {
-    if (include_internal || !obj->is_internal()) {
-      obj->add_on_state_callback(
-          [this, obj](const std::string &state, size_t index) { this->on_select_update(obj, state, index); });
-    }
-  }
+  subscribe(selects_dirty, App.get_selects(), first, add_internal,
+            [](select::Select *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_LOCK
-  for (auto *obj : App.get_locks()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_lock_update(obj); });
-  }
+  // Transitional states like JAMMED are reported even when the lock settles within the same loop
+  subscribe_direct(
+      App.get_locks(), first, add_internal,
+      [](lock::Lock *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); },
+      [](Controller *c, lock::Lock *obj) { c->on_lock_update(obj); });
 #endif
 #ifdef USE_VALVE
-  for (auto *obj : App.get_valves()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_valve_update(obj); });
-  }
+  subscribe(valves_dirty, App.get_valves(), first, add_internal,
+            [](valve::Valve *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_MEDIA_PLAYER
-  for (auto *obj : App.get_media_players()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_media_player_update(obj); });
-  }
+  subscribe(media_players_dirty, App.get_media_players(), first, add_internal,
+            [](media_player::MediaPlayer *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
-  for (auto *obj : App.get_alarm_control_panels()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_alarm_control_panel_update(obj); });
-  }
+  subscribe(alarm_control_panels_dirty, App.get_alarm_control_panels(), first, add_internal,
+            [](alarm_control_panel::AlarmControlPanel *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
 #endif
 #ifdef USE_EVENT
+  // Every event counts, so events are handed to the controllers right away instead of being coalesced
   for (auto *obj : App.get_events()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_event_callback([this, obj](const std::string &event_type) { this->on_event(obj, event_type); });
+    if (obj->is_internal() ? !add_internal : !first)
+      continue;
+    obj->add_on_event_callback([obj](const std::string &event_type) {
+#ifdef USE_WORKER_LOOP
+      if (App.in_worker_loop()) {
+        App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), 0,
+                                  [obj, event_type]() { Controller::dispatch_event_(obj, event_type); });
+        return;
+      }
+#endif
+      Controller::dispatch_event_(obj, event_type);
+    });
   }
 #endif
 #ifdef USE_UPDATE
-  for (auto *obj : App.get_updates()) {
-    if (include_internal || !obj->is_internal())
-      obj->add_on_state_callback([this, obj]() { this->on_update(obj); });
+  subscribe(updates_dirty, App.get_updates(), first, add_internal,
+            [](update::UpdateEntity *obj, auto &&cb) { obj->add_on_state_callback(std::move(cb)); });
+#endif
+}
+
+#ifdef USE_SENSOR
+void Controller::mark_sensor_updated(size_t index) { mark_dirty(sensors_dirty, index); }
+#endif
+
+#ifdef USE_EVENT
+void Controller::dispatch_event_(event::Event *obj, const std::string &event_type) {
+  for (const auto &entry : controllers) {
+    if (entry.include_internal || !obj->is_internal())
+      entry.controller->on_event(obj, event_type);
   }
+}
+#endif
+
+void Controller::flush_pending_updates() {
+  if (!any_pending)
+    return;
+  any_pending = false;
+
+#ifdef USE_FAN
+  flush(fans_dirty, App.get_fans(), [](Controller *c, fan::Fan *obj) { c->on_fan_update(obj); });
+#endif
+#ifdef USE_LIGHT
+  flush(lights_dirty, App.get_lights(), [](Controller *c, light::LightState *obj) { c->on_light_update(obj); });
+#endif
+#ifdef USE_SENSOR
+  flush(sensors_dirty, App.get_sensors(),
+        [](Controller *c, sensor::Sensor *obj) { c->on_sensor_update(obj, obj->state); });
+#endif
+#ifdef USE_COVER
+  flush(covers_dirty, App.get_covers(), [](Controller *c, cover::Cover *obj) { c->on_cover_update(obj); });
+#endif
+#ifdef USE_CLIMATE
+  flush(climates_dirty, App.get_climates(), [](Controller *c, climate::Climate *obj) { c->on_climate_update(obj); });
+#endif
+#ifdef USE_NUMBER
+  flush(numbers_dirty, App.get_numbers(),
+        [](Controller *c, number::Number *obj) { c->on_number_update(obj, obj->state); });
+#endif
+#ifdef USE_DATETIME_DATE
+  flush(dates_dirty, App.get_dates(), [](Controller *c, datetime::DateEntity *obj) { c->on_date_update(obj); });
+#endif
+#ifdef USE_DATETIME_TIME
+  flush(times_dirty, App.get_times(), [](Controller *c, datetime::TimeEntity *obj) { c->on_time_update(obj); });
+#endif
+#ifdef USE_DATETIME_DATETIME
+  flush(datetimes_dirty, App.get_datetimes(),
+        [](Controller *c, datetime::DateTimeEntity *obj) { c->on_datetime_update(obj); });
+#endif
+#ifdef USE_TEXT
+  flush(texts_dirty, App.get_texts(), [](Controller *c, text::Text *obj) { c->on_text_update(obj, obj->state); });
+#endif
+#ifdef USE_SELECT
+  flush(selects_dirty, App.get_selects(), [](Controller *c, select::Select *obj) {
+    c->on_select_update(obj, obj->state, obj->active_index().value_or(0));
+  });
+#endif
+#ifdef USE_VALVE
+  flush(valves_dirty, App.get_valves(), [](Controller *c, valve::Valve *obj) { c->on_valve_update(obj); });
+#endif
+#ifdef USE_MEDIA_PLAYER
+  flush(media_players_dirty, App.get_media_players(),
+        [](Controller *c, media_player::MediaPlayer *obj) { c->on_media_player_update(obj); });
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  flush(alarm_control_panels_dirty, App.get_alarm_control_panels(),
+        [](Controller *c, alarm_control_panel::AlarmControlPanel *obj) { c->on_alarm_control_panel_update(obj); });
+#endif
+#ifdef USE_UPDATE
+  flush(updates_dirty, App.get_updates(), [](Controller *c, update::UpdateEntity *obj) { c->on_update(obj); });
 #endif
 }
 
@@ -67,9 +67,22 @@
 
 namespace esphome {
 
+/// Receives the state changes of all entities.
+///
+/// State changes are not handed over as they are published: the entities that changed are recorded and
+/// flush_pending_updates() calls each controller once per changed entity with its latest state. An entity publishing
+/// many times within one loop iteration therefore costs every controller a single update. Events, binary sensors,
+/// switches, text sensors and locks are the exception, every transition counts for them and they are always
+/// delivered one by one.
 class Controller {
  public:
   void setup_controller(bool include_internal = false);
+  /// Hand the entities changed since the last call to the controllers, called by the Application after every loop.
+  static void flush_pending_updates();
+#ifdef USE_SENSOR
+  /// Record that the sensor at index in App.get_sensors() changed, sensors call it instead of taking a callback slot.
+  static void mark_sensor_updated(size_t index);
+#endif
 #ifdef USE_BINARY_SENSOR
   virtual void on_binary_sensor_update(binary_sensor::BinarySensor *obj){};
 #endif
@@ -130,6 +143,11 @@ class Controller {
 #ifdef USE_UPDATE
   virtual void on_update(update::UpdateEntity *obj){};
 #endif
+
+ protected:
+#ifdef USE_EVENT
+  static void dispatch_event_(event::Event *obj, const std::string &event_type);
+#endif
 };
 
 }  // namespace esphome
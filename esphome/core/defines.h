@@ -40,6 +40,8 @@
 #define USE_ESP32_IMPROV_STATE_CALLBACK
 #define USE_EVENT
 #define USE_FAN
+#define USE_FAST_WAKE
+#define USE_FINGERPRINT_LATENCY_STATS
 #define USE_GRAPH
 #define USE_GRAPHICAL_DISPLAY_MENU
 #define USE_HOMEASSISTANT_TIME
@@ -49,6 +51,7 @@
 #define USE_LOCK
 #define USE_LOGGER
 #define USE_LOGGER_RUNTIME_TAG_LEVELS
+#define USE_LOGGER_TAG_RATE_LIMITS
 #define USE_LVGL
 #define USE_LVGL_ANIMIMG
 #define USE_LVGL_ARC
@@ -94,6 +97,8 @@
 #define USE_QR_CODE
 #define USE_SELECT
 #define USE_SENSOR
+#define ESPHOME_SENSOR_CALLBACK_CAPACITY 1
+#define USE_SENSOR_PUBLISH_POLICY
 #define USE_STATUS_LED
 #define USE_STATUS_SENSOR
 #define USE_SWITCH
@@ -112,6 +117,8 @@
 #define USE_AUDIO_FLAC_SUPPORT
 #define USE_AUDIO_MP3_SUPPORT
 #define USE_API
+#define USE_API_ADAPTIVE_BATCH_DELAY
+#define USE_API_STATE_RESUME
 #define USE_API_CLIENT_CONNECTED_TRIGGER
 #define USE_API_CLIENT_DISCONNECTED_TRIGGER
 #define USE_API_HOMEASSISTANT_ACTION_RESPONSES
@@ -152,6 +159,7 @@
 // IDF-specific feature flags
 #ifdef USE_ESP_IDF
 #define USE_MQTT_IDF_ENQUEUE
+#define USE_PROMETHEUS_PROTOBUF
 #endif
 
 // ESP32-specific feature flags
@@ -161,11 +169,14 @@
 #define USE_BLUETOOTH_PROXY
 #define BLUETOOTH_PROXY_MAX_CONNECTIONS 3
 #define BLUETOOTH_PROXY_ADVERTISEMENT_BATCH_SIZE 16
+#define USE_BLUETOOTH_PROXY_ADVERTISEMENT_FILTER
+#define BLUETOOTH_PROXY_ADVERTISEMENT_CACHE_SIZE 64
 #define USE_CAPTIVE_PORTAL
 #define USE_ESP32_BLE
 #define USE_ESP32_BLE_MAX_CONNECTIONS 3
 #define USE_ESP32_BLE_CLIENT
 #define USE_ESP32_BLE_DEVICE
+#define USE_ESP32_BLE_TRACKER_ADAPTIVE_SCAN
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_BLE_UUID
 #define USE_ESP32_BLE_ADVERTISING
@@ -187,6 +198,8 @@
 #define USE_I2C
 #define USE_IMPROV
 #define USE_MICROPHONE
+#define USE_OTA_DELTA
+#define USE_PACKET_TRANSPORT_AES_GCM
 #define USE_PSRAM
 #define USE_SOCKET_IMPL_BSD_SOCKETS
 #define USE_SOCKET_SELECT_SUPPORT
@@ -210,6 +223,7 @@
 #ifdef USE_ESP_IDF
 #define USE_MICRO_WAKE_WORD
 #define USE_MICRO_WAKE_WORD_VAD
+#define USE_POWER_MANAGEMENT
 #if defined(USE_ESP32_VARIANT_ESP32C6) || defined(USE_ESP32_VARIANT_ESP32H2)
 #define USE_OPENTHREAD
 #endif
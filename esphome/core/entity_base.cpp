@@ -51,24 +51,17 @@ bool EntityBase::is_object_id_dynamic_() const {
 }
 
 // Entity Object ID
-std::string EntityBase::get_object_id() const {
+StringRef EntityBase::get_object_id_ref() const {
+  static constexpr auto EMPTY_STRING = StringRef::from_lit("");
   // Check if `App.get_friendly_name()` is constant or dynamic.
   if (this->is_object_id_dynamic_()) {
-    // `App.get_friendly_name()` is dynamic.
-    return str_sanitize(str_snake_case(App.get_friendly_name()));
+    // `App.get_friendly_name()` is dynamic, its object_id is computed once in `App.pre_setup()`.
+    return StringRef(App.get_friendly_name_object_id());
   }
   // `App.get_friendly_name()` is constant.
-  return this->object_id_c_str_ == nullptr ? "" : this->object_id_c_str_;
-}
-StringRef EntityBase::get_object_id_ref_for_api_() const {
-  static constexpr auto EMPTY_STRING = StringRef::from_lit("");
-  // Return empty for dynamic case (MAC suffix)
-  if (this->is_object_id_dynamic_()) {
-    return EMPTY_STRING;
-  }
-  // For static case, return the string or empty if null
   return this->object_id_c_str_ == nullptr ? EMPTY_STRING : StringRef(this->object_id_c_str_);
 }
+std::string EntityBase::get_object_id() const { return this->get_object_id_ref().str(); }
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
   this->calc_object_id_();
@@ -76,8 +69,7 @@ void EntityBase::set_object_id(const char *object_id) {
 
 // Calculate Object ID Hash from Entity Name
 void EntityBase::calc_object_id_() {
-  this->object_id_hash_ =
-      fnv1_hash(this->is_object_id_dynamic_() ? this->get_object_id().c_str() : this->object_id_c_str_);
+  this->object_id_hash_ = fnv1_hash(this->get_object_id_ref().c_str());
 }
 
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
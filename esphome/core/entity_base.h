@@ -35,6 +35,8 @@ class EntityBase {
 
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
+  // Get the sanitized name of this Entity as an ID without copying it, valid for the lifetime of the Entity.
+  StringRef get_object_id_ref() const;
   void set_object_id(const char *object_id);
 
   // Get the unique Object ID of this Entity
@@ -117,10 +119,6 @@ class EntityBase {
  protected:
   friend class api::APIConnection;
 
-  // Get object_id as StringRef when it's static (for API usage)
-  // Returns empty StringRef if object_id is dynamic (needs allocation)
-  StringRef get_object_id_ref_for_api_() const;
-
   /// The hash_base() function has been deprecated. It is kept in this
   /// class for now, to prevent external components from not compiling.
   virtual uint32_t hash_base() { return 0L; }
@@ -7,6 +7,7 @@
 
 #include <strings.h>
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cmath>
 #include <cstdarg>
@@ -388,17 +389,26 @@ std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
   return std::string(tmp);
 }
 
-std::string value_accuracy_with_uom_to_string(float value, int8_t accuracy_decimals, StringRef unit_of_measurement) {
+size_t value_accuracy_with_uom_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals,
+                                      StringRef unit_of_measurement) {
   normalize_accuracy_decimals(value, accuracy_decimals);
-  // Buffer sized for float (up to ~15 chars) + space + typical UOM (usually <20 chars like "μS/cm")
-  // snprintf truncates safely if exceeded, though ESPHome UOMs are typically short
-  char tmp[64];
+  int len;
   if (unit_of_measurement.empty()) {
-    snprintf(tmp, sizeof(tmp), "%.*f", accuracy_decimals, value);
+    len = snprintf(buf, buf_len, "%.*f", accuracy_decimals, value);
   } else {
-    snprintf(tmp, sizeof(tmp), "%.*f %s", accuracy_decimals, value, unit_of_measurement.c_str());
+    len = snprintf(buf, buf_len, "%.*f %s", accuracy_decimals, value, unit_of_measurement.c_str());
   }
-  return std::string(tmp);
+  if (len < 0)
+    return 0;
+  return std::min(static_cast<size_t>(len), buf_len - 1);
+}
+
+std::string value_accuracy_with_uom_to_string(float value, int8_t accuracy_decimals, StringRef unit_of_measurement) {
+  // Buffer sized for float (up to ~15 chars) + space + typical UOM (usually <20 chars like "μS/cm")
+  // snprintf truncates safely if exceeded, though ESPHome UOMs are typically short
+  char tmp[64];
+  size_t len = value_accuracy_with_uom_to_buf(tmp, sizeof(tmp), value, accuracy_decimals, unit_of_measurement);
+  return std::string(tmp, len);
 }
 
 int8_t step_to_accuracy_decimals(float step) {
@@ -662,6 +672,35 @@ bool mac_address_is_valid(const uint8_t *mac) {
   return !(is_all_zeros || is_all_ones);
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static RAMPolicy ram_policies[static_cast<size_t>(RAMSubsystem::COUNT)];
+#ifdef USE_ESP32
+// Buffers are also allocated and freed by audio and other tasks
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static std::atomic<size_t> ram_usage[static_cast<size_t>(RAMSubsystem::COUNT)];
+#endif
+
+void set_ram_policy(RAMSubsystem subsystem, uint8_t flags, uint32_t min_external_size) {
+  ram_policies[static_cast<size_t>(subsystem)] = {flags, min_external_size};
+}
+
+const RAMPolicy &get_ram_policy(RAMSubsystem subsystem) { return ram_policies[static_cast<size_t>(subsystem)]; }
+
+size_t get_ram_usage(RAMSubsystem subsystem) {
+#ifdef USE_ESP32
+  return ram_usage[static_cast<size_t>(subsystem)].load(std::memory_order_relaxed);
+#else
+  return 0;
+#endif
+}
+
+#ifdef USE_ESP32
+void add_ram_usage(RAMSubsystem subsystem, ptrdiff_t bytes) {
+  // Wraps around for negative bytes
+  ram_usage[static_cast<size_t>(subsystem)].fetch_add(static_cast<size_t>(bytes), std::memory_order_relaxed);
+}
+#endif
+
 void IRAM_ATTR HOT delay_microseconds_safe(uint32_t us) {
   // avoids CPU locks that could trigger WDT or affect WiFi/BT stability
   uint32_t start = micros();
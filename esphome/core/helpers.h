@@ -8,6 +8,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -778,6 +779,10 @@ ParseOnOffState parse_on_off(const char *str, const char *on = nullptr, const ch
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
 /// Create a string from a value, an accuracy in decimals, and a unit of measurement.
 std::string value_accuracy_with_uom_to_string(float value, int8_t accuracy_decimals, StringRef unit_of_measurement);
+/// Format a value, an accuracy in decimals and a unit of measurement into buf (truncated to fit, always terminated).
+/// Returns the number of characters written, excluding the terminator; buf_len must be at least 1.
+size_t value_accuracy_with_uom_to_buf(char *buf, size_t buf_len, float value, int8_t accuracy_decimals,
+                                      StringRef unit_of_measurement);
 
 /// Derive accuracy in decimals from an increment step.
 int8_t step_to_accuracy_decimals(float step);
@@ -843,6 +848,119 @@ template<typename... Ts> class CallbackManager<void(Ts...)> {
   std::vector<std::function<void(Ts...)>> callbacks_;
 };
 
+template<typename... X> class Callback;
+
+/** Lightweight callable for callback lists, a smaller and cheaper to call alternative to std::function.
+ *
+ * Callables that are trivially copyable and no larger than two pointers, like lambdas capturing `this` and an entity
+ * pointer, are stored inline and called through a single function pointer. Anything else is moved to the heap.
+ *
+ * @tparam Ts The arguments for the callback, wrapped in void().
+ */
+template<typename... Ts> class Callback<void(Ts...)> {
+ public:
+  /// Empty callback, must be assigned before it is called.
+  Callback() = default;
+  template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Callback>>>
+  Callback(F &&callable) {  // NOLINT(google-explicit-constructor)
+    using Fn = std::decay_t<F>;
+    if constexpr (sizeof(Fn) <= sizeof(Storage) && alignof(Fn) <= alignof(Storage) &&
+                  std::is_trivially_copyable_v<Fn> && std::is_trivially_destructible_v<Fn>) {
+      new (&this->storage_) Fn(std::forward<F>(callable));
+      this->invoke_ = [](const Storage &storage, Ts... args) {
+        (*std::launder(reinterpret_cast<Fn *>(const_cast<Storage *>(&storage))))(args...);
+      };
+    } else {
+      this->heap_() = new HeapCallable<Fn>(std::forward<F>(callable));  // NOLINT(cppcoreguidelines-owning-memory)
+      this->invoke_ = &Callback::invoke_heap_;
+    }
+  }
+  Callback(const Callback &other) : storage_(other.storage_), invoke_(other.invoke_) {
+    if (this->is_heap_())
+      this->heap_() = other.heap_()->clone();
+  }
+  Callback(Callback &&other) noexcept : storage_(other.storage_), invoke_(other.invoke_) { other.invoke_ = nullptr; }
+  Callback &operator=(Callback other) noexcept {
+    std::swap(this->storage_, other.storage_);
+    std::swap(this->invoke_, other.invoke_);
+    return *this;
+  }
+  ~Callback() {
+    if (this->is_heap_())
+      delete this->heap_();  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+
+  void operator()(Ts... args) const { this->invoke_(this->storage_, args...); }
+
+ protected:
+  struct alignas(void *) Storage {
+    uint8_t data[2 * sizeof(void *)];
+  };
+  struct HeapCallableBase {
+    virtual ~HeapCallableBase() = default;
+    virtual void call(Ts... args) = 0;
+    virtual HeapCallableBase *clone() const = 0;
+  };
+  template<typename Fn> struct HeapCallable : HeapCallableBase {
+    template<typename F> explicit HeapCallable(F &&callable) : callable(std::forward<F>(callable)) {}
+    void call(Ts... args) override { this->callable(args...); }
+    HeapCallableBase *clone() const override { return new HeapCallable(*this); }  // NOLINT
+    Fn callable;
+  };
+
+  static void invoke_heap_(const Storage &storage, Ts... args) {
+    (*reinterpret_cast<HeapCallableBase *const *>(&storage))->call(args...);
+  }
+  bool is_heap_() const { return this->invoke_ == &Callback::invoke_heap_; }
+  HeapCallableBase *&heap_() { return *reinterpret_cast<HeapCallableBase **>(&this->storage_); }
+  HeapCallableBase *heap_() const { return *reinterpret_cast<HeapCallableBase *const *>(&this->storage_); }
+
+  Storage storage_{};
+  void (*invoke_)(const Storage &, Ts...){nullptr};
+};
+
+template<typename F, size_t N> class StaticCallbackManager;
+
+/** CallbackManager with room for the first N callbacks inside the object.
+ *
+ * Use it where the number of subscribers is usually known up front, see ESPHOME_SENSOR_CALLBACK_CAPACITY for one that
+ * is picked by codegen. Callbacks beyond N still work, they go to a heap allocated list.
+ *
+ * @tparam Ts The arguments for the callbacks, wrapped in void().
+ * @tparam N The number of callbacks stored inline, 0 keeps them all on the heap.
+ */
+template<typename... Ts, size_t N> class StaticCallbackManager<void(Ts...), N> {
+ public:
+  /// Add a callback to the list.
+  template<typename F> void add(F &&callback) {
+    if constexpr (N > 0) {
+      if (this->callbacks_.size() < N) {
+        this->callbacks_.emplace_next() = Callback<void(Ts...)>(std::forward<F>(callback));
+        return;
+      }
+    }
+    this->overflow_.emplace_back(std::forward<F>(callback));
+  }
+
+  /// Call all callbacks in this manager.
+  void call(Ts... args) {
+    if constexpr (N > 0) {
+      for (auto &cb : this->callbacks_)
+        cb(args...);
+    }
+    for (auto &cb : this->overflow_)
+      cb(args...);
+  }
+  size_t size() const { return this->callbacks_.size() + this->overflow_.size(); }
+
+  /// Call all callbacks in this manager.
+  void operator()(Ts... args) { call(args...); }
+
+ protected:
+  StaticVector<Callback<void(Ts...)>, N> callbacks_;
+  std::vector<Callback<void(Ts...)>> overflow_;
+};
+
 /// Helper class to deduplicate items in a series of values.
 template<typename T> class Deduplicator {
  public:
@@ -1026,6 +1144,31 @@ void delay_microseconds_safe(uint32_t us);
 /// @name Memory management
 ///@{
 
+/// Users of large buffers, each with its own allocation policy and RAM usage count.
+enum class RAMSubsystem : uint8_t {
+  NONE = 0,  ///< Allocates with the allocator flags and isn't counted.
+  DISPLAY,
+  AUDIO,
+  IMAGE,
+  COUNT,
+};
+
+/// Where the allocations of a subsystem go, configured in the psram component.
+struct RAMPolicy {
+  /// RAMAllocator flags to allocate with, 0 keeps the flags the allocator was created with.
+  uint8_t flags{0};
+  /// Allocations smaller than this try internal RAM first, if both are allowed.
+  uint32_t min_external_size{0};
+};
+
+void set_ram_policy(RAMSubsystem subsystem, uint8_t flags, uint32_t min_external_size);
+const RAMPolicy &get_ram_policy(RAMSubsystem subsystem);
+/// Bytes the subsystem has allocated through RAMAllocator, only counted on ESP32.
+size_t get_ram_usage(RAMSubsystem subsystem);
+#ifdef USE_ESP32
+void add_ram_usage(RAMSubsystem subsystem, ptrdiff_t bytes);
+#endif
+
 /** An STL allocator that uses SPI or internal RAM.
  * Returns `nullptr` in case no memory is available.
  *
@@ -1033,6 +1176,9 @@ void delay_microseconds_safe(uint32_t us);
  * - perform external allocation falling back to main memory if SPI RAM is full or unavailable
  * - perform external allocation only
  * - perform internal allocation only
+ *
+ * Created for a RAMSubsystem, the policy of the subsystem replaces the flags once it sets any, and the allocated
+ * bytes are counted for the subsystem.
  */
 template<class T> class RAMAllocator {
  public:
@@ -1052,7 +1198,9 @@ template<class T> class RAMAllocator {
     if (flags != 0)
       this->flags_ = flags;
   }
-  template<class U> constexpr RAMAllocator(const RAMAllocator<U> &other) : flags_{other.flags_} {}
+  RAMAllocator(RAMSubsystem subsystem, uint8_t flags = NONE) : RAMAllocator(flags) { this->subsystem_ = subsystem; }
+  template<class U>
+  constexpr RAMAllocator(const RAMAllocator<U> &other) : flags_{other.flags_}, subsystem_{other.subsystem_} {}
 
   T *allocate(size_t n) { return this->allocate(n, sizeof(T)); }
 
@@ -1060,12 +1208,19 @@ template<class T> class RAMAllocator {
     size_t size = n * manual_size;
     T *ptr = nullptr;
 #ifdef USE_ESP32
-    if (this->flags_ & Flags::ALLOC_EXTERNAL) {
+    const uint8_t flags = this->get_flags_();
+    const bool internal_first = this->is_internal_first_(flags, size);
+    if (!internal_first && flags & Flags::ALLOC_EXTERNAL) {
       ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
     }
-    if (ptr == nullptr && this->flags_ & Flags::ALLOC_INTERNAL) {
+    if (ptr == nullptr && flags & Flags::ALLOC_INTERNAL) {
       ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
     }
+    if (ptr == nullptr && internal_first && flags & Flags::ALLOC_EXTERNAL) {
+      ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    }
+    if (ptr != nullptr && this->subsystem_ != RAMSubsystem::NONE)
+      add_ram_usage(this->subsystem_, heap_caps_get_allocated_size(ptr));
 #else
     // Ignore ALLOC_EXTERNAL/ALLOC_INTERNAL flags if external allocation is not supported
     ptr = static_cast<T *>(malloc(size));  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
@@ -1079,12 +1234,21 @@ template<class T> class RAMAllocator {
     size_t size = n * manual_size;
     T *ptr = nullptr;
 #ifdef USE_ESP32
-    if (this->flags_ & Flags::ALLOC_EXTERNAL) {
+    const uint8_t flags = this->get_flags_();
+    const bool internal_first = this->is_internal_first_(flags, size);
+    const bool counted = this->subsystem_ != RAMSubsystem::NONE;
+    const size_t old_size = counted && p != nullptr ? heap_caps_get_allocated_size(p) : 0;
+    if (!internal_first && flags & Flags::ALLOC_EXTERNAL) {
       ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
     }
-    if (ptr == nullptr && this->flags_ & Flags::ALLOC_INTERNAL) {
+    if (ptr == nullptr && flags & Flags::ALLOC_INTERNAL) {
       ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
     }
+    if (ptr == nullptr && internal_first && flags & Flags::ALLOC_EXTERNAL) {
+      ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    }
+    if (ptr != nullptr && counted)
+      add_ram_usage(this->subsystem_, static_cast<ptrdiff_t>(heap_caps_get_allocated_size(ptr)) - old_size);
 #else
     // Ignore ALLOC_EXTERNAL/ALLOC_INTERNAL flags if external allocation is not supported
     ptr = static_cast<T *>(realloc(p, size));  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
@@ -1093,6 +1257,10 @@ template<class T> class RAMAllocator {
   }
 
   void deallocate(T *p, size_t n) {
+#ifdef USE_ESP32
+    if (p != nullptr && this->subsystem_ != RAMSubsystem::NONE)
+      add_ram_usage(this->subsystem_, -static_cast<ptrdiff_t>(heap_caps_get_allocated_size(p)));
+#endif
     free(p);  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
   }
 
@@ -1103,10 +1271,9 @@ template<class T> class RAMAllocator {
 #ifdef USE_ESP8266
     return ESP.getFreeHeap();  // NOLINT(readability-static-accessed-through-instance)
 #elif defined(USE_ESP32)
-    auto max_internal =
-        this->flags_ & ALLOC_INTERNAL ? heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL) : 0;
-    auto max_external =
-        this->flags_ & ALLOC_EXTERNAL ? heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM) : 0;
+    const uint8_t flags = this->get_flags_();
+    auto max_internal = flags & ALLOC_INTERNAL ? heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL) : 0;
+    auto max_external = flags & ALLOC_EXTERNAL ? heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM) : 0;
     return max_internal + max_external;
 #elif defined(USE_RP2040)
     return ::rp2040.getFreeHeap();
@@ -1124,10 +1291,11 @@ template<class T> class RAMAllocator {
 #ifdef USE_ESP8266
     return ESP.getMaxFreeBlockSize();  // NOLINT(readability-static-accessed-through-instance)
 #elif defined(USE_ESP32)
+    const uint8_t flags = this->get_flags_();
     auto max_internal =
-        this->flags_ & ALLOC_INTERNAL ? heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL) : 0;
+        flags & ALLOC_INTERNAL ? heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL) : 0;
     auto max_external =
-        this->flags_ & ALLOC_EXTERNAL ? heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM) : 0;
+        flags & ALLOC_EXTERNAL ? heap_caps_get_largest_free_block(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM) : 0;
     return std::max(max_internal, max_external);
 #else
     return this->get_free_heap_size();
@@ -1135,7 +1303,23 @@ template<class T> class RAMAllocator {
   }
 
  private:
+  template<class U> friend class RAMAllocator;
+
+  uint8_t get_flags_() const {
+    if (this->subsystem_ != RAMSubsystem::NONE) {
+      const uint8_t flags = get_ram_policy(this->subsystem_).flags;
+      if (flags != 0)
+        return flags;
+    }
+    return this->flags_;
+  }
+  bool is_internal_first_(uint8_t flags, size_t size) const {
+    return this->subsystem_ != RAMSubsystem::NONE && (flags & ALLOC_INTERNAL) &&
+           size < get_ram_policy(this->subsystem_).min_external_size;
+  }
+
   uint8_t flags_{ALLOC_INTERNAL | ALLOC_EXTERNAL};
+  RAMSubsystem subsystem_{RAMSubsystem::NONE};
 };
 
 template<class T> using ExternalRAMAllocator = RAMAllocator<T>;
@@ -1,9 +1,13 @@
 #pragma once
 
-#if defined(USE_ESP32)
+#include "esphome/core/defines.h"
 
+#if defined(USE_ESP32) || defined(ESPHOME_THREAD_MULTI_ATOMICS)
 #include <atomic>
 #include <cstddef>
+#endif
+
+#if defined(USE_ESP32)
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -144,3 +148,51 @@ template<class T, uint8_t SIZE> class NotifyingLockFreeQueue : public LockFreeQu
 }  // namespace esphome
 
 #endif  // defined(USE_ESP32)
+
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+
+namespace esphome {
+
+/*
+ * Lock-free intrusive stack for multiple producers and a single consumer.
+ * Any thread can push, the consumer detaches everything pushed so far with take_all().
+ * Elements are only ever removed all at once, which keeps the stack free of the ABA
+ * problem without tagged pointers, and it is unbounded since the link lives in the
+ * element itself.
+ *
+ * Available on all platforms with atomics (ESPHOME_THREAD_MULTI_ATOMICS).
+ *
+ * Common use cases:
+ * - Scheduler defers: any task produces, main loop consumes
+ *
+ * @tparam T The type of elements stored in the stack
+ * @tparam NEXT Pointer to the member of T linking it to the next element
+ */
+template<class T, T *T::*NEXT> class LockFreeStack {
+ public:
+  void push(T *element) { this->push_chain(element, element); }
+
+  // Push a chain of elements already linked through NEXT, ending with last
+  void push_chain(T *first, T *last) {
+    T *head = this->head_.load(std::memory_order_relaxed);
+    do {
+      last->*NEXT = head;
+    } while (!this->head_.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Detach all elements, the most recently pushed one first
+  T *take_all() {
+    if (this->head_.load(std::memory_order_relaxed) == nullptr)
+      return nullptr;
+    return this->head_.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  bool empty() const { return this->head_.load(std::memory_order_acquire) == nullptr; }
+
+ protected:
+  std::atomic<T *> head_{nullptr};
+};
+
+}  // namespace esphome
+
+#endif  // ESPHOME_THREAD_MULTI_ATOMICS
@@ -8,9 +8,11 @@
 #include <cinttypes>
 #include <string>
 
+// for USE_ARDUINO_VERSION_CODE and ESPHOME_LOG_COMPONENT_LEVELS
+#include "esphome/core/defines.h"
+
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 #include "WString.h"
-#include "esphome/core/defines.h"  // for USE_ARDUINO_VERSION_CODE
 #endif
 
 // Include ESP-IDF/Arduino based logging methods here so they don't undefine ours later
@@ -76,9 +78,60 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #define ESPHOME_LOG_FORMAT(format) format
 #endif
 
+#ifdef ESPHOME_LOG_COMPONENT_LEVELS
+struct LogComponentLevel {
+  const char *component;
+  int level;
+};
+// Highest level compiled into the sources of each listed component, generated from logger: component_max_levels
+constexpr LogComponentLevel LOG_COMPONENT_LEVELS[] = {ESPHOME_LOG_COMPONENT_LEVELS};
+
+/// Whether path lies in the source directory of component, i.e. contains "components/<component>/".
+constexpr bool log_path_in_component(const char *path, const char *component) {
+  constexpr const char *DIR = "components";
+  for (const char *start = path; *start != '\0'; start++) {
+    const char *p = start;
+    const char *d = DIR;
+    while (*d != '\0' && *p == *d) {
+      p++;
+      d++;
+    }
+    if (*d != '\0' || (*p != '/' && *p != '\\'))
+      continue;
+    p++;
+    const char *c = component;
+    while (*c != '\0' && *p == *c) {
+      p++;
+      c++;
+    }
+    if (*c == '\0' && (*p == '/' || *p == '\\'))
+      return true;
+  }
+  return false;
+}
+
+/// Highest level compiled into the source file at path.
+constexpr int log_level_for_file(const char *path) {
+  for (const auto &entry : LOG_COMPONENT_LEVELS) {
+    if (log_path_in_component(path, entry.component))
+      return entry.level;
+  }
+  return ESPHOME_LOG_LEVEL;
+}
+
+// Messages above the level of the component the calling file belongs to are discarded at compile time
+#define ESPHOME_LOG_AT_(level, tag, format, ...) \
+  do { \
+    if constexpr ((level) <= ::esphome::log_level_for_file(__FILE__)) \
+      ::esphome::esp_log_printf_(level, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__); \
+  } while (0)
+#else
+#define ESPHOME_LOG_AT_(level, tag, format, ...) \
+  ::esphome::esp_log_printf_(level, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#endif
+
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERY_VERBOSE
-#define esph_log_vv(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_vv(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_VERY_VERBOSE
 #else
@@ -86,8 +139,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
-#define esph_log_v(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_v(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_VERBOSE, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_VERBOSE
 #else
@@ -95,10 +147,8 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
-#define esph_log_d(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
-#define esph_log_config(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_d(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_DEBUG, tag, format, ##__VA_ARGS__)
+#define esph_log_config(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_CONFIG, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_DEBUG
 #define ESPHOME_LOG_HAS_CONFIG
@@ -108,8 +158,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO
-#define esph_log_i(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_i(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_INFO, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_INFO
 #else
@@ -117,8 +166,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_WARN
-#define esph_log_w(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_w(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_WARN, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_WARN
 #else
@@ -126,8 +174,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR
-#define esph_log_e(tag, format, ...) \
-  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+#define esph_log_e(tag, format, ...) ESPHOME_LOG_AT_(ESPHOME_LOG_LEVEL_ERROR, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_ERROR
 #else
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+
+/** Open addressed table of fixed size records, persisted in chunks of CHUNK_SIZE records.
+ *
+ * Lookups probe linearly from the home slot of the key. The table is power of two sized and at most half full, which
+ * keeps the probe sequences short, and is allocated in PSRAM when available. Every chunk is a preference object of its
+ * own, so a change only rewrites the chunks it touched.
+ *
+ * Traits describes the records:
+ *   using Key = ...;
+ *   static Key key(const T &record);
+ *   static bool is_empty(const T &record);
+ *   static void set_empty(T &record);
+ *   static void sanitize(T &record);  // Called on the records loaded from flash.
+ * The key itself is the home slot, so it has to be spread already, like a hash or a small dense ID.
+ */
+template<typename T, typename Traits, size_t CHUNK_SIZE> class PersistentTable {
+ public:
+  using Key = typename Traits::Key;
+
+  /// Persisted slice of the table, a preference object holds one of these.
+  struct Chunk {
+    T records[CHUNK_SIZE];
+  };
+
+  /// Allocates the table and loads the stored records. @return false if the table could not be allocated.
+  bool init(uint16_t max_records, uint32_t preference_key) {
+    this->max_records_ = max_records;
+    this->capacity_ = CHUNK_SIZE;
+    while (this->capacity_ < 2u * max_records)
+      this->capacity_ *= 2;
+
+    RAMAllocator<T> allocator;
+    this->table_ = allocator.allocate(this->capacity_);
+    if (this->table_ == nullptr)
+      return false;
+    for (size_t slot = 0; slot < this->capacity_; slot++)
+      Traits::set_empty(this->table_[slot]);
+
+    const size_t chunks = this->capacity_ / CHUNK_SIZE;
+    this->prefs_.reserve(chunks);
+    this->dirty_chunks_.assign(chunks, false);
+    for (size_t i = 0; i < chunks; i++) {
+      this->prefs_.push_back(global_preferences->make_preference<Chunk>(preference_key + i));
+      Chunk chunk;
+      if (this->prefs_[i].load(&chunk))
+        memcpy(this->table_ + i * CHUNK_SIZE, chunk.records, sizeof(chunk.records));
+    }
+    bool consistent = true;
+    for (size_t slot = 0; slot < this->capacity_; slot++) {
+      T &record = this->table_[slot];
+      if (Traits::is_empty(record))
+        continue;
+      Traits::sanitize(record);
+      this->count_++;
+      consistent &= this->find_slot_(Traits::key(record)) == slot;
+    }
+    if (consistent && this->count_ <= this->max_records_)
+      return true;
+
+    // Stored with another table size, insert the records again
+    std::vector<T> records;
+    records.reserve(this->count_);
+    for (size_t slot = 0; slot < this->capacity_; slot++) {
+      if (!Traits::is_empty(this->table_[slot]))
+        records.push_back(this->table_[slot]);
+      Traits::set_empty(this->table_[slot]);
+    }
+    this->dirty_chunks_.assign(chunks, true);
+    this->count_ = 0;
+    for (const T &record : records) {
+      if (!this->insert(record)) {
+        ESP_LOGW("persistent_table", "Table full, dropped %u stored records",
+                 (unsigned) (records.size() - this->count_));
+        break;
+      }
+    }
+    this->save();
+    return true;
+  }
+
+  uint16_t size() const { return this->count_; }
+  uint16_t max_size() const { return this->max_records_; }
+
+  /// @return nullptr if no record has the key.
+  const T *find(Key key) const {
+    if (this->table_ == nullptr)
+      return nullptr;
+    const T &record = this->table_[this->find_slot_(key)];
+    return !Traits::is_empty(record) && Traits::key(record) == key ? &record : nullptr;
+  }
+
+  /// Calls callback with every record, the table must not be changed meanwhile.
+  template<typename F> void for_each(F &&callback) const {
+    for (size_t slot = 0; slot < this->capacity_; slot++) {
+      if (!Traits::is_empty(this->table_[slot]))
+        callback(this->table_[slot]);
+    }
+  }
+
+  /// Adds the record or replaces the one with its key. @return false if the table is full.
+  bool insert(const T &record) {
+    if (this->table_ == nullptr)
+      return false;
+    const size_t slot = this->find_slot_(Traits::key(record));
+    if (Traits::is_empty(this->table_[slot])) {
+      if (this->count_ >= this->max_records_)
+        return false;
+      this->count_++;
+    }
+    this->table_[slot] = record;
+    this->mark_dirty_(slot);
+    return true;
+  }
+
+  /// @return false if no record had the key.
+  bool erase(Key key) {
+    if (this->table_ == nullptr)
+      return false;
+    const size_t mask = this->capacity_ - 1;
+    size_t hole = this->find_slot_(key);
+    if (Traits::is_empty(this->table_[hole]))
+      return false;
+    Traits::set_empty(this->table_[hole]);
+    this->mark_dirty_(hole);
+    this->count_--;
+
+    // Move later records of the probe sequence into the hole, so lookups don't stop early
+    for (size_t slot = (hole + 1) & mask; !Traits::is_empty(this->table_[slot]); slot = (slot + 1) & mask) {
+      const size_t home = static_cast<size_t>(Traits::key(this->table_[slot])) & mask;
+      // Distance from the home slot, a record can move back as long as it stays at or behind it
+      if (((slot - home) & mask) < ((slot - hole) & mask))
+        continue;
+      this->table_[hole] = this->table_[slot];
+      Traits::set_empty(this->table_[slot]);
+      this->mark_dirty_(hole);
+      this->mark_dirty_(slot);
+      hole = slot;
+    }
+    return true;
+  }
+
+  void clear() {
+    if (this->table_ == nullptr)
+      return;
+    for (size_t slot = 0; slot < this->capacity_; slot++)
+      Traits::set_empty(this->table_[slot]);
+    this->dirty_chunks_.assign(this->dirty_chunks_.size(), true);
+    this->count_ = 0;
+  }
+
+  /// Writes the chunks changed since the last call.
+  void save() {
+    for (size_t i = 0; i < this->prefs_.size(); i++) {
+      if (!this->dirty_chunks_[i])
+        continue;
+      Chunk chunk;
+      memcpy(chunk.records, this->table_ + i * CHUNK_SIZE, sizeof(chunk.records));
+      this->prefs_[i].save(&chunk);
+      this->dirty_chunks_[i] = false;
+    }
+  }
+
+ protected:
+  /// @return Slot of the key, or of the empty slot that ends its probe sequence.
+  size_t find_slot_(Key key) const {
+    const size_t mask = this->capacity_ - 1;
+    size_t slot = static_cast<size_t>(key) & mask;
+    while (!Traits::is_empty(this->table_[slot]) && Traits::key(this->table_[slot]) != key)
+      slot = (slot + 1) & mask;
+    return slot;
+  }
+  void mark_dirty_(size_t slot) { this->dirty_chunks_[slot / CHUNK_SIZE] = true; }
+
+  T *table_{nullptr};
+  size_t capacity_{0};
+  uint16_t max_records_{0};
+  uint16_t count_{0};
+  std::vector<ESPPreferenceObject> prefs_;
+  std::vector<bool> dirty_chunks_;
+};
+
+}  // namespace esphome
@@ -46,6 +46,14 @@ class ESPPreferences {
    */
   virtual bool sync() = 0;
 
+  /**
+   * Start committing pending writes without waiting for flash, on platforms that can write from another task.
+   * A write still in progress is finished by the next sync().
+   *
+   * @return false if an earlier background write failed.
+   */
+  virtual bool sync_async() { return this->sync(); }
+
   /**
    * Forget all unsaved changes and re-initialize the permanent preferences storage.
    * Usually followed by a restart which moves the system to "factory" conditions
@@ -14,17 +14,18 @@ static const char *const TAG = "ring_buffer";
 RingBuffer::~RingBuffer() {
   if (this->handle_ != nullptr) {
     vRingbufferDelete(this->handle_);
-    RAMAllocator<uint8_t> allocator;
+    RAMAllocator<uint8_t> allocator(this->subsystem_);
     allocator.deallocate(this->storage_, this->size_);
   }
 }
 
-std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
+std::unique_ptr<RingBuffer> RingBuffer::create(size_t len, RAMSubsystem subsystem) {
   std::unique_ptr<RingBuffer> rb = make_unique<RingBuffer>();
 
   rb->size_ = len;
+  rb->subsystem_ = subsystem;
 
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(subsystem);
   rb->storage_ = allocator.allocate(rb->size_);
   if (rb->storage_ == nullptr) {
     return nullptr;
@@ -69,6 +70,13 @@ size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
   return bytes_read;
 }
 
+uint8_t *RingBuffer::read_acquire(size_t *len, size_t max_len, TickType_t ticks_to_wait) {
+  *len = 0;
+  return static_cast<uint8_t *>(xRingbufferReceiveUpTo(this->handle_, len, ticks_to_wait, max_len));
+}
+
+void RingBuffer::read_release(uint8_t *data) { vRingbufferReturnItem(this->handle_, data); }
+
 size_t RingBuffer::write(const void *data, size_t len) {
   size_t free = this->free();
   if (free < len) {
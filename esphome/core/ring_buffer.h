@@ -8,6 +8,8 @@
 #include <cinttypes>
 #include <memory>
 
+#include "esphome/core/helpers.h"
+
 namespace esphome {
 
 class RingBuffer {
@@ -27,6 +29,27 @@ class RingBuffer {
    */
   size_t read(void *data, size_t len, TickType_t ticks_to_wait = 0);
 
+  /**
+   * @brief Borrows the next contiguous block of data in place instead of copying it out.
+   *
+   * The block stops where the data wraps around the end of the storage, so it may be shorter than what is
+   * available. Only one block can be borrowed at a time, and it stays reserved until it is handed back with
+   * `read_release()`, which frees all of it.
+   *
+   * @param len Set to the number of bytes in the block
+   * @param max_len Maximum number of bytes to borrow
+   * @param ticks_to_wait Maximum number of FreeRTOS ticks to wait for data (default: 0)
+   * @return Pointer to the block, nullptr if no data was available
+   */
+  uint8_t *read_acquire(size_t *len, size_t max_len, TickType_t ticks_to_wait = 0);
+
+  /**
+   * @brief Hands a block borrowed by `read_acquire()` back, freeing its space for writers.
+   *
+   * @param data Pointer returned by `read_acquire()`
+   */
+  void read_release(uint8_t *data);
+
   /**
    * @brief Writes to the ring buffer, overwriting oldest data if necessary.
    *
@@ -80,7 +103,7 @@ class RingBuffer {
    */
   BaseType_t reset();
 
-  static std::unique_ptr<RingBuffer> create(size_t len);
+  static std::unique_ptr<RingBuffer> create(size_t len, RAMSubsystem subsystem = RAMSubsystem::NONE);
 
  protected:
   /// @brief Discards data from the ring buffer.
@@ -92,6 +115,7 @@ class RingBuffer {
   StaticRingbuffer_t structure_;
   uint8_t *storage_{nullptr};
   size_t size_{0};
+  RAMSubsystem subsystem_{RAMSubsystem::NONE};
 };
 
 }  // namespace esphome
@@ -14,6 +14,13 @@ namespace esphome {
 
 static const char *const TAG = "scheduler";
 
+#ifdef USE_TICKLESS_IDLE
+// A new item may be due before the loop task comes back from its idle sleep
+static inline void wake_loop() { App.wake_loop_any_context(); }
+#else
+static inline void wake_loop() {}
+#endif
+
 // Memory pool configuration constants
 // Pool size of 5 matches typical usage patterns (2-4 active timers)
 // - Minimal memory overhead (~250 bytes on ESP32)
@@ -27,6 +34,8 @@ static constexpr size_t MAX_POOL_SIZE = 5;
 // Set to 5 to match the pool size - when we have as many cancelled items as our
 // pool can hold, it's time to clean up and recycle them.
 static constexpr uint32_t MAX_LOGICALLY_DELETED_ITEMS = 5;
+// Initial bucket count of the name index once the first named item is scheduled, must be a power of two
+static constexpr size_t MIN_NAME_INDEX_BUCKETS = 8;
 // Half the 32-bit range - used to detect rollovers vs normal time progression
 static constexpr uint32_t HALF_MAX_UINT32 = std::numeric_limits<uint32_t>::max() / 2;
 // max delay to start an interval sequence
@@ -91,6 +100,14 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
     return;
   }
 
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+  // Anonymous defers from other tasks must not contend with the main loop for the lock
+  if (delay == 0 && type == SchedulerItem::TIMEOUT && name_cstr == nullptr) {
+    this->defer_lock_free_(component, std::move(func));
+    return;
+  }
+#endif /* ESPHOME_THREAD_MULTI_ATOMICS */
+
   // Get fresh timestamp BEFORE taking lock - millis_64_ may need to acquire lock itself
   const uint64_t now = this->millis_64_(millis());
 
@@ -124,6 +141,7 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   item->remove = false;
 #endif
   item->is_retry = is_retry;
+  item->scheduled = false;
 
 #ifndef ESPHOME_THREAD_SINGLE
   // Special handling for defer() (delay = 0, type = TIMEOUT)
@@ -133,7 +151,14 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
     if (!skip_cancel) {
       this->cancel_item_locked_(component, name_cstr, type);
     }
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+    // Named, so it can still be cancelled through the index while it waits in the stack
+    this->name_index_insert_(item.get());
+    this->defer_stack_.push(item.release());
+#else
     this->defer_queue_.push_back(std::move(item));
+#endif
+    wake_loop();
     return;
   }
 #endif /* not ESPHOME_THREAD_SINGLE */
@@ -172,8 +197,7 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
 
   // For retries, check if there's a cancelled timeout first
   if (is_retry && name_cstr != nullptr && type == SchedulerItem::TIMEOUT &&
-      (has_cancelled_timeout_in_container_(this->items_, component, name_cstr, /* match_retry= */ true) ||
-       has_cancelled_timeout_in_container_(this->to_add_, component, name_cstr, /* match_retry= */ true))) {
+      this->has_cancelled_retry_locked_(component, name_cstr)) {
     // Skip scheduling - the retry was cancelled
 #ifdef ESPHOME_DEBUG_SCHEDULER
     ESP_LOGD(TAG, "Skipping retry '%s' - found cancelled item", name_cstr);
@@ -186,9 +210,12 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   if (!skip_cancel) {
     this->cancel_item_locked_(component, name_cstr, type);
   }
+  if (name_cstr != nullptr)
+    this->name_index_insert_(item.get());
   // Add new item directly to to_add_
   // since we have the lock held
   this->to_add_.push_back(std::move(item));
+  wake_loop();
 }
 
 void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> func) {
@@ -308,10 +335,17 @@ optional<uint32_t> HOT Scheduler::next_schedule_in(uint32_t now) {
   if (this->cleanup_() == 0)
     return {};
 
-  auto &item = this->items_[0];
   // Convert the fresh timestamp from caller (usually Application::loop()) to 64-bit
   const auto now_64 = this->millis_64_(now);  // 'now' from parameter - fresh from caller
-  const uint64_t next_exec = item->get_next_execution();
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  uint64_t next_exec;
+  {
+    LockGuard guard{this->lock_};
+    next_exec = this->wheel_next_execution_();
+  }
+#else
+  const uint64_t next_exec = this->items_[0]->get_next_execution();
+#endif
   if (next_exec < now_64)
     return 0;
   return next_exec - now_64;
@@ -328,8 +362,30 @@ void HOT Scheduler::call(uint32_t now) {
   // Single-core platforms don't use this queue and fall back to the heap-based approach.
   //
   // Note: Items cancelled via cancel_item_locked_() are marked with remove=true but still
-  // processed here. They are removed from the queue normally via pop_front() but skipped
-  // during execution by should_skip_item_(). This is intentional - no memory leak occurs.
+  // processed here. They are removed from the queue normally but skipped during execution
+  // by should_skip_item_(). This is intentional - no memory leak occurs.
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+  // Each batch is detached from the lock-free stack at once, most recent first. Reversing it restores
+  // the order in which the items were deferred; anything deferred meanwhile lands in the next batch.
+  SchedulerItem *batch;
+  while ((batch = this->defer_stack_.take_all()) != nullptr) {
+    SchedulerItem *item = nullptr;
+    while (batch != nullptr) {
+      SchedulerItem *next = batch->defer_next;
+      batch->defer_next = item;
+      item = batch;
+      batch = next;
+    }
+    while (item != nullptr) {
+      SchedulerItem *next = item->defer_next;
+      if (!this->should_skip_item_(item)) {
+        now = this->execute_item_(item, now);
+      }
+      this->recycle_defer_item_(item);
+      item = next;
+    }
+  }
+#else  /* not ESPHOME_THREAD_MULTI_ATOMICS */
   while (!this->defer_queue_.empty()) {
     // The outer check is done without a lock for performance. If the queue
     // appears non-empty, we lock and process an item. We don't need to check
@@ -349,6 +405,7 @@ void HOT Scheduler::call(uint32_t now) {
     // Recycle the defer item after execution
     this->recycle_item_(std::move(item));
   }
+#endif /* else ESPHOME_THREAD_MULTI_ATOMICS */
 #endif /* not ESPHOME_THREAD_SINGLE */
 
   // Convert the fresh timestamp from main loop to 64-bit for scheduler operations
@@ -363,16 +420,26 @@ void HOT Scheduler::call(uint32_t now) {
 
   if (now_64 - last_print > 2000) {
     last_print = now_64;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+    const size_t item_count = this->wheel_count_;
+#else
+    const size_t item_count = this->items_.size();
+#endif
 #ifdef ESPHOME_THREAD_MULTI_ATOMICS
     const auto last_dbg = this->last_millis_.load(std::memory_order_relaxed);
     const auto major_dbg = this->millis_major_.load(std::memory_order_relaxed);
-    ESP_LOGD(TAG, "Items: count=%zu, pool=%zu, now=%" PRIu64 " (%" PRIu16 ", %" PRIu32 ")", this->items_.size(),
+    ESP_LOGD(TAG, "Items: count=%zu, pool=%zu, now=%" PRIu64 " (%" PRIu16 ", %" PRIu32 ")", item_count,
              this->scheduler_item_pool_.size(), now_64, major_dbg, last_dbg);
 #else  /* not ESPHOME_THREAD_MULTI_ATOMICS */
-    ESP_LOGD(TAG, "Items: count=%zu, pool=%zu, now=%" PRIu64 " (%" PRIu16 ", %" PRIu32 ")", this->items_.size(),
+    ESP_LOGD(TAG, "Items: count=%zu, pool=%zu, now=%" PRIu64 " (%" PRIu16 ", %" PRIu32 ")", item_count,
              this->scheduler_item_pool_.size(), now_64, this->millis_major_, this->last_millis_);
 #endif /* else ESPHOME_THREAD_MULTI_ATOMICS */
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+    ESP_LOGD(TAG, "  wheel_time=%" PRIu64 ", occupied levels=%016" PRIx64 " %016" PRIx64 " %016" PRIx64 " %016" PRIx64,
+             this->wheel_time_, this->wheel_occupied_[0], this->wheel_occupied_[1], this->wheel_occupied_[2],
+             this->wheel_occupied_[3]);
+#else
+    std::vector<std::unique_ptr<SchedulerItem>> old_items;
     // Cleanup before debug output
     this->cleanup_();
     while (!this->items_.empty()) {
@@ -399,9 +466,56 @@ void HOT Scheduler::call(uint32_t now) {
       // Rebuild heap after moving items back
       std::make_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
     }
+#endif /* USE_SCHEDULER_TIMER_WHEEL */
   }
 #endif /* ESPHOME_DEBUG_SCHEDULER */
 
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  // Cancelled items are unlinked from the wheel right away, there is nothing to clean up
+  while (true) {
+    SchedulerItem *item;
+    {
+      LockGuard guard{this->lock_};
+      item = this->wheel_pop_due_(now_64);
+      if (item == nullptr)
+        break;
+      // Don't run on failed components
+      if (item->component != nullptr && item->component->is_failed()) {
+        this->recycle_item_(std::unique_ptr<SchedulerItem>(item));
+        continue;
+      }
+      // Out of the wheel but still in the name index, a cancel from the callback marks it as removed
+    }
+
+#ifdef ESPHOME_DEBUG_SCHEDULER
+    const char *item_name = item->get_name();
+    ESP_LOGV(TAG, "Running %s '%s/%s' with interval=%" PRIu32 " next_execution=%" PRIu64 " (now=%" PRIu64 ")",
+             item->get_type_str(), LOG_STR_ARG(item->get_source()), item_name ? item_name : "(null)", item->interval,
+             item->get_next_execution(), now_64);
+#endif /* ESPHOME_DEBUG_SCHEDULER */
+
+    now = this->execute_item_(item, now);
+
+    LockGuard guard{this->lock_};
+    std::unique_ptr<SchedulerItem> executed_item(item);
+
+    if (executed_item->remove) {
+      // We were removed/cancelled in the function call, stop
+      this->recycle_item_(std::move(executed_item));
+      continue;
+    }
+
+    if (executed_item->type == SchedulerItem::INTERVAL) {
+      executed_item->set_next_execution(now_64 + executed_item->interval);
+      this->to_add_.push_back(std::move(executed_item));
+    } else {
+      // Timeout completed - recycle it
+      this->recycle_item_(std::move(executed_item));
+    }
+
+    has_added_items |= !this->to_add_.empty();
+  }
+#else  /* not USE_SCHEDULER_TIMER_WHEEL */
   // Cleanup removed items before processing
   // First try to clean items from the top of the heap (fast path)
   this->cleanup_();
@@ -491,9 +605,12 @@ void HOT Scheduler::call(uint32_t now) {
     // during the function call and know if we were cancelled.
     this->pop_raw_();
 
+    executed_item->scheduled = false;
+
     if (executed_item->remove) {
       // We were removed/cancelled in the function call, stop
       this->to_remove_--;
+      this->recycle_item_(std::move(executed_item));
       continue;
     }
 
@@ -510,6 +627,8 @@ void HOT Scheduler::call(uint32_t now) {
     has_added_items |= !this->to_add_.empty();
   }
 
+#endif /* else USE_SCHEDULER_TIMER_WHEEL */
+
   if (has_added_items) {
     this->process_to_add();
   }
@@ -523,12 +642,30 @@ void HOT Scheduler::process_to_add() {
       continue;
     }
 
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+    this->wheel_insert_(it.release());
+#else
+    it->scheduled = true;
     this->items_.push_back(std::move(it));
     std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+#endif
   }
   this->to_add_.clear();
 }
+Scheduler::QueueDepths Scheduler::get_queue_depths() {
+  LockGuard guard{this->lock_};
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  const size_t timers = this->wheel_count_;
+#else
+  const size_t timers = this->items_.size();
+#endif
+  return {timers, this->to_add_.size(), this->scheduler_item_pool_.size()};
+}
 size_t HOT Scheduler::cleanup_() {
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  // Reading the count without lock is safe for the same reasons as to_remove_ below
+  return this->wheel_count_;
+#else
   // Fast path: if nothing to remove, just return the current size
   // Reading to_remove_ without lock is safe because:
   // 1. We only call this from the main thread during call()
@@ -556,7 +693,9 @@ size_t HOT Scheduler::cleanup_() {
     this->pop_raw_();
   }
   return this->items_.size();
+#endif /* else USE_SCHEDULER_TIMER_WHEEL */
 }
+#ifndef USE_SCHEDULER_TIMER_WHEEL
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
 
@@ -565,11 +704,14 @@ void HOT Scheduler::pop_raw_() {
 
   this->items_.pop_back();
 }
+#endif
 
 // Helper to execute a scheduler item
 uint32_t HOT Scheduler::execute_item_(SchedulerItem *item, uint32_t now) {
   App.set_current_component(item->component);
-  WarnIfComponentBlockingGuard guard{item->component, now};
+  // An empty name tells an unnamed callback from a loop() call in the runtime profile
+  const char *name = item->get_name();
+  WarnIfComponentBlockingGuard guard{item->component, now, name != nullptr ? name : ""};
   item->callback();
   return guard.finish();
 }
@@ -596,32 +738,43 @@ bool HOT Scheduler::cancel_item_locked_(Component *component, const char *name_c
   size_t total_cancelled = 0;
 
   // Check all containers for matching items
-#ifndef ESPHOME_THREAD_SINGLE
+#ifdef ESPHOME_THREAD_MULTI_NO_ATOMICS
   // Mark items in defer queue as cancelled (they'll be skipped when processed)
   if (type == SchedulerItem::TIMEOUT) {
     total_cancelled += this->mark_matching_items_removed_(this->defer_queue_, component, name_cstr, type, match_retry);
   }
-#endif /* not ESPHOME_THREAD_SINGLE */
-
-  // Cancel items in the main heap
-  // Special case: if the last item in the heap matches, we can remove it immediately
-  // (removing the last element doesn't break heap structure)
-  if (!this->items_.empty()) {
-    auto &last_item = this->items_.back();
-    if (this->matches_item_(last_item, component, name_cstr, type, match_retry)) {
-      this->recycle_item_(std::move(this->items_.back()));
-      this->items_.pop_back();
+#endif /* ESPHOME_THREAD_MULTI_NO_ATOMICS */
+
+  // Items in items_ (or the timer wheel), to_add_ and named defers are found through the name index
+  const uint32_t key = name_index_key_(component, name_cstr);
+  SchedulerItem *item = this->name_index_head_(key);
+  while (item != nullptr) {
+    SchedulerItem *next = item->index_next;
+    if (item->name_hash == key && this->matches_item_(item, component, name_cstr, type, match_retry)) {
       total_cancelled++;
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+      if (item->scheduled) {
+        // Unlinking from the wheel is O(1), no need to leave it for a later cleanup
+        this->wheel_unlink_(item);
+        this->recycle_item_(std::unique_ptr<SchedulerItem>(item));
+        item = next;
+        continue;
+      }
+#else
+      // Items can't be removed from the middle of the heap, only marked for removal
+      if (item->scheduled)
+        this->to_remove_++;
+#endif
+      // Items in to_add_ are recycled by process_to_add(), a running item once its callback returns
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+      item->remove.store(true, std::memory_order_release);
+#else
+      item->remove = true;
+#endif
     }
-    // For other items in heap, we can only mark for removal (can't remove from middle of heap)
-    size_t heap_cancelled = this->mark_matching_items_removed_(this->items_, component, name_cstr, type, match_retry);
-    total_cancelled += heap_cancelled;
-    this->to_remove_ += heap_cancelled;  // Track removals for heap items
+    item = next;
   }
 
-  // Cancel items in to_add_
-  total_cancelled += this->mark_matching_items_removed_(this->to_add_, component, name_cstr, type, match_retry);
-
   return total_cancelled > 0;
 }
 
@@ -795,6 +948,9 @@ void Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
   if (!item)
     return;
 
+  if (item->index_pprev != nullptr)
+    this->name_index_remove_(item.get());
+
   if (this->scheduler_item_pool_.size() < MAX_POOL_SIZE) {
     // Clear callback to release captured resources
     item->callback = nullptr;
@@ -812,4 +968,244 @@ void Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
   // else: unique_ptr will delete the item when it goes out of scope
 }
 
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+void HOT Scheduler::defer_lock_free_(Component *component, std::function<void()> func) {
+  // Detach the whole free list so no other task can take the same item, then hand the rest back
+  SchedulerItem *item = this->defer_pool_.take_all();
+  if (item != nullptr) {
+    SchedulerItem *rest = item->defer_next;
+    if (rest != nullptr) {
+      SchedulerItem *last = rest;
+      while (last->defer_next != nullptr)
+        last = last->defer_next;
+      this->defer_pool_.push_chain(rest, last);
+    }
+    this->defer_pool_size_.fetch_sub(1, std::memory_order_relaxed);
+  } else {
+    item = new SchedulerItem();  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+
+  item->component = component;
+  item->set_name(nullptr);
+  item->type = SchedulerItem::TIMEOUT;
+  item->interval = 0;
+  item->callback = std::move(func);
+  item->remove.store(false, std::memory_order_relaxed);
+  item->is_retry = false;
+  item->scheduled = false;
+  this->defer_stack_.push(item);
+  wake_loop();
+}
+
+void Scheduler::recycle_defer_item_(SchedulerItem *item) {
+  // The name never changes once queued, unlike the index links which other tasks rewrite under the lock
+  if (item->get_name() != nullptr) {
+    // Named defers belong to the regular pool and the index, both protected by the lock
+    LockGuard guard{this->lock_};
+    this->recycle_item_(std::unique_ptr<SchedulerItem>(item));
+    return;
+  }
+  if (this->defer_pool_size_.load(std::memory_order_relaxed) >= MAX_POOL_SIZE) {
+    delete item;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
+  }
+  // Clear callback to release captured resources
+  item->callback = nullptr;
+  this->defer_pool_size_.fetch_add(1, std::memory_order_relaxed);
+  this->defer_pool_.push(item);
+}
+#endif /* ESPHOME_THREAD_MULTI_ATOMICS */
+
+uint32_t HOT Scheduler::name_index_key_(Component *component, const char *name_cstr) {
+  // Spread the component pointer over the name hash, pointers are aligned and differ in few bits
+  return fnv1_hash(name_cstr) ^ (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 0x9E3779B1UL);
+}
+
+void HOT Scheduler::name_index_insert_(SchedulerItem *item) {
+  // Keep the load factor at most 1, each bucket then holds a single item on average
+  if (this->name_index_count_ >= this->name_index_.size())
+    this->name_index_rehash_(std::max<size_t>(this->name_index_.size() * 2, MIN_NAME_INDEX_BUCKETS));
+  item->name_hash = name_index_key_(item->component, item->get_name());
+  SchedulerItem **head = &this->name_index_[item->name_hash & (this->name_index_.size() - 1)];
+  item->index_next = *head;
+  if (*head != nullptr)
+    (*head)->index_pprev = &item->index_next;
+  item->index_pprev = head;
+  *head = item;
+  this->name_index_count_++;
+}
+
+void HOT Scheduler::name_index_remove_(SchedulerItem *item) {
+  *item->index_pprev = item->index_next;
+  if (item->index_next != nullptr)
+    item->index_next->index_pprev = item->index_pprev;
+  item->index_next = nullptr;
+  item->index_pprev = nullptr;
+  this->name_index_count_--;
+}
+
+void Scheduler::name_index_rehash_(size_t bucket_count) {
+  std::vector<SchedulerItem *> buckets(bucket_count, nullptr);
+  for (SchedulerItem *item : this->name_index_) {
+    while (item != nullptr) {
+      SchedulerItem *next = item->index_next;
+      SchedulerItem **head = &buckets[item->name_hash & (bucket_count - 1)];
+      item->index_next = *head;
+      if (*head != nullptr)
+        (*head)->index_pprev = &item->index_next;
+      item->index_pprev = head;
+      *head = item;
+      item = next;
+    }
+  }
+  this->name_index_ = std::move(buckets);
+}
+
+bool HOT Scheduler::has_cancelled_retry_locked_(Component *component, const char *name_cstr) const {
+  const uint32_t key = name_index_key_(component, name_cstr);
+  for (SchedulerItem *item = this->name_index_head_(key); item != nullptr; item = item->index_next) {
+    if (item->name_hash == key && is_item_removed_(item) &&
+        this->matches_item_(item, component, name_cstr, SchedulerItem::TIMEOUT, /* match_retry= */ true,
+                            /* skip_removed= */ false)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+void HOT Scheduler::wheel_insert_(SchedulerItem *item) {
+  // Items already due go to the current slot and run on the next call()
+  const uint64_t expires = std::max(item->get_next_execution(), this->wheel_time_);
+  const uint64_t delta = expires - this->wheel_time_;
+
+  uint8_t level = 0;
+  while (level < WHEEL_LEVELS && delta >= (1ULL << (WHEEL_SLOT_BITS * (level + 1))))
+    level++;
+
+  uint16_t bucket = WHEEL_OVERFLOW_BUCKET;
+  if (level < WHEEL_LEVELS) {
+    const uint8_t slot = (expires >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+    bucket = level * WHEEL_SLOTS + slot;
+    this->wheel_occupied_[level] |= 1ULL << slot;
+  }
+
+  // Append, so items due at the same time run in the order they were scheduled
+  SchedulerItem *head = this->wheel_buckets_[bucket];
+  item->scheduled = true;
+  item->wheel_bucket = bucket;
+  item->wheel_next = nullptr;
+  if (head == nullptr) {
+    item->wheel_prev = item;
+    this->wheel_buckets_[bucket] = item;
+  } else {
+    item->wheel_prev = head->wheel_prev;
+    head->wheel_prev->wheel_next = item;
+    head->wheel_prev = item;
+  }
+  this->wheel_count_++;
+}
+
+void HOT Scheduler::wheel_unlink_(SchedulerItem *item) {
+  const uint16_t bucket = item->wheel_bucket;
+  SchedulerItem *head = this->wheel_buckets_[bucket];
+  if (item == head) {
+    this->wheel_buckets_[bucket] = item->wheel_next;
+    if (item->wheel_next != nullptr)
+      item->wheel_next->wheel_prev = item->wheel_prev;
+  } else {
+    item->wheel_prev->wheel_next = item->wheel_next;
+    // The head keeps track of the tail
+    (item->wheel_next != nullptr ? item->wheel_next : head)->wheel_prev = item->wheel_prev;
+  }
+  if (this->wheel_buckets_[bucket] == nullptr && bucket != WHEEL_OVERFLOW_BUCKET)
+    this->wheel_occupied_[bucket / WHEEL_SLOTS] &= ~(1ULL << (bucket % WHEEL_SLOTS));
+  item->scheduled = false;
+  item->wheel_next = nullptr;
+  item->wheel_prev = nullptr;
+  this->wheel_count_--;
+}
+
+Scheduler::SchedulerItem *HOT Scheduler::wheel_pop_due_(uint64_t now) {
+  while (true) {
+    SchedulerItem *item = this->wheel_buckets_[this->wheel_time_ & WHEEL_SLOT_MASK];
+    if (item != nullptr) {
+      this->wheel_unlink_(item);
+      return item;
+    }
+    if (this->wheel_time_ >= now)
+      return nullptr;
+    if (this->wheel_count_ == 0) {
+      // Nothing to cascade, catch up in one step
+      this->wheel_time_ = now;
+      return nullptr;
+    }
+
+    // Skip straight to the next occupied level 0 slot of this window, or to the end of the window
+    const uint8_t pos = this->wheel_time_ & WHEEL_SLOT_MASK;
+    const uint64_t ahead = pos == WHEEL_SLOT_MASK ? 0 : this->wheel_occupied_[0] & (~0ULL << (pos + 1));
+    const uint64_t next = ahead != 0 ? (this->wheel_time_ & ~WHEEL_SLOT_MASK) + __builtin_ctzll(ahead)
+                                     : (this->wheel_time_ | WHEEL_SLOT_MASK) + 1;
+    if (next > now) {
+      this->wheel_time_ = now;
+      return nullptr;
+    }
+    this->wheel_time_ = next;
+    if ((next & WHEEL_SLOT_MASK) == 0)
+      this->wheel_cascade_(next);
+  }
+}
+
+void Scheduler::wheel_cascade_(uint64_t t) {
+  for (uint8_t level = 1; level < WHEEL_LEVELS; level++) {
+    const uint8_t slot = (t >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+    this->wheel_cascade_bucket_(level * WHEEL_SLOTS + slot);
+    // Only a wrap-around of this level reaches the next one
+    if (slot != 0)
+      return;
+  }
+  this->wheel_cascade_bucket_(WHEEL_OVERFLOW_BUCKET);
+}
+
+void Scheduler::wheel_cascade_bucket_(uint16_t bucket) {
+  SchedulerItem *item = this->wheel_buckets_[bucket];
+  if (item == nullptr)
+    return;
+  this->wheel_buckets_[bucket] = nullptr;
+  if (bucket != WHEEL_OVERFLOW_BUCKET)
+    this->wheel_occupied_[bucket / WHEEL_SLOTS] &= ~(1ULL << (bucket % WHEEL_SLOTS));
+  while (item != nullptr) {
+    SchedulerItem *next = item->wheel_next;
+    this->wheel_count_--;
+    this->wheel_insert_(item);
+    item = next;
+  }
+}
+
+uint64_t HOT Scheduler::wheel_next_execution_() const {
+  const uint64_t window = this->wheel_time_ & ~WHEEL_SLOT_MASK;
+  const uint8_t pos = this->wheel_time_ & WHEEL_SLOT_MASK;
+  const uint64_t occupied = this->wheel_occupied_[0];
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  if (occupied & (1ULL << pos)) {
+    return this->wheel_time_;
+  }
+  const uint64_t ahead = pos == WHEEL_SLOT_MASK ? 0 : occupied & (~0ULL << (pos + 1));
+  if (ahead != 0) {
+    next = window + __builtin_ctzll(ahead);
+  } else if (occupied != 0) {
+    // Slots behind the current position belong to the next window
+    next = window + WHEEL_SLOTS + __builtin_ctzll(occupied);
+  }
+  // Higher levels are only known to the slot, wake up for the next cascade
+  bool upper_occupied = this->wheel_buckets_[WHEEL_OVERFLOW_BUCKET] != nullptr;
+  for (uint8_t level = 1; level < WHEEL_LEVELS; level++)
+    upper_occupied |= this->wheel_occupied_[level] != 0;
+  if (upper_occupied)
+    next = std::min(next, window + WHEEL_SLOTS);
+  return next;
+}
+
+#endif /* USE_SCHEDULER_TIMER_WHEEL */
+
 }  // namespace esphome
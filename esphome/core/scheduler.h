@@ -11,6 +11,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/lock_free_queue.h"
 
 namespace esphome {
 
@@ -84,6 +85,14 @@ class Scheduler {
 
   void process_to_add();
 
+  /// Snapshot of the scheduler queues, for diagnostics.
+  struct QueueDepths {
+    size_t timers;  // Pending timeouts and intervals, cancelled ones included until they are cleaned up
+    size_t to_add;  // Items scheduled from other tasks or during call(), merged on the next loop
+    size_t pooled;  // Recycled items kept for reuse
+  };
+  QueueDepths get_queue_depths();
+
  protected:
   struct SchedulerItem {
     // Ordered by size to minimize padding
@@ -110,19 +119,39 @@ class Scheduler {
     // Place atomic<bool> separately since it can't be packed with bit fields
     std::atomic<bool> remove{false};
 
-    // Bit-packed fields (3 bits used, 5 bits padding in 1 byte)
+    // Bit-packed fields (4 bits used, 4 bits padding in 1 byte)
     enum Type : uint8_t { TIMEOUT, INTERVAL } type : 1;
     bool name_is_dynamic : 1;  // True if name was dynamically allocated (needs delete[])
     bool is_retry : 1;         // True if this is a retry timeout
-                               // 5 bits padding
+    bool scheduled : 1;        // True while in items_ (or the timer wheel), false in to_add_ and the defer queue
+                               // 4 bits padding
 #else
     // Single-threaded or multi-threaded without atomics: can pack all fields together
-    // Bit-packed fields (4 bits used, 4 bits padding in 1 byte)
+    // Bit-packed fields (5 bits used, 3 bits padding in 1 byte)
     enum Type : uint8_t { TIMEOUT, INTERVAL } type : 1;
     bool remove : 1;
     bool name_is_dynamic : 1;  // True if name was dynamically allocated (needs delete[])
     bool is_retry : 1;         // True if this is a retry timeout
-                               // 4 bits padding
+    bool scheduled : 1;        // True while in items_ (or the timer wheel), false in to_add_ and the defer queue
+                               // 3 bits padding
+#endif
+
+    // Chain of the name index bucket holding this item, index_pprev is nullptr while the item isn't indexed
+    SchedulerItem *index_next{nullptr};
+    SchedulerItem **index_pprev{nullptr};
+    uint32_t name_hash{0};
+
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+    // Link of the lock-free defer stack, or of the free list of defer items
+    SchedulerItem *defer_next{nullptr};
+#endif
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+    // Intrusive links of the timer wheel bucket holding this item. The bucket head's wheel_prev points to the
+    // bucket tail so items can be appended and unlinked in O(1).
+    SchedulerItem *wheel_next{nullptr};
+    SchedulerItem *wheel_prev{nullptr};
+    uint16_t wheel_bucket{0};
 #endif
 
     // Constructor
@@ -135,12 +164,14 @@ class Scheduler {
           // remove is initialized in the member declaration as std::atomic<bool>{false}
           type(TIMEOUT),
           name_is_dynamic(false),
-          is_retry(false) {
+          is_retry(false),
+          scheduled(false) {
 #else
           type(TIMEOUT),
           remove(false),
           name_is_dynamic(false),
-          is_retry(false) {
+          is_retry(false),
+          scheduled(false) {
 #endif
       name_.static_name = nullptr;
     }
@@ -220,7 +251,9 @@ class Scheduler {
   // Returns the number of items remaining after cleanup
   // IMPORTANT: This method should only be called from the main thread (loop task).
   size_t cleanup_();
+#ifndef USE_SCHEDULER_TIMER_WHEEL
   void pop_raw_();
+#endif
 
  private:
   // Helper to cancel items by name - must be called with lock held
@@ -244,7 +277,7 @@ class Scheduler {
   }
 
   // Helper function to check if item matches criteria for cancellation
-  inline bool HOT matches_item_(const std::unique_ptr<SchedulerItem> &item, Component *component, const char *name_cstr,
+  inline bool HOT matches_item_(const SchedulerItem *item, Component *component, const char *name_cstr,
                                 SchedulerItem::Type type, bool match_retry, bool skip_removed = true) const {
     if (item->component != component || item->type != type || (skip_removed && item->remove) ||
         (match_retry && !item->is_retry)) {
@@ -252,6 +285,10 @@ class Scheduler {
     }
     return this->names_match_(item->get_name(), name_cstr);
   }
+  inline bool HOT matches_item_(const std::unique_ptr<SchedulerItem> &item, Component *component, const char *name_cstr,
+                                SchedulerItem::Type type, bool match_retry, bool skip_removed = true) const {
+    return this->matches_item_(item.get(), component, name_cstr, type, match_retry, skip_removed);
+  }
 
   // Helper to execute a scheduler item
   uint32_t execute_item_(SchedulerItem *item, uint32_t now);
@@ -264,6 +301,13 @@ class Scheduler {
   // Helper to recycle a SchedulerItem
   void recycle_item_(std::unique_ptr<SchedulerItem> item);
 
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+  // Queue an anonymous defer without taking lock_, it can't be cancelled so nothing else needs to find it
+  void defer_lock_free_(Component *component, std::function<void()> func);
+  // Return an executed defer item to the pool it came from, only called from the main thread
+  void recycle_defer_item_(SchedulerItem *item);
+#endif
+
   // Helper to check if item is marked for removal (platform-specific)
   // Returns true if item should be skipped, handles platform-specific synchronization
   // For ESPHOME_THREAD_MULTI_NO_ATOMICS platforms, the caller must hold the scheduler lock before calling this
@@ -306,27 +350,67 @@ class Scheduler {
     return count;
   }
 
-  // Template helper to check if any item in a container matches our criteria
-  template<typename Container>
-  bool has_cancelled_timeout_in_container_(const Container &container, Component *component, const char *name_cstr,
-                                           bool match_retry) const {
-    for (const auto &item : container) {
-      if (is_item_removed_(item.get()) &&
-          this->matches_item_(item, component, name_cstr, SchedulerItem::TIMEOUT, match_retry,
-                              /* skip_removed= */ false)) {
-        return true;
-      }
-    }
-    return false;
+  // Index of the named items in items_ (or the timer wheel) and to_add_, hashed by component and name so that
+  // cancelling or replacing a timer only looks at the items sharing its bucket. Cancelled items stay indexed until
+  // they are recycled so a cancelled retry can still be found. All index members are protected by lock_.
+  static uint32_t name_index_key_(Component *component, const char *name_cstr);
+  void name_index_insert_(SchedulerItem *item);
+  void name_index_remove_(SchedulerItem *item);
+  void name_index_rehash_(size_t bucket_count);
+  SchedulerItem *name_index_head_(uint32_t key) const {
+    return this->name_index_.empty() ? nullptr : this->name_index_[key & (this->name_index_.size() - 1)];
   }
+  // Check whether a retry timeout with this name was cancelled while it was pending or running
+  bool has_cancelled_retry_locked_(Component *component, const char *name_cstr) const;
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  // Hierarchical timing wheel with 1 ms ticks. Level n holds the items due within 64^(n+1) ms of wheel_time_ in
+  // slots of 64^n ms, which are cascaded one level down as wheel_time_ reaches them. Items due later than the top
+  // level can hold (~4.6 hours) wait in an overflow bucket that is re-sorted on every top level wrap.
+  // All wheel members are protected by lock_.
+  static constexpr uint8_t WHEEL_LEVELS = 4;
+  static constexpr uint8_t WHEEL_SLOT_BITS = 6;
+  static constexpr uint16_t WHEEL_SLOTS = 1 << WHEEL_SLOT_BITS;
+  static constexpr uint64_t WHEEL_SLOT_MASK = WHEEL_SLOTS - 1;
+  static constexpr uint16_t WHEEL_OVERFLOW_BUCKET = WHEEL_LEVELS * WHEEL_SLOTS;
+
+  // Link an item into the bucket matching its next execution, the wheel takes ownership
+  void wheel_insert_(SchedulerItem *item);
+  void wheel_unlink_(SchedulerItem *item);
+  // Advance wheel_time_ up to now and unlink the next item that is due, nullptr when none is
+  SchedulerItem *wheel_pop_due_(uint64_t now);
+  // Re-insert the items of the higher level slots reached at tick t
+  void wheel_cascade_(uint64_t t);
+  void wheel_cascade_bucket_(uint16_t bucket);
+  // Lower bound of the next execution time, only valid when the wheel holds items
+  uint64_t wheel_next_execution_() const;
+
+  SchedulerItem *wheel_buckets_[WHEEL_OVERFLOW_BUCKET + 1]{};
+  // One bit per non-empty slot of each level
+  uint64_t wheel_occupied_[WHEEL_LEVELS]{};
+  uint64_t wheel_time_{0};
+  size_t wheel_count_{0};
+#endif /* USE_SCHEDULER_TIMER_WHEEL */
 
   Mutex lock_;
+#ifndef USE_SCHEDULER_TIMER_WHEEL
   std::vector<std::unique_ptr<SchedulerItem>> items_;
+#endif
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
-#ifndef ESPHOME_THREAD_SINGLE
+  // Bucket heads of the name index, a power of two that grows with the number of indexed items
+  std::vector<SchedulerItem *> name_index_;
+  size_t name_index_count_{0};
+#ifdef ESPHOME_THREAD_MULTI_ATOMICS
+  // Deferred items pushed by any task, call() detaches and runs them in FIFO order. Named items are still created
+  // and cancelled under lock_ through the name index, anonymous ones never touch the lock.
+  LockFreeStack<SchedulerItem, &SchedulerItem::defer_next> defer_stack_;
+  // Free anonymous defer items, refilled by the main thread and taken by any task
+  LockFreeStack<SchedulerItem, &SchedulerItem::defer_next> defer_pool_;
+  std::atomic<uint8_t> defer_pool_size_{0};
+#elif !defined(ESPHOME_THREAD_SINGLE)
   // Single-core platforms don't need the defer queue and save 40 bytes of RAM
   std::deque<std::unique_ptr<SchedulerItem>> defer_queue_;  // FIFO queue for defer() calls
-#endif                                                      /* ESPHOME_THREAD_SINGLE */
+#endif
   uint32_t to_remove_{0};
 
   // Memory pool for recycling SchedulerItem objects to reduce heap churn.
@@ -550,6 +550,19 @@ def Pvariable(id_: ID, rhs: SafeExpType, type_: "MockObj" = None) -> "MockObj":
     return obj
 
 
+# Objects of these classes are never freed, so new_Pvariable() places them in the
+# setup arena (esphome/core/arena.h)
+SETUP_ARENA_CLASSES = ("Component", "EntityBase", "Trigger", "Automation")
+
+
+def uses_setup_arena(type_: "MockObj") -> bool:
+    """Whether new_Pvariable() allocates objects of this type from the setup arena."""
+    if not isinstance(type_, MockObjClass):
+        return False
+    # pylint: disable=protected-access
+    return any(str(cls) in SETUP_ARENA_CLASSES for cls in (type_, *type_._parents))
+
+
 def new_Pvariable(id_: ID, *args: SafeExpType) -> "MockObj":
     """Declare a new pointer variable in the code generation by calling it's constructor
     with the given arguments.
@@ -563,7 +576,10 @@ def new_Pvariable(id_: ID, *args: SafeExpType) -> "MockObj":
         id_ = id_.copy()
         id_.type = id_.type.template(args[0])
         args = args[1:]
-    rhs = id_.type.new(*args)
+    if uses_setup_arena(id_.type):
+        rhs = MockObj(f"new (setup_arena) {id_.type}", "->")(*args)
+    else:
+        rhs = id_.type.new(*args)
     return Pvariable(id_, rhs)
 
 
@@ -8,6 +8,7 @@ import logging
 from pathlib import Path
 import random
 import socket
+import struct
 import sys
 import time
 from typing import Any
@@ -27,6 +28,7 @@ RESPONSE_RECEIVE_OK = 0x44
 RESPONSE_UPDATE_END_OK = 0x45
 RESPONSE_SUPPORTS_COMPRESSION = 0x46
 RESPONSE_CHUNK_OK = 0x47
+RESPONSE_SUPPORTS_DELTA = 0x48
 
 RESPONSE_ERROR_MAGIC = 0x80
 RESPONSE_ERROR_UPDATE_PREPARE = 0x81
@@ -40,6 +42,7 @@ RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE = 0x88
 RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE = 0x89
 RESPONSE_ERROR_NO_UPDATE_PARTITION = 0x8A
 RESPONSE_ERROR_MD5_MISMATCH = 0x8B
+RESPONSE_ERROR_DELTA_BASE_MISMATCH = 0x8D
 RESPONSE_ERROR_UNKNOWN = 0xFF
 
 OTA_VERSION_1_0 = 1
@@ -49,11 +52,21 @@ MAGIC_BYTES = [0x6C, 0x26, 0xF7, 0x5C, 0x45]
 
 FEATURE_SUPPORTS_COMPRESSION = 0x01
 FEATURE_SUPPORTS_SHA256_AUTH = 0x02
+FEATURE_SUPPORTS_DELTA = 0x04
 
 
 UPLOAD_BLOCK_SIZE = 8192
 UPLOAD_BUFFER_SIZE = UPLOAD_BLOCK_SIZE * 8
 
+DELTA_MAGIC = b"EDLT"
+DELTA_DIGEST_SIZE = 32
+# Shortest run of the previous image worth a copy command
+DELTA_BLOCK_SIZE = 32
+# Offsets of the previous image that are indexed for matching
+DELTA_INDEX_STEP = 4
+DELTA_BASE_DIR = "ota-delta-base"
+DELTA_BASES_KEPT = 4
+
 _LOGGER = logging.getLogger(__name__)
 
 # Authentication method lookup table: response -> (hash_func, nonce_size, name)
@@ -210,6 +223,11 @@ def check_error(data: list[int] | bytes, expect: int | list[int] | None) -> None
             "Error: Application MD5 code mismatch. Please try again "
             "or flash over USB with a good quality cable."
         )
+    if dat == RESPONSE_ERROR_DELTA_BASE_MISMATCH:
+        raise OTAError(
+            "Error: The delta was not made against the firmware running on the ESP. "
+            "Please try again, a full image will be sent."
+        )
     if dat == RESPONSE_ERROR_UNKNOWN:
         raise OTAError("Unknown error from ESP")
     if not isinstance(expect, (list, tuple)):
@@ -241,6 +259,92 @@ def send_check(
         raise OTAError(f"Error sending {msg}: {err}") from err
 
 
+def image_digest(image: bytes) -> bytes | None:
+    """Return the SHA256 appended to an ESP32 app image.
+
+    This is what the device reports for its running image, None if the image has no
+    valid appended digest.
+    """
+    # esp_image_header_t starts with the 0xE9 magic, hash_appended is at offset 23
+    if len(image) < 24 + DELTA_DIGEST_SIZE or image[0] != 0xE9 or image[23] != 1:
+        return None
+    digest = image[-DELTA_DIGEST_SIZE:]
+    if hashlib.sha256(image[:-DELTA_DIGEST_SIZE]).digest() != digest:
+        return None
+    return digest
+
+
+def _append_delta_data(delta: bytearray, data: bytes) -> None:
+    if data:
+        delta += struct.pack("<BI", ord("D"), len(data))
+        delta += data
+
+
+def make_delta(base: bytes, base_digest: bytes, target: bytes) -> bytes:
+    """Encode target as copies from base and inserted data.
+
+    The format is decoded by OTADeltaDecoder in esphome/components/ota/ota_delta.h.
+    """
+    index: dict[bytes, int] = {}
+    for offset in range(0, len(base) - DELTA_BLOCK_SIZE + 1, DELTA_INDEX_STEP):
+        index.setdefault(base[offset : offset + DELTA_BLOCK_SIZE], offset)
+
+    delta = bytearray(DELTA_MAGIC + base_digest)
+    literal_start = 0
+    pos = 0
+    while pos + DELTA_BLOCK_SIZE <= len(target):
+        src = index.get(target[pos : pos + DELTA_BLOCK_SIZE])
+        if src is None:
+            pos += 1
+            continue
+        length = DELTA_BLOCK_SIZE
+        while pos + length < len(target) and src + length < len(base):
+            step = min(256, len(target) - pos - length, len(base) - src - length)
+            end = length + step
+            if target[pos + length : pos + end] == base[src + length : src + end]:
+                length = end
+                continue
+            while target[pos + length] == base[src + length]:
+                length += 1
+            break
+        _append_delta_data(delta, target[literal_start:pos])
+        delta += struct.pack("<BII", ord("C"), src, length)
+        pos += length
+        literal_start = pos
+    _append_delta_data(delta, target[literal_start:])
+    return bytes(delta)
+
+
+def _delta_base_path(filename: Path, digest: bytes) -> Path:
+    return Path(filename).parent / DELTA_BASE_DIR / f"{digest.hex()}.bin"
+
+
+def load_delta_base(filename: Path, digest: bytes) -> bytes | None:
+    """Return the previously uploaded image with the given digest, if it was kept."""
+    path = _delta_base_path(filename, digest)
+    if not path.is_file():
+        return None
+    base = path.read_bytes()
+    if image_digest(base) != digest:
+        return None
+    return base
+
+
+def store_delta_base(filename: Path, image: bytes) -> None:
+    """Keep an uploaded image so the next upload can be sent as a delta against it."""
+    if (digest := image_digest(image)) is None:
+        return
+    path = _delta_base_path(filename, digest)
+    try:
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_bytes(image)
+        bases = sorted(path.parent.glob("*.bin"), key=lambda p: p.stat().st_mtime)
+        for old in bases[:-DELTA_BASES_KEPT]:
+            old.unlink()
+    except OSError as err:
+        _LOGGER.debug("Could not keep image for delta updates: %s", err)
+
+
 def perform_ota(
     sock: socket.socket, password: str | None, file_handle: io.IOBase, filename: Path
 ) -> None:
@@ -260,8 +364,12 @@ def perform_ota(
             f"Device uses unsupported OTA version {version}, this ESPHome supports {supported_versions}"
         )
 
-    # Features - send both compression and SHA256 auth support
-    features_to_send = FEATURE_SUPPORTS_COMPRESSION | FEATURE_SUPPORTS_SHA256_AUTH
+    # Features - send compression, SHA256 auth and delta support
+    features_to_send = (
+        FEATURE_SUPPORTS_COMPRESSION
+        | FEATURE_SUPPORTS_SHA256_AUTH
+        | FEATURE_SUPPORTS_DELTA
+    )
     send_check(sock, features_to_send, "features")
     features = receive_exactly(
         sock,
@@ -270,9 +378,27 @@ def perform_ota(
         None,  # Accept any response
     )[0]
 
+    # Size of the image a delta builds, 0 when sending the full image
+    delta_image_size = 0
     if features == RESPONSE_SUPPORTS_COMPRESSION:
         upload_contents = gzip.compress(file_contents, compresslevel=9)
         _LOGGER.info("Compressed to %s bytes", len(upload_contents))
+    elif features == RESPONSE_SUPPORTS_DELTA:
+        running_digest = receive_exactly(
+            sock, DELTA_DIGEST_SIZE, "running image digest", None, decode=False
+        )
+        assert isinstance(running_digest, bytes)
+        base = load_delta_base(filename, running_digest)
+        if base is not None:
+            upload_contents = make_delta(base, running_digest, file_contents)
+            delta_image_size = file_size
+            _LOGGER.info(
+                "Sending delta against the running firmware (%s bytes)",
+                len(upload_contents),
+            )
+        else:
+            _LOGGER.info("Running firmware unknown, sending full image")
+            upload_contents = file_contents
     else:
         upload_contents = file_contents
 
@@ -333,9 +459,14 @@ def perform_ota(
         (upload_size >> 0) & 0xFF,
     ]
     send_check(sock, upload_size_encoded, "binary size")
+    if features == RESPONSE_SUPPORTS_DELTA:
+        send_check(sock, struct.pack(">I", delta_image_size), "image size")
     receive_exactly(sock, 1, "binary size", RESPONSE_UPDATE_PREPARE_OK)
 
-    upload_md5 = hashlib.md5(upload_contents).hexdigest()
+    # The device checks the MD5 of what it writes, for a delta that is the rebuilt image
+    upload_md5 = hashlib.md5(
+        file_contents if delta_image_size else upload_contents
+    ).hexdigest()
     _LOGGER.debug("MD5 of upload is %s", upload_md5)
 
     send_check(sock, upload_md5, "file checksum")
@@ -379,6 +510,8 @@ def perform_ota(
     send_check(sock, RESPONSE_OK, "end acknowledgement")
 
     _LOGGER.info("OTA successful")
+    if features == RESPONSE_SUPPORTS_DELTA:
+        store_delta_base(filename, file_contents)
 
     # Do not connect logs until it is fully on
     time.sleep(1)
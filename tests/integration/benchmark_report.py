@@ -0,0 +1,106 @@
+"""Collect benchmark results as JSON and compare them with a baseline run.
+
+``ESPHOME_BENCHMARK_OUTPUT`` names a JSON file every benchmark merges its
+section into. ``ESPHOME_BENCHMARK_BASELINE`` names the file of an earlier run;
+a metric that grew more than ``ESPHOME_BENCHMARK_TOLERANCE`` (default 1.5)
+times its baseline fails the benchmark. All metrics are lower-is-better.
+
+``run_comparison_benchmark`` drives the fixtures that check an optimized path
+against the code it replaced and time both.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import json
+import os
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+def find_regressions(
+    metrics: dict[str, float], baseline: dict[str, float], tolerance: float
+) -> list[str]:
+    """Return the metrics that grew beyond the tolerance."""
+    regressions: list[str] = []
+    for name, value in metrics.items():
+        if (base := baseline.get(name)) is None or base <= 0:
+            continue
+        ratio = value / base
+        print(f"{name}: {ratio:.2f}x baseline")
+        if ratio > tolerance:
+            regressions.append(f"{name}: {value:.1f}, baseline {base:.1f}")
+    return regressions
+
+
+def record_benchmark(section: str, metrics: dict[str, float]) -> None:
+    """Print the metrics, merge them into the output file and check the baseline."""
+    report = json.dumps(metrics, indent=2, sort_keys=True)
+    # Numbers depend on the host, print them for pytest -s
+    print(f"Benchmark {section}:\n{report}")
+
+    if output := os.environ.get("ESPHOME_BENCHMARK_OUTPUT"):
+        path = Path(output)
+        results = json.loads(path.read_text()) if path.exists() else {}
+        results[section] = metrics
+        path.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n")
+
+    if baseline_path := os.environ.get("ESPHOME_BENCHMARK_BASELINE"):
+        baseline = json.loads(Path(baseline_path).read_text()).get(section, {})
+        tolerance = float(os.environ.get("ESPHOME_BENCHMARK_TOLERANCE", "1.5"))
+        regressions = find_regressions(metrics, baseline, tolerance)
+        assert not regressions, f"{section} slower than baseline:\n" + "\n".join(
+            regressions
+        )
+
+
+async def run_comparison_benchmark(
+    section: str,
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> int:
+    """Run a fixture that times an optimized path against its reference, record both.
+
+    The ``run_benchmark`` action of the fixture logs
+    ``Benchmark ...: reference <us> us, optimized <us> us`` and then
+    ``Benchmark complete: <mismatches>/<count> mismatches``.
+    Returns the number of outputs that differ from the reference.
+    """
+    loop = asyncio.get_running_loop()
+    complete_future: asyncio.Future[int] = loop.create_future()
+    timings: dict[str, float] = {}
+
+    def on_log_line(line: str) -> None:
+        if match := re.search(r"reference (\d+) us, optimized (\d+) us", line):
+            timings["reference_us"] = int(match.group(1))
+            timings["optimized_us"] = int(match.group(2))
+        if (
+            match := re.search(r"Benchmark complete: (\d+)/\d+ mismatches", line)
+        ) and not complete_future.done():
+            complete_future.set_result(int(match.group(1)))
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        _, services = await client.list_entities_services()
+        run_benchmark: UserService | None = next(
+            (s for s in services if s.name == "run_benchmark"), None
+        )
+        assert run_benchmark is not None, "run_benchmark action not found"
+
+        client.execute_service(run_benchmark, {})
+        try:
+            mismatches = await asyncio.wait_for(complete_future, timeout=30.0)
+        except TimeoutError:
+            pytest.fail(f"{section} benchmark did not complete")
+
+    assert set(timings) == {"reference_us", "optimized_us"}
+    record_benchmark(section, timings)
+    return mismatches
@@ -0,0 +1,90 @@
+#include "chunked_job_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace chunked_job_component {
+
+static const char *const TAG = "chunked_job_component";
+
+static const uint32_t SLOW_STEPS = 40;
+static const uint32_t SLOW_STEP_MS = 5;
+
+static const char *state_to_str(ChunkedJobState state) {
+  switch (state) {
+    case ChunkedJobState::DONE:
+      return "DONE";
+    case ChunkedJobState::FAILED:
+      return "FAILED";
+    case ChunkedJobState::CANCELLED:
+      return "CANCELLED";
+    default:
+      return "OTHER";
+  }
+}
+
+void ChunkedJobComponent::watch_(ChunkedJob &job, const char *name, const uint32_t *steps) {
+  job.add_on_finish_callback([name, steps](ChunkedJobState state) {
+    ESP_LOGI(TAG, "Job %s finished: state=%s steps=%" PRIu32, name, state_to_str(state), *steps);
+  });
+}
+
+void ChunkedJobComponent::loop() { this->loop_passes_++; }
+
+void ChunkedJobComponent::start_failing_() {
+  this->watch_(this->failing_, "failing", &this->failing_steps_);
+  this->watch_(this->bystander_, "bystander", &this->bystander_steps_);
+  this->bystander_.start([this]() {
+    this->bystander_steps_++;
+    return ChunkResult::CONTINUE;
+  });
+  this->failing_.start([this]() {
+    if (++this->failing_steps_ == 2)
+      this->mark_failed();
+    return ChunkResult::CONTINUE;
+  });
+}
+
+void ChunkedJobComponent::setup() {
+  this->watch_(this->slow_, "slow", &this->slow_steps_);
+  this->slow_.add_on_progress_callback([](uint8_t progress) { ESP_LOGD(TAG, "Job slow progress %u%%", progress); });
+  this->slow_.add_on_finish_callback([this](ChunkedJobState state) {
+    ESP_LOGI(TAG, "Job slow slices=%" PRIu32 " max_steps_per_slice=%" PRIu32 " progress=%u", this->slow_slices_,
+             this->slow_max_steps_per_slice_, this->slow_.get_progress());
+    this->start_failing_();
+  });
+  this->slow_.start([this]() {
+    // The loop pass counter changes between two slices
+    if (this->slow_slice_pass_ != this->loop_passes_ || this->slow_slices_ == 0) {
+      this->slow_slice_pass_ = this->loop_passes_;
+      this->slow_slices_++;
+      this->slow_slice_steps_ = 0;
+    }
+    this->slow_slice_steps_++;
+    this->slow_max_steps_per_slice_ = std::max(this->slow_max_steps_per_slice_, this->slow_slice_steps_);
+    delay(SLOW_STEP_MS);
+    this->slow_steps_++;
+    this->slow_.set_progress(this->slow_steps_, SLOW_STEPS);
+    return this->slow_steps_ < SLOW_STEPS ? ChunkResult::CONTINUE : ChunkResult::DONE;
+  });
+
+  this->watch_(this->cancel_continue_, "cancel_continue", &this->cancel_continue_steps_);
+  this->cancel_continue_.start([this]() {
+    if (++this->cancel_continue_steps_ == 3)
+      this->cancel_continue_.cancel();
+    return ChunkResult::CONTINUE;
+  });
+
+  this->watch_(this->cancel_done_, "cancel_done", &this->cancel_done_steps_);
+  this->cancel_done_.start([this]() {
+    if (++this->cancel_done_steps_ < 3)
+      return ChunkResult::CONTINUE;
+    this->cancel_done_.cancel();
+    return ChunkResult::DONE;
+  });
+}
+
+}  // namespace chunked_job_component
+}  // namespace esphome
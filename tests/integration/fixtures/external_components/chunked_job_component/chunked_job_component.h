@@ -0,0 +1,42 @@
+#pragma once
+
+#include "esphome/core/chunked_job.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace chunked_job_component {
+
+class ChunkedJobComponent : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+ protected:
+  void watch_(ChunkedJob &job, const char *name, const uint32_t *steps);
+  void start_failing_();
+
+  // Runs to the end in slices of a few slow steps
+  ChunkedJob slow_{this, "slow"};
+  uint32_t slow_steps_{0};
+  uint32_t slow_slices_{0};
+  uint32_t slow_max_steps_per_slice_{0};
+  uint32_t slow_slice_steps_{0};
+  uint32_t slow_slice_pass_{0};
+  uint32_t loop_passes_{0};
+  // Cancelled from its own step, which keeps asking for more
+  ChunkedJob cancel_continue_{this, "cancel_continue"};
+  uint32_t cancel_continue_steps_{0};
+  // Cancelled from its own step, which then reports it is done
+  ChunkedJob cancel_done_{this, "cancel_done"};
+  uint32_t cancel_done_steps_{0};
+  // Started once slow is done, marks the component failed from its step
+  ChunkedJob failing_{this, "failing"};
+  uint32_t failing_steps_{0};
+  // Runs next to failing, ends with the component
+  ChunkedJob bystander_{this, "bystander"};
+  uint32_t bystander_steps_{0};
+};
+
+}  // namespace chunked_job_component
+}  // namespace esphome
@@ -0,0 +1,125 @@
+#include "core_benchmark_component.h"
+#include "esphome/components/api/api_pb2.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace core_benchmark_component {
+
+static const char *const TAG = "core_benchmark";
+// Separate tag so the test can tell the formatted lines from the reports
+static const char *const TAG_LOG = "core_benchmark.log";
+
+static const uint32_t SCHEDULER_ITEMS = 2000;
+static const uint32_t SCHEDULER_CALLS = 2000;
+static const uint32_t CALLBACK_CALLS = 100000;
+static const uint32_t CALLBACK_LISTENERS = 8;
+static const uint32_t PROTO_MESSAGES = 100000;
+static const uint32_t SENSOR_STATES = 20000;
+static const uint32_t LOG_LINES = 500;
+
+// Keeps the compiler from dropping the measured work
+static volatile uint32_t sink;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void CoreBenchmarkComponent::setup() {
+  ESP_LOGI(TAG, "Core benchmark component loaded");
+  this->names_.reserve(SCHEDULER_ITEMS);
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    this->names_.push_back("bench_" + std::to_string(i));
+}
+
+void CoreBenchmarkComponent::report_(const char *name, uint32_t ops, uint32_t start_us) {
+  ESP_LOGI(TAG, "Benchmark %s: %" PRIu32 " ops in %" PRIu32 " us", name, ops, micros() - start_us);
+}
+
+void CoreBenchmarkComponent::run_benchmark() {
+  ESP_LOGI(TAG, "Starting core benchmark...");
+  this->bench_callbacks_();
+  this->bench_proto_encode_();
+  this->bench_sensor_filters_();
+  this->bench_logger_();
+  // Last, the scheduler finishes the run from its own callbacks
+  this->bench_scheduler_();
+}
+
+void CoreBenchmarkComponent::bench_scheduler_() {
+  // Far enough out that none of them fires, the scheduler keeps them all pending
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    App.scheduler.set_timeout(this, this->names_[i], 600000 + i, []() {});
+  this->report_("scheduler_set", SCHEDULER_ITEMS, start);
+
+  start = micros();
+  uint32_t cancelled = 0;
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++) {
+    if (App.scheduler.cancel_timeout(this, this->names_[i]))
+      cancelled++;
+  }
+  this->report_("scheduler_cancel", cancelled, start);
+
+  // The deferred items all run back to back in the next Scheduler::call(), time them from the first to the last
+  this->calls_ = 0;
+  for (uint32_t i = 0; i < SCHEDULER_CALLS; i++) {
+    this->defer([this]() {
+      if (this->calls_++ == 0)
+        this->call_start_ = micros();
+      if (this->calls_ == SCHEDULER_CALLS) {
+        this->report_("scheduler_call", SCHEDULER_CALLS - 1, this->call_start_);
+        ESP_LOGI(TAG, "Benchmark complete");
+      }
+    });
+  }
+}
+
+void CoreBenchmarkComponent::bench_callbacks_() {
+  CallbackManager<void(float)> callbacks;
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < CALLBACK_LISTENERS; i++)
+    callbacks.add([&total](float value) { total += static_cast<uint32_t>(value); });
+
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < CALLBACK_CALLS; i++)
+    callbacks.call(static_cast<float>(i & 0xFF));
+  this->report_("callback_dispatch", CALLBACK_CALLS * CALLBACK_LISTENERS, start);
+  sink = total;
+}
+
+void CoreBenchmarkComponent::bench_proto_encode_() {
+  api::SensorStateResponse msg;
+  msg.key = 0x12345678;
+  msg.state = 1.5f;
+  api::ProtoSize size;
+  msg.calculate_size(size);
+  std::vector<uint8_t> buf(size.get_size());
+
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < PROTO_MESSAGES; i++) {
+    // Any non zero state keeps the size the same
+    msg.state = static_cast<float>(i) + 1.5f;
+    api::ProtoWriteBuffer buffer(&buf, 0);
+    msg.encode(buffer);
+  }
+  this->report_("proto_encode", PROTO_MESSAGES, start);
+  sink = buf[buf.size() - 1];
+}
+
+void CoreBenchmarkComponent::bench_sensor_filters_() {
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < SENSOR_STATES; i++)
+    this->sensor_->publish_state(static_cast<float>(i % 100));
+  this->report_("sensor_filters", SENSOR_STATES, start);
+}
+
+void CoreBenchmarkComponent::bench_logger_() {
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < LOG_LINES; i++)
+    ESP_LOGD(TAG_LOG, "Line %" PRIu32 " value %.2f name %s", i, i * 0.25f, this->names_[i].c_str());
+  this->report_("logger_format", LOG_LINES, start);
+}
+
+}  // namespace core_benchmark_component
+}  // namespace esphome
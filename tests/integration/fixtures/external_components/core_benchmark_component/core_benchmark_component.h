@@ -0,0 +1,38 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace core_benchmark_component {
+
+/// Times the core primitives on the host, one "Benchmark <name>: <ops> ops in <us> us" line per benchmark.
+class CoreBenchmarkComponent : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  /// Sensor with the filter chain to publish through.
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+
+  void run_benchmark();
+
+ protected:
+  void report_(const char *name, uint32_t ops, uint32_t start_us);
+  void bench_scheduler_();
+  void bench_callbacks_();
+  void bench_proto_encode_();
+  void bench_sensor_filters_();
+  void bench_logger_();
+
+  sensor::Sensor *sensor_{nullptr};
+  std::vector<std::string> names_;
+  uint32_t call_start_{0};
+  uint32_t calls_{0};
+};
+
+}  // namespace core_benchmark_component
+}  // namespace esphome
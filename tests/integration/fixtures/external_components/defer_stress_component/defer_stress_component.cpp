@@ -3,6 +3,7 @@
 #include <thread>
 #include <atomic>
 #include <vector>
+#include <algorithm>
 #include <chrono>
 
 namespace esphome {
@@ -71,5 +72,47 @@ void DeferStressComponent::run_multi_thread_test() {
   ESP_LOGI(TAG, "All threads finished in %lldms. Created %d defer requests", thread_time, this->total_defers_.load());
 }
 
+void DeferStressComponent::run_throughput_test() {
+  this->total_defers_ = 0;
+  this->executed_defers_ = 0;
+  static constexpr int NUM_THREADS = 8;
+  static constexpr int DEFERS_PER_THREAD = 5000;
+  static constexpr int TOTAL_DEFERS = NUM_THREADS * DEFERS_PER_THREAD;
+
+  ESP_LOGI(TAG, "Starting defer throughput test - %d threads, %d defers each", NUM_THREADS, DEFERS_PER_THREAD);
+
+  auto now_us = []() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  };
+  this->throughput_start_us_ = now_us();
+
+  std::vector<std::thread> threads;
+  threads.reserve(NUM_THREADS);
+  for (int i = 0; i < NUM_THREADS; i++) {
+    threads.emplace_back([this, now_us]() {
+      // No delays and no logging, the producers only contend on defer() itself
+      for (int j = 0; j < DEFERS_PER_THREAD; j++) {
+        this->total_defers_.fetch_add(1, std::memory_order_relaxed);
+        this->defer([this, now_us]() {
+          if (this->executed_defers_.fetch_add(1) + 1 == TOTAL_DEFERS) {
+            int64_t elapsed_us = now_us() - this->throughput_start_us_;
+            ESP_LOGI(TAG, "Throughput: executed %d defers in %lldus (%lld defers/ms)", TOTAL_DEFERS,
+                     (long long) elapsed_us, (long long) (TOTAL_DEFERS * 1000LL / std::max<int64_t>(elapsed_us, 1)));
+          }
+        });
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  int64_t producer_us = now_us() - this->throughput_start_us_;
+  ESP_LOGI(TAG, "Throughput: %d threads queued %d defers in %lldus", NUM_THREADS, this->total_defers_.load(),
+           (long long) producer_us);
+}
+
 }  // namespace defer_stress_component
 }  // namespace esphome
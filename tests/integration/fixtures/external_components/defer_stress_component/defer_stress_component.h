@@ -10,10 +10,12 @@ class DeferStressComponent : public Component {
  public:
   void setup() override;
   void run_multi_thread_test();
+  void run_throughput_test();
 
  private:
   std::atomic<int> total_defers_{0};
   std::atomic<int> executed_defers_{0};
+  int64_t throughput_start_us_{0};
 };
 
 }  // namespace defer_stress_component
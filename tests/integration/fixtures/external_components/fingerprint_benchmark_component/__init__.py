@@ -0,0 +1,34 @@
+import esphome.codegen as cg
+from esphome.components.fingerprint_FPC2532 import FingerprintFPC2532Component
+from esphome.components.fingerprint_simulator import FingerprintSimulator
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["fingerprint_FPC2532", "fingerprint_simulator"]
+
+CONF_READER_ID = "reader_id"
+CONF_SIMULATOR_ID = "simulator_id"
+
+fingerprint_benchmark_component_ns = cg.esphome_ns.namespace(
+    "fingerprint_benchmark_component"
+)
+FingerprintBenchmarkComponent = fingerprint_benchmark_component_ns.class_(
+    "FingerprintBenchmarkComponent", cg.Component
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(FingerprintBenchmarkComponent),
+        cv.Required(CONF_READER_ID): cv.use_id(FingerprintFPC2532Component),
+        cv.Required(CONF_SIMULATOR_ID): cv.use_id(FingerprintSimulator),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    reader = await cg.get_variable(config[CONF_READER_ID])
+    cg.add(var.set_reader(reader))
+    simulator = await cg.get_variable(config[CONF_SIMULATOR_ID])
+    cg.add(var.set_simulator(simulator))
@@ -0,0 +1,144 @@
+#include "fingerprint_benchmark_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace esphome {
+namespace fingerprint_benchmark_component {
+
+static const char *const TAG = "fingerprint_benchmark";
+
+// Templates enrolled in the simulator, the cycles alternate between them
+static const uint16_t FINGER_IDS[] = {1, 2};
+// Pause between the finger lifting and the next touch, lets the reader re-arm identify
+static const uint32_t SETTLE_MS = 300;
+// A cycle without a match after this long counts as failed
+static const uint32_t CYCLE_TIMEOUT_MS = 5000;
+
+static size_t heap_in_use() {
+#ifdef __GLIBC__
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+
+static uint32_t percentile(std::vector<uint32_t> values, uint8_t percent) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  size_t rank = (values.size() * percent + 99) / 100;
+  return values[rank == 0 ? 0 : rank - 1];
+}
+
+void FingerprintBenchmarkComponent::setup() {
+  this->reader_->add_on_finger_scan_matched_callback([this](uint16_t finger_id, uint16_t confidence) {
+    if (this->state_ == State::TOUCHED)
+      this->finish_cycle_(true);
+  });
+  this->reader_->add_on_finger_scan_unmatched_callback([this]() {
+    if (this->state_ == State::TOUCHED)
+      this->finish_cycle_(false);
+  });
+  this->disable_loop();
+}
+
+void FingerprintBenchmarkComponent::run_benchmark(uint32_t cycles, uint32_t latency_ms, uint32_t match_time_ms) {
+  if (this->state_ != State::IDLE) {
+    ESP_LOGW(TAG, "Benchmark already running");
+    return;
+  }
+  ESP_LOGI(TAG, "Starting fingerprint benchmark: %" PRIu32 " cycles, latency %" PRIu32 " ms, match time %" PRIu32 " ms",
+           cycles, latency_ms, match_time_ms);
+  this->simulator_->set_latency_ms(latency_ms);
+  this->simulator_->set_match_time_ms(match_time_ms);
+  this->cycles_ = cycles;
+  this->cycle_ = 0;
+  this->matched_ = 0;
+  this->latencies_us_.clear();
+  this->latencies_us_.reserve(cycles);
+  this->stalls_us_.clear();
+  this->stalls_us_.reserve(cycles);
+  this->heap_start_ = heap_in_use();
+  this->heap_peak_ = this->heap_start_;
+
+  // Without the idle sleep the time between two loop() calls is one main loop iteration
+  this->high_freq_.start();
+  this->last_loop_us_ = micros();
+  this->state_ = State::SETTLING;
+  this->state_start_ms_ = millis();
+  this->enable_loop();
+}
+
+void FingerprintBenchmarkComponent::loop() {
+  const uint32_t now_us = micros();
+  this->cycle_stall_us_ = std::max(this->cycle_stall_us_, now_us - this->last_loop_us_);
+  this->last_loop_us_ = now_us;
+  this->heap_peak_ = std::max(this->heap_peak_, heap_in_use());
+
+  const uint32_t now = millis();
+  switch (this->state_) {
+    case State::IDLE:
+      this->disable_loop();
+      break;
+    case State::SETTLING:
+      if (!this->simulator_->is_finger_down() && now - this->state_start_ms_ >= SETTLE_MS)
+        this->start_cycle_();
+      break;
+    case State::TOUCHED:
+      if (now - this->state_start_ms_ >= CYCLE_TIMEOUT_MS) {
+        ESP_LOGW(TAG, "Cycle %" PRIu32 " timed out", this->cycle_);
+        this->finish_cycle_(false);
+      }
+      break;
+  }
+}
+
+void FingerprintBenchmarkComponent::start_cycle_() {
+  if (this->cycle_ == this->cycles_) {
+    this->report_();
+    return;
+  }
+  this->cycle_stall_us_ = 0;
+  this->state_ = State::TOUCHED;
+  this->state_start_ms_ = millis();
+  this->touch_us_ = micros();
+  this->simulator_->touch(FINGER_IDS[this->cycle_ % 2]);
+}
+
+void FingerprintBenchmarkComponent::finish_cycle_(bool matched) {
+  uint32_t latency_us = micros() - this->touch_us_;
+  if (matched) {
+    this->matched_++;
+    this->latencies_us_.push_back(latency_us);
+  }
+  this->stalls_us_.push_back(this->cycle_stall_us_);
+  ESP_LOGD(TAG, "Cycle %" PRIu32 ": %s after %" PRIu32 " us, longest loop %" PRIu32 " us", this->cycle_,
+           matched ? "matched" : "failed", latency_us, this->cycle_stall_us_);
+  this->cycle_++;
+  this->state_ = State::SETTLING;
+  this->state_start_ms_ = millis();
+}
+
+void FingerprintBenchmarkComponent::report_() {
+  this->high_freq_.stop();
+  this->state_ = State::IDLE;
+  const size_t heap_end = heap_in_use();
+
+  ESP_LOGI(TAG, "Benchmark latency: p50 %" PRIu32 " us, p95 %" PRIu32 " us, max %" PRIu32 " us",
+           percentile(this->latencies_us_, 50), percentile(this->latencies_us_, 95),
+           percentile(this->latencies_us_, 100));
+  ESP_LOGI(TAG, "Benchmark stall: p50 %" PRIu32 " us, max %" PRIu32 " us", percentile(this->stalls_us_, 50),
+           percentile(this->stalls_us_, 100));
+  ESP_LOGI(TAG, "Benchmark heap: start %zu, peak %zu, end %zu bytes", this->heap_start_, this->heap_peak_, heap_end);
+  ESP_LOGI(TAG, "Benchmark complete: %" PRIu32 "/%" PRIu32 " matched", this->matched_, this->cycles_);
+}
+
+}  // namespace fingerprint_benchmark_component
+}  // namespace esphome
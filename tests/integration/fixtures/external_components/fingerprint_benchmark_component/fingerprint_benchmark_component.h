@@ -0,0 +1,58 @@
+#pragma once
+
+#include "esphome/components/fingerprint_base/fingerprint_reader.h"
+#include "esphome/components/fingerprint_simulator/fingerprint_simulator.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <vector>
+
+namespace esphome {
+namespace fingerprint_benchmark_component {
+
+/// Drives identify cycles through a simulated reader and reports the touch to match latency, the longest main loop
+/// iteration and the heap in use.
+class FingerprintBenchmarkComponent : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_reader(fingerprint_base::FingerprintReader *reader) { this->reader_ = reader; }
+  void set_simulator(fingerprint_simulator::FingerprintSimulator *simulator) { this->simulator_ = simulator; }
+
+  /// Runs cycles touches with the sensor answering after latency_ms and matching in match_time_ms.
+  void run_benchmark(uint32_t cycles, uint32_t latency_ms, uint32_t match_time_ms);
+
+ protected:
+  enum class State : uint8_t {
+    IDLE,
+    /// Waiting for the finger of the last cycle to lift and the reader to settle.
+    SETTLING,
+    /// A finger is down, waiting for the match.
+    TOUCHED,
+  };
+
+  void start_cycle_();
+  void finish_cycle_(bool matched);
+  void report_();
+
+  fingerprint_base::FingerprintReader *reader_{nullptr};
+  fingerprint_simulator::FingerprintSimulator *simulator_{nullptr};
+  HighFrequencyLoopRequester high_freq_;
+  State state_{State::IDLE};
+  uint32_t cycles_{0};
+  uint32_t cycle_{0};
+  uint32_t matched_{0};
+  uint32_t state_start_ms_{0};
+  uint32_t touch_us_{0};
+  uint32_t last_loop_us_{0};
+  uint32_t cycle_stall_us_{0};
+  size_t heap_start_{0};
+  size_t heap_peak_{0};
+  std::vector<uint32_t> latencies_us_;
+  std::vector<uint32_t> stalls_us_;
+};
+
+}  // namespace fingerprint_benchmark_component
+}  // namespace esphome
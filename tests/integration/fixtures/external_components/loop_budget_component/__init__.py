@@ -0,0 +1,35 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_NAME
+
+CODEOWNERS = ["@esphome/tests"]
+
+CONF_BUSY_TIME = "busy_time"
+CONF_LATENCY_CRITICAL = "latency_critical"
+
+loop_budget_component_ns = cg.esphome_ns.namespace("loop_budget_component")
+LoopBudgetComponent = loop_budget_component_ns.class_(
+    "LoopBudgetComponent", cg.Component
+)
+
+CONFIG_SCHEMA = cv.ensure_list(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(LoopBudgetComponent),
+            cv.Required(CONF_NAME): cv.string,
+            cv.Optional(
+                CONF_BUSY_TIME, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_LATENCY_CRITICAL, default=False): cv.boolean,
+        }
+    ).extend(cv.COMPONENT_SCHEMA)
+)
+
+
+async def to_code(config):
+    for conf in config:
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+        cg.add(var.set_name(conf[CONF_NAME]))
+        cg.add(var.set_busy_time(conf[CONF_BUSY_TIME]))
+        cg.add(var.set_latency_critical(conf[CONF_LATENCY_CRITICAL]))
@@ -0,0 +1,21 @@
+#include "loop_budget_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace loop_budget_component {
+
+static const char *const TAG = "loop_budget_component";
+
+void LoopBudgetComponent::loop() {
+  this->loop_count_++;
+  if (this->busy_time_ > 0) {
+    // Stands in for a slow display or bus transaction that holds the main loop
+    delay(this->busy_time_);
+  }
+}
+
+void LoopBudgetComponent::report() { ESP_LOGI(TAG, "Loop count %s: %" PRIu32, this->name_, this->loop_count_); }
+
+}  // namespace loop_budget_component
+}  // namespace esphome
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace loop_budget_component {
+
+class LoopBudgetComponent : public Component {
+ public:
+  void loop() override;
+  LoopClass get_loop_class() const override {
+    return this->latency_critical_ ? LoopClass::LATENCY_CRITICAL : LoopClass::NORMAL;
+  }
+
+  void set_name(const char *name) { this->name_ = name; }
+  void set_busy_time(uint32_t busy_time) { this->busy_time_ = busy_time; }
+  void set_latency_critical(bool latency_critical) { this->latency_critical_ = latency_critical; }
+
+  void report();
+
+ protected:
+  const char *name_{""};
+  uint32_t busy_time_{0};
+  uint32_t loop_count_{0};
+  bool latency_critical_{false};
+};
+
+}  // namespace loop_budget_component
+}  // namespace esphome
@@ -0,0 +1,30 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/tests"]
+
+CONF_IO_TIME = "io_time"
+
+parallel_setup_component_ns = cg.esphome_ns.namespace("parallel_setup_component")
+ParallelSetupComponent = parallel_setup_component_ns.class_(
+    "ParallelSetupComponent", cg.Component
+)
+
+CONFIG_SCHEMA = cv.ensure_list(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ParallelSetupComponent),
+            cv.Optional(
+                CONF_IO_TIME, default="200ms"
+            ): cv.positive_time_period_milliseconds,
+        }
+    ).extend(cv.COMPONENT_SCHEMA)
+)
+
+
+async def to_code(config):
+    for conf in config:
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+        cg.add(var.set_io_time(conf[CONF_IO_TIME]))
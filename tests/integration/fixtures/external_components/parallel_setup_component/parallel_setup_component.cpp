@@ -0,0 +1,19 @@
+#include "parallel_setup_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace parallel_setup_component {
+
+static const char *const TAG = "parallel_setup_component";
+
+void ParallelSetupComponent::setup_io() {
+  // Stands in for a reader that needs a while to come out of reset
+  delay(this->io_time_);
+  this->io_done_ = true;
+}
+
+void ParallelSetupComponent::setup() { ESP_LOGI(TAG, "Setup after io: %s", YESNO(this->io_done_)); }
+
+}  // namespace parallel_setup_component
+}  // namespace esphome
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace parallel_setup_component {
+
+class ParallelSetupComponent : public Component {
+ public:
+  bool has_setup_io() const override { return true; }
+  void setup_io() override;
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_io_time(uint32_t io_time) { this->io_time_ = io_time; }
+
+ protected:
+  uint32_t io_time_{0};
+  bool io_done_{false};
+};
+
+}  // namespace parallel_setup_component
+}  // namespace esphome
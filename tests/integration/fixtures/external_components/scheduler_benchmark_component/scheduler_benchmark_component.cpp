@@ -0,0 +1,83 @@
+#include "scheduler_benchmark_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace scheduler_benchmark_component {
+
+static const char *const TAG = "scheduler_benchmark";
+
+// Large enough for the heap rebuilds and linear scans to show up in the timings
+static const int BENCHMARK_ITEMS = 2000;
+static const int BENCHMARK_SHORT_ITEMS = 200;
+static const int BENCHMARK_INTERVALS = 10;
+static const int BENCHMARK_INTERVAL_RUNS = 5;
+
+void SchedulerBenchmarkComponent::setup() {
+  ESP_LOGI(TAG, "Scheduler benchmark component loaded");
+  this->names_.reserve(BENCHMARK_ITEMS);
+  for (int i = 0; i < BENCHMARK_ITEMS; i++)
+    this->names_.push_back("bench_" + std::to_string(i));
+}
+
+void SchedulerBenchmarkComponent::log_phase_(const char *phase, uint32_t start_us) {
+  ESP_LOGI(TAG, "Benchmark %s: %d items in %" PRIu32 " us", phase, BENCHMARK_ITEMS, micros() - start_us);
+}
+
+void SchedulerBenchmarkComponent::run_benchmark() {
+  ESP_LOGI(TAG, "Starting scheduler benchmark...");
+
+  // Long timeouts spread over minutes, none of them may fire
+  uint32_t start = micros();
+  for (int i = 0; i < BENCHMARK_ITEMS; i++) {
+    App.scheduler.set_timeout(this, this->names_[i], 60000 + random_uint32() % 240000,
+                              [i]() { ESP_LOGW(TAG, "Long timeout %d executed - this should not happen!", i); });
+  }
+  this->log_phase_("schedule", start);
+
+  // Re-arming a name replaces the pending timeout
+  start = micros();
+  for (int i = 0; i < BENCHMARK_ITEMS; i++) {
+    App.scheduler.set_timeout(this, this->names_[i], 60000 + random_uint32() % 240000,
+                              [i]() { ESP_LOGW(TAG, "Replaced timeout %d executed - this should not happen!", i); });
+  }
+  this->log_phase_("replace", start);
+
+  start = micros();
+  int cancelled = 0;
+  for (int i = 0; i < BENCHMARK_ITEMS; i++) {
+    if (App.scheduler.cancel_timeout(this, this->names_[i]))
+      cancelled++;
+  }
+  this->log_phase_("cancel", start);
+  ESP_LOGI(TAG, "Benchmark cancelled %d/%d", cancelled, BENCHMARK_ITEMS);
+
+  // Short timeouts and intervals must all still fire after the churn above
+  this->short_fired_ = 0;
+  this->interval_fired_ = 0;
+  for (int i = 0; i < BENCHMARK_SHORT_ITEMS; i++) {
+    App.scheduler.set_timeout(this, this->names_[i], 1 + random_uint32() % 200, [this]() {
+      this->short_fired_++;
+      if (this->short_fired_ == BENCHMARK_SHORT_ITEMS)
+        ESP_LOGI(TAG, "Benchmark fired %d/%d", this->short_fired_, BENCHMARK_SHORT_ITEMS);
+    });
+  }
+  for (int i = 0; i < BENCHMARK_INTERVALS; i++) {
+    std::string name = "bench_interval_" + std::to_string(i);
+    App.scheduler.set_interval(this, name, 10 + i * 5, [this, name, runs = 0]() mutable {
+      this->interval_fired_++;
+      if (++runs == BENCHMARK_INTERVAL_RUNS)
+        App.scheduler.cancel_interval(this, name);
+    });
+  }
+
+  // Well past the last short timeout and the last interval run
+  App.scheduler.set_timeout(this, "bench_done", 500, [this]() {
+    ESP_LOGI(TAG, "Benchmark intervals fired %d", this->interval_fired_);
+    ESP_LOGI(TAG, "Benchmark complete: %d/%d short timeouts fired", this->short_fired_, BENCHMARK_SHORT_ITEMS);
+  });
+}
+
+}  // namespace scheduler_benchmark_component
+}  // namespace esphome
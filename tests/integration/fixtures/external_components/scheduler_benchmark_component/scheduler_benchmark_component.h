@@ -0,0 +1,28 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/application.h"
+
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace scheduler_benchmark_component {
+
+class SchedulerBenchmarkComponent : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void run_benchmark();
+
+ protected:
+  void log_phase_(const char *phase, uint32_t start_us);
+
+  std::vector<std::string> names_;
+  int short_fired_{0};
+  int interval_fired_{0};
+};
+
+}  // namespace scheduler_benchmark_component
+}  // namespace esphome
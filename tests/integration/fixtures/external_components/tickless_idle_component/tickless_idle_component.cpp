@@ -0,0 +1,41 @@
+#include "tickless_idle_component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <chrono>
+#include <thread>
+
+namespace esphome {
+namespace tickless_idle_component {
+
+static const char *const TAG = "tickless_idle_component";
+
+void TicklessIdleComponent::setup() {
+  // Nothing else loops on host, so the application goes idle until a scheduler item or a wakeup
+  this->disable_loop();
+
+  const uint32_t setup_time = millis();
+  this->set_timeout("deadline", 750, [setup_time]() {
+    ESP_LOGI(TAG, "Timeout fired after %" PRIu32 " ms", millis() - setup_time);
+  });
+
+  std::thread([this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    this->enable_requested_at_.store(millis());
+    this->enable_loop_soon_any_context();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    const uint32_t scheduled_at = millis();
+    this->set_timeout("cross_thread", 100, [scheduled_at]() {
+      ESP_LOGI(TAG, "Cross-thread timeout fired after %" PRIu32 " ms", millis() - scheduled_at);
+    });
+  }).detach();
+}
+
+void TicklessIdleComponent::loop() {
+  ESP_LOGI(TAG, "Loop woken after %" PRIu32 " ms", millis() - this->enable_requested_at_.load());
+  this->disable_loop();
+}
+
+}  // namespace tickless_idle_component
+}  // namespace esphome
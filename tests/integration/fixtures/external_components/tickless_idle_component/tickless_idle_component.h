@@ -0,0 +1,21 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+#include <atomic>
+
+namespace esphome {
+namespace tickless_idle_component {
+
+class TicklessIdleComponent : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+ protected:
+  std::atomic<uint32_t> enable_requested_at_{0};
+};
+
+}  // namespace tickless_idle_component
+}  // namespace esphome
@@ -0,0 +1,20 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+
+CODEOWNERS = ["@esphome/tests"]
+DEPENDENCIES = ["sensor"]
+
+worker_loop_component_ns = cg.esphome_ns.namespace("worker_loop_component")
+WorkerLoopComponent = worker_loop_component_ns.class_(
+    "WorkerLoopComponent", sensor.Sensor, cg.Component
+)
+
+CONFIG_SCHEMA = sensor.sensor_schema(WorkerLoopComponent).extend(
+    cv.COMPONENT_SCHEMA
+)
+
+
+async def to_code(config):
+    var = await sensor.new_sensor(config)
+    await cg.register_component(var, config)
@@ -0,0 +1,28 @@
+#include "worker_loop_component.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace worker_loop_component {
+
+static const char *const TAG = "worker_loop_component";
+
+void WorkerLoopComponent::loop() {
+  this->passes_++;
+  if (!this->reported_) {
+    // The logger is not for the worker task, report through the scheduler instead
+    this->reported_ = true;
+    const bool in_worker = App.in_worker_loop();
+    this->defer([in_worker]() { ESP_LOGI(TAG, "loop() running on the worker loop: %s", YESNO(in_worker)); });
+  }
+
+  const uint32_t now = millis();
+  if (now - this->last_publish_ >= 100) {
+    this->last_publish_ = now;
+    this->publish_state(this->passes_);
+  }
+}
+
+}  // namespace worker_loop_component
+}  // namespace esphome
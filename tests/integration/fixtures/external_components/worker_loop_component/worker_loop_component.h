@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace worker_loop_component {
+
+/// Counts its loop() passes and publishes the count from the worker loop.
+class WorkerLoopComponent : public sensor::Sensor, public Component {
+ public:
+  void loop() override;
+  bool is_loop_thread_safe() const override { return true; }
+
+ protected:
+  uint32_t passes_{0};
+  uint32_t last_publish_{0};
+  bool reported_{false};
+};
+
+}  // namespace worker_loop_component
+}  // namespace esphome
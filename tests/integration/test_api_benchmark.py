@@ -0,0 +1,190 @@
+"""Measure native API state throughput and latency with plaintext and Noise frames.
+
+The device publishes a round of values on all synthetic sensors at once and the
+client times the arrival of every state. All traffic goes through a counting TCP
+proxy so bytes and reads per state can be reported as well. Numbers depend on
+the host, run with ``pytest -s`` to see the report and compare them between
+API changes; the assertions only check that every state arrived.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from dataclasses import dataclass
+import statistics
+import time
+
+from aioesphomeapi import EntityState, SensorInfo, SensorState, UserService
+import pytest
+
+from .const import LOCALHOST
+from .types import APIClientFactory, RunCompiledFunction
+
+NOISE_KEY = "N4Yle5YirwZhPiHHsdZLdOA73ndj/84veVaLhTvxCuU="
+
+SENSOR_COUNT = 100
+ROUNDS = 20
+CONNECTS = 5
+
+
+@dataclass
+class ProxyStats:
+    """Traffic from the device to the client."""
+
+    bytes: int = 0
+    reads: int = 0
+
+
+async def _pipe(
+    reader: asyncio.StreamReader,
+    writer: asyncio.StreamWriter,
+    stats: ProxyStats | None,
+) -> None:
+    try:
+        while data := await reader.read(65536):
+            if stats is not None:
+                stats.bytes += len(data)
+                stats.reads += 1
+            writer.write(data)
+            await writer.drain()
+    except ConnectionError:
+        pass
+    finally:
+        writer.close()
+
+
+async def start_counting_proxy(
+    device_port: int, stats: ProxyStats
+) -> asyncio.Server:
+    """Forward a local port to the device, counting what it sends back."""
+
+    async def _handle(
+        client_reader: asyncio.StreamReader, client_writer: asyncio.StreamWriter
+    ) -> None:
+        device_reader, device_writer = await asyncio.open_connection(
+            LOCALHOST, device_port
+        )
+        await asyncio.gather(
+            _pipe(client_reader, device_writer, None),
+            _pipe(device_reader, client_writer, stats),
+        )
+
+    return await asyncio.start_server(_handle, LOCALHOST, 0)
+
+
+def _percentile(values: list[float], percentile: float) -> float:
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(len(ordered) * percentile))
+    return ordered[index]
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize("frame_helper", ["plaintext", "noise"])
+async def test_api_benchmark(
+    frame_helper: str,
+    yaml_config: str,
+    unused_tcp_port: int,
+    run_compiled: RunCompiledFunction,
+    api_client_factory: APIClientFactory,
+) -> None:
+    """Report state throughput, latency and overhead of a frame helper."""
+    noise_psk = NOISE_KEY if frame_helper == "noise" else None
+    encryption = f"encryption:\n    key: {NOISE_KEY}" if noise_psk else ""
+    sensors = "\n".join(
+        f'  - platform: template\n    name: "Bench Sensor {i}"\n'
+        f"    update_interval: never"
+        for i in range(SENSOR_COUNT)
+    )
+    yaml_config = yaml_config.replace("ENCRYPTION_CONFIG", encryption).replace(
+        "SENSORS", sensors
+    )
+
+    stats = ProxyStats()
+    async with run_compiled(yaml_config):
+        proxy = await start_counting_proxy(unused_tcp_port, stats)
+        proxy_port = proxy.sockets[0].getsockname()[1]
+        try:
+            # Connection setup, including the Noise handshake when encrypted
+            connect_times: list[float] = []
+            for _ in range(CONNECTS):
+                async with api_client_factory(
+                    port=proxy_port, noise_psk=noise_psk
+                ) as client:
+                    start = time.perf_counter()
+                    await client.connect(login=True)
+                    connect_times.append(time.perf_counter() - start)
+
+            async with api_client_factory(
+                port=proxy_port, noise_psk=noise_psk
+            ) as client:
+                await client.connect(login=True)
+                entities, services = await client.list_entities_services()
+                sensor_keys = {e.key for e in entities if isinstance(e, SensorInfo)}
+                assert len(sensor_keys) == SENSOR_COUNT
+
+                publish_round: UserService | None = next(
+                    (s for s in services if s.name == "publish_round"), None
+                )
+                assert publish_round is not None, "publish_round action not found"
+
+                loop = asyncio.get_running_loop()
+                current_value = 0.0
+                round_start = 0.0
+                pending: set[int] = set()
+                round_done: asyncio.Future[None] = loop.create_future()
+                initial_done: asyncio.Future[None] = loop.create_future()
+                initial_seen: set[int] = set()
+                latencies: list[float] = []
+
+                def on_state(state: EntityState) -> None:
+                    if not isinstance(state, SensorState):
+                        return
+                    if not initial_done.done():
+                        initial_seen.add(state.key)
+                        if initial_seen == sensor_keys:
+                            initial_done.set_result(None)
+                        return
+                    if state.state != current_value or state.key not in pending:
+                        return
+                    latencies.append(time.perf_counter() - round_start)
+                    pending.discard(state.key)
+                    if not pending and not round_done.done():
+                        round_done.set_result(None)
+
+                client.subscribe_states(on_state)
+                await asyncio.wait_for(initial_done, timeout=10.0)
+
+                stats.bytes = stats.reads = 0
+                bench_start = time.perf_counter()
+                for round_number in range(1, ROUNDS + 1):
+                    current_value = float(round_number)
+                    pending = set(sensor_keys)
+                    round_done = loop.create_future()
+                    round_start = time.perf_counter()
+                    client.execute_service(publish_round, {"value": current_value})
+                    try:
+                        await asyncio.wait_for(round_done, timeout=10.0)
+                    except TimeoutError:
+                        pytest.fail(
+                            f"Round {round_number}: {len(pending)} of "
+                            f"{SENSOR_COUNT} states missing"
+                        )
+                bench_time = time.perf_counter() - bench_start
+        finally:
+            proxy.close()
+            await proxy.wait_closed()
+
+    states = SENSOR_COUNT * ROUNDS
+    assert len(latencies) == states
+
+    # Timings depend on the host, only report them
+    print(
+        f"\nAPI benchmark ({frame_helper}, {SENSOR_COUNT} sensors x {ROUNDS} rounds):\n"
+        f"  Throughput: {states / bench_time:.0f} states/s\n"
+        f"  Latency: p50 {statistics.median(latencies) * 1000:.1f}ms, "
+        f"p99 {_percentile(latencies, 0.99) * 1000:.1f}ms\n"
+        f"  Bytes per state: {stats.bytes / states:.1f}\n"
+        f"  States per read: {states / max(stats.reads, 1):.1f}\n"
+        f"  Connect: median {statistics.median(connect_times) * 1000:.1f}ms, "
+        f"max {max(connect_times) * 1000:.1f}ms"
+    )
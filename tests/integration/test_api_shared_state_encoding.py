@@ -0,0 +1,61 @@
+"""Integration test for state messages encoded once for all API connections."""
+
+from __future__ import annotations
+
+import asyncio
+
+from aioesphomeapi import EntityState, SensorState, TextSensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_api_shared_state_encoding(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Connections sharing an encoding still see every new state, never a stale one."""
+    loop = asyncio.get_running_loop()
+    async with (
+        run_compiled(yaml_config),
+        api_client_connected() as client1,
+        api_client_connected() as client2,
+        api_client_connected() as client3,
+    ):
+        clients = (client1, client2, client3)
+        sensor_values: list[list[float]] = [[] for _ in clients]
+        text_values: list[list[str]] = [[] for _ in clients]
+        done = [loop.create_future() for _ in clients]
+
+        def make_callback(index: int):
+            def on_state(state: EntityState) -> None:
+                if isinstance(state, SensorState) and not state.missing_state:
+                    sensor_values[index].append(state.state)
+                elif isinstance(state, TextSensorState) and not state.missing_state:
+                    text_values[index].append(state.state)
+                if len(sensor_values[index]) >= 10 and not done[index].done():
+                    done[index].set_result(None)
+
+            return on_state
+
+        for index, client in enumerate(clients):
+            client.subscribe_states(make_callback(index))
+
+        try:
+            await asyncio.wait_for(asyncio.gather(*done), timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Not enough states received: {sensor_values}")
+
+        for index in range(len(clients)):
+            values = sensor_values[index]
+            # Each connection sees the counter move forward, a reused stale encoding
+            # would show up as an older value
+            assert values == sorted(values), (
+                f"Client {index + 1} got stale states: {values}"
+            )
+            texts = [float(t) for t in text_values[index]]
+            assert texts == sorted(texts), (
+                f"Client {index + 1} got stale text states: {text_values[index]}"
+            )
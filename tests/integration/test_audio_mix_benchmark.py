@@ -0,0 +1,21 @@
+"""Compare the audio mixing and scaling kernels with per-sample loops."""
+
+from __future__ import annotations
+
+import pytest
+
+from .benchmark_report import run_comparison_benchmark
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_audio_mix_benchmark(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that mixing three sources and ducking matches the per-sample loops."""
+    mismatches = await run_comparison_benchmark(
+        "audio_mix", yaml_config, run_compiled, api_client_connected
+    )
+    assert mismatches == 0, f"{mismatches} mixed samples differ from the loops"
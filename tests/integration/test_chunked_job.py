@@ -0,0 +1,86 @@
+"""Test the ChunkedJob core facility."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_chunked_job(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that jobs run in bounded slices and can cancel themselves from the step."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    finished: dict[str, list[tuple[str, int]]] = {}
+    slow_stats: dict[str, int] = {}
+    slow_future = loop.create_future()
+    failed_future = loop.create_future()
+
+    finish_pattern = re.compile(r"Job (\w+) finished: state=(\w+) steps=(\d+)")
+    slow_pattern = re.compile(
+        r"Job slow slices=(\d+) max_steps_per_slice=(\d+) progress=(\d+)"
+    )
+
+    def check_output(line: str) -> None:
+        if match := finish_pattern.search(line):
+            finished.setdefault(match.group(1), []).append(
+                (match.group(2), int(match.group(3)))
+            )
+            if (
+                "failing" in finished
+                and "bystander" in finished
+                and not failed_future.done()
+            ):
+                failed_future.set_result(True)
+        if match := slow_pattern.search(line):
+            slow_stats["slices"] = int(match.group(1))
+            slow_stats["max_steps_per_slice"] = int(match.group(2))
+            slow_stats["progress"] = int(match.group(3))
+            if not slow_future.done():
+                slow_future.set_result(True)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "chunked-job-test"
+
+        try:
+            await asyncio.wait_for(slow_future, timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Slow job did not finish, got: {finished}")
+
+        # 40 steps of 5ms in 20ms slices
+        assert finished.get("slow") == [("DONE", 40)], finished
+        assert slow_stats["progress"] == 100
+        assert slow_stats["max_steps_per_slice"] <= 5, slow_stats
+        assert slow_stats["slices"] >= 8, slow_stats
+
+        # A cancel from inside the step ends the job once, no further step runs
+        assert finished.get("cancel_continue") == [("CANCELLED", 3)], finished
+        assert finished.get("cancel_done") == [("CANCELLED", 3)], finished
+
+        # Marking the component failed ends all of its jobs as FAILED
+        try:
+            await asyncio.wait_for(failed_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail(f"Failed jobs did not finish, got: {finished}")
+        assert finished["failing"] == [("FAILED", 2)], finished
+        assert [state for state, _ in finished["bystander"]] == ["FAILED"], finished
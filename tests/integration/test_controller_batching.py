@@ -0,0 +1,48 @@
+"""Integration test for the per-loop coalescing of controller state updates."""
+
+from __future__ import annotations
+
+import asyncio
+
+from aioesphomeapi import EntityState, SensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_controller_batching(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """A burst of samples published within one loop reaches the API as one state."""
+    loop = asyncio.get_running_loop()
+    async with run_compiled(yaml_config), api_client_connected() as client:
+        entities, _ = await client.list_entities_services()
+        burst = next(e for e in entities if e.object_id == "burst_sensor")
+
+        values: list[float] = []
+        bursts_done: asyncio.Future[None] = loop.create_future()
+
+        def on_state(state: EntityState) -> None:
+            if not isinstance(state, SensorState) or state.key != burst.key:
+                return
+            if state.missing_state:
+                return
+            values.append(state.state)
+            if len(values) >= 5 and not bursts_done.done():
+                bursts_done.set_result(None)
+
+        client.subscribe_states(on_state)
+
+        try:
+            await asyncio.wait_for(bursts_done, timeout=5.0)
+        except TimeoutError:
+            pytest.fail(f"Received only {len(values)} burst states: {values}")
+
+        # Every burst ends on a multiple of ten, intermediate samples are coalesced
+        partial = [v for v in values if int(v) % 10 != 0]
+        assert not partial, f"Intermediate samples reached the API: {values}"
+        # One state per burst
+        assert len(values) == len(set(values)), f"Duplicate states: {values}"
@@ -0,0 +1,87 @@
+"""Time the core primitives on the host so regressions show up between commits.
+
+Each benchmark reports its operations and total time, recorded as ns per
+operation through benchmark_report. ``script/benchmark`` writes them as JSON
+and compares them with an earlier run.
+"""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .benchmark_report import record_benchmark
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+BENCHMARKS = {
+    "scheduler_set",
+    "scheduler_cancel",
+    "scheduler_call",
+    "callback_dispatch",
+    "proto_encode",
+    "sensor_filters",
+    "logger_format",
+}
+
+
+@pytest.mark.asyncio
+async def test_core_benchmark(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that every benchmark reports, and compare with a baseline if given."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    complete_future: asyncio.Future[None] = loop.create_future()
+    results: dict[str, dict[str, float]] = {}
+    log_lines = 0
+
+    def on_log_line(line: str) -> None:
+        nonlocal log_lines
+        if "[core_benchmark.log" in line:
+            log_lines += 1
+        if match := re.search(r"Benchmark (\w+): (\d+) ops in (\d+) us", line):
+            ops = int(match.group(2))
+            us = int(match.group(3))
+            results[match.group(1)] = {
+                "ops": ops,
+                "us": us,
+                "ns_per_op": us * 1000 / ops if ops else 0.0,
+            }
+        if "Benchmark complete" in line and not complete_future.done():
+            complete_future.set_result(None)
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        _, services = await client.list_entities_services()
+        run_benchmark: UserService | None = next(
+            (s for s in services if s.name == "run_benchmark"), None
+        )
+        assert run_benchmark is not None, "run_benchmark service not found"
+
+        client.execute_service(run_benchmark, {})
+        try:
+            await asyncio.wait_for(complete_future, timeout=30.0)
+        except TimeoutError:
+            pytest.fail("Core benchmark did not complete")
+
+    assert set(results) == BENCHMARKS
+    assert results["scheduler_cancel"]["ops"] == results["scheduler_set"]["ops"]
+    assert log_lines == results["logger_format"]["ops"]
+
+    record_benchmark(
+        "core", {name: result["ns_per_op"] for name, result in results.items()}
+    )
@@ -0,0 +1,101 @@
+"""Measure FPC2532 identify latency, main loop stalls and heap use on the host.
+
+The driver runs against the simulated reader. Each cycle touches an enrolled
+finger and times it until FingerScanMatchedTrigger fires, while a high
+frequency loop tracks the longest main loop iteration. ``ESPHOME_BENCHMARK_CYCLES``
+changes the number of cycles (default 20); results go through benchmark_report.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import os
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .benchmark_report import record_benchmark
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize(
+    ("latency_ms", "match_time_ms"), [(2, 50), (20, 200)], ids=["fast", "slow"]
+)
+async def test_fingerprint_benchmark(
+    latency_ms: int,
+    match_time_ms: int,
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that every identify cycle matches and report the timings."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+    cycles = int(os.environ.get("ESPHOME_BENCHMARK_CYCLES", "20"))
+
+    loop = asyncio.get_running_loop()
+    complete_future: asyncio.Future[int] = loop.create_future()
+    metrics: dict[str, float] = {}
+
+    def on_log_line(line: str) -> None:
+        if match := re.search(
+            r"Benchmark latency: p50 (\d+) us, p95 (\d+) us, max (\d+) us", line
+        ):
+            metrics["latency_p50_us"] = int(match.group(1))
+            metrics["latency_p95_us"] = int(match.group(2))
+            metrics["latency_max_us"] = int(match.group(3))
+        if match := re.search(r"Benchmark stall: p50 (\d+) us, max (\d+) us", line):
+            metrics["stall_p50_us"] = int(match.group(1))
+            metrics["stall_max_us"] = int(match.group(2))
+        if match := re.search(
+            r"Benchmark heap: start (\d+), peak (\d+), end (\d+) bytes", line
+        ):
+            metrics["heap_peak_bytes"] = int(match.group(2)) - int(match.group(1))
+            metrics["heap_growth_bytes"] = int(match.group(3)) - int(match.group(1))
+        if (
+            match := re.search(r"Benchmark complete: (\d+)/\d+ matched", line)
+        ) and not complete_future.done():
+            complete_future.set_result(int(match.group(1)))
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        _, services = await client.list_entities_services()
+        run_benchmark: UserService | None = next(
+            (s for s in services if s.name == "run_benchmark"), None
+        )
+        assert run_benchmark is not None, "run_benchmark service not found"
+
+        client.execute_service(
+            run_benchmark,
+            {
+                "cycles": cycles,
+                "latency_ms": latency_ms,
+                "match_time_ms": match_time_ms,
+            },
+        )
+        # Every cycle takes the match time, the answers and the settle time
+        timeout = 10.0 + cycles * (1.0 + match_time_ms / 1000)
+        try:
+            matched = await asyncio.wait_for(complete_future, timeout=timeout)
+        except TimeoutError:
+            pytest.fail("Fingerprint benchmark did not complete")
+
+    assert matched == cycles, f"Only {matched}/{cycles} cycles matched"
+    # The simulator answers after at least its match time
+    assert metrics["latency_p50_us"] >= match_time_ms * 1000
+    assert "stall_max_us" in metrics
+    assert "heap_peak_bytes" in metrics
+
+    # Heap growth may be negative, it is reported but not compared
+    growth = metrics.pop("heap_growth_bytes")
+    print(f"Heap growth over the run: {growth:+} bytes")
+    record_benchmark(f"fingerprint_{latency_ms}ms_{match_time_ms}ms", metrics)
@@ -0,0 +1,67 @@
+"""Test the per-iteration loop budget of Application::loop()."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_loop_budget(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that slow components are sliced while critical ones run every pass."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    counts: dict[str, int] = {}
+    overruns: list[int] = []
+    report_future = loop.create_future()
+
+    count_pattern = re.compile(r"Loop count (\w+): (\d+)")
+    budget_pattern = re.compile(r"Loop budget 10ms: overruns=(\d+), deferred=(\d+)")
+
+    def check_output(line: str) -> None:
+        if match := count_pattern.search(line):
+            counts[match.group(1)] = int(match.group(2))
+            if len(counts) == 4 and not report_future.done():
+                report_future.set_result(True)
+        if match := budget_pattern.search(line):
+            overruns.append(int(match.group(1)))
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "loop-budget-test"
+
+        try:
+            await asyncio.wait_for(report_future, timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Loop counts not reported, got: {counts}")
+
+        # Each pass runs a single 20ms component before the 10ms budget is spent,
+        # so every slow component only gets about a third of the passes
+        critical = counts["critical"]
+        for name in ("slow_1", "slow_2", "slow_3"):
+            assert counts[name] > 0, f"{name} never ran: {counts}"
+            assert critical >= 2 * counts[name], (
+                f"Expected critical to run on every pass, got {counts}"
+            )
+
+        assert overruns, "No loop budget line in runtime stats"
+        assert max(overruns) > 0, f"Expected budget overruns, got {overruns}"
@@ -0,0 +1,70 @@
+"""Test parallel setup_io() and the boot profile of runtime_stats."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_parallel_setup(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Three 200ms setup_io() of one setup priority overlap instead of adding up."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    setups: list[str] = []
+    io_times: list[int] = []
+    boot_times: list[int] = []
+    profile_done = loop.create_future()
+
+    setup_pattern = re.compile(r"Setup after io: (\w+)")
+    boot_pattern = re.compile(r"Boot profile \(setup finished after (\d+)ms\)")
+    io_pattern = re.compile(
+        r"parallel_setup_component: io=(\d+)ms, setup=\d+ms, wait=\d+ms"
+    )
+
+    def check_output(line: str) -> None:
+        if match := setup_pattern.search(line):
+            setups.append(match.group(1))
+        if match := boot_pattern.search(line):
+            boot_times.append(int(match.group(1)))
+        if match := io_pattern.search(line):
+            io_times.append(int(match.group(1)))
+            if len(io_times) == 3 and not profile_done.done():
+                profile_done.set_result(True)
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "parallel-setup-test"
+
+        try:
+            await asyncio.wait_for(profile_done, timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Boot profile not logged, io times: {io_times}")
+
+        # setup() only runs once setup_io() is done
+        assert setups == ["YES", "YES", "YES"]
+        # Each setup_io() took its own 200ms...
+        for io_time in io_times:
+            assert 190 <= io_time <= 400, f"Unexpected io times: {io_times}"
+        # ...but they ran side by side, serially they alone would take 600ms
+        assert len(boot_times) == 1
+        assert boot_times[0] < 550, f"Boot took {boot_times[0]}ms"
@@ -0,0 +1,94 @@
+"""Compare the heap and timer wheel scheduler backends under named timer churn."""
+
+import asyncio
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize("backend", ["heap", "timer_wheel"])
+async def test_scheduler_benchmark(
+    backend: str,
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that both backends fire, replace and cancel timers identically."""
+
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    ).replace("SCHEDULER_BACKEND", backend)
+
+    loop = asyncio.get_event_loop()
+    test_complete_future: asyncio.Future[None] = loop.create_future()
+    timings: dict[str, int] = {}
+    cancelled = 0
+    intervals_fired = 0
+    short_fired = 0
+    unexpected: list[str] = []
+
+    def on_log_line(line: str) -> None:
+        nonlocal cancelled, intervals_fired, short_fired
+
+        if "should not happen" in line:
+            unexpected.append(line)
+
+        if match := re.search(r"Benchmark (\w+): \d+ items in (\d+) us", line):
+            timings[match.group(1)] = int(match.group(2))
+
+        if match := re.search(r"Benchmark cancelled (\d+)/\d+", line):
+            cancelled = int(match.group(1))
+
+        if match := re.search(r"Benchmark intervals fired (\d+)", line):
+            intervals_fired = int(match.group(1))
+
+        if match := re.search(r"Benchmark complete: (\d+)/\d+", line):
+            short_fired = int(match.group(1))
+            if not test_complete_future.done():
+                test_complete_future.set_result(None)
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-benchmark"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+
+        run_benchmark_service: UserService | None = None
+        for service in services:
+            if service.name == "run_benchmark":
+                run_benchmark_service = service
+                break
+
+        assert run_benchmark_service is not None, "run_benchmark service not found"
+
+        client.execute_service(run_benchmark_service, {})
+
+        try:
+            await asyncio.wait_for(test_complete_future, timeout=10.0)
+        except TimeoutError:
+            pytest.fail(f"Scheduler benchmark with {backend} backend timed out")
+
+        # Timings depend on the host, only report them
+        print(f"Scheduler {backend} backend timings (us): {timings}")
+        assert set(timings) == {"schedule", "replace", "cancel"}
+
+        assert not unexpected, f"Replaced or cancelled timers fired: {unexpected}"
+        assert cancelled == 2000, f"Expected 2000 cancelled timeouts, got {cancelled}"
+        assert short_fired == 200, f"Expected 200 short timeouts, got {short_fired}"
+        assert intervals_fired == 50, (
+            f"Expected 50 interval runs, got {intervals_fired}"
+        )
@@ -0,0 +1,78 @@
+"""Throughput of defer() called concurrently from multiple threads."""
+
+import asyncio
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_defer_throughput(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that every defer from many producer threads runs and report the rate."""
+
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_event_loop()
+    test_complete_future: asyncio.Future[None] = loop.create_future()
+    queued = 0
+    executed = 0
+    executed_us = 0
+
+    def on_log_line(line: str) -> None:
+        nonlocal queued, executed, executed_us
+
+        if match := re.search(r"Throughput: \d+ threads queued (\d+) defers", line):
+            queued = int(match.group(1))
+
+        if match := re.search(r"Throughput: executed (\d+) defers in (\d+)us", line):
+            executed = int(match.group(1))
+            executed_us = int(match.group(2))
+            if not test_complete_future.done():
+                test_complete_future.set_result(None)
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-defer-throughput"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+
+        run_throughput_service: UserService | None = None
+        for service in services:
+            if service.name == "run_throughput_test":
+                run_throughput_service = service
+                break
+
+        assert run_throughput_service is not None, (
+            "run_throughput_test service not found"
+        )
+
+        client.execute_service(run_throughput_service, {})
+
+        try:
+            await asyncio.wait_for(test_complete_future, timeout=10.0)
+        except TimeoutError:
+            pytest.fail("Defer throughput test timed out")
+
+        # The rate depends on the host, only report it
+        print(f"Defer throughput: {executed} defers in {executed_us}us")
+        assert executed == 40000, f"Expected 40000 executed defers, got {executed}"
+        assert queued == 40000, f"Expected 40000 queued defers, got {queued}"
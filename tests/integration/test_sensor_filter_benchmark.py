@@ -0,0 +1,21 @@
+"""Compare the sorted window of the median/quantile filters with copying and sorting."""
+
+from __future__ import annotations
+
+import pytest
+
+from .benchmark_report import run_comparison_benchmark
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_sensor_filter_benchmark(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that the filters match the copy-and-sort results."""
+    mismatches = await run_comparison_benchmark(
+        "sensor_filter", yaml_config, run_compiled, api_client_connected
+    )
+    assert mismatches == 0, f"{mismatches} filter outputs differ from sorting"
@@ -0,0 +1,51 @@
+"""Test that publishing a block of sensor states matches publishing them one by one."""
+
+from __future__ import annotations
+
+import asyncio
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_sensor_publish_states(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that the batch filter path produces the same states as the single path."""
+    loop = asyncio.get_running_loop()
+    result_future: asyncio.Future[tuple[int, int, int]] = loop.create_future()
+
+    def on_log_line(line: str) -> None:
+        if (
+            match := re.search(
+                r"Batch comparison: (\d+) single, (\d+) batch, (\d+) matching", line
+            )
+        ) and not result_future.done():
+            result_future.set_result(tuple(int(g) for g in match.groups()))
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        _, services = await client.list_entities_services()
+        run_comparison: UserService | None = next(
+            (s for s in services if s.name == "run_comparison"), None
+        )
+        assert run_comparison is not None, "run_comparison action not found"
+
+        client.execute_service(run_comparison, {})
+        try:
+            single, batch, matching = await asyncio.wait_for(result_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Batch comparison did not complete")
+
+        # 40 samples, filter_out drops the NaNs and the average sends every second value
+        assert single > 0
+        assert batch == single, f"Batch path sent {batch} states, single path {single}"
+        assert matching == single, f"Only {matching}/{single} states match"
@@ -0,0 +1,55 @@
+"""Test the tickless idle sleep of Application::loop()."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+import pytest
+
+from .types import RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_tickless_idle(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+) -> None:
+    """Test that an idle loop still wakes up for scheduler items and enable requests."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    futures = {
+        "timeout": loop.create_future(),
+        "loop": loop.create_future(),
+        "cross_thread": loop.create_future(),
+    }
+    patterns = {
+        "timeout": re.compile(r"Timeout fired after (\d+) ms"),
+        "loop": re.compile(r"Loop woken after (\d+) ms"),
+        "cross_thread": re.compile(r"Cross-thread timeout fired after (\d+) ms"),
+    }
+
+    def check_output(line: str) -> None:
+        for key, pattern in patterns.items():
+            if (match := pattern.search(line)) and not futures[key].done():
+                futures[key].set_result(int(match.group(1)))
+
+    async with run_compiled(yaml_config, line_callback=check_output):
+        try:
+            await asyncio.wait_for(asyncio.gather(*futures.values()), timeout=5.0)
+        except TimeoutError:
+            done = {key: f.result() for key, f in futures.items() if f.done()}
+            pytest.fail(f"Not all events fired, got: {done}")
+
+    # The sleep ends at the scheduler deadline, not a loop interval later
+    assert 740 <= futures["timeout"].result() < 800
+    # Without a wakeup the loop would only notice these when the 750ms timeout is due
+    assert futures["loop"].result() < 50
+    assert 90 <= futures["cross_thread"].result() < 150
@@ -0,0 +1,72 @@
+"""Test components with a thread-safe loop() running on the worker loop."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+from aioesphomeapi import EntityState, SensorInfo, SensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_worker_loop(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that the worker loop runs the component and its states reach the API."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    worker_future = loop.create_future()
+    worker_pattern = re.compile(r"loop\(\) running on the worker loop: (YES|NO)")
+
+    def check_output(line: str) -> None:
+        if (match := worker_pattern.search(line)) and not worker_future.done():
+            worker_future.set_result(match.group(1))
+
+    async with (
+        run_compiled(yaml_config, line_callback=check_output),
+        api_client_connected() as client,
+    ):
+        entities, _ = await client.list_entities_services()
+        sensor = next(
+            (e for e in entities if isinstance(e, SensorInfo)),
+            None,
+        )
+        assert sensor is not None, "Worker Passes sensor not found"
+
+        values: list[float] = []
+        states_future = loop.create_future()
+
+        def on_state(state: EntityState) -> None:
+            if not isinstance(state, SensorState) or state.key != sensor.key:
+                return
+            values.append(state.state)
+            if len(values) >= 5 and not states_future.done():
+                states_future.set_result(True)
+
+        client.subscribe_states(on_state)
+
+        try:
+            in_worker = await asyncio.wait_for(worker_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Worker loop component never reported")
+        assert in_worker == "YES"
+
+        # States published on the worker task are handed to the API on the main loop
+        try:
+            await asyncio.wait_for(states_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail(f"Expected 5 sensor states, got {values}")
+        assert values == sorted(values), f"Pass count went backwards: {values}"
+        assert values[-1] > values[0]
@@ -0,0 +1,70 @@
+from unittest.mock import Mock
+
+import pytest
+
+from esphome import automation, codegen as cg
+from esphome.const import CONF_TYPE_ID
+from esphome.core import ID
+
+
+def _action(name: str, id_: str) -> dict:
+    return {name: None, CONF_TYPE_ID: ID(id_, True, automation.Action)}
+
+
+@pytest.fixture
+def built(monkeypatch) -> list[str]:
+    """Builds every action as its ID and every SequenceAction as a list of them."""
+    names: list[str] = []
+
+    async def build_action(config, templ, args):
+        names.append(config[CONF_TYPE_ID].id)
+        return config[CONF_TYPE_ID].id
+
+    monkeypatch.setattr(automation, "build_action", build_action)
+    monkeypatch.setattr(
+        cg, "new_Pvariable", Mock(side_effect=lambda id_, templ, actions: actions)
+    )
+    return names
+
+
+@pytest.mark.asyncio
+async def test_build_action_list__sequences_synchronous_actions(built):
+    actions = await automation.build_action_list(
+        [
+            _action("lambda", "first"),
+            _action("lambda", "second"),
+            _action("delay", "wait"),
+            _action("lambda", "third"),
+        ],
+        cg.TemplateArguments(),
+        [],
+    )
+
+    assert actions == [["first", "second"], "wait", "third"]
+    cg.new_Pvariable.assert_called_once()
+    assert cg.new_Pvariable.call_args.args[0].id == "first_sequence"
+
+
+@pytest.mark.asyncio
+async def test_build_action_list__keeps_lambdas_separate(built):
+    # Each lambda is its own action, so the sequence can stop after any of them
+    actions = await automation.build_action_list(
+        [_action("lambda", "first"), _action("lambda", "second")],
+        cg.TemplateArguments(),
+        [],
+    )
+
+    assert actions == [["first", "second"]]
+    assert built == ["first", "second"]
+
+
+@pytest.mark.asyncio
+async def test_build_action_list__no_synchronous_actions(built):
+    actions = await automation.build_action_list(
+        [_action("delay", "wait"), _action("delay", "wait_again")],
+        cg.TemplateArguments(),
+        [],
+    )
+
+    assert actions == ["wait", "wait_again"]
+    cg.new_Pvariable.assert_not_called()
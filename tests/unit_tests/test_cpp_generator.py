@@ -292,3 +292,20 @@ class TestMockObj:
         assert isinstance(actual, cg.MockObj)
         assert actual.base == "foo.eek"
         assert actual.op == "."
+
+
+@pytest.mark.parametrize(
+    "type_, expected",
+    (
+        (ct.Component, True),
+        (ct.PollingComponent, True),
+        (ct.esphome_ns.namespace("foo").class_("Foo", ct.PollingComponent), True),
+        (ct.esphome_ns.namespace("sensor").class_("Sensor", ct.EntityBase), True),
+        (ct.esphome_ns.class_("Trigger").template(ct.float_), True),
+        (ct.esphome_ns.class_("Automation").template(), True),
+        (ct.esphome_ns.namespace("sensor").class_("Filter"), False),
+        (ct.uint8, False),
+    ),
+)
+def test_uses_setup_arena(type_, expected):
+    assert cg.uses_setup_arena(type_) is expected
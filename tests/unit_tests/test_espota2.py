@@ -248,12 +248,13 @@ def test_perform_ota_successful_md5_auth(
     # Verify magic bytes were sent
     assert mock_socket.sendall.call_args_list[0] == call(bytes(espota2.MAGIC_BYTES))
 
-    # Verify features were sent (compression + SHA256 support)
+    # Verify features were sent (compression, SHA256 and delta support)
     assert mock_socket.sendall.call_args_list[1] == call(
         bytes(
             [
                 espota2.FEATURE_SUPPORTS_COMPRESSION
                 | espota2.FEATURE_SUPPORTS_SHA256_AUTH
+                | espota2.FEATURE_SUPPORTS_DELTA
             ]
         )
     )
@@ -615,12 +616,13 @@ def test_perform_ota_successful_sha256_auth(
     # Verify magic bytes were sent
     assert mock_socket.sendall.call_args_list[0] == call(bytes(espota2.MAGIC_BYTES))
 
-    # Verify features were sent (compression + SHA256 support)
+    # Verify features were sent (compression, SHA256 and delta support)
     assert mock_socket.sendall.call_args_list[1] == call(
         bytes(
             [
                 espota2.FEATURE_SUPPORTS_COMPRESSION
                 | espota2.FEATURE_SUPPORTS_SHA256_AUTH
+                | espota2.FEATURE_SUPPORTS_DELTA
             ]
         )
     )
@@ -673,6 +675,7 @@ def test_perform_ota_sha256_fallback_to_md5(
             [
                 espota2.FEATURE_SUPPORTS_COMPRESSION
                 | espota2.FEATURE_SUPPORTS_SHA256_AUTH
+                | espota2.FEATURE_SUPPORTS_DELTA
             ]
         )
     )
@@ -736,3 +739,117 @@ def test_perform_ota_version_differences(
 
     # For v2.0, verify more recv calls due to chunk acknowledgments
     assert mock_socket.recv.call_count == 9  # v2.0 has 9 recv calls (includes chunk OK)
+
+
+def _make_image(body: bytes) -> bytes:
+    """Build an ESP32 app image with an appended SHA256 from body."""
+    image = bytearray(body)
+    image[0] = 0xE9
+    image[23] = 1
+    return bytes(image) + hashlib.sha256(image).digest()
+
+
+def _apply_delta(base: bytes, delta: bytes) -> bytes:
+    """Rebuild an image the way OTADeltaDecoder does."""
+    assert delta[:4] == espota2.DELTA_MAGIC
+    out = bytearray()
+    pos = 4 + espota2.DELTA_DIGEST_SIZE
+    while pos < len(delta):
+        if delta[pos] == ord("C"):
+            offset, length = struct.unpack_from("<II", delta, pos + 1)
+            out += base[offset : offset + length]
+            pos += 9
+        else:
+            assert delta[pos] == ord("D")
+            (length,) = struct.unpack_from("<I", delta, pos + 1)
+            out += delta[pos + 5 : pos + 5 + length]
+            pos += 5 + length
+    return bytes(out)
+
+
+def _image_pair() -> tuple[bytes, bytes]:
+    body = bytes(range(256)) * 400
+    changed = bytearray(body)
+    changed[1000:1000] = b"inserted code" * 10
+    changed[50000:50016] = b"patched constant"
+    return _make_image(body), _make_image(bytes(changed))
+
+
+def test_image_digest() -> None:
+    """Test the appended image digest is only returned when valid."""
+    base, _ = _image_pair()
+    assert espota2.image_digest(base) == base[-32:]
+    assert espota2.image_digest(base[:-1] + b"\x00") is None
+    assert espota2.image_digest(b"firmware content here") is None
+
+
+def test_make_delta_roundtrip() -> None:
+    """Test a delta rebuilds the new image and is much smaller than it."""
+    base, target = _image_pair()
+    delta = espota2.make_delta(base, base[-32:], target)
+
+    assert delta[4 : 4 + espota2.DELTA_DIGEST_SIZE] == base[-32:]
+    assert _apply_delta(base, delta) == target
+    assert len(delta) < len(target) // 10
+
+
+@pytest.mark.usefixtures("mock_time")
+def test_perform_ota_with_delta(mock_socket: Mock, tmp_path: Path) -> None:
+    """Test OTA sends a delta when the running image was uploaded before."""
+    base, target = _image_pair()
+    filename = tmp_path / "firmware.bin"
+    espota2.store_delta_base(filename, base)
+
+    recv_responses = [
+        bytes([espota2.RESPONSE_OK]),  # First byte of version response
+        bytes([espota2.OTA_VERSION_1_0]),  # Version number
+        bytes([espota2.RESPONSE_SUPPORTS_DELTA]),  # Device supports delta
+        base[-32:],  # Running image digest
+        bytes([espota2.RESPONSE_AUTH_OK]),  # No auth required
+        bytes([espota2.RESPONSE_UPDATE_PREPARE_OK]),  # Binary size OK
+        bytes([espota2.RESPONSE_BIN_MD5_OK]),  # MD5 checksum OK
+        bytes([espota2.RESPONSE_RECEIVE_OK]),  # Receive OK
+        bytes([espota2.RESPONSE_UPDATE_END_OK]),  # Update end OK
+    ]
+    mock_socket.recv.side_effect = recv_responses
+
+    espota2.perform_ota(mock_socket, None, io.BytesIO(target), filename)
+
+    delta = espota2.make_delta(base, base[-32:], target)
+    sent = mock_socket.sendall.call_args_list
+    assert struct.unpack(">I", sent[2][0][0])[0] == len(delta)
+    assert struct.unpack(">I", sent[3][0][0])[0] == len(target)
+    # The device verifies the rebuilt image
+    assert sent[4] == call(hashlib.md5(target).hexdigest().encode())
+    assert b"".join(c[0][0] for c in sent[5:-1]) == delta
+    # The new image is kept as the base of the next delta
+    assert espota2.load_delta_base(filename, target[-32:]) == target
+
+
+@pytest.mark.usefixtures("mock_time")
+def test_perform_ota_delta_unknown_base(mock_socket: Mock, tmp_path: Path) -> None:
+    """Test OTA falls back to the full image when the running image is unknown."""
+    base, target = _image_pair()
+    filename = tmp_path / "firmware.bin"
+
+    recv_responses = [
+        bytes([espota2.RESPONSE_OK]),  # First byte of version response
+        bytes([espota2.OTA_VERSION_1_0]),  # Version number
+        bytes([espota2.RESPONSE_SUPPORTS_DELTA]),  # Device supports delta
+        base[-32:],  # Running image digest
+        bytes([espota2.RESPONSE_AUTH_OK]),  # No auth required
+        bytes([espota2.RESPONSE_UPDATE_PREPARE_OK]),  # Binary size OK
+        bytes([espota2.RESPONSE_BIN_MD5_OK]),  # MD5 checksum OK
+        bytes([espota2.RESPONSE_RECEIVE_OK]),  # Receive OK
+        bytes([espota2.RESPONSE_UPDATE_END_OK]),  # Update end OK
+    ]
+    mock_socket.recv.side_effect = recv_responses
+
+    espota2.perform_ota(mock_socket, None, io.BytesIO(target), filename)
+
+    sent = mock_socket.sendall.call_args_list
+    assert struct.unpack(">I", sent[2][0][0])[0] == len(target)
+    # An image size of 0 tells the device a full image follows
+    assert struct.unpack(">I", sent[3][0][0])[0] == 0
+    assert sent[4] == call(hashlib.md5(target).hexdigest().encode())
+    assert espota2.load_delta_base(filename, target[-32:]) == target